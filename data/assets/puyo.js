@@ -206,6 +206,8 @@ function displayGameState(json) {
     setOjama(document.getElementById('ojama-1'), json.o1);
     // p1 set message
     setMessage(document.getElementById('player1-message'), json.m1);
+    // p1 think latency
+    setMessage(document.getElementById('latency-1'), json.l1);
 
     // p2
     for (var i = 0; i < json.p2.length; ++i) {
@@ -225,4 +227,6 @@ function displayGameState(json) {
     setOjama(document.getElementById('ojama-2'), json.o2);
     // p2 set message
     setMessage(document.getElementById('player2-message'), json.m2);
+    // p2 think latency
+    setMessage(document.getElementById('latency-2'), json.l2);
 }
@@ -0,0 +1,173 @@
+#include "base/benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <glog/logging.h>
+
+#include "base/time_stamp_counter.h"
+
+using namespace std;
+
+namespace {
+
+const char WARMUPS_ENV[] = "PUYOAI_BENCHMARK_WARMUPS";
+const char OUTPUT_ENV[] = "PUYOAI_BENCHMARK_OUTPUT";
+
+template<typename T>
+double medianOf(vector<T> xs)
+{
+    if (xs.empty())
+        return 0.0;
+
+    sort(xs.begin(), xs.end());
+    size_t n = xs.size();
+    if (n % 2 == 1)
+        return xs[n / 2];
+    return (static_cast<double>(xs[n / 2 - 1]) + xs[n / 2]) / 2;
+}
+
+string escapeJson(const string& s)
+{
+    string result;
+    for (char c : s) {
+        if (c == '"' || c == '\\')
+            result += '\\';
+        result += c;
+    }
+    return result;
+}
+
+}
+
+// static
+BenchmarkResult BenchmarkResult::fromSamples(const string& name, vector<unsigned long long> samples)
+{
+    BenchmarkResult result;
+    result.name = name;
+    result.size = static_cast<int>(samples.size());
+    if (samples.empty())
+        return result;
+
+    double sum = 0.0;
+    for (auto x : samples)
+        sum += x;
+    result.mean = sum / samples.size();
+
+    double diffSquareSum = 0.0;
+    for (auto x : samples)
+        diffSquareSum += (x - result.mean) * (x - result.mean);
+    result.deviation = sqrt(diffSquareSum / samples.size());
+
+    result.min = *min_element(samples.begin(), samples.end());
+    result.median = medianOf(std::move(samples));
+    return result;
+}
+
+string BenchmarkResult::toJson() const
+{
+    ostringstream oss;
+    oss << "{\"name\": \"" << escapeJson(name) << "\""
+        << ", \"size\": " << size
+        << ", \"min\": " << min
+        << ", \"median\": " << median
+        << ", \"mean\": " << mean
+        << ", \"deviation\": " << deviation
+        << "}";
+    return oss.str();
+}
+
+string BenchmarkResult::toString() const
+{
+    ostringstream oss;
+    oss << name << ":" << endl
+        << "        N = " << size << endl
+        << "      min = " << min << endl
+        << "   median = " << median << endl
+        << "  average = " << mean << endl
+        << "deviation = " << deviation << endl;
+    return oss.str();
+}
+
+// static
+BenchmarkResult Benchmark::report(const string& name, const TimeStampCounterData& tsc)
+{
+    const vector<unsigned long long>& data = tsc.data();
+
+    size_t warmups = data.size() / 10;
+    if (const char* s = getenv(WARMUPS_ENV))
+        warmups = atoi(s);
+    if (!data.empty())
+        warmups = std::min(warmups, data.size() - 1);
+
+    BenchmarkResult result = BenchmarkResult::fromSamples(
+        name, vector<unsigned long long>(data.begin() + std::min(warmups, data.size()), data.end()));
+    cout << result.toString();
+
+    if (const char* path = getenv(OUTPUT_ENV)) {
+        ofstream ofs(path, ios::out | ios::app);
+        if (!ofs) {
+            LOG(ERROR) << "failed to open " << path;
+            return result;
+        }
+        ofs << result.toJson() << endl;
+    }
+
+    return result;
+}
+
+// static
+map<string, BenchmarkResult> Benchmark::merge(const vector<BenchmarkResult>& results)
+{
+    map<string, vector<const BenchmarkResult*>> grouped;
+    for (const auto& r : results)
+        grouped[r.name].push_back(&r);
+
+    map<string, BenchmarkResult> merged;
+    for (const auto& entry : grouped) {
+        vector<double> mins, medians, means, deviations;
+        BenchmarkResult r;
+        r.name = entry.first;
+        for (const BenchmarkResult* x : entry.second) {
+            r.size += x->size;
+            mins.push_back(x->min);
+            medians.push_back(x->median);
+            means.push_back(x->mean);
+            deviations.push_back(x->deviation);
+        }
+        r.min = *min_element(mins.begin(), mins.end());
+        r.median = medianOf(medians);
+        r.mean = medianOf(means);
+        r.deviation = medianOf(deviations);
+        merged.emplace(r.name, r);
+    }
+
+    return merged;
+}
+
+// static
+vector<BenchmarkComparison> Benchmark::compare(const map<string, BenchmarkResult>& baseline,
+                                               const map<string, BenchmarkResult>& current,
+                                               double threshold)
+{
+    vector<BenchmarkComparison> comparisons;
+    for (const auto& entry : current) {
+        BenchmarkComparison c;
+        c.name = entry.first;
+        c.currentMedian = entry.second.median;
+
+        auto it = baseline.find(entry.first);
+        if (it != baseline.end() && it->second.median > 0) {
+            c.baselineMedian = it->second.median;
+            c.ratio = c.currentMedian / c.baselineMedian;
+            c.regressed = c.ratio > 1.0 + threshold;
+        }
+        comparisons.push_back(c);
+    }
+
+    return comparisons;
+}
@@ -0,0 +1,61 @@
+#ifndef BASE_BENCHMARK_H_
+#define BASE_BENCHMARK_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+class TimeStampCounterData;
+
+// BenchmarkResult is the statistics of a benchmark. The unit is CPU cycles.
+struct BenchmarkResult {
+    // Calculates the statistics of |samples|.
+    static BenchmarkResult fromSamples(const std::string& name, std::vector<unsigned long long> samples);
+
+    // Returns a JSON object in one line.
+    std::string toJson() const;
+    std::string toString() const;
+
+    std::string name;
+    int size = 0;
+    double min = 0.0;
+    double median = 0.0;
+    double mean = 0.0;
+    double deviation = 0.0;
+};
+
+struct BenchmarkComparison {
+    std::string name;
+    // 0 if the benchmark is not in the baseline.
+    double baselineMedian = 0.0;
+    double currentMedian = 0.0;
+    // currentMedian / baselineMedian. 0 if the benchmark is not in the baseline.
+    double ratio = 0.0;
+    bool regressed = false;
+};
+
+// Benchmark collects the results of the performance tests.
+//
+// Performance tests measure with TimeStampCounterData, and call report().
+// report() drops the first samples as warmup, shows the statistics,
+// and appends the result to a JSON lines file. These are controlled with
+// environment variables, because most performance tests don't parse flags.
+//   PUYOAI_BENCHMARK_WARMUPS: the number of samples to drop. (default: 10% of samples)
+//   PUYOAI_BENCHMARK_OUTPUT: the file to append the results.
+// To repeat the whole benchmark, run the performance tests with --gtest_repeat.
+class Benchmark {
+public:
+    static BenchmarkResult report(const std::string& name, const TimeStampCounterData&);
+
+    // Merges the results having the same name (e.g. repetitions).
+    // The median of the medians is taken, so an occasional noisy repetition is ignored.
+    static std::map<std::string, BenchmarkResult> merge(const std::vector<BenchmarkResult>&);
+
+    // Compares |current| with |baseline|. A benchmark is regressed when its median
+    // is larger than the baseline median by more than |threshold| (e.g. 0.1 for 10%).
+    static std::vector<BenchmarkComparison> compare(const std::map<std::string, BenchmarkResult>& baseline,
+                                                     const std::map<std::string, BenchmarkResult>& current,
+                                                     double threshold);
+};
+
+#endif // BASE_BENCHMARK_H_
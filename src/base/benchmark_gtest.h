@@ -0,0 +1,21 @@
+#ifndef BASE_BENCHMARK_GTEST_H_
+#define BASE_BENCHMARK_GTEST_H_
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "base/benchmark.h"
+
+// Reports |tsc| as the benchmark named after the running test, e.g. "PlanPerformanceTest.Empty44".
+// When a test measures several things, |label| is appended to the name.
+inline BenchmarkResult reportTestBenchmark(const TimeStampCounterData& tsc, const std::string& label = std::string())
+{
+    const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+    std::string name = std::string(info->test_case_name()) + "." + info->name();
+    if (!label.empty())
+        name += "/" + label;
+    return Benchmark::report(name, tsc);
+}
+
+#endif // BASE_BENCHMARK_GTEST_H_
@@ -0,0 +1,111 @@
+#include "base/benchmark.h"
+
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "base/time_stamp_counter.h"
+
+using namespace std;
+
+namespace {
+
+BenchmarkResult makeResult(const string& name, double median)
+{
+    BenchmarkResult r;
+    r.name = name;
+    r.size = 1;
+    r.min = median;
+    r.median = median;
+    r.mean = median;
+    return r;
+}
+
+}
+
+TEST(BenchmarkTest, fromSamples)
+{
+    BenchmarkResult r = BenchmarkResult::fromSamples("a", vector<unsigned long long> { 5, 1, 3, 9 });
+    EXPECT_EQ("a", r.name);
+    EXPECT_EQ(4, r.size);
+    EXPECT_DOUBLE_EQ(1.0, r.min);
+    EXPECT_DOUBLE_EQ(4.0, r.median);
+    EXPECT_DOUBLE_EQ(4.5, r.mean);
+    EXPECT_GT(r.deviation, 0.0);
+}
+
+TEST(BenchmarkTest, fromSamplesEmpty)
+{
+    BenchmarkResult r = BenchmarkResult::fromSamples("a", vector<unsigned long long>());
+    EXPECT_EQ(0, r.size);
+    EXPECT_DOUBLE_EQ(0.0, r.median);
+}
+
+TEST(BenchmarkTest, toJson)
+{
+    BenchmarkResult r = makeResult("Test.a \"b\"", 10);
+    EXPECT_EQ("{\"name\": \"Test.a \\\"b\\\"\", \"size\": 1, \"min\": 10, \"median\": 10, \"mean\": 10, \"deviation\": 0}",
+              r.toJson());
+}
+
+TEST(BenchmarkTest, reportDropsWarmups)
+{
+    setenv("PUYOAI_BENCHMARK_WARMUPS", "2", 1);
+
+    TimeStampCounterData tsc;
+    tsc.add(1000);
+    tsc.add(1000);
+    tsc.add(10);
+    tsc.add(20);
+    tsc.add(30);
+
+    BenchmarkResult r = Benchmark::report("a", tsc);
+    EXPECT_EQ(3, r.size);
+    EXPECT_DOUBLE_EQ(20.0, r.median);
+
+    unsetenv("PUYOAI_BENCHMARK_WARMUPS");
+}
+
+TEST(BenchmarkTest, merge)
+{
+    vector<BenchmarkResult> results {
+        makeResult("a", 10),
+        makeResult("a", 100),
+        makeResult("a", 12),
+        makeResult("b", 5),
+    };
+
+    map<string, BenchmarkResult> merged = Benchmark::merge(results);
+    ASSERT_EQ(2U, merged.size());
+    EXPECT_EQ(3, merged["a"].size);
+    EXPECT_DOUBLE_EQ(10.0, merged["a"].min);
+    EXPECT_DOUBLE_EQ(12.0, merged["a"].median);
+    EXPECT_DOUBLE_EQ(5.0, merged["b"].median);
+}
+
+TEST(BenchmarkTest, compare)
+{
+    map<string, BenchmarkResult> baseline {
+        { "fast", makeResult("fast", 100) },
+        { "slow", makeResult("slow", 100) },
+    };
+    map<string, BenchmarkResult> current {
+        { "fast", makeResult("fast", 105) },
+        { "slow", makeResult("slow", 120) },
+        { "new", makeResult("new", 50) },
+    };
+
+    map<string, BenchmarkComparison> comparisons;
+    for (const auto& c : Benchmark::compare(baseline, current, 0.1))
+        comparisons[c.name] = c;
+
+    ASSERT_EQ(3U, comparisons.size());
+    EXPECT_FALSE(comparisons["fast"].regressed);
+    EXPECT_DOUBLE_EQ(1.05, comparisons["fast"].ratio);
+    EXPECT_TRUE(comparisons["slow"].regressed);
+    EXPECT_FALSE(comparisons["new"].regressed);
+    EXPECT_DOUBLE_EQ(0.0, comparisons["new"].baselineMedian);
+}
@@ -22,6 +22,12 @@ public:
     void push(const T& v);
     T take();
 
+    // Return true if succeeded, false if timeout. |v| is not moved on timeout.
+    bool pushWithTimeout(const std::chrono::steady_clock::time_point& timeout, T&& v);
+    // Pushes |v| without blocking. When the queue is full, the oldest element is
+    // moved to |dropped| to make room. Returns true if an element was dropped.
+    bool pushDroppingOldest(T&& v, T* dropped);
+
     // Return true if succeeded, false if timeout.
     bool takeWithTimeout(const std::chrono::steady_clock::time_point& timeout, T* v);
     bool takeWithTimeout(const std::chrono::seconds& d, T* v);
@@ -85,6 +91,34 @@ void BlockingQueue<T>::push(const T& v)
     take_cond_var_.notify_one();
 }
 
+template<typename T>
+bool BlockingQueue<T>::pushWithTimeout(const std::chrono::steady_clock::time_point& timeout, T&& v)
+{
+    std::unique_lock<std::mutex> lock(mu_);
+    if (!push_cond_var_.wait_until(lock, timeout, [this]() { return q_.size() < capacity_; })) {
+        return false;
+    }
+
+    q_.push(std::move(v));
+    take_cond_var_.notify_one();
+    return true;
+}
+
+template<typename T>
+bool BlockingQueue<T>::pushDroppingOldest(T&& v, T* dropped)
+{
+    std::unique_lock<std::mutex> lock(mu_);
+    bool full = capacity_ <= q_.size();
+    if (full) {
+        *dropped = std::move(q_.front());
+        q_.pop();
+    }
+
+    q_.push(std::move(v));
+    take_cond_var_.notify_one();
+    return full;
+}
+
 template<typename T>
 T BlockingQueue<T>::take()
 {
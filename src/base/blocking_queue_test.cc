@@ -58,3 +58,38 @@ TEST(BlockingQueue, producer_consumer)
     producer.join();
     consumer.join();
 }
+
+TEST(BlockingQueue, pushWithTimeout)
+{
+    base::BlockingQueue<int> q(1);
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+    EXPECT_TRUE(q.pushWithTimeout(timeout, 1));
+
+    timeout = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+    EXPECT_FALSE(q.pushWithTimeout(timeout, 2));
+    EXPECT_EQ(1U, q.size());
+
+    EXPECT_EQ(1, q.take());
+
+    timeout = std::chrono::steady_clock::now() + std::chrono::milliseconds(10);
+    EXPECT_TRUE(q.pushWithTimeout(timeout, 3));
+    EXPECT_EQ(3, q.take());
+}
+
+TEST(BlockingQueue, pushDroppingOldest)
+{
+    base::BlockingQueue<int> q(2);
+    int dropped = -1;
+
+    EXPECT_FALSE(q.pushDroppingOldest(1, &dropped));
+    EXPECT_FALSE(q.pushDroppingOldest(2, &dropped));
+    EXPECT_EQ(-1, dropped);
+
+    EXPECT_TRUE(q.pushDroppingOldest(3, &dropped));
+    EXPECT_EQ(1, dropped);
+    EXPECT_EQ(2U, q.size());
+
+    EXPECT_EQ(2, q.take());
+    EXPECT_EQ(3, q.take());
+}
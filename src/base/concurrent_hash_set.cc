@@ -0,0 +1,53 @@
+#include "base/concurrent_hash_set.h"
+
+#include <glog/logging.h>
+
+using namespace std;
+
+ConcurrentHashSet::ConcurrentHashSet(int numShards) :
+    numShards_(numShards),
+    shards_(new Shard[numShards])
+{
+    CHECK_GT(numShards, 0);
+}
+
+ConcurrentHashSet::Shard& ConcurrentHashSet::shard(size_t h) const
+{
+    // Field hashes often differ only in their high bits, so mix them before taking the modulo.
+    h ^= h >> 29;
+    h *= 0x9E3779B97F4A7C15ULL;
+    h ^= h >> 32;
+    return shards_[h % numShards_];
+}
+
+bool ConcurrentHashSet::insert(size_t h)
+{
+    Shard& s = shard(h);
+    lock_guard<mutex> lock(s.mu);
+    return s.values.insert(h).second;
+}
+
+bool ConcurrentHashSet::contains(size_t h) const
+{
+    Shard& s = shard(h);
+    lock_guard<mutex> lock(s.mu);
+    return s.values.count(h) > 0;
+}
+
+void ConcurrentHashSet::clear()
+{
+    for (int i = 0; i < numShards_; ++i) {
+        lock_guard<mutex> lock(shards_[i].mu);
+        shards_[i].values.clear();
+    }
+}
+
+size_t ConcurrentHashSet::size() const
+{
+    size_t n = 0;
+    for (int i = 0; i < numShards_; ++i) {
+        lock_guard<mutex> lock(shards_[i].mu);
+        n += shards_[i].values.size();
+    }
+    return n;
+}
@@ -0,0 +1,37 @@
+#ifndef BASE_CONCURRENT_HASH_SET_H_
+#define BASE_CONCURRENT_HASH_SET_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include "base/noncopyable.h"
+
+// ConcurrentHashSet is a set of hash values that can be updated from several threads.
+// The set is split into shards, and each shard has its own mutex, so threads
+// inserting different values rarely wait for each other.
+class ConcurrentHashSet : noncopyable {
+public:
+    explicit ConcurrentHashSet(int numShards = 64);
+
+    // Returns true if |h| is newly inserted.
+    bool insert(size_t h);
+    bool contains(size_t h) const;
+
+    void clear();
+    size_t size() const;
+
+private:
+    struct Shard {
+        mutable std::mutex mu;
+        std::unordered_set<size_t> values;
+    };
+
+    Shard& shard(size_t h) const;
+
+    const int numShards_;
+    std::unique_ptr<Shard[]> shards_;
+};
+
+#endif // BASE_CONCURRENT_HASH_SET_H_
@@ -0,0 +1,48 @@
+#include "base/concurrent_hash_set.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std;
+
+TEST(ConcurrentHashSetTest, insert)
+{
+    ConcurrentHashSet set;
+    EXPECT_TRUE(set.insert(1));
+    EXPECT_TRUE(set.insert(2));
+    EXPECT_FALSE(set.insert(1));
+    EXPECT_TRUE(set.contains(2));
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_EQ(2U, set.size());
+
+    set.clear();
+    EXPECT_EQ(0U, set.size());
+    EXPECT_TRUE(set.insert(1));
+}
+
+TEST(ConcurrentHashSetTest, insertFromThreads)
+{
+    const int NUM_THREADS = 4;
+    const size_t NUM_VALUES = 10000;
+
+    ConcurrentHashSet set(8);
+    atomic<int> numInserted(0);
+    vector<thread> threads;
+    for (int i = 0; i < NUM_THREADS; ++i) {
+        threads.emplace_back([&]() {
+            // All threads try to insert the same values. Each value should be inserted once.
+            for (size_t v = 0; v < NUM_VALUES; ++v) {
+                if (set.insert(v << 32))
+                    ++numInserted;
+            }
+        });
+    }
+    for (auto& th : threads)
+        th.join();
+
+    EXPECT_EQ(static_cast<int>(NUM_VALUES), numInserted.load());
+    EXPECT_EQ(NUM_VALUES, set.size());
+}
@@ -7,6 +7,11 @@ DEFINE_int32(num_threads, 1, "The default number of threads");
 
 using namespace std;
 
+namespace {
+thread_local const Executor* currentExecutor = nullptr;
+thread_local int currentExecutorWorkerIndex = -1;
+}
+
 // static
 unique_ptr<Executor> Executor::makeDefaultExecutor(bool automaticStart)
 {
@@ -36,8 +41,8 @@ void Executor::start()
     hasStarted_ = true;
 
     for (size_t i = 0; i < threads_.size(); ++i) {
-        threads_[i] = thread([this]() {
-                runWorkerLoop();
+        threads_[i] = thread([this, i]() {
+                runWorkerLoop(static_cast<int>(i));
         });
     }
 }
@@ -64,8 +69,16 @@ void Executor::submit(Executor::Func f)
     condVar_.notify_one();
 }
 
-void Executor::runWorkerLoop()
+int Executor::currentWorkerIndex() const
+{
+    return currentExecutor == this ? currentExecutorWorkerIndex : -1;
+}
+
+void Executor::runWorkerLoop(int workerIndex)
 {
+    currentExecutor = this;
+    currentExecutorWorkerIndex = workerIndex;
+
     while (true) {
         Func f = take();
         if (!f)
@@ -28,8 +28,13 @@ public:
 
     void submit(Func);
 
+    int numThreads() const { return static_cast<int>(threads_.size()); }
+    // Returns the index (in [0, numThreads())) of the worker thread of this executor
+    // that is calling this. Returns -1 if the caller is not a worker of this executor.
+    int currentWorkerIndex() const;
+
 private:
-    void runWorkerLoop();
+    void runWorkerLoop(int workerIndex);
     Func take();
 
     std::vector<std::thread> threads_;
@@ -0,0 +1,51 @@
+#include "base/executor.h"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <set>
+
+#include "base/wait_group.h"
+
+using namespace std;
+
+TEST(ExecutorTest, currentWorkerIndex)
+{
+    Executor executor(4);
+    Executor other(1);
+    executor.start();
+    other.start();
+
+    EXPECT_EQ(4, executor.numThreads());
+    EXPECT_EQ(-1, executor.currentWorkerIndex());
+
+    mutex mu;
+    set<int> indices;
+    WaitGroup wg;
+    for (int i = 0; i < 100; ++i) {
+        wg.add(1);
+        executor.submit([&]() {
+            int index = executor.currentWorkerIndex();
+            {
+                lock_guard<mutex> lock(mu);
+                indices.insert(index);
+            }
+            wg.done();
+        });
+    }
+
+    int indexInOther = 0;
+    wg.add(1);
+    other.submit([&]() {
+        indexInOther = executor.currentWorkerIndex();
+        wg.done();
+    });
+    wg.waitUntilDone();
+
+    EXPECT_FALSE(indices.empty());
+    for (int index : indices) {
+        EXPECT_LE(0, index);
+        EXPECT_LT(index, 4);
+    }
+    EXPECT_EQ(-1, indexInOther);
+}
@@ -0,0 +1,71 @@
+#include "base/file/mapped_file.h"
+
+#if !defined(_MSC_VER)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <glog/logging.h>
+
+namespace file {
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+#if defined(_MSC_VER)
+
+bool MappedFile::open(const std::string&)
+{
+    return false;
+}
+
+void MappedFile::close()
+{
+}
+
+#else
+
+bool MappedFile::open(const std::string& filename)
+{
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping is still valid after closing the file descriptor.
+    ::close(fd);
+    if (p == MAP_FAILED) {
+        PLOG(ERROR) << "failed to mmap " << filename;
+        return false;
+    }
+
+    data_ = static_cast<const char*>(p);
+    size_ = st.st_size;
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (!data_)
+        return;
+
+    munmap(const_cast<char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+} // namespace file
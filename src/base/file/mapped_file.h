@@ -0,0 +1,35 @@
+#ifndef BASE_FILE_MAPPED_FILE_H_
+#define BASE_FILE_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+#include "base/noncopyable.h"
+
+namespace file {
+
+// MappedFile maps a whole file into memory read-only.
+// Since the mapped memory is never written, it can be read from several threads
+// without any lock.
+class MappedFile : noncopyable {
+public:
+    MappedFile() {}
+    ~MappedFile();
+
+    // Maps |filename|. Returns false if failed. On platforms not supporting mmap,
+    // this always returns false.
+    bool open(const std::string& filename);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+} // namespace file
+
+#endif // BASE_FILE_MAPPED_FILE_H_
@@ -0,0 +1,192 @@
+#include "base/instrumentation.h"
+
+#include <atomic>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+
+#include <glog/logging.h>
+
+using namespace std;
+
+namespace {
+
+struct Slot {
+    atomic<uint64_t> count { 0 };
+    atomic<uint64_t> cycles { 0 };
+};
+
+struct ThreadBuffer;
+
+struct Registry {
+    // Never destructed, since threads might exit after the static destructors ran.
+    static Registry* instance()
+    {
+        static Registry* registry = new Registry;
+        return registry;
+    }
+
+    mutex mu;
+    vector<string> names;
+    map<string, int> ids;
+    set<ThreadBuffer*> buffers;
+    // The values of the threads which have already exited.
+    uint64_t retiredCounts[Instrumentation::MAX_ENTRIES] {};
+    uint64_t retiredCycles[Instrumentation::MAX_ENTRIES] {};
+};
+
+// Only the owner thread writes to the slots. Other threads might read them in snapshot(),
+// so they're atomic, but no atomic read-modify-write is necessary.
+struct ThreadBuffer {
+    ThreadBuffer()
+    {
+        Registry* registry = Registry::instance();
+        lock_guard<mutex> lock(registry->mu);
+        registry->buffers.insert(this);
+    }
+
+    ~ThreadBuffer()
+    {
+        Registry* registry = Registry::instance();
+        lock_guard<mutex> lock(registry->mu);
+        for (int i = 0; i < Instrumentation::MAX_ENTRIES; ++i) {
+            registry->retiredCounts[i] += slots[i].count.load(memory_order_relaxed);
+            registry->retiredCycles[i] += slots[i].cycles.load(memory_order_relaxed);
+        }
+        registry->buffers.erase(this);
+    }
+
+    Slot slots[Instrumentation::MAX_ENTRIES];
+};
+
+thread_local ThreadBuffer threadBuffer;
+
+// Formats |x| in 3 significant digits with K/M/G suffix.
+string humanize(double x)
+{
+    const char* suffix = "";
+    if (x >= 1e9) {
+        x /= 1e9;
+        suffix = "G";
+    } else if (x >= 1e6) {
+        x /= 1e6;
+        suffix = "M";
+    } else if (x >= 1e3) {
+        x /= 1e3;
+        suffix = "K";
+    }
+
+    ostringstream oss;
+    oss << setprecision(3) << x << suffix;
+    return oss.str();
+}
+
+}
+
+const int Instrumentation::MAX_ENTRIES;
+
+// static
+bool Instrumentation::enabled()
+{
+#ifdef USE_INSTRUMENTATION
+    return true;
+#else
+    return false;
+#endif
+}
+
+// static
+int Instrumentation::registerName(const char* name)
+{
+    Registry* registry = Registry::instance();
+    lock_guard<mutex> lock(registry->mu);
+
+    auto it = registry->ids.find(name);
+    if (it != registry->ids.end())
+        return it->second;
+
+    int id = static_cast<int>(registry->names.size());
+    CHECK_LT(id, MAX_ENTRIES) << "too many instrumentation names: " << name;
+    registry->names.push_back(name);
+    registry->ids.emplace(name, id);
+    return id;
+}
+
+// static
+void Instrumentation::add(int id, uint64_t count, uint64_t cycles)
+{
+    DCHECK(0 <= id && id < MAX_ENTRIES) << id;
+
+    Slot& slot = threadBuffer.slots[id];
+    slot.count.store(slot.count.load(memory_order_relaxed) + count, memory_order_relaxed);
+    slot.cycles.store(slot.cycles.load(memory_order_relaxed) + cycles, memory_order_relaxed);
+}
+
+// static
+InstrumentationSnapshot Instrumentation::snapshot()
+{
+    Registry* registry = Registry::instance();
+    lock_guard<mutex> lock(registry->mu);
+
+    vector<InstrumentationEntry> entries(registry->names.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        entries[i].name = registry->names[i];
+        entries[i].count = registry->retiredCounts[i];
+        entries[i].cycles = registry->retiredCycles[i];
+        for (const ThreadBuffer* buffer : registry->buffers) {
+            entries[i].count += buffer->slots[i].count.load(memory_order_relaxed);
+            entries[i].cycles += buffer->slots[i].cycles.load(memory_order_relaxed);
+        }
+    }
+
+    return InstrumentationSnapshot(std::move(entries));
+}
+
+bool InstrumentationSnapshot::empty() const
+{
+    for (const auto& entry : entries_) {
+        if (entry.count > 0)
+            return false;
+    }
+    return true;
+}
+
+InstrumentationSnapshot InstrumentationSnapshot::since(const InstrumentationSnapshot& before) const
+{
+    map<string, const InstrumentationEntry*> beforeEntries;
+    for (const auto& entry : before.entries_)
+        beforeEntries.emplace(entry.name, &entry);
+
+    vector<InstrumentationEntry> entries(entries_);
+    for (auto& entry : entries) {
+        auto it = beforeEntries.find(entry.name);
+        if (it == beforeEntries.end())
+            continue;
+        entry.count -= it->second->count;
+        entry.cycles -= it->second->cycles;
+    }
+
+    return InstrumentationSnapshot(std::move(entries));
+}
+
+string InstrumentationSnapshot::toString(double elapsedSeconds) const
+{
+    ostringstream oss;
+    for (const auto& entry : entries_) {
+        if (entry.count == 0)
+            continue;
+
+        if (oss.tellp() > 0)
+            oss << ' ';
+        oss << entry.name << '=' << entry.count;
+        if (entry.cycles > 0) {
+            oss << '/' << humanize(entry.cycles) << 'c';
+        } else if (elapsedSeconds > 0) {
+            oss << '(' << humanize(entry.count / elapsedSeconds) << "/s)";
+        }
+    }
+
+    return oss.str();
+}
@@ -0,0 +1,92 @@
+#ifndef BASE_INSTRUMENTATION_H_
+#define BASE_INSTRUMENTATION_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "base/time_stamp_counter.h"
+
+// Instrumentation records where the time goes in the hot paths.
+//
+//   INSTRUMENT_SCOPE("Plan::iterateAvailablePlans");  // counts calls and CPU cycles until the scope ends.
+//   INSTRUMENT_COUNT("Plan::nodes", 1);                // counts something.
+//
+// These macros are compiled only when USE_INSTRUMENTATION is defined
+// (cmake -DUSE_INSTRUMENTATION=ON). Otherwise they cost nothing.
+// Each thread records into its own buffer, so recording doesn't take any lock.
+// Instrumentation::snapshot() sums up the buffers of all threads.
+//
+// Timers are inclusive: when a timed scope calls another timed scope,
+// both of them count the cycles of the inner one.
+
+struct InstrumentationEntry {
+    std::string name;
+    std::uint64_t count = 0;
+    // 0 for counters.
+    std::uint64_t cycles = 0;
+};
+
+class InstrumentationSnapshot {
+public:
+    InstrumentationSnapshot() {}
+    explicit InstrumentationSnapshot(std::vector<InstrumentationEntry> entries) : entries_(std::move(entries)) {}
+
+    const std::vector<InstrumentationEntry>& entries() const { return entries_; }
+    bool empty() const;
+
+    // Returns what has been recorded since |before|.
+    InstrumentationSnapshot since(const InstrumentationSnapshot& before) const;
+
+    // Returns a compact report in one line, e.g.
+    //   "Plan::iterateAvailablePlans=3/12.5Mc Plan::nodes=15403(1.2M/s)"
+    // Timers show count/cycles, and counters show count(count per second in |elapsedSeconds|).
+    std::string toString(double elapsedSeconds) const;
+
+private:
+    std::vector<InstrumentationEntry> entries_;
+};
+
+class Instrumentation {
+public:
+    // The maximum number of names.
+    static const int MAX_ENTRIES = 64;
+
+    static bool enabled();
+
+    // Returns the id of |name|. The same id is returned for the same name.
+    static int registerName(const char* name);
+
+    static void add(int id, std::uint64_t count, std::uint64_t cycles);
+    static InstrumentationSnapshot snapshot();
+};
+
+class ScopedInstrumentationTimer {
+public:
+    explicit ScopedInstrumentationTimer(int id) : id_(id), start_(rdtscp(&aux_)) {}
+    ~ScopedInstrumentationTimer() { Instrumentation::add(id_, 1, rdtscp(&aux_) - start_); }
+
+private:
+    int id_;
+    unsigned int aux_;
+    unsigned long long start_;
+};
+
+#define INSTRUMENT_CONCAT_INTERNAL(x, y) x ## y
+#define INSTRUMENT_CONCAT(x, y) INSTRUMENT_CONCAT_INTERNAL(x, y)
+
+#ifdef USE_INSTRUMENTATION
+#define INSTRUMENT_SCOPE(name)                                                                             \
+    static const int INSTRUMENT_CONCAT(instrumentId_, __LINE__) = Instrumentation::registerName(name);     \
+    ScopedInstrumentationTimer INSTRUMENT_CONCAT(instrumentTimer_, __LINE__)(INSTRUMENT_CONCAT(instrumentId_, __LINE__))
+#define INSTRUMENT_COUNT(name, n)                                                                          \
+    do {                                                                                                   \
+        static const int instrumentId = Instrumentation::registerName(name);                               \
+        Instrumentation::add(instrumentId, (n), 0);                                                        \
+    } while (false)
+#else
+#define INSTRUMENT_SCOPE(name) do {} while (false)
+#define INSTRUMENT_COUNT(name, n) do {} while (false)
+#endif
+
+#endif // BASE_INSTRUMENTATION_H_
@@ -0,0 +1,100 @@
+#include "base/instrumentation.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+const InstrumentationEntry* findEntry(const InstrumentationSnapshot& snapshot, const string& name)
+{
+    for (const auto& entry : snapshot.entries()) {
+        if (entry.name == name)
+            return &entry;
+    }
+    return nullptr;
+}
+
+}
+
+TEST(InstrumentationTest, registerName)
+{
+    int id1 = Instrumentation::registerName("InstrumentationTest.a");
+    int id2 = Instrumentation::registerName("InstrumentationTest.b");
+    EXPECT_NE(id1, id2);
+    EXPECT_EQ(id1, Instrumentation::registerName("InstrumentationTest.a"));
+}
+
+TEST(InstrumentationTest, addAndSnapshot)
+{
+    int id = Instrumentation::registerName("InstrumentationTest.counter");
+    InstrumentationSnapshot before = Instrumentation::snapshot();
+
+    Instrumentation::add(id, 3, 0);
+    Instrumentation::add(id, 4, 0);
+
+    InstrumentationSnapshot diff = Instrumentation::snapshot().since(before);
+    const InstrumentationEntry* entry = findEntry(diff, "InstrumentationTest.counter");
+    ASSERT_TRUE(entry != nullptr);
+    EXPECT_EQ(7U, entry->count);
+    EXPECT_EQ(0U, entry->cycles);
+}
+
+TEST(InstrumentationTest, threads)
+{
+    int id = Instrumentation::registerName("InstrumentationTest.threads");
+    InstrumentationSnapshot before = Instrumentation::snapshot();
+
+    // The threads exit before snapshot(), so their values should be kept after they exited.
+    vector<thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([id]() {
+            for (int j = 0; j < 1000; ++j)
+                Instrumentation::add(id, 1, 10);
+        });
+    }
+    for (auto& th : threads)
+        th.join();
+
+    InstrumentationSnapshot diff = Instrumentation::snapshot().since(before);
+    const InstrumentationEntry* entry = findEntry(diff, "InstrumentationTest.threads");
+    ASSERT_TRUE(entry != nullptr);
+    EXPECT_EQ(4000U, entry->count);
+    EXPECT_EQ(40000U, entry->cycles);
+}
+
+TEST(InstrumentationTest, scopedTimer)
+{
+    int id = Instrumentation::registerName("InstrumentationTest.timer");
+    InstrumentationSnapshot before = Instrumentation::snapshot();
+
+    for (int i = 0; i < 3; ++i) {
+        ScopedInstrumentationTimer timer(id);
+    }
+
+    InstrumentationSnapshot diff = Instrumentation::snapshot().since(before);
+    const InstrumentationEntry* entry = findEntry(diff, "InstrumentationTest.timer");
+    ASSERT_TRUE(entry != nullptr);
+    EXPECT_EQ(3U, entry->count);
+    EXPECT_LT(0U, entry->cycles);
+}
+
+TEST(InstrumentationTest, toString)
+{
+    vector<InstrumentationEntry> entries(3);
+    entries[0].name = "timer";
+    entries[0].count = 2;
+    entries[0].cycles = 12500000;
+    entries[1].name = "unused";
+    entries[2].name = "nodes";
+    entries[2].count = 1500;
+
+    InstrumentationSnapshot snapshot(entries);
+    EXPECT_FALSE(snapshot.empty());
+    EXPECT_EQ("timer=2/12.5Mc nodes=1500(3K/s)", snapshot.toString(0.5));
+    EXPECT_TRUE(InstrumentationSnapshot().empty());
+}
@@ -0,0 +1,107 @@
+#include "base/latency_histogram.h"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace std;
+
+namespace {
+
+int bucketIndex(int64_t us)
+{
+    int i = 0;
+    while (i < LatencyHistogram::NUM_BUCKETS - 1 && (static_cast<int64_t>(1) << i) <= us)
+        ++i;
+    return i;
+}
+
+// The largest latency [us] that bucket |i| can contain.
+int64_t bucketUpperBound(int i)
+{
+    return (static_cast<int64_t>(1) << i) - 1;
+}
+
+}
+
+void LatencyHistogram::addMicros(int64_t us)
+{
+    if (us < 0)
+        us = 0;
+
+    lock_guard<mutex> lock(mu_);
+    buckets_[bucketIndex(us)] += 1;
+    count_ += 1;
+    sumMicros_ += us;
+    maxMicros_ = std::max(maxMicros_, us);
+}
+
+void LatencyHistogram::clear()
+{
+    lock_guard<mutex> lock(mu_);
+    std::fill(buckets_, buckets_ + NUM_BUCKETS, 0);
+    count_ = 0;
+    sumMicros_ = 0;
+    maxMicros_ = 0;
+}
+
+int64_t LatencyHistogram::count() const
+{
+    lock_guard<mutex> lock(mu_);
+    return count_;
+}
+
+int64_t LatencyHistogram::maxMicros() const
+{
+    lock_guard<mutex> lock(mu_);
+    return maxMicros_;
+}
+
+double LatencyHistogram::averageMicros() const
+{
+    lock_guard<mutex> lock(mu_);
+    if (count_ == 0)
+        return 0.0;
+    return static_cast<double>(sumMicros_) / count_;
+}
+
+int64_t LatencyHistogram::percentileMicros(double percentile) const
+{
+    lock_guard<mutex> lock(mu_);
+    if (count_ == 0)
+        return 0;
+
+    // The rank (1-origin) of the sample we'd like to find.
+    int64_t rank = static_cast<int64_t>(count_ * percentile / 100.0 + 0.5);
+    rank = std::max<int64_t>(1, std::min(count_, rank));
+
+    int64_t seen = 0;
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        seen += buckets_[i];
+        if (seen >= rank)
+            return std::min(maxMicros_, bucketUpperBound(i));
+    }
+
+    return maxMicros_;
+}
+
+int64_t LatencyHistogram::countLargerThan(int64_t us) const
+{
+    lock_guard<mutex> lock(mu_);
+    int64_t n = 0;
+    for (int i = 0; i < NUM_BUCKETS; ++i) {
+        if (bucketUpperBound(i) > us)
+            n += buckets_[i];
+    }
+    return n;
+}
+
+string LatencyHistogram::toString() const
+{
+    ostringstream oss;
+    oss << "n=" << count()
+        << " avg=" << static_cast<int64_t>(averageMicros()) << "us"
+        << " p50=" << percentileMicros(50) << "us"
+        << " p99=" << percentileMicros(99) << "us"
+        << " max=" << maxMicros() << "us";
+    return oss.str();
+}
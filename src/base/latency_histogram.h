@@ -0,0 +1,49 @@
+#ifndef BASE_LATENCY_HISTOGRAM_H_
+#define BASE_LATENCY_HISTOGRAM_H_
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "base/noncopyable.h"
+
+// LatencyHistogram records latencies into power-of-two buckets of microseconds.
+// Bucket i contains latencies in [2^(i-1), 2^i) [us] (bucket 0 contains 0 us).
+// It's cheap enough to be updated every frame, and it's thread-safe.
+class LatencyHistogram : noncopyable {
+public:
+    static const int NUM_BUCKETS = 32;
+
+    void add(std::chrono::steady_clock::duration d)
+    {
+        addMicros(std::chrono::duration_cast<std::chrono::microseconds>(d).count());
+    }
+    void addMicros(std::int64_t us);
+
+    void clear();
+
+    std::int64_t count() const;
+    std::int64_t maxMicros() const;
+    double averageMicros() const;
+
+    // Returns the upper bound of the bucket containing the |percentile|-th latency.
+    // The result never exceeds maxMicros(). Returns 0 when no sample has been added.
+    std::int64_t percentileMicros(double percentile) const;
+
+    // Returns the number of samples whose latency is larger than |us|.
+    // Since this is computed from the buckets, it's approximate unless |us| is 2^k - 1.
+    std::int64_t countLargerThan(std::int64_t us) const;
+
+    // e.g. "n=120 avg=1024us p50=1023us p99=4095us max=3300us"
+    std::string toString() const;
+
+private:
+    mutable std::mutex mu_;
+    std::int64_t buckets_[NUM_BUCKETS] {};
+    std::int64_t count_ = 0;
+    std::int64_t sumMicros_ = 0;
+    std::int64_t maxMicros_ = 0;
+};
+
+#endif // BASE_LATENCY_HISTOGRAM_H_
@@ -0,0 +1,53 @@
+#include "base/latency_histogram.h"
+
+#include <gtest/gtest.h>
+
+TEST(LatencyHistogramTest, empty)
+{
+    LatencyHistogram h;
+    EXPECT_EQ(0, h.count());
+    EXPECT_EQ(0, h.maxMicros());
+    EXPECT_EQ(0, h.percentileMicros(50));
+    EXPECT_EQ(0.0, h.averageMicros());
+}
+
+TEST(LatencyHistogramTest, percentile)
+{
+    LatencyHistogram h;
+    for (int i = 0; i < 99; ++i)
+        h.addMicros(100);
+    h.addMicros(5000);
+
+    EXPECT_EQ(100, h.count());
+    EXPECT_EQ(5000, h.maxMicros());
+    EXPECT_EQ(149.0, h.averageMicros());
+
+    // 100us is in the bucket [64, 128).
+    EXPECT_EQ(127, h.percentileMicros(50));
+    EXPECT_EQ(127, h.percentileMicros(99));
+    // Never exceeds max.
+    EXPECT_EQ(5000, h.percentileMicros(100));
+}
+
+TEST(LatencyHistogramTest, countLargerThan)
+{
+    LatencyHistogram h;
+    h.add(std::chrono::microseconds(10));
+    h.add(std::chrono::milliseconds(10));
+    h.add(std::chrono::milliseconds(20));
+
+    EXPECT_EQ(3, h.countLargerThan(0));
+    EXPECT_EQ(2, h.countLargerThan(8191));
+    EXPECT_EQ(1, h.countLargerThan(16383));
+    EXPECT_EQ(0, h.countLargerThan(32767));
+}
+
+TEST(LatencyHistogramTest, clear)
+{
+    LatencyHistogram h;
+    h.addMicros(10);
+    h.clear();
+
+    EXPECT_EQ(0, h.count());
+    EXPECT_EQ(0, h.maxMicros());
+}
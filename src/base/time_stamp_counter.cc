@@ -8,6 +8,17 @@
 
 using namespace std;
 
+double TimeStampCounterData::average() const
+{
+    if (data_.empty())
+        return 0.0;
+
+    double sum = 0.0;
+    for (auto x : data_)
+        sum += x;
+    return sum / data_.size();
+}
+
 void TimeStampCounterData::showStatistics() const
 {
     int n = data_.size();
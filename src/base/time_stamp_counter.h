@@ -20,6 +20,11 @@ public:
     void showStatistics() const;
     void add(unsigned long long t) { data_.push_back(t); }
 
+    int size() const { return static_cast<int>(data_.size()); }
+    const std::vector<unsigned long long>& data() const { return data_; }
+    // Returns the average. 0 if no data.
+    double average() const;
+
 private:
     std::vector<unsigned long long> data_;
 };
@@ -0,0 +1,115 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+#include <json/json.h>
+
+#include "base/benchmark.h"
+
+DEFINE_string(current, "", "The JSON lines file the performance tests wrote.");
+DEFINE_string(baseline, "", "The JSON lines file of the baseline. Not compared if empty or missing.");
+DEFINE_double(threshold, 0.1, "A benchmark regresses when its median gets slower than the baseline by more than this ratio.");
+DEFINE_bool(update_baseline, false, "Overwrites --baseline with the current results.");
+
+using namespace std;
+
+static bool readResults(const string& filename, vector<BenchmarkResult>* results)
+{
+    ifstream ifs(filename);
+    if (!ifs)
+        return false;
+
+    Json::Reader reader;
+    string line;
+    while (getline(ifs, line)) {
+        if (line.empty())
+            continue;
+
+        Json::Value v;
+        if (!reader.parse(line, v)) {
+            LOG(ERROR) << "failed to parse " << filename << ": " << line;
+            return false;
+        }
+
+        BenchmarkResult r;
+        r.name = v["name"].asString();
+        r.size = v["size"].asInt();
+        r.min = v["min"].asDouble();
+        r.median = v["median"].asDouble();
+        r.mean = v["mean"].asDouble();
+        r.deviation = v["deviation"].asDouble();
+        results->push_back(r);
+    }
+
+    return true;
+}
+
+static bool writeResults(const string& filename, const map<string, BenchmarkResult>& results)
+{
+    ofstream ofs(filename);
+    if (!ofs)
+        return false;
+
+    for (const auto& entry : results)
+        ofs << entry.second.toJson() << endl;
+    return true;
+}
+
+// Compares the results of the performance tests with the baseline.
+// Returns non-zero if any benchmark regressed, so this can be used as a gate.
+int main(int argc, char* argv[])
+{
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    google::InitGoogleLogging(argv[0]);
+
+    if (FLAGS_current.empty()) {
+        LOG(ERROR) << "--current must be specified.";
+        return 2;
+    }
+
+    vector<BenchmarkResult> currentResults;
+    if (!readResults(FLAGS_current, &currentResults)) {
+        LOG(ERROR) << "failed to read " << FLAGS_current;
+        return 2;
+    }
+    map<string, BenchmarkResult> current = Benchmark::merge(currentResults);
+
+    vector<BenchmarkResult> baselineResults;
+    if (!FLAGS_baseline.empty() && !readResults(FLAGS_baseline, &baselineResults))
+        LOG(WARNING) << "no baseline in " << FLAGS_baseline << ". Nothing will be compared.";
+    map<string, BenchmarkResult> baseline = Benchmark::merge(baselineResults);
+
+    int numRegressions = 0;
+    for (const BenchmarkComparison& c : Benchmark::compare(baseline, current, FLAGS_threshold)) {
+        if (c.baselineMedian == 0) {
+            printf("%-80s %14s %14.1f %8s\n", c.name.c_str(), "-", c.currentMedian, "new");
+            continue;
+        }
+
+        printf("%-80s %14.1f %14.1f %7.3fx%s\n", c.name.c_str(), c.baselineMedian, c.currentMedian, c.ratio,
+               c.regressed ? " REGRESSED" : "");
+        if (c.regressed)
+            ++numRegressions;
+    }
+
+    if (FLAGS_update_baseline) {
+        if (!writeResults(FLAGS_baseline, current)) {
+            LOG(ERROR) << "failed to write " << FLAGS_baseline;
+            return 2;
+        }
+        cout << "updated " << FLAGS_baseline << endl;
+        return 0;
+    }
+
+    if (numRegressions > 0) {
+        cout << numRegressions << " benchmark(s) regressed by more than " << FLAGS_threshold * 100 << "%" << endl;
+        return 1;
+    }
+
+    return 0;
+}
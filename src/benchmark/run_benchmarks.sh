@@ -0,0 +1,32 @@
+#!/bin/bash
+# Runs all the performance tests, and compares the results with the baseline.
+#
+# usage: run_benchmarks.sh <build dir> <output> [<baseline>] [options for benchmark_compare]
+#
+# The environment variable PUYOAI_BENCHMARK_REPEAT controls how many times
+# each performance test runs (default: 3).
+
+set -e
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 <build dir> <output> [<baseline>] [options for benchmark_compare]" 1>&2
+    exit 2
+fi
+
+build_dir="$1"
+output="$2"
+baseline="$3"
+shift 2
+if [ $# -gt 0 ]; then
+    shift
+fi
+
+rm -f "$output"
+export PUYOAI_BENCHMARK_OUTPUT="$output"
+
+for test in $(find "$build_dir" -name '*_performance_test' -type f -perm -u+x | sort); do
+    echo "running $test"
+    "$test" --gtest_repeat="${PUYOAI_BENCHMARK_REPEAT:-3}" > /dev/null
+done
+
+exec "$build_dir/benchmark/benchmark_compare" --current="$output" --baseline="$baseline" "$@"
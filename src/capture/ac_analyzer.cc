@@ -5,6 +5,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "capture/capture_source.h"
 #include "capture/color.h"
 #include "gui/pixel_color.h"
 #include "gui/util.h"
@@ -141,9 +142,8 @@ RealColor ACAnalyzer::analyzeBox(const SDL_Surface* surface, const Box& b,
 
     for (int by = b.sy; by < b.dy; ++by) {
         for (int bx = b.sx; bx < b.dx; ++bx) {
-            Uint32 c = getpixel(surface, bx, by);
             Uint8 r, g, b;
-            SDL_GetRGB(c, surface->format, &r, &g, &b);
+            getRGB(surface, bx, by, &r, &g, &b);
 
             RGB rgb(r, g, b);
             RealColor rc = toRealColor(rgb);
@@ -185,12 +185,11 @@ RealColor ACAnalyzer::analyzeBoxWithRecognizer(const SDL_Surface* surface, const
     CHECK_EQ(16, b.dy - b.sy);
 
     int pos = 0;
-    double features[16 * 16 * 3];
+    float features[Recognizer::NUM_FEATURES];
     for (int by = b.sy; by < b.dy; ++by) {
         for (int bx = b.sx; bx < b.dx; ++bx) {
-            Uint32 c = getpixel(surface, bx, by);
             Uint8 r, g, b;
-            SDL_GetRGB(c, surface->format, &r, &g, &b);
+            getRGB(surface, bx, by, &r, &g, &b);
 
             features[pos++] = r;
             features[pos++] = g;
@@ -340,18 +339,16 @@ bool ACAnalyzer::detectOjamaDrop(const SDL_Surface* currentSurface,
     double diffSum = 0;
     for (int by = box.sy; by < box.dy; ++by) {
         for (int bx = box.sx; bx < box.dx; ++bx) {
-            Uint32 c1 = getpixel(currentSurface, bx, by);
             Uint8 r1, g1, b1;
-            SDL_GetRGB(c1, currentSurface->format, &r1, &g1, &b1);
+            getRGB(currentSurface, bx, by, &r1, &g1, &b1);
 
             // Since 3 SET MATCH etc. has RED or GREEN, we'd like to ignore them.
             RealColor rc = toRealColor(RGB(r1, g1, b1));
             if (rc == RealColor::RC_RED || rc == RealColor::RC_GREEN)
                 continue;
 
-            Uint32 c2 = getpixel(prev2Surface, bx, by);
             Uint8 r2, g2, b2;
-            SDL_GetRGB(c2, prev2Surface->format, &r2, &g2, &b2);
+            getRGB(prev2Surface, bx, by, &r2, &g2, &b2);
 
             double diff = sqrt((r1 - r2) * (r1 - r2) + (g1 - g2) * (g1 - g2) + (b1 - b2) * (b1 - b2));
             diffSum += diff;
@@ -383,9 +380,8 @@ bool ACAnalyzer::isLevelSelect(const SDL_Surface* surface)
         int whiteCount = 0;
         for (int bx = b.sx; bx < b.dx; ++bx) {
             for (int by = b.sy; by < b.dy; ++by) {
-                Uint32 c = getpixel(surface, bx, by);
                 Uint8 r, g, b;
-                SDL_GetRGB(c, surface->format, &r, &g, &b);
+                getRGB(surface, bx, by, &r, &g, &b);
 
                 RGB rgb(r, g, b);
                 RealColor rc = toRealColor(rgb);
@@ -409,9 +405,8 @@ bool ACAnalyzer::isGameFinished(const SDL_Surface* surface)
     int whiteCount = 0;
     for (int bx = b.sx; bx < b.dx; ++bx) {
         for (int by = b.sy; by < b.dy; ++by) {
-            Uint32 c = getpixel(surface, bx, by);
             Uint8 r, g, b;
-            SDL_GetRGB(c, surface->format, &r, &g, &b);
+            getRGB(surface, bx, by, &r, &g, &b);
 
             RGB rgb(r, g, b);
             RealColor rc = toRealColor(rgb);
@@ -444,9 +439,8 @@ bool ACAnalyzer::isMatchEnd(const SDL_Surface* surface)
 
     for (int x = b1.dx; x < b2.dx; ++x) {
         for (int y = b1.dy; y < b2.dy; ++y) {
-            Uint32 c = getpixel(surface, x, y);
             Uint8 r, g, b;
-            SDL_GetRGB(c, surface->format, &r, &g, &b);
+            getRGB(surface, x, y, &r, &g, &b);
             RGB rgb(r, g, b);
             RealColor rc = toRealColor(rgb);
             if (rc == RealColor::RC_RED)
@@ -495,9 +489,8 @@ void ACAnalyzer::drawBoxWithAnalysisResult(SDL_Surface* surface, const Box& box)
 {
     for (int by = box.sy; by < box.dy; ++by) {
         for (int bx = box.sx; bx < box.dx; ++bx) {
-            Uint32 c = getpixel(surface, bx, by);
             Uint8 r, g, b;
-            SDL_GetRGB(c, surface->format, &r, &g, &b);
+            getRGB(surface, bx, by, &r, &g, &b);
             RealColor rc = toRealColor(RGB(r, g, b));
             putpixel(surface, bx, by, toPixelColor(surface, rc));
         }
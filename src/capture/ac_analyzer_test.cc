@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <SDL_image.h>
 
+#include "base/executor.h"
 #include "capture/color.h"
 #include "core/next_puyo.h"
 #include "core/real_color.h"
@@ -29,7 +30,8 @@ protected:
     }
 
     deque<unique_ptr<AnalyzerResult>> analyzeMultipleFrames(const vector<string>& imgFilenames,
-                                                            bool userPlayable[2])
+                                                            bool userPlayable[2],
+                                                            Executor* executor = nullptr)
     {
         deque<unique_ptr<AnalyzerResult>> results;
 
@@ -43,7 +45,7 @@ protected:
             string filename = FLAGS_testdata_dir + imgFilename;
             auto surface = makeUniqueSDLSurface(IMG_Load(filename.c_str()));
             CHECK(surface.get()) << "Failed to load "<< filename;
-            auto r = analyzer.analyze(surface.get(), prev.get(), prev2.get(), prev3.get(), results);
+            auto r = analyzer.analyze(surface.get(), prev.get(), prev2.get(), prev3.get(), results, executor);
             if (firstResult) {
                 r->mutablePlayerResult(0)->playable = userPlayable[0];
                 r->mutablePlayerResult(1)->playable = userPlayable[1];
@@ -590,6 +592,30 @@ TEST_F(ACAnalyzerTest, gameStart)
     }
 }
 
+TEST_F(ACAnalyzerTest, analyzeInParallel)
+{
+    vector<string> images;
+    for (int i = 0; i < 120; ++i) {
+        char buf[80];
+        sprintf(buf, "/images/game-start/frame%03d.png", i);
+        images.push_back(buf);
+    }
+
+    Executor executor(1);
+    executor.start();
+
+    // The 2nd player's field is analyzed on |executor|. The results should be the same
+    // as analyzing both fields on this thread.
+    bool pgs[2] = { false, false };
+    deque<unique_ptr<AnalyzerResult>> expected = analyzeMultipleFrames(images, pgs);
+    deque<unique_ptr<AnalyzerResult>> actual = analyzeMultipleFrames(images, pgs, &executor);
+    executor.stop();
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_EQ(expected[i]->toString(), actual[i]->toString()) << "Frame " << i;
+}
+
 TEST_F(ACAnalyzerTest, exhaustivePuyoDetection)
 {
     const int WIDTH = 16;
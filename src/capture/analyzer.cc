@@ -3,6 +3,9 @@
 #include <sstream>
 #include <queue>
 
+#include "base/executor.h"
+#include "base/wait_group.h"
+
 using namespace std;
 
 namespace {
@@ -180,44 +183,61 @@ std::unique_ptr<AnalyzerResult> Analyzer::analyze(const SDL_Surface* surface,
                                                   const SDL_Surface* /*prevSurface*/,
                                                   const SDL_Surface* prev2Surface,
                                                   const SDL_Surface* prev3Surface,
-                                                  const deque<unique_ptr<AnalyzerResult>>& previousResults)
+                                                  const deque<unique_ptr<AnalyzerResult>>& previousResults,
+                                                  Executor* executor)
 {
     CaptureGameState gameState = detectGameState(surface);
-    unique_ptr<DetectedField> player1FieldResult = detectField(0, surface, prev2Surface, prev3Surface);
-    unique_ptr<DetectedField> player2FieldResult = detectField(1, surface, prev2Surface, prev3Surface);
 
+    unique_ptr<PlayerAnalyzerResult> playerResults[2];
+    if (executor) {
+        WaitGroup wg;
+        wg.add(1);
+        executor->submit([&]() {
+            playerResults[1] = detectAndAnalyzePlayerField(1, gameState, surface, prev2Surface, prev3Surface, previousResults);
+            wg.done();
+        });
+        playerResults[0] = detectAndAnalyzePlayerField(0, gameState, surface, prev2Surface, prev3Surface, previousResults);
+        wg.waitUntilDone();
+    } else {
+        for (int pi = 0; pi < 2; ++pi)
+            playerResults[pi] = detectAndAnalyzePlayerField(pi, gameState, surface, prev2Surface, prev3Surface, previousResults);
+    }
+
+    return std::unique_ptr<AnalyzerResult>(new AnalyzerResult(gameState, move(playerResults[0]), move(playerResults[1])));
+}
+
+unique_ptr<PlayerAnalyzerResult>
+Analyzer::detectAndAnalyzePlayerField(int pi,
+                                      CaptureGameState gameState,
+                                      const SDL_Surface* surface,
+                                      const SDL_Surface* prev2Surface,
+                                      const SDL_Surface* prev3Surface,
+                                      const deque<unique_ptr<AnalyzerResult>>& previousResults)
+{
     switch (gameState) {
-    case CaptureGameState::UNKNOWN: {
+    case CaptureGameState::UNKNOWN:
         // When in unknown state, we don't check the player field.
-        auto player1Result = unique_ptr<PlayerAnalyzerResult>();
-        auto player2Result = unique_ptr<PlayerAnalyzerResult>();
-        return std::unique_ptr<AnalyzerResult>(new AnalyzerResult(gameState, move(player1Result), move(player2Result)));
-    }
+        return unique_ptr<PlayerAnalyzerResult>();
     case CaptureGameState::LEVEL_SELECT: {
-        auto player1Result = analyzePlayerFieldOnLevelSelect(*player1FieldResult, makePlayerOnlyResults(0, previousResults));
-        auto player2Result = analyzePlayerFieldOnLevelSelect(*player2FieldResult, makePlayerOnlyResults(1, previousResults));
-        return std::unique_ptr<AnalyzerResult>(new AnalyzerResult(gameState, move(player1Result), move(player2Result)));
+        unique_ptr<DetectedField> detectedField = detectField(pi, surface, prev2Surface, prev3Surface);
+        return analyzePlayerFieldOnLevelSelect(*detectedField, makePlayerOnlyResults(pi, previousResults));
     }
     case CaptureGameState::PLAYING: {
-        auto player1Result = analyzePlayerField(*player1FieldResult, makePlayerOnlyResults(0, previousResults));
-        auto player2Result = analyzePlayerField(*player2FieldResult, makePlayerOnlyResults(1, previousResults));
-        return std::unique_ptr<AnalyzerResult>(new AnalyzerResult(gameState, move(player1Result), move(player2Result)));
+        unique_ptr<DetectedField> detectedField = detectField(pi, surface, prev2Surface, prev3Surface);
+        return analyzePlayerField(*detectedField, makePlayerOnlyResults(pi, previousResults));
     }
     case CaptureGameState::GAME_FINISHED_WITH_1P_WIN:
     case CaptureGameState::GAME_FINISHED_WITH_2P_WIN:
     case CaptureGameState::GAME_FINISHED_WITH_DRAW:
     case CaptureGameState::MATCH_FINISHED_WITH_1P_WIN:
     case CaptureGameState::MATCH_FINISHED_WITH_2P_WIN:
-    case CaptureGameState::MATCH_FINISHED_WITH_DRAW: {
+    case CaptureGameState::MATCH_FINISHED_WITH_DRAW:
         // After finished, we don't need to check each player gamestate.
-        auto player1Result = unique_ptr<PlayerAnalyzerResult>();
-        auto player2Result = unique_ptr<PlayerAnalyzerResult>();
-        return std::unique_ptr<AnalyzerResult>(new AnalyzerResult(gameState, move(player1Result), move(player2Result)));
-    }
+        return unique_ptr<PlayerAnalyzerResult>();
     }
 
     DCHECK(false) << "Unknown gamestate: " << static_cast<int>(gameState);
-    return std::unique_ptr<AnalyzerResult>();
+    return unique_ptr<PlayerAnalyzerResult>();
 }
 
 unique_ptr<PlayerAnalyzerResult>
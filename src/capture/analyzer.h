@@ -17,6 +17,8 @@
 #include "gui/bounding_box.h"
 #include "capture/real_color_field.h"
 
+class Executor;
+
 // TODO(mayah): Should be renamed?
 enum class CaptureGameState {
     UNKNOWN,
@@ -162,14 +164,18 @@ public:
     virtual ~Analyzer() {}
 
     // Analyzes the specified frame. previousResults.front() should be the most recent results.
+    // When |executor| is specified, the 2nd player's field is analyzed on |executor| in parallel.
     std::unique_ptr<AnalyzerResult> analyze(const SDL_Surface* current,
                                             const SDL_Surface* prev,
                                             const SDL_Surface* prev2,
                                             const SDL_Surface* prev3,
-                                            const std::deque<std::unique_ptr<AnalyzerResult>>& previousResults);
+                                            const std::deque<std::unique_ptr<AnalyzerResult>>& previousResults,
+                                            Executor* executor = nullptr);
 
 protected:
     // These methods should be implemented in the derived class.
+    // detectField() is called for both players in parallel when analyze() is given an executor,
+    // so it must not modify the analyzer.
     virtual CaptureGameState detectGameState(const SDL_Surface*) = 0;
     virtual std::unique_ptr<DetectedField> detectField(int pi,
                                                        const SDL_Surface* current,
@@ -178,6 +184,16 @@ protected:
 
 
 private:
+    // Detects and analyzes the field of player |pi|. This can be called for both players
+    // in parallel. Analyzer has no state, so this is thread-safe as long as detectField() is.
+    std::unique_ptr<PlayerAnalyzerResult> detectAndAnalyzePlayerField(
+        int pi,
+        CaptureGameState,
+        const SDL_Surface* current,
+        const SDL_Surface* prev2,
+        const SDL_Surface* prev3,
+        const std::deque<std::unique_ptr<AnalyzerResult>>& previousResults);
+
     std::unique_ptr<PlayerAnalyzerResult> analyzePlayerField(
         const DetectedField&,
         const std::vector<const PlayerAnalyzerResult*>& previousResults);
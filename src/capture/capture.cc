@@ -1,62 +1,39 @@
 #include "capture/capture.h"
 
 #include "capture/source.h"
+#include "capture/yuv_surface.h"
 #include "gui/screen.h"
 #include "gui/SDL_prims.h"
 
 using namespace std;
 
 Capture::Capture(Source* source, Analyzer* analyzer) :
-    source_(source),
-    analyzer_(analyzer),
-    shouldStop_(false),
-    surface_(makeUniqueSDLSurface(nullptr))
+    drawBuffer_(emptyUniqueSDLSurface()),
+    pipeline_(source, analyzer, [this](CaptureFrame* frame) { return this->publish(frame); })
 {
 }
 
 bool Capture::start()
 {
-    th_ = thread([this](){
-        this->runLoop();
-    });
-    th_.detach();
-    return true;
+    return pipeline_.start();
 }
 
 void Capture::stop()
 {
-    shouldStop_ = true;
-    if (th_.joinable())
-        th_.join();
+    pipeline_.stop();
 }
 
-void Capture::runLoop()
+bool Capture::publish(CaptureFrame* frame)
 {
-    int frameId = 0;
-    UniqueSDLSurface prevSurface(emptyUniqueSDLSurface());
-    UniqueSDLSurface prev2Surface(emptyUniqueSDLSurface());
-    UniqueSDLSurface prev3Surface(emptyUniqueSDLSurface());
-
-    while (!shouldStop_) {
-        UniqueSDLSurface surface(source_->nextFrame());
-        if (!surface.get())
-            continue;
-
-        // We set frameId to surface's userdata. This will be useful for saving screen shot.
-        surface->userdata = reinterpret_cast<void*>(static_cast<uintptr_t>(++frameId));
-
-        lock_guard<mutex> lock(mu_);
-        unique_ptr<AnalyzerResult> r =
-            analyzer_->analyze(surface.get(), prevSurface.get(), prev2Surface.get(), prev3Surface.get(), results_);
-
-        prev3Surface = move(prev2Surface);
-        prev2Surface = move(prevSurface);
-        prevSurface = move(surface_);
-        surface_ = move(surface);
-        results_.push_front(move(r));
-        while (results_.size() > 10)
-            results_.pop_back();
-    }
+    lock_guard<mutex> lock(mu_);
+
+    surface_ = frame->surface;
+    frameId_ = frame->frameId;
+    results_.push_front(move(frame->result));
+    while (results_.size() > 10)
+        results_.pop_back();
+
+    return true;
 }
 
 void Capture::draw(Screen* screen)
@@ -70,9 +47,15 @@ void Capture::draw(Screen* screen)
     if (!surface_.get())
         return;
 
-    surface->userdata = surface_->userdata;
+    // A YUV frame is converted to RGB only here.
+    SDL_Surface* drawable = toDrawableSurface(surface_.get(), &drawBuffer_);
+    if (!drawable)
+        return;
+
+    // FrameNumberDrawer shows the frame id.
+    surface->userdata = reinterpret_cast<void*>(static_cast<uintptr_t>(frameId_));
     SDL_Rect dstRect = screen->mainBox().toSDLRect();
-    SDL_BlitScaled(surface_.get(), nullptr, surface, &dstRect);
+    SDL_BlitScaled(drawable, nullptr, surface, &dstRect);
 }
 
 unique_ptr<AnalyzerResult> Capture::analyzerResult() const
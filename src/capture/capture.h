@@ -1,13 +1,14 @@
 #ifndef CAPTURE_CAPTURE_H_
 #define CAPTURE_CAPTURE_H_
 
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <thread>
 
 #include "base/base.h"
 #include "capture/analyzer.h"
 #include "capture/analyzer_result_drawer.h"
+#include "capture/capture_pipeline.h"
 #include "gui/drawer.h"
 #include "gui/unique_sdl_surface.h"
 
@@ -29,18 +30,20 @@ public:
 
     virtual std::unique_ptr<AnalyzerResult> analyzerResult() const override;
 
-private:
-    void runLoop();
-
-    Source* source_;
-    Analyzer* analyzer_;
+    const CapturePipeline& pipeline() const { return pipeline_; }
 
-    std::thread th_;
-    volatile bool shouldStop_;
+private:
+    bool publish(CaptureFrame*);
 
     mutable std::mutex mu_;
-    UniqueSDLSurface surface_;
+    SharedSDLSurface surface_;
+    int frameId_ = 0;
+    // Holds |surface_| converted to RGB when it's a YUV surface.
+    UniqueSDLSurface drawBuffer_;
     std::deque<std::unique_ptr<AnalyzerResult>> results_;
+
+    // Should be destructed first, since it calls publish().
+    CapturePipeline pipeline_;
 };
 
 #endif  // CAPTURE_CAPTURE_H_
@@ -0,0 +1,233 @@
+#include "capture/capture_pipeline.h"
+
+#include <sstream>
+
+#include <glog/logging.h>
+
+#include "capture/source.h"
+
+using namespace std;
+
+namespace {
+
+// The number of previous results the analyzer refers.
+const size_t NUM_PREVIOUS_RESULTS = 10;
+
+// If the source doesn't give a surface for this number of times in a row,
+// we consider the source is broken.
+const int MAX_NO_SURFACE_COUNT = 100000;
+
+// Taking a frame from the queues is retried with this interval
+// so that the stages can notice stop().
+const chrono::milliseconds QUEUE_POLL_INTERVAL(50);
+
+}
+
+// static
+const CapturePipeline::Clock::duration CapturePipeline::FRAME_BUDGET = chrono::microseconds(16667);
+
+string CapturePipelineStats::toString() const
+{
+    ostringstream oss;
+    oss << "source:       " << source.toString() << endl
+        << "analyze wait: " << analyzeWait.toString() << endl
+        << "analyze:      " << analyze.toString() << endl
+        << "publish wait: " << publishWait.toString() << endl
+        << "publish:      " << publish.toString() << endl
+        << "total:        " << total.toString() << endl
+        << "dropped:      before analyze=" << numDroppedBeforeAnalyze
+        << " before publish=" << numDroppedBeforePublish << endl;
+    return oss.str();
+}
+
+CapturePipeline::CapturePipeline(Source* source, Analyzer* analyzer, Publisher publisher, int queueCapacity) :
+    source_(source),
+    analyzer_(analyzer),
+    publisher_(std::move(publisher)),
+    executor_(1),
+    analyzerQueue_(queueCapacity),
+    publisherQueue_(queueCapacity),
+    shouldStop_(false),
+    generation_(0),
+    numFramesOverBudget_(0)
+{
+    CHECK(publisher_) << "publisher should be callable";
+}
+
+CapturePipeline::~CapturePipeline()
+{
+    stop();
+}
+
+bool CapturePipeline::start()
+{
+    executor_.start();
+
+    sourceThread_ = thread([this]() {
+        runSourceLoop();
+    });
+    analyzerThread_ = thread([this]() {
+        runAnalyzerLoop();
+    });
+    publisherThread_ = thread([this]() {
+        runPublisherLoop();
+    });
+    return true;
+}
+
+void CapturePipeline::stop()
+{
+    shouldStop_ = true;
+    // The source might be waiting for the next frame (e.g. MovieSource in step mode).
+    // Ending it lets the source thread finish.
+    source_->end();
+
+    // stop() can be called from the publisher callback. In that case, the publisher thread
+    // will finish soon, so we don't join it.
+    for (thread* th : { &sourceThread_, &analyzerThread_, &publisherThread_ }) {
+        if (th->joinable() && th->get_id() != this_thread::get_id())
+            th->join();
+    }
+}
+
+void CapturePipeline::push(base::BlockingQueue<unique_ptr<CaptureFrame>>* q, unique_ptr<CaptureFrame> frame,
+                           atomic<int>* numDropped)
+{
+    // The end of stream marker is always the last frame pushed, so it's never dropped.
+    unique_ptr<CaptureFrame> dropped;
+    if (q->pushDroppingOldest(std::move(frame), &dropped)) {
+        ++*numDropped;
+        VLOG(1) << "frame " << dropped->frameId << " was dropped since the next stage is behind.";
+    }
+}
+
+unique_ptr<CaptureFrame> CapturePipeline::take(base::BlockingQueue<unique_ptr<CaptureFrame>>* q)
+{
+    unique_ptr<CaptureFrame> frame;
+    while (!shouldStop_) {
+        if (q->takeWithTimeout(Clock::now() + QUEUE_POLL_INTERVAL, &frame))
+            return frame;
+    }
+
+    return unique_ptr<CaptureFrame>();
+}
+
+void CapturePipeline::runSourceLoop()
+{
+    int frameId = 0;
+    int noSurfaceCount = 0;
+
+    while (!shouldStop_) {
+        Clock::time_point beginTime = Clock::now();
+        UniqueSDLSurface surface(source_->nextFrame());
+        Clock::time_point endTime = Clock::now();
+
+        if (!surface.get()) {
+            ++noSurfaceCount;
+            LOG(INFO) << "No surface?: count=" << noSurfaceCount << " done=" << source_->done();
+            if (!source_->done() && noSurfaceCount <= MAX_NO_SURFACE_COUNT)
+                continue;
+
+            // Tell the following stages that no frame will come.
+            unique_ptr<CaptureFrame> frame(new CaptureFrame);
+            frame->capturedTime = endTime;
+            push(&analyzerQueue_, std::move(frame), &stats_.numDroppedBeforeAnalyze);
+            return;
+        }
+
+        noSurfaceCount = 0;
+        stats_.source.add(endTime - beginTime);
+
+        unique_ptr<CaptureFrame> frame(new CaptureFrame);
+        frame->frameId = ++frameId;
+        frame->surface = toSharedSDLSurface(std::move(surface));
+        frame->capturedTime = endTime;
+
+        push(&analyzerQueue_, std::move(frame), &stats_.numDroppedBeforeAnalyze);
+    }
+}
+
+void CapturePipeline::runAnalyzerLoop()
+{
+    // The analyzer refers the previous 3 surfaces and results.
+    SharedSDLSurface prevSurfaces[3];
+    deque<unique_ptr<AnalyzerResult>> results;
+    int resultsGeneration = 0;
+
+    while (true) {
+        unique_ptr<CaptureFrame> frame(take(&analyzerQueue_));
+        if (!frame)
+            return;
+
+        if (frame->isEndOfStream()) {
+            push(&publisherQueue_, std::move(frame), &stats_.numDroppedBeforePublish);
+            return;
+        }
+
+        // The generation is read before analyzing, so a reset during analyzing makes this frame stale.
+        frame->generation = generation_;
+        if (frame->generation != resultsGeneration) {
+            results.clear();
+            resultsGeneration = frame->generation;
+        }
+
+        Clock::time_point beginTime = Clock::now();
+        stats_.analyzeWait.add(beginTime - frame->capturedTime);
+
+        unique_ptr<AnalyzerResult> r =
+            analyzer_->analyze(frame->surface.get(), prevSurfaces[0].get(), prevSurfaces[1].get(), prevSurfaces[2].get(),
+                               results, &executor_);
+
+        frame->analyzedTime = Clock::now();
+        stats_.analyze.add(frame->analyzedTime - beginTime);
+
+        prevSurfaces[2] = std::move(prevSurfaces[1]);
+        prevSurfaces[1] = std::move(prevSurfaces[0]);
+        prevSurfaces[0] = frame->surface;
+
+        frame->result = r->copy();
+        results.push_front(std::move(r));
+        while (results.size() > NUM_PREVIOUS_RESULTS)
+            results.pop_back();
+
+        push(&publisherQueue_, std::move(frame), &stats_.numDroppedBeforePublish);
+    }
+}
+
+void CapturePipeline::runPublisherLoop()
+{
+    while (true) {
+        unique_ptr<CaptureFrame> frame(take(&publisherQueue_));
+        if (!frame)
+            return;
+
+        if (frame->isEndOfStream())
+            break;
+
+        if (frame->generation != generation_) {
+            VLOG(1) << "frame " << frame->frameId << " was analyzed with the previous history. Dropped.";
+            continue;
+        }
+
+        Clock::time_point beginTime = Clock::now();
+        stats_.publishWait.add(beginTime - frame->analyzedTime);
+
+        bool ok = publisher_(frame.get());
+
+        Clock::time_point endTime = Clock::now();
+        stats_.publish.add(endTime - beginTime);
+        stats_.total.add(endTime - frame->capturedTime);
+        if (endTime - frame->capturedTime > FRAME_BUDGET) {
+            ++numFramesOverBudget_;
+            VLOG(1) << "frame " << frame->frameId << " missed the frame budget: "
+                    << chrono::duration_cast<chrono::microseconds>(endTime - frame->capturedTime).count() << "us";
+        }
+
+        if (!ok)
+            break;
+    }
+
+    shouldStop_ = true;
+    LOG(INFO) << "capture pipeline finished: over budget=" << numFramesOverBudget_ << endl
+              << stats_.toString();
+}
@@ -0,0 +1,124 @@
+#ifndef CAPTURE_CAPTURE_PIPELINE_H_
+#define CAPTURE_CAPTURE_PIPELINE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "base/blocking_queue.h"
+#include "base/executor.h"
+#include "base/latency_histogram.h"
+#include "base/noncopyable.h"
+#include "capture/analyzer.h"
+#include "gui/unique_sdl_surface.h"
+
+class Source;
+
+// CaptureFrame is a frame flowing through CapturePipeline.
+struct CaptureFrame {
+    typedef std::chrono::steady_clock Clock;
+
+    // A frame whose |surface| is nullptr means the source has been exhausted.
+    bool isEndOfStream() const { return !surface; }
+
+    int frameId = 0;
+    // The value of CapturePipeline::resetAnalyzerHistory() calls when this frame was analyzed.
+    int generation = 0;
+    SharedSDLSurface surface;
+    // Filled by the analyzer stage.
+    std::unique_ptr<AnalyzerResult> result;
+
+    Clock::time_point capturedTime;
+    Clock::time_point analyzedTime;
+};
+
+struct CapturePipelineStats {
+    // The time to take a frame from Source.
+    LatencyHistogram source;
+    // The time a frame waits in the queue before being analyzed.
+    LatencyHistogram analyzeWait;
+    LatencyHistogram analyze;
+    // The time a frame waits in the queue before being published.
+    LatencyHistogram publishWait;
+    LatencyHistogram publish;
+    // From the frame being captured until the publisher finishes.
+    LatencyHistogram total;
+
+    // The frames dropped because the next stage was behind.
+    std::atomic<int> numDroppedBeforeAnalyze { 0 };
+    std::atomic<int> numDroppedBeforePublish { 0 };
+
+    std::string toString() const;
+};
+
+// CapturePipeline runs capturing in 3 stages connected with bounded queues:
+//   1. source: takes a frame from Source.
+//   2. analyzer: analyzes the frame. The fields of the 2 players are analyzed in parallel.
+//   3. publisher: passes the analyzed frame to the callback.
+// Each stage has its own thread. When a stage falls behind, the queue in front of it
+// drops the oldest frame instead of stalling the previous stage, so a spike in analyzing
+// doesn't leave stale frames in the queues.
+class CapturePipeline : noncopyable {
+public:
+    typedef CaptureFrame::Clock Clock;
+    // Called for each analyzed frame on the publisher thread.
+    // Should return false to stop the pipeline.
+    typedef std::function<bool (CaptureFrame*)> Publisher;
+
+    // The time a frame can spend from being captured until being published.
+    static const Clock::duration FRAME_BUDGET;
+
+    // Does not take the ownership of |source| and |analyzer|.
+    // They should be alive during CapturePipeline is alive.
+    CapturePipeline(Source*, Analyzer*, Publisher, int queueCapacity = 1);
+    ~CapturePipeline();
+
+    bool start();
+    void stop();
+
+    // The analyzer stage forgets the previous results before analyzing the next frame.
+    // The frames already analyzed with the previous results are dropped instead of
+    // being published. This is used when a new game starts.
+    void resetAnalyzerHistory() { ++generation_; }
+
+    const CapturePipelineStats& stats() const { return stats_; }
+    // The number of frames which missed FRAME_BUDGET.
+    int numFramesOverBudget() const { return numFramesOverBudget_; }
+
+private:
+    void runSourceLoop();
+    void runAnalyzerLoop();
+    void runPublisherLoop();
+
+    // Pushes |frame| to |q|. If |q| is full, the oldest frame in |q| is dropped and counted in |numDropped|.
+    void push(base::BlockingQueue<std::unique_ptr<CaptureFrame>>* q, std::unique_ptr<CaptureFrame> frame,
+              std::atomic<int>* numDropped);
+    // Takes a frame from |q| unless the pipeline is stopped. Returns nullptr if stopped.
+    std::unique_ptr<CaptureFrame> take(base::BlockingQueue<std::unique_ptr<CaptureFrame>>* q);
+
+    Source* source_;
+    Analyzer* analyzer_;
+    Publisher publisher_;
+
+    // Used for analyzing the 2nd player's field in parallel.
+    Executor executor_;
+
+    base::BlockingQueue<std::unique_ptr<CaptureFrame>> analyzerQueue_;
+    base::BlockingQueue<std::unique_ptr<CaptureFrame>> publisherQueue_;
+
+    std::thread sourceThread_;
+    std::thread analyzerThread_;
+    std::thread publisherThread_;
+
+    std::atomic<bool> shouldStop_;
+    std::atomic<int> generation_;
+    std::atomic<int> numFramesOverBudget_;
+
+    CapturePipelineStats stats_;
+};
+
+#endif // CAPTURE_CAPTURE_PIPELINE_H_
@@ -1,6 +1,13 @@
 #ifndef CAPTURE_CAPTURE_SOURCE_H_
 #define CAPTURE_CAPTURE_SOURCE_H_
 
+#include <algorithm>
+
+#include <SDL.h>
+
+#include "capture/yuv_surface.h"
+#include "gui/util.h"
+
 inline void convertUVY2RGBA(int u, int v, int y, int* r, int* g, int* b)
 {
     u -= 128;
@@ -19,4 +26,21 @@ inline void convertUVY2RGBA(int u, int v, int y, int* r, int* g, int* b)
     *b = std::max(0, std::min(255, static_cast<int>(b1)));
 }
 
+// Reads the color at (x, y) of |surface|. A YUV surface is read in place.
+inline void getRGB(const SDL_Surface* surface, int x, int y, Uint8* r, Uint8* g, Uint8* b)
+{
+    if (const YUVSurfaceInfo* info = yuvSurfaceInfo(surface)) {
+        int yy, u, v;
+        getYUV(surface, *info, x, y, &yy, &u, &v);
+        int ri, gi, bi;
+        convertUVY2RGBA(u, v, yy, &ri, &gi, &bi);
+        *r = ri;
+        *g = gi;
+        *b = bi;
+        return;
+    }
+
+    SDL_GetRGB(getpixel(surface, x, y), surface->format, r, g, b);
+}
+
 #endif
@@ -12,6 +12,7 @@
 #include "capture/ac_analyzer.h"
 #include "capture/capture.h"
 #include "capture/color.h"
+#include "capture/movie_segment_decoder.h"
 #include "capture/movie_source.h"
 #include "gui/bounding_box.h"
 #include "gui/main_window.h"
@@ -20,6 +21,10 @@
 
 using namespace std;
 
+DEFINE_int32(decoder_threads, 1, "the number of threads FFmpeg uses to decode each segment");
+
+DECLARE_int32(num_threads);
+
 int main(int argc, char* argv[])
 {
     google::ParseCommandLineFlags(&argc, &argv, true);
@@ -34,14 +39,6 @@ int main(int argc, char* argv[])
     atexit(SDL_Quit);
 
     MovieSource::init();
-    MovieSource source(argv[1]);
-    if (!source.ok()) {
-        cerr << "failed to load " << argv[1] << endl;
-        return EXIT_FAILURE;
-    }
-
-    source.setFPS(0);
-    int num = 0;
 
     // TODO(mayah): Since bounding box is initialized in ACAnalyzer, we need to use this here.
     // This must be wrong.
@@ -52,12 +49,8 @@ int main(int argc, char* argv[])
     const int IMAGE_WIDTH = 32 * 20;
     // const int IMAGE_HEIGHT = 32 * 14;
 
-    while (true) {
-        source.nextStep();
-        UniqueSDLSurface surf = source.getNextFrame();
-        if (!surf.get())
-            break;
-
+    MovieSegmentDecoder decoder(argv[1], FLAGS_num_threads, FLAGS_decoder_threads);
+    bool ok = decoder.run([&](int frameIndex, SDL_Surface* surf) {
         UniqueSDLSurface up(makeUniqueSDLSurface(SDL_CreateRGBSurface(0, 320, 224, 32, 0, 0, 0, 0)));
         UniqueSDLSurface down(makeUniqueSDLSurface(SDL_CreateRGBSurface(0, 320, 224, 32, 0, 0, 0, 0)));
 
@@ -65,21 +58,28 @@ int main(int argc, char* argv[])
             const int y = IMAGE_OFFSET_Y + 2 * i;
             SDL_Rect srcRect { IMAGE_OFFSET_X, y, IMAGE_WIDTH, 1 };
             SDL_Rect dstRect { 0, i, 320, 1 };
-            SDL_BlitScaled(surf.get(), &srcRect, up.get(), &dstRect);
+            SDL_BlitScaled(surf, &srcRect, up.get(), &dstRect);
         }
 
         for (int i = 0; i < 224; ++i) {
             const int y = IMAGE_OFFSET_Y + 2 * i + 1;
             SDL_Rect srcRect { IMAGE_OFFSET_X, y, IMAGE_WIDTH, 1 };
             SDL_Rect dstRect { 0, i, 320, 1 };
-            SDL_BlitScaled(surf.get(), &srcRect, down.get(), &dstRect);
+            SDL_BlitScaled(surf, &srcRect, down.get(), &dstRect);
         }
 
+        // Each frame makes 2 images. File names are determined by the frame index,
+        // so they don't depend on the number of threads.
         char buf[80];
-        sprintf(buf, "orig-%05d.bmp", ++num);
+        sprintf(buf, "orig-%05d.bmp", 2 * frameIndex + 1);
         SDL_SaveBMP(up.get(), buf);
-        sprintf(buf, "orig-%05d.bmp", ++num);
+        sprintf(buf, "orig-%05d.bmp", 2 * frameIndex + 2);
         SDL_SaveBMP(down.get(), buf);
+    });
+
+    if (!ok) {
+        cerr << "failed to load " << argv[1] << endl;
+        return EXIT_FAILURE;
     }
 
     return 0;
@@ -0,0 +1,65 @@
+#include "capture/movie_segment_decoder.h"
+
+#include <atomic>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "base/executor.h"
+#include "base/wait_group.h"
+#include "capture/movie_source.h"
+
+using namespace std;
+
+MovieSegmentDecoder::MovieSegmentDecoder(const string& filename, int numThreads, int numDecoderThreads) :
+    filename_(filename),
+    numThreads_(max(1, numThreads)),
+    numDecoderThreads_(numDecoderThreads)
+{
+}
+
+bool MovieSegmentDecoder::run(const Callback& callback)
+{
+    const vector<MovieSegment> segments = MovieSource::splitIntoSegments(filename_, numThreads_);
+    if (segments.empty())
+        return false;
+
+    LOG(INFO) << "decoding " << filename_ << " in " << segments.size() << " segments";
+
+    Executor executor(numThreads_);
+    executor.start();
+
+    atomic<bool> ok(true);
+    WaitGroup wg;
+    wg.add(segments.size());
+    for (const MovieSegment& segment : segments) {
+        executor.submit([this, &segment, &callback, &ok, &wg]() {
+            MovieSource source(filename_, numDecoderThreads_);
+            source.setFPS(-1);
+            if (!source.ok() || (segment.startPts != INT64_MIN && !source.seek(segment.startPts))) {
+                ok = false;
+                wg.done();
+                return;
+            }
+            source.setEndPts(segment.endPts);
+
+            int numFrames = 0;
+            while (true) {
+                UniqueSDLSurface surface = source.getNextFrame();
+                if (!surface.get())
+                    break;
+                callback(segment.firstFrameIndex + numFrames, surface.get());
+                ++numFrames;
+            }
+
+            LOG_IF(WARNING, numFrames != segment.numFrames)
+                << "segment starting at frame " << segment.firstFrameIndex << ": expected "
+                << segment.numFrames << " frames, but decoded " << numFrames << " frames";
+            wg.done();
+        });
+    }
+
+    wg.waitUntilDone();
+    executor.stop();
+    return ok;
+}
@@ -0,0 +1,33 @@
+#ifndef CAPTURE_MOVIE_SEGMENT_DECODER_H_
+#define CAPTURE_MOVIE_SEGMENT_DECODER_H_
+
+#include <functional>
+#include <string>
+
+#include <SDL.h>
+
+#include "base/noncopyable.h"
+
+// MovieSegmentDecoder decodes a whole movie as fast as possible.
+// The movie is split into segments starting with key frames, and each segment
+// is decoded by its own MovieSource in parallel.
+// This is useful for tools which process each frame independently.
+class MovieSegmentDecoder : noncopyable {
+public:
+    // |frameIndex| is the index of the frame in the whole movie, so it's deterministic
+    // regardless of the number of threads. The callback is called from several threads
+    // at once, but frames in the same segment are passed in order.
+    typedef std::function<void (int frameIndex, SDL_Surface*)> Callback;
+
+    MovieSegmentDecoder(const std::string& filename, int numThreads, int numDecoderThreads = 1);
+
+    // Returns false if the movie could not be decoded.
+    bool run(const Callback&);
+
+private:
+    const std::string filename_;
+    const int numThreads_;
+    const int numDecoderThreads_;
+};
+
+#endif // CAPTURE_MOVIE_SEGMENT_DECODER_H_
@@ -1,5 +1,6 @@
 #include "capture/movie_source.h"
 
+#include <algorithm>
 #include <iostream>
 
 using namespace std;
@@ -9,7 +10,7 @@ using namespace std;
 #define PIX_FMT_RGB24 AV_PIX_FMT_RGB24
 #endif
 
-MovieSource::MovieSource(const char* filename) :
+MovieSource::MovieSource(const char* filename, int numDecoderThreads) :
     filename_(filename),
     waitUntilTrue_(true),
     sws_(NULL),
@@ -17,8 +18,8 @@ MovieSource::MovieSource(const char* filename) :
 {
     format_ = NULL;
 
-    if (avformat_open_input(&format_, filename_, NULL, NULL) != 0) {
-        fprintf(stderr, "Couldn't open file: %s\n", filename_);
+    if (avformat_open_input(&format_, filename_.c_str(), NULL, NULL) != 0) {
+        fprintf(stderr, "Couldn't open file: %s\n", filename_.c_str());
         return;
     }
 
@@ -54,10 +55,16 @@ MovieSource::MovieSource(const char* filename) :
         codec_->flags |= CODEC_FLAG_TRUNCATED;
     }
 
+    // Frame threading delays the output by (thread_count - 1) frames.
+    // The delayed frames are flushed in decodeNextFrame().
+    codec_->thread_count = numDecoderThreads;
+    codec_->thread_type = FF_THREAD_FRAME | FF_THREAD_SLICE;
+
     if (avcodec_open2(codec_, c, NULL) < 0) {
         fprintf(stderr, "Couldn't open codec\n");
         return;
     }
+    codecOpened_ = true;
 
 #if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(55, 28, 1)
     // av_frame_alloc is introduced lavc 55.28.1
@@ -91,7 +98,7 @@ MovieSource::MovieSource(const char* filename) :
 #endif
 
     int buf_len = avpicture_get_size(PIX_FMT_RGB24, width_, height_);
-    uint8_t* buffer = (uint8_t*)calloc(sizeof(uint8_t), buf_len);
+    uint8_t* buffer = (uint8_t*)av_mallocz(buf_len);
     avpicture_fill((AVPicture*)frame_rgb_, buffer,
                    PIX_FMT_RGB24, width_, height_);
 
@@ -108,7 +115,25 @@ MovieSource::MovieSource(const char* filename) :
 
 MovieSource::~MovieSource()
 {
-    // TODO(hamaji): Free resource.
+    // Several MovieSources can be created for one movie (e.g. MovieSegmentDecoder),
+    // so we have to release the decoder resources.
+    surf_.reset();
+    if (sws_)
+        sws_freeContext(sws_);
+    // The picture buffer of |frame_rgb_| is allocated separately, so av_frame_free() doesn't free it.
+    if (frame_rgb_)
+        av_free(frame_rgb_->data[0]);
+#if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(55, 28, 1)
+    av_frame_free(&frame_rgb_);
+    av_frame_free(&frame_);
+#else
+    avcodec_free_frame(&frame_rgb_);
+    avcodec_free_frame(&frame_);
+#endif
+    if (codecOpened_)
+        avcodec_close(codec_);
+    if (format_)
+        avformat_close_input(&format_);
 }
 
 void MovieSource::nextStep()
@@ -116,41 +141,71 @@ void MovieSource::nextStep()
     waitUntilTrue_ = true;
 }
 
-UniqueSDLSurface MovieSource::getNextFrame()
+bool MovieSource::decodeNextFrame()
 {
-    int frame_finished;
+    int frame_finished = 0;
     while (true) {
+        if (draining_) {
+            // Flush the frames delayed in the decoder.
+            AVPacket flushPacket;
+            av_init_packet(&flushPacket);
+            flushPacket.data = nullptr;
+            flushPacket.size = 0;
+            avcodec_decode_video2(codec_, frame_, &frame_finished, &flushPacket);
+            return frame_finished;
+        }
+
         if (av_read_frame(format_, &packet_) < 0) {
-            done_ = true;
-            return emptyUniqueSDLSurface();
+            draining_ = true;
+            continue;
         }
 
-        if (packet_.stream_index == video_index_) {
+        if (packet_.stream_index == video_index_)
             avcodec_decode_video2(codec_, frame_, &frame_finished, &packet_);
+        av_free_packet(&packet_);
 
-            if (frame_finished) {
-                sws_ = sws_getCachedContext(sws_,
-                                            width_, height_, codec_->pix_fmt,
-                                            width_, height_, PIX_FMT_RGB24,
-                                            SWS_BICUBIC, NULL, NULL, NULL);
+        if (frame_finished)
+            return true;
+    }
+}
 
-                sws_scale(sws_, frame_->data, frame_->linesize, 0, height_, frame_rgb_->data, frame_rgb_->linesize);
-                break;
-            }
+UniqueSDLSurface MovieSource::getNextFrame()
+{
+    while (true) {
+        if (!decodeNextFrame()) {
+            done_ = true;
+            return emptyUniqueSDLSurface();
         }
 
-        av_free_packet(&packet_);
+        currentPts_ = av_frame_get_best_effort_timestamp(frame_);
+        if (currentPts_ == AV_NOPTS_VALUE)
+            break;
+        // After seeking, the decoder might output frames before the key frame.
+        if (currentPts_ < startPts_)
+            continue;
+        if (endPts_ <= currentPts_) {
+            done_ = true;
+            return emptyUniqueSDLSurface();
+        }
+        break;
     }
 
+    sws_ = sws_getCachedContext(sws_,
+                                width_, height_, codec_->pix_fmt,
+                                width_, height_, PIX_FMT_RGB24,
+                                SWS_BICUBIC, NULL, NULL, NULL);
+    sws_scale(sws_, frame_->data, frame_->linesize, 0, height_, frame_rgb_->data, frame_rgb_->linesize);
+
     // Wait until next frame.
     Uint32 currentTime = SDL_GetTicks();
     Uint32 elapsed = currentTime - lastTaken_;
     if (fps_ == 0) {
-        while (!waitUntilTrue_) {
+        // end() can be called while we're waiting.
+        while (!waitUntilTrue_ && !done_) {
             SDL_Delay(10);
         }
         waitUntilTrue_ = false;
-    } else if (static_cast<int>(elapsed) < 1000 / fps_) {
+    } else if (fps_ > 0 && static_cast<int>(elapsed) < 1000 / fps_) {
         int d = 1000 / fps_ - elapsed;
         SDL_Delay(d);
     }
@@ -159,6 +214,85 @@ UniqueSDLSurface MovieSource::getNextFrame()
     return makeUniqueSDLSurface(SDL_ConvertSurface(surf_.get(), surf_->format, 0));
 }
 
+bool MovieSource::seek(int64_t pts)
+{
+    if (av_seek_frame(format_, video_index_, pts, AVSEEK_FLAG_BACKWARD) < 0) {
+        fprintf(stderr, "Couldn't seek to %lld\n", static_cast<long long>(pts));
+        return false;
+    }
+
+    avcodec_flush_buffers(codec_);
+    startPts_ = pts;
+    draining_ = false;
+    done_ = false;
+    return true;
+}
+
+// static
+vector<MovieSegment> MovieSource::splitIntoSegments(const string& filename, int numSegments)
+{
+    AVFormatContext* format = nullptr;
+    if (avformat_open_input(&format, filename.c_str(), NULL, NULL) != 0) {
+        fprintf(stderr, "Couldn't open file: %s\n", filename.c_str());
+        return vector<MovieSegment>();
+    }
+    if (avformat_find_stream_info(format, nullptr) < 0) {
+        fprintf(stderr, "Couldn't find stream infomation\n");
+        avformat_close_input(&format);
+        return vector<MovieSegment>();
+    }
+
+    int videoIndex = av_find_best_stream(format, AVMEDIA_TYPE_VIDEO, -1, -1, nullptr, 0);
+    if (videoIndex < 0) {
+        fprintf(stderr, "Couldn't find a video stream\n");
+        avformat_close_input(&format);
+        return vector<MovieSegment>();
+    }
+
+    // The pts of all frames, and the pts of the key frames.
+    vector<int64_t> framePts;
+    vector<int64_t> keyFramePts;
+    AVPacket packet;
+    while (av_read_frame(format, &packet) >= 0) {
+        if (packet.stream_index == videoIndex) {
+            int64_t pts = packet.pts != AV_NOPTS_VALUE ? packet.pts : packet.dts;
+            framePts.push_back(pts);
+            if (packet.flags & AV_PKT_FLAG_KEY)
+                keyFramePts.push_back(pts);
+        }
+        av_free_packet(&packet);
+    }
+    avformat_close_input(&format);
+
+    // Packets are in the decoding order. We need the display order.
+    sort(framePts.begin(), framePts.end());
+    sort(keyFramePts.begin(), keyFramePts.end());
+
+    // The index of the frame at |pts| in the display order.
+    auto frameIndexOf = [&framePts](int64_t pts) {
+        return static_cast<int>(lower_bound(framePts.begin(), framePts.end(), pts) - framePts.begin());
+    };
+
+    const int numFrames = framePts.size();
+    const int numFramesPerSegment = (numFrames + numSegments - 1) / max(1, numSegments);
+
+    vector<MovieSegment> segments;
+    // The first segment always starts from the beginning, even if the first frame is not a key frame.
+    segments.push_back(MovieSegment { INT64_MIN, INT64_MAX, 0, numFrames });
+    for (int64_t pts : keyFramePts) {
+        int index = frameIndexOf(pts);
+        if (index < segments.back().firstFrameIndex + numFramesPerSegment)
+            continue;
+
+        MovieSegment& last = segments.back();
+        last.endPts = pts;
+        last.numFrames = index - last.firstFrameIndex;
+        segments.push_back(MovieSegment { pts, INT64_MAX, index, numFrames - index });
+    }
+
+    return segments;
+}
+
 void MovieSource::init()
 {
     av_register_all();
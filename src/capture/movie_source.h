@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <string>
+#include <vector>
 
 #include <SDL.h>
 
@@ -16,38 +17,73 @@ extern "C" {
 #include "capture/source.h"
 #include "gui/unique_sdl_surface.h"
 
+// A range of frames in a movie. |startPts| is always a key frame, so a segment
+// can be decoded independently from the others.
+struct MovieSegment {
+    int64_t startPts;
+    // The pts of the first frame of the next segment. INT64_MAX for the last segment.
+    int64_t endPts;
+    // The index of the first frame of this segment in the whole movie.
+    int firstFrameIndex;
+    int numFrames;
+};
+
 class MovieSource : public Source {
 public:
-    explicit MovieSource(const char* filename);
-    explicit MovieSource(const std::string& filename) :
-        MovieSource(filename.c_str()) {}
+    // When |numDecoderThreads| is larger than 1, FFmpeg decodes frames (or slices) in parallel.
+    // 0 means FFmpeg chooses the number of threads.
+    explicit MovieSource(const char* filename, int numDecoderThreads = 1);
+    explicit MovieSource(const std::string& filename, int numDecoderThreads = 1) :
+        MovieSource(filename.c_str(), numDecoderThreads) {}
 
     virtual ~MovieSource();
 
     virtual UniqueSDLSurface getNextFrame();
 
+    // When |fps| is 0, getNextFrame() waits until nextStep() is called.
+    // When |fps| is negative, getNextFrame() returns frames as fast as possible.
     void setFPS(int fps) { fps_ = fps; }
     void nextStep();
 
+    // Seeks to the key frame at |pts|. Frames before |pts| are skipped.
+    bool seek(int64_t pts);
+    // The movie is considered to end before the frame at |pts|.
+    void setEndPts(int64_t pts) { endPts_ = pts; }
+    // The pts of the frame last returned by getNextFrame().
+    int64_t currentPts() const { return currentPts_; }
+
+    // Splits the movie into at most |numSegments| segments having almost the same number of frames.
+    // Each segment starts with a key frame. Only packets are read, so this is much faster than decoding.
+    static std::vector<MovieSegment> splitIntoSegments(const std::string& filename, int numSegments);
+
     static void init();
 
 private:
-    const char* filename_;
+    bool decodeNextFrame();
+
+    const std::string filename_;
 
     int fps_ = 60;
     Uint32 lastTaken_ = 0;
     // Default must be true to show the first image.
     std::atomic<bool> waitUntilTrue_;
 
-    AVFormatContext* format_;
-    AVCodecContext* codec_;
-    AVFrame* frame_;
-    AVFrame* frame_rgb_;
+    AVFormatContext* format_ = nullptr;
+    AVCodecContext* codec_ = nullptr;
+    AVFrame* frame_ = nullptr;
+    AVFrame* frame_rgb_ = nullptr;
+    bool codecOpened_ = false;
     int video_index_;
 
     AVPacket packet_;
     SwsContext* sws_;
 
+    int64_t startPts_ = INT64_MIN;
+    int64_t endPts_ = INT64_MAX;
+    int64_t currentPts_ = AV_NOPTS_VALUE;
+    // True after all packets are read. The decoder might still have delayed frames.
+    bool draining_ = false;
+
     UniqueSDLSurface surf_;
 };
 
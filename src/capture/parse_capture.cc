@@ -21,6 +21,9 @@
 DEFINE_bool(save_screenshot, false, "save screenshot");
 DEFINE_bool(draw_result, true, "draw analyzer result");
 DEFINE_string(source, "syntek", "set image source");
+#if USE_V4L2
+DEFINE_bool(v4l2_zero_copy, false, "analyze V4L2 frames in place in the device's native YUV format, and convert them to RGB only for drawing");
+#endif
 
 static unique_ptr<Source> makeVideoSource()
 {
@@ -31,7 +34,7 @@ static unique_ptr<Source> makeVideoSource()
     if (strings::hasPrefix(FLAGS_source, "v4l2:")) {
         std::string deviceName = FLAGS_source.substr(5);
         cout << "V4L2 device name: " << deviceName << endl;
-        return unique_ptr<Source>(new VidDevSource(deviceName));
+        return unique_ptr<Source>(new VidDevSource(deviceName, FLAGS_v4l2_zero_copy));
     }
 #endif
 
@@ -18,7 +18,8 @@
 
 
 DEFINE_bool(draw_result, true, "draw analyzer result");
-DEFINE_int32(fps, 60, "FPS. When 0, hitting space will go next step.");
+DEFINE_int32(fps, 60, "FPS. When 0, hitting space will go next step. When negative, frames are decoded as fast as possible.");
+DEFINE_int32(decoder_threads, 1, "the number of threads FFmpeg uses to decode the movie");
 
 int main(int argc, char* argv[])
 {
@@ -35,7 +36,7 @@ int main(int argc, char* argv[])
     SDL_Init(SDL_INIT_VIDEO);
     atexit(SDL_Quit);
 
-    MovieSource source(argv[1]);
+    MovieSource source(argv[1], FLAGS_decoder_threads);
     if (!source.ok()) {
         fprintf(stderr, "Failed to load %s\n", argv[1]);
         exit(EXIT_FAILURE);
@@ -1,3141 +0,0 @@
-#include "capture/recognition/classifier_features.h"
-
-#include <cstddef>
-#include <cstdint>
-
-const std::size_t RED_MEAN_SIZE = 768;
-const std::size_t RED_COV_SIZE = 768;
-const std::size_t BLUE_MEAN_SIZE = 768;
-const std::size_t BLUE_COV_SIZE = 768;
-const std::size_t YELLOW_MEAN_SIZE = 768;
-const std::size_t YELLOW_COV_SIZE = 768;
-const std::size_t GREEN_MEAN_SIZE = 768;
-const std::size_t GREEN_COV_SIZE = 768;
-const std::size_t PURPLE_MEAN_SIZE = 768;
-const std::size_t PURPLE_COV_SIZE = 768;
-const std::size_t EMPTY_MEAN_SIZE = 768;
-const std::size_t EMPTY_COV_SIZE = 768;
-const std::size_t OJAMA_MEAN_SIZE = 768;
-const std::size_t OJAMA_COV_SIZE = 768;
-const std::size_t ZENKESHI_MEAN_SIZE = 768;
-const std::size_t ZENKESHI_COV_SIZE = 768;
-
-const double RED_MEAN[] = {
-    -1.4904896489570068e-04, +8.0844916422581186e-05, +6.6617075279582719e-04, +6.2278768582680341e-04,
-    +3.9498832355516414e-04, -3.9600116105343675e-04, +4.7400033851686653e-04, +3.3797217100839405e-04,
-    -1.1212446220510474e-03, -2.2134754889592813e-05, -3.3363455821626604e-04, -1.2784601872842837e-03,
-    +3.9770277748564818e-04, -9.2822805128302908e-05, +7.9408388842637121e-04, +4.7180734271923800e-04,
-    +2.1729924313229727e-05, -3.5863497049604023e-04, +2.6181990485376824e-04, -4.0905175834836117e-04,
-    -1.5143067407042896e-03, +1.8303329498643174e-05, -3.4358638826962077e-04, -1.1092852263860046e-03,
-    -1.6775116481733260e-05, -2.4825530474253417e-04, +8.0273104284300429e-05, -3.7063475298725876e-04,
-    -1.8144351751609914e-04, -1.1346085546670803e-03, -2.2090965735904608e-04, +2.5916343197149473e-04,
-    +1.2445966349748861e-04, +1.9509034120680132e-04, +6.3357713643340512e-04, +2.4519380147830370e-04,
-    +6.9225295522011388e-06, +2.0861613774811981e-04, -1.1437956118424955e-03, -3.0884663493641204e-06,
-    +1.5268124625012215e-04, -1.1770947792249743e-03, +1.2032731931451518e-04, +3.1617051036555630e-04,
-    -4.5032897478501535e-04, +5.6745212695046071e-05, +2.4338495656206092e-04, -7.9094074871831766e-06,
-    +8.6689433827986023e-05, +3.9076345106192558e-04, +1.0154158966556774e-03, +1.3142188400634122e-04,
-    +2.8112183126712573e-04, -6.5694907924973588e-04, -3.1560008703902630e-04, -3.9365216730953881e-04,
-    -1.9521701050771668e-04, -3.1754120523001079e-04, -4.7696830937497494e-04, +1.4415974160515745e-03,
-    -4.6008888387907262e-04, -7.5205006323678775e-04, +2.1449157685999071e-04, -9.7312932916242636e-05,
-    -4.5145240459358045e-04, -1.3620947737799934e-04, -8.7702414823229608e-06, -2.1326631447762194e-04,
-    -5.1805316158506877e-04, +6.0258780061195574e-05, -3.0048782167556363e-04, -8.8420467507350641e-04,
-    +3.4716177426548670e-04, +1.6157160781702596e-04, -5.8274327186040459e-05, +1.9727450848412375e-04,
-    +1.6371006494224799e-04, -3.4105481681784652e-04, -2.9778974703689395e-04, -1.4454494082038363e-04,
-    +4.9591177299801217e-05, +5.2741285855510353e-05, +2.9591387334150802e-04, +1.3032718944131136e-03,
-    -2.4171743950287050e-04, -3.2025180123422336e-04, +3.6875565590280772e-04, -2.2167592315659967e-04,
-    -2.4784767326659497e-04, -1.9201268173464024e-03, +6.0946121401612601e-05, +3.0589999054907863e-04,
-    +1.3160904430892335e-03, +2.4059670985708336e-04, +4.2779467500442757e-04, +9.2917744558821552e-04,
-    -1.1265431979764645e-04, +2.9397443515591560e-04, +1.5617583421073838e-03, -6.1629343131470039e-04,
-    -7.3207172703456237e-04, -4.1193548756410271e-03, -2.2406129806340792e-04, -3.3065723051932372e-04,
-    +1.8751661159541360e-03, +1.6269339437480768e-04, +3.2705847299179441e-04, +1.9025765480787447e-03,
-    -3.7032612479962878e-04, -4.1032517391799054e-04, +9.3343374945231022e-04, -3.8923981378175036e-04,
-    -6.2539883802516856e-04, +3.3001793351248524e-04, -3.5395765588360574e-04, -4.0974569556584720e-04,
-    +5.1780807762370794e-04, -4.6729008399179256e-04, -5.3802803953065801e-04, +3.2954973746781424e-04,
-    -4.1850461942035663e-04, -5.9521978988016325e-04, +6.2156184446646428e-04, -3.1762384619809830e-04,
-    -5.5432561816255092e-04, +3.4064390827699871e-04, -1.6338411835761714e-04, -3.5983056231920439e-04,
-    -6.6942574524056877e-04, -5.0671931042646045e-04, -7.7087063563544380e-04, -1.3862454255697096e-03,
-    -3.3302625611015636e-05, -1.9424717242355152e-04, -1.0795553112407782e-04, -2.4906331627206794e-04,
-    -4.6865685764834201e-04, -3.6397030768900592e-03, +2.2001806147680411e-06, +2.6632809070217052e-04,
-    +1.2777433833653909e-03, +1.0843517795317685e-04, +1.3381634796964592e-04, +1.5546309469349749e-03,
-    -3.4275358974969094e-05, +2.7180589576347052e-04, -1.7128936596595616e-03, +2.0549845963267678e-04,
-    +6.5474531086218200e-04, +3.0066206968180366e-03, +5.4106152595258337e-04, -2.9758632997441175e-05,
-    +1.5023464090762424e-03, +1.6139297666747541e-04, -1.4358573046243384e-03, +2.0059739299111361e-04,
-    +5.1287188728089619e-05, -1.1212488902332572e-03, +1.8265576705278155e-04, +2.4476869323405011e-05,
-    -7.1532747913971670e-04, +7.9108098731339648e-05, -6.9743921450790005e-05, -5.7083456793893545e-04,
-    +8.8878587566376262e-05, -2.2140008527390137e-05, -6.7367613196633641e-04, +6.2372938338855745e-05,
-    -4.1827732818314722e-05, -1.0192299130789692e-03, -2.8308836109417325e-04, -2.0830499911054658e-04,
-    -1.2858044060862935e-03, -2.4474855181652041e-04, -1.4099782650302571e-04, -1.2855263633537153e-03,
-    -3.0126442014472047e-05, +2.8813266743012313e-04, -8.4397866224625664e-04, -3.5166926577886608e-04,
-    -1.6300966309980086e-04, -1.2841190711856628e-03, -2.1870290256259606e-03, +2.2332519093277983e-04,
-    -6.0239671327174207e-05, -1.3057187271693232e-03, -9.7808806183477827e-05, -5.1636737888735159e-05,
-    +1.2650487500483386e-04, -3.4683746184928516e-05, -1.6274996346385106e-04, +4.7890168831563637e-04,
-    -1.4969152987113118e-04, +1.3685474897345064e-04, -6.2141092899492979e-04, +1.9439186615693362e-05,
-    -5.3695476536853805e-04, +1.2034503408198814e-03, +5.0246331499600332e-04, -1.7080866910561890e-03,
-    -4.3825017948285525e-05, +3.9989064746403537e-04, -8.4341435344961670e-04, +1.3139957005015154e-04,
-    +3.4670555339376120e-04, -1.5708160930804504e-04, +3.0420910363128303e-04, +3.0079995142020529e-04,
-    +8.3971894621687074e-05, +3.7432508676298970e-04, +2.2177524988297779e-04, -1.2488840608660675e-04,
-    +1.3344365398922873e-04, +1.9899509425695265e-04, -2.6406779024601201e-04, +1.4699889522258016e-05,
-    +1.9221592571119797e-04, -3.7183342438559499e-04, -1.2267817673489859e-04, +1.4340052268881629e-04,
-    -1.6714618879678023e-04, -1.6782616915744637e-04, +5.5547797136675063e-05, -4.8321079478661454e-04,
-    -5.5105756876487010e-05, +3.3187617389031300e-04, -5.5278439145005343e-04, -5.2006720740290924e-06,
-    +6.8772664595841983e-04, -9.9754425495293870e-04, -1.8544063911401861e-04, +2.7909033697510484e-04,
-    -2.3459597197492585e-04, +2.1030570673053711e-03, +2.9901856441813556e-04, +8.1619281827794625e-04,
-    +3.8823230457521846e-03, +1.0417894137546790e-04, +7.7420760341733911e-05, -1.7238338034726451e-03,
-    -4.5669459113583326e-04, -1.0539537889057655e-04, -2.0666583832880956e-03, +6.4332123882819678e-04,
-    -4.0886422065946530e-04, -8.6128978127894014e-05, +6.3761361544486866e-04, -6.0045348087727087e-04,
-    -1.9394986615745209e-04, +4.8212739236158734e-04, +2.0886270299988431e-04, +4.8069941249159694e-04,
-    +4.5189678261100153e-04, +5.8403269970727038e-04, +6.2835601013475420e-04, +4.0119907712763797e-04,
-    +4.0117811408550127e-04, +3.9078174035359227e-04, +1.5606795611929327e-04, -1.3728150142894565e-04,
-    -1.5495419559195112e-04, +7.3293245781162056e-06, -3.8210517850690038e-04, -4.3626096843360425e-04,
-    +6.8086027955169956e-05, -1.7653310733897041e-04, -3.8422656479838313e-04, +3.2484590135457598e-04,
-    +4.3901172124015099e-04, +1.9428205598039178e-04, +2.5867695751482801e-04, +4.9498894448141682e-04,
-    +4.3046277112301532e-04, +3.6947876641585560e-04, +1.8545885234106418e-04, +7.8989160124850544e-04,
-    +8.1841143074049536e-04, -2.9882032965966192e-04, +3.1679962387964401e-04, +7.3639133457737501e-04,
-    -2.1002539983461124e-04, -1.3610533394970705e-04, +1.7197106427620617e-04, +7.7409283591950125e-04,
-    -7.7925921467757034e-05, -1.4108851519005643e-04, -9.6830407657418286e-05, -3.3132333806875020e-03,
-    -3.9597244261137124e-04, -2.5037334368549415e-04, -1.0833533358145910e-03, +7.7729553886160291e-04,
-    -2.5819405094999005e-04, -9.7803014830008159e-04, +5.4666025155438705e-04, -2.5661322066039397e-04,
-    -2.1936093455707348e-04, +4.2622247641948419e-04, +3.5534366315679384e-04, +2.8646751207852248e-04,
-    +4.3846067115336097e-04, +5.3477848423573102e-04, +4.8180671177017594e-04, +4.2798564517110483e-04,
-    +4.3332653226672542e-04, +2.6720931305753283e-04, +3.1327824803814576e-05, -5.7492645974087863e-04,
-    -5.2163868494510470e-04, +2.3300346326947044e-05, -7.1777168130358665e-04, -6.6522590173229157e-04,
-    +4.6991057871514740e-04, +1.6548256211935819e-04, +1.2761012485095700e-04, +6.7260130309328679e-04,
-    +6.8199031483462402e-04, +5.8997673609339563e-04, +5.0546977024193982e-04, +6.2931767395850012e-04,
-    +5.6628302067236616e-04, +3.6154632472308005e-04, +1.8997141945890420e-04, +1.5365088648807335e-04,
-    +3.7422936914527735e-04, -6.5251039456379627e-04, -6.4634796769898607e-04, +7.3812699334716687e-04,
-    -5.4115221239069006e-03, -1.4851740013528043e-03, -1.8042960720732505e-04, -1.0243284421494255e-03,
-    -9.4259748020901349e-04, -6.7865577555124509e-05, +3.2529060785237818e-05, -1.8974205204039401e-03,
-    +4.7105994405486838e-05, -3.9417525948698753e-04, -7.6272208398076935e-04, +1.0053433890161992e-03,
-    -1.9540580763432636e-04, -1.0676233865018808e-03, +5.3356154405724879e-04, +1.5921904149837274e-04,
-    -2.6285403541265157e-04, +3.4163076629392918e-04, +1.3403508300343389e-04, +2.3641520582098305e-04,
-    +3.1974564563557389e-04, +3.5616362410355540e-04, +2.0164541611138542e-04, +2.6295351649538375e-04,
-    +6.6813373845882798e-05, +4.4732470474217410e-05, +1.5711902138547726e-04, -3.2070068657225390e-04,
-    -4.4351767688960078e-04, +2.4874807172483503e-04, -4.6369672161198272e-04, -6.4756725774286691e-04,
-    +6.3151790712294117e-04, +4.8954554873015818e-04, +1.9248292180594302e-04, +1.7701947239723726e-04,
-    -6.5539248766291580e-05, +3.7692724210627758e-05, -4.5277457849892446e-05, -1.5504282383183428e-04,
-    -6.8335409829634722e-05, -9.0402150447048001e-05, -3.3437969581459186e-04, -3.9480306656401769e-04,
-    +2.0298648064414904e-04, -6.1611452078954264e-04, -6.7188015682535676e-04, +8.0854241902506891e-05,
-    -2.3519036383687474e-03, -1.7305736446319333e-03, +6.1740971128869783e-04, -1.2962351934493988e-03,
-    -1.8086675460755053e-03, +2.6343958246000045e-04, -1.0211967914644254e-04, -4.0897856743188387e-04,
-    -6.4390232851046537e-04, -1.2179466477703499e-03, -7.9985263073000326e-04, +7.2867030927630051e-05,
-    -1.6033536027533612e-03, -1.6520845915117648e-03, +5.8373978521932073e-05, -2.0512611501178442e-05,
-    +2.8573067060358605e-04, +8.0087173084753720e-04, +8.9875721495291075e-04, +6.8893992626882278e-04,
-    +3.5755597475768642e-04, +2.6694539099305839e-04, +2.2667064155259509e-04, +4.4912127901449892e-04,
-    +2.4905565783331991e-04, +2.6410335906165304e-04, +2.5682231983907366e-04, -3.1734422770535772e-04,
-    -2.7821443642659624e-04, +1.4368932706725310e-04, -8.2819991109802011e-04, -9.1349550843481786e-04,
-    +2.2876014218775961e-04, -2.0321831508445158e-04, -4.1760917198353597e-04, +2.3762500730019237e-04,
-    -3.7522379726162790e-05, +4.6269714067283927e-05, +8.9767713315160760e-05, -1.8391411535695915e-04,
-    +7.2795681655078953e-07, -1.1735767609363863e-04, -5.6492974802450186e-04, -3.3029030413554667e-04,
-    +2.4855611020154573e-04, -6.5007990470312071e-04, -1.0853043270726095e-04, -8.7741951610729207e-05,
-    -1.4820191997185342e-03, -6.4512809736084326e-04, +9.7762717336117005e-04, -1.7100243062409626e-03,
-    -1.1908304913543135e-03, +2.0440853103865508e-04, -1.0427365138159693e-04, +1.4478635903521296e-03,
-    -8.4961817459953059e-04, -1.4928700240670879e-04, -1.6223005729142385e-03, +1.4396436652685810e-05,
-    +3.7899705616606643e-04, -5.8978544824915960e-05, +1.5176338767407632e-05, -5.2856653234095176e-04,
-    -8.3631585003214720e-05, +1.7941070298277395e-04, -9.2318747182068691e-05, -1.9614954859359873e-04,
-    +2.4385316060847724e-04, +9.0937162970438780e-05, -1.9276345171088323e-05, +3.0930725587868856e-04,
-    +1.8414929755780369e-04, +1.5575828699777348e-04, +4.4013247487181346e-04, +3.2460509400048578e-04,
-    +6.7297879258791389e-05, -4.8986882955370339e-05, -1.2888085405533623e-03, -9.5284972339766661e-04,
-    -2.8284588017098790e-04, -2.0545344642569929e-03, -1.2639550397521941e-03, -1.9447491891360703e-04,
-    -5.0460548960051018e-04, -4.4984600289795082e-04, +4.4856291848194543e-05, -1.8271065907976623e-04,
-    -1.6050487627923982e-04, +9.5423591778877947e-05, -3.7339346381083758e-04, -1.5815596328154309e-04,
-    +1.2035013437956195e-04, -6.7437785065922609e-04, -2.6141793508586357e-04, +1.4072124884082626e-04,
-    -7.3403979387657887e-04, +7.0260074020173354e-05, +1.1238657674454867e-03, +6.4438672373982766e-04,
-    +4.5016769574759600e-04, -1.7528755222233179e-04, -3.8244215267056584e-04, +7.5182577634805227e-04,
-    -3.0882243988967931e-04, +7.6120936332172322e-06, -1.0087528845282314e-03, -4.8167124842688712e-05,
-    -7.9509315648363754e-04, -6.6100986449828313e-04, +9.3141203762673165e-06, -9.1399703297076961e-04,
-    +3.2139294745455713e-04, +4.0326735482982401e-04, +2.6113569629421840e-05, -2.3391873150181990e-04,
-    +3.3886080789822441e-04, +4.6063645364204222e-04, -1.5434713140332287e-04, +6.3683457192745979e-04,
-    +1.1292310332262632e-03, +1.4518107800336075e-04, +2.5906329130093956e-04, +7.1501429821685836e-04,
-    -2.5517983424694363e-04, -4.0533567522722021e-04, -1.8447381338116491e-03, -1.4384692068118452e-03,
-    -3.5284776882312142e-04, -2.8503619365174673e-03, -1.8131062421751273e-03, +3.0977574765822990e-04,
-    -1.9903189903426960e-04, -8.4394141426219244e-04, +4.2009718861720489e-04, +3.6363157157490254e-04,
-    -2.0256749932668570e-04, +1.1759428417108788e-04, -1.9446342624902395e-04, -3.7939445631100972e-04,
-    +1.5242365683971803e-04, -3.0953335208540930e-04, -2.8688181594646280e-04, +3.5276467403971807e-04,
-    -2.8543050314448499e-04, +3.8808831284200076e-04, +7.7642160754471496e-04, +2.2640420848055149e-04,
-    +9.3022509748513294e-04, -1.5794695721919498e-04, +4.1373623019658160e-05, +1.3710865028173261e-03,
-    +6.9005340135650203e-05, -4.3200034586386477e-04, +9.9420125916925128e-04, +1.4381021810049580e-04,
-    -2.3385596210962895e-03, -9.1362444204167706e-04, +8.3147201428156566e-05, -1.1720854643808435e-03,
-    +4.7336997888385959e-05, +2.0507166506615753e-04, -9.7450229100912338e-05, +2.9852676165056328e-04,
-    +1.0046351280762055e-04, +2.2659353565062114e-04, +7.5835890448592934e-05, -7.2181851545137796e-06,
-    +7.0026240559745135e-04, -1.9682451515125234e-04, -2.3904727271162628e-05, +4.2122120236531396e-04,
-    -6.5664337692597984e-04, -3.1840736066885154e-04, -8.7018317738250806e-04, -1.2770564095170634e-03,
-    -2.2571254433219001e-04, -1.6402883007216543e-03, -1.2731042322826798e-03, -1.4593597658634635e-04,
-    -1.0148394074816962e-03, -7.9112407675438706e-04, +9.6676502053873146e-05, -1.0175545617687830e-04,
-    -1.8893053332998838e-04, +9.9533541291326740e-05, -9.9408205119196389e-05, -1.9731611339811542e-04,
-    +2.1053636233326879e-04, -4.9037954172641159e-05, +5.7259874275465420e-05, +3.0934304931248656e-04,
-    -2.1763222662315860e-04, +2.3352694074597191e-04, +3.7481385829037610e-04, -7.9841633573284998e-04,
-    +1.1021886336898338e-04, -3.3435655631805484e-04, -9.8055471913346634e-04, +1.6992982448827566e-03,
-    +2.2552007583482553e-04, -6.8179064628432937e-04, +2.9063900497950678e-03, +5.3473184266580604e-04,
-    -2.4050730827447882e-03, -2.7638487043027713e-04, -2.9712255358898024e-05, -2.1803856053006078e-03,
-    -1.9555545082187723e-04, -1.7940710969844222e-04, -1.4043840029107765e-03, -5.1594613281946210e-05,
-    -1.8710039744727951e-04, -7.3995645290157112e-04, -1.2316812629613365e-04, +1.4203770957220508e-04,
-    +2.6243181588070000e-04, +2.6730002324555581e-04, +4.8745006461905984e-05, +1.8890280953656993e-04,
-    -3.6378557211270317e-04, +8.4940164690791329e-05, +2.3910899127770288e-04, -3.4907412443459663e-04,
-    +7.2856027201736355e-05, +5.8771131406631755e-05, -2.4625108819976895e-04, +2.0911390075526760e-05,
-    -1.1062674506801988e-04, -1.4678940181693897e-04, +6.6032672991480016e-05, -4.3916325565642653e-05,
-    -1.8645416660523613e-04, +6.2553626511749796e-05, -2.6032768469097766e-04, -2.2257872453218522e-04,
-    +3.1771553101903014e-05, -5.1396722021546657e-04, -9.5094930570144265e-05, +8.7221684278823204e-05,
-    -6.8022516251399305e-04, -2.1665733710256338e-04, -5.9148121082900688e-05, -9.8068841002099325e-04,
-    -7.8158204619063548e-04, -3.2354529675678099e-04, -5.3951189083551213e-04, +7.2745379413166383e-04,
-    +2.3212517577125250e-04, +1.5306060403644884e-04, -8.0722962442766075e-04, +5.6726978343234593e-04,
-    -2.9155534280931347e-04, +6.1832467118981169e-04, +2.7033692581457169e-04, -1.3690267851043773e-03,
-    +5.0413469344780086e-04, -1.2464122901157334e-04, -1.3789837946872475e-03, +1.1056459985632003e-04,
-    -2.0980352881080845e-05, -1.1890780382428844e-03, +3.1643366284660261e-04, +8.7004217102958897e-05,
-    -4.7936361492269974e-04, +4.4430313829721760e-04, +2.0683020027707931e-04, +5.7338749389418106e-05,
-    +3.4065202033424567e-04, +2.1774737432090434e-04, +4.1802416257350996e-04, +3.2962819616958437e-04,
-    +2.5112871495576526e-04, +4.4440603256250873e-04, +2.3637421080349439e-04, +1.2789728725013175e-04,
-    +8.7113484649993929e-05, +1.3749043966405891e-05, +3.6679511050153678e-05, -2.8285341951526396e-04,
-    -1.0642110191289216e-04, -3.8049018844693846e-05, -6.1322953605012179e-04, -2.9220821461686071e-04,
-    -1.3527548432987408e-04, -9.6606902239981200e-04, -4.3600637968458619e-04, -1.7300135386736143e-04,
-    -7.4590493272490180e-04, -9.0461694101556345e-04, -1.7474549992852580e-05, -1.8378377722179162e-04,
-    -3.9066433834786192e-04, +1.0780380022774388e-04, +4.3747921489555681e-04, +1.8843832460122168e-03,
-    +1.0332867816668169e-04, -3.4552038927333420e-05, -2.4233796537321503e-03, -6.0100991788014546e-05,
-    -3.5555012275200804e-04, +7.2418801705456087e-05, +2.2125747319793246e-04, -2.9049405893827876e-05,
-    +1.3837820587699657e-03, +5.1493985693284680e-04, -6.8125620366423402e-07, +9.5914843912952956e-04,
-    +4.1390337222937192e-04, -5.5830302960995035e-04, +3.4330605613739235e-04, +6.7140251024385385e-05,
-    -7.9576509703387143e-04, +2.3311535406329021e-04, +1.2653279286072838e-04, -5.1171118849797697e-04,
-    +5.4539857538789044e-04, +2.8313071683149573e-04, -8.2375342647713435e-05, +1.0697714387211364e-03,
-    +3.6890546899666225e-04, +2.7389825465174458e-04, +1.5014224555089371e-03, +1.2199729546663422e-04,
-    -1.0973624769926789e-05, +7.8409085986318454e-04, -2.8042203309402021e-04, -6.8990873270228007e-04,
-    -6.1435901098660581e-04, -3.1900254674139953e-04, -9.5025973942251536e-04, -9.2198146280543329e-04,
-    -1.8410285841707785e-04, -2.8755059562170649e-04, -4.9351766596700177e-04, -3.4431907594227747e-04,
-    -8.0837322080990284e-04, -5.9870949376641827e-04, -9.7520825041401803e-05, -9.4209779583536931e-05,
-    -1.0214917549496462e-03, +7.8582802222635449e-05, +3.8460526463558579e-04, -1.8081157469199826e-03,
-    +2.1331580239059432e-04, +4.3244948456635943e-04, +9.6299299709054573e-04, +2.7425359231721737e-04,
-    +5.9183929577783499e-04, -4.0893062455620629e-04, +1.2950746630614325e-04, +2.1984037471331892e-04,
-    -2.2367063781532507e-03, +1.8768207074818639e-04, -8.4894004665972406e-05, -4.2099882653510860e-05,
-    +8.4396651456445217e-04, +7.9482350553318465e-05, +1.7686980878602043e-03, +4.3700445624254093e-04,
-    +1.8830113776865870e-05, +2.8219187506758534e-04, +1.3296520084638284e-04, -1.2804818073452169e-03,
-    -7.1147239489049812e-04, +4.0404661907838732e-04, -2.3693868763046322e-04, -6.0617988775388361e-05,
-    +4.0795962795637180e-04, +2.8050047545299586e-04, +1.9922596225221936e-03, -1.6907752046606102e-04,
-    -6.4827898355347368e-05, +1.0829772145824158e-03, -4.4411122342452792e-04, -7.7834266781850938e-05,
-    -2.0526513529221094e-04, +2.9973501475296591e-04, +1.0526096349963538e-03, -3.8427315523335961e-04,
-    +2.5404603151066746e-04, +8.0657748096438567e-04, -2.6710989712910063e-04, +2.1959417446416275e-04,
-    +7.2452708419455854e-04, +6.8996499755863568e-04, +2.1247021400075283e-04, +5.9243636357627575e-04,
-    -5.8692513538398416e-04, +8.0742554291821217e-05, +3.3404325394077321e-04, -1.6182411135262930e-03,
-};
-
-const double BLUE_MEAN[] = {
-    -1.8717330939828965e-06, +1.5722535599128827e-04, -8.1773846270643641e-05, -4.7568624571215262e-04,
-    +8.5857958805011381e-05, +3.5330241050668230e-04, -3.5456145773915478e-04, -6.5609552262935566e-05,
-    +6.6165714758244901e-05, +8.3417849962078684e-06, +2.2508956934663289e-04, +1.6605539296631199e-04,
-    -2.7871807114260451e-06, -7.2300984876991887e-05, +2.8215236905714718e-05, -2.5577748586266320e-04,
-    +1.8049442636546187e-05, +1.5663198481826211e-04, -4.5646993573200537e-04, -2.6808694032700442e-05,
-    -5.8168202404912583e-05, -1.2386151603019631e-04, +5.5628764851803048e-07, +3.8197202353966232e-05,
-    -1.1987138528325875e-04, -1.0826430092986347e-04, +1.5089545462689661e-04, -1.6192009856784690e-05,
-    +4.0971489580900198e-05, +3.5945339362983801e-04, +3.2389857047078079e-06, +7.1718839125035089e-05,
-    -9.9586683055531526e-04, +3.2247227254318064e-05, +3.9618115675980031e-05, +6.7019091717329779e-04,
-    -2.2490925065447092e-05, -2.2574286584350615e-05, +4.2054845462874196e-04, -8.6284576522130650e-06,
-    +4.2607302109569929e-06, +5.6468769304986774e-04, +1.4020819859351170e-06, +2.8245811103835428e-06,
-    -4.1528805556384659e-05, -3.5646650742884356e-06, +8.2029453272282538e-06, -1.0125449842251764e-04,
-    +6.2194080312435111e-06, +1.5027699698901738e-04, +9.8693130999097188e-05, +1.6212790275252652e-04,
-    +1.5414202895380291e-04, +3.7993848091764291e-04, +8.9288259968250787e-05, +8.6035623629432571e-05,
-    +2.8448925045401464e-04, +5.0348323735080443e-05, +5.6366654926354199e-06, -2.1100044775343759e-06,
-    -1.1364997256769369e-04, -1.1603600729877993e-04, -2.6425170698686426e-05, -1.6013287976779955e-04,
-    -1.3366563250748496e-04, -1.2204965320135932e-04, -1.7632240109299806e-04, -1.4170404455512560e-04,
-    -8.0091740292967324e-05, -2.1611183408109871e-04, -1.6121800481255650e-04, +8.1768183908773295e-05,
-    -1.9159105070372550e-04, -2.0323556348699151e-04, +1.2831167805498245e-04, -1.6236647544381084e-04,
-    -1.4999975459085150e-04, +2.4872372804686825e-04, -1.1794623113589348e-04, -1.9388178762718669e-05,
-    -5.3651912383328331e-04, +1.3191329310482548e-04, +1.1323990205184596e-04, +4.8637301211633426e-04,
-    +1.2364932197436795e-05, +9.3348016324780823e-06, +2.4919257504804517e-04, +5.4114398996761646e-05,
-    +4.9597624953783683e-05, +3.8427363691076347e-04, +4.5384830178036298e-05, +5.3780669682580376e-05,
-    -2.5867829061399525e-04, +9.6214790088947240e-05, +6.8426518167719424e-05, -2.0202259709029241e-04,
-    -2.0300854095890171e-06, -4.6307315849143446e-05, +3.1551865939896993e-04, +6.6982369718829909e-05,
-    +2.6324240168571090e-05, -4.9256720346545213e-04, +8.3586539276282181e-05, +2.4715125957495373e-05,
-    +3.3863369733087010e-04, -2.3151527412458946e-04, -2.4530370501572277e-04, +9.0930155808150565e-04,
-    -4.0749480823346816e-04, -1.4516089289444699e-04, +5.0962937118505019e-04, -2.3088329470412515e-04,
-    -1.4095674184636564e-04, +1.1093765920024810e-04, -2.0459418502954347e-04, -1.1650242856386622e-04,
-    +7.3577485357456486e-05, -2.9862013774352550e-04, -4.4334341513477931e-05, +1.2302370945371582e-04,
-    -2.8290892376894492e-04, +1.9036715643658701e-05, +1.8683919403713109e-04, -1.3740815215424680e-04,
-    +2.6746558511310965e-05, +3.1737488449120243e-04, -2.0606077390437335e-04, -3.9553412084618740e-05,
-    +3.8858118768096797e-04, -2.3947719700251238e-04, -2.5407205925221424e-04, +1.1981869340177696e-03,
-    -1.1853042066993418e-04, -2.1957776224558546e-04, +1.0129208660348697e-03, +8.1890680785264754e-05,
-    -6.6184591759136730e-05, -4.3402663658814673e-04, +1.4447920907211383e-04, +5.4946746943250922e-05,
-    -5.7863485329494107e-04, +2.0813439355546587e-04, +1.8820136623619649e-04, +1.4009165142845587e-04,
-    +1.3543467033396144e-04, +1.4382586306135915e-04, +8.3802908462262131e-04, +1.5735892761895381e-04,
-    +5.5798142159841045e-05, +3.7757395633118273e-04, -2.7626148955964649e-04, -4.0643460088633343e-04,
-    +2.0772855974498100e-03, -7.1531168605993916e-04, -2.3954180123470192e-04, +6.4587227003608206e-04,
-    -3.4218417709783828e-04, -1.4299185165201277e-04, +9.6543070956149173e-05, -2.0296281272514960e-04,
-    -6.1790219683802375e-05, +1.3467890889467675e-05, -1.2216762671617625e-04, -3.0339721156412255e-05,
-    -4.8188971795663865e-07, -8.3009279435921563e-05, +3.3495279631367388e-05, +8.3058608636326291e-05,
-    -1.2019670554668454e-04, +4.8739687487628141e-05, +1.2540076372861199e-04, -2.5712820229090042e-04,
-    -7.2547750917935209e-05, +1.2662919304399212e-04, -4.3190192384145109e-04, -6.1583256936084980e-05,
-    +1.3820721964998692e-04, -4.6656166393710266e-04, -2.5112803740037038e-04, +5.0206785601098055e-04,
-    -6.0198396788524932e-04, -3.6012332792689295e-04, +2.0946562709304459e-03, -2.8335006384341079e-04,
-    -4.5174589460530258e-04, +1.1901701276127763e-04, +9.0723543998609700e-05, -1.0421332210941558e-04,
-    -3.9525114352164184e-04, +2.3743763077296591e-04, +2.4892176007015280e-04, -2.7579083924801336e-04,
-    -3.3051279291990122e-05, -1.6461031214080302e-04, +4.9232212284337491e-04, -1.7850307187408692e-04,
-    -3.5976043723245270e-04, +3.3691721501813096e-04, -5.9650112323942012e-04, -2.7812762285467601e-04,
-    +8.3691271204359269e-04, -3.7393920055441845e-04, +1.9177941742749721e-05, +1.8587104629160341e-04,
-    -1.4326269309409583e-04, +4.4969739663506116e-06, +7.4263030929595260e-05, -3.8563144838080626e-05,
-    +3.6343440362170368e-05, +6.2973348297828494e-05, -6.1135405353293063e-05, +1.3223183052406456e-05,
-    +7.0617788814957884e-05, -1.1438910074334249e-04, -4.6134766891715246e-06, +1.2575921834330698e-04,
-    -1.9610767109829778e-04, -1.6096423301062201e-05, +1.5453337041407544e-04, -2.6928297146450501e-04,
-    -3.0814877724011109e-04, +1.8688848426111861e-04, -3.6083154111933493e-04, -1.2434231240279379e-04,
-    +2.1953420580546326e-04, -5.0545788860093920e-04, -9.3624911671072155e-05, +3.6329395011238562e-04,
-    -5.8121803537981485e-04, +4.0029245491651434e-05, +6.9386341226592785e-04, -7.8532175860497318e-04,
-    -6.9645094498319579e-04, +5.8467340883281262e-04, +1.4224956248082924e-05, -2.3421237426520918e-04,
-    -5.2790519718510208e-04, +2.2106983003818847e-04, +2.0959890053747767e-04, -3.3539112668841083e-04,
-    -3.7069325757102707e-04, -3.2250109521789769e-04, +8.7960730848286764e-04, -7.8310787931122193e-04,
-    -3.4117149108007589e-04, +2.8826330406983130e-04, -4.4299963433853891e-04, -2.4380211842272958e-05,
-    +2.3143885082006291e-04, -2.3458028874513037e-04, +1.7328205131197538e-05, +1.1716813601480885e-04,
-    -1.8139242837943802e-04, -7.2928948079426710e-06, +6.4695809713778032e-05, -1.2244950161435463e-04,
-    -1.3648620329200092e-05, +2.6248371971269650e-05, -1.6636812102140380e-04, -5.2710007479709013e-05,
-    +6.7143345258080295e-05, -1.5811859307342672e-04, +1.5284050105521679e-06, +2.0853102623880418e-04,
-    -2.1397101357825430e-04, -1.8764145660576339e-05, +2.0808350540186505e-04, -3.0364979600730734e-04,
-    -9.8161304637551077e-05, +1.2259002180485065e-04, -2.5642744398980428e-04, -1.2243318747213729e-04,
-    +7.9144944654746123e-05, -3.7863180249756291e-04, -2.6473311570016165e-04, +7.9829595727649052e-05,
-    -5.5268398939767001e-04, -8.9945630356464692e-05, +3.1379086479539446e-04, -8.5494697872105026e-04,
-    +7.0128599253101788e-05, +8.6908738670729915e-04, -4.9368174927810304e-04, -6.3118718469988978e-04,
-    +4.5119111660634745e-04, -4.2352099064782755e-05, +2.2637319608552944e-04, -2.3165898758740767e-04,
-    -2.5539953865372082e-04, -1.4571172030223875e-04, +8.8589591639501579e-05, -4.2767762861718137e-04,
-    +1.1491346900942693e-05, +1.8207259427404127e-04, -2.2773326799121671e-04, +1.1964063275112468e-04,
-    +1.9163439173866572e-04, -2.5725526637432214e-04, -3.7685368131294812e-05, +5.1861870624244434e-05,
-    -1.4156442295625992e-04, +3.3777860604880632e-05, +1.1415227288953363e-04, -6.9172363796181759e-05,
-    +4.2796074708739197e-05, +8.6092558213934279e-05, -1.4573749497801363e-04, -2.4217141613713810e-05,
-    +1.2468940730585388e-04, -1.8381673781696882e-04, -2.7533489849575611e-05, +9.1071226587296272e-05,
-    -2.4078916685321862e-04, -5.0774762154465216e-05, +1.2212315209670553e-04, -2.1540141441584069e-04,
-    -5.0015048383101821e-06, +1.9094758578071841e-04, -7.4650729558485861e-05, +3.9341009586453757e-05,
-    +2.1905505691583894e-04, -1.4936652514217116e-04, +1.5246589521583775e-04, +3.2062882366972302e-04,
-    -2.7973782312117328e-04, -1.8152849048896124e-04, +8.3133143048904446e-05, -4.9862122940430239e-04,
-    +3.7287950961847425e-03, +3.3787682000194924e-04, -7.4858179543166336e-04, -7.1099933093935711e-04,
-    +3.1260180187873694e-04, -8.2788122267519210e-05, +1.5898202219166976e-04, +2.3612975760865221e-04,
-    -5.9783782337237012e-05, +8.4893769231179380e-05, +5.0291902505249465e-05, -2.5214449340013281e-04,
-    +4.6647274077854456e-06, +1.9576439361258525e-04, -3.2107665464118306e-04, +8.5157272732242970e-05,
-    +1.9913368872272804e-04, -3.3050364695110592e-04, -1.1814337006202380e-04, +1.3494549402671960e-05,
-    -1.9874296238692578e-04, -7.1561910240828622e-05, +2.6088761110343209e-05, -1.5964374840517922e-04,
-    -7.0166597937487411e-05, +1.3828615165535418e-06, -1.1016051612868106e-04, -2.5273670040837338e-05,
-    +9.3882188293209577e-05, -2.2105432943099652e-04, -4.4547077731513214e-05, +1.0667347368366926e-04,
-    -2.8965781829573084e-04, -2.3863755969720364e-05, +1.6730295679770295e-04, -1.0200260942240917e-04,
-    +4.2698507405362230e-05, +1.7014876279499301e-04, -1.0395333740256087e-04, -1.5491343277734444e-06,
-    +1.1576499868392242e-04, -1.1685061929261587e-04, +6.3462916819506703e-05, +1.4827004218501014e-04,
-    -3.0070126575243292e-04, -1.2282946113526083e-04, +2.1748939869339151e-05, -5.1010393139422924e-04,
-    +1.7316138503965393e-04, +2.4349066474963537e-04, -3.6519861151603801e-04, -1.0891366425452194e-04,
-    +3.1647674038064779e-04, -5.9713891510066774e-05, +2.3157435475297996e-04, +2.1226924086542603e-04,
-    -9.4866264010905270e-05, -8.6320457221669542e-05, +1.3141951206791546e-04, -4.5903455571150783e-04,
-    -1.3697173658728761e-04, +2.4067734457369460e-04, -3.4842792650494005e-04, -3.9341763415482904e-04,
-    -2.6366953055902018e-04, -2.1775636795156339e-04, -4.4460618997582918e-05, +1.4533598854755584e-04,
-    -1.7126639021909377e-04, -1.5055071120330616e-06, +1.0644846603909605e-04, -1.0303872356504027e-04,
-    +3.1781307741925157e-05, +1.1018370847659132e-04, -2.0021021905033867e-04, +7.3170257666693841e-05,
-    +1.6214466776772672e-04, -1.9638167342795609e-04, +1.3428522708862380e-04, +2.4884613027624806e-04,
-    -2.4457006796178648e-04, +1.8266170176072714e-04, +3.9573800300123693e-04, -2.4552398591531579e-04,
-    +8.8309853791894902e-05, +2.0272749932261796e-04, -7.7139524058342248e-05, +1.1003609237563672e-04,
-    +2.3064508484476413e-04, -1.9784474039379147e-04, +1.5078533919536550e-05, +1.7174600987613378e-04,
-    -3.3655005229083282e-04, -1.1102479745286687e-04, +1.0949795424791346e-04, -4.6139042748974618e-04,
-    -1.5854098473314765e-04, +1.9295968639475135e-04, -7.3659225028913230e-04, -1.8141627860875353e-04,
-    +2.0746321993558937e-04, -1.8306046968151211e-04, +9.8186519733443496e-05, -7.5510252834851082e-06,
-    -9.0444684982213871e-05, -1.0913810991484434e-04, +1.4881603308690558e-04, -2.8861423721833278e-04,
-    -9.2721139360267611e-05, +2.7007870001482398e-04, -3.7645924850865663e-04, -1.0396436757985471e-04,
-    +2.9742760469835016e-04, -1.8111410048834387e-04, +1.3760035891593076e-04, +2.7352686582189092e-04,
-    -1.0743286253773050e-04, +4.4649323576973171e-05, +1.3381060022051521e-04, -7.6000776524474785e-05,
-    +3.9909988698229217e-05, +1.3491128364875922e-04, -1.5566956001466300e-04, +2.9636442937359495e-05,
-    +1.6338310844951295e-04, -2.6425301616373820e-04, +2.4906852185073197e-04, +5.7405156822667623e-04,
-    -5.2501812341015648e-04, +3.9780547259010625e-05, +4.1049569211265249e-04, -4.8201728616290913e-04,
-    -1.7418130305144337e-04, -1.3008918759446379e-05, -2.9495195153471696e-04, -1.4291901605704613e-04,
-    -1.0283443825187562e-06, -3.0324248246252632e-04, -8.3537406714772724e-05, +3.2651035365250580e-05,
-    -4.6038555214560447e-04, -2.1289466583014465e-05, +1.4934824113151102e-04, -4.6341110756917329e-04,
-    -1.8617866839076069e-04, +1.3902613563045936e-04, -4.9169408821802369e-04, -2.5978199070565862e-04,
-    +8.6296808065246310e-05, -7.8317549517273335e-05, +5.5915525658440484e-05, -3.5225049558371671e-05,
-    -6.0534075589983912e-05, -1.1179749749189325e-04, +1.8358943878457904e-04, -2.8552204198026933e-04,
-    +1.2435727302958000e-04, +2.9132783383442433e-04, -3.3178973483809926e-04, -7.2334143698695184e-05,
-    +2.4714701293551726e-04, -3.3611305985957051e-04, +1.6971186163984155e-04, +2.3010381748307367e-04,
-    -3.0547014961959223e-04, +2.3984170042426898e-06, +1.0366669168525973e-04, -3.0108107612293518e-04,
-    -1.2184086474288887e-04, +5.7552647692935445e-05, -3.3472869577544091e-04, -1.2158271138274326e-04,
-    +7.1111423393416414e-05, -5.2802301014476867e-04, -8.1747957615512916e-05, +3.2442924285056111e-04,
-    -6.2581971570959468e-04, +1.8704449306847787e-04, +4.3830636618833558e-04, -4.7784948143634340e-04,
-    -1.9892284163197963e-04, +3.6794182843796427e-04, -4.0703320026236654e-04, -1.1330748616837577e-04,
-    +8.6802783008850900e-05, -4.0021273690400044e-04, -8.3579843778931268e-05, +5.5203538185728974e-05,
-    -3.9244534451910509e-04, -8.9830894770880854e-05, +4.2109733166221730e-05, -4.1892969569383670e-04,
-    -2.1133356700947552e-04, +2.9945042221983958e-05, -2.6051013714044026e-04, -1.7766104733190502e-04,
-    -5.2612869331045861e-05, -1.3211732020735384e-05, -5.0510269024750369e-04, -3.5560569272479094e-04,
-    +3.0011708469548931e-05, -3.2783527535133626e-05, +9.8040704900423449e-05, -5.5165134066917071e-05,
-    -7.2666775948795477e-05, +3.8593549033313755e-04, -3.9214056289932461e-04, -1.8851227844432839e-04,
-    +1.8867446380370462e-04, -3.4662358202549188e-04, +9.0183918635870349e-05, +2.6448566280191325e-04,
-    -2.5523650109314288e-04, +1.2581169583096954e-04, +2.2292501519509159e-04, -2.1397367596183426e-04,
-    +1.0745649277896688e-04, +1.6475577720307064e-04, -2.7168921155214758e-04, +7.4889740324230245e-05,
-    +2.0009391156358670e-04, -4.3729587379954404e-04, -4.7453085272954558e-05, +2.1223829014317656e-04,
-    -4.7538906346520808e-04, -9.4983725359137103e-05, +3.4644645970166544e-04, -3.3025129587740297e-04,
-    -3.0200545458986510e-05, +1.6344200123333361e-04, -2.2425768141750554e-04, +2.2154498978813189e-05,
-    +9.1634639775543833e-05, -1.8907610752192587e-04, +2.5525042618926235e-05, +9.8516300153088070e-05,
-    -2.6745192653576319e-04, -9.2141702489586966e-05, +5.6113002945330248e-05, -2.5727293868532919e-04,
-    -1.3727795317060459e-04, +4.2156392868142662e-05, -8.6211112020060117e-05, -6.2240258006167145e-05,
-    +2.9443961089495698e-04, +9.4662835344664815e-05, +1.0840915936831269e-04, +7.0536630481579302e-05,
-    -8.3460737979276772e-05, -1.9693148668221965e-05, -3.0435572788643214e-04, +2.9192303610028344e-05,
-    +7.1603053431315333e-05, +3.0169699735123481e-04, -1.6237251799123035e-04, -1.6291824396912443e-04,
-    +2.3774334360701483e-04, -3.1169012906702469e-04, -2.6272967747987999e-04, +3.7351952041225647e-04,
-    -2.5998672104971931e-04, +2.8246025073325279e-04, +3.6722248150003283e-04, -2.3936125696975545e-04,
-    +2.2242612046260133e-04, +2.5346316532078868e-04, -2.7204474893838455e-04, +3.9969353867709415e-04,
-    +3.1841377374487473e-04, -3.4578369110935129e-04, +3.3534243137631964e-05, +2.0354656366732617e-04,
-    -3.1793377685646100e-04, -2.4841834836683590e-05, +1.5876378934783896e-04, -2.1342664512902880e-04,
-    +5.4935885814248011e-05, +1.2461974199338852e-04, -1.1243331126595683e-04, +7.7666494188698018e-05,
-    +1.2359658588872866e-04, -1.2026260764045955e-04, +7.9866342499340423e-05, +1.4823951758407273e-04,
-    -2.2601858551436960e-04, -5.7571498827636019e-05, +1.3030729877577701e-04, -1.7703318449139265e-04,
-    -9.4284792483459884e-05, +1.5649825140102676e-04, -1.0450273721498362e-05, -6.6302207406895996e-05,
-    +1.3084570124393262e-04, +7.9131767701213471e-05, +7.0579477965733754e-05, +7.0960026695670014e-04,
-    -5.5647834854352497e-05, -7.8799391743270027e-05, +5.5594962854094881e-04, +2.5831351085073256e-05,
-    +4.5985245494550712e-04, +1.1222755071003276e-04, -7.0021975295139787e-05, +8.8922674569836357e-06,
-    -4.4491237441350154e-06, -1.6850427082000535e-04, -3.5171584124689799e-04, +8.3765761968408327e-05,
-    -2.0720565489757101e-04, -6.7711054258023411e-05, +2.9635661520255308e-04, -1.9739773704148316e-04,
-    +1.5025517509928630e-04, +2.5285726850419880e-04, -2.4190197535012335e-04, +1.7579264153910998e-04,
-    +2.2466340646490183e-04, -2.8487416728372453e-04, +7.0808934561977452e-05, +1.8089780987283133e-04,
-    -2.2744907795728105e-04, +4.7775422195866696e-05, +1.6717759606351581e-04, -1.4957493087479874e-04,
-    +5.4993452831311091e-05, +1.4589817025030403e-04, -9.8298594832346939e-05, +8.6737059869586441e-05,
-    +1.6318817329787774e-04, -1.2439820743254216e-04, +7.6596808929935918e-05, +1.8332121617938845e-04,
-    -2.6197392712850947e-04, +7.7230174384915380e-05, +2.9701034072560474e-04, -1.7544609435698246e-04,
-    -2.7329829676572706e-04, +2.8226321503256732e-04, -3.9554055240203234e-05, -2.6574294883738155e-05,
-    +6.5801044425988213e-04, +3.5087847388291885e-05, +1.3933133188087919e-04, +1.1117305321572814e-04,
-    -7.6900723032528474e-05, -1.6377846764526380e-04, -6.4723357588910187e-06, +1.6288859855390097e-05,
-    -6.1240652644754868e-06, -6.6618170348342181e-05, +1.5316944578147454e-05, +6.7089858787486905e-05,
-    +4.7381642044725171e-05, -1.2042402299720294e-04, -2.0643839125953779e-05, -4.6301092215421737e-05,
-    -2.4034203281148817e-04, -1.8122560875724801e-04, -1.7300756864739942e-05, -4.5452060141588387e-04,
-    -2.2507789151412745e-04, +3.7941679278253446e-05, -3.6580203250300081e-04, -1.6076983754302379e-04,
-    +1.1065800817238749e-04, -3.6773854282365771e-04, -2.1505092786079029e-04, +1.6600865338312399e-04,
-    -3.3197429777759367e-04, -9.2926545908837013e-05, +2.0123353208095700e-04, -3.5920082210163281e-04,
-    -5.3870035764498856e-05, +1.6078311701081034e-04, -4.0842675829122444e-04, +1.3950302328338164e-05,
-    +1.7609801848828067e-04, -4.7434108968284153e-04, -4.8718592515250999e-06, +2.5957954126829528e-04,
-    -3.6275688338177685e-04, -2.1746807766036407e-04, +1.0151702857735947e-04, -2.8555139933388339e-04,
-    -2.5503135237282950e-04, +5.2436654809555989e-04, -1.0519160761067960e-04, -1.6782185658449159e-04,
-    +8.2326494820342483e-04, +1.1790384070669878e-06, +1.1027645520222737e-04, +4.8214641366246423e-04,
-    +3.0657806014900028e-06, +4.2391564385546322e-05, +5.4652916496762878e-04, +1.4349620475954678e-04,
-    +1.6058870563403111e-04, +5.0809453669800505e-05, +8.8196703688523379e-05, +1.9395163851347897e-04,
-    +9.5607286745706807e-04, +5.6970797373665188e-05, +1.8205515018436695e-04, +4.6382065944156200e-04,
-    -1.3298077279916422e-04, +1.0320067105293638e-04, -8.1025995315349051e-05, -2.7056484982301274e-04,
-    -1.7755163364520474e-04, -2.6449291510860586e-05, -3.3624850449547554e-04, +5.7681148758264515e-04,
-    +3.1517794636861984e-04, -4.8158599428637955e-04, +2.3190976654381514e-05, +3.0670802296627129e-04,
-    -4.4532531652720977e-04, -2.5993716817069082e-04, +1.4431654933857958e-04, -4.2804378494881999e-04,
-    -2.2662986690714819e-06, +2.4864988002630436e-04, -3.0895367044624637e-04, +1.1483167239345053e-04,
-    +3.5934536784267793e-04, -3.2683539498636370e-04, -2.2139818217177602e-04, +1.0329990716765431e-03,
-    -2.6251162034374224e-04, -3.0725768222153037e-04, +3.0102810113220608e-04, -1.1171488609962244e-04,
-    -1.8583961307179768e-04, +6.7765049017961610e-04, -4.6697149564000138e-05, -6.6507231183546406e-05,
-    +2.0931099769365348e-04, -4.0655052797021120e-06, +9.9677011457717480e-05, -8.2586830630521055e-05,
-};
-
-const double YELLOW_MEAN[] = {
-    -2.7172420100723342e-04, +2.2170275465037645e-04, -2.4347080359370340e-03, -3.9651809482767539e-04,
-    +9.5729463801605397e-04, +9.7824843059257172e-04, -3.3594036688783713e-04, +7.3476912597273758e-04,
-    -1.0320017721749993e-03, -8.8170114827195296e-05, +1.2283354811794653e-03, -9.6692562038788179e-04,
-    -2.3729301005713982e-04, -3.2149797839071850e-04, -8.7678227706595730e-04, +4.7585362658285204e-05,
-    +4.7288087238905639e-05, +6.0105323645689731e-05, +7.5958273097187287e-05, +1.9787417273554669e-04,
-    -5.8418237553296262e-04, +6.6439156557694559e-04, +9.0245176890048340e-04, -1.2952314907754418e-03,
-    +6.5262646117156817e-04, +7.1129358844406051e-04, -7.8976586817718747e-04, +7.9067297290411618e-04,
-    +8.4788021482480353e-04, +1.5811557284103655e-03, +6.6311294668688545e-04, +4.7949983514802857e-04,
-    -1.0159545925553600e-04, +9.8590444153424505e-05, -3.4611358880747673e-04, +3.1443537759932394e-04,
-    -2.3236174807857261e-04, -3.5904491260219053e-04, -3.5344016819258885e-03, -3.1877011974406770e-04,
-    -2.6016567280778092e-04, -1.0546130367346490e-03, -1.1826474375849090e-04, +1.8707753047762321e-04,
-    -3.8738289981722900e-04, -3.5446082123781247e-04, -1.6612895695562819e-04, -1.4025029639227655e-03,
-    +2.6649379455625301e-04, +1.2670816046146608e-03, -2.1488190970724485e-04, +2.2729909898618566e-04,
-    +7.8389743628979832e-04, +2.2635342226197236e-03, -3.5017256893429865e-04, -1.6298849731953671e-04,
-    -1.8136554599146879e-03, -6.2556990874962663e-04, -7.0346433798937813e-04, -1.5086755037978701e-03,
-    -6.1965350316882698e-04, -8.1418109814310148e-04, +4.1821084398172329e-04, -1.7360999935619708e-04,
-    -5.5029552878293282e-04, +5.0557483135971865e-04, +1.0784525581736421e-04, -3.4363363177609166e-04,
-    +9.5388388461141267e-05, +1.7517705420628553e-04, -4.6968368598781498e-04, +7.9308711338858763e-04,
-    -1.8047913544187065e-04, -8.1366722743758267e-04, +1.3859005481343940e-03, +1.0205846097044693e-04,
-    -2.2149109392445159e-04, +3.3599189686579749e-03, +3.3781655828458914e-04, +1.6129043011388054e-04,
-    +2.5738339195662684e-03, -3.6408032511307158e-04, -8.0323712242369926e-04, +2.0444423198322445e-03,
-    -6.2781604893884983e-04, -1.2751362219354135e-03, -2.6145497467651721e-03, -7.2550458072586656e-04,
-    -1.2431749679181836e-03, +1.4981818811943048e-04, -2.0445860689169139e-04, +1.4924414473706319e-04,
-    +5.9571704358514662e-04, -2.9796036904131899e-04, -9.3479604014207127e-06, -6.5386617143896276e-04,
-    -1.1840032840797889e-04, +5.4604905696679137e-04, -1.1094990198921044e-03, -4.1666085940354069e-04,
-    -3.4332345457097096e-04, -8.1173062515736759e-04, -2.9548434184344514e-04, -2.7025512828492213e-04,
-    +5.5429437229241173e-04, +1.0614389620213570e-04, +4.8351147977998272e-04, -1.1896352052267536e-03,
-    +3.4677309275255329e-05, -1.8095641834020416e-05, +5.2751526251700943e-04, -3.4334158077506974e-04,
-    -5.5651568426064884e-04, -8.3499027409731654e-04, +1.3938115721328807e-04, -2.8840451709432572e-04,
-    -1.5091279477996127e-03, +5.6324251474140264e-04, +7.9449515568419484e-06, -7.9518330427445153e-04,
-    +5.1839754137718481e-04, -2.5994006695752407e-05, -5.8084209081672527e-04, +3.1373283570709207e-04,
-    -3.3140850287004703e-04, -4.5212022777602501e-04, +1.2239888015630853e-04, -1.8216581752333779e-04,
-    -6.2309599982607612e-05, +2.2400934547382617e-04, -1.1015026835714017e-04, +3.4451907637631130e-03,
-    -2.1432487749703364e-04, -6.2510678599196482e-04, +1.2945820680822244e-03, -5.6571746978085547e-04,
-    -1.0510667638115052e-03, +8.3707798079540711e-04, -1.5893593164913709e-04, -7.1962626721670179e-05,
-    +5.9091848785748869e-03, -2.8174290439028301e-04, +1.4422429761394668e-04, -5.9372593330889038e-04,
-    -6.7246370978021333e-05, +1.7554330133709138e-04, -1.3991462588949903e-03, +8.6596447159338727e-05,
-    -1.0829737506314052e-04, +8.9521724680873341e-04, +6.8127626304167330e-06, -5.0490856615193771e-04,
-    +1.5191708405039857e-03, +2.6356953326124003e-04, +1.2642985937884072e-04, +7.9796293362209244e-04,
-    +3.4933572631340047e-04, +3.1965938215715881e-04, +1.3229314736975235e-04, -1.0467592922795130e-04,
-    +1.0501198465490616e-04, -8.0667648336209664e-04, +6.1207784022663966e-07, -4.0512597009607469e-05,
-    -7.4137379751360109e-04, +2.2738720175927271e-04, +1.2252597388004105e-04, -6.3037506962907081e-04,
-    +4.2141564273153658e-04, +3.7692593342967900e-04, -7.1157634531060358e-04, +6.1095536277316735e-04,
-    +5.2176718894077917e-04, -6.8185282982509752e-05, +5.9269519791439675e-04, +2.9844239257059577e-04,
-    +2.2924990783687089e-04, +3.7997129980558254e-04, -4.1951123970670616e-04, +1.2620579714608959e-03,
-    +1.4866560073305144e-04, -9.1506269448547099e-04, -9.1209275617380129e-04, -3.3241984529830252e-04,
-    -9.6928694195426305e-04, -1.1894815734738997e-03, -6.4329982377353036e-05, -3.7259856868526633e-04,
-    +1.9731653477835869e-03, -2.1155380699312956e-04, +1.7494400430545918e-04, -2.6123854095966418e-03,
-    -1.5471098510078422e-04, +4.3984714347160069e-05, +4.8300096570739380e-04, -5.7045551190290991e-04,
-    -1.0968868553110254e-03, -2.1326115520011305e-06, -5.0047797578000523e-04, -1.0171484868336429e-03,
-    -5.1472228308032666e-04, +1.8520752786217790e-05, +2.7066390144741503e-05, +2.8228291374067787e-04,
-    +2.0121369717577742e-04, +3.6377766397081786e-04, -1.7851533461300622e-04, +2.7201469916639828e-04,
-    +5.0916805372147632e-04, -2.7043629148376148e-04, +1.0308177505496225e-04, +1.9203101686386494e-04,
-    -1.4599968988264988e-04, -6.7947415191930470e-05, -2.2565624391175990e-04, -3.2138312691780733e-04,
-    +1.8686051713065230e-04, -4.0202847585251461e-05, -9.8709668043594231e-05, +7.4825437965280730e-04,
-    +2.9808647684734826e-04, +3.6572459694424138e-04, +1.0400507553636972e-03, +1.1788907504025883e-03,
-    +4.3180197897411954e-04, +6.3485407617530046e-04, +1.1480151966570197e-03, -6.9927679945567460e-04,
-    +3.0156390833535894e-04, -8.1697803058460158e-04, +4.1657753558797366e-04, +3.8374470846004556e-05,
-    -9.7448226453170528e-04, +1.5497844540368561e-03, -2.7789662173794124e-05, -4.5461169708301875e-04,
-    +7.0133975765032739e-04, -1.1638787379312570e-04, +3.4695742054117161e-04, -2.9218475457312590e-05,
-    +1.7969640948942704e-05, +6.5504770466910190e-04, +1.0165698038454254e-04, -9.8627792656576037e-06,
-    +4.6631779104965373e-04, +6.5935821801892140e-03, -7.1429009496853870e-04, -8.4497344528764525e-04,
-    -6.9791683324178062e-04, -1.5654403224077499e-04, -2.9850978672439589e-04, -5.3498753068266644e-04,
-    +1.9152645666165353e-04, +2.2563924956562042e-04, -7.0465751623065580e-04, +2.8468964269158970e-04,
-    +4.9694382237812547e-04, -7.8175033132719398e-04, +2.1009523231203426e-04, +1.9932130341760034e-04,
-    -7.6550288988468768e-04, +1.6944493540145211e-04, -2.9864518999563923e-04, -7.6779030115927251e-04,
-    +2.2501088078676849e-04, -5.0673147575030391e-04, -6.4396079790331228e-04, +6.6110709235217612e-04,
-    -1.8524422780104109e-05, -7.3511399778575194e-04, +1.0540923113046897e-03, +5.6926579119217959e-04,
-    -9.4560668596761549e-04, +9.0380457455165085e-04, +6.9329862299160033e-04, -1.6673427850551442e-03,
-    +4.2358690206774905e-04, -2.0387344431176284e-04, -3.1635632608279828e-03, -1.3851047485847597e-04,
-    -1.7391038862224176e-03, -6.2210691246027486e-04, -6.7822706925869082e-05, -3.9287460628890052e-04,
-    -2.2483129752178801e-03, -1.4393563759316816e-04, +2.6869852449174614e-04, +1.9118594063358449e-03,
-    -3.2773768102899582e-04, +2.2600117491791622e-05, +5.8505691654844720e-04, -2.1142288751496916e-04,
-    +4.8552400584977968e-04, +1.3634956295578370e-03, -4.5537989024599119e-04, -2.4659945082252456e-04,
-    -1.6635985348837194e-03, -4.6270924053422649e-04, -5.6457543145189862e-04, -1.4028923049051625e-03,
-    -8.9309317157348339e-05, +6.7155662372544688e-05, -6.1900859011669910e-04, +2.3152365394673059e-04,
-    +3.2513600536695499e-04, -1.2950809224477049e-04, +6.8874798731100397e-04, +2.7453648116872273e-04,
-    -2.8012261350377247e-04, +4.9046506429979166e-04, -2.4549544389353953e-04, -1.1291802509226906e-03,
-    +3.4965856491097014e-04, -4.3555744520750876e-04, -1.0546948056192260e-03, +3.1065625392933863e-04,
-    -3.0224334515210237e-04, -3.6649468826944912e-04, +3.6989171136630008e-04, -1.1032653917637435e-04,
-    -3.3607732828378481e-04, +5.5519644785673172e-04, -7.6111344614377186e-05, -2.6200264369830153e-04,
-    +2.1477819039817869e-04, -6.7922529711106024e-04, -1.8091497257051864e-03, -8.3881154513492501e-05,
-    -1.0394576108025868e-03, -2.7509300329037851e-03, +3.1137738146919483e-04, +7.7373421571015394e-04,
-    -1.8453304074923936e-03, -4.0222602151584726e-04, -2.3010217544325453e-04, -3.6065949399167667e-03,
-    -9.1248838562838289e-04, +3.3467253575613482e-04, -3.3945982539367362e-03, -1.7709732585237536e-04,
-    +9.7229008051420360e-04, +1.7284383485962976e-03, -8.5533031226911203e-05, +1.3643448538119761e-04,
-    +2.1776818788073066e-04, +5.6875349697501655e-05, +1.7738676319054990e-04, +2.9345789963269340e-05,
-    -2.0337090036094473e-04, +3.2909556600251552e-05, -3.1530210763745518e-05, -4.7851380772381236e-05,
-    +1.4908074226017841e-05, +9.5806992170108371e-05, +2.6691972510813652e-04, -4.7042483263675979e-05,
-    +1.9160634988974101e-05, +6.8803520176996937e-04, -1.6944028546225741e-04, -8.1358896314497183e-04,
-    +3.9324583040347490e-04, -3.2673124000292327e-04, -2.3613609610680585e-04, -1.0797840046251073e-05,
-    -4.0914845280205211e-04, +1.1493400109482621e-05, +7.9165248723427561e-05, +1.6353003397417853e-05,
-    +7.9843440344871518e-04, +4.2030504808394009e-04, +5.4238508301922186e-04, +1.5813525578962538e-03,
-    +5.0199030496060333e-04, +3.0184942608740058e-04, +1.2323111360301533e-03, -2.6286843000927247e-04,
-    -6.4495572651440995e-04, +4.6835930449900431e-05, -4.3657576679472534e-04, -7.7649882812220138e-04,
-    -7.8423524783740694e-04, -7.4057025905053338e-04, -9.9532796524606066e-04, -2.9793711540146411e-03,
-    -2.2797198888635384e-04, +9.0501164943539896e-04, -4.2761847282332781e-03, -7.6853186042162916e-04,
-    -2.4663010378961586e-04, +2.5262146459821191e-03, +8.1319401757945812e-05, -4.6600265848797853e-04,
-    -1.2568904672841208e-04, -3.3942556399575347e-05, -1.6508765715976664e-04, +3.4565513844087031e-04,
-    -9.2559523409083496e-05, -3.5131759985505069e-05, +4.5883079692339253e-04, -3.2184068761514743e-04,
-    -2.5782068483583612e-04, +5.3449001356046829e-05, -1.7543691267995888e-04, -3.7485872580419381e-04,
-    -2.4826649259991509e-04, +5.4153769302299839e-04, -7.3778662999213023e-04, +1.3369545111626676e-04,
-    +3.2962399401888193e-04, -5.8412752765100724e-04, +1.8041562241560716e-04, +1.6181551276166524e-04,
-    -9.2909500192497211e-06, +5.0610758557592965e-04, -1.0131894455708617e-04, +2.6454694755833874e-06,
-    +9.1041808296455165e-04, -1.3820940393878816e-04, -4.0667660782805780e-05, +1.5033578502745212e-03,
-    +2.7656556717210015e-05, -3.7894099373567640e-04, +1.2633828040852575e-03, -9.4308205956284205e-05,
-    -3.9331477493552755e-04, +1.5010714641781051e-04, -8.4460973686724947e-04, -2.9548388013522380e-03,
-    +9.2033084078817608e-04, +6.1551022704738815e-04, +1.8591968620142671e-03, +1.6920434352177768e-03,
-    +1.7784818144102167e-04, +9.7475881855308756e-04, -2.0991215444115213e-03, -7.5647132123812268e-04,
-    -9.4679080778491717e-04, -6.1514420335817037e-05, -2.3618499331513760e-04, -7.5999008488753948e-04,
-    -2.9144809834854175e-04, +2.3563257143372431e-04, +3.2004070612718001e-04, +1.1240443240315432e-03,
-    -1.0336581008330276e-04, +6.8170956634274434e-05, +6.4908610850438028e-04, -1.7067451833417837e-04,
-    +6.6535571477410803e-05, -1.3180598892448603e-04, -9.8978734904130470e-05, -3.8988729688957022e-04,
-    -2.9698722736990699e-04, +3.4718365998672606e-04, -9.8522608138553445e-04, -7.9131528075971106e-04,
-    +3.6476424303139894e-04, -4.5966649175443894e-04, -7.8945929745730104e-04, +2.1554996695460888e-04,
-    +4.0212335372647588e-05, -3.0354233110250936e-04, +2.4587895185876771e-05, +4.3056455599216109e-04,
-    +2.6775719152626564e-04, -2.6351593361282228e-04, -5.0420354851854831e-05, +8.1688318670758973e-04,
-    -1.9279976023283535e-04, +1.4887093527112471e-04, +6.6489042434011373e-04, -4.7431173635067465e-04,
-    -6.7307585969278905e-04, -5.1736827164473290e-04, -1.1865281597539467e-03, -2.5148445357729560e-03,
-    +1.6253294204138569e-03, +4.9927738669115426e-04, +7.0064713793989842e-04, +2.0091833034119014e-03,
-    +1.3314838206277758e-04, +1.1629800972713723e-03, -5.2367413844438089e-03, -5.1351933001166376e-04,
-    -6.8898855849906023e-04, -1.3948992092126273e-03, -8.2873039752396800e-05, -8.3630363146685108e-04,
-    -1.3736265536254822e-03, +5.5612946185217811e-05, +2.6867596733390136e-04, +4.2908471625017358e-04,
-    +1.3686557705967740e-04, +5.3850806037499042e-04, +1.4287888765625797e-04, +3.0463141021365599e-04,
-    +6.7314258875993040e-04, -2.1572815036407416e-04, +1.5208281046883682e-04, -8.0350477170430638e-05,
-    -1.0805269359968510e-03, +3.0318347989981520e-04, -1.2331936414860447e-03, -6.4768152770417712e-04,
-    +5.4943616228866541e-04, +7.8893918433983311e-04, -1.5696122742310829e-03, +2.5955494421223341e-04,
-    +1.0500164422206526e-03, -1.9745784118621488e-03, +3.5713251512345059e-04, +8.9511668518955066e-04,
-    -3.6313074616254080e-04, +6.3335010025585696e-06, +6.3864262832133206e-04, -1.2087101181422138e-04,
-    -3.7121636150252876e-05, +6.8935761629763330e-04, +1.8750238988911631e-04, -5.0879098828533937e-04,
-    -4.9966699990899865e-04, -1.5832496885970478e-03, -7.3148060677003868e-04, -1.3096582328303813e-03,
-    +9.7601600231490748e-05, +3.6053131047040040e-04, +1.1906980687668579e-04, +4.9937251853642020e-05,
-    +4.9225593481723039e-05, +7.2554192224997388e-04, +9.5994673268840868e-04, +5.0583020543571367e-05,
-    -2.9475512847815938e-04, +3.2561647730378144e-04, +1.6337966618348892e-04, -3.1272131247270674e-04,
-    -1.7984312322948158e-03, +4.4035886002193666e-04, +3.7467297339576248e-04, -4.2551553510302310e-04,
-    +3.5340847333508466e-04, +9.1465248713160994e-05, -8.0375705041473705e-04, +4.3439244321030447e-04,
-    +4.7169226727949835e-04, -1.1374826317953114e-03, +6.2553376941903505e-04, -2.1695758922381543e-04,
-    -2.1549385411481678e-03, +4.3317174834566825e-04, -9.3305373739758211e-04, -2.0903080602810947e-03,
-    +2.7220261675957991e-04, -7.7999340479561303e-04, -2.5735015874697982e-03, +2.5376001848947927e-04,
-    -6.5812430188583526e-05, -1.2544167905117955e-03, +8.0787719018176525e-05, +4.4483306775003995e-04,
-    -4.0264552042387444e-04, -1.3709450155011008e-04, +5.9952626883620078e-05, -2.6133015132213824e-04,
-    -1.0084552503501522e-04, +1.9441796105517474e-04, +6.6481729453845962e-05, -6.1428535652879987e-04,
-    -4.8729447024624520e-04, -7.6645085762730360e-04, -2.1662978605177329e-04, -3.7344625302354790e-04,
-    +1.6873449856477454e-03, +3.4716829121928482e-04, +8.0898652676324948e-04, +1.9126371950846316e-03,
-    -7.0393888632189466e-04, -6.3521454917045623e-04, +1.6899871022579955e-03, -7.4860039005029510e-05,
-    -8.7928671022422628e-04, +9.0710679349653917e-04, +3.9949752420621588e-04, -1.6295664496718882e-05,
-    -3.0841093180417772e-04, +6.3746683045647870e-04, +8.9623789761935355e-04, -5.3580271335750885e-04,
-    +6.2693312590629308e-04, +1.1423335780000599e-03, -6.0246658482185095e-04, +7.3964901866504498e-04,
-    +1.0364048138975627e-03, -1.5174532960159381e-03, +7.9028502824541930e-04, +9.7209192373848459e-04,
-    -1.7186777149994727e-03, +4.7643078160132594e-04, -2.2743687584904698e-04, -2.1661188443198678e-03,
-    +1.1776214930227627e-04, -6.5553553582613547e-04, -2.0605009430101203e-03, +1.3640945901491182e-04,
-    +2.4093832731704662e-04, -5.1883832641890968e-04, +1.2352455666438006e-04, +4.3659886031076968e-04,
-    +2.3029125435743649e-04, +2.4542036967174706e-05, +4.4805939871139929e-04, +4.4882110725655858e-04,
-    -3.8455401877526717e-05, +7.8723700368628190e-05, +8.4641453604123221e-04, -3.3085808695513342e-04,
-    -1.6417292937970801e-04, +7.2962455836819435e-04, -3.7452933931053628e-04, -1.1463214055826827e-03,
-    +4.0802252175454485e-03, -3.3038849712529826e-04, -3.2744840515030327e-04, +3.4618401338176062e-03,
-    -3.2344731263052730e-04, -6.5267683509130382e-05, +2.1326025425771372e-03, -5.8727549632498779e-04,
-    -1.4984705995839747e-03, +6.4144483926208773e-03, +1.2771416227049665e-04, -6.2588528862187007e-04,
-    +9.4321630483128248e-04, +2.9978953520381287e-04, -6.9210035857268687e-06, -4.9972528650246229e-04,
-    +4.3549451879691740e-04, +8.3700536756493545e-04, -8.7158831454821686e-04, +4.0237338230895465e-04,
-    +4.8922494446112597e-04, -1.7302967459807254e-03, +4.9741756297797728e-04, +4.2970733670862364e-04,
-    -2.1255394211942302e-03, +5.1111113241873729e-04, +4.9921357060794520e-04, -1.6950261874192686e-03,
-    +1.9348970644336087e-04, +2.0060638259253324e-04, -1.4002959151203740e-03, -2.4333706143728904e-05,
-    +1.0268584660404954e-04, -5.9191331424498887e-04, -9.1309040019138098e-05, +2.5696504103252786e-04,
-    +1.4626809192208823e-04, -5.9333790045481973e-05, +4.0045584105538763e-04, +9.4930827082270969e-04,
-    -2.1324114302868701e-04, +2.1724342632298412e-04, +1.1018197661815659e-03, -5.1997433512069094e-04,
-    -8.6005089619644887e-04, +1.5158999623730823e-03, -9.9417809569173348e-04, -2.7962968308989536e-03,
-    +5.5872784339558602e-03, -1.3159383115792194e-05, +2.5219767756112338e-04, -3.5370729742934797e-03,
-    -2.1671307562760259e-04, -2.0473751939067758e-04, +1.3820024520976722e-03, -2.7296750346002740e-04,
-    -1.1627752460659352e-03, -1.0153016914608036e-02, -1.1454611328902777e-03, -1.8702746173513008e-03,
-    -1.6615075724804604e-03, -8.1523914974856722e-04, -7.1490992413311954e-04, +2.1748540223423111e-03,
-    -1.1191381440951396e-04, -2.3864471376867981e-04, +2.9317195711678272e-03, -1.5562790541694417e-04,
-    -2.9481683534941816e-04, -5.7027577679497575e-04, -2.0374461917836438e-05, -2.2043280332357390e-05,
-    -2.0115615203801333e-03, +1.2654552085377663e-04, +4.1111429928426298e-04, -1.7334896196352619e-03,
-    -1.0416280057459970e-05, +4.8072944187865172e-04, -2.1814049559889430e-03, -3.1016830715876586e-04,
-    +4.0692889460094041e-05, -1.6924790975564948e-03, -6.5388688383968558e-04, -7.7134545088428100e-05,
-    +1.8860958273271344e-04, -8.5055267316553012e-04, -3.0566516401710859e-04, +8.7484110089295622e-04,
-    -1.2329160111735115e-03, -9.7854295309887868e-04, +1.7174865081126410e-03, -1.0655974026200245e-03,
-    -2.2007846387264644e-03, +3.7603980676959464e-03, -3.8962702016791890e-04, -1.4069465853580338e-03,
-    -5.2846435192076156e-03, +9.5325276049001664e-05, +4.6389348476340178e-04, +1.2873396662350335e-03,
-    -8.5630955315205541e-05, +2.7569462692655629e-04, +1.8686689964418205e-03, +2.5697092447909926e-04,
-    +8.0974938196673473e-04, -1.6631814317849075e-04, -1.2846618055132136e-04, +3.8933653102962690e-04,
-    -2.7698554012343555e-03, -5.1365410441444260e-05, +3.5959094543631525e-04, +1.2106343773776488e-03,
-    -1.4450339673601216e-04, -1.2166146979115506e-03, +4.1067656139678133e-03, +4.3422848521377698e-05,
-    -5.7053244146928496e-04, -1.6733102045709199e-04, +4.0817392656555839e-06, +2.6849024363364264e-04,
-    +2.7622883854134508e-04, +1.6298090354046127e-04, +8.9573567750629427e-04, +6.3314167893027782e-04,
-    +1.4512852739796776e-04, +9.1431995082578543e-04, -4.7340576982063225e-04, +5.5006123910726721e-04,
-    +9.9808915338381429e-04, +3.4574565296701905e-04, +6.3940330586396857e-04, +5.3961507722694003e-04,
-    -2.0742318763464543e-04, +1.0603076520226425e-04, -1.1046036057935633e-04, -8.9843835289816522e-04,
-    +1.5378657783809266e-04, +1.1922314408324970e-03, -9.4942214240513622e-05, +1.1589428737034220e-04,
-    +9.9360114750802683e-04, +2.6404907141160783e-04, +3.6165878062070122e-04, +1.2063472299127379e-03,
-    -4.8962277883469790e-04, +1.4325371474808651e-04, +6.6445993981091545e-04, -1.3790105590711008e-03,
-};
-
-const double GREEN_MEAN[] = {
-    -6.1233715661709447e-05, +1.6925571656304947e-04, +3.6774734143337189e-04, -5.8779287069878289e-04,
-    +2.5217383366466379e-04, +5.0251605157262686e-04, -3.9938874456272672e-04, +2.2541425105271115e-04,
-    +8.7132181086965906e-04, +6.8731056944560520e-05, +9.1151906816423160e-04, +1.4502090880300997e-03,
-    +3.5058656605087747e-05, +5.6416950918691323e-04, +1.3256065612204834e-04, -1.9089879050837133e-04,
-    +3.5755937035822274e-04, -5.0260618436425697e-05, -3.4807442766045536e-04, +6.9376201070738583e-04,
-    -2.0676263763509274e-04, -7.1118745520673250e-05, +6.2541015998628113e-04, -2.0075844477983649e-04,
-    -4.9518752496688004e-05, +1.5612296497709703e-04, -3.5752818869727105e-04, -3.1385808662807417e-05,
-    +1.2679633237711697e-04, -4.5786633045019398e-04, -3.3724014422984763e-05, +1.6741820195257241e-04,
-    -1.8421772847363733e-03, -8.4336484643626080e-05, +8.7470387320689370e-05, -5.8502896347656928e-04,
-    -1.0500030136419876e-04, -5.3210856578998613e-06, -9.6791664315846451e-04, -4.0590517293605740e-05,
-    +1.2132962321491859e-04, +3.6919356669235122e-04, +2.5735347210994561e-05, +2.1623016888525236e-04,
-    +6.3793446715999639e-04, +7.9823165915165617e-06, +7.5297125502083695e-05, +1.4657111672248272e-04,
-    -3.7448804407768482e-05, +1.7771070822429681e-04, +2.5580792919441665e-04, -1.4133918272933113e-04,
-    +4.9786990671007889e-05, +7.7439285505677066e-04, -2.4419369838531564e-04, -1.5827706653775381e-04,
-    -1.0265719199084057e-03, -3.1338013680589320e-04, -2.7136970372006089e-04, -4.4111643442082881e-04,
-    -2.9483301730665886e-04, -1.3314498604816258e-04, -5.9014319138807954e-04, +3.1936880250168194e-05,
-    +2.6294011742605171e-04, +5.3751112727778614e-04, +2.5767620350449133e-05, +2.9832754749581597e-04,
-    +7.4907716112756150e-04, -1.6353506056090061e-04, +1.2583374601295473e-04, -5.8453342266694151e-05,
-    -1.9785112166940147e-04, -2.4372777609577962e-05, -9.0193530436585487e-04, -2.5155107515619274e-05,
-    +2.1872404767808379e-04, +4.7547971075727693e-04, -4.4103265968687325e-06, +3.3388886776531128e-04,
-    -2.0706813191594039e-04, -2.1776994969562461e-04, -5.2757823572938033e-05, +7.8395122552278747e-04,
-    -4.2879709035481171e-04, -5.5186026557217519e-04, -2.8497801019269743e-03, -3.3911249825024480e-04,
-    -2.3757228476431640e-04, +1.4596061388047775e-04, -1.2957937214045856e-04, +1.2955311376178943e-04,
-    +8.3208084088629767e-04, +4.2792947995274206e-05, +1.8235218566182323e-04, +5.7728762494941373e-04,
-    -2.2636587417132102e-05, +1.0766094859051820e-04, -8.5604211209370674e-05, -2.0545075920229704e-04,
-    -9.2896645488590302e-06, -1.9739953911268745e-03, -1.8023530920975217e-04, +1.7411824259984575e-04,
-    -4.2424018375062961e-04, -3.0398209420237345e-04, +1.3406706966608066e-04, -1.1580457909255559e-03,
-    -2.9832309277428687e-04, +8.4725384725349532e-05, -6.3275373623910972e-04, -1.1544775415946247e-04,
-    +9.5096537527519266e-05, +2.5871832281072651e-04, +1.7996325871461270e-05, +3.0346988756834814e-04,
-    +1.8418665986069335e-04, -7.6698408110890192e-05, +2.1027346516057602e-04, -1.7117606668509130e-04,
-    -3.0957942534482227e-05, +2.7284220430846780e-04, -3.5520432606431007e-04, -1.0916567638451427e-05,
-    +3.1821459975184534e-04, -1.1877595407112145e-04, -3.6157659032063811e-05, +2.9478012303406939e-04,
-    -1.6957660447832241e-04, -1.8663238689189734e-04, +1.4822715414166895e-04, +5.4205883028552316e-04,
-    -3.4355253792333956e-04, +1.1352521785547056e-04, -9.6489818802502096e-04, -2.9426598745258627e-04,
-    +1.3385885918025102e-04, +1.2261955966040691e-03, -1.1391775002456942e-04, +3.6161933845022475e-04,
-    -1.3247535542090932e-03, +3.6399631828844420e-05, +1.7987960652060347e-04, +3.2626132473081780e-03,
-    -5.5663683039681292e-05, +2.1748458438579219e-04, +3.5945024921917490e-04, -1.9932498277204702e-05,
-    +4.7387376440856052e-04, +1.8976360280920819e-03, -2.3323219280856861e-04, +2.7138481330125978e-04,
-    +2.8387988458931414e-04, -3.0088037548173414e-04, +4.3435818131668538e-04, -6.1527518890489496e-04,
-    -2.3854803535080163e-04, +1.5069034896113775e-04, +9.9406658079774827e-05, -1.0597961349729131e-04,
-    +1.6767197572681520e-04, +2.1713958675114868e-04, -1.9225488399956733e-04, +5.2229123805584461e-05,
-    +4.3471626188749742e-05, -2.4166705303882232e-04, +7.7293394364641617e-05, -1.8486577315972354e-04,
-    -2.5235895509556188e-04, +8.0229984002905122e-06, -3.5460195667580923e-04, -2.8498338578423398e-04,
-    -6.4378964663091580e-05, -3.2438452505161031e-04, -1.9966223722718852e-04, +1.7080785967550416e-04,
-    -7.2507015998630564e-05, -1.5637018569560377e-04, +4.0254831281840938e-04, -7.2196929935827011e-06,
-    -1.8233460529910457e-04, +4.5921932153878650e-04, +8.2009834610096095e-06, -1.9022513470275584e-04,
-    +3.2637460134937767e-04, +3.1396597516762171e-04, -1.0184325890069791e-04, +3.0031444218313097e-04,
-    -7.3685550387680911e-04, +9.8869601668042975e-05, +2.2156127546537661e-04, -6.1159362849365568e-04,
-    +3.6591697795566406e-06, +1.9644445706587475e-04, +3.4532396460413677e-04, -3.8358786853476382e-04,
-    -7.8274325460574415e-05, -1.2940939748976720e-03, -4.7991996674985637e-04, +2.5115973939221980e-04,
-    -1.4266750382320099e-03, -3.8585305173391947e-04, +7.4473115313819708e-05, -2.1541310797355598e-04,
-    -1.1580604874283622e-04, +2.3783347972666175e-04, -1.2703201384515905e-04, -5.7831100219987713e-05,
-    +2.8781365564639204e-04, -3.1878328962640957e-05, -1.5838025688201291e-04, +1.5635722751625096e-04,
-    -8.0581800394501077e-05, -3.1035194410756106e-04, +7.9352568732532649e-05, -1.3393556511191585e-04,
-    -4.0938233921216299e-04, +1.2948527031008918e-04, -2.9761767315033427e-04, -3.4333716837452194e-04,
-    +6.0607941475348681e-05, -4.3794161712476840e-04, -2.8073741447853020e-04, +8.0734262840079392e-04,
-    -6.2214107746678580e-04, -2.2510011873779699e-04, +7.4243667718712535e-04, -7.2085334641911077e-04,
-    -2.9605709138491045e-04, +6.3622429407247255e-04, -2.0566814145486147e-04, -1.3841815278335182e-04,
-    +4.8106642305728879e-04, +1.6054560401454404e-05, -1.0596108192184753e-04, +4.6392545083934233e-04,
-    -3.0589823851707098e-04, +1.4207191147530332e-04, +4.0835906755686864e-04, +2.4044343514842414e-04,
-    -1.1205126981015827e-04, +2.3241754669947452e-04, -3.7019697626840669e-06, -1.5903778180583855e-04,
-    +6.2914234734010456e-04, +5.9948344847264841e-05, -4.9206158732182205e-04, -1.1320360516935454e-04,
-    -4.3443079678929662e-04, -2.3905097705872522e-04, +2.7763538590077871e-04, -1.5249433682326061e-04,
-    -6.2656410777716778e-05, +2.9377382994435266e-04, -1.3270585623314702e-04, +1.5292794946783386e-05,
-    +2.9282532263348246e-04, +2.3152331450624737e-05, -8.8581078182014368e-05, +2.5276563664660773e-04,
-    -6.9976603412131634e-06, -2.8645867779370144e-04, +1.9914740439832613e-04, -1.3484615917320548e-04,
-    -4.4652671400782616e-04, +1.5755909276085405e-04, -2.3579534765563097e-04, -2.1898122485109178e-04,
-    +4.0028000842078011e-04, -1.4784767614450819e-04, -3.5501219127167084e-06, +7.4406831727690643e-04,
-    -8.2797535530119450e-05, -1.9775970846876230e-04, +1.0240230529305813e-03, -6.6715563499775751e-04,
-    -4.2629973795929994e-04, +1.0491731629097740e-03, -8.7096650086247566e-04, -4.2054666902637287e-04,
-    +3.2103908958680928e-04, -7.4595191344565387e-04, -1.0314080174498246e-04, +3.2101823309644493e-04,
-    -8.0404601234225547e-04, +1.4181080956974902e-04, +5.0786015082250938e-04, -5.0296353368758278e-04,
-    -1.1212159822347745e-04, +1.3841210502316435e-04, -1.8168671899464545e-04, -1.3295202420602625e-04,
-    +4.2778247358258285e-04, +1.4485929443039486e-04, -2.6727677074458338e-04, +2.9448354981102988e-04,
-    -4.3225622859113897e-04, -2.5798578433819706e-04, +1.3627743486069346e-04, -2.8389861690821807e-04,
-    -2.0169201000272424e-04, +1.4928756415275132e-04, -1.1590671914618491e-04, -1.2071445930200730e-04,
-    +2.1314746107620370e-04, -2.5011312763083121e-05, -1.2505425230018290e-04, +2.5413789699308515e-04,
-    -4.8666356850247375e-05, -1.6815699908730408e-04, +3.3722003977101569e-04, -3.9106302510943759e-05,
-    -2.8400355622231735e-04, +3.0173447144986879e-04, -3.8958062755359349e-05, -5.2159773781157654e-04,
-    +3.2378620615924691e-04, -2.1233928374566626e-05, -7.5305350518074907e-04, +3.2054550355919487e-04,
-    -1.5222892788551879e-04, -8.0295925835226483e-04, +3.9799557833539661e-04, -6.9810865209519307e-04,
-    -6.1206436988118736e-04, +3.4696880682082680e-04, -1.1145527263520937e-03, -3.5182469287886185e-04,
-    +2.0681888125930899e-03, -6.2217922224087039e-04, -2.8090683733845637e-04, +1.2517631706108931e-04,
-    -8.1307476352128949e-04, +1.6068702025120679e-04, +3.6267581520728185e-04, +3.7678222740047685e-04,
-    +3.0096596827886552e-05, +1.7662826952768797e-04, +7.6925125349060132e-04, -1.4364428665483220e-05,
-    +5.6034533670530965e-04, +4.6068102010433763e-04, -2.3428250435191721e-04, +3.4696121287129575e-04,
-    -2.8876950900056568e-04, -3.0666884439340818e-04, +1.2968989697971579e-04, -1.6146633092562227e-04,
-    -3.2228005724194023e-04, +1.1051820202664585e-04, -8.1868802393027221e-05, -3.0186231033643766e-04,
-    +2.7653796293101323e-04, -6.0988465547981844e-05, -9.1241931492285394e-05, +4.6946438129434365e-04,
-    +7.7068299289026316e-05, -1.1285510343705244e-04, +4.7886750645464163e-04, -7.1717500850321955e-05,
-    -3.7040608723738939e-04, +4.2109804975002860e-04, -1.5688450332046006e-04, -6.0510304339910436e-04,
-    +3.4274154841162159e-04, +3.9375499151304396e-06, -9.8544283117869293e-04, +6.7009046076774471e-05,
-    -1.3819272871559455e-04, -1.1826724677772862e-03, +1.1214930565028450e-04, -3.2648584247458359e-04,
-    -8.2571146815765232e-04, +5.1122259791160226e-05, -6.7844281427680941e-04, -5.3434692668232961e-04,
-    +2.4521275966636716e-04, -4.6727687616518443e-04, -3.9448443718632849e-04, +1.8948977089011567e-04,
-    +1.2243193934213077e-04, +1.1186048334436123e-04, +2.9582755580458478e-04, +7.7128182798185318e-04,
-    -7.4212409333869331e-05, +4.4089911871277834e-04, +2.7921245256615402e-04, -6.1510127668522373e-04,
-    +3.6819374939384615e-05, -1.3357408623767895e-03, -1.7707073313534292e-04, +2.3484885434823228e-07,
-    -5.2525868536100928e-04, -1.7518694272288123e-04, +3.8894548184318555e-04, +5.9383613699344988e-05,
-    -2.8107297350917084e-04, +3.1293320673905138e-04, +7.6229066670218288e-05, -1.5563626259816103e-04,
-    +2.5410072166893885e-04, +8.1937318219676479e-05, -1.8581805638390476e-04, +3.3462836450859568e-04,
-    +4.3342974528060387e-05, -4.1527943931131991e-04, +3.9261622257098230e-04, -7.9687951461735650e-05,
-    -6.7047134333870324e-04, +2.5072369895889635e-04, -3.6793949324673080e-04, -5.8493317741448625e-04,
-    +2.2220762077023725e-04, -2.0284012275384634e-04, -7.1031495254228504e-04, +1.6276667272291126e-04,
-    -5.3603171441800923e-05, -9.1805929538002159e-04, -2.5409731944032841e-04, -3.6225339612823737e-05,
-    -6.6148907791382743e-04, +9.9988233564249029e-05, +4.0330660174112820e-05, -4.2730745769301709e-04,
-    +2.6338590384376897e-04, +6.1391800490995832e-05, -7.8992709775443362e-04, +1.1306102017071963e-03,
-    +1.9434555928081514e-04, -1.1908440206861500e-04, +3.7842255403441481e-04, +8.2717695131187389e-04,
-    -2.5988106434288286e-05, +3.8634025221290273e-04, +9.7427676798833191e-05, -5.2808463942748596e-04,
-    +6.9314680385293621e-04, -6.1971271219723003e-04, -2.9321060899840679e-04, +3.7733344882871772e-04,
-    +8.2592129127141378e-05, -2.4877826541272967e-04, +4.2893888393475999e-04, +1.2480701984257829e-04,
-    +9.5183111766113061e-06, +3.7946545389930941e-04, +1.3395543069033144e-04, -7.7228844872063152e-05,
-    +2.9759226369862685e-04, +8.3579709382416355e-05, -3.0286398735218894e-04, +3.1919615223700279e-04,
-    +6.5822142023542741e-05, -4.8946307003595489e-04, +4.1632379881880360e-04, +1.9938446528735328e-04,
-    -4.2514619962466668e-04, +2.5865568073977000e-04, -1.4190300545287223e-04, -5.0924890902093124e-04,
-    +1.0249245014658737e-04, -2.6252288984600841e-04, -2.4118623238891533e-04, +3.0077319012184863e-05,
-    -1.1151085016304341e-04, -3.3791750788374187e-04, +2.0116963456683729e-04, +1.2414986213499947e-05,
-    -5.5409583568844455e-04, -1.4298510575382482e-04, -3.1627931063307148e-05, -4.9082492527750658e-04,
-    +1.3302234092089167e-04, -5.1996172960722589e-05, -6.6568027569965916e-04, +7.4938218304998353e-04,
-    -8.7411006714409662e-05, +1.1011786701651776e-04, +5.3216385300835839e-04, +9.5656781741193975e-04,
-    -1.5788222296398685e-04, +5.8162472213027332e-04, -5.0235513556419356e-04, -5.4696278336077828e-04,
-    +2.7098301178673980e-03, -9.1840214194230700e-04, -6.3684685799696085e-04, +2.1323368157951216e-04,
-    -4.2302053317307646e-04, -1.0613746710275696e-04, +3.9428422631374602e-04, +9.8269341291923898e-05,
-    +2.0856589947416912e-05, +3.1665953017507263e-04, +5.8621990459931445e-05, +4.9105991780930438e-05,
-    +4.2221578582133664e-04, +5.1584956746120310e-05, -2.2757344882019616e-04, +1.5641954174512351e-04,
-    -6.4287672705693087e-05, -1.0976384963747008e-03, -4.5966963767715159e-04, -3.7902389555849063e-04,
-    -9.5325867221237562e-04, +3.3332150939057088e-04, -6.9354685865875842e-04, -3.5231199047010953e-04,
-    +2.2565405132543531e-03, +4.3000260671725773e-04, -8.5808159587114888e-05, +2.9803396729742544e-04,
-    -5.9293632901375842e-05, -1.3886446449324998e-04, +2.0739011238278936e-04, -6.5945925289608313e-05,
-    -2.5871724639263562e-04, +2.4292392321099217e-04, -6.9088582703789422e-05, -5.6350407651993290e-04,
-    +1.8548815397993182e-04, -1.9862400428305229e-04, -6.3288260934287030e-04, +4.3221475746354528e-04,
-    -2.2458493232583953e-04, -9.4747256542467102e-07, -2.3496958123744882e-04, +8.3905710009375667e-04,
-    -1.1253155529536477e-04, +1.2447725247507072e-04, -1.9936318479001603e-04, -5.2949534025733451e-04,
-    +8.0683415773443433e-04, -1.1027109743281273e-03, -3.5725800945291274e-04, +4.1585678193181550e-04,
-    -1.8898093394527238e-04, -1.0763905505395272e-04, +3.0003900758455992e-04, +1.0817589948721282e-04,
-    -1.8356408014593525e-05, +2.7839920334226981e-04, +1.0346266268911388e-04, -1.3193475586256380e-06,
-    +2.5422420132030851e-04, +3.5185393164681621e-05, -1.7263516316492258e-04, +3.8332254361957260e-04,
-    -3.9170984852921057e-05, -7.5416258947799989e-04, -2.5526769189662284e-05, -3.1835162149376821e-04,
-    -8.0103717360699737e-04, -2.1723019314394561e-04, -3.3747323671021949e-04, -4.5427948029430181e-04,
-    +1.7655660905376559e-04, -1.5680716488490073e-04, -1.0495377772067459e-04, +1.4555712762969348e-04,
-    +5.8834809706368297e-06, -7.8630520655517937e-05, +2.4808097654686174e-04, +2.1275696784007573e-05,
-    -2.6073432133900666e-04, +2.7851410169505526e-04, +2.7789276387948943e-05, -5.3566826876257339e-04,
-    +1.9121686512368631e-04, -5.7919920147582781e-05, -5.8031248730759525e-04, +3.5394917606485122e-04,
-    -5.3765237225823575e-04, -6.2770850622475079e-06, +1.2319094785889830e-04, -3.1348274381033219e-04,
-    -1.9097145279683492e-04, +1.9273373328076277e-03, -5.4162300687037067e-04, -6.3791581260259618e-04,
-    +3.1931562537484254e-04, -1.0362604970451227e-03, -6.3847718895884698e-04, +3.2159364770072932e-04,
-    -6.0636392208758961e-04, -2.9576371343969062e-04, +3.8804121160204366e-04, +4.3309039734752511e-05,
-    -1.5696172412404323e-04, +3.2930377965695822e-04, +6.3662806556548927e-05, -3.3239006440517017e-04,
-    +3.4081552034195647e-06, -1.4704754912799975e-04, -6.7685343386546151e-04, -4.5863308469001140e-05,
-    -4.7746243292944506e-04, -5.6295953218484494e-04, +2.4993802138150795e-04, -2.3980900078286673e-04,
-    -6.9586780357366103e-04, -4.8133338255708804e-05, -2.5900367514453273e-04, -5.7977127856559938e-04,
-    -2.3430833483313609e-04, -1.5776046782055268e-04, -5.6103538062056088e-04, -2.0407533415294033e-04,
-    -1.2494925725477869e-04, -4.2795029438914172e-04, +9.9436178256800652e-05, -9.6286809052769542e-05,
-    -4.7131820902498951e-04, +1.7511579020592873e-04, -1.2951086506469585e-05, -7.4866906829913684e-04,
-    +2.0459425359252610e-04, -3.1660496338779240e-04, -7.2015286461011186e-04, +1.5480869303775526e-04,
-    -1.2433846771784957e-03, -2.4162381784416039e-05, +9.5430249555081989e-05, -2.3952790063222213e-04,
-    -2.0645631326665580e-04, -1.0811217141515809e-04, -7.4681693969689210e-04, -6.2193705780695945e-04,
-    +5.4652822275180377e-04, -9.3161341184223010e-04, -5.7338086742531123e-04, +5.5730441740526472e-05,
-    -5.0321583875598231e-04, -2.3719992245374799e-04, +1.2467489214724439e-04, +1.2885037842157687e-05,
-    -2.5125082004779622e-04, +5.8945822475709819e-04, +1.5405286825318835e-04, -2.5172180771940817e-04,
-    +3.7706833067778815e-04, +6.4140695253310441e-05, -2.9259514286301242e-04, +2.8943785998473374e-04,
-    -1.0160652002104551e-04, -6.6967268101470812e-04, +1.8155227408476180e-04, -4.6578773049497463e-04,
-    -6.5908353386052922e-04, +5.3158984287419822e-06, -4.6564597347035640e-04, -3.8990606137604230e-04,
-    +8.8137092853474326e-05, -1.3994069990010962e-04, -3.8037840029495751e-04, +1.0283834238237005e-04,
-    -8.2666291450156216e-05, -4.8410945764522796e-04, +1.0365040475994725e-04, -1.0726486158439295e-04,
-    -3.5925422745211513e-04, +2.2951999690986244e-04, +2.6794589945440679e-06, -7.8698553867454391e-04,
-    -3.7728196789826656e-04, -5.5592558978989940e-04, -5.2829998649348941e-04, -1.1365152574076018e-04,
-    -1.1406868110483983e-03, +3.9422055430794167e-05, +1.7635020494054010e-04, +1.5142381803664520e-03,
-    -1.4228967618451019e-04, -1.8128857748573785e-04, -1.4604866456463122e-03, -3.7431130159280574e-04,
-    -5.9968179150743284e-05, -1.5783755961157123e-03, -4.0272961578098078e-04, -3.5743982877751366e-04,
-    -3.0453081186363373e-04, -2.0409520706003459e-04, +2.8434522394754527e-04, +1.8230851733203203e-04,
-    -4.7742746879904081e-04, +4.0583793532197806e-04, +7.8484768161847068e-05, -2.1404163311525715e-04,
-    +4.8650413910290602e-04, +1.7203907786632946e-04, -3.7647108431123586e-04, +3.9768001639299945e-04,
-    -7.1779438139488874e-05, -5.4067484572703636e-04, +3.1372264044160329e-04, -3.2819735473391365e-04,
-    -5.2565808315602029e-04, +1.9267704712858973e-04, -3.0310384739039997e-04, -3.7605680841209908e-04,
-    +2.9681619254447812e-04, -1.1232753252919725e-04, -3.2255909824666865e-04, +3.3506595658635386e-04,
-    -5.2447063874749519e-05, -3.9320312058807594e-04, +1.8035435870796882e-04, -2.0802630346951290e-05,
-    -5.5281507463275648e-04, -1.7010312929607190e-04, -1.5214943394101154e-04, -5.1761232704371641e-04,
-    -7.3193168652772791e-04, -8.1463759033220944e-04, -3.2383684821156894e-04, -2.6059016184023430e-04,
-    -1.7435700461601953e-03, +9.2091338972556590e-05, +2.2591829734585925e-04, +3.7798235671586416e-04,
-    +7.2159292635768548e-05, +1.0637068890642674e-04, -1.2208379468385184e-04, +1.1181878316885647e-04,
-    +2.2955678807911879e-04, -1.2826276225339813e-03, +1.0314144290642679e-04, +2.3781081016549893e-04,
-    -1.2296045892542737e-03, +9.4534374829515286e-05, +4.3514668141036994e-04, -4.6367812590082641e-04,
-    +7.5576822028623837e-05, +6.8695434247951375e-04, -1.4559473887474652e-04, -2.3111803745178141e-04,
-    +3.9290304181653640e-04, -3.5891882293995198e-04, -3.2196104616725855e-04, +6.0780922994000059e-04,
-    -1.2952247282133002e-03, -2.1055310362227706e-04, +6.3518637915245849e-04, -1.2674632074426494e-03,
-    -9.6911799493426683e-05, +4.7962688964695596e-04, +7.3201230130958526e-05, -2.5126171972344883e-04,
-    +5.6784148014680461e-04, -1.0727566074065912e-04, -1.7500013633860693e-04, +8.5357731644831894e-04,
-    -5.6279611275383292e-04, +1.8563172327107230e-04, +8.1679468725656820e-04, +3.3542016509688523e-04,
-    +1.5212462212787001e-04, +5.5922886158343084e-04, -9.3169129788088753e-05, +1.8132982293942964e-04,
-    +6.1345733403839371e-04, +1.3639577690024112e-05, +1.8300548257018580e-04, +6.4913640539921737e-04,
-    -3.3655475926605453e-05, +2.4117287260676305e-04, +5.2474563894253177e-04, +4.7460821563706615e-05,
-};
-
-const double PURPLE_MEAN[] = {
-    -2.8558822257906310e-06, +3.6069090747299431e-04, +8.0121043466162441e-04, -5.4746337260282445e-04,
-    +2.5927448449015534e-04, +5.5602362491768368e-04, -4.2591218073432711e-04, +1.1634110302334213e-04,
-    +5.0258229307367459e-05, -3.4637869866039206e-05, +8.6161113705983134e-04, -6.0807047944573956e-04,
-    -3.2836141754121753e-04, -8.7593163606991493e-05, -1.3161383760378806e-03, -2.7167422488657986e-04,
-    -9.3414012711152291e-05, -1.1309585021061408e-04, -2.7684356866282064e-04, +1.4801828068773960e-04,
-    +1.1993878060350569e-04, +7.6593584949886763e-05, +3.1748716183185849e-04, +2.0760315348403836e-04,
-    +1.1646180350246428e-04, +2.7603007092633243e-04, +1.8610019226840421e-04, +4.9454540435415963e-04,
-    +2.2781257941709206e-04, +8.8461298789588446e-04, +3.5182565302541282e-04, +3.4432697437110910e-05,
-    -5.5365507900043186e-04, -1.3838390755961061e-04, +6.6556782157243859e-06, +1.8454859995403689e-03,
-    -1.9850511822454511e-04, -7.3971758413609706e-05, -3.7449667097948436e-04, -1.1034927045937854e-04,
-    +5.8472606301158041e-05, +8.0205426888449016e-04, -6.5973620561719931e-05, +1.2548202976817187e-04,
-    +7.5650971041589868e-04, -9.0230946869415105e-05, +4.9370653075048491e-05, -1.3150763740703788e-04,
-    -2.7583482866348055e-05, +3.0834457728861660e-04, +2.9432515134495606e-04, +2.0555101776436083e-05,
-    +8.1648581233717624e-05, +2.7151609455879669e-04, -3.4464773812151213e-06, -4.1500431834503512e-05,
-    +2.3137262413748457e-04, -1.1105411599977970e-04, -3.0257723225127632e-04, -9.2548961899260434e-05,
-    -9.1614248815143111e-05, -4.1762607392907834e-04, -4.6393736772026753e-04, +4.9490762814642570e-05,
-    -2.7974381207416187e-04, +4.4073856118149717e-05, -6.7175808931715971e-05, -1.7629444827691241e-04,
-    -2.7389788663984977e-05, -1.3086967194479330e-04, -3.7543656418980500e-04, +3.5350906543036601e-05,
-    -2.6540278720947515e-04, -5.6207529178140567e-04, -4.9311238605798189e-04, +2.0283203491826903e-04,
-    -6.9291087016693667e-05, -5.2343430841284080e-05, +3.8698923009042774e-04, -1.6069625330795295e-04,
-    +9.8099022382285218e-05, -9.1388874782408146e-05, -3.0028091084422507e-04, +2.8671466241314347e-04,
-    -1.9508805516649713e-04, -1.4592986063238322e-04, -8.3134068962020173e-04, -1.4019750290162209e-04,
-    -6.3439641271588379e-06, +4.2625434766165211e-04, -6.5728872848629764e-05, +1.5979635646583450e-04,
-    +1.2861031220944819e-03, -7.8084781046220450e-05, +6.1174824760989600e-05, -8.6399166872293961e-05,
-    -2.6132799626980817e-05, +2.1486640051390524e-05, -1.3062044032266296e-03, -1.3105422440317623e-05,
-    -1.0026368332167875e-06, -2.1236256717085916e-03, +1.0165615125221868e-04, +1.5706267690000376e-04,
-    -5.8808375824151709e-04, +1.0454765052875753e-04, -1.4632468169319373e-04, +4.8818807478803072e-04,
-    +3.4726748745447474e-04, -7.7082409752854430e-04, +8.5747452711512216e-04, -3.7452418861337257e-05,
-    -7.1501531775100405e-04, +3.8163593535109902e-05, -1.2289484787191197e-04, -4.3743511846220778e-04,
-    -4.2505887770195899e-05, -6.4917029483247610e-06, -4.5317420963772827e-04, +2.8382067791124087e-05,
-    -2.7033786426246200e-05, -6.5168647905581569e-04, -1.7029601066779671e-05, -1.3779120484004416e-04,
-    -1.0333236917419771e-03, -3.2907545347273410e-04, -2.4431212669717954e-05, -1.0002261299707142e-03,
-    -8.3587162993431385e-05, +1.5663532018250396e-04, -5.7158816800170396e-04, +2.4550361709184351e-03,
-    -8.0528171256795121e-05, -1.6991032692885706e-04, -1.4199427076730593e-03, -8.8199806201977058e-05,
-    +1.9349701257810766e-05, +1.5322391687974427e-03, -5.6624559692852886e-06, +1.3275284002449975e-04,
-    +5.1330509759516040e-06, -2.4321819300269301e-05, +6.6261097594482241e-05, +1.9323975148251057e-03,
-    +3.0444985431338602e-05, -2.9042527890806164e-06, +1.2797692602643956e-03, +1.2802773912998596e-04,
-    +3.1447898067080967e-04, -5.8931465854913467e-04, +1.3167921512884572e-04, -6.6520341903373011e-05,
-    +3.1265357898754191e-03, +5.2708317813081383e-04, -3.9265717742067210e-04, +7.7556632692200454e-04,
-    +1.4270338022408620e-04, -1.4864116070000371e-04, +1.8314791971203406e-04, -9.1171627579495165e-05,
-    -3.6704187015241131e-04, +2.9743670707117906e-05, -1.0264366280792425e-04, -3.8069396240959032e-04,
-    +5.4035095551999242e-05, -3.6721474913575889e-06, -2.4334014962684557e-04, +1.8179794880421614e-04,
-    +1.4895412204293869e-04, -1.2436124874611200e-04, +4.0650430183097126e-04, +1.3783698718287951e-04,
-    -8.2530171432468867e-04, +3.9183770495686922e-04, +2.2260347787170467e-04, -1.2279151408652171e-03,
-    +1.5782772558762257e-04, +2.8357426314483186e-04, -8.1056724398377480e-04, +1.4279422233737590e-04,
-    +4.6595664973970459e-04, -3.4565545445008466e-04, +9.4823909739536968e-05, +1.5913946445275857e-04,
-    +1.9495734921829336e-04, -2.8083287372573592e-04, +5.3512277113053511e-05, +1.5919281467794742e-04,
-    -3.2868988045583430e-03, -4.8263923338556152e-06, +1.3869065788651820e-04, -1.3768839334440842e-03,
-    +1.1729798203166462e-04, +2.6514027864184624e-05, +1.3398182602488886e-03, -7.1232554871972844e-05,
-    -3.1582813637957412e-04, -2.1195870579135950e-03, +6.1491321216864127e-05, -4.3146874026955676e-04,
-    +7.0033866317253902e-04, +1.9966518913341774e-04, -1.2162352909183236e-04, +1.1911157338958443e-04,
-    +1.8743727795918841e-05, -1.9586437781480428e-04, +1.1581934911500693e-04, -9.8560429488105797e-05,
-    -3.8662409512948162e-04, +2.2103466741635035e-05, -7.3930285502147767e-05, -3.8023503473556526e-04,
-    +3.4811934356169173e-05, -9.8987130249698620e-05, -4.8437956743743250e-04, +1.0937788059468019e-04,
-    +1.4789216623193758e-04, -2.6500893889572718e-04, +4.2893220571608596e-04, +1.7734117480146177e-04,
-    -9.7589573196365772e-04, +5.4031499540219726e-04, +2.8283835393122454e-04, -1.6294564889526317e-03,
-    +6.5435904952617437e-04, +4.8298830085648697e-04, -9.6981032868813139e-04, +6.4418968459798776e-04,
-    +4.4073482975567885e-04, -6.9607531401344284e-04, +1.0103965306634402e-04, +3.9074178873116632e-04,
-    +1.1043294172309690e-04, -3.2184477807951815e-06, +7.8692177434317440e-05, +1.2836220252129688e-04,
-    +6.9959948987673775e-05, -1.0323331571468055e-04, -9.5882232290118890e-05, -9.6245268616198122e-04,
-    +1.4627374637753434e-04, -2.3124439145707186e-04, +3.3095515089577483e-03, +1.9550725987471860e-04,
-    +3.7764445166038926e-05, +5.4536052824366360e-04, +6.6324369377732283e-05, -6.1680969344924264e-04,
-    -1.0484500520970610e-05, +5.1459188708929589e-05, -1.3750877212926160e-04, +9.6528324571860526e-05,
-    +3.3860639258114716e-05, -2.9648181688496784e-04, +6.4367690092602937e-05, -1.4141550670010542e-05,
-    -2.8121101991182980e-04, +4.2036912742560232e-05, +1.5096100275502518e-04, -6.0883476032516960e-05,
-    +3.0459566846431977e-04, +1.2717359370406704e-04, -7.5530583308734326e-05, +3.3587967684232950e-04,
-    +1.2257777500939039e-04, -7.0257661976431442e-04, +3.7093381135267791e-04, +3.2627048445591971e-05,
-    -1.1269038694448888e-03, +2.5711794499621080e-04, +2.3730228817777632e-04, -8.7077045365611017e-04,
-    +4.1546105786420041e-04, +2.5577689970488328e-04, -6.3687294377152320e-04, +6.3996868664308677e-04,
-    +2.7858435278453451e-04, -8.7799003757148362e-04, +3.9724851694561034e-04, +2.2162853336428609e-04,
-    -3.8912514299595317e-04, -5.2539765561290691e-05, +3.7001778193779852e-04, +3.4127961777578327e-04,
-    +1.9007547958322816e-04, +2.1878196499580281e-04, -5.3444586424654603e-05, +6.9574045767256513e-04,
-    +1.4223461850007779e-04, -5.6889447808766004e-05, +9.2039612335751341e-04, +9.3539026746506905e-05,
-    -4.0122247299518123e-04, +5.5616114973294602e-05, -2.2372153862806172e-05, -4.9178819915919169e-04,
-    -1.7331798067975218e-04, -2.0262806795409225e-05, -3.0534617307068611e-04, +3.0610097299859095e-05,
-    -6.4813416347113054e-05, -4.8912101142765431e-04, -3.9180835841048197e-05, -8.5202925677112208e-05,
-    -3.9765699286481025e-04, +3.2200918379068672e-05, +9.5215850807526186e-05, -1.8461227095516245e-04,
-    +2.1314907954461795e-04, +1.3924678039315595e-04, +5.8482136655167786e-05, +3.9263221792085060e-04,
-    +1.7063188120535594e-05, -4.7033079406239551e-04, +2.2871224312938357e-04, -2.0571823730343040e-04,
-    -1.1006674209877818e-03, -5.5764522199374864e-05, -1.4243878146278212e-04, -8.6165012443584297e-04,
-    +6.8519988310309716e-05, +1.7347206855113906e-04, -6.1653165617458756e-04, +3.6581737252536326e-04,
-    +2.1799821277662998e-04, -4.5080739081384772e-05, +6.4123931602454913e-04, +2.8030879804538233e-04,
-    +1.2676851510044491e-04, +3.6794221216101339e-05, +6.4410819936920193e-04, +1.5272075726225861e-03,
-    -2.6670605372449568e-04, +1.5267712897154483e-04, -1.0784509387195995e-04, +4.1819412937140767e-04,
-    -4.7144488862646000e-07, -7.4472073026083730e-05, +6.6749849794944653e-05, +1.1409292476501426e-05,
-    +1.2874998257482676e-04, -6.2609024571617228e-04, +2.2899802200286923e-05, -4.6708948828803301e-04,
-    -1.2287011081557538e-04, -4.9890759609703722e-05, -4.4886680243877192e-04, +1.1263816995409369e-04,
-    -1.2857174957104915e-04, -4.5242852372332030e-04, +8.1982556183473140e-05, -7.7871641650617446e-05,
-    -2.2456209971212585e-04, +1.7235500903589834e-04, +8.2722043546941726e-05, -1.9959981810406465e-04,
-    +3.3620318524911507e-04, +1.7750025764593064e-04, -2.4506597326302002e-04, +4.6666840206241293e-04,
-    +2.7496378281896241e-05, -7.4157421304587873e-04, +2.8180731374754321e-04, -8.7115954714438442e-05,
-    -5.7506232122578598e-04, +1.4705371686107597e-04, -3.1097726459725909e-05, -3.8128067943398770e-04,
-    +2.8288378910913594e-04, +1.0992777734263257e-04, -3.6310495352202875e-04, +5.4502711506579349e-04,
-    +2.3544220293049255e-04, +1.0887937032826894e-04, +6.4904467037102886e-04, +2.3451097918475027e-04,
-    +2.8429193115717984e-04, +2.9426050258918589e-04, +8.6515605017601317e-06, -2.7755150226640291e-04,
-    -5.1170774178855682e-04, -1.5489962780945149e-04, -1.6252942811863103e-04, -3.4171258867963866e-04,
-    -7.7529764931644335e-05, -7.5727324419379868e-04, +3.0243920490904489e-05, -4.1188730812380866e-05,
-    -7.3819715324581177e-04, -6.1438460950811026e-04, -7.9879369588758915e-05, -9.3829761809162047e-04,
-    -6.7827938598391047e-04, -3.9687618817694663e-04, -1.2968649109015263e-03, -1.3598792944221949e-04,
-    -1.3617511539564333e-04, -5.9197627558744590e-04, +4.3524904832287715e-05, -1.2358526390108485e-04,
-    -3.9859208061711240e-04, +1.1615508431825293e-04, +1.7674962407254237e-04, -3.7103244517818255e-04,
-    +3.4917508658700901e-04, +3.2941759884681484e-04, -1.1529474119196833e-03, +7.4607523607276205e-04,
-    +2.0008527322441279e-04, -9.8507221432393558e-04, +5.8226966501885775e-04, +3.3283179404356503e-05,
-    -5.3631380532877802e-04, +2.2891568871527803e-04, -1.0798760468900499e-04, -4.6224942918088243e-04,
-    +1.9355497127637161e-04, -7.2599957810727582e-05, -6.7449673268148592e-04, +3.1828081005679930e-04,
-    -2.4356678046090241e-04, -1.0153635703932567e-03, +4.6594348944034472e-04, +3.5333480991345340e-05,
-    -1.1467580482046690e-05, +7.2373401595542323e-05, +1.2469566895719942e-04, -1.7341273534417878e-03,
-    -9.5851168645054967e-05, -9.0741915225810887e-05, +2.8060716004911246e-04, -3.9249394582549350e-04,
-    +2.7306533790277782e-04, +6.1330900162314100e-04, +1.2724775911319992e-03, +1.9637708857553834e-04,
-    -6.0561921586352080e-04, +1.5805596383463633e-04, -7.6693401272603313e-05, -7.8671323259831862e-04,
-    -7.1165197096205270e-05, -1.3600763152503236e-04, -9.1007835855712305e-04, +3.7649052264058192e-05,
-    -1.1048677258115172e-04, -5.9915703196537632e-04, +1.1151940207339171e-04, -8.6611422059436907e-05,
-    -5.1185178506304248e-04, +1.5859636722392149e-04, +1.0834683157523854e-04, -5.9951321050904767e-04,
-    +3.8267463024025669e-04, +3.2353025728929148e-04, -8.1677255359354872e-04, +7.0462462331996882e-04,
-    +1.9285087171584547e-04, -1.0957738405960467e-03, +6.7904588313182025e-04, +1.6061669287069851e-04,
-    -1.7575909335409024e-04, +6.5342514143778500e-04, -1.0186740533405345e-04, -6.6643995718325064e-04,
-    +4.2211458867271828e-04, -1.7416396444566690e-04, -5.9191351869200537e-04, +3.3900086939680027e-04,
-    -1.1038065928191699e-04, -6.7637105964251569e-04, +2.6564695341140708e-04, -1.5817582886373878e-04,
-    -5.8029773448843331e-04, +7.2041431220180274e-05, +2.4497410130945910e-04, +5.9537400085255964e-04,
-    +1.2305866778070890e-04, +2.4810811438527721e-04, +4.3692926833661748e-04, +4.0713427711747596e-04,
-    +1.8531060114263900e-04, -1.5046800461979402e-03, +1.9370344078264627e-03, +4.5331857661061579e-05,
-    -5.8315193130881887e-04, +3.5857867794733311e-04, +8.0318857255726247e-06, -4.1133050037139829e-04,
-    +2.6802009220104985e-04, +1.2339186725995025e-04, -3.2306532435939171e-04, +1.9005822808364187e-04,
-    +6.1041933239255257e-05, -3.4047160943121254e-04, +1.2013817345367824e-04, +5.5993702088859514e-05,
-    -3.7494279414219234e-04, +1.3189220126119967e-04, +2.1837492643329802e-04, -1.9440981877180327e-04,
-    +3.6031281598536278e-04, +1.9825834143645161e-04, -2.1399061430421443e-04, +6.3923522724238543e-04,
-    +1.5725552420559047e-04, -2.3027366668999593e-04, +1.1794750071278605e-03, -9.5934014826545855e-05,
-    -1.1525405858938370e-03, +6.7617647488912543e-04, -2.8416598155582012e-05, -1.5829132019854386e-04,
-    +2.6556464597790201e-04, +4.4485432921350444e-07, -2.0124820574574667e-04, +2.3375012288271864e-04,
-    +4.0647735892445334e-05, -3.3403769169353380e-04, +2.8221035070217501e-04, -1.7092255340441222e-04,
-    -6.6322617128452643e-04, +1.6086989591481055e-04, -6.2106512622732394e-05, +4.6198096328071422e-05,
-    +7.4226227190953446e-05, +7.1700003058490318e-05, -2.3054276091111000e-04, +4.2154188343036943e-04,
-    -1.7275462825936911e-05, +5.2780615485794799e-04, -1.4205162230071658e-03, -1.6739611713130942e-04,
-    +6.8516786073741234e-06, +2.4501007241386870e-05, +9.4602743046325454e-06, +2.5722966341731774e-05,
-    +4.0640687435409086e-04, +2.0279769168164913e-04, +1.3938047099213067e-04, +3.2362560459017780e-04,
-    +2.9131653604765902e-04, -9.5856507267711721e-05, +2.4738140179164891e-04, +2.7548041037276337e-04,
-    -1.4209319066823284e-04, +2.5149410180687570e-04, +2.3940930233328007e-04, -2.0523667523139591e-04,
-    +3.3727811462489355e-04, +9.0185378478556023e-05, -6.0057889751308679e-04, +3.8291133122676698e-04,
-    -4.1555044993413920e-05, -1.6639697858182860e-03, +1.0079653008746954e-03, -5.0103770809273964e-05,
-    -3.9426657656022621e-04, +3.7835927617740678e-04, -1.0224549353550937e-04, -3.6075821429600789e-04,
-    +1.3456413135511661e-04, -1.0667375382629259e-04, -3.1819219571437902e-04, +8.3384858927757383e-05,
-    -1.4291994808399691e-05, -1.6360273945970375e-04, +2.0059593360199525e-04, -1.8390334651500831e-05,
-    -2.4627368698518866e-04, +3.0929838853022032e-04, -1.6271498795272411e-04, -1.5506252620493935e-04,
-    +1.5818224648024587e-06, -4.1435534248275866e-05, +2.3464421189850178e-04, -1.5266429250675349e-03,
-    -1.6043590954267387e-04, -1.2137294374485120e-04, -1.3387376322192967e-03, -3.7943786550941687e-05,
-    -2.0544155981951971e-04, -1.3428769241380373e-04, -2.1810777810414645e-04, -3.7436216417292607e-05,
-    +6.1784422980061177e-05, -8.9267294675049323e-06, +3.9597339936737189e-04, +4.6328290354903895e-04,
-    +2.0272782737892483e-04, -1.1592292288062539e-04, +2.3073389359667092e-04, +7.2953192271193505e-05,
-    -8.0934105760078199e-04, +1.5207652767468364e-04, +1.5866442262207000e-04, -1.1077083400129241e-03,
-    +4.5402439578375259e-04, -5.7925455736434293e-05, -7.6441391779878329e-04, +3.1504787913858392e-04,
-    -1.3741194926848987e-04, -6.4020469622788243e-04, +2.8998742237218314e-04, -2.1761195342050101e-04,
-    -6.5960613119654904e-04, +7.4952507183591346e-05, -2.1601935359870337e-04, -5.2158015899949944e-04,
-    -2.5799822751787050e-05, -6.3065797644173890e-05, -4.5878354974352825e-04, +6.8948387095917960e-05,
-    +1.5020932504016275e-04, -3.0420874509316558e-05, +3.0975302549066341e-04, +9.6941138158608380e-05,
-    -1.3295524677454988e-04, +6.3521497102664759e-04, -2.7407013717899264e-05, -3.6942032865415909e-04,
-    +8.8293329200351850e-04, +5.6223634503450866e-05, +1.9516962639976154e-04, +6.2670941706255521e-04,
-    -1.1666291951493285e-04, +4.2582149526902443e-05, +2.2576082710899451e-03, +3.1387761181236206e-04,
-    +3.2915368122664986e-05, +1.4744690363719347e-03, +8.2347221418969507e-05, +2.9080260494478047e-04,
-    +3.5652658475004300e-04, -6.2202613109939932e-05, -2.3581389031540013e-06, +2.3904240681618270e-04,
-    -8.5375544551699308e-05, -3.7605965200525272e-04, +2.3890060310590791e-04, -2.6148908700860300e-05,
-    -6.2210909279920899e-04, +1.1304921481210344e-04, -5.7424844433440454e-05, -7.0342908761293144e-04,
-    +4.8800868756365553e-05, -2.1488051272640910e-04, -9.3386433073150052e-04, -3.7684824217161664e-05,
-    -1.9387721899036402e-04, -7.5974693376194239e-04, -6.8946953432713897e-05, -6.5249902086662420e-05,
-    -4.7514003009628937e-04, +2.5541059222488775e-05, -1.1725094176474189e-05, -3.9207932099719506e-04,
-    +1.0650363292229957e-04, +1.7955272308634458e-04, -3.1228914341609014e-04, +2.4070837255073561e-04,
-    +3.8555283928314016e-04, +6.0408627372174951e-05, +5.4576534415355215e-04, +2.3751179291142246e-04,
-    -4.0400277369294168e-04, +1.0362913577387440e-03, -1.0829335466286615e-05, -6.4538204395151171e-04,
-    +1.5283521919830846e-03, -1.3356381982162539e-05, -2.3236360763938131e-05, +6.8452572526408724e-04,
-    -1.6433915557682624e-04, -2.3179789403630774e-04, -5.2682326573201344e-05, +3.0445490985562090e-05,
-    -6.3690958503514756e-04, +1.8199497534131608e-03, +1.3720654672450688e-04, -2.0187944303518541e-04,
-    +3.9695956863352786e-04, -3.5842918510142118e-05, +8.5650809660904031e-06, +8.8892703161560325e-05,
-    -1.8397918237460735e-04, -2.6856093525369165e-04, +9.0884039806461234e-05, -4.2954914221943878e-05,
-    -4.5950905016342721e-04, +1.3339243149177962e-04, -5.3542504214970418e-05, -4.5711693042325757e-04,
-    +1.1694852870376047e-04, -2.0590990172883152e-04, -7.6334507258765227e-04, -8.2172133798127361e-05,
-    -2.3910924662391082e-04, -7.4934231944987070e-04, -3.2583967088613790e-04, +5.4172913654103103e-07,
-    -5.9158557566248735e-04, -2.5513622913313837e-05, +2.6718000129852775e-04, -4.3806362935699055e-04,
-    +2.7494680833259246e-04, +3.0222962022153932e-04, -3.8154663898871916e-04, +3.4956618934190375e-04,
-    +1.3117841921796307e-04, -5.8591652712558506e-04, +3.8256170765631973e-04, -3.7885882218722061e-05,
-    -7.6767637539522024e-04, +1.1845238912345844e-03, -1.1555530400797762e-04, -7.2879948879676676e-04,
-    +1.3609982194125270e-03, -5.3218195687513236e-05, -4.7503798202931732e-05, +1.5131033302886094e-03,
-    +9.5593097162659121e-05, +3.4044792423990186e-04, -8.7656751634190605e-04, +2.4005766941745391e-04,
-    +5.1694594352185395e-04, +3.8897765608111119e-04, +8.7794787857721520e-05, +1.3064602438407416e-04,
-    +1.1462558066641616e-03, +1.3474024005173568e-04, +5.4848445041671718e-04, -1.7416968506165723e-04,
-    -3.0432627257642470e-04, +4.5808194614202480e-04, -9.3235094221418653e-04, -1.2605954457146256e-04,
-    -3.8794125796170461e-04, -1.8995712443824441e-04, +6.4295498114908038e-05, +4.0231616103093165e-04,
-    +7.6564057767911987e-04, -3.5401335772068361e-05, +1.1237933122158152e-04, +6.6349170568288148e-04,
-    -1.4884776147855506e-05, +2.8604180838828433e-04, -1.8746118576424618e-04, +3.2830269988576744e-04,
-    -1.0064402998053763e-04, +2.9827237644591997e-05, +4.7105826198755524e-04, -4.2222399329352073e-04,
-    +4.7728116048488523e-04, -6.6995365483800686e-05, -2.8233559544642902e-04, +6.7515900191414293e-04,
-    -2.7697167268765244e-05, +6.7857476226096275e-05, +2.1290164026433652e-04, -3.3913433028964512e-05,
-    -6.4523605265544428e-06, -1.6723152511030485e-04, -5.0782096535755912e-06, +1.7463053364384674e-05,
-    -3.8539421348762351e-03, +7.6848543047732968e-05, +2.8157837733190118e-04, -1.0963090418809587e-03,
-};
-
-const double EMPTY_MEAN[] = {
-    -7.3757670623295492e-04, -2.6330603748155469e-04, +1.1183292764876769e-03, -1.2032995467712551e-03,
-    -1.2708914961240730e-04, +1.2389392226693232e-03, -1.0175659443867132e-03, +9.4238270041651070e-05,
-    +1.3393069483211820e-03, -1.1024407787032946e-04, +1.4755919449366600e-03, -3.2612235545344459e-03,
-    -1.8701335230968982e-03, -3.7783640206684693e-03, -1.2153792859928320e-03, -1.0980359950520566e-03,
-    -2.5944432474050219e-03, +6.9522581057995738e-04, -1.2126163323349508e-04, -3.8259521819593463e-04,
-    +6.7322286246638977e-03, +2.4069263811232191e-04, -1.2508416921729088e-03, +5.6917933318614217e-03,
-    -3.9749161987770064e-04, -2.1296031017799455e-03, +4.7667956847849336e-05, -6.2685391731436436e-04,
-    -2.5087658582598786e-03, -4.7769566812299108e-03, -2.4163374312953018e-04, -1.4716236633083024e-03,
-    -8.8466678571418847e-04, +1.7744391252728205e-05, -1.1689387520449866e-03, +1.7606389328355286e-03,
-    +4.3857828878166296e-05, -1.0676756869880432e-03, +1.1531627388623900e-03, -3.5038797945748898e-04,
-    -1.3064644335033754e-03, +5.9835182017162777e-04, -5.5927999607770793e-04, -1.4262392412832678e-03,
-    +1.5026205806226807e-03, -9.0745943164074469e-05, -4.7940801272055840e-04, +2.6392619517998854e-03,
-    -4.2254428205396630e-04, -1.1381429638225597e-03, -5.6264240264938153e-04, -1.5449883203174386e-04,
-    -5.1273002832393942e-04, +2.0029155897307860e-03, +1.4151805904042148e-05, -2.5958166079643932e-04,
-    +4.6824156526274092e-03, -1.4442905878626959e-04, -4.8927822131259130e-04, +3.3506565911716468e-03,
-    -6.5630099008147659e-07, -5.5871981601528665e-04, +1.9710059679118376e-03, +3.7584317222468736e-04,
-    +1.0954227506640177e-04, +4.4079286058254096e-04, +4.3200363186546162e-04, +2.3639691680035828e-04,
-    -5.0878486738769810e-04, +4.5313808677481234e-04, +2.6751033416467319e-04, -2.9879381714202055e-04,
-    +4.3083418763354916e-04, +1.7807849054571597e-04, -6.5213488698595036e-04, +5.4888129603126491e-04,
-    +1.7227466937890369e-04, -1.1178433892652651e-03, +4.9206464816699508e-04, +9.5865396804436929e-05,
-    -8.0648949280779270e-04, +5.5933571005864003e-04, +3.2645629134259478e-04, +1.5439529931200735e-03,
-    +4.5380322237567269e-04, +1.2768898866633428e-04, +2.3836324079897233e-03, +2.7367342407054733e-04,
-    -1.4029614079626474e-04, +2.0358697677011007e-03, -2.7482500439094672e-04, -1.1020408186898454e-03,
-    +2.3160656363885031e-03, -4.0564316264090444e-05, -4.4052628751997756e-04, -7.6371737442406317e-04,
-    +1.3525071036263607e-04, -6.3542178793100544e-04, +2.0428540475614194e-03, +4.3012887623905278e-04,
-    +4.7532866043547715e-04, +5.7311010285229034e-03, +4.3281041792487293e-04, +4.7060373688495607e-05,
-    +5.3018045387724887e-03, +3.7991191044660025e-04, -5.2372696689153935e-04, -2.4374585043980854e-03,
-    +4.6310626284277388e-04, -2.8090332295896317e-04, -1.8944883377014163e-03, +5.2853786022568727e-04,
-    +5.6544057605173655e-05, -8.2920131209706326e-04, +4.6456350853204013e-04, -1.1434957311782900e-04,
-    -1.9238847767018806e-03, +2.3828480255743268e-05, -7.6306748068777862e-04, -1.4074095966428114e-03,
-    -2.5455845597705974e-05, -8.0580258420619145e-04, -2.1915169139601971e-03, +3.8943722689634445e-04,
-    +7.6120088859422488e-05, -8.3744095555812856e-04, +4.3947917581630189e-04, +3.9700350761629681e-04,
-    -3.0782434585161801e-04, +4.7376923384148786e-04, +3.3603981194526205e-04, +1.2109606201838791e-04,
-    +3.5654671005627551e-04, -1.0026633259079784e-04, -6.5462660100724208e-04, +1.7665613786759451e-04,
-    -2.3698988897090286e-04, -3.7385553003276739e-03, -3.1043573565753805e-04, -1.0134553206705170e-03,
-    +2.1145856925073963e-04, +2.8880892909859473e-05, -4.4997394564426704e-04, -2.5878913116359910e-03,
-    -1.6779801384344197e-04, -4.6303207304650113e-04, -1.0239442887959394e-03, -2.4190834208274786e-04,
-    -5.6427326229404934e-04, +1.4872957146510254e-03, +4.1099576622670165e-04, +9.6077890035966489e-06,
-    +5.6797861981841955e-05, +2.3402157166640703e-04, -3.2672864579152543e-04, -3.1472678332376087e-03,
-    +2.9741079666138800e-05, -3.4990578189430621e-04, -1.4108661720320999e-03, +3.7946130706382352e-04,
-    +6.0822469194611675e-06, -5.7240403014025248e-04, +4.0054617826752243e-04, +1.2646324705915300e-04,
-    -6.5240657992910421e-04, +3.6670944613690021e-04, -5.6699552458057654e-05, -8.3415191932983772e-04,
-    +2.8365885729178184e-05, -4.1169292042531741e-04, -2.1180334573402764e-03, -6.9386148966064950e-05,
-    -2.1886188377240011e-04, -1.7328459469932844e-03, -7.6589056008463433e-05, +6.2274732367453161e-05,
-    -3.5755537361607287e-03, +1.7300070663914014e-04, +1.8730449375712984e-04, -4.2798059045318030e-03,
-    +4.4929308627507711e-04, +1.5545174126892325e-04, -2.6989721905718075e-03, +4.9492924439332564e-04,
-    +2.0423961526546162e-04, -1.7113163055233727e-03, -9.1444516348499010e-06, -2.3326211430101776e-04,
-    +6.1447184875338594e-04, +1.2554104281992982e-04, -3.0182068037345788e-04, +4.2790143925650094e-03,
-    -1.1084225282043242e-04, -4.3775582026271177e-04, -9.9753981019077122e-04, +4.6539889436097916e-04,
-    +7.0550345363013108e-04, +5.3742641945968110e-03, +7.4638680372469371e-04, +1.6305042695909070e-03,
-    +1.0171335203731761e-03, +2.5160403582408344e-04, +2.8737988491520940e-04, -5.4132395610923228e-04,
-    -2.9637073168881881e-04, -6.3898333279508758e-04, -7.9870952260437155e-04, -8.5730196534912267e-05,
-    -4.7376048631266672e-04, -1.2031574011518728e-03, +2.7197626970449826e-04, -6.6379817251248672e-05,
-    -1.1147649439224258e-03, +7.3243889910709853e-04, +6.9585589693934820e-04, -7.2071082100025655e-04,
-    +4.3470370696600688e-04, +4.9664129472752421e-04, -1.1403820769371970e-03, -2.6801829048009172e-04,
-    -6.6941600893340419e-04, -1.2993138346549602e-03, -7.1138294105884195e-04, -1.2922421534041688e-03,
-    -3.5208184317389616e-03, -5.9765880479169232e-04, -1.2518688611961003e-03, -3.3865529051556684e-03,
-    +2.0663707847149489e-04, +6.3015913027780158e-06, +4.1931547915480824e-04, +3.5001110582828500e-04,
-    +1.4212718082457014e-04, -2.3125732759304118e-03, +9.5171997298355553e-05, -4.9060507221221328e-04,
-    +2.0688473752399962e-04, +4.0897646857307620e-04, -9.5128345405769417e-05, +3.1272125876535928e-03,
-    -3.7920290960643345e-04, -8.7574180930559777e-04, -3.1585682643920743e-03, +2.3920683145394755e-04,
-    +2.1453804746017949e-04, -1.2977379780249195e-03, +6.7285230153344084e-04, +9.3359421412563947e-04,
-    +7.4508975212752746e-04, +7.5664997048966731e-05, -2.5511268350314871e-04, -1.8298606419656100e-03,
-    -5.2436503691047310e-04, -1.0876006453654527e-03, -8.0399461234458990e-04, -4.9298734142752304e-04,
-    -8.6139568471806061e-04, -1.3525262029249125e-03, -1.9093222853235457e-04, -4.2769212219527828e-04,
-    -1.2270486552562784e-03, +2.3694268867514582e-04, +1.7737413876858600e-04, -1.1893048305597089e-03,
-    +3.4185940242670331e-04, +4.7559950455452235e-04, -8.4667981147289943e-04, +9.2695208844435173e-05,
-    -1.8075958178330156e-04, -1.0500421037441996e-03, -1.0126016226958505e-03, -1.8231014463217291e-03,
-    -1.7659535617364477e-03, -9.7157454786290728e-04, -1.7832914806308446e-03, -4.4246789279173241e-04,
-    -2.0901581776458806e-04, -6.6995119172834664e-04, -1.2887956384436208e-03, +6.0150449285119312e-04,
-    +7.8827443700290678e-04, -6.2142559317258114e-04, -6.7611307784105765e-05, -4.5526001789947875e-04,
-    +9.1381127461006044e-04, -3.7016670758636723e-05, -9.0330595647038930e-04, +7.6780088332157736e-04,
-    -2.1773607144218811e-04, +1.6049886305313316e-04, +2.9123456362222344e-03, +1.0060434331552101e-04,
-    -2.0925080727552059e-04, +2.5770778967884414e-03, +5.6358980853619782e-04, +6.5943854233017213e-04,
-    +1.4483775838327580e-03, +2.7987913775136909e-04, +2.8554180047552337e-04, -7.0385732598793099e-04,
-    +4.1843227299040964e-05, -3.1197077910562326e-05, -3.9484431207860741e-04, -9.6497473919889045e-05,
-    -1.5929057749880786e-04, -7.8344315117580634e-04, -2.5617746958721054e-04, -3.9468281178448744e-04,
-    -8.6569825046294241e-04, -4.7381776194410414e-05, -1.8617519819978862e-04, -1.0675294287702333e-03,
-    +2.1496439589179645e-04, +1.4180871098780262e-04, -8.8980906255953403e-04, +3.7990976504563898e-04,
-    +4.2729613727808720e-04, -1.6728534813574534e-04, +1.6605245683606217e-04, +1.2575556355977501e-04,
-    -2.8446021422834383e-04, -1.1986860464576508e-04, -2.5637995776362339e-04, -1.6597515492163556e-04,
-    -1.7692205447875827e-04, -2.6410990996556227e-04, -3.3725884030817054e-04, -5.7420518821790247e-05,
-    +1.3231524572777180e-04, -5.1080260006940820e-04, -2.6691413959916668e-04, -5.5999271556866285e-04,
-    -3.2463550038706597e-04, -3.1356488137071519e-04, -1.0600583986950804e-03, +5.0330237936261301e-04,
-    -2.8257609898273459e-04, -1.3831383529528958e-03, +1.4798292784899546e-03, -2.4539782190942275e-04,
-    -9.2172384845868953e-04, +6.3398835734197170e-05, +3.9075720319459834e-04, +1.8110778382487524e-04,
-    -3.1058357036881350e-04, +2.3765414458732737e-04, +3.4912205813495980e-05, -5.6838682318191851e-04,
-    +4.6487584665478172e-05, -3.9321129945175644e-05, -4.8057445862489766e-04, +8.1147201126830401e-05,
-    -9.8190332502896561e-05, -8.7784245943989508e-04, -1.7019009171732945e-04, -4.9919915978481578e-04,
-    -1.4879054582102543e-03, -2.9405703976888119e-04, -5.1350829187532608e-04, -1.2442982617715309e-03,
-    -8.1582500590672002e-05, -6.4326855218623926e-05, -9.0057582356543257e-04, +1.2491896521124891e-04,
-    +3.2038138607799657e-04, -8.9842341046807113e-05, +1.7888369961205477e-04, +2.8415463196666330e-04,
-    +2.2123173721750876e-04, +6.7363205160828361e-05, +5.3595216227437021e-07, -9.1985460433473146e-04,
-    -1.6360317310121442e-04, -9.2157580339558045e-05, -1.5067485330217620e-03, +1.4640079233448872e-04,
-    +2.3021167554397842e-04, -2.2553106022422115e-04, -3.6928594386015075e-04, +1.2236105290330051e-03,
-    -2.9351764345576258e-03, -3.5290025183162994e-04, -1.0619951309580569e-03, -2.9998576761002581e-03,
-    -8.7376900893584137e-05, -1.1038460742700965e-03, -1.8886117778259841e-03, +2.7900765453356467e-04,
-    +9.7512606306245574e-04, +3.9983064671112690e-03, +8.7316567039764166e-04, +6.3795472026967706e-04,
-    +3.7712443250981047e-04, +2.0477276143106139e-04, -7.5438555852198097e-05, -8.7914252609007902e-04,
-    +8.7390615883992177e-05, -5.2313168442033452e-05, -7.7933110835322122e-04, +3.9621642042615268e-04,
-    +1.9040194403669892e-04, -5.1550236583921617e-04, +3.7477565850223954e-04, +1.3736214084063541e-04,
-    -9.2461057145872504e-04, +1.1633332913467726e-04, +9.8953140325654606e-05, -1.0395902204910475e-03,
-    -3.4779212780678507e-05, +8.4224950744432413e-05, -8.5311291682948120e-04, +2.8199000790359269e-05,
-    +2.4575235274213155e-05, -4.5991810737194084e-04, +2.5617567046965699e-04, +1.9770301927394198e-04,
-    -3.0382795892311643e-04, +5.7638219713743708e-04, +7.9851043082399117e-04, -2.9373573809037218e-04,
-    +4.9252483736381147e-04, +7.2480470056589415e-04, +4.0902187961779763e-05, +4.4186577727020068e-04,
-    +4.2417197529933960e-04, +6.4351654532633423e-04, -2.7885603724335642e-04, +5.0158886977253094e-03,
-    -1.5802261012185688e-03, -2.6108799698209791e-04, -9.1646049964116136e-04, -1.8678345194427317e-03,
-    -2.7073073429551556e-04, -2.0726412561212185e-03, +4.4836473901861944e-03, +1.6891090602553772e-04,
-    -2.7593210821638397e-05, +1.6763738791747839e-03, +7.1256029635487943e-04, +6.1685498046978383e-04,
-    +5.0577554959838045e-04, -1.3269666398792908e-04, -2.9550299291791245e-04, -1.2133143451782563e-03,
-    -1.1154691285248463e-04, -2.6131219871437295e-04, -8.6923836127286941e-04, +1.1971222653591222e-04,
-    -6.5627666565917358e-05, -2.9648393375094050e-04, +4.1895492254182410e-04, +3.2686398619431500e-04,
-    -1.8943411286655661e-05, +2.5732922421063171e-04, +3.1818637562577601e-04, -1.8668428526681609e-04,
-    -3.9919951178295167e-05, +2.7381437297262099e-04, -1.0275792178266307e-03, +1.8581814648105816e-04,
-    +2.1973286919394831e-04, +4.1578125064420721e-04, +2.5291352215985177e-04, +2.5036930659789805e-05,
-    +3.6318266388570149e-04, +5.4998206368248590e-04, +4.3980750315894535e-04, -6.3640347139337370e-05,
-    +4.4554792774106515e-04, +2.9669709822998936e-04, -8.3213840310208508e-04, +6.5472025191873546e-04,
-    +4.1075553295766005e-04, -6.4217525355324018e-04, +1.8960897664298418e-05, +3.3614624327625960e-04,
-    -2.1320708187933090e-03, -3.6746879876756687e-04, -1.1453032981999895e-03, -1.6802220982993239e-03,
-    -1.6947498204773434e-04, -7.0673943885627246e-04, +5.8995947945938640e-03, +4.3363818154755658e-04,
-    +3.0865525039612714e-04, +1.4979435761861115e-03, +4.3580410447227694e-04, +4.2214195084061616e-04,
-    +1.3989696103528671e-03, -2.2541136312077467e-04, -3.5657187813075119e-04, -8.1954820964814598e-04,
-    -8.8239670248383968e-04, -1.0738152755375254e-03, -8.4442390548776925e-04, -9.6421557068753101e-04,
-    -1.5351990201669930e-03, -8.8074478196280910e-04, -4.2343021332472478e-04, -5.7504977448909764e-04,
-    -8.8680192895273624e-04, +4.3283040188395080e-04, +7.6932404905209306e-04, -8.7991042835885817e-05,
-    +5.0523366041912185e-04, +2.1415767833897954e-03, -2.8535495221056916e-04, -1.7585123302235191e-04,
-    +4.4686373506053786e-04, -6.2199032644856273e-04, -3.8484027953564469e-04, -6.8180161521187537e-04,
-    -2.7149664634427880e-04, -1.9658424022562599e-04, -4.7171328746862623e-04, -8.2363767437535504e-04,
-    +8.1109624189775264e-05, -2.5748606923755928e-04, -8.6351739850436650e-04, +4.6554192978579532e-04,
-    +2.7272308955736440e-04, -3.7307676780965035e-04, +2.1612165630172306e-04, -8.3841361237549163e-05,
-    -1.0027057207909718e-03, +6.2887545226985708e-05, -4.5074495517846263e-04, +1.1316467993661596e-02,
-    -2.5933488809495685e-04, -1.8058971817369695e-03, +3.7112098905105291e-03, -4.5363751495229528e-04,
-    -1.0556487639260704e-03, -3.7054212668258978e-04, -7.4533732124874193e-05, +6.9967347263902546e-05,
-    +1.3014665061924962e-04, -2.6632669290017446e-04, +3.1226483155704553e-04, +4.8489575579409651e-05,
-    -3.3373117310232287e-04, +8.5897071583954036e-05, +1.0127026500598468e-03, -2.9905954595135548e-04,
-    -1.2675702273692442e-04, -4.5338699738960526e-05, +4.8170833160564792e-05, +1.3800563663644968e-04,
-    -5.6628450151204046e-04, +2.5521135718708962e-04, +5.1714329690455635e-04, -1.2127384132420223e-03,
-    +5.6349841832345124e-04, +1.9025423402540789e-03, -1.4121747042319557e-03, +5.9522853417078156e-04,
-    +8.4752229291532553e-04, -1.3730345787685088e-03, +1.9938367550558273e-04, +1.7553454346953354e-04,
-    -1.0011932003077730e-03, +1.1649560944838473e-04, +6.5444478272776749e-05, -5.4848381554012708e-04,
-    +2.2336473283031237e-04, +8.0882023376592290e-05, -7.7055270809815442e-04, +3.6834067363878992e-04,
-    +4.5688466536946836e-04, -9.0077558104370581e-04, -9.9335446575353448e-05, -2.0696977389509717e-04,
-    -1.5247598866884983e-03, -1.5336158487074436e-04, -2.7322714059951789e-04, +2.2717302691939605e-03,
-    -1.4048973246094941e-04, -3.9529570312824008e-04, -2.2421675975038144e-03, -2.5459973079964388e-04,
-    -3.0222253247698584e-04, -5.4793207743904118e-04, -2.7420835135846042e-05, +7.8570053701734754e-04,
-    +6.3725824457517026e-04, -8.5246995983949059e-05, +1.1529021979667161e-03, -3.1643602006378870e-04,
-    -3.5432411900700368e-04, +3.1891979436221888e-04, -1.9492709256935348e-03, -2.1789220066415822e-04,
-    +1.1440051248679523e-04, -2.0747498910197513e-03, -2.8358863040731645e-04, -1.6168413257693884e-04,
-    -2.4162515885172244e-03, -2.7953241889589153e-04, -3.2265568997309513e-04, -2.2686552406271619e-03,
-    +1.4913825577271452e-05, +3.6118187885502406e-05, -2.2029523700131128e-03, +3.8471070733464769e-04,
-    +4.8834879862573184e-04, -6.2665013088356546e-04, +3.6915918233468536e-04, +3.9144388369627262e-04,
-    -6.1831447857485684e-04, +1.0481022411462866e-04, +1.0119208911980556e-04, -1.0485489514950198e-03,
-    +6.3659380945812460e-05, +1.9381087767511668e-04, -1.1395476512001577e-03, +2.5798508257810442e-04,
-    +6.0480418076938646e-04, +5.1938851076098545e-04, -8.4161468809282582e-05, +4.5048656717659324e-06,
-    -1.0950722757512616e-03, -4.4058019237644901e-04, -5.8924756046020710e-04, -8.1569321533883838e-04,
-    -3.8800778630289568e-04, -2.5037143958458142e-03, -4.3197360401030617e-03, +1.8594565501088743e-04,
-    +2.4655206953301588e-04, -1.4723987760933191e-03, +3.0321337255364932e-04, +1.0384283123828985e-03,
-    -2.7180740293336603e-04, +2.2345333916898058e-04, +1.9521135613243624e-04, -1.3619407608645422e-03,
-    +9.7383985475405109e-05, +3.3538921002939867e-04, -1.7837657248530338e-03, -3.0002974075778836e-05,
-    -1.7698463940752884e-06, -1.7986038410926419e-03, -1.6946703861940506e-04, -4.6484983348823663e-04,
-    -1.9389085798120619e-03, -2.6671353358748379e-04, -8.5925320260212055e-04, -3.0217338811017276e-03,
-    -1.0250970065756912e-04, -6.1248292817077973e-04, -2.4186335984486560e-03, +6.3259416075881159e-05,
-    -2.7596350837459454e-04, -1.3853345807781927e-03, +2.5287984453881981e-04, +5.4043857095032680e-05,
-    -1.0196386945049429e-03, +3.1055846461283692e-04, +2.2638451226280549e-04, -1.2308537488290774e-03,
-    +2.0969548372076180e-04, +2.7244966126473949e-04, -2.1722221180411482e-03, +3.0068749424469433e-04,
-    +6.2593224561373882e-04, -3.8031916195343249e-04, -2.7235005451243117e-04, -2.5509959963211209e-04,
-    -4.7265949574920229e-03, -7.7906247976811300e-04, -1.4683367388764015e-03, +8.1781073615510029e-04,
-    -1.5085721645055410e-04, -1.4407501054297532e-03, +2.7262850663740761e-04, +8.4036629916822161e-05,
-    +2.8078585246149698e-04, +3.3560362908098000e-03, +4.9611078905216542e-04, +7.1180727175644521e-04,
-    +1.3184238602893241e-03, +6.2177126915268931e-04, +8.1354841328625785e-04, -1.8235364465423213e-04,
-    +4.2876969035692420e-04, +2.0771542669541115e-04, -1.6580404860288419e-03, +3.0532752696148290e-04,
-    +1.3118163181934640e-04, -9.3057952608068819e-04, +3.5148528877360303e-04, -1.3354990705853994e-04,
-    -3.7306080820007044e-04, +5.1473233309513736e-04, -1.4361082263750891e-04, -6.4390153715874703e-05,
-    +3.0522398822534067e-04, -3.7939082920922950e-04, -9.6353766282800297e-04, +2.8740434241814869e-04,
-    -2.3833859539596503e-04, -8.5790034588182143e-04, +6.1301061957039433e-04, +3.0639710201895386e-04,
-    -7.8059021314313222e-04, +8.3999585381771267e-04, +6.7166780876236841e-04, -6.8710606463881041e-04,
-    +7.9001656535421792e-04, +5.8208704488763756e-04, -8.3429800270190893e-04, +5.8384249930050209e-04,
-    +1.0946237109932578e-03, +4.7179105255075763e-03, -3.5695278376712039e-04, -7.8181595696168724e-04,
-    +6.9875052387602266e-03, -6.6789652273476874e-04, -1.4072437220185704e-03, -1.0756912755706461e-03,
-    -1.8151434283766692e-04, -4.7358896649023620e-04, +2.5991776490190189e-03, -5.3321902149765785e-04,
-    -1.0624910021296023e-03, +7.8366831930899077e-04, -4.1320187462189236e-04, -9.2049151340390886e-04,
-    +2.3838807703244268e-03, -2.0565564075498765e-04, -7.3162118636318043e-04, +4.8508560850345243e-03,
-    -1.5350820472822754e-04, -1.4560257041189573e-03, +8.3269842646903011e-04, -3.5446487704006500e-04,
-    -1.7557958646498774e-03, +1.7743789377170352e-03, -3.6801368864902402e-04, -2.2902987642722385e-03,
-    +1.6594398298087952e-03, -2.5918689634177148e-04, -3.2430301819142233e-03, +3.4546362048743810e-03,
-    -4.9508449741685317e-04, -3.1172203831792865e-03, -3.6261411952487105e-04, -3.6038929500137865e-04,
-    -3.0678771720226315e-03, +2.8907978771710850e-03, -4.8792955263538018e-04, -3.5724843974284399e-03,
-    +3.8689676120503263e-03, -1.4364242753159588e-04, -1.7050009688982506e-03, +2.3602983923225371e-03,
-    -2.4170089051007450e-04, -1.2076465874687364e-03, +2.0426556837851439e-03, -7.1279452774198194e-04,
-    -1.7826800431450277e-03, +1.5930427356385887e-03, -1.0127776409175684e-03, -2.3242154429845615e-03,
-    +2.4541246070420696e-03, -4.9867919135281264e-04, -1.2656260045368452e-03, +1.7563000935317066e-03,
-};
-
-const double OJAMA_MEAN[] = {
-    +3.8439198340446351e-05, -1.6589423976792308e-04, -1.5533021855302970e-03, -5.1628815684985705e-04,
-    +3.3181738978211407e-04, -1.4074564574997051e-03, -3.9406629304337585e-04, +2.5525735456593060e-04,
-    -1.2057664634159738e-03, -1.9394416873795659e-04, -1.1451887373496451e-04, +2.2033765574966395e-03,
-    -3.5798506638814349e-05, +2.7618761811993333e-04, -6.3154240655013006e-04, -3.4189562018770321e-04,
-    +3.1368078725372428e-05, -8.5479908467734115e-04, -2.5266811949051286e-04, +3.8239261520790779e-04,
-    -1.4704038423262017e-04, +5.4588351213117204e-04, +9.2545723250078249e-04, +3.7182282489548412e-04,
-    +4.4838766146621374e-04, +4.0779967120752617e-04, +8.1178086474638039e-05, +1.8962244150474199e-04,
-    -2.1545671785450006e-04, -1.2947444487665270e-03, -2.8475977802235405e-04, -9.0139559562960134e-04,
-    -4.1004883977059847e-03, -3.0322669559874026e-04, -7.5623722743696834e-04, -8.5711391293249030e-04,
-    -1.8556228655637543e-04, -1.0181079347356695e-04, +2.1415122321067469e-03, -7.2469743980155870e-05,
-    +2.3029939226254186e-04, +4.6747097867023193e-04, +3.5944222984366818e-05, +2.3669022167832821e-04,
-    -2.4610615197965422e-03, +1.8221011837678337e-04, +2.4588318790149679e-04, -1.6589246555436465e-03,
-    +6.8310411438589837e-05, +9.4144522955052730e-04, -3.1032786250693211e-03, -2.1376756512716974e-04,
-    +4.2428434732102999e-04, +3.1966788317247394e-04, -3.8649178488213469e-04, -2.0952754633998759e-04,
-    -8.6854737069509658e-04, +1.7700416362029958e-04, +3.3607077522581507e-04, +2.8595756543904867e-03,
-    +3.6332143110122376e-05, -1.7015542636751450e-05, +1.0332625538729953e-03, +1.4456323812461698e-05,
-    -6.5553982465454464e-05, +5.2800224846173336e-04, +5.1243944382173235e-05, -1.0042378231875359e-04,
-    +5.8626339085395115e-04, +1.9993799034113811e-04, -1.6586630126990001e-04, +1.2347842290870183e-03,
-    -1.4129972513481869e-05, -3.4637284770438413e-04, +6.4829964133412672e-04, -6.2320637729160373e-05,
-    -5.1857231480174860e-04, -4.0940786014703490e-04, -3.3474222087866359e-05, -4.4677632460950732e-04,
-    -1.3749609164252921e-03, -1.5696279969530752e-04, -2.8454835994835289e-04, +8.3656886268485930e-04,
-    -4.6328096392955125e-04, -2.7575549310160250e-04, +3.8120128847460269e-03, -5.0059826210847804e-04,
-    -1.7784770994383067e-05, +2.8212197318767097e-03, -4.4199352242816465e-04, -1.0820179382280122e-04,
-    -2.6714632716380135e-03, -1.1384882700148231e-05, +1.8282828568894251e-04, -4.3510243574433546e-03,
-    -3.6081925153114234e-04, +6.5231201457328534e-04, -1.8033248220724453e-03, -8.2131508896654895e-04,
-    -4.5441146432342855e-04, +1.5448785289932454e-03, -2.2244218075940329e-04, -1.3074767620371643e-04,
-    +2.2977029432827306e-03, +1.7847290659013965e-04, +9.1571342363199119e-05, -7.3417892393663048e-04,
-    +8.3861758203884607e-05, -1.7060629954089598e-04, -5.8258167771940629e-04, -2.4356793431544694e-05,
-    -2.0246610366295872e-04, +5.8861236400404024e-05, +1.4182604284876166e-04, -1.2580299889551353e-04,
-    +2.2473477139030223e-04, +5.2828035968162466e-04, -1.5314487257286601e-04, +4.4023489249973532e-04,
-    +5.9267180714938652e-04, -1.2087444835669058e-04, +2.8132440041510445e-04, +3.3353083951607435e-04,
-    -2.4825261865847690e-04, -1.9794634381363160e-04, +3.9311229941367708e-05, -4.9897117997649894e-04,
-    -1.5443445677522400e-03, +7.5998893573166741e-05, -2.3575006921677761e-04, -1.3955419835038783e-04,
-    +1.2182334428496934e-04, +3.1008411577525101e-04, +1.8892766427950690e-03, -4.1790533174455581e-04,
-    -2.1352997946129523e-05, +2.3120312600205910e-03, -5.9426290866520029e-04, -2.9477467679633553e-04,
-    +2.0244238810523301e-03, -3.9049065818324105e-04, -1.3461780995128017e-05, -5.4190336385043737e-03,
-    -5.1687042472613924e-04, -5.5227055113012832e-05, -1.5739677093835494e-03, -7.3769861099009658e-04,
-    -8.6639311417191468e-04, +1.2649478895334263e-03, +1.7326153382937244e-04, -4.8987743172185900e-04,
-    +2.9372140432733537e-03, +7.3082486864347825e-04, +1.3854975667336767e-04, +1.4911335413214151e-04,
-    +1.5498774537751591e-04, -2.2336653853620442e-05, +5.2280051561800695e-05, +1.6545933315504279e-04,
-    -7.7742403317285264e-07, +4.9409390114996002e-04, +1.4407628562048965e-05, -1.7528947586228043e-04,
-    +4.5948614453610812e-04, +3.6435504112002477e-04, -4.9744919190693575e-05, +5.1733167889438602e-04,
-    +4.5845577354297742e-04, -2.1579196660595772e-04, +2.6647083639790280e-04, -1.4638081497455035e-04,
-    -1.0447650626000077e-03, -7.7600021306198710e-04, -3.8351435678015067e-04, -1.3893585595748264e-03,
-    -1.7419484303701426e-03, +3.0499171771132766e-04, -4.0292005315240243e-04, -1.5471889805734357e-03,
-    +8.1437269692198925e-04, +4.1620499285229955e-04, -7.0898850407398765e-04, +4.2038278807999429e-04,
-    +9.7379623314219226e-04, +3.7864576411338561e-03, -4.7586358069374193e-04, -1.0186669962051775e-04,
-    +3.9040367023696573e-03, -2.3069222021373769e-04, +2.5232341853862606e-04, +1.2696948735199582e-03,
-    -2.6216622221333517e-04, +2.5053236779155245e-05, +2.2096670261296898e-03, -7.2806527688593287e-04,
-    -1.2943909163502254e-03, +6.6390349294225361e-04, +3.7878996713364442e-04, -4.8230250103499251e-04,
-    +4.5477146954073661e-04, +5.3068985844092727e-04, -5.8253776801665316e-05, +2.9164988632292868e-04,
-    +2.6040814337061405e-04, +2.9708305932030432e-05, +1.1495484160427734e-04, +2.9812626288487507e-04,
-    +1.1148445793571149e-04, +5.1997939820954786e-04, +2.5242169008242861e-04, +2.5830859339489075e-05,
-    +5.8137189394191335e-04, +1.2493774167689572e-04, -1.5710182508675677e-04, +4.8894028264256245e-04,
-    +1.7942126091167904e-04, -2.7595052263344955e-04, +2.4919636690082833e-04, -2.6621466315553404e-04,
-    -8.0732273663283022e-04, -2.7545737218075009e-04, -6.6480022054456070e-04, -8.6020580754630192e-04,
-    -1.4278696767315712e-03, +3.4309121026835087e-04, -3.7323169757058497e-04, -1.5426664229365446e-03,
-    +6.3489160786582089e-04, +3.8524053827083959e-04, -8.4466162680343394e-04, +9.2356869546607789e-04,
-    +1.6172260297887039e-03, +1.1552652127119394e-03, -6.6009389804361150e-05, +6.2216265792386415e-04,
-    +3.4778593218561882e-04, -1.4576808495891645e-04, +5.7580756210652800e-04, +1.9091122829356722e-03,
-    -4.3826799574427284e-04, -5.3747190162528342e-04, -3.6170083078968592e-03, +1.9005506618092016e-04,
-    +3.0880287245412338e-04, +1.7670352290621440e-03, +3.3283426308356877e-04, -4.5952768461309825e-04,
-    +6.5445844019190375e-05, +4.2711896594448237e-04, -1.1635085752127474e-04, +1.6604501522104534e-04,
-    +2.2964467612817429e-04, -1.5454946842637359e-04, +4.5928545167432368e-05, +1.7405562649130371e-04,
-    -8.2691821730014713e-06, +3.7247213393101769e-04, +2.1244733722621098e-04, +6.5157508972429293e-05,
-    +5.2624371255495159e-04, -2.9990664747711533e-05, -8.7294139054789528e-05, +3.2709845274670244e-04,
-    -3.7408793588755132e-04, -3.1302136313754079e-04, +3.6159404252197961e-04, -1.0506519041113761e-03,
-    -5.6617197217913209e-04, -9.4138903854960030e-06, -7.6690359608104052e-04, -6.0538789575126915e-04,
-    -8.6931111107053840e-04, -9.8645585701745067e-05, +4.2230778952915968e-04, -2.0663183485731846e-04,
-    +8.2885430165554545e-04, +8.1279667074797047e-04, +1.1503710760203435e-03, +6.1000397476717629e-04,
-    +5.6517826641322780e-04, -2.3107905753447019e-04, -6.2493348388366075e-05, +4.2652134271639516e-04,
-    -2.4354989836294265e-03, -3.5088974181979099e-04, +2.4295499253336019e-04, -1.1172036690193111e-03,
-    -3.9408026239856186e-04, -6.1453951479441976e-04, -2.9313901841776565e-03, +3.1025281022727065e-04,
-    +3.0528589742454128e-04, +8.2740549111376004e-04, +3.8033468315240928e-04, -2.4755979649379654e-04,
-    -9.1136899073014025e-05, +3.7072638614134491e-04, -9.0212698087380538e-06, +4.2599404045932888e-04,
-    -2.5437039035200220e-05, -1.3247661722624285e-04, +2.7304883615031031e-04, -1.4340601842917301e-05,
-    +2.1142921377376999e-04, +5.2916300149726773e-04, +4.9876367363326738e-04, +4.7585397709763402e-04,
-    +7.8730119733807211e-04, +6.5296094828412230e-04, +6.0663082968545612e-04, +1.0141003058521246e-03,
-    +1.0905048916898469e-04, +1.1273162621281358e-04, +9.2939498968533547e-04, -1.0727037526709860e-03,
-    -7.4056727840197804e-04, +1.0018750563205053e-04, -5.7276420741265532e-04, -9.0056094242347011e-04,
-    -4.3272692735163882e-04, +2.0660238032958595e-04, -9.0471261020973724e-05, +4.2331557909762788e-04,
-    +9.2143491890860942e-04, +8.9604174689792511e-04, +1.3404061145173098e-03, +3.4063907767812723e-04,
-    +4.0350113610560580e-04, +2.4313617298190628e-04, +3.9638791219092815e-04, +7.1036327305794452e-04,
-    -1.3904166159574417e-03, -5.5731941064700709e-04, -4.0300782020102752e-04, -4.0044617899741416e-03,
-    -3.2586249507437625e-04, -4.5277055658596462e-04, -3.4190605311911495e-03, +1.5349940033537095e-04,
-    -5.1041072759266113e-04, -8.7884356436203619e-04, -4.3320419810139099e-06, -6.5640958807633334e-04,
-    -2.6769820291457807e-04, +2.1895686495863054e-04, -3.7455937482005186e-05, +5.0591847268525384e-04,
-    -1.1590584509917151e-05, +3.6195767513508769e-04, +5.6465774354066305e-04, +9.7599423764714886e-05,
-    +6.6561258600027890e-04, +1.0081604032023983e-03, +1.9366488715289739e-04, +2.9587853441437811e-04,
-    +7.2723635605653042e-04, +2.6050117491217161e-04, +2.5126628117815529e-04, +8.4326130567503020e-04,
-    +2.6417771199378868e-05, -2.3271845169684551e-04, +2.2333105738164651e-04, -8.8360733968421198e-04,
-    -1.2412188398196453e-03, -1.1147726971874276e-03, -1.3169169562794131e-03, -1.5401540382716840e-03,
-    -1.6098530307068874e-03, -1.9148242431057288e-04, +1.1413608385341262e-04, +1.2486460418431426e-04,
-    +4.0397290083217546e-04, +9.7071015420681828e-04, +1.2994262318484333e-03, -3.3409758479411249e-04,
-    +5.5362525923489839e-04, +1.7373390717695123e-04, +5.3629787012017245e-04, +8.8827506638601084e-04,
-    -3.1860322210530001e-04, -4.5067663870920646e-04, +2.2126831676791314e-04, -5.4360797247492388e-03,
-    +2.9383528253286011e-04, -1.7070266356878193e-04, -1.5866120174782667e-03, +2.7369434622312428e-04,
-    -3.0289453504375730e-04, +7.0259941057130475e-04, -2.0503619556751468e-04, -1.2406454848811928e-03,
-    -7.9019475352704114e-04, +2.0125528895247361e-04, -1.7536684130198913e-04, +2.5983815368912032e-04,
-    -9.2367989531014235e-05, +1.7237825485307034e-04, +5.7017946413273244e-04, -3.7193416735535400e-04,
-    +3.9469419216187356e-04, +9.2589151289310036e-04, +7.8544741366809629e-05, +3.3144741329848231e-04,
-    +8.0657262749289573e-04, +2.7279142600887215e-04, +1.1895032700368345e-04, +8.1237294695012609e-05,
-    +1.1140977730535492e-04, -2.1577338056842304e-04, -1.1973371111720108e-03, -2.6645443174945228e-04,
-    -6.3496885564231999e-04, -1.2741617109514362e-03, -8.0045037490849040e-04, -7.2807890724396068e-04,
-    -7.8418223535911991e-04, -6.6769046958805396e-04, -4.7667367799762337e-04, -2.3088518746776956e-04,
-    +6.1490924296211925e-05, +2.5873633447434614e-04, +8.7300116041864493e-04, -3.5720723387469366e-04,
-    -7.4512507884845312e-05, +2.1434132972148463e-04, +2.8914934758219235e-04, +7.6605311922880266e-04,
-    +1.8621263664248639e-03, +3.2141904767018247e-05, +1.3372502754488319e-04, -2.9024022266681739e-03,
-    +1.1872036099484150e-04, -4.1048594199894433e-04, -5.7940901322349198e-04, +3.5177886448033749e-04,
-    +5.2128565975467778e-04, +2.1042430733669479e-03, +3.5251654441129917e-04, -1.5813368047399700e-04,
-    +1.1523399779045716e-03, +4.9989476280050533e-05, +5.9432252125475577e-05, +2.5015928748148877e-04,
-    -3.1926009481393126e-04, -8.6017260853190014e-05, +3.1825028440042504e-04, -3.1544230724413154e-04,
-    +4.3580292926622137e-04, +7.5904711759597376e-04, -6.7641824224548769e-04, +5.8762438929035930e-05,
-    -2.5413315683902252e-05, +1.0275441618757169e-03, +8.9553874448688986e-04, -1.3210508994912029e-04,
-    +1.0565321664096057e-03, +7.8395352124509276e-04, -1.4599418716448576e-03, -2.4656614730445166e-04,
-    +5.2227443957694331e-05, -1.1093991547730794e-03, -2.8618939149682406e-04, +2.6543670860517001e-04,
-    -2.2699764538723212e-04, -1.3464918818542795e-03, -6.1569290170841674e-04, -5.3208116190917357e-04,
-    -8.6818203307471550e-04, +5.1996127100349676e-04, +3.6802073833631281e-04, -1.5489394890936086e-04,
-    +8.1347740928897983e-04, +1.2906745224284899e-03, +2.7323980970349265e-05, +1.2636523807143724e-03,
-    +2.2627448584549925e-03, +1.1374386076379931e-04, +7.5594415750585204e-04, -8.1093921210161448e-04,
-    -4.5827048379887427e-04, -7.1034886463573136e-04, +1.7487978540289338e-03, -4.3650391739426562e-04,
-    +5.8653087138889370e-04, +2.7967784927364222e-03, -4.7025773686049110e-04, +3.9307122855592364e-04,
-    +2.4844591334317865e-03, -8.6469083856837467e-04, +1.8244018025533954e-04, +2.0017425712549463e-04,
-    -8.7851328740957578e-04, +4.5776803894036716e-05, -1.5466051903345111e-04, -6.9626378858412413e-04,
-    -1.7364622882559162e-04, -6.1589575852996127e-04, -1.3111012375322621e-04, +8.4805329357202301e-04,
-    +1.2030472339921797e-04, +2.5446066881230401e-04, +9.6861303358661548e-04, -2.7605421853324892e-04,
-    +1.0674389207936375e-04, -6.3442539924240835e-05, -1.0847618130394691e-03, -1.8222637066272777e-04,
-    +4.5456657420874359e-04, +1.3436675402907000e-04, -8.9590954429689745e-04, -2.5386075666025514e-04,
-    -9.2670310822817368e-04, -6.5612931401471753e-04, +5.3437734761703525e-04, -3.0710459082042003e-05,
-    -3.5589573905482266e-04, +9.2608178473729504e-04, +3.6878515199639339e-04, -1.7062623027554514e-04,
-    +6.6696770757805645e-04, +1.7204953681107377e-03, -3.2492424135074769e-04, +4.3402598223225836e-04,
-    +1.7331643838493789e-03, -3.5632568331011650e-04, -5.8645086775654064e-04, -4.0946707639537305e-04,
-    -6.1035122764424457e-04, -7.3192397096844843e-04, +1.5601988035718176e-04, -6.3485084756570442e-04,
-    +6.6709512844182449e-04, +1.8623128393447292e-03, -9.0922320264134101e-04, +5.5270567861127114e-04,
-    +2.0407972766867586e-03, -1.2647725296971943e-03, -5.9562450553330587e-04, -8.6967671339315369e-04,
-    -1.3525248606572784e-03, -7.1342159771038249e-04, -1.2131310439872666e-03, -1.3169552725498580e-04,
-    +6.8281889060488928e-04, +1.1517871721623190e-05, -8.7028482886517916e-05, +5.7268883961935453e-04,
-    -2.4483013739673762e-04, +1.4392827875926351e-04, +1.0535995610119805e-03, -1.1392069498237902e-03,
-    -2.6550276173522924e-04, +3.1719506271654901e-04, -1.4250044644309693e-03, -9.6879119076309650e-04,
-    -1.3618582865274049e-04, -6.2109412116709208e-04, -6.4500838963781027e-04, +3.8893690371568593e-04,
-    -1.2965342483899878e-04, -4.1141011469423032e-04, +3.5405290408107589e-04, -2.3081057089112546e-05,
-    -7.6447233872693440e-04, +3.3565538269471259e-04, +3.7942305765817494e-04, -2.6949301742826363e-04,
-    +1.2901860942271398e-04, +1.4896700720255899e-03, -1.5455582153804862e-04, -4.3265989525264245e-05,
-    +2.6491129184481859e-03, -2.0973038850640189e-04, -2.1523809038618525e-04, +2.7366855449788216e-03,
-    -2.4103679353990900e-04, -1.1358275271880199e-03, +2.4884590070967439e-03, +1.5021248978364142e-04,
-    +5.0245731949971585e-04, +2.1903673454176189e-03, -3.6183533009210368e-04, -4.1835561219338851e-04,
-    +8.2589552358094433e-04, -7.7027184451569685e-04, -5.4040738721586952e-04, -1.4853860391470899e-04,
-    -7.8513230148679052e-04, -2.9570161753765187e-04, -9.8831835974977399e-04, -5.8353492105249645e-04,
-    +3.0636046200979751e-05, -6.8558143416643630e-04, -3.0561305708353049e-05, +9.1749926110847426e-04,
-    +1.2631482596594531e-04, +7.1275110686008195e-04, +1.3319885097521252e-03, -4.4270950201099547e-05,
-    +7.1425527346223792e-05, +5.8781224798005213e-04, -4.9355750258484184e-04, -1.1642604865846108e-03,
-    -1.2447916059570816e-04, -7.1559134850725052e-04, -1.2017869990807587e-03, -7.6842242278038581e-05,
-    -5.0009566090206982e-04, -9.6605554825956010e-04, +2.5381382398251898e-05, -6.5855240536722199e-05,
-    -5.8873528791957290e-04, -3.0191956832342667e-04, +5.2088196357771475e-04, -1.3811344288519907e-04,
-    -3.7210145909235176e-04, +8.8631336772625766e-04, +2.1170397688587443e-04, +2.4580021824844667e-04,
-    +3.9870478657188201e-03, -2.4217776598238358e-04, -4.7082360048563641e-04, +1.2686850001815920e-03,
-    +2.5927473433291353e-04, -3.0328035403452160e-04, -1.8552864123064863e-03, +4.7730060510101015e-04,
-    -2.9923818465015905e-04, +3.1222027897737409e-03, +3.1082372522864466e-04, -3.8286861667268565e-04,
-    +8.0773055935289950e-04, -2.4433011609451206e-04, -1.1191126790352365e-03, -6.9829736703923740e-04,
-    -2.1108250529665621e-04, -3.7379579324717211e-04, -2.8767236805044856e-04, +3.7704961302530766e-05,
-    -7.8210033386583874e-05, -3.5114352195552377e-04, +4.4216586882723309e-04, +3.5804678806105488e-04,
-    -1.6016021682662465e-04, +1.0954625764367453e-03, +4.4040254367018933e-04, -2.1399222550673244e-04,
-    +5.0840317270946776e-04, -1.8991253738720646e-04, -6.0962504147640546e-04, -5.1752682402317579e-04,
-    -5.2906674509402068e-04, -7.0115672185799653e-04, -7.2813538357125753e-04, -5.3170602505771172e-04,
-    -4.2856965753809223e-04, -6.2987707357500030e-04, -3.3436252654666195e-04, -9.1102829220325566e-05,
-    -6.5192030468004536e-04, -8.3432606159568681e-04, -7.5263716400187763e-04, +1.5232011197564854e-04,
-    -8.0454107314703333e-04, -2.5751741785750865e-04, +1.2485247556776453e-04, -2.3503958641965680e-04,
-    +1.8419731140985110e-04, +2.0224975221851931e-05, +3.3804646081887367e-04, -2.8214510678271488e-03,
-    +1.2407250107722691e-04, -2.7507835206341076e-04, -1.6575128035547359e-03, +2.8802346751268459e-04,
-    -3.5811801284111472e-04, +1.4269593341510616e-03, +3.1125448400841420e-04, -2.4391503304474669e-04,
-    -6.2744894915614183e-05, +1.5101126888992443e-04, -4.2663909448812976e-04, -6.3016262272077141e-04,
-    -2.7395798550733976e-05, -5.7169593962744930e-04, -1.0500841200501642e-05, -1.9247712067841323e-04,
-    -6.2308035663230206e-04, +3.6434339193976931e-04, +1.5842721191128073e-04, -3.9891803961827931e-04,
-    +2.2394225224344887e-04, +6.2173090294090274e-04, -3.5973953553637027e-04, +1.0517950234352575e-04,
-    +2.6384877073723983e-04, -7.3017053940086201e-04, -6.7599819454101245e-04, -4.1440304248647347e-04,
-    -1.0897062252767189e-03, -9.6686106452553158e-04, -4.0786516502787807e-04, -1.0289371711038396e-03,
-    -7.2791116089725649e-04, -6.2398485875777310e-05, -6.4918638098230359e-04, -5.3091043060144014e-04,
-    +4.5353829565378636e-04, -1.8804140630702485e-04, -1.0108677373317511e-03, +2.5039703730416087e-04,
-    +5.4145241682842892e-05, -2.7037714265860519e-03, +1.1017475513920755e-04, +5.7608982304249484e-04,
-    -2.4877678624442277e-03, -1.1705554638467300e-04, +2.8421188066679592e-04, -8.5932118482324560e-04,
-    -2.1573387475301588e-05, -2.2200353868179432e-04, -1.7878684096097588e-03, -8.5410322012825459e-05,
-    -4.0886786316270390e-04, -9.8489022161445117e-04, +1.6324163896955178e-04, +3.2157139856696564e-06,
-    +1.4280131782584376e-03, +2.0574387485019875e-04, +1.4074931306539928e-04, +1.3267669648733605e-03,
-    -2.3105885232498963e-04, +2.2142003772754963e-04, +1.7259727425273906e-04, -3.2274081729263571e-04,
-    -6.5630263361271220e-04, -4.3751698673878166e-04, +1.3425573034715394e-04, +1.2591102697349671e-04,
-    +7.4387498302133854e-04, +7.1967099492139923e-04, +4.2768194297309323e-04, +8.6294956356988424e-04,
-    +5.2644517367863143e-04, +5.0435443000209365e-04, +1.6937263952807025e-04, +3.3436484132989266e-04,
-    +2.0225495782859925e-04, -3.5979683394795942e-04, -1.8802009353688744e-04, -1.2358348831028783e-03,
-    -2.3806133511033267e-03, -1.0897247116217259e-05, -5.8897603186276000e-04, -7.8672510529553081e-04,
-    +4.5171505961294516e-04, +1.4512978652972128e-03, +2.4580928460790916e-03, +3.7489526437795760e-04,
-    +2.6515811606891439e-03, +1.8951834229777513e-03, -3.0158101419836789e-04, +7.2449186597333586e-04,
-    -4.5683463058095213e-04, -4.2179131324266610e-04, -2.7993186264119533e-05, -3.0206753560140464e-03,
-};
-
-const double ZENKESHI_MEAN[] = {
-    +5.7691907899960987e-04, +2.9712451691211918e-04, -1.9021845848940495e-03, +1.0733715297358940e-04,
-    +2.4038423440040285e-04, -2.4701460517290537e-03, +3.2497325027460778e-04, -2.0582850128565195e-04,
-    -2.6073100675820882e-03, +1.1159972755249556e-03, +6.5187880966412952e-04, +1.9951013875324410e-03,
-    +1.5223887288483807e-03, +2.3711363181957222e-03, -9.5900708093354882e-04, +4.7229268113620307e-04,
-    +1.1794479273294926e-03, -7.1082828932014135e-04, -2.4216039692861202e-04, +2.4888868818487091e-04,
-    -2.6044404568792445e-03, +4.7740317632806423e-05, +1.1274367552301448e-03, -2.1984288060479355e-03,
-    +4.9024670790816704e-04, +1.1150113209324743e-03, +1.0198294230889119e-03, +7.0092669329285177e-04,
-    +1.1364158265534531e-03, +1.6060107143069961e-03, +5.4249660261506685e-04, +9.4317524177990586e-04,
-    -1.6811471384804574e-03, +6.2747678593692163e-04, +1.2392222222802340e-03, -1.7920684625397378e-03,
-    +4.2507579614901826e-04, +1.1869837935805146e-03, -3.6939947004983664e-04, +4.3571856026983441e-04,
-    +1.2168110573397676e-03, +5.1191374452515183e-04, +3.7290846477831661e-04, +9.8445917802464237e-04,
-    -8.5684196013202445e-04, -2.3530184234702154e-05, +4.9952109028818958e-05, -1.8910968140322989e-03,
-    +3.1913544715856870e-04, +5.5523418459026705e-04, +1.4736071326466602e-04, +3.6527991128344284e-04,
-    +1.8129867300153583e-04, -1.3935060202057272e-03, +2.2627457952450005e-04, -1.1283811227671003e-04,
-    -5.5892849652100203e-03, +3.6850938952148732e-04, -3.9272058058493010e-05, -3.9428429290794048e-03,
-    +4.0176865265736776e-04, +1.8685684572922651e-04, -2.5563816572393492e-03, -6.6627644175649591e-06,
-    -4.4593310544613724e-05, -1.8784192540836412e-03, -1.2384187518643501e-04, -7.1455840584704029e-05,
-    +1.4967109480200062e-04, -2.4583371162561894e-04, -1.2800336677150432e-04, -5.7767733324370300e-04,
-    -1.9201350485268813e-04, -1.3912130967278890e-04, +2.9362954312282628e-04, -1.8025823572653246e-04,
-    -1.2732974657223822e-04, +1.2053638042484297e-04, -1.7571386705463626e-04, -6.7530711403860556e-05,
-    +6.8898625617113990e-04, -4.7132603668674749e-05, -4.8014672596195337e-05, -2.1240623470284705e-03,
-    -1.9089446785484738e-04, -1.8292721694079917e-04, -3.6805309744765216e-03, -7.4948450350995362e-05,
-    -6.5177434696464957e-06, -1.9227527390043857e-03, +1.9643920829858535e-04, +6.4812430906088358e-04,
-    -2.7453717789609603e-05, -3.7022184661737174e-05, +1.2352577939453847e-04, -8.3788431506710663e-04,
-    +1.1246968972660427e-05, -2.5962243213817866e-05, -1.5378799306857945e-03, -1.0362860320970282e-05,
-    -5.5206713665092034e-04, -7.6604740439818768e-03, +1.1973459306657610e-04, -1.4223652831459084e-04,
-    -6.2653780467587100e-03, +2.5328253002379001e-04, +5.8829150044777232e-04, +1.3239934981656239e-04,
-    +2.3031046056691724e-04, +5.3035118864370372e-04, +4.4972727152337461e-04, -1.0819596486565130e-04,
-    -2.1054143703603662e-05, -1.8188763955600854e-03, -2.6984711361729307e-04, -8.1758150733742693e-05,
-    -6.3651007923139213e-04, -2.8679061426305685e-04, +1.8908877326331033e-04, -1.8207006319525417e-03,
-    -8.8277129987718013e-05, +5.7435429421024320e-04, +2.0981737118100029e-03, -1.7076329748237569e-04,
-    +6.5635154060190219e-06, +1.2334659969389418e-03, -1.8881507834902543e-04, -3.2443768747452941e-04,
-    +1.1004126586127028e-03, +4.4123867767780136e-05, -5.2599729774894624e-05, -5.7466142160023722e-04,
-    +1.0099796135375864e-04, +2.6479046885085819e-04, -6.4694105847162701e-04, +9.5467174894477806e-05,
-    +2.8351607098445447e-04, +2.7844878848651868e-03, +3.4487985498009419e-04, +6.5102853432819985e-04,
-    +2.5582843664450372e-03, +1.4176861939571532e-04, +3.9327664581481972e-04, -1.0934922601682476e-03,
-    +2.5934920716407222e-04, +2.9669253581402074e-04, +7.0886162410386524e-04, +5.3548364762287038e-04,
-    +4.7927868504163689e-04, -2.2682554029143675e-03, +2.4512388403844952e-04, +8.0660729227993816e-05,
-    -8.7565476214721460e-04, +1.9115628531524522e-04, +9.2275558750701706e-05, +1.0580043073426003e-03,
-    +1.1772201407270679e-04, +7.8425629171867541e-05, -3.0863131152122680e-04, -2.1558394919847664e-04,
-    -3.1781030205588114e-04, -1.5398631924506950e-03, -4.3470962375850413e-04, -4.6444043755245222e-04,
-    -1.0118325082533847e-03, -5.9790858177510885e-04, -4.4718395447427634e-04, -1.0249433856519424e-03,
-    -2.8830427167632865e-04, +1.9920135877971943e-04, +3.9575585583452363e-03, +1.8120899475806181e-05,
-    +2.7721041318954281e-04, +1.2282830553345819e-03, +9.5253173345249875e-05, +1.4039257346867509e-04,
-    +7.1254185213650548e-04, +1.8008844971053217e-04, -2.3935966889905103e-05, +9.8471327353685041e-04,
-    +1.2246092550309847e-04, -1.0170253097095026e-04, +2.8840686815227029e-03, -5.3875657460071948e-05,
-    -1.6965466273180746e-04, +9.6339719815246552e-05, +1.0597721682114541e-04, -1.5266572562963818e-04,
-    -3.3513003983605049e-03, +1.5420610585843382e-05, +1.7731923867320170e-04, -5.1307559537134423e-03,
-    +1.0816333794148377e-04, +1.7256641569967653e-04, +1.0839701123081726e-03, +1.3925364462023161e-04,
-    -1.6845524152362602e-04, -1.1220621215217526e-03, -1.1429128132174182e-04, -5.7090264060583734e-04,
-    -3.5152789017541459e-03, -2.2851731898133444e-05, -3.5987911676925877e-04, -7.1107096850745973e-04,
-    +9.4298808202093951e-05, -1.0455310440336493e-04, -1.2531915235508429e-03, -1.4272634580863631e-04,
-    -2.1192983636605676e-04, -1.2470896978128024e-03, -3.9075695535496899e-04, -4.1459401292812782e-04,
-    -8.5871217240414399e-04, -6.8459002324661612e-04, -8.0839091296561866e-04, -1.1880751159116395e-03,
-    -4.2761784772027016e-04, -4.8669539361919436e-04, -1.6755146932999316e-04, -9.6546325179688955e-05,
-    -3.3015208061009613e-04, -1.0414357120214553e-03, +1.2047116984388472e-04, +2.1684747595533788e-04,
-    -1.4243037867794402e-03, +3.2966007857523135e-04, +1.1188489428688757e-04, +2.8990758644201702e-04,
-    +3.4695533647066413e-04, -6.5971549547527854e-05, +6.2150800259939498e-05, +1.8266789036576803e-04,
-    -2.3920971870456618e-04, +4.1877469469883254e-04, +6.2677124938117384e-05, -2.0135885441280551e-04,
-    -3.0142679909705649e-03, -1.8140835228582839e-04, +4.9003737763986145e-05, -2.9904347444424189e-03,
-    +5.7530241268542918e-05, +4.0289743551609403e-05, +3.8002468154968769e-04, +2.9298358941774792e-04,
-    +6.3950650122260744e-04, -1.1424330903819864e-03, -1.8779566671113054e-04, -6.6051363634005535e-04,
-    -4.8891228143580438e-03, +1.4017101285813130e-04, -1.5176448811317629e-04, +1.1279795581068495e-03,
-    +3.6732560212068523e-04, +3.1604988996527915e-04, -1.1182377337681320e-03, +2.4537668614842692e-04,
-    +1.6536444952483328e-04, -1.1666222411701394e-03, -2.7649769882345770e-05, -1.6707987568896605e-05,
-    -1.0130535622736247e-03, -4.1671770453349924e-04, -5.6864375509827825e-04, -8.6124491381984320e-04,
-    -3.0080168246650817e-04, -5.9648969878472200e-04, -1.0641536101357707e-04, -5.2340944181747262e-05,
-    -6.8312472446629323e-05, -1.1056132504691063e-03, +4.8407995927811229e-04, +8.1308871565320088e-04,
-    -3.6281698523165268e-04, +5.3082406441187237e-04, +1.1480115748932365e-03, -1.0074473171726717e-03,
-    +4.7194272638857542e-04, +3.9615911370975303e-04, -2.2733206163179955e-03, +6.3053491691878339e-04,
-    +2.0621239111232571e-04, -1.3514460976235051e-03, +2.4426504296775416e-04, +2.2770819204988107e-04,
-    -2.5121749250906029e-03, -1.9221574463614753e-04, +1.0022368719923495e-04, -3.6234265499572706e-03,
-    +1.4788569003610231e-04, -5.0308178743402158e-04, -1.9647538599688072e-03, +1.5283425341248148e-04,
-    +2.2696429486360038e-04, -4.1911469166267057e-03, -1.3296519787405869e-04, -7.4531577469289596e-04,
-    -6.9448192074179069e-04, -2.3530249306660304e-05, -5.0901271915033204e-04, +4.4039904618568631e-04,
-    +1.2724156965187452e-04, -2.7790841287139749e-04, -7.9797198732049605e-04, +1.5251768355318900e-04,
-    -2.4889340905298048e-04, -1.2688883391437401e-03, +2.8481726788102675e-04, -6.8689497795389184e-05,
-    -9.8398815867039202e-04, -1.1812859145435010e-04, -2.2814495284683480e-04, -7.2062266062835375e-04,
-    -3.3420446053295661e-04, -6.8560853667003316e-04, -9.6790143743248028e-04, -3.4532880582262548e-04,
-    -9.4329548549719954e-04, -2.3912499902477543e-03, +6.2259173685660894e-05, -3.6136512812859860e-04,
-    -1.1792118342091532e-03, +2.5480577095168214e-04, +2.5161613448638137e-04, -1.0428988988712817e-03,
-    +3.2315956125195388e-04, +5.1221352154287168e-04, -1.6993152435008374e-03, +5.9657512616466683e-04,
-    +1.1746155407079098e-03, -1.7894541427243189e-04, +1.0596542008875047e-03, +2.0610799879705625e-03,
-    -3.2958706552006659e-05, +6.5563735753802998e-05, +3.4712940650697995e-05, -2.5371388998574767e-03,
-    +3.8601260205350045e-04, +9.5878319803620468e-04, -2.7422639087283760e-03, +4.2575169178296613e-04,
-    +5.7932718816405945e-04, -2.2861727288809594e-03, +1.6342588933852486e-04, +8.1077238745498126e-05,
-    +8.0131188812260351e-05, +1.3219668928940998e-04, -1.2945041213009836e-04, -5.4367297215799067e-05,
-    +1.5898403534130606e-04, -3.0452837479494452e-04, -1.0436189945906180e-03, -5.7754818270858145e-05,
-    -6.4811510170552171e-04, -1.3198631119104097e-03, +3.1374162778434266e-04, -1.2256411457178414e-04,
-    -8.1691417407853584e-04, +3.8095165427952870e-04, +1.6682947585483512e-04, -1.0063421214438755e-03,
-    +2.0785015962388229e-04, -2.1483872981271419e-04, +5.1320006761701605e-04, -1.3006251155113006e-04,
-    -8.7660195519690927e-04, -7.7779515881391001e-04, -2.0462986349487517e-04, -8.0315401144426062e-04,
-    -1.5156947177841333e-03, -8.9090930451714566e-05, -6.6822616923534184e-04, -1.5799328662949336e-03,
-    +2.8077395591736563e-05, -3.3285658226548667e-04, -2.6052013719751951e-03, +9.2458051632614581e-05,
-    +4.0899156951229479e-04, -1.8156260863859057e-03, +1.0895676234474877e-03, +1.9258008075121460e-03,
-    +2.6926879926807844e-03, +2.6458913299785201e-04, +2.8070831454003547e-04, -2.7412938845360851e-03,
-    +2.7787316892209044e-04, +1.2902010104297041e-03, +2.7327876013317339e-03, +5.4435033312116117e-04,
-    +7.4643156203227650e-04, -6.4406517306118500e-03, -4.4337502514462353e-05, -8.7660672712842338e-04,
-    -2.7082633308443387e-03, +2.7657911332133675e-05, -4.4647945063464240e-04, -9.8529726540843719e-04,
-    -3.1087337430523636e-05, -7.9223269674585060e-04, -1.4935533470428199e-03, -2.3911622214224792e-04,
-    -1.0271409300629272e-03, -2.2828917752287922e-03, +8.2177873523693953e-05, -3.8996683530625835e-04,
-    -1.0929824995817485e-03, +5.5616851184352265e-04, +4.3088104912744580e-04, -2.0982940087505559e-04,
-    +3.2777183087083766e-04, -1.5521184185848718e-04, -8.2473056138806800e-05, -1.1678290880417735e-04,
-    -7.0192854821254686e-04, -3.0026955732193018e-04, -2.1841798469970304e-04, -7.4453724603988202e-04,
-    -1.1851709657712058e-03, -2.1703241090033351e-04, -9.9821085358025728e-04, -1.4728443646468811e-03,
-    -2.6280113154705792e-04, -1.1702844625670987e-03, -2.8228236632809401e-03, -1.8393278037732465e-04,
-    -5.2637316004096931e-04, -1.5350108559264747e-03, +1.0199921138376385e-03, -4.8052045731730708e-04,
-    -1.6193651636955964e-03, +1.7609010684129975e-04, +2.3270163140297123e-03, -3.9775311135390240e-03,
-    +3.6091525916050882e-04, +1.1291978934623750e-03, -2.6893382672457675e-03, +6.0049025970266374e-04,
-    +1.0187364346438005e-03, -8.8750632533096663e-04, -1.6203919062511405e-04, -8.0406404903464836e-04,
-    -3.5429771981983615e-03, -8.2108081156453242e-05, -7.5863276022815839e-04, -2.2007302955213705e-03,
-    +1.9311800128252122e-05, -6.6808248576316262e-04, -1.6651894927227748e-03, +1.7479011163536466e-04,
-    -2.3162829264663704e-04, -1.4869139052487860e-03, +1.5301556546569572e-04, -4.7224652418060996e-05,
-    -8.8726961004725207e-04, +2.3552381373200074e-04, +2.2919095279045148e-04, -4.4653528557655076e-04,
-    +2.8599232340291707e-04, +2.0542307457230706e-04, +3.1107900217178762e-04, -5.5303849162921358e-05,
-    -3.9776516203595351e-04, -4.3400037567116429e-04, -6.4648975542087360e-05, -4.3248823441751716e-04,
-    -1.2352075491115775e-03, -2.4433061759747041e-04, -8.4540020352955438e-04, -1.4929114078846789e-03,
-    -3.8224491717828678e-04, -1.1629106793323177e-03, -2.6928915727184193e-03, -2.9809386399371612e-04,
-    -6.3475106746812724e-04, -1.5542122779672186e-03, +6.7175948965202473e-04, +8.6856841790092308e-04,
-    +6.0699736341127976e-04, +4.1852449296021570e-04, +1.0129530913597939e-03, +1.4307672200200286e-03,
-    +2.7842718425505342e-04, +1.3791205313416757e-03, -5.0368117260069694e-04, +4.6630654863389671e-04,
-    +3.6026888818791147e-04, -4.4046757016084695e-03, +1.0267676991558360e-04, -4.1272396924094845e-04,
-    -4.0185561254743631e-03, +2.6651168503065301e-04, -8.3473999563474070e-05, -9.4873130679704791e-04,
-    +4.7869844664620321e-04, +2.2151948956034305e-04, -7.6146210455581666e-04, +6.5818399215302457e-04,
-    +6.2845537024635515e-04, -7.5700610585738607e-04, +2.6089978985765079e-04, +2.1018427304304136e-04,
-    +1.6750677521991907e-04, -5.6723743363571428e-05, -2.8453915006605436e-04, -5.3805331565456762e-04,
-    -1.0330941624225777e-04, -1.0451322701967895e-03, -8.3912324114096646e-04, -1.2839998265064392e-04,
-    -9.0045101184269927e-04, -3.9650544731589376e-04, +3.3281059852209517e-04, +5.2275949716428503e-04,
-    -1.1300885356093893e-03, +1.2553526788463998e-04, -2.6509467423800354e-04, -1.5315523684699978e-03,
-    -1.8719397774538451e-05, -5.3497885649116583e-04, -1.6280683490252973e-03, -9.8759285266714795e-06,
-    -2.4737681470743438e-04, -1.0290301205623509e-03, +4.9964520851407119e-04, +6.6408675156427114e-04,
-    +6.4298944474371685e-04, +2.9745259352836244e-04, +2.1457941535299338e-04, -1.3636552216271889e-03,
-    +1.2462267901505844e-04, +4.0111162763027458e-04, -1.9385223997936548e-03, +6.2538335484341775e-04,
-    +5.6353200470530445e-04, -8.0612115721272605e-05, +4.2919571047829675e-04, -3.2799134273366164e-05,
-    -1.3090550072107825e-03, +3.2970147075987472e-04, -9.3054625539628919e-05, +4.1324427137314233e-04,
-    +3.4889908293545896e-04, -1.7192131899615833e-04, -1.6371847022262930e-03, +2.5176450223050168e-04,
-    -5.7530720643360117e-05, -8.5632456324348895e-04, +1.7962062665700230e-04, +2.0931681497297542e-04,
-    +8.3224501626271981e-04, -1.5418366602660858e-04, -1.9301185593929837e-04, +1.5135666462498360e-03,
-    -2.9362893580306247e-04, -4.4154994067925564e-04, +2.5138149892839847e-03, -3.7819411990648420e-04,
-    -5.6824237805082074e-04, +1.6532176084751703e-05, -2.4635678317955033e-04, -4.8997284699374693e-04,
-    -1.2651081684383325e-03, -2.2868559587351918e-04, -6.5225625743464439e-04, -1.5830002717595825e-03,
-    -1.6101816587950812e-04, -6.2750188903115916e-04, -1.0589205222076247e-03, -4.2269054416059811e-05,
-    -4.8082929728612985e-04, -7.6839730800789619e-04, +3.2171071196982002e-04, +1.8335088800405970e-04,
-    +1.6253516977694711e-04, +9.8087872554317222e-05, +1.7858618935691543e-04, -1.3031359908362160e-03,
-    +3.3411235762951407e-04, +2.4906419800767922e-04, -1.9850211134406254e-03, +6.2851316491059660e-04,
-    +7.7429252027101138e-04, -1.7151078042717925e-04, +4.2634393361557470e-04, -1.7392661665144909e-04,
-    +1.3015377149480956e-04, +2.3905118305694097e-04, -6.3823405787313066e-04, -1.3982556331186005e-03,
-    +9.8231283208564932e-05, -8.4452190581141577e-04, -4.2787397727524889e-03, +1.7429255705120413e-05,
-    -6.6683687345750345e-04, +5.8218880395577671e-04, -2.8598061173028794e-05, -2.0853847793148803e-04,
-    +1.4952997559060386e-03, -1.9254881126566591e-04, -2.9526243263591827e-04, +1.4062848351630811e-03,
-    -1.2742781976715132e-04, -1.0788738303476595e-04, +2.2032478958588873e-03, -2.6673492368331362e-04,
-    -6.0326743042454908e-04, -2.6133100873704381e-04, -2.8842019493079433e-04, -8.7041945781786737e-04,
-    -1.0535370010678895e-03, -1.1689806305325213e-04, -7.5246862203665662e-04, -1.1265086617699999e-03,
-    +9.3821288205339377e-05, -4.9833807283336995e-04, -9.2711926555585217e-04, +2.0768686254926029e-04,
-    -3.9353437235879627e-04, -2.5673559965943061e-03, +6.7890269222865710e-04, +6.1225468056640012e-04,
-    +1.2890617305536104e-03, +5.4395926565307723e-04, +4.3310846534977843e-04, -1.3033095689994375e-03,
-    +3.9783819167854947e-04, +9.3880803377801127e-04, +1.4979377755103484e-03, +8.7424120509973927e-04,
-    +1.1367227144774830e-03, -5.0788100092719372e-04, +4.3116337657921863e-04, -3.1860601345717630e-05,
-    -4.9486838841906388e-03, +1.9508954630752156e-04, -7.0856037336718624e-04, -1.8732193272647780e-03,
-    -3.8204427492268265e-05, -9.0856120181447562e-04, -2.5875069497679399e-03, -9.6729332261279120e-05,
-    -7.7449225029833089e-04, +5.1435855554746645e-04, -1.4628906935609644e-04, -4.3793655131750856e-04,
-    +1.0881616666217524e-03, -1.7112202732393308e-04, -2.6700346186885667e-04, +9.6123123457219554e-04,
-    -8.5418324812854796e-05, -1.4672291469328911e-04, +1.2157706646031053e-03, -7.1576294488724537e-05,
-    -3.9552713911918054e-04, +3.5288081194069038e-04, -5.7856941063746741e-05, -7.4160467521614979e-04,
-    -1.0595832466413189e-03, +5.3646383167669537e-05, -7.3343826052258267e-04, -1.0053699756539134e-03,
-    +3.1827633090764768e-04, -5.4967515708051441e-04, -9.9388328748433070e-04, +4.6749760086684341e-04,
-    -6.4739549461939171e-04, -2.1269886885797828e-03, +8.9999000732398661e-04, +1.0982229938713546e-03,
-    +1.1639004014617445e-03, +3.4137463278740383e-04, +3.6602438234921387e-04, -1.8304447571982716e-03,
-    +2.1369725538170577e-04, +3.7932608674915059e-04, -3.3298376618677637e-04, +4.4696631496009493e-04,
-    +5.2003107896050221e-04, -3.8679060237936354e-03, +3.2408525605184818e-04, +1.3298163909880535e-05,
-    -1.5461495128517057e-03, +3.5527041549723210e-05, -5.7159542028151396e-04, -2.5593423921393154e-03,
-    -6.1461695719943949e-05, -5.5213599250065809e-04, -1.3843411792955772e-03, +6.1141119831023010e-05,
-    -2.1184432002712095e-04, -8.3826111663551879e-05, -1.7340459553191856e-04, -2.7525579744762054e-04,
-    -1.0316807483452346e-03, -3.9273990909057031e-04, -5.0368585461310698e-04, -1.5826546936197881e-03,
-    -1.7249986648700541e-04, -1.9699715910844625e-04, +3.1066112540035492e-04, -2.1976037178399886e-05,
-    -2.8351815002501820e-04, +6.3325095402301578e-04, +2.7923810114249602e-05, -4.7210220504584002e-04,
-    -8.6522694652843080e-04, -6.5189038323374139e-05, -7.3401991306766925e-04, -1.8651319232292410e-03,
-    -3.7487908909219083e-05, -9.6477154174855412e-04, -2.0054093717285170e-03, +1.9152464283719143e-04,
-    -3.1461947645537193e-04, -2.9954059085950200e-03, +4.4763797715725184e-04, +7.4543404489343023e-04,
-    -3.4485567602826664e-03, +2.6198872611675776e-04, +3.2934429539559419e-04, +1.0608220062461463e-03,
-    +2.0137179315774675e-04, +2.7966759050036727e-06, -3.2532213633066302e-03, +5.9128845343101911e-04,
-    +7.5906084161700838e-04, -4.3032315319733762e-03, +6.0430317680306529e-04, +9.1798317188785696e-04,
-    -5.1271393244692017e-03, +8.1230202342849297e-04, +1.3098497017104251e-03, -7.2221872561718118e-03,
-    +7.3853902042826788e-04, +2.6515529145575895e-03, -2.3197422999950827e-03, +6.7692778289333308e-04,
-    +1.3173062459252861e-03, -1.7850941008579946e-03, +5.5916487265578684e-04, +1.9040808275581416e-03,
-    -2.2078073595702642e-03, +4.2438797943219331e-04, +1.6676283949000547e-03, -2.7107807968035770e-03,
-    +9.1690623194183119e-04, +1.8529882839241573e-03, +9.7917478212309998e-04, +1.2828824810378230e-03,
-    +1.7250420461439242e-03, +1.0723744596745808e-05, +1.3656737309564442e-03, +1.3477127489407667e-03,
-    -2.3006823550418896e-03, +1.0333791431977905e-03, +9.8630097554054360e-04, -4.6452967724686101e-03,
-    +6.4932294358358174e-04, +5.2896459933963276e-04, -5.3174644966387909e-03, +6.0305275145084770e-04,
-    +6.7775770260463785e-04, -7.1390106111906488e-03, +5.6044163000849607e-04, +6.8925942704106073e-04,
-    -1.0042193113844682e-02, +2.5302902425252088e-04, +2.2970699498348353e-04, -8.3751661666581537e-04,
-};
-
-const double RED_COV[] = {
-    +9.4718898996732108e-11, +1.7895611740290804e-10, +3.2060840600422334e-09, +9.3107546023400417e-11,
-    +1.7115047827810366e-10, +2.5687055461263018e-09, +9.7587122760682285e-11, +1.7553342485174369e-10,
-    +2.5459692506337413e-09, +1.1123435555126412e-10, +1.9190470714767869e-10, +1.9045627382878235e-09,
-    +1.3482943742664895e-10, +2.2449559527642672e-10, +1.5539382590898085e-09, +1.4537575769348785e-10,
-    +2.5881763731558909e-10, +1.0815966331783209e-09, +1.3527755990210812e-10, +2.6291253569496871e-10,
-    +6.3984728800608014e-10, +1.3723170585506523e-10, +2.8380358690391002e-10, +7.2808810069300988e-10,
-    +1.3486461128662679e-10, +2.5367583508457105e-10, +1.2448468460008122e-09, +1.2544966883382947e-10,
-    +2.3643996910324438e-10, +1.2251298172363326e-09, +1.4113735154518659e-10, +2.8004401836057571e-10,
-    +1.5559139354359642e-09, +1.4976056488304870e-10, +2.9815802495241941e-10, +2.4118430310522704e-09,
-    +1.2766462969949710e-10, +2.4616163540481563e-10, +2.6447457374639478e-09, +1.0358519494062099e-10,
-    +1.9532484968066633e-10, +2.5576888576159467e-09, +9.3328033038971798e-11, +1.7566633306827890e-10,
-    +2.8474237781030403e-09, +8.8555381991857634e-11, +1.5891402273372547e-10, +2.7034368611685733e-09,
-    +1.3200953779840812e-10, +2.5341924709060024e-10, +4.1088015414382573e-09, +1.1517596020969362e-10,
-    +2.1104261305943676e-10, +3.0484733076484963e-09, +1.1072418432942861e-10, +2.0099663938422742e-10,
-    +2.6703337755129986e-09, +1.2596280360153688e-10, +2.2828026030837943e-10, +2.1155156996535019e-09,
-    +1.3094030719450549e-10, +2.4089649547924013e-10, +1.2391009439915882e-09, +1.2144240071925333e-10,
-    +2.4050250375720853e-10, +6.3550731873392673e-10, +1.1124584192675779e-10, +2.4139931413207062e-10,
-    +4.3559585460343045e-10, +1.1549423005661724e-10, +2.5920814238634743e-10, +4.9816529681597523e-10,
-    +1.1892986699689875e-10, +2.5380096377824565e-10, +7.5167488705713749e-10, +1.2097380163515620e-10,
-    +2.5584497081770808e-10, +8.5904824012967686e-10, +1.3655411207588718e-10, +3.0353649972121412e-10,
-    +1.2938861752365091e-09, +1.5123700395641204e-10, +3.3255707627798736e-10, +2.4908326088975018e-09,
-    +1.4022572733532039e-10, +2.9542197321476010e-10, +2.8828885260722805e-09, +1.2585556390522445e-10,
-    +2.6131451605552005e-10, +2.7971659372063500e-09, +1.2672011241246050e-10, +2.6050636287429617e-10,
-    +3.3358742576358114e-09, +1.3126410573022515e-10, +2.4578098499536520e-10, +3.8794072146289938e-09,
-    +1.6149647384537301e-10, +3.8775538582236790e-10, +9.3951469237032753e-09, +1.4137395414833891e-10,
-    +3.2419211306782356e-10, +4.6574088959239215e-09, +1.4217725000862728e-10, +3.2788565514754723e-10,
-    +2.0189702811026997e-09, +1.3837695276246556e-10, +3.0053385291893725e-10, +7.2605115491719495e-10,
-    +1.0910965415726497e-10, +2.2170105226598117e-10, +3.3789229888479031e-10, +8.4946155292248324e-11,
-    +1.8308600375991996e-10, +2.1175052757024549e-10, +7.7121663182812988e-11, +1.7540239986731865e-10,
-    +1.9149322665066600e-10, +7.9893826467098494e-11, +2.0441880557825909e-10, +2.1260014060042236e-10,
-    +9.1070008625580147e-11, +2.4308816594274455e-10, +2.8561037078742937e-10, +1.0844381039016085e-10,
-    +3.0151979657426370e-10, +3.3495242401587387e-10, +1.3598730544687422e-10, +3.7493781407957177e-10,
-    +5.3228005160567757e-10, +1.7184019612838994e-10, +4.5975486566630680e-10, +1.4065818106711401e-09,
-    +1.8479182529439376e-10, +4.8490333452753606e-10, +3.2672887826287896e-09, +1.5970715123175463e-10,
-    +4.0038582763879411e-10, +2.5645981825652076e-09, +1.5484254007827114e-10, +4.1281620078487752e-10,
-    +3.6311421727565611e-09, +1.6053279058344113e-10, +3.6015401988100445e-10, +4.4215502272563923e-09,
-    +1.8181165177172743e-10, +4.4313409279613219e-10, +6.6210822369466440e-09, +1.6903740297394014e-10,
-    +4.1038536790242705e-10, +2.5554959094291994e-09, +1.5573221202718643e-10, +4.0556781816215237e-10,
-    +1.1145812968191409e-09, +1.1667243997484808e-10, +2.9241739121192389e-10, +4.0172817015079377e-10,
-    +7.2648416907329961e-11, +1.5940816972618121e-10, +1.6891142087817465e-10, +5.1591503466923728e-11,
-    +1.0732386108454442e-10, +1.0366587839439995e-10, +4.6460275535143034e-11, +9.7690444221759741e-11,
-    +9.4027522841907686e-11, +5.3028360160772433e-11, +1.3223880664227627e-10, +1.1522040418190665e-10,
-    +6.9295946978786994e-11, +2.0314294801908544e-10, +1.8089872520344796e-10, +8.5910964599152255e-11,
-    +2.3421502504464253e-10, +2.5438417445158261e-10, +1.0259331365841189e-10, +2.2081575730715676e-10,
-    +2.7926622322860109e-10, +1.3658911162814671e-10, +2.6475131578895226e-10, +3.6586368039052548e-10,
-    +1.8639108160232388e-10, +4.6513213877766094e-10, +9.5720607230358852e-10, +1.8755695362659507e-10,
-    +4.4805372208574785e-10, +2.4028292199151804e-09, +1.6057797921419579e-10, +3.9245265646692201e-10,
-    +4.1112279398754634e-09, +1.5558648584814153e-10, +3.1834820566429377e-10, +3.5467542958048895e-09,
-    +1.9270598181149192e-10, +4.6665098759791393e-10, +3.5396772743845266e-09, +1.7132006363421460e-10,
-    +4.5558043783540796e-10, +1.7710578615920262e-09, +1.2441740785161796e-10, +3.6542971581359228e-10,
-    +5.9710047614696210e-10, +6.6363013447632244e-11, +1.5185310102864314e-10, +1.6493498590828595e-10,
-    +4.3405021216411163e-11, +8.5678482994457623e-11, +8.7277466704492181e-11, +3.7206568669339219e-11,
-    +6.7205458693812429e-11, +6.9859271022540430e-11, +3.6562293141433726e-11, +6.7207560727780354e-11,
-    +6.8126283968452535e-11, +4.1565691995322661e-11, +8.8010838308727154e-11, +8.6523100436030419e-11,
-    +5.2425340249742363e-11, +1.2327238572892094e-10, +1.2266723201998637e-10, +6.6175459199011171e-11,
-    +1.5880197349456501e-10, +1.6570310281997980e-10, +8.1427161077919347e-11, +1.8118321040031273e-10,
-    +2.2158472538011537e-10, +9.9385617384200581e-11, +2.0945426487905762e-10, +2.6933104804789554e-10,
-    +1.4469195045477299e-10, +2.9230658073772135e-10, +4.0552474076008591e-10, +1.8168016596961455e-10,
-    +4.5235147156929689e-10, +1.3490804824599424e-09, +1.7110151378880173e-10, +4.3385165716632542e-10,
-    +4.2123868428101991e-09, +1.6622191110400537e-10, +3.4986814856707656e-10, +4.0481373566685746e-09,
-    +1.8768384837644249e-10, +4.5559964564936111e-10, +1.3141905689161318e-09, +1.6801370023900837e-10,
-    +5.0379662623731642e-10, +9.9923848934042071e-10, +9.2789360154655428e-11, +2.9431151083006948e-10,
-    +3.1126617095497666e-10, +5.2513902006459956e-11, +1.1945221977093213e-10, +1.1314241853831924e-10,
-    +3.9838598664677705e-11, +7.4952371285188859e-11, +7.0511167943029912e-11, +3.7374826481579728e-11,
-    +6.3636957041153031e-11, +6.1495361157911866e-11, +3.7348787098741968e-11, +6.6820365441298575e-11,
-    +6.3038220798019991e-11, +4.1027954428300079e-11, +7.8707837557030136e-11, +7.4539594819717124e-11,
-    +4.5462013580108261e-11, +9.2860635668672723e-11, +8.4828903081250345e-11, +5.2067089890081127e-11,
-    +1.0176819479520927e-10, +9.6381406630634736e-11, +5.9553335886955382e-11, +1.1611245378334026e-10,
-    +1.1639664728578489e-10, +7.5821210425891132e-11, +1.5627344514336714e-10, +1.9039050202131471e-10,
-    +1.0340508112431344e-10, +2.3360601566288663e-10, +2.9519637265791115e-10, +1.5826390470056075e-10,
-    +4.2546738126857276e-10, +6.5213784797748780e-10, +1.8691910981184658e-10, +4.9212100709704387e-10,
-    +2.3034943080344636e-09, +1.9019124808569515e-10, +4.3169193077570858e-10, +2.5619696849249352e-09,
-    +2.0262457746998272e-10, +6.3032957403913677e-10, +9.8084298787957190e-10, +1.5844786070274867e-10,
-    +6.0747447861058904e-10, +6.5355381050428125e-10, +8.1252310722784260e-11, +2.8209554384752657e-10,
-    +2.1842739231821869e-10, +4.7269461363245517e-11, +1.0630161455162180e-10, +8.9112224631508564e-11,
-    +3.8834997212232792e-11, +7.1840240942869063e-11, +6.4742760476354320e-11, +4.0943472103112352e-11,
-    +7.2798925289208750e-11, +6.7242734948344510e-11, +4.3786067115210365e-11, +7.7631276176300423e-11,
-    +7.5475215936123651e-11, +4.6348579229594003e-11, +8.9732219317365747e-11, +8.5537804865576005e-11,
-    +4.6818495706338117e-11, +9.2911037422167681e-11, +8.4749168112992693e-11, +4.9119448585722558e-11,
-    +8.8155476067590513e-11, +8.0871002231599881e-11, +5.1490141106400338e-11, +8.5925887041853198e-11,
-    +8.4909681059826598e-11, +6.2548561839460674e-11, +1.1789920317765884e-10, +1.2393255586790069e-10,
-    +8.7475716962940713e-11, +2.3170419904389034e-10, +1.9763210020146143e-10, +1.6927737803538946e-10,
-    +6.5635406614734389e-10, +5.2790598371988040e-10, +2.4226184705498837e-10, +7.7478865545557001e-10,
-    +1.3801651505895160e-09, +2.5393280972033714e-10, +7.2575924161806207e-10, +1.9909494583324367e-09,
-    +2.2293757982005496e-10, +7.0006494453485273e-10, +1.3417644786024445e-09, +1.5995694621869434e-10,
-    +6.4097592389245286e-10, +7.2864191644318866e-10, +7.7305645848522689e-11, +2.4917151337673441e-10,
-    +2.0010819686115554e-10, +4.7439740420583729e-11, +1.0246154054819076e-10, +8.9337434669993333e-11,
-    +3.9213794538011782e-11, +7.4284109526945730e-11, +6.1158393245594805e-11, +4.0950071551918751e-11,
-    +7.2853254968152846e-11, +6.2181418009095914e-11, +5.2596323490552510e-11, +1.1277216909072688e-10,
-    +8.9458396619457245e-11, +7.0157654093973310e-11, +1.7432007567082380e-10, +1.3200351581701552e-10,
-    +6.6561008737563194e-11, +1.5372574352211591e-10, +1.1998892846318458e-10, +5.5491950247495194e-11,
-    +9.5546556184035807e-11, +8.7323582995650629e-11, +5.3554696398257132e-11, +9.1999705507838073e-11,
-    +8.0399687292780276e-11, +6.2412485014572545e-11, +1.2425176733486875e-10, +1.1136604207541180e-10,
-    +8.1498783419045981e-11, +2.1492892758915661e-10, +1.6875956339667204e-10, +1.4491730903933843e-10,
-    +5.8854256838438835e-10, +3.9111728205876385e-10, +2.6442040258402706e-10, +1.0353658174851326e-09,
-    +1.0466442439395255e-09, +3.0516283725344402e-10, +9.9477014418769436e-10, +2.0158077994671977e-09,
-    +2.3998141597353516e-10, +7.4804300859213901e-10, +1.5638752058800846e-09, +1.5451428691098675e-10,
-    +5.2155768976649524e-10, +6.3334786488786036e-10, +7.4029469996837539e-11, +1.9047560921719516e-10,
-    +1.6737299826561749e-10, +4.8317520819951394e-11, +9.8098592542697991e-11, +8.5277687410978022e-11,
-    +3.9700736450499048e-11, +7.1279690856954242e-11, +6.1530542118457856e-11, +4.3249891287365228e-11,
-    +7.7212447133750938e-11, +6.8489306835169808e-11, +6.0382414787291043e-11, +1.2584610345122034e-10,
-    +1.0585259471454992e-10, +9.7776811472581388e-11, +3.2677507724170047e-10, +2.0100398269270849e-10,
-    +8.8798234250591828e-11, +2.3245071589626652e-10, +1.7584866134734523e-10, +6.3519196267247792e-11,
-    +1.1670296899825480e-10, +1.0070002690113529e-10, +5.6087740431823019e-11, +9.4772179220142860e-11,
-    +8.4950295948400064e-11, +5.7655315007730030e-11, +1.1677173772641550e-10, +1.0082570351869938e-10,
-    +7.1636968943560833e-11, +1.8772141479237944e-10, +1.5068753491062017e-10, +1.0524129295263134e-10,
-    +3.5771001646649627e-10, +2.7392040844417117e-10, +2.0544895156781632e-10, +8.6460698877340738e-10,
-    +6.9900936832696345e-10, +2.5190137100774575e-10, +8.2101026954045330e-10, +1.1652925251713039e-09,
-    +2.4161939556554342e-10, +7.3605720276205592e-10, +1.5536832336422496e-09, +1.5820031471323444e-10,
-    +4.9190780401652180e-10, +5.1330250360816498e-10, +7.9672393358451597e-11, +1.7589363545538998e-10,
-    +1.5359254252519565e-10, +5.9282028964902471e-11, +1.1512583565079343e-10, +1.0225633144722492e-10,
-    +5.3630258759742852e-11, +1.0084002868930577e-10, +8.6519572760870765e-11, +5.6623172253170061e-11,
-    +1.0070453617574230e-10, +9.2893131797586862e-11, +7.8272692492747427e-11, +1.8077619470142076e-10,
-    +1.5295868494404588e-10, +1.2882397013379960e-10, +4.9746179050832737e-10, +4.0339835017360992e-10,
-    +1.1592413418348749e-10, +4.2792839017732597e-10, +3.1434748292843123e-10, +7.1203837262000498e-11,
-    +1.6244684531492335e-10, +1.2024098027283631e-10, +5.2279852233221090e-11, +9.9737693148390427e-11,
-    +7.9618314380505849e-11, +4.9821246844169284e-11, +1.0290155453420612e-10, +8.1478839230760729e-11,
-    +5.6032486489466039e-11, +1.3055066486763869e-10, +1.0561873056661759e-10, +7.6782855534819162e-11,
-    +2.1228829563781571e-10, +1.8379909659917127e-10, +1.3069891099802303e-10, +4.0254891217756364e-10,
-    +4.4401801132244354e-10, +1.6365427021349901e-10, +3.5482821247392179e-10, +7.7334446745203473e-10,
-    +2.0290600762628109e-10, +6.1197020913600676e-10, +1.4906811017506498e-09, +1.6447382863910648e-10,
-    +5.8176014254929224e-10, +6.5367800581400431e-10, +8.2389488681606623e-11, +1.9370322491933648e-10,
-    +1.7218195689670342e-10, +6.0088016249613008e-11, +1.2395767260936868e-10, +1.0288813019974896e-10,
-    +5.8879419415687999e-11, +1.2145472605578090e-10, +9.6737954845818700e-11, +6.0786596905707534e-11,
-    +1.3060784861005571e-10, +1.0397024747224134e-10, +7.6034199574999412e-11, +2.0443316461653261e-10,
-    +1.4641274454502186e-10, +1.0168839763807742e-10, +4.3338374376476880e-10, +3.0968743698818541e-10,
-    +1.0013551418241230e-10, +3.9105151484634286e-10, +2.9183632465610123e-10, +7.2707810929696042e-11,
-    +2.1345809800918037e-10, +1.3649091859358839e-10, +5.7917002368839460e-11, +1.4793412886332169e-10,
-    +1.0135965286786392e-10, +5.0507152084690796e-11, +1.1578505504496904e-10, +8.6534454070481342e-11,
-    +4.8769753008898314e-11, +1.1104967200401609e-10, +8.8107027200000604e-11, +5.7563032575080724e-11,
-    +1.4459880549607696e-10, +1.3086620317240088e-10, +1.0488337782228590e-10, +3.2568324654318715e-10,
-    +3.8334571838374526e-10, +1.4410982656228124e-10, +3.7496684857159317e-10, +1.1551237237946194e-09,
-    +1.8800086434751081e-10, +5.6790221314053460e-10, +1.7355872982091860e-09, +1.6324870110423921e-10,
-    +7.3582293032210265e-10, +8.1857468350152508e-10, +8.2639217887150488e-11, +2.4355477521601772e-10,
-    +2.1478196397865414e-10, +6.2391862186589411e-11, +1.3997240436489367e-10, +1.2652294256819920e-10,
-    +5.7072347157220229e-11, +1.2889535538039322e-10, +1.0780346227164154e-10, +5.8187797564973725e-11,
-    +1.4571054370474588e-10, +1.0790764322635984e-10, +6.3290975681403170e-11, +2.2001472012445018e-10,
-    +1.2967352205887893e-10, +7.1525388905137640e-11, +3.1972824827986877e-10, +1.7285575723032954e-10,
-    +6.5818606077471508e-11, +2.5340971186857015e-10, +1.5951966049833919e-10, +5.2753003058322405e-11,
-    +1.6351296055665369e-10, +1.0878034664815766e-10, +4.6151489500457218e-11, +1.1308033003617382e-10,
-    +8.7635532352440294e-11, +4.2448887111755542e-11, +8.6628159350812990e-11, +7.7317179710843687e-11,
-    +4.1321919833348480e-11, +8.3722555650290292e-11, +7.2008232396470685e-11, +5.0920362689829578e-11,
-    +1.3607043159353334e-10, +1.0824711189904868e-10, +1.0177606022719487e-10, +3.6516199171490152e-10,
-    +3.3969287065181926e-10, +1.4429573211977997e-10, +4.1745078517506339e-10, +1.4663937862290830e-09,
-    +1.7894807141007641e-10, +4.9224346837847764e-10, +2.1553416313368344e-09, +1.7346427477700995e-10,
-    +8.3334041603241511e-10, +9.5633041392149486e-10, +1.0254635887822596e-10, +4.1717704262502619e-10,
-    +3.0815243892297039e-10, +6.6080371430229956e-11, +1.6470997879862881e-10, +1.6371299873585802e-10,
-    +5.8676141533218795e-11, +1.3103523354622745e-10, +1.3905459385573875e-10, +5.5812000625951367e-11,
-    +1.4064816752440002e-10, +1.2964709341242614e-10, +5.2303017472519958e-11, +1.5156150520072236e-10,
-    +1.0792301650625338e-10, +4.7686438227527567e-11, +1.5045626718367345e-10, +9.7481102533039024e-11,
-    +4.1594565847264759e-11, +1.1893713733544865e-10, +8.1288424975995878e-11, +3.6006216438846043e-11,
-    +8.4601958088750744e-11, +6.6407757999041096e-11, +3.5027370161643022e-11, +7.2898093100487173e-11,
-    +6.1027976705609829e-11, +3.5790136311308281e-11, +7.4260339517941783e-11, +5.9711423951671702e-11,
-    +4.0026784721931141e-11, +9.2194678813718164e-11, +7.1609409119485477e-11, +6.1734927947074714e-11,
-    +1.9530078916199683e-10, +1.3043745792065511e-10, +1.2011416013484932e-10, +4.7937359653882700e-10,
-    +4.6078445703396633e-10, +1.5013949360508205e-10, +4.3371398251129283e-10, +2.2328722737151510e-09,
-    +1.5833825844618175e-10, +4.0937673967076469e-10, +3.7296863425909121e-09, +1.6377888190814050e-10,
-    +5.6463894588061470e-10, +1.1351590120697802e-09, +1.3631248335078164e-10, +5.1615434286862785e-10,
-    +4.7490871994390284e-10, +8.7033815176233047e-11, +2.8502152209341966e-10, +2.1097042358775123e-10,
-    +5.9701492747604358e-11, +1.4676663617187254e-10, +1.4370638123951070e-10, +4.7375450450170630e-11,
-    +1.0396793887187851e-10, +1.0890150678641557e-10, +4.2682352700353625e-11, +9.1910639214486340e-11,
-    +9.1527523070168030e-11, +4.0779471174738504e-11, +8.5175474489278671e-11, +8.2441656053819745e-11,
-    +3.6284420611068706e-11, +7.4529012965362438e-11, +6.7221922204397983e-11, +3.1771535876439384e-11,
-    +6.8034000672993079e-11, +5.4461004694475616e-11, +3.3030408199633369e-11, +7.4689120887686314e-11,
-    +5.7459877864141409e-11, +3.9945465139182652e-11, +1.0120964573294071e-10, +6.9404282928346654e-11,
-    +5.7114763725435019e-11, +1.9056519454922195e-10, +1.0588010016267182e-10, +9.4653517807488905e-11,
-    +4.0576173038771874e-10, +2.4559719317833454e-10, +1.2725663813036037e-10, +4.9699044182664325e-10,
-    +9.0455212064640719e-10, +1.2651902599862798e-10, +3.5712502882369548e-10, +3.1341383541118081e-09,
-    +1.2580564407499594e-10, +3.0450778300592803e-10, +4.8426478201661060e-09, +1.4193353086375242e-10,
-    +3.7926891373993757e-10, +2.5497810259529102e-09, +1.3870260395210063e-10, +3.8354965340092639e-10,
-    +8.2787116974506510e-10, +1.2084896274025935e-10, +3.4979966261479878e-10, +4.3850466469707140e-10,
-    +9.2855421832968863e-11, +2.7354079566131321e-10, +2.4120811083373420e-10, +6.4921400704428471e-11,
-    +1.6589129927724717e-10, +1.5975890895519880e-10, +5.2215540386508225e-11, +1.1801063527682090e-10,
-    +1.2384870382704082e-10, +4.9214696344525482e-11, +9.7725509414157578e-11, +1.1963337937914663e-10,
-    +4.7037308153339036e-11, +9.4085826293727237e-11, +1.2043582674819715e-10, +4.7790536401191486e-11,
-    +1.1424039491215708e-10, +1.1200797174713658e-10, +5.7946245039431378e-11, +1.8427178709801633e-10,
-    +1.2230671335638368e-10, +7.8379546019869952e-11, +2.9077188286871429e-10, +1.5741548900638181e-10,
-    +9.9646133551536758e-11, +3.7978804326299125e-10, +2.6744127065448885e-10, +1.1333186973761157e-10,
-    +4.2016332167636312e-10, +6.3530751864446983e-10, +1.1711972079085771e-10, +4.5364801690167342e-10,
-    +2.6157224311075684e-09, +1.0760857235158108e-10, +3.0694273831985952e-10, +4.4906451800192452e-09,
-    +1.0418729031287275e-10, +2.2480305566862749e-10, +3.8385845855010628e-09, +1.1129484293216529e-10,
-    +2.4404748531395130e-10, +3.1355007823215692e-09, +1.2746697559433604e-10, +2.7791315074026657e-10,
-    +2.6879483291176984e-09, +1.4463424646670632e-10, +2.9089211372603440e-10, +1.2564880314407408e-09,
-    +1.3567316115470249e-10, +2.6885639077048729e-10, +5.9829674811639383e-10, +1.1050416732813123e-10,
-    +2.3397075751723346e-10, +3.1089712508301956e-10, +9.0514432915042838e-11, +1.9802540625604552e-10,
-    +2.0158403277518323e-10, +9.0977041239390370e-11, +1.8892553784655524e-10, +2.0286070387335676e-10,
-    +9.2705123728503424e-11, +1.8449227419239408e-10, +2.7404796660627534e-10, +9.4316376226225657e-11,
-    +2.0982074512062691e-10, +3.1481654399132445e-10, +1.1900689572378573e-10, +2.9794587908508493e-10,
-    +4.0678958651738793e-10, +1.3774319814924174e-10, +3.5432972952561160e-10, +6.6549278132293614e-10,
-    +1.3022990315279724e-10, +3.3656966936235096e-10, +1.3062912222320539e-09, +1.1194907505178373e-10,
-    +3.2466001600689192e-10, +1.8800407617653967e-09, +9.8948770625747482e-11, +2.9399504066409818e-10,
-    +2.9389458884545439e-09, +9.1055272856963294e-11, +2.2778112744984716e-10, +3.4892513316143199e-09,
-};
-
-const double BLUE_COV[] = {
-    +1.2389431908741512e-08, +1.8295870982347955e-08, +1.4410440560167820e-08, +1.0023577358426710e-08,
-    +1.2538502449666003e-08, +1.2668166586035879e-08, +8.5847490850825337e-09, +1.0376166004793523e-08,
-    +9.4943254837636473e-09, +7.6576268305355940e-09, +8.9044363513605442e-09, +6.2785599527540944e-09,
-    +5.8654270094502700e-09, +5.1029046391480683e-09, +3.2175243260363609e-09, +3.6563631316459058e-09,
-    +3.1102266082803737e-09, +2.3856298570126674e-09, +3.2881728981549215e-09, +3.0285571038424546e-09,
-    +2.4798980640876629e-09, +3.3095336932885810e-09, +3.5732953502519251e-09, +2.9432563053431294e-09,
-    +3.2950720441306627e-09, +3.9129672961901942e-09, +3.3160424819661437e-09, +2.6124965779886995e-09,
-    +2.5938033348379056e-09, +2.1755623041546579e-09, +2.6637000790274492e-09, +2.4594247728624677e-09,
-    +2.0440487142513548e-09, +3.6090190700242904e-09, +3.5061939422919198e-09, +2.7382209736165776e-09,
-    +6.9862483595502885e-09, +6.0201024102497396e-09, +4.1453600170765579e-09, +9.8309382398733338e-09,
-    +1.0572323089643858e-08, +8.8455002555420660e-09, +8.0877958710847375e-09, +9.5565410409333917e-09,
-    +1.0614307166861927e-08, +6.4451647861383823e-09, +7.9735233734389107e-09, +1.1766445793613877e-08,
-    +1.2765305981639843e-08, +2.0169906857992258e-08, +3.0783096423031881e-08, +8.7111883131463846e-09,
-    +1.0561574661498090e-08, +1.8496702343167833e-08, +5.9765314400128023e-09, +8.2853177764450889e-09,
-    +1.2519466048278505e-08, +3.8947458791456149e-09, +4.7414552942096394e-09, +5.4784701028189964e-09,
-    +2.8323504760902135e-09, +2.8924448908476741e-09, +3.0847405593296539e-09, +2.5460251911726886e-09,
-    +2.5277144872475157e-09, +2.6162666888937684e-09, +2.9493183153572837e-09, +2.7254432784274355e-09,
-    +2.7892078663884396e-09, +3.4125654707937359e-09, +3.5724841001325695e-09, +3.3368444611807187e-09,
-    +3.2225629835514141e-09, +3.7226604420210305e-09, +3.4873568545067799e-09, +3.8403792303826922e-09,
-    +3.4285584470695625e-09, +3.3518151189996060e-09, +4.4717765188902138e-09, +4.2404441939925152e-09,
-    +3.9950873050623603e-09, +4.1565724132420497e-09, +4.1863731285650918e-09, +3.8724398037074221e-09,
-    +4.7103954437739025e-09, +5.0987146594129273e-09, +4.5451314072711774e-09, +9.9956078299634444e-09,
-    +1.2304890427350181e-08, +1.0201418750070957e-08, +1.0260519620827424e-08, +1.3038300751641063e-08,
-    +1.3233040822700245e-08, +1.0442220629690752e-08, +1.2272362856068959e-08, +1.5414718907745108e-08,
-    +1.2966550927665309e-08, +2.2539833012745508e-08, +1.0858092226680948e-07, +8.2909203701786772e-09,
-    +1.2160525108985385e-08, +3.3327322195320002e-08, +5.2887876100165008e-09, +7.7063782941964027e-09,
-    +9.5222405306340878e-09, +3.1327452132585191e-09, +3.5010041107354857e-09, +3.8078323921342589e-09,
-    +2.3737398797113450e-09, +2.2054770105917483e-09, +2.2823225144878467e-09, +2.0526490060454628e-09,
-    +2.1157404784574918e-09, +2.0501741960233208e-09, +2.6871561174099264e-09, +2.5694877426325849e-09,
-    +2.4054620287463228e-09, +3.7811583375140562e-09, +3.4683140945892686e-09, +3.0282289595828076e-09,
-    +4.5761863199019372e-09, +4.5248618784780449e-09, +3.6750798542482595e-09, +3.5942963706761276e-09,
-    +3.5366517777045575e-09, +2.9705082210731017e-09, +3.4002990379387596e-09, +3.2948549084446972e-09,
-    +3.1133419839200818e-09, +4.0772528347824015e-09, +4.1781108430328447e-09, +3.7648905515632770e-09,
-    +7.4741515251630277e-09, +8.2435051627959988e-09, +6.8984370907825506e-09, +1.1105320180206910e-08,
-    +1.4088519095318156e-08, +1.3770102438959189e-08, +1.1468439525330016e-08, +1.6616677883755044e-08,
-    +1.7957031732104241e-08, +1.2243817854549827e-08, +1.5099120972964386e-08, +1.5881473135590927e-08,
-    +1.4938094817196541e-08, +2.5179998590423668e-08, +2.0807709506064506e-07, +1.1508223989765241e-08,
-    +1.5899866204215879e-08, +3.7195446935097123e-08, +4.6186594367772976e-09, +5.1576297763706875e-09,
-    +5.7031166979551928e-09, +3.5654817172063077e-09, +3.5202763039524909e-09, +3.3699155527132720e-09,
-    +3.2181219811823469e-09, +3.1292221910506465e-09, +2.6486912984486222e-09, +2.4141582015879090e-09,
-    +2.1610790013310782e-09, +1.8545864705123920e-09, +2.6908203961850432e-09, +2.1580206242937451e-09,
-    +1.8731486816954694e-09, +4.0706158883766356e-09, +2.7727512342132633e-09, +2.2626668337510368e-09,
-    +5.6942257379333560e-09, +3.8963295644280372e-09, +2.7206221836578182e-09, +4.2407516976651528e-09,
-    +3.7416655195655700e-09, +2.5374081777635890e-09, +3.5505176581960107e-09, +3.6387174101868376e-09,
-    +2.7797061139588677e-09, +5.1471741542926329e-09, +5.7101890288984714e-09, +3.9506135225763606e-09,
-    +9.1565288555050426e-09, +9.0862543680009691e-09, +6.5153362120998900e-09, +1.2762897990074599e-08,
-    +1.4710935775717436e-08, +1.1556611953158599e-08, +1.2586194824654828e-08, +1.9480607649243705e-08,
-    +1.6743314490797909e-08, +1.2562439880088543e-08, +1.7276500947417425e-08, +1.5911455676866082e-08,
-    +2.0603802254513376e-08, +3.5942286894856312e-08, +2.5418703234352142e-07, +1.2450321505274749e-08,
-    +1.4708140268768577e-08, +2.7253443479396982e-08, +5.4871054092867339e-09, +5.4020628133388907e-09,
-    +6.4440234649834972e-09, +3.4130587333720689e-09, +3.0310692386812784e-09, +2.7688523744574559e-09,
-    +3.0509500016080053e-09, +2.6685298626811077e-09, +2.1762683288011818e-09, +2.5768788550059328e-09,
-    +2.1895719529373164e-09, +1.8337719773972722e-09, +3.0675408286846779e-09, +2.0974367558898708e-09,
-    +1.8959479820582826e-09, +3.7344531773345682e-09, +2.0398870081291563e-09, +2.1151463193394502e-09,
-    +5.3476621873881807e-09, +2.6282696722745614e-09, +2.3899541946397982e-09, +8.4124368086138715e-09,
-    +4.0052904920840189e-09, +3.1028306531407973e-09, +9.7221307126668976e-09, +5.7664173896326882e-09,
-    +3.8065771417836694e-09, +8.2782929640031583e-09, +6.9451128633275811e-09, +4.4220515488189223e-09,
-    +5.8758428184077088e-09, +6.5007497217142912e-09, +4.7068928176162158e-09, +7.8471075220324753e-09,
-    +9.1949033643700616e-09, +9.4677755312745214e-09, +1.8409066052667901e-08, +2.7336908618263820e-08,
-    +3.0104975145182002e-08, +1.9469165038184596e-08, +2.8289710740819533e-08, +2.5704171563418422e-08,
-    +2.2062596395620394e-08, +4.6484210870788293e-08, +7.2636353143712480e-08, +2.0059266708230806e-08,
-    +2.1643648538227977e-08, +2.4737430113977005e-08, +7.6596697804526346e-09, +6.4671808260815918e-09,
-    +6.0331373325886721e-09, +3.4880798933258607e-09, +2.5261500038330536e-09, +2.3308859442708292e-09,
-    +2.6297162017375246e-09, +1.9117537855511334e-09, +1.6162834976512556e-09, +2.8357497101629877e-09,
-    +1.7403014276209479e-09, +1.6794046119685185e-09, +4.7742119756132763e-09, +2.1877783695013346e-09,
-    +2.1394635822659167e-09, +5.9562950536763714e-09, +2.3308806199142966e-09, +2.2277320421790461e-09,
-    +7.7839522941490737e-09, +2.7978203446309810e-09, +2.7078283216589505e-09, +8.0768841183831738e-09,
-    +2.7765254028571074e-09, +2.6223739936905280e-09, +5.5212080893582673e-09, +2.6119052453746377e-09,
-    +2.3723775859748931e-09, +4.2009844914734048e-09, +3.1269086748267027e-09, +2.9000123224423635e-09,
-    +3.6585893538247356e-09, +3.8312797718454400e-09, +3.3766501153070243e-09, +4.7316673571036853e-09,
-    +5.5077561571605415e-09, +5.1681528025980472e-09, +1.9271624704534693e-08, +2.8950279371643449e-08,
-    +2.7287414599601839e-08, +2.1401479753954030e-08, +4.5907082870685596e-08, +3.7219189127113686e-08,
-    +2.2899554926540403e-08, +4.7856275735609555e-08, +3.8789637627593186e-08, +1.5459792550300181e-08,
-    +1.3019510869735734e-08, +1.3707686411067378e-08, +5.4551596757695360e-09, +3.6205168185660023e-09,
-    +4.1251398974162712e-09, +3.4607486268588701e-09, +2.0465763069526824e-09, +2.3165517406429631e-09,
-    +3.1235050026571500e-09, +1.6671797662474238e-09, +1.9233996806398747e-09, +2.3282695124508836e-09,
-    +1.3046762397572759e-09, +1.4666196681549811e-09, +3.0756661136957373e-09, +1.5273179424374053e-09,
-    +1.6555954213919177e-09, +4.0780852016479200e-09, +2.0628177044819746e-09, +2.5183951070846919e-09,
-    +4.5898098208169835e-09, +2.4226101370715068e-09, +2.7163334032073900e-09, +3.6783489668865931e-09,
-    +2.1801331957172242e-09, +2.0854988153730668e-09, +2.4119226100574228e-09, +1.6361821632350843e-09,
-    +1.5432912065608239e-09, +2.2418874561691076e-09, +1.7969789983344733e-09, +1.6672783327322039e-09,
-    +2.5746402961674731e-09, +2.2830531016165674e-09, +2.4715268918400848e-09, +4.6493190437628356e-09,
-    +4.4829899692516680e-09, +4.5542520977374748e-09, +2.5855967625846389e-08, +3.2307452188767014e-08,
-    +2.1224622064297826e-08, +2.7067334677659621e-08, +7.4628976446423254e-08, +3.7827304058253112e-08,
-    +2.4549841222674391e-08, +5.4268278818043247e-08, +3.1481664716430098e-08, +1.4746452228477238e-08,
-    +1.2066814773946744e-08, +1.4568388685659026e-08, +5.1013341514104921e-09, +3.6792718261882801e-09,
-    +4.6341773237645472e-09, +3.2699763320094131e-09, +2.4600690751479312e-09, +2.9559502141247504e-09,
-    +3.1234795389647910e-09, +2.4169761385070042e-09, +2.7644337714939694e-09, +2.0430389402547872e-09,
-    +1.5946219626603612e-09, +1.8002565945329856e-09, +1.8431219355229475e-09, +1.3893351722907113e-09,
-    +1.5314432614873908e-09, +2.2319113909930020e-09, +1.6331342265622700e-09, +1.7426965040310911e-09,
-    +2.4391179631376641e-09, +1.8857183014322275e-09, +1.8586636786938139e-09, +2.0394257669629251e-09,
-    +1.6659579931257611e-09, +1.5129457754590769e-09, +1.9672210184676568e-09, +1.6628607912592325e-09,
-    +1.4968012063487278e-09, +2.2371373111324589e-09, +1.9121368856117456e-09, +1.8780293164545495e-09,
-    +3.8506430887785501e-09, +2.9141494401652305e-09, +3.2390720083313130e-09, +5.6621059780792418e-09,
-    +4.4277214129579875e-09, +5.1874500373991755e-09, +2.3175357197724848e-08, +2.2858291780197113e-08,
-    +1.8666777323322670e-08, +3.3179633106916564e-08, +8.6152895025885016e-08, +3.2836127594755997e-08,
-    +2.3991665679209684e-08, +5.9026507683096862e-08, +3.8607592468755153e-08, +2.0656397944349658e-08,
-    +1.9622240090234058e-08, +1.8159778484116490e-08, +6.2973076975562617e-09, +4.2118561805605364e-09,
-    +4.8989635071848202e-09, +2.6280667367377547e-09, +1.7546121221017499e-09, +2.2527189760493011e-09,
-    +1.8975820290602113e-09, +1.3309393089133039e-09, +1.5946616316267503e-09, +1.7367578393267422e-09,
-    +1.2793874317541008e-09, +1.4899267593872042e-09, +1.7098972844011490e-09, +1.3632930597977222e-09,
-    +1.4876132668927350e-09, +1.9667218817934807e-09, +1.6831123263503735e-09, +1.7817974462961919e-09,
-    +2.5025342476128636e-09, +2.1222187879770474e-09, +1.9833743604567306e-09, +2.4557043668472043e-09,
-    +2.1928350120300339e-09, +1.8131964477356508e-09, +2.2300215939011926e-09, +1.6980247375749038e-09,
-    +1.5581066723486039e-09, +2.1875171603885252e-09, +1.5487748756302441e-09, +1.5287248757066810e-09,
-    +3.1158526259164253e-09, +2.2712007625620189e-09, +2.3305090073345825e-09, +6.7201527657383443e-09,
-    +5.3301883516398294e-09, +4.9561411001674811e-09, +3.4342368203692626e-08, +2.7521740730285493e-08,
-    +2.0708160698888838e-08, +3.0624362458194287e-08, +6.1328995656128464e-08, +3.8561217726236960e-08,
-    +2.4495532272116630e-08, +5.7985902583335592e-08, +5.7039303102920988e-08, +2.4863059860476979e-08,
-    +1.9555070902678272e-08, +2.3488353569998403e-08, +5.8385936775585798e-09, +3.6273869616354241e-09,
-    +4.2245170089637176e-09, +2.7514708806154881e-09, +1.7526790983856242e-09, +1.9721809635938473e-09,
-    +2.1706578070602568e-09, +1.3873406340830092e-09, +1.4911952132585932e-09, +2.3928748743163453e-09,
-    +1.4085412059736297e-09, +1.6274570730489526e-09, +4.0425880016125543e-09, +2.1589522972386993e-09,
-    +2.4681063218048219e-09, +6.0049214775150154e-09, +3.2474522819442854e-09, +3.2938223857200912e-09,
-    +6.2649708919115145e-09, +3.4728356238727485e-09, +3.4487756848043340e-09, +4.4624288060203651e-09,
-    +2.7938443930536628e-09, +2.7637015471955773e-09, +2.4927558582872379e-09, +1.7553923868010769e-09,
-    +1.8162510409547712e-09, +2.0494618726936127e-09, +1.5345611302715464e-09, +1.6616115707092695e-09,
-    +2.9077263205301673e-09, +2.0876104513720500e-09, +2.3378462205013809e-09, +6.2366931964993010e-09,
-    +4.5175424780340535e-09, +4.9320727566944248e-09, +1.8920082913100938e-08, +2.0587755296658162e-08,
-    +2.0077535023201907e-08, +2.0179019788374127e-08, +3.7137692563113875e-08, +4.5404330329034700e-08,
-    +2.0359710892919702e-08, +4.5729188726236724e-08, +8.7358896817873615e-08, +1.5035617649114739e-08,
-    +1.5603566794367846e-08, +2.1244006083348618e-08, +4.6259331449687324e-09, +3.8248355222236026e-09,
-    +3.7759467817456432e-09, +4.3155584500293842e-09, +3.0182188047520968e-09, +2.7188115065681976e-09,
-    +5.3662776703857453e-09, +3.5312341598767078e-09, +3.3640329259297793e-09, +5.0017453340255813e-09,
-    +3.4816221062615360e-09, +3.3089393800022417e-09, +7.3108200480319444e-09, +4.3584762890674058e-09,
-    +4.1806622872250212e-09, +1.7837323997563424e-08, +8.8815901165522776e-09, +7.6412844262500722e-09,
-    +1.7327028304965556e-08, +9.7976999331140497e-09, +6.8360600884486454e-09, +5.6692684508085167e-09,
-    +4.2163939205823168e-09, +3.3218539914223220e-09, +4.3830951191996015e-09, +3.2700788786517642e-09,
-    +2.6623008411611393e-09, +4.7958821941608039e-09, +3.5558755401032527e-09, +2.9552972196939038e-09,
-    +3.6956933431334711e-09, +2.9658999420851705e-09, +2.6188835578400508e-09, +4.9532472649493622e-09,
-    +3.8674435128258572e-09, +3.6463131520608421e-09, +1.4659575126518422e-08, +1.5964594106341185e-08,
-    +1.7810272897728355e-08, +1.6251315279888047e-08, +3.4047223021670016e-08, +6.9311208086732671e-08,
-    +1.5332837336489321e-08, +2.6008978663560361e-08, +7.8739841280951929e-08, +1.4203635332400778e-08,
-    +1.6330932365100625e-08, +2.8592406411549704e-08, +6.0938748873006415e-09, +5.1626487053850320e-09,
-    +5.4464788925169015e-09, +3.7456066234850303e-09, +2.5896500528453045e-09, +2.4525521835598222e-09,
-    +3.3292104280418716e-09, +2.0383918424732580e-09, +1.8732285427931704e-09, +2.5149304441537450e-09,
-    +1.8090589935241310e-09, +1.5646968074243983e-09, +5.0722349404850021e-09, +3.4037598360022232e-09,
-    +2.6734454478149626e-09, +1.1172355356291396e-08, +9.2193640831147158e-09, +5.1445727579202058e-09,
-    +1.0846528017162161e-08, +8.6970481635830812e-09, +4.8061986659232547e-09, +4.1957496627949393e-09,
-    +2.6958840759710766e-09, +2.2644875180213807e-09, +2.7115054144926428e-09, +1.8414031472831669e-09,
-    +1.7245125040702626e-09, +2.8636958031572879e-09, +1.8881744861136334e-09, +1.8775518123518507e-09,
-    +3.4753984588644373e-09, +2.4124701489085837e-09, +2.5125684263148996e-09, +5.7881802361300835e-09,
-    +4.2772869122920607e-09, +4.6903241394365612e-09, +1.4019926325006746e-08, +1.4788331432712352e-08,
-    +2.7951073658038883e-08, +1.3872586480351551e-08, +2.4751298335542020e-08, +1.3693132250599062e-07,
-    +1.2332658009313404e-08, +2.3191255431015184e-08, +6.4200630565753318e-08, +1.1881596892800831e-08,
-    +1.8382011319605819e-08, +3.3752128620181739e-08, +1.1392132099153784e-08, +9.0208205138077116e-09,
-    +9.7815409235071648e-09, +5.1201525461384408e-09, +3.5198294927013128e-09, +3.4405084870618134e-09,
-    +4.1553885784682103e-09, +2.5589405838587884e-09, +2.2476397765089948e-09, +4.2193097461570114e-09,
-    +2.6179481113835676e-09, +2.0022039019185821e-09, +4.7095930468434902e-09, +3.1840932787003566e-09,
-    +2.1342332353380956e-09, +5.3807649630154924e-09, +4.1989229502299491e-09, +2.6163155620456321e-09,
-    +5.0381747285447742e-09, +3.8356560832770988e-09, +2.4751148181631802e-09, +4.3219897770160528e-09,
-    +2.4991921298960293e-09, +2.0773816737888283e-09, +2.8638652407523566e-09, +1.7334785680969874e-09,
-    +1.6524375790010811e-09, +3.2273131800297849e-09, +1.8145683494557989e-09, +1.8914290913986386e-09,
-    +5.5485741853884448e-09, +3.0121697592247019e-09, +3.6164870160467224e-09, +8.5707259433157476e-09,
-    +6.3950644018477736e-09, +8.3808260076742739e-09, +1.0561861344708089e-08, +1.4005733471088139e-08,
-    +2.7470700369077102e-08, +1.0395332304521171e-08, +1.8984445682947603e-08, +1.1627527054057870e-07,
-    +1.3448985463005062e-08, +2.9284085232970185e-08, +8.8004997979845240e-08, +1.2176167074351106e-08,
-    +2.2011478942245427e-08, +3.5864582652279972e-08, +1.3374555317769358e-08, +1.4138507978239841e-08,
-    +1.3826425897526172e-08, +1.3292719467218196e-08, +1.0684541363016894e-08, +8.0071551297667048e-09,
-    +8.9317939719876086e-09, +6.0654197615294227e-09, +4.5076072205034130e-09, +5.1767572441638365e-09,
-    +3.0033867600698421e-09, +2.2020909950639541e-09, +5.9100564699394685e-09, +2.9700156633577149e-09,
-    +2.1030529554980270e-09, +6.7143722366455629e-09, +3.0126892876068699e-09, +2.2973225594633284e-09,
-    +7.1581028281657281e-09, +2.9560762162884188e-09, +2.1862469409513557e-09, +5.2449248520541806e-09,
-    +2.4765245838862328e-09, +1.9430262689709763e-09, +4.1218378841508192e-09, +2.1859782128229540e-09,
-    +1.8233157748206517e-09, +4.9047372262262102e-09, +2.7171955555125747e-09, +2.2384498845576549e-09,
-    +9.0587381353517054e-09, +5.2572407043060278e-09, +4.5212706591720035e-09, +8.0003186686932019e-09,
-    +8.2881772028199461e-09, +7.8271372970911518e-09, +9.3307256194601183e-09, +1.6922237293730784e-08,
-    +2.2768052897290505e-08, +1.0028801615070279e-08, +2.3108713022390664e-08, +1.4595831926660037e-07,
-    +1.3648083431716672e-08, +3.2677302714787744e-08, +1.0660104590550171e-07, +1.2049258186817258e-08,
-    +2.7094682449102381e-08, +5.1307176011473565e-08, +1.1927083868188518e-08, +1.8756222024977675e-08,
-    +1.8892694990229701e-08, +1.0807022978465032e-08, +9.9133099876865749e-09, +8.9933742304628501e-09,
-    +7.3138828371993950e-09, +5.1202571499641944e-09, +4.2671594996927808e-09, +5.9054076177785820e-09,
-    +3.6244421082015394e-09, +3.3898318758982754e-09, +5.9607202483717716e-09, +3.0120431031440358e-09,
-    +3.0901808942761621e-09, +6.7601294675659162e-09, +2.8316499896215723e-09, +3.2674532953738470e-09,
-    +7.7282941372673528e-09, +2.8454341314564568e-09, +3.1638428846886637e-09, +6.9202054157790412e-09,
-    +2.5772524262905125e-09, +2.8818396382408285e-09, +7.8152963496681121e-09, +3.2427833534609138e-09,
-    +2.6206493156078710e-09, +7.4047745438305388e-09, +4.1182634974613898e-09, +2.7967786960282831e-09,
-    +7.8088194227765879e-09, +6.1596881537142263e-09, +4.3132032357081278e-09, +9.0947337571715617e-09,
-    +1.3238194664501840e-08, +1.2585735445751708e-08, +9.8812812476374452e-09, +2.3336160353585810e-08,
-    +3.8973331757251866e-08, +9.9918285826668134e-09, +2.4157693110378126e-08, +1.0984036789493457e-07,
-    +1.3002406316329735e-08, +3.0424626471536574e-08, +1.6104146157365531e-07, +1.2682510682066554e-08,
-    +2.6096448140316217e-08, +4.7949669725072471e-08, +1.1531841241464517e-08, +1.3654777538344302e-08,
-    +1.0798026997464652e-08, +8.9148965344685806e-09, +7.3655182863685638e-09, +5.6096182199861247e-09,
-    +9.6378053942237821e-09, +7.3592153946013560e-09, +5.2520519885290461e-09, +7.0398485204818532e-09,
-    +6.2909196406669484e-09, +4.2762410495014182e-09, +5.7310297856461248e-09, +5.0322706685684960e-09,
-    +3.5575761196507570e-09, +5.3692355933650534e-09, +4.3643725428228043e-09, +3.0444772769669203e-09,
-    +5.9081635879039037e-09, +4.7431422238642613e-09, +3.3787124714031281e-09, +7.0814106801736736e-09,
-    +5.6733123715409611e-09, +3.7342392557936093e-09, +8.6649450402898724e-09, +5.8974545530504501e-09,
-    +4.2773341143859495e-09, +1.2837538853292748e-08, +9.0128763449318186e-09, +6.5504738806044390e-09,
-    +1.2044509618088947e-08, +1.6687007851120399e-08, +1.1766855617657471e-08, +9.7250399580010796e-09,
-    +2.1525248546125534e-08, +2.6986073108348505e-08, +9.3907029280146113e-09, +2.5657847320465050e-08,
-    +7.6094808347996259e-08, +8.9004229667902927e-09, +2.0098457923707461e-08, +8.9184338766354073e-08,
-};
-
-const double YELLOW_COV[] = {
-    +5.2178032791364063e-11, +9.6070952616405613e-11, +1.3710280663964405e-09, +4.8944393048558982e-11,
-    +8.3659412618927277e-11, +1.0421651136143161e-09, +5.2140450369723324e-11, +8.8418934932565111e-11,
-    +1.0424070025791932e-09, +5.9901954908631393e-11, +1.0180010208007349e-10, +8.0723474713619399e-10,
-    +5.9595781785081572e-11, +9.2848848183404038e-11, +5.1685123656045984e-10, +4.8331868802875121e-11,
-    +6.6247370799769654e-11, +3.2386687189121106e-10, +4.3265845581038334e-11, +5.7291922734408159e-11,
-    +2.9554599992747683e-10, +4.4478272441993480e-11, +6.3262037337992063e-11, +3.2671599479426501e-10,
-    +4.6272424136318010e-11, +7.2973897748102471e-11, +4.2549184062357912e-10, +4.8366073342534630e-11,
-    +7.7387180757835662e-11, +5.5357928335730997e-10, +5.4614125211514641e-11, +8.8928637056985524e-11,
-    +7.7110162726879621e-10, +6.4071786804948804e-11, +1.2437401221078968e-10, +1.1456230946691249e-09,
-    +6.7370678757258570e-11, +1.4817823774796089e-10, +1.4645432018503387e-09, +6.4275343886408828e-11,
-    +1.4222983267380609e-10, +1.5735692953363716e-09, +5.8441078989807251e-11, +1.2655365170858994e-10,
-    +2.3339188536697915e-09, +5.2381065451468385e-11, +1.0696252305443892e-10, +2.0904180169399518e-09,
-    +5.9988676881686531e-11, +1.2592640433712461e-10, +2.2119656765481293e-09, +5.3714897808929878e-11,
-    +9.9609303415345865e-11, +1.4392883262702078e-09, +5.1015408416382920e-11, +9.5126672361133953e-11,
-    +1.0773552012765978e-09, +5.3283244551434295e-11, +9.6982974764180206e-11, +6.2263757644385274e-10,
-    +5.0733541871050606e-11, +8.0047927249173435e-11, +3.9470585130793829e-10, +4.2290174746102347e-11,
-    +5.7714247982325545e-11, +2.6662814060677087e-10, +3.8381097260225477e-11, +5.1508649556932913e-11,
-    +2.5615713237537073e-10, +3.9879445821491127e-11, +5.7164910120621167e-11, +3.3732109030349611e-10,
-    +4.1497494968381655e-11, +6.6360705101314106e-11, +4.3714436456274908e-10, +4.4003837208355463e-11,
-    +7.1719681559671284e-11, +4.6368324959622853e-10, +5.0074972496692266e-11, +8.4907468763059852e-11,
-    +5.8640673958063122e-10, +5.7361965260545491e-11, +1.1822921724986926e-10, +9.2155636556529421e-10,
-    +6.2741519318068290e-11, +1.4641079297461548e-10, +1.6538611478149156e-09, +6.1972687144349596e-11,
-    +1.4624703011640596e-10, +2.0641071172847232e-09, +6.2197017603981569e-11, +1.5033858509704571e-10,
-    +2.9725834673272264e-09, +6.0612881718950337e-11, +1.3575055493764678e-10, +2.8509505843281655e-09,
-    +6.4589613631617457e-11, +1.4502845163160527e-10, +2.6950785367581115e-09, +5.8878207452239739e-11,
-    +1.2336559460541588e-10, +1.9536716044993336e-09, +5.9143924047587965e-11, +1.3092470968611778e-10,
-    +1.7450291157322726e-09, +6.1225955666498093e-11, +1.3081598343870783e-10, +7.0846283747665482e-10,
-    +5.3934457947399710e-11, +9.3131780666568671e-11, +4.0971255218371805e-10, +4.1264201859967399e-11,
-    +5.8670271236396365e-11, +2.5232787853642712e-10, +3.7158094943668318e-11, +4.9560347061220420e-11,
-    +2.2524387932468929e-10, +4.0317565967440064e-11, +5.5713929081544557e-11, +3.4599828081550613e-10,
-    +4.2879398426958087e-11, +6.8686553903469882e-11, +5.5109964519152443e-10, +4.4113542272307405e-11,
-    +7.4725128540916191e-11, +5.9542702955088661e-10, +4.6719014151869263e-11, +8.4087658837827043e-11,
-    +5.6795829722583407e-10, +5.5317541596020355e-11, +1.1901438214197849e-10, +8.6932590255342577e-10,
-    +6.3688707203764595e-11, +1.5801746532311892e-10, +1.6071986530530922e-09, +6.1720619669507874e-11,
-    +1.5246946805725237e-10, +1.8619994696615978e-09, +6.0936345529609304e-11, +1.5437506083081773e-10,
-    +2.4112186810151084e-09, +6.1389204469627373e-11, +1.4244743471109064e-10, +2.4304534790411904e-09,
-    +6.4869068951380576e-11, +1.3375246807460697e-10, +1.7379689546640221e-09, +6.1304947406038745e-11,
-    +1.1933059933255050e-10, +1.3667384231218017e-09, +6.1624231391366893e-11, +1.2503678314894266e-10,
-    +1.3450562138065782e-09, +5.9143652988521936e-11, +1.1352438085209915e-10, +6.7075743695886349e-10,
-    +4.4291087948085690e-11, +6.9619242693684483e-11, +2.6934245169507157e-10, +2.9763505426395912e-11,
-    +4.0030163062520036e-11, +1.0857708115073444e-10, +2.7206629347219478e-11, +3.4774296065280265e-11,
-    +1.0280210238947196e-10, +3.0133325703229708e-11, +4.1223061011337412e-11, +1.5874231458668061e-10,
-    +3.4183216620516128e-11, +5.2687185693628145e-11, +2.7439660405599711e-10, +3.7024147215939106e-11,
-    +6.0036723583678863e-11, +3.6098352576560158e-10, +4.1506749288334784e-11, +6.8815746977125634e-11,
-    +4.3703407695991099e-10, +4.9674610263095728e-11, +9.2598661225908691e-11, +6.7740561353472508e-10,
-    +6.0985777903691251e-11, +1.3115482870271539e-10, +1.2796379488616042e-09, +6.1943779390855737e-11,
-    +1.4006067146205486e-10, +1.3057844825353906e-09, +5.9829253278513383e-11, +1.4208487096746124e-10,
-    +1.8227380634939967e-09, +5.9088473224197176e-11, +1.3040019683095785e-10, +1.8227952101192157e-09,
-    +6.4827202778849197e-11, +1.3045460936680835e-10, +1.9601426898416040e-09, +6.1471726164288393e-11,
-    +1.1643712990834379e-10, +1.5662927509758529e-09, +5.6570805045139082e-11, +1.0802950827876590e-10,
-    +1.1902991037270310e-09, +4.2911170329822786e-11, +7.4283479306786684e-11, +2.8619830993825027e-10,
-    +3.0277578886725469e-11, +4.3037564052121998e-11, +9.9762759857285188e-11, +2.3976216070689004e-11,
-    +3.1125242295230441e-11, +6.3758166189679632e-11, +2.2988182966085722e-11, +2.9744651269819765e-11,
-    +6.8231351517663900e-11, +2.5828902434174630e-11, +3.6453508444354468e-11, +1.0719900892938087e-10,
-    +2.9782909893929615e-11, +4.6917243117904111e-11, +1.7583070170145041e-10, +3.2810888023065288e-11,
-    +5.3521285040491543e-11, +2.1037745575778604e-10, +3.6058306866491092e-11, +6.0307106942864296e-11,
-    +2.6841033024492619e-10, +4.2184017964596123e-11, +7.3689932218335828e-11, +3.8118497479631877e-10,
-    +5.4788811880978511e-11, +1.0862541119295206e-10, +8.8490979093757789e-10, +6.1366309437258385e-11,
-    +1.3559666861282874e-10, +1.5870912574029304e-09, +6.1351294817675452e-11, +1.4548126023655427e-10,
-    +2.5188062195501751e-09, +5.9049146052799847e-11, +1.2783911970822835e-10, +2.2112454474906479e-09,
-    +6.4844228819257893e-11, +1.3163994566449862e-10, +1.9220143042032362e-09, +6.2070877677407589e-11,
-    +1.1992939203576336e-10, +1.2772223809603887e-09, +5.0472477426424889e-11, +9.7271147816811232e-11,
-    +5.7561083443285864e-10, +3.7703748283082378e-11, +6.1917232756921917e-11, +1.9068616387359726e-10,
-    +2.7952437425333433e-11, +3.8938958456248039e-11, +8.1576479357693273e-11, +2.4682726651312901e-11,
-    +3.1331992327466616e-11, +6.5637601483943152e-11, +2.4970188546975242e-11, +3.2501166477996597e-11,
-    +7.8737677051293186e-11, +2.7942203065525556e-11, +3.9232152607441839e-11, +1.2090743241601264e-10,
-    +2.9805304690968809e-11, +4.7843198744068888e-11, +1.5948105347469973e-10, +2.9410726411223469e-11,
-    +4.8675244586804041e-11, +1.2539016952162902e-10, +2.9590847670907489e-11, +4.5961379635989023e-11,
-    +1.1304714533037269e-10, +3.5198280479973245e-11, +5.6747496198649576e-11, +1.8690479370594482e-10,
-    +4.7549042293934859e-11, +8.8510001638724629e-11, +6.1680444189450128e-10, +5.8221060036683791e-11,
-    +1.1715604363431987e-10, +1.2191324338820554e-09, +6.5240761533669252e-11, +1.5052937679753746e-10,
-    +3.1086668603096611e-09, +6.2896569984998945e-11, +1.3791314113724120e-10, +2.9557503977679180e-09,
-    +6.8319305235765509e-11, +1.4736273900291292e-10, +2.5906034342059987e-09, +6.8046208640538405e-11,
-    +1.4285086678594160e-10, +1.4864779169412901e-09, +5.3827663452896893e-11, +1.0129624118950953e-10,
-    +6.0587637154075070e-10, +3.9075193559837745e-11, +5.8990888815396937e-11, +1.7621385146385860e-10,
-    +3.1384184639848623e-11, +4.3243379619305378e-11, +9.8391194645097726e-11, +2.9960508684090453e-11,
-    +4.1181131396741103e-11, +9.9096657847575269e-11, +3.1473038357112907e-11, +4.4503944772721843e-11,
-    +1.3852259549430505e-10, +3.4943127675364898e-11, +5.4164694897316958e-11, +2.2002383786224166e-10,
-    +3.3482072371775238e-11, +5.8578368907202900e-11, +1.8612194344078991e-10, +2.9589396842577150e-11,
-    +4.8037331445072826e-11, +1.0549971990557433e-10, +2.9209135639087212e-11, +4.4581824980715780e-11,
-    +9.0234797106008719e-11, +3.1224633575077703e-11, +4.8941093922877337e-11, +1.0971068564703160e-10,
-    +4.2800761473362743e-11, +7.2248569359677805e-11, +2.7977437665897369e-10, +5.7009690321480728e-11,
-    +1.0819015845992739e-10, +1.0487412775938850e-09, +7.1215556334728181e-11, +1.6201072414402912e-10,
-    +3.9852084842490080e-09, +7.1286416380038251e-11, +1.6674754725876074e-10, +5.5352500749320921e-09,
-    +7.1060120485925741e-11, +1.7484720554250514e-10, +2.4165391360289291e-09, +6.6499237939912866e-11,
-    +1.4370008548520941e-10, +1.0197998100135270e-09, +5.1827195394952990e-11, +9.2674773999295776e-11,
-    +3.8846229519954146e-10, +3.6005366909728256e-11, +5.4112891729562815e-11, +1.2993788587947394e-10,
-    +2.8456918710258202e-11, +4.0956282940812474e-11, +7.8105239246328377e-11, +2.7811351872748083e-11,
-    +3.9337537983801998e-11, +8.0589976582447120e-11, +3.4294610239805441e-11, +4.9359929772716743e-11,
-    +1.4074767539017436e-10, +4.0965865733495919e-11, +6.5725354315955150e-11, +2.1927444082490079e-10,
-    +3.7181216622354852e-11, +6.2957703761565422e-11, +1.4715796491077474e-10, +3.1268286709309939e-11,
-    +4.8788086106625869e-11, +9.4583159992865683e-11, +2.9740416805352460e-11, +4.5993248694901361e-11,
-    +9.9391374226416236e-11, +3.1123875347560180e-11, +4.7940982707334688e-11, +1.0356037417129909e-10,
-    +3.8552306529522182e-11, +6.2637714296020530e-11, +1.7097433041310577e-10, +5.5164462711587729e-11,
-    +9.9412270867027144e-11, +5.5231404559399690e-10, +7.3302734533274070e-11, +1.6853782383929205e-10,
-    +2.1847908272850642e-09, +7.4321910775008508e-11, +1.8661855875610045e-10, +2.9601745136546301e-09,
-    +7.1824546252014562e-11, +1.7966878709858777e-10, +2.9218262380528063e-09, +6.4497055251530641e-11,
-    +1.3425344556980703e-10, +9.0346406018297844e-10, +4.6015093880021548e-11, +7.5693141105326041e-11,
-    +2.3531400965386267e-10, +3.4178722243651831e-11, +4.9812647556652515e-11, +1.0375257984252427e-10,
-    +3.0030488990591819e-11, +4.2787464014173790e-11, +7.1265432834406542e-11, +2.8233943636172971e-11,
-    +4.1897083235425763e-11, +7.2177473859338459e-11, +3.7380467407951755e-11, +6.0746264822385239e-11,
-    +1.4871251056149530e-10, +4.8493210310761756e-11, +8.8701589285827964e-11, +3.4676925837024879e-10,
-    +4.4683366003293761e-11, +8.3941504355056381e-11, +2.1702325691818814e-10, +3.3416713780777747e-11,
-    +5.3460558596756465e-11, +9.1680011531981992e-11, +2.9606024083453341e-11, +4.2287654045681282e-11,
-    +7.4806087542053531e-11, +3.1330261108043752e-11, +4.7288852573186561e-11, +9.2657150939167196e-11,
-    +3.8193341058581075e-11, +6.1819712007342470e-11, +1.6212074317787483e-10, +5.0463594990544602e-11,
-    +9.0215037583917933e-11, +3.6568256222125333e-10, +7.2983519078263498e-11, +1.5919636221933494e-10,
-    +1.4692988801513596e-09, +7.5144851520860019e-11, +1.7857680019346695e-10, +2.7438649710462599e-09,
-    +6.4337626110820198e-11, +1.3819556880272724e-10, +1.6351915165165335e-09, +5.6125471676716815e-11,
-    +1.0484891351195669e-10, +6.2822844990571013e-10, +4.1406546289944917e-11, +6.4497617462878701e-11,
-    +1.9520351768544794e-10, +3.3201529237428607e-11, +4.8425421790995908e-11, +1.1806164324267479e-10,
-    +3.0145693142257988e-11, +4.2359148105499548e-11, +9.0426848382142031e-11, +2.6611781732506867e-11,
-    +3.6927527972776042e-11, +7.1973462665157624e-11, +3.2464234015979461e-11, +4.7454018178790670e-11,
-    +1.2866713972058437e-10, +4.5296086913435980e-11, +7.8407194838773871e-11, +4.8941930976900090e-10,
-    +4.6143366922098418e-11, +8.2934944882697514e-11, +4.0653547221949522e-10, +3.5210540419948051e-11,
-    +5.2907647288908636e-11, +1.2470284852834689e-10, +2.9359068837704671e-11, +4.1858924671054838e-11,
-    +8.2794553838926736e-11, +3.0898961617841852e-11, +4.6030691956006619e-11, +1.0770899851567734e-10,
-    +3.4730910025506277e-11, +5.7383491828620416e-11, +1.6502619187377658e-10, +4.3695754166252892e-11,
-    +8.0252966460599537e-11, +2.8291752225063303e-10, +6.4191671479173698e-11, +1.4028938710431539e-10,
-    +9.1997967054683942e-10, +6.8952551779214810e-11, +1.4854312296973383e-10, +1.8124765670568700e-09,
-    +5.8317459550712216e-11, +1.4156925696999471e-10, +3.6712664196150794e-09, +5.3629099559276002e-11,
-    +1.1598255912777383e-10, +1.0877754854371668e-09, +4.2021357686929537e-11, +7.6520646010515336e-11,
-    +3.0993566869572065e-10, +3.2352035060577812e-11, +5.0725065040935278e-11, +1.2356134649925044e-10,
-    +2.8230527751596867e-11, +4.0409024590278733e-11, +7.9701082232406937e-11, +2.7043719425893202e-11,
-    +3.8345230709152248e-11, +8.0595798437172181e-11, +3.2919745397671580e-11, +4.9961670952359246e-11,
-    +1.5935233878226930e-10, +4.2540033167411335e-11, +7.4744349615701654e-11, +7.9678325786525163e-10,
-    +4.4244525788672552e-11, +7.9988427012017684e-11, +8.7355705332715082e-10, +3.6530682512343860e-11,
-    +5.7162157860531653e-11, +1.8865231815456288e-10, +3.1743877303187577e-11, +4.5995926328193340e-11,
-    +1.1986477631221824e-10, +3.1120521009632139e-11, +4.6150983619207369e-11, +1.1935702384147024e-10,
-    +3.2435634852453985e-11, +5.3486853493905408e-11, +1.5455912173507835e-10, +3.9565080941128046e-11,
-    +7.3547175835808971e-11, +2.6679049295632079e-10, +5.7900940455219717e-11, +1.2824525563592472e-10,
-    +1.0314987313169232e-09, +6.0898064125574533e-11, +1.3412460571887459e-10, +2.7584792196216410e-09,
-    +5.5245145662623627e-11, +1.2730320327304928e-10, +2.0325646904719850e-09, +5.1416229682756561e-11,
-    +1.1759264454273642e-10, +1.1044855343326119e-09, +4.3699227722614095e-11, +9.2192899062640572e-11,
-    +5.2501368341849943e-10, +3.6966819520387674e-11, +6.9720273334308756e-11, +2.2356123173717493e-10,
-    +3.4684950183025754e-11, +6.0332904983966736e-11, +1.6132528512653802e-10, +3.4195942895937984e-11,
-    +6.1681053326503291e-11, +1.9086240032512031e-10, +3.7145239701891068e-11, +7.0754189990909598e-11,
-    +4.2163674831173414e-10, +3.8846203050084402e-11, +8.2400299015984521e-11, +8.8714765776370015e-10,
-    +3.8406483873307763e-11, +8.0045522842983508e-11, +9.0369675058057263e-10, +3.4667858937508547e-11,
-    +6.2421226826665382e-11, +3.2149489974173685e-10, +3.0373360121204282e-11, +4.9679729511395504e-11,
-    +1.4885560611605424e-10, +2.8403549932465609e-11, +4.4519501294322127e-11, +1.2164434286321435e-10,
-    +2.9574623510456892e-11, +4.7900966451004874e-11, +1.3182760091884443e-10, +3.7024069286834734e-11,
-    +6.4963132716358702e-11, +2.3045661790932368e-10, +5.1354614533346275e-11, +9.8776209085594513e-11,
-    +7.5121054518172288e-10, +5.6281086070306363e-11, +1.0771525843824757e-10, +1.4822020270977252e-09,
-    +6.0761497129119672e-11, +1.3030770108267373e-10, +2.4858785257908004e-09, +5.7406365676308311e-11,
-    +1.3618133052169774e-10, +1.3388210519344248e-09, +4.5106068881057844e-11, +1.0296662369193761e-10,
-    +5.2766170980499949e-10, +3.8279538907631476e-11, +8.1376319309498088e-11, +3.6616193817607571e-10,
-    +3.5657275485613168e-11, +7.2785119582422375e-11, +3.1478467262597506e-10, +3.3085081222896944e-11,
-    +6.7205673547908718e-11, +2.8953879195291930e-10, +3.2147862957897690e-11, +6.7842632537029360e-11,
-    +3.3059141136320277e-10, +3.2193587478484251e-11, +7.3530624257666013e-11, +3.8620268194581988e-10,
-    +2.9711891644625922e-11, +6.7332425581317292e-11, +2.9541325740332042e-10, +2.6018748620427157e-11,
-    +5.1921947451275466e-11, +1.6223665340219804e-10, +2.5090896407151194e-11, +4.3544958112034879e-11,
-    +1.0797178292331729e-10, +2.6313767640805916e-11, +4.3278191246367449e-11, +1.0347114868397737e-10,
-    +3.1040666294934608e-11, +5.0786165909815797e-11, +1.4665055483306660e-10, +4.2111371361777309e-11,
-    +7.0107616974892824e-11, +3.2082371710091891e-10, +5.7290575913481192e-11, +1.0234582347513019e-10,
-    +1.0284984781734857e-09, +5.8424039162957995e-11, +1.0627991828389132e-10, +1.3884058952597463e-09,
-    +6.4950856845995361e-11, +1.6190606647137216e-10, +4.1005297183204818e-09, +6.7100995525661446e-11,
-    +1.9396848400188461e-10, +2.2152822303566278e-09, +5.2977388092517972e-11, +1.4204450379558524e-10,
-    +5.3652626811335130e-10, +3.9983123713630952e-11, +9.2389215007403651e-11, +2.5998534549442389e-10,
-    +3.3154131428082947e-11, +7.1451215181180103e-11, +2.4022321535405194e-10, +2.8839508961791750e-11,
-    +5.9079662647925691e-11, +2.4324056181845095e-10, +2.7315539042968807e-11, +5.3673097405224801e-11,
-    +2.1693201536614160e-10, +2.7418781733235508e-11, +5.2622741536776861e-11, +1.7757094374230311e-10,
-    +2.6086082405926117e-11, +4.8821329273592176e-11, +1.3469832737184034e-10, +2.3983788387907848e-11,
-    +4.3457354781327983e-11, +1.0703130696264834e-10, +2.5213863536032711e-11, +4.5327776538715904e-11,
-    +1.1170567647702242e-10, +3.0675087838284490e-11, +5.5056135626510176e-11, +1.5146132833226152e-10,
-    +4.1821268288384106e-11, +7.6507381299675331e-11, +2.8996227605577053e-10, +5.6110651903686840e-11,
-    +1.1811011367890836e-10, +7.2170157375637912e-10, +6.6455293683027407e-11, +1.6253227360082731e-10,
-    +2.2081240810988557e-09, +6.2686291076723228e-11, +1.3582437314511117e-10, +2.5199615541561311e-09,
-    +6.1120028067863379e-11, +1.6229489260126758e-10, +4.1801755833427643e-09, +6.5248660543346636e-11,
-    +2.0881366606078703e-10, +6.1666982740787235e-09, +6.5374784476143409e-11, +2.0436568172360059e-10,
-    +2.6659592916920299e-09, +5.7253475827756523e-11, +1.5043194733759783e-10, +1.0509059570731540e-09,
-    +4.6754778129132347e-11, +1.0232187498197898e-10, +7.3094893740493887e-10, +3.7271967909205822e-11,
-    +7.3866927075220512e-11, +6.0567648933475622e-10, +3.2119342659392366e-11, +6.2919868525832436e-11,
-    +3.6313159210459400e-10, +3.0475452943759014e-11, +6.0955434135537979e-11, +2.4144203975917586e-10,
-    +3.0998040717039196e-11, +6.3619364543892647e-11, +2.2009873501154674e-10, +3.4414841333615341e-11,
-    +7.1432587057374132e-11, +2.7539486093818691e-10, +4.1625583566783030e-11, +8.0198646973582985e-11,
-    +3.7857313303476768e-10, +4.9546547566414319e-11, +9.3964580914382883e-11, +4.2025744945297778e-10,
-    +5.7103136295877390e-11, +1.2227064454797153e-10, +7.1381130968079150e-10, +6.3973447228078813e-11,
-    +1.7333538143415607e-10, +2.0701632951638476e-09, +6.4846154116297010e-11, +1.9272133526115235e-10,
-    +6.9425872541415830e-09, +5.8078640472573782e-11, +1.3384851141738720e-10, +2.3575083024193055e-09,
-    +5.3308090485448866e-11, +1.1761641240053308e-10, +2.3428045996404834e-09, +5.4016005877342123e-11,
-    +1.2588848677668070e-10, +2.4454378731483156e-09, +5.6770488894980083e-11, +1.3471080100887468e-10,
-    +2.2153907890311702e-09, +5.8545330229852489e-11, +1.2790337542982143e-10, +1.3115555979152890e-09,
-    +5.3926604409818575e-11, +1.0336674404883356e-10, +6.3575799439882141e-10, +4.6139482079140285e-11,
-    +7.4041768931810026e-11, +3.0320516779031032e-10, +4.5734323994568016e-11, +7.0225217034405477e-11,
-    +2.6635147407419730e-10, +5.0442942782059953e-11, +8.0033981269555205e-11, +2.7230814190225774e-10,
-    +5.5732403634076115e-11, +9.1949732077103227e-11, +3.1062367371903383e-10, +6.0142192546361167e-11,
-    +9.9569022347078099e-11, +4.0532350579259630e-10, +6.9219001468598275e-11, +1.1535755271127812e-10,
-    +6.3413538969777207e-10, +7.1641379788183078e-11, +1.3899029754196754e-10, +1.0283062890201849e-09,
-    +6.5624406020991051e-11, +1.4222852910803256e-10, +1.6462345879579576e-09, +5.8645664043258137e-11,
-    +1.3889741910025984e-10, +2.2850188513255281e-09, +5.4521424254479515e-11, +1.3200031946558835e-10,
-    +2.8367024626273623e-09, +5.0286695157644799e-11, +1.0385092274563138e-10, +1.7878982321389062e-09,
-};
-
-const double GREEN_COV[] = {
-    +2.7465667771091461e-09, +5.4328435854831353e-09, +5.9694147484300480e-08, +2.7775290269073450e-09,
-    +4.4635910480021312e-09, +4.6219497038508832e-08, +2.4124799265687450e-09, +3.0756141806986246e-09,
-    +2.0409479051924977e-08, +2.1762657712865082e-09, +2.4090487087991587e-09, +1.1227933895898481e-08,
-    +2.2879091043730230e-09, +2.3130448482672849e-09, +9.7964329639741812e-09, +2.0492336121420178e-09,
-    +1.7995450717666717e-09, +3.8634599027394929e-09, +2.2036287326223140e-09, +1.5882443464564425e-09,
-    +3.4270274528305723e-09, +2.3924736740151886e-09, +1.6170593003345627e-09, +3.4466269363180273e-09,
-    +2.4037453178857155e-09, +1.7440193578056480e-09, +4.1862830483027977e-09, +2.7943227219924643e-09,
-    +2.3320472349357808e-09, +6.9066744796810088e-09, +3.3869825613175817e-09, +3.2985016941978908e-09,
-    +1.2192079729959105e-08, +4.3617436333623594e-09, +5.6372994988029396e-09, +5.6010136938624003e-08,
-    +4.6010633950112130e-09, +7.8151534277563682e-09, +1.3302735268517662e-07, +4.5144205512566925e-09,
-    +8.5273569249996088e-09, +2.3114167112192268e-07, +4.2359268774139522e-09, +8.3138048293246312e-09,
-    +1.1685599870336571e-07, +3.4289854423143204e-09, +7.2186008386671518e-09, +6.4657411734065807e-08,
-    +2.9000361231399473e-09, +5.7972442463234815e-09, +4.3617189202774119e-08, +2.4825697474681076e-09,
-    +3.7705456893215502e-09, +2.1076734044559255e-08, +1.9124024040573491e-09, +2.4664978008545250e-09,
-    +9.6673371641703307e-09, +1.7077134930341784e-09, +1.7731238053500776e-09, +5.6424785329506203e-09,
-    +1.4590407836055162e-09, +1.2688443191221545e-09, +3.1905057593239384e-09, +1.1529667758868615e-09,
-    +1.0527699007223545e-09, +2.0607760316646099e-09, +1.3241246975313541e-09, +1.0866973078142397e-09,
-    +2.4458565564661720e-09, +1.7386400445546730e-09, +1.3113704296886542e-09, +2.7298790842918743e-09,
-    +1.9347629620610251e-09, +1.6462313358584036e-09, +2.7266458143883131e-09, +2.0058472815156033e-09,
-    +1.8960314887297396e-09, +3.0689592598450895e-09, +2.1285614006450027e-09, +2.0821091355784337e-09,
-    +4.2208295651349895e-09, +2.4900460967542625e-09, +2.8139427972872339e-09, +7.1169306221177032e-09,
-    +3.0118938694981558e-09, +4.5099481134528415e-09, +2.1124659552346148e-08, +3.2913566758609001e-09,
-    +5.5870013407853480e-09, +4.9156037533780670e-08, +3.7645734969184658e-09, +7.2743937172923580e-09,
-    +6.0004988814769882e-08, +3.3389315975153908e-09, +7.0924736789968250e-09, +4.0024685625106058e-08,
-    +2.9176605470652602e-09, +5.8272616326433475e-09, +3.5816515002230837e-08, +2.4010756761403359e-09,
-    +4.0357755195273058e-09, +1.7861365475312999e-08, +2.1640512221315876e-09, +2.7393479898696008e-09,
-    +7.9456813517504852e-09, +1.8639238619460128e-09, +1.7862192403244916e-09, +3.6761502630978417e-09,
-    +1.7945315852731685e-09, +1.6774959627243407e-09, +4.3311950324519400e-09, +1.6627209163129894e-09,
-    +1.5091768190362052e-09, +4.3064320813583494e-09, +1.6536796287527560e-09, +1.2399208215825468e-09,
-    +2.8913852768828587e-09, +1.7028497809218252e-09, +1.1211888535875524e-09, +2.0855841522349906e-09,
-    +1.8406991545269359e-09, +1.3058259000750060e-09, +2.1684954300617699e-09, +2.0521708580570293e-09,
-    +1.6354250305539509e-09, +2.4694767061065697e-09, +2.5021678093804395e-09, +2.1770201671158649e-09,
-    +4.2501137362311757e-09, +3.1042719901528936e-09, +3.1055435657592158e-09, +8.7141594573190842e-09,
-    +3.5163759261997681e-09, +4.0083145109230577e-09, +1.1073853622768600e-08, +3.3192944769220214e-09,
-    +4.4689078218538220e-09, +2.7329908148824785e-08, +3.3794179946728982e-09, +6.0691075561232632e-09,
-    +3.9860756809881590e-08, +2.9583313030552190e-09, +6.4499708238794764e-09, +2.5964954425922523e-08,
-    +2.8010198546903129e-09, +5.1683381752823244e-09, +2.1269662287321159e-08, +2.6455253844232149e-09,
-    +4.0160306933338259e-09, +1.5120421836786179e-08, +2.6130903634529344e-09, +2.9349578043024179e-09,
-    +1.1010385535145618e-08, +2.2307754565203325e-09, +2.2938668668252030e-09, +7.2370268351343294e-09,
-    +1.8125498928147734e-09, +1.7612104980100753e-09, +4.4900348413682598e-09, +1.3991031561289429e-09,
-    +1.1706521153079100e-09, +2.3650258408281192e-09, +1.4667068092586711e-09, +1.0802717519952390e-09,
-    +2.3280241369356315e-09, +1.7538116961951134e-09, +1.2345146631707388e-09, +2.6697968717888620e-09,
-    +2.0632262436452637e-09, +1.4695018822563072e-09, +2.9179130568762995e-09, +2.3003584940786851e-09,
-    +1.6916045232767427e-09, +3.1320301254568221e-09, +2.4637777186049584e-09, +1.8601691815313812e-09,
-    +4.0499540611685853e-09, +2.6094292807363097e-09, +2.1085504501933401e-09, +5.0785524851716286e-09,
-    +2.8175819854582293e-09, +2.4936642164080025e-09, +6.8120243210249215e-09, +3.5129314748862671e-09,
-    +3.5531721066566759e-09, +1.7064706346011020e-08, +3.1877516787728258e-09, +4.7447150884231654e-09,
-    +2.4085195502301711e-08, +2.7615389240112681e-09, +5.4137569009091517e-09, +1.7874940871929913e-08,
-    +2.9829102716935817e-09, +6.1784840089805365e-09, +2.8971314661185878e-08, +3.0305586900708274e-09,
-    +4.5385629233239602e-09, +8.5532750271970423e-09, +2.6311297788950298e-09, +2.7753484921147266e-09,
-    +7.3903389542748851e-09, +1.9025152299626009e-09, +1.7261494874351868e-09, +4.3082463959009383e-09,
-    +1.4597723291486891e-09, +1.1686657010971485e-09, +2.1906619350325835e-09, +1.2902356587174461e-09,
-    +9.4076751695639986e-10, +1.8053266744845899e-09, +1.5723574256295617e-09, +9.9327891761395394e-10,
-    +2.1748226819764965e-09, +2.0326194732413327e-09, +1.2510942054281986e-09, +3.8207994471883938e-09,
-    +2.4006829597322089e-09, +1.5977703025952159e-09, +4.9048887865271262e-09, +2.4097583975989615e-09,
-    +1.5587740647885259e-09, +2.9460782161788621e-09, +2.2404788838998895e-09, +1.4941964267723937e-09,
-    +3.0206680968100345e-09, +2.6031901246337327e-09, +1.5385293023929186e-09, +3.7921355893552000e-09,
-    +2.9272480132628708e-09, +1.9781383234230606e-09, +6.5809337280165005e-09, +3.5968003885235220e-09,
-    +3.1440326867975022e-09, +1.4116862294144603e-08, +3.4421902951499487e-09, +5.3645412012884667e-09,
-    +2.8056353205470635e-08, +2.7520989288415340e-09, +6.2611710640154610e-09, +2.1200912546638590e-08,
-    +3.2291728017586191e-09, +7.3939252146314172e-09, +3.4787786328267769e-08, +3.2191268568434758e-09,
-    +3.9925683769556013e-09, +8.2483777235040229e-09, +2.5973215002551843e-09, +2.1219567434831355e-09,
-    +4.3390600348918490e-09, +2.0319291205578513e-09, +1.3659370841101467e-09, +2.8657688952086347e-09,
-    +1.5186904989117099e-09, +8.9987676736595303e-10, +1.5683195658635543e-09, +1.2406036354988852e-09,
-    +7.0464088132152003e-10, +1.2178143821713237e-09, +1.5447042801983820e-09, +7.5386185088518923e-10,
-    +1.4381383749736157e-09, +2.0445234188411810e-09, +9.6530390695239987e-10, +2.5602594767678122e-09,
-    +2.2784337083367004e-09, +1.1146492294567588e-09, +2.8473646733062925e-09, +1.9009271698134575e-09,
-    +9.1457350203211295e-10, +1.8943272251490740e-09, +1.6595646400020648e-09, +8.9365210145674091e-10,
-    +1.7582827173410531e-09, +2.5292461090539436e-09, +1.2410688481565941e-09, +2.9868028623284493e-09,
-    +3.9111717972003803e-09, +2.1889570265729647e-09, +7.5677912714775518e-09, +3.8733411104600245e-09,
-    +3.3807772339921517e-09, +1.2178398781936071e-08, +3.6780126355990889e-09, +5.8989243730229340e-09,
-    +3.8734390960384881e-08, +2.8442243009779112e-09, +7.1014359380422334e-09, +2.0627083554601744e-08,
-    +3.7853721115987910e-09, +8.0676422753523156e-09, +1.7664314780915716e-07, +3.0910685580119863e-09,
-    +2.8830907480115832e-09, +9.4387447692718060e-09, +2.4611437031757771e-09, +1.5657102417620876e-09,
-    +3.5275452658047803e-09, +2.1094846096443352e-09, +1.1634448364166384e-09, +2.1295306571290176e-09,
-    +2.1270824517418530e-09, +1.0014518036783409e-09, +1.7029156065967354e-09, +1.5608118819601478e-09,
-    +7.7284666850930000e-10, +1.2889246362684637e-09, +1.7636682094877643e-09, +7.8822266635469124e-10,
-    +1.4694694914335521e-09, +2.0220893403516137e-09, +8.7474129668296099e-10, +2.0061529070767583e-09,
-    +2.3816414068230966e-09, +9.9704354554084695e-10, +2.3410249682931027e-09, +2.4469246684951157e-09,
-    +9.9157734274368876e-10, +2.4071715745793755e-09, +2.7434970128982816e-09, +1.1800865386016877e-09,
-    +2.4098907449280987e-09, +5.3472724319963402e-09, +1.8611904750130475e-09, +4.2469302689002110e-09,
-    +6.0892609787289873e-09, +2.6877047942022994e-09, +8.1981989360361239e-09, +4.7496804189404204e-09,
-    +3.5239743427744652e-09, +9.4761228757860985e-09, +4.3119188452374288e-09, +6.6075833741070696e-09,
-    +2.3622835353963723e-08, +2.8546545689412946e-09, +7.1115904765591337e-09, +1.4482510710070118e-08,
-    +3.5912912207822630e-09, +5.1468594319243644e-09, +3.1387968759303653e-08, +3.4827284409262079e-09,
-    +2.8408617082412213e-09, +8.7236946040049400e-09, +3.6179703880050045e-09, +1.9576676262546489e-09,
-    +4.4617454872154882e-09, +3.0883402336479584e-09, +1.4596266303396347e-09, +2.6299936771533020e-09,
-    +2.4537127275730456e-09, +1.1485144348814371e-09, +1.9944183768533293e-09, +2.1159270247323112e-09,
-    +9.2615020777702940e-10, +1.6051255098920001e-09, +2.3740838680405330e-09, +8.7343706440192194e-10,
-    +1.6253751989696911e-09, +2.6669190567744163e-09, +9.4702764770792022e-10, +1.6372976375640318e-09,
-    +3.3226526552973593e-09, +1.1118764267744234e-09, +1.9026446743850129e-09, +2.7895841424928867e-09,
-    +1.1685654341679651e-09, +1.8582031523743769e-09, +2.8247119278977858e-09, +1.3982206113067741e-09,
-    +2.4803974745674382e-09, +5.6795392344302496e-09, +2.2382241771807192e-09, +6.1661704882875239e-09,
-    +8.6282296121340662e-09, +3.0649465765559772e-09, +7.7092579190904427e-09, +6.5528617621847615e-09,
-    +4.0397111524115779e-09, +8.1297335729403878e-09, +5.3085831332691985e-09, +8.3370870372961611e-09,
-    +2.1155187026556131e-08, +2.9542534648614669e-09, +6.8869579067962083e-09, +1.2822990123566308e-08,
-    +3.5704302408786030e-09, +5.4658335635861378e-09, +3.1755436395750378e-08, +5.0535907781388286e-09,
-    +5.2506028466531794e-09, +3.3013453873816759e-08, +5.2087014420305429e-09, +2.4784305841942679e-09,
-    +6.1096953894668147e-09, +3.3474527663619197e-09, +1.2861404816187864e-09, +2.4232244878485386e-09,
-    +2.5367898519050295e-09, +9.5902424024970652e-10, +1.7293394232436157e-09, +1.9624530106080956e-09,
-    +8.2023790637929340e-10, +1.2843044278690215e-09, +2.5414774779183687e-09, +9.4011564763070752e-10,
-    +1.3763183597011351e-09, +4.3088144369895651e-09, +1.1663641512678149e-09, +1.6901246074958125e-09,
-    +5.8459006215250482e-09, +1.2985590289113804e-09, +1.7937496080993441e-09, +4.4850514826277397e-09,
-    +1.2636400769116543e-09, +1.6930098978556115e-09, +3.1167992045529456e-09, +1.1531461174243060e-09,
-    +1.7284790926997493e-09, +2.8916066695150666e-09, +1.3828891838305721e-09, +2.1328300036526211e-09,
-    +3.9365474064567175e-09, +2.0693790748001133e-09, +3.2481112208889780e-09, +5.2863982648434059e-09,
-    +3.6449630851078534e-09, +5.9932391108643941e-09, +6.2327721891660686e-09, +7.4909430191606040e-09,
-    +1.6124106343576512e-08, +3.5032630670897859e-09, +7.3775735383434913e-09, +1.1526610719648845e-08,
-    +3.9807427429835737e-09, +4.7893123773968987e-09, +6.1351345597590028e-08, +4.5810895710162814e-09,
-    +3.3784420551629119e-09, +1.7574096035510662e-08, +3.9985617813042698e-09, +1.7500844691394638e-09,
-    +4.5213832967829939e-09, +3.2682913824657142e-09, +1.2234585337316108e-09, +2.3565414672554432e-09,
-    +2.4371399401439905e-09, +9.8221241698774186e-10, +1.4272978690338578e-09, +2.2054240415008235e-09,
-    +9.6794687387962149e-10, +1.2878222761885029e-09, +3.3022175173254429e-09, +1.2349136297887832e-09,
-    +1.6225673389419062e-09, +6.0337867561168314e-09, +1.6481598070780186e-09, +2.0897549281912050e-09,
-    +8.3945878715279481e-09, +1.9728545434211754e-09, +2.3600940328489339e-09, +4.6477284220365721e-09,
-    +1.6496322859934052e-09, +1.8153573169350031e-09, +2.5184491447587200e-09, +1.2527071298594196e-09,
-    +1.2934339970416121e-09, +2.3661385452532065e-09, +1.2767363416032474e-09, +1.4669501536102923e-09,
-    +3.0501715613222254e-09, +1.7861356829648171e-09, +2.4968830721966914e-09, +4.3878085424147119e-09,
-    +2.6027365103999298e-09, +5.7353383058984132e-09, +6.8486489201142660e-09, +5.7360956281940061e-09,
-    +1.5516608970483708e-08, +4.0261945667945655e-09, +9.0858325058941737e-09, +1.4195683033167746e-08,
-    +4.6009164813988794e-09, +5.5673174105420155e-09, +7.8756770818033167e-08, +5.0136787947874184e-09,
-    +3.4167859264473672e-09, +1.3834991796057341e-08, +3.9807514584746676e-09, +1.7187630005622073e-09,
-    +4.4704201485483886e-09, +3.5943220796031748e-09, +1.3990111601652460e-09, +2.4898626425194603e-09,
-    +3.4848963425075551e-09, +1.3715906335617303e-09, +2.0296196975127429e-09, +3.3637009262061490e-09,
-    +1.5409703068721046e-09, +1.8239474121233087e-09, +4.0770779579014094e-09, +1.8561005312751869e-09,
-    +2.0016847740372411e-09, +7.6162302811704666e-09, +2.7631246132644438e-09, +2.6308758734846600e-09,
-    +8.1495095327706138e-09, +2.6972282697002005e-09, +2.3302261810041258e-09, +3.4330395471977257e-09,
-    +1.5637374514154829e-09, +1.3047191871746659e-09, +2.7545270369513312e-09, +1.2936012990996234e-09,
-    +1.2086018791818227e-09, +2.7267933991345157e-09, +1.3515098049177922e-09, +1.4795489034714661e-09,
-    +3.1876440693590451e-09, +1.7385698261390712e-09, +2.5931607185701266e-09, +3.9972952541500478e-09,
-    +2.1998901546448197e-09, +5.5779177065369393e-09, +5.2068943592625362e-09, +4.3265889124124193e-09,
-    +1.4361060409786314e-08, +4.1163536593402204e-09, +8.0279751814505223e-09, +1.6750856190700233e-08,
-    +4.7357184713113893e-09, +6.6114198354006711e-09, +5.8128649280271471e-08, +4.7624147711704352e-09,
-    +3.8862210693721582e-09, +1.2237151941899551e-08, +4.5650026962503827e-09, +2.1989867460493824e-09,
-    +5.2714676421158949e-09, +3.6198893095043240e-09, +1.7105514894805861e-09, +2.9188724987484623e-09,
-    +2.8467675201054612e-09, +1.3654350742237767e-09, +1.8074233737302974e-09, +2.1383227485181193e-09,
-    +1.1301379491247213e-09, +1.3801581026588928e-09, +3.3415498591434930e-09, +1.5272932395429248e-09,
-    +1.8146835339541210e-09, +4.6884762799506358e-09, +2.0274590908884439e-09, +2.3827960921219605e-09,
-    +5.4726506445734527e-09, +2.0503264897870591e-09, +2.2967261769166228e-09, +3.6523181440397587e-09,
-    +1.2633060855939048e-09, +1.4454098942594355e-09, +2.1428357252140767e-09, +9.1557046704076043e-10,
-    +1.0736712509526584e-09, +1.9596167241302329e-09, +9.9001444600368589e-10, +1.2937456798031358e-09,
-    +2.7277594513107483e-09, +1.4958525893876205e-09, +2.5188631934141045e-09, +3.8454044212022005e-09,
-    +2.3072256393605486e-09, +6.4050707253994132e-09, +5.0662623802797228e-09, +4.1275689406067302e-09,
-    +1.6557330061649165e-08, +4.8740019085909160e-09, +8.3842402743504772e-09, +2.4193251239341608e-08,
-    +5.5893268584186146e-09, +8.4880751160016522e-09, +1.3637446573598374e-07, +6.7350888382800830e-09,
-    +8.9498127703643328e-09, +6.6163335706611858e-08, +8.1232550588119059e-09, +5.0752504594230740e-09,
-    +1.5613241033889417e-08, +6.8284121297154699e-09, +3.0894353757484618e-09, +6.1818317436330730e-09,
-    +4.5588716985841994e-09, +2.1391403818597793e-09, +3.2793927768770298e-09, +3.8213218532367039e-09,
-    +1.8079489552948621e-09, +2.4310451013540449e-09, +5.3951161606545085e-09, +2.1784895242898061e-09,
-    +2.5775950780677643e-09, +7.7094451365084677e-09, +2.7058823265190288e-09, +3.0921849505949673e-09,
-    +7.1499196803048134e-09, +2.2372309044964992e-09, +2.8244473691220336e-09, +3.8420232131123551e-09,
-    +1.3346900528904432e-09, +1.8433274489221283e-09, +3.0266264953831390e-09, +1.2105740823030409e-09,
-    +1.8218009051767169e-09, +3.6008171420760100e-09, +1.4350464174589263e-09, +2.3761647427902252e-09,
-    +4.9334336484575657e-09, +2.0858567376315011e-09, +4.6742098847657205e-09, +6.1642129944926471e-09,
-    +3.1545815860618695e-09, +1.1854736188198002e-08, +6.9076176800225620e-09, +5.8042788691089390e-09,
-    +3.7423831743051064e-08, +5.7942442654408032e-09, +1.0726274893123139e-08, +4.5126962678783384e-08,
-    +5.9561095123887476e-09, +9.1929076607082711e-09, +8.6641665925158242e-08, +6.1092508408360374e-09,
-    +1.0916040139633171e-08, +8.9720369421826868e-08, +6.5565777486103240e-09, +6.4403883036339870e-09,
-    +2.0777061691729401e-08, +5.8254471972990116e-09, +4.2728819483347018e-09, +8.0680731733250929e-09,
-    +4.9646445075484790e-09, +3.0331592460683482e-09, +4.6587068405343942e-09, +3.8151623869885452e-09,
-    +2.1472534402870487e-09, +3.2295188251736573e-09, +4.8503442999925076e-09, +2.1090624407360099e-09,
-    +3.3608115413467922e-09, +6.2103700373841229e-09, +2.1726298646646480e-09, +3.4974230864289331e-09,
-    +5.6822904899294193e-09, +1.9128409396761537e-09, +2.8724215051292828e-09, +4.1784849716881051e-09,
-    +1.5186956883763156e-09, +2.1052569041736995e-09, +3.1803554683943025e-09, +1.3380193070860722e-09,
-    +1.7125154107763400e-09, +3.4069915712152960e-09, +1.4428279684427718e-09, +1.8783953134066954e-09,
-    +6.1833335774719382e-09, +2.4193941870343285e-09, +3.8339361092413570e-09, +8.6837116173759157e-09,
-    +4.4695032407719997e-09, +1.5993175136414970e-08, +8.8733647597743738e-09, +8.8376438307753540e-09,
-    +5.3118617964047155e-08, +6.9094136691597682e-09, +1.8309977705588010e-08, +1.3667044287100311e-07,
-    +5.4948091883825603e-09, +1.0938156853409914e-08, +2.3473732072230511e-07, +5.4496559934627217e-09,
-    +1.0874884336089532e-08, +1.3394087126661551e-07, +4.8395265973146767e-09, +6.4863739671819527e-09,
-    +2.3933951293595356e-08, +4.9843558266628587e-09, +4.0675946203148861e-09, +1.2099635025399125e-08,
-    +5.1499274959732515e-09, +3.1740916823241639e-09, +9.7857583377033950e-09, +5.2115981552839552e-09,
-    +2.6201850657149389e-09, +8.1069290319675544e-09, +5.9855171673281390e-09, +2.3454044758024429e-09,
-    +7.9303976909663886e-09, +6.3917424414657783e-09, +2.2671998343783320e-09, +8.2232865037176993e-09,
-    +6.2130551934086214e-09, +2.1879991393549234e-09, +5.2540945539781016e-09, +5.4313673117970443e-09,
-    +2.0053911290693214e-09, +3.6080060080227414e-09, +4.8661587133382002e-09, +2.2084458828209547e-09,
-    +3.1969925660747453e-09, +5.6179314168662829e-09, +2.8215627015662760e-09, +3.7799497562274494e-09,
-    +7.3561459138915571e-09, +3.8743016760101044e-09, +6.7876234284352195e-09, +7.6135286953630057e-09,
-    +5.4314454872620610e-09, +2.2131164284479226e-08, +8.2917996398389933e-09, +1.1529377586205104e-08,
-    +1.1967805167961505e-07, +7.5571417593060623e-09, +2.2133838852505643e-08, +4.7923912163136897e-07,
-    +3.7508326238914936e-09, +7.5463575954288875e-09, +1.1694345818879671e-07, +3.9844456644551385e-09,
-    +9.7332968620210979e-09, +8.1560872835099230e-08, +3.9963449269444446e-09, +8.7368566332762118e-09,
-    +2.5924317946101311e-08, +3.9667325846387481e-09, +5.5288251908269830e-09, +1.4093334034805502e-08,
-    +5.2327429618416715e-09, +5.3975605325753456e-09, +1.0361755729462877e-08, +6.7065423816492072e-09,
-    +4.9484901515718092e-09, +7.3067533083937644e-09, +7.3440062748364798e-09, +4.9343959476056118e-09,
-    +6.7044016763659079e-09, +9.1966461928170077e-09, +5.4021112563624814e-09, +6.7315022072158162e-09,
-    +8.9638545205493700e-09, +5.0775914105960683e-09, +7.3643292994900652e-09, +9.7754538178675121e-09,
-    +5.1702150878240330e-09, +7.5102471125897420e-09, +1.0020329143563150e-08, +4.7281010682288697e-09,
-    +7.4526371309266791e-09, +8.7049747476952153e-09, +4.6653443308002278e-09, +9.2943600122577655e-09,
-    +7.0154519749483451e-09, +5.7122061122079017e-09, +1.8892305940264295e-08, +5.9413455749134618e-09,
-    +8.9388502284113314e-09, +6.9869723010566449e-08, +5.7153696423031851e-09, +1.2597422005612645e-08,
-    +1.4041254046864951e-07, +5.2582660191588879e-09, +1.3847498139969468e-08, +2.1902729540058060e-07,
-};
-
-const double PURPLE_COV[] = {
-    +5.1882925239079436e-10, +9.7665006373603629e-10, +1.0153036619434342e-08, +4.9271608183622396e-10,
-    +8.9845160769069213e-10, +4.9815795882486383e-09, +5.3345953392640283e-10, +1.0080970242093886e-09,
-    +4.4865022927978394e-09, +7.0605171846771705e-10, +1.3163566311348784e-09, +3.8251657355378242e-09,
-    +8.1574803473592873e-10, +1.4133044874872331e-09, +2.2484576204670581e-09, +6.3531477170038959e-10,
-    +1.0292426984244160e-09, +1.0674433088143971e-09, +5.7593231241694332e-10, +8.7072286918899928e-10,
-    +8.0707435472966481e-10, +7.0564050868661664e-10, +1.1210791351701008e-09, +1.0242806957829353e-09,
-    +9.1919976589894264e-10, +1.6554472015882710e-09, +1.4366921854279225e-09, +9.6061820684606044e-10,
-    +1.6855102470418497e-09, +1.3374002408585659e-09, +9.6716708475155881e-10, +1.5866444369530475e-09,
-    +1.4355562897118040e-09, +9.8861571339763936e-10, +2.0274948947627770e-09, +3.1548987685896786e-09,
-    +8.1312797655100577e-10, +1.8194697016910810e-09, +6.1320360675814392e-09, +6.8017975662734527e-10,
-    +1.4721552774740229e-09, +6.0603283506505583e-09, +5.8802748831636307e-10, +1.2697294352973203e-09,
-    +5.8511209995966025e-09, +5.5638624299828217e-10, +1.2290691807656907e-09, +9.0852852167664811e-09,
-    +5.4070479175035796e-10, +1.0244587046796810e-09, +1.0138407408880482e-08, +4.8554833338178271e-10,
-    +9.1563029822890835e-10, +4.5475004865939211e-09, +5.0709333284684486e-10, +1.0377066580746188e-09,
-    +3.0327656268017966e-09, +7.0271432776280297e-10, +1.5321544811118991e-09, +3.2071989968933610e-09,
-    +7.6291768931936615e-10, +1.5072262432397455e-09, +2.0941247902909391e-09, +5.7117244432278241e-10,
-    +8.9767427863844148e-10, +9.0650615430518404e-10, +4.8155172198896578e-10, +6.3893442462719905e-10,
-    +6.6219105374575484e-10, +5.6313389205274088e-10, +7.6523831433056198e-10, +7.5403358143297590e-10,
-    +7.2183379571708600e-10, +1.1818625357224042e-09, +1.0280022350125586e-09, +8.1421164013717125e-10,
-    +1.4826932020671096e-09, +1.0498934446869677e-09, +9.1960414047018605e-10, +1.7637533486819426e-09,
-    +1.3049952041361019e-09, +9.7594748058089758e-10, +2.3743867436886433e-09, +2.7353098060164428e-09,
-    +8.9429684019948535e-10, +2.4305850964479699e-09, +5.6611735224355743e-09, +6.8209308346829245e-10,
-    +1.6232583811252955e-09, +4.4053385284374586e-09, +6.1343798940408724e-10, +1.4581542516378276e-09,
-    +4.0026811399240373e-09, +6.4881000061149694e-10, +1.5603144845674042e-09, +6.5758238088498785e-09,
-    +5.7782488789224779e-10, +1.0892132638845002e-09, +1.5780696045788311e-08, +5.3851008941275587e-10,
-    +1.0693712337005837e-09, +6.8163611836014163e-09, +6.2386464783326386e-10, +1.4553045180972191e-09,
-    +4.5741261871784464e-09, +7.7728873560136471e-10, +2.0314514555492872e-09, +2.5341473119243983e-09,
-    +7.3730230631235860e-10, +1.6478327593967496e-09, +1.2369386223794757e-09, +5.5644873274702308e-10,
-    +9.8336223764375809e-10, +7.0912701230718739e-10, +4.8578357737022272e-10, +7.1133014211805279e-10,
-    +5.7475141594623610e-10, +6.0512170252763069e-10, +9.1347295428236621e-10, +6.2540117100778120e-10,
-    +7.0811913416990710e-10, +1.3267272030265707e-09, +6.9777429071433606e-10, +7.6229597452207604e-10,
-    +1.4841111263171541e-09, +7.2453592008944220e-10, +8.6425695791951490e-10, +1.6956034939476718e-09,
-    +9.1474448655849855e-10, +1.1230027860093262e-09, +2.3500769524472826e-09, +1.5035151485037491e-09,
-    +1.0569309169162806e-09, +2.5147065635055892e-09, +2.2363345317708419e-09, +7.2360723247483569e-10,
-    +1.5916317579246043e-09, +2.2151054281311375e-09, +6.3109378199951136e-10, +1.4944624911666650e-09,
-    +2.6562230281303247e-09, +6.8388393203698091e-10, +1.6587096677549540e-09, +4.4338491018646579e-09,
-    +6.7751412352547491e-10, +1.1867182197789314e-09, +1.5795814207169150e-08, +6.7567291317783936e-10,
-    +1.2878182294948501e-09, +6.8301680956960788e-09, +8.0231487031457686e-10, +1.6911933075367811e-09,
-    +3.1390885137295133e-09, +7.8088043552256987e-10, +1.5326422819918007e-09, +1.2456097068999276e-09,
-    +5.1828233929124453e-10, +8.1735596476153042e-10, +5.6532591020915813e-10, +3.7760000766316350e-10,
-    +5.7466270714023989e-10, +3.8974189799193260e-10, +3.7895542861952558e-10, +5.7492108197726128e-10,
-    +3.7960034128059669e-10, +5.1286481618739985e-10, +8.6293019886802184e-10, +4.5600642014357419e-10,
-    +6.5843769192697576e-10, +1.3364269103826041e-09, +5.4990838111189663e-10, +8.1969793080397019e-10,
-    +1.5182536501159678e-09, +6.6169389981833006e-10, +9.0384676469013297e-10, +1.3931090981306952e-09,
-    +7.1544059842983144e-10, +1.0254683041739735e-09, +1.4598333829971104e-09, +7.9106365074461887e-10,
-    +1.1651098338962223e-09, +2.2351085618267514e-09, +1.3432766774469457e-09, +9.5663048630537520e-10,
-    +2.0283986315522334e-09, +2.4049047108093598e-09, +7.5241832271312691e-10, +1.7630968977550185e-09,
-    +4.1038448220380272e-09, +7.4925111732690691e-10, +1.7060174344984613e-09, +8.5839502740001268e-09,
-    +7.3543232430736334e-10, +1.2986741766500871e-09, +4.4834735600216264e-09, +7.7106034061385403e-10,
-    +1.5837452722095504e-09, +2.6226153244013511e-09, +7.9307362424997140e-10, +1.6638635529658751e-09,
-    +1.3529530631182715e-09, +5.5643448679655754e-10, +9.1925482471882310e-10, +6.1173036742732293e-10,
-    +3.7401021548538370e-10, +5.8877808482430514e-10, +3.9277813439915712e-10, +3.1547145312212234e-10,
-    +4.9826293309169509e-10, +3.1815819281012757e-10, +3.5989001963977920e-10, +5.9817074087647241e-10,
-    +3.5447708300890512e-10, +4.9615802243232711e-10, +1.0194213831307210e-09, +4.6795188006455609e-10,
-    +6.8006720921970677e-10, +1.5487985272090708e-09, +5.8410350705260741e-10, +8.9884568538265392e-10,
-    +1.8688861573622600e-09, +7.0100017323747324e-10, +1.0629572226120923e-09, +1.9342284905392477e-09,
-    +7.1823542891311415e-10, +9.9077499213495066e-10, +1.5725603788528167e-09, +6.9670098102695042e-10,
-    +1.0464586833033437e-09, +1.7803816262615062e-09, +8.3962027632288041e-10, +1.2201669768979765e-09,
-    +2.9389901126230206e-09, +1.9547137355844184e-09, +1.0163277514956559e-09, +2.6426484383753964e-09,
-    +4.1544259794103774e-09, +9.0965281734837588e-10, +2.2559589299608637e-09, +8.0529522843813948e-09,
-    +8.6374141386943131e-10, +1.7267938560971534e-09, +2.8363465132881608e-09, +8.9538669741766448e-10,
-    +1.7855082157473266e-09, +1.7324270238373998e-09, +7.3313089043040665e-10, +1.3487859040586386e-09,
-    +8.1772034595611742e-10, +4.7887543016356206e-10, +7.5863132352122803e-10, +4.6464468179074007e-10,
-    +3.4755016585231337e-10, +5.4002976841734288e-10, +3.3962279069995830e-10, +3.0532537736046668e-10,
-    +4.3353090676365034e-10, +2.8658067386924040e-10, +3.3770634445677469e-10, +5.3997937325232219e-10,
-    +3.2568480577344190e-10, +4.5341048340018480e-10, +8.4671874948283734e-10, +4.2921099814845558e-10,
-    +5.7983575214146062e-10, +1.2056833874869868e-09, +4.8497056081507394e-10, +6.1834866648296370e-10,
-    +1.0090009330746206e-09, +4.7628070620946438e-10, +6.7291647668972982e-10, +9.7681106121231531e-10,
-    +4.7862841537995466e-10, +8.3351555997803453e-10, +1.4240180677361790e-09, +6.3131851147006779e-10,
-    +9.9350668767253457e-10, +1.7506100801728375e-09, +7.8628482066358462e-10, +1.1910664333727972e-09,
-    +2.8005619753288824e-09, +1.2193201804460649e-09, +1.2004831450059576e-09, +3.2952015791950564e-09,
-    +2.1939077415415439e-09, +1.0567775385983767e-09, +3.3621965466738459e-09, +3.9607219795723229e-09,
-    +1.0219641443450758e-09, +2.6290167560672051e-09, +1.8420076139716269e-09, +8.8075213195235755e-10,
-    +1.7664811824328978e-09, +1.1414885815396146e-09, +6.4262590682299248e-10, +1.1367630393492891e-09,
-    +6.2203975518154919e-10, +4.4136548646122546e-10, +7.2149721760622416e-10, +3.9125359459691624e-10,
-    +3.8493352017765136e-10, +5.7205554397787938e-10, +3.3353843156269581e-10, +3.5441861956279168e-10,
-    +4.8685231207704047e-10, +3.0856703628012220e-10, +3.7238963232541956e-10, +5.3201093828746860e-10,
-    +3.3339582604715329e-10, +4.1618666800438153e-10, +6.8216492113135482e-10, +3.8240258982062346e-10,
-    +4.8635303097818257e-10, +8.5647997516715843e-10, +4.1076009211740481e-10, +5.5269239676782879e-10,
-    +9.1484678323097856e-10, +4.2111931542358682e-10, +5.0423892714926698e-10, +7.5148616289542818e-10,
-    +4.0741871492151011e-10, +6.1757660530294934e-10, +9.6512254526256236e-10, +5.0914006436093736e-10,
-    +7.8174973901734499e-10, +1.4214210491770096e-09, +6.4065079419259095e-10, +1.0778295303974067e-09,
-    +2.1245785242533542e-09, +9.7322452899804356e-10, +1.3927730020078937e-09, +3.7221294715118183e-09,
-    +1.9834412368671155e-09, +1.1380382972215311e-09, +4.1495683529783503e-09, +2.5982049298335198e-09,
-    +1.2037416803047719e-09, +3.9283523373466946e-09, +1.8401105460395348e-09, +1.0087258508295162e-09,
-    +2.2558345021996129e-09, +1.1876404712200609e-09, +7.4931786541241122e-10, +1.4369515225191815e-09,
-    +6.7844489014308369e-10, +5.5797949567191891e-10, +1.0222564853972947e-09, +4.6988839545861199e-10,
-    +4.2026683682026915e-10, +7.0630612947270683e-10, +3.7107315943303801e-10, +3.7424962701842601e-10,
-    +5.7295922676438733e-10, +3.6035080281822022e-10, +4.5775551691744199e-10, +7.5747998169210296e-10,
-    +4.2727682234429018e-10, +6.0359167066696273e-10, +1.1715730805830298e-09, +5.4319288061470094e-10,
-    +5.8249821404154553e-10, +1.2065615068599971e-09, +4.9222612974130711e-10, +4.3494823111971956e-10,
-    +7.0049748652009717e-10, +3.6706271913063978e-10, +3.7289664834790741e-10, +5.5588864372204762e-10,
-    +3.1520234783032938e-10, +4.8412164491457671e-10, +7.1762853513405984e-10, +4.0750135652820566e-10,
-    +6.6139970666698094e-10, +1.0615155241640377e-09, +5.5456272160697217e-10, +1.0229736653505758e-09,
-    +1.7831696357751663e-09, +8.8375622050926964e-10, +1.3671392023364269e-09, +3.6295421955712619e-09,
-    +2.0302374181360369e-09, +1.2214631085509823e-09, +4.5274052008775624e-09, +2.3672450682005854e-09,
-    +1.3177797528572902e-09, +5.3541468008857582e-09, +2.0687653420801615e-09, +1.2535386911504893e-09,
-    +3.2535759215157566e-09, +1.3220163428691483e-09, +9.8313319872686407e-10, +2.0698741448835083e-09,
-    +7.2409945960522628e-10, +6.7905784670454187e-10, +1.2611003932500696e-09, +4.9463617985739510e-10,
-    +4.6258957372292482e-10, +7.6287696009667111e-10, +3.8168744248096620e-10, +4.3369008472977363e-10,
-    +7.1608952282251126e-10, +3.9356668017509580e-10, +5.9167483182372149e-10, +1.0821312736889300e-09,
-    +4.9700036399461699e-10, +8.1329520279020593e-10, +2.0911306323220801e-09, +6.6168064232457748e-10,
-    +8.0078577520600941e-10, +2.0880112572036700e-09, +6.4058459811920635e-10, +5.6643155080471972e-10,
-    +9.7573264034225536e-10, +4.6674818028455336e-10, +4.9453714463820043e-10, +7.7399248950660058e-10,
-    +3.9771103127082643e-10, +6.1334325390694885e-10, +9.8993989323544306e-10, +4.5591927589226271e-10,
-    +7.4853691853434226e-10, +1.2614183892178879e-09, +5.4109343244215348e-10, +9.3194440477079473e-10,
-    +1.6672396663739352e-09, +7.7216887715412781e-10, +1.2788175116170122e-09, +3.1882211196241225e-09,
-    +1.6561998123323531e-09, +1.2100467358649857e-09, +4.6974232111170947e-09, +2.3976625418055449e-09,
-    +1.2104966507851572e-09, +4.1537641924101187e-09, +3.1315923836303722e-09, +1.4590999453565621e-09,
-    +3.8089995315730582e-09, +1.7669411949654798e-09, +1.2218055375259509e-09, +3.0268625790556327e-09,
-    +8.2944429643334093e-10, +7.2227629772445464e-10, +1.4279127711677261e-09, +4.9386302811934433e-10,
-    +4.6474898016889309e-10, +8.1591228628306453e-10, +3.7061597744135597e-10, +4.7745899128477100e-10,
-    +8.0704006812140938e-10, +3.9535228581212663e-10, +6.1692705793344753e-10, +1.3922181252290159e-09,
-    +4.8831026702694331e-10, +9.2719847062766328e-10, +2.7156543113384351e-09, +6.8967110571887663e-10,
-    +9.9372023367558548e-10, +3.1860760727085722e-09, +7.1465179415680594e-10, +7.1395023366059649e-10,
-    +1.4526603324778349e-09, +5.2830227247304566e-10, +5.6924530392875080e-10, +9.5088042593920223e-10,
-    +4.2696684854459671e-10, +5.5496530032010044e-10, +8.7611686425078040e-10, +4.2137528954955446e-10,
-    +6.4511397599876898e-10, +1.1945762163881915e-09, +5.2883968214511914e-10, +7.9710237281665564e-10,
-    +1.6917325862533976e-09, +7.7283406585418974e-10, +9.8021671632945864e-10, +2.1958049756374239e-09,
-    +1.5290517048696395e-09, +9.6223715581571984e-10, +2.8329289955158325e-09, +3.4074099601884654e-09,
-    +1.0083568369463763e-09, +3.0482816941256030e-09, +6.0285491227674407e-09, +1.2850691169477064e-09,
-    +3.4877166334587926e-09, +2.6359616428674219e-09, +1.1465482406772733e-09, +3.2582078466891755e-09,
-    +9.8353595142716082e-10, +7.1163262029170353e-10, +1.4430621203277413e-09, +4.8039073575862771e-10,
-    +5.5960905232578900e-10, +9.7088315495891058e-10, +3.9972958597303472e-10, +5.5640069699402791e-10,
-    +1.1489183357245495e-09, +4.2871274251922283e-10, +5.8352932882390671e-10, +1.3861131568639684e-09,
-    +4.5322333594509757e-10, +7.0517110525207038e-10, +1.7485586906111239e-09, +5.2716721418930008e-10,
-    +8.4409043520434370e-10, +2.2331272724819535e-09, +5.9220225112053575e-10, +7.2287545171646521e-10,
-    +1.6108993683230214e-09, +4.9544085392627798e-10, +5.6667936411894958e-10, +1.0328178800596838e-09,
-    +4.0470589407322473e-10, +4.6241684845086093e-10, +8.2311795862867988e-10, +3.6786664667488098e-10,
-    +5.3371719953753876e-10, +1.1544970712839496e-09, +4.8724700138584198e-10, +6.7637538555502218e-10,
-    +1.6767646154697146e-09, +8.4251907234225144e-10, +7.4095823064260619e-10, +1.9584858922848486e-09,
-    +1.9408176347565585e-09, +7.4313927449368301e-10, +2.3893759495036604e-09, +6.5517171818147781e-09,
-    +7.9616105089997384e-10, +2.0190116965607610e-09, +1.0419426620828515e-08, +9.6760869795108596e-10,
-    +2.8339992773471946e-09, +3.6774756612617173e-09, +1.0316328114368683e-09, +3.8018962497414803e-09,
-    +1.3459136763996635e-09, +8.4275307165354287e-10, +1.8058146766688485e-09, +6.2000128959028347e-10,
-    +6.7025699163148322e-10, +9.7869475377851505e-10, +4.0997679161970198e-10, +5.9633860227728892e-10,
-    +8.7876232014557383e-10, +3.7430333899902417e-10, +6.1514294521673827e-10, +1.1392289512308109e-09,
-    +4.0223177317903143e-10, +7.1366189681436490e-10, +1.6702676774821682e-09, +4.8082160079463436e-10,
-    +7.3616253990670397e-10, +1.7235555148811852e-09, +4.9700691229907263e-10, +5.9317466619263131e-10,
-    +1.1434497490843050e-09, +4.0283932419077315e-10, +4.5256242658444299e-10, +7.0705087629336536e-10,
-    +3.3027190641033870e-10, +4.2996676390022334e-10, +6.5246280328969089e-10, +3.5694092278746717e-10,
-    +4.5774089777063874e-10, +8.4081628930819227e-10, +4.6108126661943691e-10, +5.5999003231182100e-10,
-    +1.3230340232712752e-09, +8.4865952967028934e-10, +6.4992466745926841e-10, +1.8773203409549330e-09,
-    +2.5621071359395503e-09, +6.8753226670572083e-10, +2.2666116916622523e-09, +1.0661330770121950e-08,
-    +6.5640663665417481e-10, +1.3988102008586345e-09, +1.4690808934850161e-08, +7.3480316593559248e-10,
-    +2.1279416806769771e-09, +4.6619553039603841e-09, +8.0652378312294648e-10, +3.6673941786520878e-09,
-    +1.8774344657515479e-09, +8.3182687337678300e-10, +2.9981317052334878e-09, +9.9963283386048933e-10,
-    +7.1991086069481740e-10, +1.3819082350994717e-09, +5.3079912252174310e-10, +5.9646376756896392e-10,
-    +8.6096851341631658e-10, +3.8626156290935902e-10, +6.1837620492172683e-10, +9.9829798080826139e-10,
-    +3.6966559456263228e-10, +6.4466462364410658e-10, +1.4498302880133851e-09, +4.0864110168895768e-10,
-    +5.9131900149251669e-10, +1.3800710380802280e-09, +4.0350444074855201e-10, +4.1871656146027219e-10,
-    +7.2415481630216237e-10, +3.1468518860218181e-10, +3.7341160723715326e-10, +5.2061422226291635e-10,
-    +2.9174290264882357e-10, +4.1786985134339677e-10, +5.9652266383081795e-10, +3.4171524832067200e-10,
-    +4.8013042162906210e-10, +8.2142507852378208e-10, +5.0131775105682486e-10, +5.4357106942586927e-10,
-    +1.2344270683459103e-09, +9.3214829109799186e-10, +6.1364185702800176e-10, +1.9720924425984287e-09,
-    +3.0967403955239081e-09, +6.2627244038193665e-10, +2.0217405811215376e-09, +1.2531372133494097e-08,
-    +5.5526243220911473e-10, +1.1100104235417810e-09, +1.4990098814881273e-08, +6.1470178157068656e-10,
-    +1.7224577299442551e-09, +6.6703780205280793e-09, +6.8187724277053583e-10, +2.9730089937892322e-09,
-    +2.5929367454040374e-09, +6.9975179894659463e-10, +3.6841679121272841e-09, +1.3161302977470648e-09,
-    +6.4718372233582649e-10, +2.1041217449386499e-09, +7.5812598416456118e-10, +5.8223122605032700e-10,
-    +1.2615427359946024e-09, +5.1683844377234315e-10, +5.8759547143249443e-10, +1.1337517673248484e-09,
-    +4.5491382080507069e-10, +6.5050521119692024e-10, +1.5342714878760847e-09, +4.6762787992014495e-10,
-    +5.7726179827160661e-10, +1.3824407799592032e-09, +4.4344024916754926e-10, +4.1597702165561560e-10,
-    +7.2186556516968835e-10, +3.2562742745050979e-10, +3.5754042664643324e-10, +5.1091860886666551e-10,
-    +2.8429319169254342e-10, +4.0475896142219714e-10, +5.6298111032127089e-10, +3.2721153265973277e-10,
-    +4.8403682819183597e-10, +8.4806663167255571e-10, +5.0015033243609808e-10, +5.4073237748139190e-10,
-    +1.3300698721216657e-09, +9.5722519468670784e-10, +5.6782686799349011e-10, +2.1617499994017353e-09,
-    +2.9289903116352271e-09, +5.8142470030540717e-10, +2.0339143792135036e-09, +1.5495248839053368e-08,
-    +4.8313599298257555e-10, +9.3025396609569414e-10, +1.4634840746809462e-08, +5.2669297621329052e-10,
-    +1.3087923409095302e-09, +1.0793501418444163e-08, +5.9274456667939402e-10, +1.8634235012970751e-09,
-    +4.0328138610683514e-09, +6.6248199272087160e-10, +2.3451410662269675e-09, +2.3274045054236109e-09,
-    +6.1576581383239001e-10, +2.1421386037751739e-09, +1.1935824020005720e-09, +5.3247683483091981e-10,
-    +1.4224005247429043e-09, +7.0806962616588181e-10, +5.5338685981385444e-10, +1.1934364798284909e-09,
-    +6.0930498486891207e-10, +6.1876426735432582e-10, +1.4715499342930070e-09, +7.0849579505017933e-10,
-    +6.1154774563530843e-10, +1.4556704156987531e-09, +6.6103293809400475e-10, +5.3503958713229166e-10,
-    +1.0229725874823370e-09, +5.0239424745404434e-10, +4.8778567571130842e-10, +8.2462333117295838e-10,
-    +4.4491276337621440e-10, +4.8825398335140155e-10, +8.1808539350571143e-10, +5.0393398560334751e-10,
-    +4.9499636611040414e-10, +1.0313708662551313e-09, +7.7276689645526240e-10, +5.0746941929271085e-10,
-    +1.5565390125311235e-09, +1.6754690757575309e-09, +5.2534856718514696e-10, +2.2629934640833837e-09,
-    +5.8882265857422565e-09, +5.2403530339687636e-10, +1.8125167772217081e-09, +2.6356245617121123e-08,
-    +3.9962090985416230e-10, +7.0748082963427067e-10, +1.2380322364033432e-08, +4.2295632308411944e-10,
-    +8.5311931659109431e-10, +1.7031669247844550e-08, +4.9204237070735699e-10, +1.0905674962196687e-09,
-    +1.4300277893010279e-08, +6.2217039199971669e-10, +1.4502998814796081e-09, +1.0070423377013585e-08,
-    +6.9950528209414448e-10, +1.8241607504740258e-09, +4.1753494624494536e-09, +5.8142873332574154e-10,
-    +1.4786655086961087e-09, +1.2974709238744590e-09, +5.6152028891481306e-10, +1.2193836676222213e-09,
-    +8.4421611554011696e-10, +6.6579767154055470e-10, +1.5667549858463943e-09, +9.8417341771001878e-10,
-    +7.8383841141049670e-10, +2.0749659854457173e-09, +1.2291350771525746e-09, +7.9496217145081168e-10,
-    +1.7481469786248782e-09, +1.0158243791047077e-09, +7.7835159439965162e-10, +1.5333121314087299e-09,
-    +1.0467065686073875e-09, +6.4117799437036833e-10, +1.3602301044682158e-09, +1.3215704383808085e-09,
-    +5.2339593407436955e-10, +1.1939775139002752e-09, +2.2742089146665101e-09, +4.8193031419608867e-10,
-    +1.3715241718359615e-09, +7.9948403858497953e-09, +4.6834430165167266e-10, +1.5540783498639488e-09,
-    +2.7238381407124372e-08, +4.4265887834221195e-10, +1.2484122209614095e-09, +2.5122540845545926e-08,
-};
-
-const double EMPTY_COV[] = {
-    +3.4252652713216312e-10, +6.9832084235320564e-10, +3.6600130301587828e-09, +3.6418559776332286e-10,
-    +7.5520621739891344e-10, +3.7618230194610674e-09, +3.6640506272193117e-10, +7.8901729522045054e-10,
-    +3.5316011787792377e-09, +3.8301990474278729e-10, +8.3113662468939424e-10, +3.6844666801353461e-09,
-    +4.1614716744284818e-10, +8.7931556461155062e-10, +4.2348771087999304e-09, +5.7318084389657676e-10,
-    +1.2109510942978133e-09, +6.4305240617960425e-09, +6.5672451381421502e-10, +1.3217709900349268e-09,
-    +7.6740928786712600e-09, +7.9825587413687490e-10, +1.6415671837692553e-09, +9.8383615247811743e-09,
-    +8.3493818820256115e-10, +1.9988737505762327e-09, +1.2159865607219731e-08, +7.8946343510535280e-10,
-    +2.1416570760228805e-09, +1.5694115166650032e-08, +7.0391878011669133e-10, +1.8224594585737950e-09,
-    +1.2422917196374570e-08, +6.4515639504234445e-10, +1.7125069939427886e-09, +8.5376192819604410e-09,
-    +5.8920113306371068e-10, +1.5532364709907549e-09, +6.7190885024294333e-09, +5.2003056026151400e-10,
-    +1.3087838105369150e-09, +6.1822720122901472e-09, +4.9855922342213473e-10, +1.1492741895045254e-09,
-    +6.1400451837329277e-09, +4.3559207304335884e-10, +9.6992243281034754e-10, +5.9045676264921185e-09,
-    +3.5613832054950005e-10, +6.8863287506447626e-10, +3.9353389029843914e-09, +3.4144541384845492e-10,
-    +6.1933854468774189e-10, +3.5243034609812153e-09, +3.0610656351700696e-10, +5.5074470236426733e-10,
-    +3.6905985114096256e-09, +3.0003306355359421e-10, +5.3054697672736453e-10, +4.5208048365342212e-09,
-    +3.0336237718564088e-10, +5.3732490339122914e-10, +5.1006011716458185e-09, +3.3547361350056025e-10,
-    +5.7588137142285589e-10, +4.7122972641895769e-09, +3.9114812226267454e-10, +6.5022000574272886e-10,
-    +5.2286105112398947e-09, +4.3384034312075433e-10, +7.0317800759083685e-10, +6.4108325221866994e-09,
-    +4.4624861748999161e-10, +7.9871672356534456e-10, +7.4439533031579303e-09, +4.6752914239234512e-10,
-    +9.1985152371165302e-10, +1.0012348128823799e-08, +4.9364212855383635e-10, +1.0175412294300158e-09,
-    +1.5407180741529483e-08, +4.4211860954593785e-10, +9.0069810507107305e-10, +1.1341353053587293e-08,
-    +4.0424750109687546e-10, +7.9721652742331772e-10, +8.9040375456194957e-09, +4.0512423971189993e-10,
-    +8.2360154017144493e-10, +6.4378897727818452e-09, +4.5830851724476671e-10, +9.7371509556480202e-10,
-    +6.6701586726026387e-09, +4.4633983528339856e-10, +9.9187934395604675e-10, +7.1356022231710676e-09,
-    +4.4624330853863698e-10, +9.4191428334936033e-10, +4.2780120733286895e-09, +3.7675571540049773e-10,
-    +7.8441181634163236e-10, +3.9987976255347511e-09, +3.6640559570580706e-10, +7.9311069722559092e-10,
-    +5.4109388654757626e-09, +3.5310731084318971e-10, +7.2385094382898585e-10, +5.4892116927169593e-09,
-    +3.2016659820271938e-10, +5.8521454709396964e-10, +4.4961928060276821e-09, +3.2093127982556995e-10,
-    +5.2910515919059611e-10, +3.8199975734611364e-09, +3.7641464844841822e-10, +5.9970227145049635e-10,
-    +5.5122743715165218e-09, +3.9423647079612207e-10, +6.8307251517425452e-10, +8.2062977245963294e-09,
-    +3.9532322645149795e-10, +7.1581689724740613e-10, +1.0473651952229444e-08, +3.7588706985094630e-10,
-    +6.9350238839205863e-10, +1.3687914000369328e-08, +3.7856051003996697e-10, +6.7496800774824917e-10,
-    +1.5478910286573249e-08, +4.1229292060842351e-10, +8.1229810822974543e-10, +2.1569155641538839e-08,
-    +4.6173468222700014e-10, +9.6478351925456098e-10, +2.4368840333920290e-08, +4.4578673385853682e-10,
-    +8.9913403690590050e-10, +1.3407508856564570e-08, +5.0759589826190661e-10, +1.0856185664771408e-09,
-    +1.3981649169355216e-08, +4.9267718600809294e-10, +1.0029948614135942e-09, +1.0471218332849930e-08,
-    +5.8568728192442975e-10, +1.2446694680716297e-09, +6.1769139435005189e-09, +5.0777787464656136e-10,
-    +1.0876938114423828e-09, +1.0407513367071902e-08, +4.4222275447268298e-10, +8.7724026031960799e-10,
-    +1.0983168064294943e-08, +3.6802188627335285e-10, +6.4069202898984386e-10, +6.0480275927469416e-09,
-    +3.3178492505007119e-10, +5.2327347446367498e-10, +4.3900917718393229e-09, +3.3705282234296653e-10,
-    +4.9349938405181936e-10, +3.7414195546662606e-09, +3.1794618050666556e-10, +4.5344839983095187e-10,
-    +4.3092546790243110e-09, +3.2433652242808529e-10, +4.7676761223934966e-10, +5.4033792550146284e-09,
-    +3.2629140883879392e-10, +5.1738588313579999e-10, +7.2719582433104072e-09, +3.3743428000472091e-10,
-    +5.6982043039653359e-10, +1.1486273082397963e-08, +3.6696838573705387e-10, +6.2255702359461399e-10,
-    +1.6969239232182072e-08, +4.0481644763850669e-10, +6.9008043757691549e-10, +2.8819240278139036e-08,
-    +5.2047732386190776e-10, +9.3758801812618273e-10, +3.2078084730475481e-08, +5.4116348670099346e-10,
-    +9.8745041272123841e-10, +3.3076974651559624e-08, +5.4997877051697320e-10, +1.0284816910167578e-09,
-    +1.9017039286217413e-08, +5.3440624978788810e-10, +9.6314524619134103e-10, +8.3956838091781492e-09,
-    +6.3241089481796613e-10, +1.5323861202159504e-09, +1.4945049072143422e-08, +4.6586159239698002e-10,
-    +9.9639847685308219e-10, +1.4728125938319562e-08, +3.7995109171519923e-10, +6.7157883559083904e-10,
-    +9.4780871411730012e-09, +3.3664928717975868e-10, +5.1856467204193684e-10, +4.2768363493932895e-09,
-    +3.5495164165277972e-10, +5.5574331621365528e-10, +4.1698204234726645e-09, +3.7653368557085582e-10,
-    +5.2773262909328166e-10, +3.9568874792292640e-09, +3.6237107046129285e-10, +4.9332689024076993e-10,
-    +2.2394448419819975e-09, +3.2978981313572014e-10, +4.4269119234189336e-10, +2.1032298836509517e-09,
-    +3.5876879205504961e-10, +4.8832452895357293e-10, +3.9598200073318892e-09, +4.0845176212116980e-10,
-    +6.0819396582290639e-10, +5.6335587171825532e-09, +4.8131662638335567e-10, +8.4525607815172442e-10,
-    +2.3303151324769103e-08, +5.5989156391958265e-10, +1.0704235496109637e-09, +9.8253919766439163e-08,
-    +6.3158159695294300e-10, +1.2426087132983018e-09, +4.3050375698476215e-08, +6.5334964939927984e-10,
-    +1.1801582899344058e-09, +2.7665945111152388e-08, +6.3146371348297269e-10, +1.1766475684882120e-09,
-    +1.7475172716306327e-08, +5.4962437842793320e-10, +9.9009488189153134e-10, +9.3796935693505713e-09,
-    +5.8783194078327178e-10, +1.2968129857343583e-09, +1.4178693306087148e-08, +4.6318578942329567e-10,
-    +8.9857648510650133e-10, +1.1624722208372673e-08, +3.6652285896724677e-10, +6.1115466874945876e-10,
-    +7.5997883945319033e-09, +3.6019046585122559e-10, +5.5569698630426558e-10, +4.5827021023984521e-09,
-    +3.3091804952132328e-10, +5.4499704887095851e-10, +3.2213163418947126e-09, +3.4292102677135269e-10,
-    +5.2489364236280401e-10, +2.4447527380869972e-09, +3.4729445211237074e-10, +5.4023143734109069e-10,
-    +1.8600711583986048e-09, +3.4936902805855284e-10, +4.9529566665162177e-10, +1.9559566254178351e-09,
-    +3.4311028127038049e-10, +4.7937733080239058e-10, +2.9457048767036721e-09, +3.7721442298312496e-10,
-    +6.1937793321091524e-10, +2.7055833372819106e-09, +4.4044509900047636e-10, +7.9729349411036860e-10,
-    +4.6849543641640831e-09, +5.5799460857908746e-10, +1.1955574076652718e-09, +1.7091165352734861e-08,
-    +6.7850058489566048e-10, +1.5468062703461255e-09, +2.9595324483285456e-08, +6.5769382825261035e-10,
-    +1.3266615506263578e-09, +7.9580273899546008e-09, +6.0883010743249903e-10, +1.2846225842628943e-09,
-    +6.5637966144343734e-09, +5.7984297401146018e-10, +1.2409089906041610e-09, +9.0014063887355979e-09,
-    +5.6064803660488658e-10, +1.2008242923862733e-09, +1.4642542375261345e-08, +4.6435190809797907e-10,
-    +9.0169362688381578e-10, +8.1843052508186900e-09, +3.8092164732319755e-10, +6.6894812271252081e-10,
-    +6.8269627973741940e-09, +3.2348407451072718e-10, +5.3665269165636289e-10, +3.2512907925190729e-09,
-    +2.8729212022317838e-10, +4.5544354761036509e-10, +1.8125909604591626e-09, +3.0206167809426921e-10,
-    +4.4319715351345022e-10, +1.4019434926739588e-09, +3.0216315968131552e-10, +4.4816379341172625e-10,
-    +1.5067588886882366e-09, +3.1941199563267662e-10, +4.6578128020293329e-10, +2.1354887259531396e-09,
-    +3.1462414747171819e-10, +4.3609342761104983e-10, +2.4647973878254883e-09, +3.1094194560550054e-10,
-    +4.4632463935649076e-10, +2.0774047188925299e-09, +3.5674393320847952e-10, +5.6006227368264666e-10,
-    +2.7778518461107627e-09, +4.7483666913698307e-10, +8.7043262166434473e-10, +6.2455620987464743e-09,
-    +5.7571100232505599e-10, +1.1486460023390053e-09, +1.1776202087918254e-08, +5.1534048524473378e-10,
-    +1.0573767619638632e-09, +8.3726323064497359e-09, +5.4094670935384714e-10, +1.1562303662328078e-09,
-    +8.1209019746143537e-09, +5.3251977348029568e-10, +1.1564861122885334e-09, +7.7666910248219300e-09,
-    +5.4758128715662769e-10, +1.0257900639945363e-09, +1.5814289383878549e-08, +4.7204031549435468e-10,
-    +8.2670594112911202e-10, +8.2072332299777353e-09, +3.9154630677741984e-10, +6.6089806592351296e-10,
-    +4.1984774632930081e-09, +2.7692872039808603e-10, +4.5133200330094804e-10, +1.5995453938434207e-09,
-    +2.4185606530223704e-10, +3.5344989636585754e-10, +9.8627190286876300e-10, +2.5528905300748215e-10,
-    +3.6051055997239899e-10, +1.1227492415769901e-09, +3.1734770627413836e-10, +4.1550360611196199e-10,
-    +1.8875299748961789e-09, +3.5105592959845131e-10, +4.6162130317428498e-10, +2.4758227797240342e-09,
-    +3.2889530332083550e-10, +4.6916929931518320e-10, +2.6739201849959176e-09, +2.9646622977294199e-10,
-    +4.2731800943575074e-10, +2.1181532530944024e-09, +2.5987727844905596e-10, +3.8362980261742940e-10,
-    +1.4479687048670500e-09, +3.0590665328038552e-10, +4.7645709227704903e-10, +1.8926221898319604e-09,
-    +3.8072893425921602e-10, +6.3210063892220680e-10, +2.8440430243302097e-09, +4.5890679816366688e-10,
-    +8.3745276978882035e-10, +7.5060473784262575e-09, +4.9916779718230630e-10, +9.5072891963193258e-10,
-    +9.4004504564252680e-09, +4.6493727800148380e-10, +9.0631305874194776e-10, +7.2166332484827687e-09,
-    +6.0235199020298595e-10, +1.0454344221249519e-09, +1.2968387183026543e-08, +4.8662367124955065e-10,
-    +7.9346390078576685e-10, +7.2949612003263436e-09, +3.8550613197020936e-10, +5.8325072330482305e-10,
-    +3.1736287093892067e-09, +2.9273507214178327e-10, +4.0526546488545746e-10, +1.3377482217409832e-09,
-    +2.5769914721896495e-10, +3.2001298679263038e-10, +8.9910851511589753e-10, +2.6633741460184690e-10,
-    +3.1012065826926742e-10, +9.8286103536874431e-10, +3.1310203347055561e-10, +3.3819149576758767e-10,
-    +1.4338730697790410e-09, +3.4183159716204552e-10, +3.6623106800401556e-10, +1.9469734726675081e-09,
-    +3.5876572995024012e-10, +4.3713750435290131e-10, +3.1245265268255813e-09, +3.7346553501376027e-10,
-    +5.0094284180509314e-10, +3.3125913109583585e-09, +3.0908721725765162e-10, +4.3700368543693414e-10,
-    +1.6768288616105698e-09, +2.8726386736667008e-10, +4.3570078349950015e-10, +1.9126122088222576e-09,
-    +3.3861595201376703e-10, +5.6795027485842698e-10, +6.2105605725878051e-09, +3.9211300436736818e-10,
-    +7.0139382966775742e-10, +8.8953978689526929e-09, +4.4725845930013482e-10, +8.7894756147956611e-10,
-    +1.0150473563746333e-08, +4.5030522883971429e-10, +9.0517856194536674e-10, +6.2851848181536629e-09,
-    +6.4099838174766221e-10, +1.1799994097878934e-09, +1.2472687776033805e-08, +5.3981775928427489e-10,
-    +9.2941877548664577e-10, +8.3651711048486489e-09, +3.8579668650190369e-10, +5.3303441303591815e-10,
-    +3.4502079666330147e-09, +2.5401813887289849e-10, +3.0662225912497511e-10, +1.1097557528464716e-09,
-    +2.4055889272710267e-10, +2.8277230080208422e-10, +7.9741319732923225e-10, +2.7594062023969461e-10,
-    +3.1745758016973331e-10, +1.0764489513390869e-09, +3.6202072556272930e-10, +4.2366259814703655e-10,
-    +2.7511952629721850e-09, +4.2748180109407386e-10, +5.3989263115291929e-10, +5.4499295326836454e-09,
-    +4.2987367172157626e-10, +6.1416527206264484e-10, +5.9201211900904730e-09, +3.5781400747096885e-10,
-    +5.1677436381353997e-10, +3.4539094146148354e-09, +2.9271235989949619e-10, +4.0323107268193645e-10,
-    +1.4020824634492480e-09, +2.5290309415456678e-10, +3.5440191764807960e-10, +1.2976380090609433e-09,
-    +2.6879171670458499e-10, +3.8118852165077537e-10, +1.7359807889838618e-09, +3.5384966537946340e-10,
-    +5.9689817886013337e-10, +6.0158188000726174e-09, +4.7258351826861709e-10, +1.0517489058742854e-09,
-    +2.0217111152322515e-08, +5.4128859230485981e-10, +1.3236273487040951e-09, +2.4387524990811443e-08,
-    +5.4524923899141018e-10, +1.0841207435098344e-09, +1.3419172919744124e-08, +4.5706610952696740e-10,
-    +7.9609202184032062e-10, +7.0734593823323849e-09, +3.5662184523609725e-10, +4.8630207629672215e-10,
-    +4.4635737144982561e-09, +2.9864418190389569e-10, +3.6357726170659023e-10, +2.5543741906992178e-09,
-    +3.2014260114443979e-10, +4.2411103446401933e-10, +1.9391283150118524e-09, +3.7862306287784646e-10,
-    +5.5408432284948245e-10, +2.5909747524512142e-09, +3.7462337926935566e-10, +5.9379388212868767e-10,
-    +4.5584729017316062e-09, +3.5707918852073537e-10, +5.5854548647069378e-10, +6.2517203562222524e-09,
-    +3.4307758047532336e-10, +5.1294788146218064e-10, +5.4600468687146816e-09, +3.0504482078307000e-10,
-    +4.5973382006713355e-10, +3.0398307718913586e-09, +2.9554149286840626e-10, +4.1309114063585051e-10,
-    +1.8225092470975265e-09, +2.9836204271914883e-10, +4.1746640863118193e-10, +1.9981537419092456e-09,
-    +3.1259450601320196e-10, +4.5360290050133257e-10, +3.3607531469310906e-09, +3.2969672450171508e-10,
-    +5.1734910272169181e-10, +5.7953540744303727e-09, +4.5404531310747059e-10, +9.4258509548194760e-10,
-    +1.4752210585563786e-08, +4.8117573149721892e-10, +1.0749074159938339e-09, +1.2688878557039959e-08,
-    +5.3550324933438199e-10, +1.1012133916873442e-09, +1.0179301162676759e-08, +4.4422293297506392e-10,
-    +8.1191394006797358e-10, +6.0473710774717992e-09, +3.4828974468080640e-10, +5.5179113800930199e-10,
-    +4.3138479510350281e-09, +3.2391100292414476e-10, +5.2364026031202109e-10, +5.3326444694309901e-09,
-    +3.6144901601091550e-10, +6.8500594212857074e-10, +1.1746236514630392e-08, +3.7699382927188555e-10,
-    +6.9884052454407407e-10, +8.8852478327969894e-09, +3.4200357412818820e-10, +5.5852698084189452e-10,
-    +6.9281276933745921e-09, +3.0307384087331280e-10, +4.4756725024770496e-10, +5.9421000228824098e-09,
-    +2.7867558994488936e-10, +3.8364177100365030e-10, +4.3056040049626123e-09, +2.7786809100501407e-10,
-    +3.8816892315478999e-10, +3.7511524337396398e-09, +3.0026389974956430e-10, +4.6014213382827894e-10,
-    +3.5999535620390435e-09, +3.0578906423088417e-10, +5.4423253136883853e-10, +3.9048276207794178e-09,
-    +3.0848910077358428e-10, +5.2187626744664388e-10, +3.5411403005063414e-09, +3.2042685666273705e-10,
-    +4.9812127558552106e-10, +4.1111476560161966e-09, +4.4877212336675266e-10, +8.4155838768996445e-10,
-    +1.1043234361916021e-08, +5.4360843115823678e-10, +1.3653907212806312e-09, +2.0667062082676499e-08,
-    +5.3731599947405533e-10, +1.0187672504483875e-09, +1.9155854735100289e-08, +4.6591325489762143e-10,
-    +8.9292144037611970e-10, +1.5778343059708779e-08, +3.5203121789183666e-10, +6.6073524155781108e-10,
-    +1.3841550593615042e-08, +2.9715497635895651e-10, +5.9997756407898096e-10, +1.3161172734719718e-08,
-    +2.9877019754169424e-10, +6.0053398605260621e-10, +1.3923337352675857e-08, +3.0173565672874752e-10,
-    +6.4148093993567015e-10, +1.4978468227246208e-08, +2.9086597835185729e-10, +5.4801080432455225e-10,
-    +1.0151266973032633e-08, +2.7913703237788120e-10, +4.6090075407884612e-10, +6.4684734592162420e-09,
-    +2.7052545100589075e-10, +4.3359019211978537e-10, +5.4005863016904341e-09, +2.7186546136495420e-10,
-    +4.4253256588633532e-10, +6.1838929858520037e-09, +2.9482186194003424e-10, +5.1380652836419477e-10,
-    +6.1208380374778970e-09, +2.9169030747332325e-10, +5.0861794592882156e-10, +5.2543286591298224e-09,
-    +3.0289500983412341e-10, +5.1424932926498527e-10, +5.1280118153084572e-09, +3.4089930582064158e-10,
-    +5.9517506301047982e-10, +8.1724971590560966e-09, +4.5499829138814355e-10, +8.4517823085147950e-10,
-    +1.2347631614979767e-08, +4.4893740984262242e-10, +9.0418548010292286e-10, +9.8455284824198092e-09,
-    +6.2504716723119884e-10, +1.5466290461318063e-09, +3.3022938624788268e-08, +5.5461255676072013e-10,
-    +1.2022151617434791e-09, +2.8311776416465636e-08, +4.1825627910762844e-10, +8.3017746144884746e-10,
-    +1.1915268476437890e-08, +3.1780904064392456e-10, +5.6300099949398294e-10, +3.1247448352897244e-09,
-    +2.4244053672047363e-10, +4.0295895322169876e-10, +1.4834092960285191e-09, +2.2346348386148803e-10,
-    +3.3546249804166801e-10, +1.3676750876550882e-09, +2.4058091952568448e-10, +3.8101147605003922e-10,
-    +2.6904529902516538e-09, +2.7943517915896086e-10, +4.8823879825632766e-10, +6.8203342071523312e-09,
-    +2.8008573629410606e-10, +4.9067141131005505e-10, +4.1794358706963076e-09, +2.3342632036537952e-10,
-    +3.8082381758800145e-10, +1.6969681801886960e-09, +2.4455482893476385e-10, +3.7604995860703352e-10,
-    +1.8473880457488758e-09, +2.8864920226939352e-10, +4.7500109583940058e-10, +3.4913441078144535e-09,
-    +3.6184672879544140e-10, +6.9515227310890116e-10, +9.5135864050698054e-09, +4.6543387361016928e-10,
-    +9.8756033352958430e-10, +4.5643653334444746e-08, +5.4688889452415732e-10, +1.2724824408589185e-09,
-    +3.2806309808158322e-08, +5.1766181593681096e-10, +1.2284593627872477e-09, +3.0223970806545888e-08,
-    +6.7526523258567843e-10, +1.8090345795530704e-09, +2.0437283892328094e-08, +6.0516612980956960e-10,
-    +1.3727882731857043e-09, +1.5732128172605726e-08, +4.7234263565124322e-10, +8.9711412479716517e-10,
-    +3.6537554992537034e-09, +3.8917507035519756e-10, +6.6355193134018848e-10, +1.7967603803037936e-09,
-    +3.2431013766660362e-10, +5.1583031631961780e-10, +1.4422309191663195e-09, +2.4097106765670885e-10,
-    +3.6863934500019528e-10, +8.8743893908712071e-10, +2.3245243687073391e-10, +3.6369979142518990e-10,
-    +1.3365839571984842e-09, +2.6847174171996042e-10, +4.3870158507896982e-10, +3.0756484241172698e-09,
-    +2.5972971734476423e-10, +4.4634623429739883e-10, +2.1891865650645191e-09, +2.2654046400377195e-10,
-    +3.6633539346572287e-10, +9.4320926543210636e-10, +2.3236296593741844e-10, +3.6882593893491512e-10,
-    +6.7256574032669553e-10, +2.8035247958063153e-10, +4.4584937706154602e-10, +8.3691687819650266e-10,
-    +3.9947281237393316e-10, +7.1547507866113900e-10, +2.0038964524101348e-09, +5.1273759368568856e-10,
-    +1.1219019870052035e-09, +1.4319497867905562e-08, +5.3076193442983079e-10, +1.2177526746777601e-09,
-    +1.2533514460999700e-08, +5.0022195823719436e-10, +1.1161834567657193e-09, +8.7193817058530467e-09,
-    +7.6548250699816687e-10, +1.9774300445512305e-09, +1.3731779970581303e-08, +7.5789402081574378e-10,
-    +1.7917785249362845e-09, +1.3273839806336720e-08, +7.7055273483725229e-10, +1.7849034901165559e-09,
-    +1.3709708520492016e-08, +8.8480588253916677e-10, +2.2856138702075541e-09, +1.5938944661115757e-08,
-    +8.5364755503418873e-10, +2.2249930258149916e-09, +2.0155056477390759e-08, +7.5283307403415985e-10,
-    +1.7493998959187593e-09, +1.4337788930283507e-08, +7.5483806228447060e-10, +1.5848967429707808e-09,
-    +1.2912716069607861e-08, +9.6778087992304587e-10, +2.2654288795210890e-09, +1.2992871422115572e-08,
-    +9.6067286665016493e-10, +2.3094260951213644e-09, +1.1386773381381278e-08, +8.1109713182500110e-10,
-    +2.2743832253083514e-09, +9.0707932874061016e-09, +8.4877692064804604e-10, +2.6052912094080005e-09,
-    +9.9419557801491987e-09, +8.6804855465353063e-10, +2.6783532073524695e-09, +1.0572548877977102e-08,
-    +9.4240538406148013e-10, +3.2578823951434082e-09, +1.5803700091855936e-08, +8.5267162668083154e-10,
-    +2.2391862925989872e-09, +1.0494550332183470e-08, +7.0164457440377233e-10, +1.6373798869078449e-09,
-    +7.2160286527138141e-09, +6.3850712702069854e-10, +1.5500197231484614e-09, +8.0266200606858551e-09,
-};
-
-const double OJAMA_COV[] = {
-    +8.4124689230432927e-11, +1.7816535120776732e-10, +2.5043376317342363e-09, +8.2733755320816699e-11,
-    +1.6468522614852162e-10, +1.6390753169057046e-09, +8.1564225197272343e-11, +1.5805658551289991e-10,
-    +1.2673026879511331e-09, +7.9832310947150778e-11, +1.4250502127593282e-10, +5.4639452255534215e-10,
-    +7.2198277830639107e-11, +1.0649310175582455e-10, +2.2356372324921999e-10, +5.3808383499622463e-11,
-    +6.2698673360733301e-11, +9.0659017972265192e-11, +4.4434681905869758e-11, +4.5836740192783843e-11,
-    +5.8847536676283619e-11, +4.6174344953798817e-11, +4.7792259075858791e-11, +5.9242537097384443e-11,
-    +5.3224055601406621e-11, +6.0970359832627860e-11, +7.9693204998587169e-11, +6.1883784246956010e-11,
-    +7.7687519237939577e-11, +1.0217741803611601e-10, +7.9439498848719368e-11, +1.0145717357242919e-10,
-    +1.6094698499486730e-10, +9.6867182503251023e-11, +1.4205519579890509e-10, +4.2266379196284598e-10,
-    +9.5089005539499337e-11, +1.8063858391549869e-10, +9.8750409259961791e-10, +8.7864107149974572e-11,
-    +1.8144030003101546e-10, +1.7012171652519647e-09, +8.7142006751276248e-11, +1.8927876717157544e-10,
-    +2.6879192124162458e-09, +8.2734448438592710e-11, +1.8240339122809191e-10, +2.8111447304342744e-09,
-    +1.0450813544891892e-10, +2.3538074933801134e-10, +3.2386011094391593e-09, +5.6173086136153738e-11,
-    +1.0027829612796102e-10, +8.5143261170011359e-10, +3.8695897334479240e-11, +6.2838114373393138e-11,
-    +4.0773875251416909e-10, +3.5057233317809226e-11, +5.4516511637245163e-11, +2.1492752097754475e-10,
-    +3.0905808137025961e-11, +4.1920567595483090e-11, +9.7627791489249506e-11, +2.5613376283076172e-11,
-    +3.0176929609718000e-11, +4.8734788359398842e-11, +2.4626637778885531e-11, +2.5840695675471389e-11,
-    +3.9291357668193121e-11, +2.6003941224786484e-11, +2.7534185188701931e-11, +4.4264050867284037e-11,
-    +2.9954397191172693e-11, +3.5605974931421354e-11, +6.3350449009428761e-11, +3.7295472017001075e-11,
-    +4.9526605584080742e-11, +9.0060221650035582e-11, +4.6041286588833653e-11, +6.5844087928657272e-11,
-    +1.4470285378298491e-10, +4.9642826907201011e-11, +7.6078866371995738e-11, +2.8018425536400790e-10,
-    +4.9094465348748524e-11, +8.4213336374764205e-11, +4.6277009902504443e-10, +5.4552316271681741e-11,
-    +1.0161543110255693e-10, +9.0322867498932325e-10, +8.0020982199315822e-11, +1.7707661855659223e-10,
-    +1.9771644583311518e-09, +9.7060687978728335e-11, +2.2568403420807667e-10, +3.1204227201710477e-09,
-    +1.0909066483492579e-10, +2.8379009876159538e-10, +3.4688088059568094e-09, +5.5139207848708082e-11,
-    +1.1170084639085340e-10, +9.4519297495041470e-10, +4.4764234383170833e-11, +8.3672702836339133e-11,
-    +4.0361316425841811e-10, +3.8270046759567174e-11, +5.9584882073695204e-11, +1.3136432690655322e-10,
-    +2.7184374217838701e-11, +3.3486037420452970e-11, +5.6079555000919886e-11, +2.1078976216109078e-11,
-    +2.2856415944228951e-11, +3.5679910667648478e-11, +2.1658381997213402e-11, +2.1071330756513064e-11,
-    +3.1716758163982382e-11, +2.4969921537772862e-11, +2.3723566256529598e-11, +3.4636027136179497e-11,
-    +2.9373643202102726e-11, +3.1084173239577176e-11, +4.9122389771275459e-11, +3.2546299530656929e-11,
-    +4.0686890602608978e-11, +7.4148558162703963e-11, +3.5111043316695478e-11, +4.9433568468677713e-11,
-    +1.1577318884344463e-10, +4.1312349833452874e-11, +6.3431633882081572e-11, +1.7744047775099042e-10,
-    +4.9485809773344977e-11, +8.7282089008674752e-11, +3.1354262908543749e-10, +5.6035818473075550e-11,
-    +1.1299616306013927e-10, +7.1305513849811264e-10, +7.7643111480077606e-11, +1.9531960127899062e-10,
-    +1.6687732397845775e-09, +1.0571934486913174e-10, +2.9557351605858748e-10, +2.9924540990682878e-09,
-    +1.1996539040235330e-10, +2.9341681056459535e-10, +3.1500455098100268e-09, +6.5924150082706036e-11,
-    +1.2026528123913701e-10, +8.4721981610617271e-10, +5.0705475186654640e-11, +7.5190508927389909e-11,
-    +2.6591546816213846e-10, +3.5771569473952045e-11, +4.1837210842705060e-11, +7.9309571470929044e-11,
-    +2.4342690538999184e-11, +2.4557886499138916e-11, +3.6767550648574573e-11, +1.9060589992951421e-11,
-    +1.8140320101575552e-11, +2.5517701663442204e-11, +1.8509954192031264e-11, +1.6535081012548878e-11,
-    +2.2599109785299822e-11, +2.1383004869425535e-11, +1.8930089187123305e-11, +2.5235571892728928e-11,
-    +2.6677976826245155e-11, +2.5100217046117557e-11, +3.2992229236552156e-11, +3.1516959976421819e-11,
-    +3.3525120174296726e-11, +4.4683372691914833e-11, +3.6382694146710310e-11, +4.2336911806231792e-11,
-    +6.5914651674490902e-11, +4.0495775277616392e-11, +5.0658671747649431e-11, +9.2964902038972660e-11,
-    +4.8081194857613015e-11, +6.7619219691864815e-11, +1.5984312226176854e-10, +5.9712515107545387e-11,
-    +1.0152125271371222e-10, +4.1962715706627987e-10, +8.1214835741022646e-11, +1.8268221251691095e-10,
-    +1.2237810553579954e-09, +1.0728597129107982e-10, +2.7914791397854230e-10, +2.0581808158402898e-09,
-    +1.1524272874530712e-10, +2.5617422267065739e-10, +1.9381914205952632e-09, +6.3071632073300811e-11,
-    +1.0471685873970327e-10, +5.0244978663672204e-10, +4.3196572860833294e-11, +5.3795144099989850e-11,
-    +1.5345654583137762e-10, +3.0734334626481930e-11, +3.0620111897406598e-11, +5.2135273775961730e-11,
-    +2.4296464107460378e-11, +2.2082671724867467e-11, +3.0148521822869948e-11, +2.0513581290647196e-11,
-    +1.7998640214646983e-11, +2.3837226326664849e-11, +1.8892608426654372e-11, +1.6130707832478935e-11,
-    +2.2375449503792004e-11, +1.9102518955379536e-11, +1.6434249745783305e-11, +2.2925097966493643e-11,
-    +2.4934636088753991e-11, +2.1294071317369610e-11, +2.9391789068322023e-11, +3.3853734759750402e-11,
-    +3.0645317633390913e-11, +3.9345872584645926e-11, +4.4361050871865156e-11, +4.4561161512316539e-11,
-    +5.2752419661949889e-11, +4.6479357006206919e-11, +4.9424791897040961e-11, +6.4291306725186499e-11,
-    +4.8008213834381078e-11, +5.6122032012650654e-11, +8.4027545519746638e-11, +5.7267973688708813e-11,
-    +8.5298658998091048e-11, +1.9583125120895734e-10, +7.9691943009987264e-11, +1.6835426069080008e-10,
-    +6.7349707600336016e-10, +1.0503228332601631e-10, +2.6818026168918167e-10, +1.5725315448295140e-09,
-    +1.2660836908431759e-10, +2.5943952613447494e-10, +1.6674731372704446e-09, +6.9589439207082438e-11,
-    +1.0307612448005866e-10, +2.9837879275523584e-10, +4.1450900049653066e-11, +4.4996136209005676e-11,
-    +9.5230741964607971e-11, +2.8689342366110842e-11, +2.6285581494771507e-11, +3.9972248689148160e-11,
-    +2.2343053115345191e-11, +1.9555391764774210e-11, +2.5540381846899009e-11, +1.9529766523130723e-11,
-    +1.5844257479095652e-11, +2.1193442263439076e-11, +1.7873076235118723e-11, +1.3925151549911309e-11,
-    +1.9297780107532512e-11, +1.7895826994154149e-11, +1.3886984184662077e-11, +1.9399143138230316e-11,
-    +2.3206080273751312e-11, +1.7027977630708477e-11, +2.5422771305168013e-11, +3.5080649339891069e-11,
-    +2.5341765652485160e-11, +3.6029947908372803e-11, +4.7610013752700119e-11, +3.7406189940647485e-11,
-    +4.7745397079558143e-11, +4.5489960834394137e-11, +4.1744692487155101e-11, +5.0766238131281133e-11,
-    +4.4491023538496539e-11, +4.4709048128157037e-11, +6.2652164286425963e-11, +5.1437555556409142e-11,
-    +6.3961058374942872e-11, +1.0853409585721817e-10, +7.4682613784993739e-11, +1.3556322436083208e-10,
-    +3.1000279178903660e-10, +9.6195850710281481e-11, +2.5121516411220655e-10, +5.5765997500665705e-10,
-    +1.3795150570606184e-10, +2.7690783558352386e-10, +1.3478235670538591e-09, +7.7598700147466485e-11,
-    +1.0048518668474993e-10, +2.0850165885097701e-10, +3.7435465775931224e-11, +3.7753796540459862e-11,
-    +5.8643370110612476e-11, +2.2433267432459917e-11, +1.9568449178158270e-11, +2.7880435733084902e-11,
-    +1.8037593187323932e-11, +1.4355200028327799e-11, +1.9659033993187393e-11, +1.4340659508325694e-11,
-    +1.1239776635677201e-11, +1.4175247145442284e-11, +1.3750797484702174e-11, +1.0718017472536480e-11,
-    +1.3358935233797471e-11, +1.7085807339933297e-11, +1.2466919790221002e-11, +1.7382019326243324e-11,
-    +2.6490237972430609e-11, +1.7369639836168100e-11, +2.8148743903635413e-11, +3.4567276719613581e-11,
-    +2.3260882634510881e-11, +3.7111776841651019e-11, +3.7636769875017974e-11, +2.8278744638207909e-11,
-    +3.9169871164042222e-11, +3.6927990539681672e-11, +3.2705617276153252e-11, +4.0007163777162904e-11,
-    +3.4817199139758524e-11, +3.4806965616223532e-11, +4.1662828893446225e-11, +4.3420960284166521e-11,
-    +4.9844925307053171e-11, +6.4008670436297540e-11, +7.4313523912591933e-11, +1.1315293609140251e-10,
-    +1.9684849608903305e-10, +1.0542512727855628e-10, +2.5670046807129603e-10, +5.3659285273740543e-10,
-    +1.4316158064180895e-10, +2.5293896415779184e-10, +1.0968852275601046e-09, +6.8646949515792536e-11,
-    +7.4486386287085660e-11, +1.4475269488519979e-10, +3.6818646768722346e-11, +3.2240587506213881e-11,
-    +5.2235927697637634e-11, +2.3773925638380492e-11, +1.8320294509171226e-11, +2.8529685206827720e-11,
-    +1.6627624972470515e-11, +1.2920960960581121e-11, +1.7533957915167129e-11, +1.4303515942872794e-11,
-    +1.1075572084787780e-11, +1.4381280516039802e-11, +1.9964777165444394e-11, +1.4161037605397774e-11,
-    +1.9145146271233911e-11, +3.3851474850015078e-11, +2.1437176548118289e-11, +3.2710778267492225e-11,
-    +5.1434495289584010e-11, +3.1795564055686388e-11, +5.1626520713872502e-11, +4.0022629305298561e-11,
-    +2.9192098840569940e-11, +4.5503301081319768e-11, +2.8269881210992118e-11, +2.3743644951724958e-11,
-    +3.3180446637997047e-11, +3.1187166162790615e-11, +2.9156076802123304e-11, +3.5897595347743913e-11,
-    +3.6806670830833963e-11, +3.5593755747435593e-11, +4.5942573509358923e-11, +4.0452013564874757e-11,
-    +4.2914885686162150e-11, +5.7065080662905031e-11, +7.0998735998070751e-11, +9.3176407829953485e-11,
-    +1.4791604243600589e-10, +1.1680964428585926e-10, +2.5527522871358445e-10, +5.5484937994647276e-10,
-    +1.4312502626800687e-10, +1.7197900553700570e-10, +7.5414946174909615e-10, +6.4364070448106248e-11,
-    +6.0436670570164252e-11, +1.3270660196982261e-10, +3.9295117407886891e-11, +3.0108848475371755e-11,
-    +5.5826655311282925e-11, +3.0924103148950185e-11, +2.1241158310846973e-11, +3.6286658333547936e-11,
-    +2.5459430228867242e-11, +1.8609458911826181e-11, +2.7039976887790779e-11, +2.1698694647959369e-11,
-    +1.6965631279875758e-11, +2.2196444538705265e-11, +3.1010160335115501e-11, +2.4212202869566211e-11,
-    +3.1946539341290135e-11, +5.3630921790636259e-11, +4.2038239104627823e-11, +5.9164510071415205e-11,
-    +6.6278866759355868e-11, +5.2946010644111480e-11, +7.5907758101111170e-11, +4.4764512297005871e-11,
-    +3.5941277291047642e-11, +4.9410585764539623e-11, +3.0794996240459181e-11, +2.5996905789363632e-11,
-    +3.4755325328863257e-11, +3.1659916039692540e-11, +2.8701180020611649e-11, +3.7281955693149478e-11,
-    +3.6396676126677333e-11, +3.3854663037477287e-11, +4.5501088184663554e-11, +4.1298824027660741e-11,
-    +4.0843481759568754e-11, +5.7291414070911653e-11, +6.8725540068712073e-11, +8.0596784104122952e-11,
-    +1.2057277099896632e-10, +1.2444077341508110e-10, +2.2362991533972718e-10, +4.0874250498728936e-10,
-    +8.9654281829585347e-11, +9.5875437150204825e-11, +3.6864992200891200e-10, +4.9547276425181062e-11,
-    +4.3226232013392957e-11, +9.9809504966173115e-11, +3.5979820191245386e-11, +2.8440060332241972e-11,
-    +5.7240670127536536e-11, +3.0874200227628582e-11, +2.4915318642808078e-11, +4.0185883095896051e-11,
-    +2.6466675446444592e-11, +2.0322118250806304e-11, +3.1317051107057604e-11, +2.2024610321113072e-11,
-    +1.7413452384359860e-11, +2.4800649483356193e-11, +3.0100805121161659e-11, +2.4916091349260061e-11,
-    +3.6692795367621995e-11, +4.9704332038730651e-11, +4.5296572810646396e-11, +7.6269471657986980e-11,
-    +5.7940101010341350e-11, +5.0897629445153180e-11, +7.5493322186814768e-11, +3.3992953195740274e-11,
-    +2.7040546634561955e-11, +3.4287170940708063e-11, +2.4931405537706487e-11, +1.9736477743525598e-11,
-    +2.4812705368393245e-11, +2.7798182569617066e-11, +2.2806033004093514e-11, +2.9916735952010575e-11,
-    +3.2864011606319375e-11, +3.0092465650938859e-11, +3.9241497575750176e-11, +3.8036921306087276e-11,
-    +3.4866338648329343e-11, +5.1699305103087816e-11, +5.4611925288467786e-11, +5.8761874859180025e-11,
-    +8.6451447193427408e-11, +9.1260738020999017e-11, +1.3950532239387608e-10, +2.2967430299816312e-10,
-    +8.2699148907358255e-11, +1.0290482676757794e-10, +5.0960930491268299e-10, +4.9554792973220713e-11,
-    +4.7765918079718371e-11, +1.0520843023019197e-10, +4.1177845032761887e-11, +3.5663483908087145e-11,
-    +7.5551071321781199e-11, +3.8298522947747724e-11, +3.3447356563699034e-11, +4.7313127557843185e-11,
-    +3.0504015622420856e-11, +2.4230653830202070e-11, +3.1856864354999830e-11, +2.2854676134447386e-11,
-    +1.8227763994799987e-11, +2.2912347736327866e-11, +2.8723744539501825e-11, +2.4640241356667306e-11,
-    +3.1429832454423161e-11, +4.0604946293944640e-11, +4.0675749908693624e-11, +6.1705542181831822e-11,
-    +4.5064271613001852e-11, +4.3099544142668099e-11, +5.3684486476951553e-11, +2.9064744258996191e-11,
-    +2.4239806007837979e-11, +2.5651746682656255e-11, +2.1167602565129954e-11, +1.7090285361262676e-11,
-    +1.8413491634363842e-11, +2.4743526683116110e-11, +2.0418878688214238e-11, +2.1716220152513150e-11,
-    +3.1537805447039424e-11, +2.8770786189828124e-11, +3.1176064607599340e-11, +3.3468371898461763e-11,
-    +3.1656782882521232e-11, +4.4487617520092745e-11, +4.3370703013893565e-11, +4.7493974293555829e-11,
-    +7.0767547533064233e-11, +7.2834935151312202e-11, +1.1521256711546867e-10, +2.3846237641649640e-10,
-    +8.2082115420897686e-11, +1.2191959860865091e-10, +5.7303455775266844e-10, +5.5286511973511564e-11,
-    +5.9143786471421608e-11, +1.1156711191744709e-10, +5.2145819829474584e-11, +4.7387824459014524e-11,
-    +9.0695925792932480e-11, +5.5240776849628837e-11, +4.6996104825743476e-11, +7.6325091489965856e-11,
-    +3.8421182637880709e-11, +3.1137769406961139e-11, +3.9349878168808085e-11, +2.5957371865148162e-11,
-    +2.1971402935466107e-11, +2.5157462848668764e-11, +3.2449554896823387e-11, +2.9109208192614859e-11,
-    +3.4659310878326543e-11, +3.7809151025961882e-11, +4.1385837768822147e-11, +5.0067762859308891e-11,
-    +3.6340201874373593e-11, +3.7909725817915296e-11, +4.2286448534219911e-11, +2.7295712773344689e-11,
-    +2.4048770737174057e-11, +2.5207935234437519e-11, +2.2774492785558468e-11, +1.8964246587780010e-11,
-    +1.9525285204224778e-11, +2.8001160229530918e-11, +2.2809956897212590e-11, +2.5332958572439075e-11,
-    +3.5656467655546761e-11, +3.0305924416872380e-11, +4.0336465463358605e-11, +3.6850618138612447e-11,
-    +3.3881216695719222e-11, +5.2710583703615725e-11, +4.5382774410064799e-11, +5.0173122582743629e-11,
-    +8.3599900666295762e-11, +8.0585931663869672e-11, +1.3172293872167658e-10, +4.6663139627036742e-10,
-    +8.7966294165480662e-11, +1.5329748678760882e-10, +9.4433859526260287e-10, +6.3658071572919892e-11,
-    +8.2232869561118206e-11, +1.7588321688998659e-10, +5.3620200602971198e-11, +5.8229843714223228e-11,
-    +1.1584942907949062e-10, +6.0064972721870476e-11, +6.0979947657630101e-11, +1.1072663610751712e-10,
-    +5.1744266412306109e-11, +4.8091260882904141e-11, +6.6301743105823023e-11, +3.7457869807350899e-11,
-    +3.4176670297938083e-11, +3.9523488896224474e-11, +3.8026941388353887e-11, +3.5282952202005058e-11,
-    +4.0134468625122550e-11, +3.5504245185239429e-11, +3.4408433981647920e-11, +3.8975563481649068e-11,
-    +3.3202153626445237e-11, +3.0319954615954005e-11, +3.5167030959004572e-11, +2.8974274490404896e-11,
-    +2.4281845379264784e-11, +2.9243357036999976e-11, +2.8938440147607582e-11, +2.3442827319689389e-11,
-    +2.8500324747136117e-11, +3.6007687085378942e-11, +2.8685495649059379e-11, +3.7112914650830866e-11,
-    +3.8558280250908175e-11, +3.2102164526352446e-11, +4.7042502258330744e-11, +3.6994758986640155e-11,
-    +3.5408748603835312e-11, +5.5251347251738363e-11, +5.2464103750546015e-11, +6.3816576859108201e-11,
-    +1.1866477398108655e-10, +8.7555628811330193e-11, +1.6003621911544910e-10, +7.9266981379886005e-10,
-    +9.1950123111101927e-11, +2.2734080959332343e-10, +2.8923486823172329e-09, +7.3324885147541034e-11,
-    +1.2384889172396993e-10, +4.8963157858419374e-10, +5.5876738272476250e-11, +7.2648542888455620e-11,
-    +1.8273928847159064e-10, +5.2301980643825634e-11, +6.2033689149080404e-11, +1.2425206622497767e-10,
-    +4.6861113095006091e-11, +5.0112178916280449e-11, +7.8510284923599361e-11, +3.6612168106989332e-11,
-    +3.6340188985222845e-11, +4.8800442184281486e-11, +3.5422741571132487e-11, +3.1521452384271545e-11,
-    +4.3928113108163701e-11, +3.3528547016201671e-11, +2.7023100949513659e-11, +3.8490715058649884e-11,
-    +3.3499579686351481e-11, +2.5119173345620827e-11, +3.4984270441068427e-11, +3.0958576575627183e-11,
-    +2.3634748981948349e-11, +3.2049976383524108e-11, +2.9905463052658203e-11, +2.4204262317340316e-11,
-    +3.2628930869169888e-11, +3.4297707385346400e-11, +2.8599811309353973e-11, +3.8986117179381845e-11,
-    +3.8568501345210241e-11, +3.4359426630573568e-11, +4.9841237886437378e-11, +4.5097301825902868e-11,
-    +4.7365745040355318e-11, +7.7816290428612100e-11, +6.7527117587658144e-11, +1.0553740906119310e-10,
-    +2.7008668205997823e-10, +9.1888286480135460e-11, +2.2159957022323181e-10, +1.7839479192389068e-09,
-    +7.9362704146419700e-11, +2.1779976930217885e-10, +4.9112396326862598e-09, +7.4774784586911011e-11,
-    +1.5664814252410709e-10, +1.1480364258778661e-09, +6.1078927215814335e-11, +9.9015394079861601e-11,
-    +4.6073419733155744e-10, +5.7370035365739897e-11, +7.8837549161118934e-11, +2.7185750731424516e-10,
-    +5.3497416125703339e-11, +6.3385913091513860e-11, +1.5613480810547242e-10, +4.3080945814718611e-11,
-    +4.4970668702278956e-11, +9.3619022970028552e-11, +3.6412869143396763e-11, +3.4239434800972493e-11,
-    +7.1296302828028317e-11, +3.3739250069857333e-11, +2.8364044422208789e-11, +5.7735205335142685e-11,
-    +3.6405870640742782e-11, +2.8389599407788736e-11, +5.5610220739292401e-11, +3.9753128016827104e-11,
-    +3.1031297687072787e-11, +6.1910029223905804e-11, +4.5041402796355348e-11, +3.7870897074286055e-11,
-    +7.0602610545462065e-11, +5.0107423674620177e-11, +4.7208946666848140e-11, +8.5263928433742743e-11,
-    +5.4128374474418179e-11, +6.1519614574845465e-11, +1.2294221350052355e-10, +5.7395187933525121e-11,
-    +8.5639181050494038e-11, +1.9717751076418735e-10, +7.4993673490585155e-11, +1.7561958538354245e-10,
-    +7.0599801319025857e-10, +8.2608093945951319e-11, +2.4226343758618515e-10, +3.3851804066394097e-09,
-    +6.8234987623906492e-11, +1.6957072469528997e-10, +3.1880166178936774e-09, +7.0240250428979585e-11,
-    +1.5485767702135428e-10, +2.0633761826480338e-09, +7.5974485497955072e-11, +1.5691370572226282e-10,
-    +1.3282529940904544e-09, +7.7700226332701492e-11, +1.3004904152867392e-10, +6.2709860075294881e-10,
-    +6.8716237049552528e-11, +8.9539728654531068e-11, +2.8343655224778147e-10, +5.3706286598256772e-11,
-    +6.2700005646843345e-11, +1.4587918180167771e-10, +4.6348393111089241e-11, +5.2871236887250750e-11,
-    +1.0609892874128026e-10, +5.1125022503197371e-11, +5.4697911804345870e-11, +9.5232075926946950e-11,
-    +6.3054848335932275e-11, +6.2094872941831655e-11, +1.0384317278145329e-10, +7.1599393358414705e-11,
-    +6.9767738060210019e-11, +1.2207836634900069e-10, +8.5457318358538681e-11, +7.8458746399499123e-11,
-    +1.5100823446679162e-10, +9.4285298023396408e-11, +9.6316358328081856e-11, +2.1596761479747988e-10,
-    +9.6442002979691118e-11, +1.5060924623227299e-10, +3.7731053496658539e-10, +9.4563774373086169e-11,
-    +2.4032909064118762e-10, +1.0239695282396541e-09, +8.1618859667162373e-11, +2.3365476606546549e-10,
-    +2.3780185232471066e-09, +7.0510020116523352e-11, +1.9057177398184126e-10, +3.7374100064839659e-09,
-};
-
-const double ZENKESHI_COV[] = {
-    +1.6243309333576809e-10, +3.2769456396869546e-10, +5.6768728192187046e-09, +1.7063698311939669e-10,
-    +3.4281050092231153e-10, +7.0732182275050614e-09, +1.7879809407618276e-10, +3.5193456358467413e-10,
-    +6.7356522742683756e-09, +1.9197190424528689e-10, +3.6370242244445956e-10, +6.8699318752136333e-09,
-    +2.0085235307352042e-10, +3.6753196443227884e-10, +6.8658985177218011e-09, +2.2001880231840162e-10,
-    +3.8621265752345745e-10, +5.4054515416647436e-09, +2.3555758292848054e-10, +3.9307489285689002e-10,
-    +5.4771822204465194e-09, +2.8048437950361147e-10, +5.1596797807996679e-10, +9.9282652061235252e-09,
-    +2.7988784438418023e-10, +5.7092909622932544e-10, +1.2643972009735669e-08, +2.5059715604489443e-10,
-    +5.3360751624307697e-10, +8.5525881239223462e-09, +2.3717552331209580e-10, +5.1681480722962078e-10,
-    +7.9616927294403441e-09, +2.3559876342323439e-10, +5.4765664864226865e-10, +9.4117557591780413e-09,
-    +2.1733503814907479e-10, +5.2907924247900728e-10, +9.7089866215115781e-09, +2.0061903044144390e-10,
-    +4.8153056508688666e-10, +7.3824186857403490e-09, +1.8172252271877695e-10, +4.0827372567899082e-10,
-    +7.0027863596730282e-09, +1.5175899692867057e-10, +3.1996954801176169e-10, +5.5314246846387065e-09,
-    +1.6820792445156772e-10, +3.3492323390844844e-10, +6.8452163311171563e-09, +1.7394386024982522e-10,
-    +3.5462150570964367e-10, +8.2552850479343886e-09, +1.6510443580951236e-10, +3.2685218345761585e-10,
-    +6.7421981188039250e-09, +1.6413066324517663e-10, +3.0723989448975427e-10, +5.9172574155676387e-09,
-    +1.5982703796689552e-10, +2.8190102655614867e-10, +4.1838187371242916e-09, +1.6072382215033944e-10,
-    +2.6369452134557932e-10, +2.6317452251871404e-09, +1.8071086707605644e-10, +2.8426046553249857e-10,
-    +3.5829388777391719e-09, +2.0174778093192309e-10, +3.5764433184692621e-10, +6.9959398573321630e-09,
-    +2.0037176251471313e-10, +4.0133209812892340e-10, +8.1652735634872818e-09, +1.8831686887328632e-10,
-    +3.8885139849419947e-10, +3.8060352918200026e-09, +1.8662113037930027e-10, +3.7741615818837518e-10,
-    +3.1367087357755520e-09, +1.7717284320009301e-10, +3.6158544952034147e-10, +3.9235877980515457e-09,
-    +1.7339193855320697e-10, +3.5778373969440132e-10, +5.5932374760938719e-09, +1.7020826026232351e-10,
-    +3.7041264254708524e-10, +6.7267576447633273e-09, +1.8222961583576364e-10, +4.2380141630881994e-10,
-    +1.1479131954010732e-08, +1.6186736954498547e-10, +3.6660196678413715e-10, +1.0786876655657562e-08,
-    +1.8495599111185810e-10, +3.9868143594325142e-10, +8.3285401890499918e-09, +1.8268561927492222e-10,
-    +4.3321636559332861e-10, +1.1166751185945212e-08, +1.8595766534540510e-10, +4.5535635085828440e-10,
-    +1.3569999369402187e-08, +1.9496781856409992e-10, +4.4507024267919435e-10, +1.2669416867663784e-08,
-    +1.7949757029315491e-10, +3.6306652465280738e-10, +7.6264124964381858e-09, +1.7330420618089840e-10,
-    +3.2145294664297343e-10, +4.1824671387426011e-09, +1.8956761309108428e-10, +3.3016954082768212e-10,
-    +3.9942643801436295e-09, +2.0725380693176061e-10, +3.9767880275357026e-10, +7.0050919523044309e-09,
-    +1.9709397271374464e-10, +4.2028351080759007e-10, +8.9307322670866866e-09, +1.7127501620256864e-10,
-    +3.5650205475788213e-10, +5.1654060914941521e-09, +1.6312586903257377e-10, +3.2684697546354879e-10,
-    +3.4974136678387448e-09, +1.7010359966329827e-10, +3.5199737324353963e-10, +5.0477241878679253e-09,
-    +1.8111588190206420e-10, +3.9075435022197398e-10, +8.4987573244521613e-09, +1.7457085070146181e-10,
-    +3.9275101015844315e-10, +8.8970511622524945e-09, +1.8778707699403850e-10, +4.7382895083148535e-10,
-    +1.3890109868129859e-08, +1.6696453387173619e-10, +3.7447758350241486e-10, +7.4031124505907687e-09,
-    +2.0024472344185315e-10, +4.1571336473042603e-10, +7.2526066430352666e-09, +2.1183299037639315e-10,
-    +4.8491676794764300e-10, +1.2296223752219447e-08, +2.1296976357458216e-10, +4.8547188700728972e-10,
-    +1.6436006220765378e-08, +2.0160233125645963e-10, +4.0761241771844311e-10, +1.0007426411065357e-08,
-    +1.8275103744607096e-10, +3.3134929976669938e-10, +5.7092155719928450e-09, +1.7510221619448860e-10,
-    +2.8025260751503315e-10, +2.1318197481339820e-09, +1.7830145053270857e-10, +2.6793662690342853e-10,
-    +2.3977944262026412e-09, +1.9156928587961017e-10, +3.1268863225114746e-10, +5.0206771315953815e-09,
-    +1.8869042568916876e-10, +3.4081783488115016e-10, +6.5142288901087792e-09, +1.7196088989410406e-10,
-    +3.0423646314711506e-10, +3.4317758718434352e-09, +1.6558996453584672e-10, +2.8235800254664512e-10,
-    +2.8507456942101813e-09, +1.6572940690419905e-10, +2.8066864210406785e-10, +3.2273991106081872e-09,
-    +1.8861464722189441e-10, +3.3723416919287055e-10, +5.4559841181976617e-09, +1.9385174189818264e-10,
-    +3.8592836024739056e-10, +1.0092114666485719e-08, +1.9894702904066625e-10, +4.2870141555633751e-10,
-    +1.2674216452372450e-08, +1.7900567873515880e-10, +3.7188760969893402e-10, +9.1434372234138683e-09,
-    +1.9335115864863000e-10, +3.7742420353805452e-10, +8.1297461305476931e-09, +2.0406178739436427e-10,
-    +4.2887660840463807e-10, +1.1298432723216879e-08, +1.9495452689656659e-10, +3.8147517473185294e-10,
-    +1.2593013413788353e-08, +1.8461629243902134e-10, +3.2643587378577635e-10, +7.4336636028301075e-09,
-    +1.9264683591102495e-10, +3.1581370779867764e-10, +4.1364373926147622e-09, +2.2034475752880500e-10,
-    +3.4914605809975164e-10, +2.8890536015388405e-09, +2.0903734450090085e-10, +3.0177905746596845e-10,
-    +2.3410910637578592e-09, +1.8901179616779307e-10, +2.8254565478432744e-10, +3.2474149497234235e-09,
-    +1.9137191195917403e-10, +3.0923032503758381e-10, +3.5195005901868283e-09, +2.0507136813673320e-10,
-    +3.4951429681083280e-10, +3.3301153207946119e-09, +2.1536633683275600e-10, +3.6363038277605789e-10,
-    +4.6392679019988633e-09, +2.0992385240860945e-10, +3.3642069622834383e-10, +5.9718726827081189e-09,
-    +2.1325946475878166e-10, +3.5084685507024395e-10, +7.9706265831507337e-09, +2.1355195718937045e-10,
-    +3.9551658363836386e-10, +1.0579593396814518e-08, +2.1159098903811352e-10, +4.3684539054052679e-10,
-    +1.4181614951540385e-08, +1.8482683671903270e-10, +3.7635247611200848e-10, +8.9571935808343733e-09,
-    +2.1267622070649478e-10, +4.3201051723037228e-10, +1.0211550548283235e-08, +2.3050843223461129e-10,
-    +4.8447341410499502e-10, +1.2245937964209196e-08, +2.1184036644370612e-10, +3.9922277537541142e-10,
-    +9.8111663454703178e-09, +2.1483469160852139e-10, +3.6098599253382413e-10, +6.4402452056383647e-09,
-    +2.4234417654956592e-10, +3.7762834648996589e-10, +3.9029073580423252e-09, +2.9717335736567081e-10,
-    +4.0587953671258140e-10, +2.1415724548432240e-09, +3.1742045640401283e-10, +4.2211803065048899e-10,
-    +1.9351435441392826e-09, +2.7124280467532548e-10, +3.7902159427056440e-10, +3.0586513431741751e-09,
-    +2.2700535103210346e-10, +3.2312715940286236e-10, +3.3925665156175150e-09, +2.4226634637547261e-10,
-    +3.5526182179709901e-10, +2.5604255894351267e-09, +2.5582772218992470e-10, +3.8167572537168989e-10,
-    +2.9428916484298930e-09, +2.6062236144015592e-10, +4.1446549207375491e-10, +8.1082160788666024e-09,
-    +2.5338564324866382e-10, +4.4607729929614415e-10, +1.3178202867653399e-08, +2.3875484605157662e-10,
-    +4.5289942226886223e-10, +1.0102451894371929e-08, +2.4868414869263426e-10, +5.4856397331745967e-10,
-    +1.5569647228071085e-08, +2.1496914275635758e-10, +4.7448339091790982e-10, +1.2885812335332846e-08,
-    +2.3089166173001660e-10, +5.1003753329995691e-10, +9.3614226314321165e-09, +2.5133201753197109e-10,
-    +5.2597465034350797e-10, +6.1353163281056557e-09, +2.2681513541781036e-10, +4.4631762543459478e-10,
-    +6.2591598501234646e-09, +2.2426054872581050e-10, +3.9085958277597654e-10, +5.4659354403825994e-09,
-    +2.4696144131326110e-10, +3.7313717408608153e-10, +3.1466494299084404e-09, +3.1337105588184760e-10,
-    +4.1387853408598456e-10, +2.0609510145929007e-09, +3.1690955671986765e-10, +3.8782858456383816e-10,
-    +1.9986116803851018e-09, +2.9935224804502640e-10, +3.5881372824381242e-10, +1.9217803089896662e-09,
-    +2.4398442784906845e-10, +2.9723432016517662e-10, +1.9000980471493543e-09, +2.1264783017457557e-10,
-    +2.7612533173182781e-10, +2.1707539782469190e-09, +2.3193323314081958e-10, +3.4880300823452323e-10,
-    +2.8224667483851779e-09, +2.3874523102491419e-10, +3.9753602544112563e-10, +4.4851196758427926e-09,
-    +2.4245233333363120e-10, +4.4638601310564238e-10, +5.2978274070714687e-09, +2.3362667727107237e-10,
-    +4.5642841865904550e-10, +6.5735336742179533e-09, +2.5598788748870874e-10, +5.7059658585096460e-10,
-    +7.0241376271315718e-09, +2.2688701311104554e-10, +5.2460801615601547e-10, +7.0172291430774995e-09,
-    +2.5282327555878260e-10, +5.9161724241499369e-10, +2.2442532585042329e-08, +2.6907423522198811e-10,
-    +5.8520504696211733e-10, +1.4255063658766608e-08, +2.6192825112517347e-10, +5.4288926702658041e-10,
-    +1.1072064736679657e-08, +2.4644465260315307e-10, +4.5378996212074878e-10, +6.3081301685940493e-09,
-    +2.4060425751673450e-10, +3.6324882060255194e-10, +1.7039566765198440e-09, +2.7893413790985400e-10,
-    +3.7506172564285047e-10, +1.4935599762405149e-09, +3.2864517043017883e-10, +4.1082039275012026e-10,
-    +1.6425564807541455e-09, +4.1114540512851934e-10, +5.1796799079125343e-10, +3.0555761543826845e-09,
-    +3.6972725705698704e-10, +5.0826898723771874e-10, +4.5149784205928789e-09, +2.5093679529945448e-10,
-    +3.4295789200967566e-10, +2.8799047106344670e-09, +2.0618186037060022e-10, +3.0880648996464746e-10,
-    +2.7404576094493303e-09, +2.0480946484243443e-10, +3.3277801877765260e-10, +2.1774170708335732e-09,
-    +2.3211294523255441e-10, +4.4003686099016754e-10, +5.4258128848417225e-09, +2.3924226914821880e-10,
-    +4.9126650938379404e-10, +7.8865708583431102e-09, +2.6008629875102840e-10, +6.0024445879961008e-10,
-    +1.3317515498691528e-08, +2.2153384218840651e-10, +4.9483718036012535e-10, +8.7891989814970954e-09,
-    +2.7410999410353740e-10, +6.8026011821773587e-10, +1.3459632965769163e-08, +2.8243456029860866e-10,
-    +6.2175804049461336e-10, +1.0015975380572239e-08, +2.6430389619060902e-10, +5.1510973683290718e-10,
-    +4.2785481881395110e-09, +2.5581613975854233e-10, +4.3636510362939980e-10, +3.0404684126177670e-09,
-    +2.3463835418420490e-10, +3.4722082116209668e-10, +1.4552977408128253e-09, +2.4524015823159214e-10,
-    +3.2190378627324836e-10, +1.3634665234288837e-09, +3.0120500698589099e-10, +4.0560527820411119e-10,
-    +1.9974698808058410e-09, +3.8857717687576113e-10, +5.6159888969562858e-10, +5.8442149352407470e-09,
-    +3.5212284161959721e-10, +5.2345093945155768e-10, +5.9785749039597221e-09, +2.5348666400615072e-10,
-    +3.8120225343854383e-10, +2.4156740080392669e-09, +2.0396082869383452e-10, +3.0190830372707475e-10,
-    +2.2098732003264858e-09, +1.8423084175614643e-10, +2.8218135809937719e-10, +2.1810926266830871e-09,
-    +2.0617016201831383e-10, +3.4885963598741465e-10, +4.1993223293199431e-09, +2.2181140084120328e-10,
-    +4.2360776387140927e-10, +4.2534458047053747e-09, +2.4582637631475380e-10, +5.3756064401035257e-10,
-    +1.1965622622617866e-08, +2.0756055378186048e-10, +4.6273120511002506e-10, +6.7927200327251403e-09,
-    +2.7741608876898197e-10, +6.7887601601849329e-10, +8.1149695780745493e-09, +2.9055079583909751e-10,
-    +6.5510946954246329e-10, +1.0483813196858393e-08, +2.5033954171633422e-10, +4.8233719280470590e-10,
-    +4.3449436702167421e-09, +2.2614731129432572e-10, +3.7720470335443105e-10, +2.5097211476188819e-09,
-    +2.3650197882826231e-10, +3.5549308849964155e-10, +1.9817188772006657e-09, +2.6163398617171087e-10,
-    +3.9545713850834559e-10, +2.3432281319740212e-09, +2.8162245538682510e-10, +4.1195226079197260e-10,
-    +2.5344215568408855e-09, +3.1573428921308523e-10, +4.4136765268670101e-10, +3.5508092629861626e-09,
-    +3.1203176114132369e-10, +4.5369187226404888e-10, +3.2613212830294969e-09, +2.7386184468133686e-10,
-    +4.1131398566994259e-10, +3.2025875780319878e-09, +2.4826360333273141e-10, +3.8540598555328655e-10,
-    +3.1571044870028725e-09, +2.0172706362141915e-10, +3.0573362466148544e-10, +2.4100005711460492e-09,
-    +1.8716317865208859e-10, +3.0173556295303774e-10, +2.6535704051177674e-09, +2.0236573349728424e-10,
-    +3.8045085961427795e-10, +4.2468364816045627e-09, +2.3911446286695851e-10, +5.5701171073285523e-10,
-    +1.2631541558005448e-08, +2.1002217630250512e-10, +4.9267948467958485e-10, +8.2651813342351458e-09,
-    +2.3687751334606964e-10, +5.3205775650182793e-10, +7.8321077429227145e-09, +2.4724359055240950e-10,
-    +5.2366731145281435e-10, +8.6575835744030003e-09, +2.2849875390295243e-10, +4.4241759161957831e-10,
-    +7.2319239164576661e-09, +2.2374014542430749e-10, +3.8105991518945275e-10, +2.5957688744111079e-09,
-    +2.5162310737235315e-10, +4.1623533049181350e-10, +2.8993828811406138e-09, +2.9781885029706631e-10,
-    +4.9137934856651142e-10, +2.8949690102397173e-09, +2.7757483656933004e-10, +4.2913765160971777e-10,
-    +3.8849629676200194e-09, +2.4764679569720677e-10, +3.6109488969553364e-10, +5.7364072345710111e-09,
-    +2.5005081964094412e-10, +3.6782751324352902e-10, +4.2595756250402321e-09, +2.6611132277916262e-10,
-    +4.4949320789266004e-10, +4.3501153635369171e-09, +2.7407407915560963e-10, +4.6384538994881711e-10,
-    +3.3650832187940435e-09, +2.4481165152539473e-10, +4.1541907473559364e-10, +2.7891203477287805e-09,
-    +2.1163716805138570e-10, +3.7441435309694580e-10, +2.3568773779699682e-09, +2.0415898761850198e-10,
-    +3.9435059629582108e-10, +6.8832105904307086e-09, +2.2088093106364242e-10, +4.8300486266449695e-10,
-    +1.1439479985949171e-08, +1.8623503480698713e-10, +4.0757297470514846e-10, +6.9019123204387045e-09,
-    +2.1269956255427720e-10, +4.1215494880726506e-10, +6.4021670669696247e-09, +2.4258543318173084e-10,
-    +4.7399572902640947e-10, +8.0808615614191715e-09, +2.3681376321125114e-10, +4.2875442016170361e-10,
-    +7.4952685555097432e-09, +2.2370991147776448e-10, +3.9130867112337175e-10, +5.3338314136225157e-09,
-    +2.5318078290177560e-10, +4.2205869137104710e-10, +6.5312746067811834e-09, +2.5602338203789207e-10,
-    +4.2752342982196872e-10, +3.5985981027737411e-09, +2.4948089319282321e-10, +4.0533046347259724e-10,
-    +6.1447314940058715e-09, +2.2319078785933289e-10, +3.5938732455375194e-10, +9.0893241606662304e-09,
-    +2.0385957087714111e-10, +3.1250219718341246e-10, +6.6143755740740531e-09, +2.1463802293031517e-10,
-    +3.3310748190813227e-10, +5.9160951812393539e-09, +2.3306960367966397e-10, +3.7117268473580155e-10,
-    +3.0317919065593538e-09, +2.1924592608363151e-10, +3.4464241447244986e-10, +1.9486506735020798e-09,
-    +2.0537850144562156e-10, +3.4450403858656677e-10, +2.2548006289387507e-09, +2.1308313118887869e-10,
-    +3.8628223689002055e-10, +6.1543532346797210e-09, +2.2386647065637959e-10, +4.6883288943508721e-10,
-    +1.0657172291339271e-08, +1.9682311971186566e-10, +4.3087569930603257e-10, +9.1058434191400035e-09,
-    +2.2041936419108086e-10, +4.2077331410332993e-10, +7.2578025387226955e-09, +2.6572218296010194e-10,
-    +5.4816119871312045e-10, +1.3796482920554470e-08, +2.6789221274630727e-10, +4.8571167373730702e-10,
-    +1.2072759964883269e-08, +2.4903307485990447e-10, +4.1383354309086097e-10, +9.0965794850791460e-09,
-    +2.3823820989337325e-10, +3.7880488038313160e-10, +8.2994376691109742e-09, +2.3422743099088405e-10,
-    +3.7694642823527809e-10, +6.2065394445659720e-09, +2.2550223181126093e-10, +3.5619436104496819e-10,
-    +4.4908236552752835e-09, +2.2101491005459974e-10, +3.4991915350654704e-10, +4.0058860727363227e-09,
-    +1.9172755970231324e-10, +2.8275800224720384e-10, +2.9484199492676495e-09, +1.7359484650965109e-10,
-    +2.4335502548682416e-10, +2.3949077880392112e-09, +1.8880911849015687e-10, +2.6218970948750966e-10,
-    +2.0954702489943060e-09, +1.9633969903163403e-10, +2.8284835378175189e-10, +2.2203809786969138e-09,
-    +2.1098578281564599e-10, +3.4199169893740430e-10, +3.8940912931775526e-09, +2.2948922543393446e-10,
-    +4.4337823388793856e-10, +1.4018941636916825e-08, +2.4001984516722712e-10, +5.9255365049339226e-10,
-    +3.0679880573042262e-08, +2.0339366805746716e-10, +4.8449492664311422e-10, +1.5203154970882201e-08,
-    +2.4022451031044513e-10, +5.3906998065306198e-10, +9.9306068064518583e-09, +2.8582530344705552e-10,
-    +7.8524236172944062e-10, +2.0531945335502343e-08, +2.9143433476569522e-10, +7.3010400102971974e-10,
-    +2.1973752308919360e-08, +2.9103731996263197e-10, +5.9937432716522890e-10, +1.7471399014064588e-08,
-    +2.6492604314909538e-10, +4.6699337283305935e-10, +1.0031956697741133e-08, +2.2802344778156257e-10,
-    +3.8180943754208160e-10, +8.0159651733887768e-09, +2.1337561010869590e-10, +3.3548202851775718e-10,
-    +7.0387955393265854e-09, +2.2511614170033762e-10, +3.4689137445338959e-10, +5.1031567152738162e-09,
-    +2.1257974884902324e-10, +3.2009723365757432e-10, +3.5553005725587730e-09, +1.8184767417154789e-10,
-    +2.7108385071305853e-10, +2.9907899729375721e-09, +1.8933449334740227e-10, +2.8564581796236855e-10,
-    +3.1774362271788402e-09, +2.0945798960075475e-10, +3.1774855766772204e-10, +2.7380982392464516e-09,
-    +2.2813687236189307e-10, +4.0223032354226934e-10, +9.1239451544693423e-09, +2.3438738420536325e-10,
-    +5.2317295707517405e-10, +2.0328450432763108e-08, +2.4269839270472185e-10, +6.4554032202976702e-10,
-    +2.0845788257530073e-08, +2.0159118214172113e-10, +4.8989040098954652e-10, +1.1868504893936508e-08,
-    +2.1702654872380270e-10, +4.6979321893148723e-10, +6.6222753037320906e-09, +2.4664708744760537e-10,
-    +6.2865711018882799e-10, +8.5775239314847568e-09, +2.5258018546266519e-10, +6.5302487643217275e-10,
-    +9.4086343093508543e-09, +2.5987858595646707e-10, +6.2719326702307993e-10, +9.9379029142612736e-09,
-    +2.4454289083136792e-10, +5.0966170250918921e-10, +8.2820816724066450e-09, +2.1050089610010265e-10,
-    +3.7323100897680107e-10, +6.2511747910924678e-09, +1.9515889809282323e-10, +3.0767485911970583e-10,
-    +3.9230144351906003e-09, +2.0250456713056069e-10, +3.1578227541062152e-10, +3.3407700991561586e-09,
-    +1.9631398733266630e-10, +3.1626965448161103e-10, +3.1533529691991997e-09, +1.8734963022431707e-10,
-    +3.2241049759733266e-10, +4.1524062482071028e-09, +1.9419205164860013e-10, +3.4936805525327906e-10,
-    +4.2251140602285091e-09, +1.9964939725075325e-10, +3.7980456511194094e-10, +5.8954901392887108e-09,
-    +2.0573903055177724e-10, +4.1493553469624416e-10, +7.5769836120679401e-09, +2.0356241841387331e-10,
-    +4.7285449426333843e-10, +1.0300851722834421e-08, +2.1171916290347726e-10, +5.6666552073676891e-10,
-    +9.3556851004007327e-09, +1.9081875553907309e-10, +4.4470448964416383e-10, +5.5017124052352951e-09,
-    +2.1112192581064782e-10, +4.5161350352212697e-10, +9.2255977013352996e-09, +2.2321607338604949e-10,
-    +5.6615807296111037e-10, +1.2698639903284054e-08, +2.3805174825131341e-10, +6.5772637143974552e-10,
-    +1.6021047555099058e-08, +2.5938329705320883e-10, +6.9575896456498967e-10, +1.7433003789708370e-08,
-    +2.6700647256077280e-10, +6.3051581898269482e-10, +1.3111894243761776e-08, +2.5191157804558932e-10,
-    +4.8320324141857557e-10, +5.6848117196896097e-09, +2.5804443254749425e-10, +4.3776319918634357e-10,
-    +4.4580124350104541e-09, +3.1228983860008886e-10, +5.8174891316548381e-10, +5.3374985463989273e-09,
-    +3.1639700345700480e-10, +6.5196524547220648e-10, +7.9383147851565160e-09, +2.7771123037563576e-10,
-    +5.8747361004655765e-10, +8.6331197847700866e-09, +2.7872389745369928e-10, +6.2177271166795593e-10,
-    +1.1118674156813414e-08, +2.8044107124427421e-10, +6.7083830102791140e-10, +1.5715212440363479e-08,
-    +2.6052526560595781e-10, +5.7609930775901049e-10, +1.7375539143432028e-08, +2.3737756878316866e-10,
-    +5.6792567369974734e-10, +2.6701135340285159e-08, +2.1798460247057487e-10, +5.4342691559092094e-10,
-    +2.3403566109024509e-08, +2.0108178093132938e-10, +4.7346864899713709e-10, +1.2907899132151655e-08,
-};
@@ -1,41 +0,0 @@
-#ifndef CAPTURE_RECOGNITION_CLASSIFIER_FEATURES_H_
-#define CAPTURE_RECOGNITION_CLASSIFIER_FEATURES_H_
-
-#include <cstddef>
-#include <cstdint>
-
-extern const std::size_t BLUE_MEAN_SIZE;
-extern const std::size_t BLUE_COV_SIZE;
-extern const std::size_t EMPTY_MEAN_SIZE;
-extern const std::size_t EMPTY_COV_SIZE;
-extern const std::size_t GREEN_MEAN_SIZE;
-extern const std::size_t GREEN_COV_SIZE;
-extern const std::size_t OJAMA_MEAN_SIZE;
-extern const std::size_t OJAMA_COV_SIZE;
-extern const std::size_t PURPLE_MEAN_SIZE;
-extern const std::size_t PURPLE_COV_SIZE;
-extern const std::size_t RED_MEAN_SIZE;
-extern const std::size_t RED_COV_SIZE;
-extern const std::size_t YELLOW_MEAN_SIZE;
-extern const std::size_t YELLOW_COV_SIZE;
-extern const std::size_t ZENKESHI_MEAN_SIZE;
-extern const std::size_t ZENKESHI_COV_SIZE;
-
-extern const double BLUE_MEAN[];
-extern const double BLUE_COV[];
-extern const double EMPTY_MEAN[];
-extern const double EMPTY_COV[];
-extern const double GREEN_MEAN[];
-extern const double GREEN_COV[];
-extern const double OJAMA_MEAN[];
-extern const double OJAMA_COV[];
-extern const double PURPLE_MEAN[];
-extern const double PURPLE_COV[];
-extern const double RED_MEAN[];
-extern const double RED_COV[];
-extern const double YELLOW_MEAN[];
-extern const double YELLOW_COV[];
-extern const double ZENKESHI_MEAN[];
-extern const double ZENKESHI_COV[];
-
-#endif // CAPTURE_RECOGNITION_CLASSIFIER_FEATURES_H_
@@ -1,18 +1,25 @@
 #ifndef CAPTURE_RECOGNITION_RECOGNIZER_H_
 #define CAPTURE_RECOGNITION_RECOGNIZER_H_
 
+#include <string>
+
 #include "capture/recognition/recognition_color.h"
+#include "capture/recognition/recognizer_model.h"
 #include "core/real_color.h"
-#include "learning/arow.h"
 
+// Recognizer classifies a 16x16 box with the linear classifiers learned by tool/arow.
 class Recognizer {
 public:
-    Recognizer();
+    static const int NUM_FEATURES = 16 * 16 * 3;
+
+    // Loads the model made by tool/arow. Dies if it's not available.
+    explicit Recognizer(const std::string& modelPath = RecognizerModel::defaultPath());
 
-    RealColor recognize(const double features[16 * 16 * 3]) const;
+    // |features| are the RGB values of the pixels in row-major order.
+    RealColor recognize(const float features[NUM_FEATURES]) const;
 
 private:
-    Arow arows[NUM_RECOGNITION];
+    RecognizerModel model_;
 };
 
 #endif // CAPTURE_RECOGNITION_RECOGNIZER_H_
@@ -0,0 +1,125 @@
+#include "capture/recognition/recognizer_model.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+
+#include "base/file/file.h"
+#include "base/file/path.h"
+
+DECLARE_string(data_dir);
+
+using namespace std;
+
+namespace {
+
+const char MODEL_MAGIC[] = "PUYORCGN";
+const uint32_t MODEL_VERSION = 1;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t numClasses;
+    uint32_t numFeatures;
+    uint32_t padding[3];
+};
+
+// The weights are aligned to this, since a mapping is aligned to a page.
+const size_t ALIGNMENT = 32;
+
+static_assert(sizeof(Header) % ALIGNMENT == 0, "weights should be aligned");
+
+}
+
+// static
+string RecognizerModel::defaultPath()
+{
+    return file::joinPath(FLAGS_data_dir, "recognition", "recognizer.model");
+}
+
+// static
+bool RecognizerModel::save(const string& filename, const vector<vector<double>>& weights)
+{
+    CHECK(!weights.empty());
+
+    const size_t numClasses = weights.size();
+    const size_t numFeatures = weights.front().size();
+
+    Header header {};
+    memcpy(header.magic, MODEL_MAGIC, sizeof(header.magic));
+    header.version = MODEL_VERSION;
+    header.numClasses = numClasses;
+    header.numFeatures = numFeatures;
+
+    vector<float> values(numClasses * numFeatures);
+    for (size_t c = 0; c < numClasses; ++c) {
+        CHECK_EQ(numFeatures, weights[c].size());
+        for (size_t f = 0; f < numFeatures; ++f)
+            values[f * numClasses + c] = static_cast<float>(weights[c][f]);
+    }
+
+    ofstream ofs(filename, ios::out | ios::binary);
+    if (!ofs)
+        return false;
+    if (!ofs.write(reinterpret_cast<const char*>(&header), sizeof(header)))
+        return false;
+    if (!ofs.write(reinterpret_cast<const char*>(values.data()), sizeof(float) * values.size()))
+        return false;
+    return true;
+}
+
+bool RecognizerModel::load(const string& filename)
+{
+    clear();
+
+    const char* data;
+    size_t size;
+    if (file_.open(filename)) {
+        data = file_.data();
+        size = file_.size();
+    } else {
+        // MappedFile is not supported on some platforms (e.g. MSVC). The buffer is aligned
+        // like a mapping, so that the weights after the header are aligned to 32 bytes.
+        string content;
+        if (!file::readFile(filename, &content))
+            return false;
+        buffer_.reset(new char[content.size() + ALIGNMENT]);
+        char* aligned = buffer_.get() + (ALIGNMENT - reinterpret_cast<uintptr_t>(buffer_.get()) % ALIGNMENT) % ALIGNMENT;
+        memcpy(aligned, content.data(), content.size());
+        data = aligned;
+        size = content.size();
+    }
+
+    Header header;
+    if (size < sizeof(header)) {
+        LOG(WARNING) << filename << " is too small: " << size;
+        clear();
+        return false;
+    }
+
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, MODEL_MAGIC, sizeof(header.magic)) != 0 || header.version != MODEL_VERSION ||
+        size != sizeof(header) + sizeof(float) * header.numClasses * header.numFeatures) {
+        LOG(WARNING) << filename << " is not a valid model: version=" << header.version
+                     << " numClasses=" << header.numClasses << " numFeatures=" << header.numFeatures;
+        clear();
+        return false;
+    }
+
+    numClasses_ = header.numClasses;
+    numFeatures_ = header.numFeatures;
+    weights_ = reinterpret_cast<const float*>(data + sizeof(header));
+    return true;
+}
+
+void RecognizerModel::clear()
+{
+    file_.close();
+    buffer_.reset();
+    numClasses_ = 0;
+    numFeatures_ = 0;
+    weights_ = nullptr;
+}
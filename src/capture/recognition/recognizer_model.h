@@ -0,0 +1,50 @@
+#ifndef CAPTURE_RECOGNITION_RECOGNIZER_MODEL_H_
+#define CAPTURE_RECOGNITION_RECOGNIZER_MODEL_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/file/mapped_file.h"
+#include "base/noncopyable.h"
+
+// RecognizerModel is the read-only weights of the linear classifiers Recognizer uses.
+// The file is mapped, and the weights are used in place. On platforms not supporting
+// mmap, the file is read into an aligned buffer instead.
+//
+// The file is a 32 bytes header (8 bytes magic, uint32 version, uint32 the number of
+// classes, uint32 the number of features, padding) followed by float weights in the
+// native byte order. The weights are transposed, i.e. the weights of all the classes
+// for a feature are contiguous, so that the scores of the classes can be calculated
+// with SIMD at once.
+class RecognizerModel : noncopyable {
+public:
+    // Returns <--data_dir>/recognition/recognizer.model.
+    static std::string defaultPath();
+
+    // Writes the model whose |weights[c]| is the weight vector of the class c.
+    // Returns false if failed.
+    static bool save(const std::string& filename, const std::vector<std::vector<double>>& weights);
+
+    // Maps or reads |filename|. Returns false if the file doesn't exist or is broken.
+    bool load(const std::string& filename);
+
+    size_t numClasses() const { return numClasses_; }
+    size_t numFeatures() const { return numFeatures_; }
+    // The weight of the feature f for the class c is weights()[f * numClasses() + c].
+    // This is aligned to 32 bytes.
+    const float* weights() const { return weights_; }
+
+private:
+    void clear();
+
+    file::MappedFile file_;
+    // The content of the file when it cannot be mapped.
+    std::unique_ptr<char[]> buffer_;
+    size_t numClasses_ = 0;
+    size_t numFeatures_ = 0;
+    const float* weights_ = nullptr;
+};
+
+#endif // CAPTURE_RECOGNITION_RECOGNIZER_MODEL_H_
@@ -0,0 +1,98 @@
+#include "capture/recognition/recognizer_model.h"
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "base/file/file.h"
+
+using namespace std;
+
+namespace {
+
+string tempFilename()
+{
+    char buf[] = "/tmp/recognizer_model_test_XXXXXX";
+    int fd = mkstemp(buf);
+    CHECK_GE(fd, 0);
+    close(fd);
+    return buf;
+}
+
+// 3 classes x 2 features.
+const vector<vector<double>> WEIGHTS {
+    { 1.0, 2.0 },
+    { -3.0, 4.5 },
+    { 0.25, -6.0 },
+};
+
+}
+
+TEST(RecognizerModelTest, saveAndLoad)
+{
+    string filename = tempFilename();
+    ASSERT_TRUE(RecognizerModel::save(filename, WEIGHTS));
+
+    RecognizerModel model;
+    ASSERT_TRUE(model.load(filename));
+    EXPECT_EQ(3U, model.numClasses());
+    EXPECT_EQ(2U, model.numFeatures());
+
+    // The weights are transposed.
+    for (size_t c = 0; c < 3; ++c) {
+        for (size_t f = 0; f < 2; ++f)
+            EXPECT_EQ(static_cast<float>(WEIGHTS[c][f]), model.weights()[f * model.numClasses() + c]) << c << ' ' << f;
+    }
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(model.weights()) % 32);
+
+    unlink(filename.c_str());
+}
+
+TEST(RecognizerModelTest, loadNonexistentFile)
+{
+    RecognizerModel model;
+    EXPECT_FALSE(model.load("/nonexistent/recognizer.model"));
+    EXPECT_TRUE(model.weights() == nullptr);
+}
+
+TEST(RecognizerModelTest, loadBrokenFile)
+{
+    string filename = tempFilename();
+    ASSERT_TRUE(RecognizerModel::save(filename, WEIGHTS));
+    string content;
+    ASSERT_TRUE(file::readFile(filename, &content));
+
+    // The header is 8 bytes magic followed by uint32 version.
+    string badMagic(content);
+    badMagic[0] = 'X';
+    string badVersion(content);
+    const uint32_t version = 2;
+    memcpy(&badVersion[8], &version, sizeof(version));
+    string tooLong(content + string(4, '\0'));
+    string tooShort(content.substr(0, content.size() - 4));
+    string noWeights(content.substr(0, 16));
+
+    for (const string& broken : { badMagic, badVersion, tooLong, tooShort, noWeights }) {
+        ASSERT_TRUE(file::writeFile(filename, broken));
+        RecognizerModel model;
+        EXPECT_FALSE(model.load(filename));
+        EXPECT_TRUE(model.weights() == nullptr);
+        EXPECT_EQ(0U, model.numClasses());
+    }
+
+    // A failed load doesn't keep the previous model.
+    ASSERT_TRUE(file::writeFile(filename, content));
+    RecognizerModel model;
+    ASSERT_TRUE(model.load(filename));
+    ASSERT_TRUE(file::writeFile(filename, badMagic));
+    EXPECT_FALSE(model.load(filename));
+    EXPECT_TRUE(model.weights() == nullptr);
+
+    unlink(filename.c_str());
+}
@@ -7,6 +7,8 @@
 
 #include <SDL_image.h>
 
+#include "capture/yuv_surface.h"
+
 DEFINE_string(save_img_dir, "/tmp", "");
 
 using namespace std;
@@ -47,7 +49,9 @@ UniqueSDLSurface Source::nextFrame()
     UniqueSDLSurface surface = getNextFrame();
 
     if (savesScreenShot_ && surface.get()) {
-        saveScreenShot(surface.get());
+        UniqueSDLSurface buffer(emptyUniqueSDLSurface());
+        if (SDL_Surface* drawable = toDrawableSurface(surface.get(), &buffer))
+            saveScreenShot(drawable);
     }
 
     return surface;
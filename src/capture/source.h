@@ -1,6 +1,8 @@
 #ifndef CAPTURE_SOURCE_H_
 #define CAPTURE_SOURCE_H_
 
+#include <atomic>
+
 #include <SDL.h>
 #include "gui/unique_sdl_surface.h"
 
@@ -32,7 +34,8 @@ protected:
     virtual UniqueSDLSurface getNextFrame() = 0;
 
     bool ok_;
-    bool done_;
+    // Can be set from another thread with end().
+    std::atomic<bool> done_;
     bool savesScreenShot_ = false;
     int width_;
     int height_;
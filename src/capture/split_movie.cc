@@ -2,6 +2,7 @@
 #include <stdlib.h>
 
 #include <iostream>
+#include <mutex>
 #include <sstream>
 
 #include <gflags/gflags.h>
@@ -12,6 +13,7 @@
 #include "capture/ac_analyzer.h"
 #include "capture/capture.h"
 #include "capture/color.h"
+#include "capture/movie_segment_decoder.h"
 #include "capture/movie_source.h"
 #include "gui/bounding_box.h"
 #include "gui/main_window.h"
@@ -20,6 +22,10 @@
 
 using namespace std;
 
+DEFINE_int32(decoder_threads, 1, "the number of threads FFmpeg uses to decode each segment");
+
+DECLARE_int32(num_threads);
+
 int main(int argc, char* argv[])
 {
     google::ParseCommandLineFlags(&argc, &argv, true);
@@ -35,37 +41,30 @@ int main(int argc, char* argv[])
 
     MovieSource::init();
 
-    MovieSource source(argv[1]);
-    if (!source.ok()) {
-        fprintf(stderr, "Failed to load %s\n", argv[1]);
-        exit(EXIT_FAILURE);
-    }
-    source.setFPS(0);
-
     // TODO(mayah): Since bounding box is initialized in ACAnalyzer, we need to use this here.
     // This must be wrong.
     ACAnalyzer analyzer;
 
-    int num = 0;
+    const int WIDTH = 16;
+    const int HEIGHT = 16;
+    const int NUM_BOXES_PER_FRAME = 2 * 12 * 6;
 
-    while (true) {
-        source.nextStep();
-        UniqueSDLSurface surf = source.getNextFrame();
-        if (!surf.get())
-            break;
-
-        const int WIDTH = 16;
-        const int HEIGHT = 16;
+    mutex mu;
+    MovieSegmentDecoder decoder(argv[1], FLAGS_num_threads, FLAGS_decoder_threads);
+    bool ok = decoder.run([&](int frameIndex, SDL_Surface* surf) {
+        // File names are determined by the frame index, so they don't depend on the number of threads.
+        int num = frameIndex * NUM_BOXES_PER_FRAME;
+        ostringstream oss;
 
         for (int pi = 0; pi < 2; ++pi) {
             for (int y = 12; y >= 1; --y) {
                 for (int x = 1; x <= 6; ++x) {
                     Box b = BoundingBox::boxForAnalysis(pi, x, y);
-                    RealColor rc = analyzer.analyzeBox(surf.get(), b);
+                    RealColor rc = analyzer.analyzeBox(surf, b);
 
                     const SDL_Rect rect = b.toSDLRect();
                     UniqueSDLSurface dest(makeUniqueSDLSurface(SDL_CreateRGBSurface(0, WIDTH, HEIGHT, 32, 0, 0, 0, 0)));
-                    SDL_BlitSurface(surf.get(), &rect, dest.get(), nullptr);
+                    SDL_BlitSurface(surf, &rect, dest.get(), nullptr);
 
                     char prefix;
                     switch (rc) {
@@ -84,11 +83,19 @@ int main(int argc, char* argv[])
                     sprintf(filename, "%c%06d.bmp", prefix, ++num);
                     SDL_SaveBMP(dest.get(), filename);
 
-                    cout << toChar(rc);
+                    oss << toChar(rc);
                 }
-                cout << endl;
+                oss << endl;
             }
         }
+
+        lock_guard<mutex> lock(mu);
+        cout << oss.str();
+    });
+
+    if (!ok) {
+        fprintf(stderr, "Failed to load %s\n", argv[1]);
+        exit(EXIT_FAILURE);
     }
 
     return 0;
@@ -10,13 +10,24 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <mutex>
+#include <vector>
+
 #include <libv4l2.h>
 #include <linux/videodev2.h>
 
+#include "capture/yuv_surface.h"
+
 using namespace std;
 
 namespace {
 
+// The number of buffers the device needs to keep capturing.
+const size_t MIN_BUFFERS = 5;
+// In zero-copy mode, the capture pipeline holds at most this number of frames
+// (the queues, the previous frames referred by the analyzer, and the drawn frame).
+const size_t MAX_FRAMES_HELD_BY_PIPELINE = 8;
+
 void showPixFormat(const struct v4l2_pix_format& pix_fmt)
 {
     char fmt_buf[5];
@@ -107,8 +118,26 @@ void showCurrentAudio(int fd)
 
 }  // anonymous namespace
 
-VidDevSource::VidDevSource(const string& dev) :
-    dev_(dev)
+struct VidDevSource::MappedBuffers {
+    ~MappedBuffers()
+    {
+        for (Buffer& buf : buffers) {
+            if (buf.surface)
+                SDL_FreeSurface(buf.surface);
+            v4l2_munmap(buf.start, buf.length);
+        }
+    }
+
+    // Guards |fd| so that the device isn't closed while a buffer is being queued back.
+    mutex mu;
+    // -1 after the device has been closed.
+    int fd = -1;
+    vector<Buffer> buffers;
+};
+
+VidDevSource::VidDevSource(const string& dev, bool zeroCopy) :
+    dev_(dev),
+    zeroCopy_(zeroCopy)
 {
     init();
 }
@@ -136,16 +165,44 @@ void VidDevSource::init()
     }
     showPixFormat(pix_fmt);
 
+    // In zero-copy mode, we use the native format of the capture device, so that
+    // libv4l2 doesn't convert (and copy) the frames.
     //format.fmt.pix.pixelformat = V4L2_PIX_FMT_RGB24;
-    format.fmt.pix.pixelformat = V4L2_PIX_FMT_RGB565;
+    format.fmt.pix.pixelformat = zeroCopy_ ? V4L2_PIX_FMT_YUYV : V4L2_PIX_FMT_RGB565;
     if (v4l2_ioctl(fd_, VIDIOC_S_FMT, &format) < 0) {
         perror("v4l2_ioctl VIDIOC_S_FMT");
         exit(EXIT_FAILURE);
     }
     showPixFormat(pix_fmt);
 
+    if (zeroCopy_ && pix_fmt.pixelformat != V4L2_PIX_FMT_YUYV &&
+        pix_fmt.pixelformat != V4L2_PIX_FMT_UYVY && pix_fmt.pixelformat != V4L2_PIX_FMT_NV12) {
+        fprintf(stderr, "Zero-copy mode needs YUYV, UYVY or NV12: %u\n", pix_fmt.pixelformat);
+        exit(EXIT_FAILURE);
+    }
+
+    switch (pix_fmt.pixelformat) {
+    case V4L2_PIX_FMT_YUYV:
+        sdlPixelFormat_ = SDL_PIXELFORMAT_YUY2;
+        break;
+    case V4L2_PIX_FMT_UYVY:
+        sdlPixelFormat_ = SDL_PIXELFORMAT_UYVY;
+        break;
+    case V4L2_PIX_FMT_NV12:
+        // The UV plane follows the Y plane with the same bytes per line, as YUV surfaces expect.
+        sdlPixelFormat_ = SDL_PIXELFORMAT_NV12;
+        break;
+    case V4L2_PIX_FMT_RGB565:
+        sdlPixelFormat_ = SDL_PIXELFORMAT_RGB565;
+        break;
+    default:
+        fprintf(stderr, "Unsupported pixel format: %u\n", pix_fmt.pixelformat);
+        exit(EXIT_FAILURE);
+    }
+
     width_ = pix_fmt.width;
     height_ = pix_fmt.height;
+    bytesPerLine_ = pix_fmt.bytesperline;
 
     showCurrentInput(fd_);
 
@@ -170,11 +227,14 @@ void VidDevSource::quit()
         perror("v4l2_ioctl VIDIOC_STREAMOFF");
         exit(EXIT_FAILURE);
     }
-    v4l2_close(fd_);
-    for (size_t i = 0; i < buf_cnt_; i++) {
-        munmap(buffers_[i].start, buffers_[i].length);
+    {
+        lock_guard<mutex> lock(buffers_->mu);
+        v4l2_close(fd_);
+        buffers_->fd = -1;
     }
-    free(buffers_);
+
+    // The buffers are unmapped when the last frame referring them is freed.
+    buffers_.reset();
 }
 
 void VidDevSource::initBuffers()
@@ -196,14 +256,16 @@ void VidDevSource::initBuffers()
     fprintf(stderr, "Buffer count=%u type=%u memory=%u\n",
             reqbuf.count, reqbuf.type, reqbuf.memory);
 
-    if (reqbuf.count < 5) {
+    // In zero-copy mode, the frames held by the pipeline are not queued to the device.
+    size_t minBuffers = zeroCopy_ ? MIN_BUFFERS + MAX_FRAMES_HELD_BY_PIPELINE : MIN_BUFFERS;
+    if (reqbuf.count < minBuffers) {
         fprintf(stderr, "Not enough buffer memory: %u\n", reqbuf.count);
         exit(EXIT_FAILURE);
     }
 
-    buf_cnt_ = reqbuf.count;
-    buffers_ = (Buffer*)calloc(reqbuf.count, sizeof(*buffers_));
-    assert(buffers_ != NULL);
+    buffers_.reset(new MappedBuffers);
+    buffers_->fd = fd_;
+    buffers_->buffers.resize(reqbuf.count, Buffer { nullptr, 0, nullptr });
 
     fprintf(stderr, "mmap:");
     for (size_t i = 0; i < reqbuf.count; i++) {
@@ -217,26 +279,32 @@ void VidDevSource::initBuffers()
             exit(EXIT_FAILURE);
         }
 
-        buffers_[i].length = buffer.length; /* remember for munmap() */
-        buffers_[i].start = (char*)mmap(NULL, buffer.length,
-                                        PROT_READ | PROT_WRITE, /* recommended */
-                                        MAP_SHARED,             /* recommended */
-                                        fd_, buffer.m.offset);
-        // This document says rmask and bmask should be swapped, but hmm?
-        // http://linuxtv.org/downloads/v4l-dvb-apis/packed-rgb.html
-        buffers_[i].surface = SDL_CreateRGBSurfaceFrom(buffers_[i].start,
-                                                       width_, height_, 16,
-                                                       width_ * 2,
-                                                       31 << 11, 63 << 5, 31, 0);
-        assert(buffers_[i].surface);
-
-        fprintf(stderr, " %lu:%p+%lu", i, buffers_[i].start, buffers_[i].length);
-        if (MAP_FAILED == buffers_[i].start) {
+        Buffer& buf = buffers_->buffers[i];
+        buf.length = buffer.length; /* remember for munmap() */
+        // Use v4l2_mmap instead of mmap, since libv4l2 might convert the format.
+        buf.start = (char*)v4l2_mmap(NULL, buffer.length,
+                                     PROT_READ | PROT_WRITE, /* recommended */
+                                     MAP_SHARED,             /* recommended */
+                                     fd_, buffer.m.offset);
+        fprintf(stderr, " %lu:%p+%lu", i, buf.start, buf.length);
+        if (MAP_FAILED == buf.start) {
             /* If you do not exit here you should unmap() and free()
                the buffers mapped so far. */
             perror("mmap");
             exit(EXIT_FAILURE);
         }
+
+        // In zero-copy mode, the frames are wrapped as YUV surfaces.
+        if (zeroCopy_)
+            continue;
+
+        // This document says rmask and bmask should be swapped, but hmm?
+        // http://linuxtv.org/downloads/v4l-dvb-apis/packed-rgb.html
+        buf.surface = SDL_CreateRGBSurfaceFrom(buf.start,
+                                               width_, height_, 16,
+                                               bytesPerLine_,
+                                               31 << 11, 63 << 5, 31, 0);
+        assert(buf.surface);
     }
     fprintf(stderr, "\n");
 
@@ -296,16 +364,44 @@ UniqueSDLSurface VidDevSource::getNextFrame()
         exit(EXIT_FAILURE);
     }
 
-    const Buffer& buf = buffers_[buffer.index];
 #if 0
     static int cnt = 0;
     fprintf(stderr, "%d %d\n", cnt++, buffer.index);
 #endif
 
+    // The buffer is queued back when the frame is freed.
+    if (zeroCopy_)
+        return wrapBuffer(buffer.index);
+
+    // Copy the frame before the buffer is queued back to the device.
+    const Buffer& buf = buffers_->buffers[buffer.index];
+    UniqueSDLSurface surface(makeUniqueSDLSurface(SDL_ConvertSurface(buf.surface, buf.surface->format, 0)));
+
     if (v4l2_ioctl(fd_, VIDIOC_QBUF, &buffer) < 0) {
         perror("VIDIOC_QBUF");
         exit(EXIT_FAILURE);
     }
 
-    return makeUniqueSDLSurface(buf.surface);
+    return surface;
+}
+
+UniqueSDLSurface VidDevSource::wrapBuffer(int index)
+{
+    shared_ptr<MappedBuffers> buffers(buffers_);
+    auto release = [buffers, index]() {
+        lock_guard<mutex> lock(buffers->mu);
+        // The device has been closed, so the buffer is no longer queued.
+        if (buffers->fd < 0)
+            return;
+
+        struct v4l2_buffer buffer;
+        memset(&buffer, 0, sizeof(buffer));
+        buffer.type = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        buffer.memory = V4L2_MEMORY_MMAP;
+        buffer.index = index;
+        if (v4l2_ioctl(buffers->fd, VIDIOC_QBUF, &buffer) < 0)
+            perror("VIDIOC_QBUF");
+    };
+
+    return makeYUVSurface(buffers_->buffers[index].start, width_, height_, bytesPerLine_, sdlPixelFormat_, release);
 }
@@ -5,6 +5,7 @@
 # error "USE_V4L2 must be defined to include viddev_source.h"
 #endif
 
+#include <memory>
 #include <string>
 
 #include <SDL.h>
@@ -13,7 +14,13 @@
 
 class VidDevSource : public Source {
 public:
-    explicit VidDevSource(const std::string& dev);
+    // In |zeroCopy| mode, the device is asked for its native YUYV format (NV12 and UYVY are
+    // also accepted), so that libv4l2 doesn't convert the frames. Each frame is passed to the
+    // analyzer as a YUV surface wrapping the mmap'd buffer in place, and the buffer is queued
+    // back to the device when the surface is freed, i.e. after the frame has been analyzed
+    // and drawn.
+    // Otherwise, libv4l2 converts a frame to RGB565, and the frame is copied from the buffer.
+    explicit VidDevSource(const std::string& dev, bool zeroCopy = false);
     virtual ~VidDevSource();
 
     virtual UniqueSDLSurface getNextFrame() override;
@@ -25,15 +32,25 @@ private:
         SDL_Surface* surface;
     };
 
+    // The buffers mapped from the opened device. In zero-copy mode, the frames being
+    // analyzed share this, so that the buffers stay mapped until the last frame is freed,
+    // even if the device has been reopened meanwhile.
+    struct MappedBuffers;
+
     void init();
     void initBuffers();
 
     void quit();
 
+    // Wraps the frame in the buffer |index| without copying it.
+    UniqueSDLSurface wrapBuffer(int index);
+
     const std::string dev_;
+    const bool zeroCopy_;
     int fd_;
-    Buffer* buffers_;
-    size_t buf_cnt_;
+    std::shared_ptr<MappedBuffers> buffers_;
+    Uint32 sdlPixelFormat_;
+    int bytesPerLine_;
 };
 
 #endif  // CAPTURE_VIDDEV_H_
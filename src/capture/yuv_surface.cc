@@ -0,0 +1,65 @@
+#include "capture/yuv_surface.h"
+
+#include <glog/logging.h>
+
+using namespace std;
+
+namespace {
+
+void freeYUVSurface(SDL_Surface* surface)
+{
+    if (!surface)
+        return;
+
+    YUVSurfaceInfo* info = static_cast<YUVSurfaceInfo*>(surface->userdata);
+    SDL_FreeSurface(surface);
+    if (info->release)
+        info->release();
+    delete info;
+}
+
+}
+
+UniqueSDLSurface makeYUVSurface(void* pixels, int width, int height, int pitch, Uint32 format,
+                                function<void ()> release)
+{
+    CHECK(format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_NV12)
+        << "Unsupported YUV format: " << SDL_GetPixelFormatName(format);
+
+    // The placeholder format only tells SDL the size of the Y plane.
+    int depth = format == SDL_PIXELFORMAT_NV12 ? 8 : 16;
+    SDL_Surface* surface = SDL_CreateRGBSurfaceFrom(pixels, width, height, depth, pitch, 0, 0, 0, 0);
+    if (!surface) {
+        LOG(ERROR) << "Couldn't create a surface: " << SDL_GetError();
+        if (release)
+            release();
+        return emptyUniqueSDLSurface();
+    }
+
+    surface->userdata = new YUVSurfaceInfo { format, std::move(release) };
+    return UniqueSDLSurface(surface, freeYUVSurface);
+}
+
+SDL_Surface* toDrawableSurface(SDL_Surface* surface, UniqueSDLSurface* buffer)
+{
+    const YUVSurfaceInfo* info = yuvSurfaceInfo(surface);
+    if (!info)
+        return surface;
+
+    if (!buffer->get() || (*buffer)->w != surface->w || (*buffer)->h != surface->h) {
+        *buffer = makeUniqueSDLSurface(
+            SDL_CreateRGBSurfaceWithFormat(0, surface->w, surface->h, 32, SDL_PIXELFORMAT_ARGB8888));
+        if (!buffer->get()) {
+            LOG(ERROR) << "Couldn't create a surface: " << SDL_GetError();
+            return nullptr;
+        }
+    }
+
+    if (SDL_ConvertPixels(surface->w, surface->h, info->format, surface->pixels, surface->pitch,
+                          (*buffer)->format->format, (*buffer)->pixels, (*buffer)->pitch) < 0) {
+        LOG(ERROR) << "Couldn't convert the frame: " << SDL_GetError();
+        return nullptr;
+    }
+
+    return buffer->get();
+}
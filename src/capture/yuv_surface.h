@@ -0,0 +1,70 @@
+#ifndef CAPTURE_YUV_SURFACE_H_
+#define CAPTURE_YUV_SURFACE_H_
+
+#include <functional>
+
+#include <SDL.h>
+
+#include "gui/unique_sdl_surface.h"
+
+// A YUV surface wraps a frame in its native YUV format (e.g. a buffer of a capture device)
+// without converting it. Since SDL_Surface can't have a YUV format, the surface has a
+// placeholder format, and its userdata points to YUVSurfaceInfo. So the surfaces passed
+// to the analyzer must not use userdata for anything else.
+// Use getRGB() in capture_source.h to read a pixel, and toDrawableSurface() to draw it.
+struct YUVSurfaceInfo {
+    // SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY or SDL_PIXELFORMAT_NV12.
+    // For NV12, the UV plane follows the Y plane with the same pitch.
+    Uint32 format;
+    // Called when the surface is freed.
+    std::function<void ()> release;
+};
+
+// Wraps |pixels| without copying. |release| is called when the surface is freed,
+// on the thread which frees it.
+UniqueSDLSurface makeYUVSurface(void* pixels, int width, int height, int pitch, Uint32 format,
+                                std::function<void ()> release);
+
+// Returns nullptr if |surface| is not a YUV surface.
+inline const YUVSurfaceInfo* yuvSurfaceInfo(const SDL_Surface* surface)
+{
+    return static_cast<const YUVSurfaceInfo*>(surface->userdata);
+}
+
+// Reads Y, U and V at (x, y) of a YUV surface.
+inline void getYUV(const SDL_Surface* surface, const YUVSurfaceInfo& info, int x, int y, int* yy, int* u, int* v)
+{
+    const Uint8* line = static_cast<const Uint8*>(surface->pixels) + y * surface->pitch;
+    switch (info.format) {
+    case SDL_PIXELFORMAT_YUY2: {
+        const Uint8* p = line + (x & ~1) * 2;
+        *yy = p[(x & 1) * 2];
+        *u = p[1];
+        *v = p[3];
+        return;
+    }
+    case SDL_PIXELFORMAT_UYVY: {
+        const Uint8* p = line + (x & ~1) * 2;
+        *yy = p[(x & 1) * 2 + 1];
+        *u = p[0];
+        *v = p[2];
+        return;
+    }
+    default: {
+        // NV12
+        const Uint8* uv = static_cast<const Uint8*>(surface->pixels) +
+            (surface->h + y / 2) * surface->pitch + (x & ~1);
+        *yy = line[x];
+        *u = uv[0];
+        *v = uv[1];
+        return;
+    }
+    }
+}
+
+// Returns |surface| itself if it's not a YUV surface. Otherwise, converts it to RGB
+// into |*buffer|, which is (re)allocated when it doesn't fit, and returns |*buffer|.
+// Returns nullptr if the conversion failed.
+SDL_Surface* toDrawableSurface(SDL_Surface* surface, UniqueSDLSurface* buffer);
+
+#endif // CAPTURE_YUV_SURFACE_H_
@@ -0,0 +1,102 @@
+#include "capture/yuv_surface.h"
+
+#include <gtest/gtest.h>
+
+#include "capture/capture_source.h"
+
+using namespace std;
+
+namespace {
+
+void expectRGB(const SDL_Surface* surface, int x, int y, int yy, int u, int v)
+{
+    int r, g, b;
+    convertUVY2RGBA(u, v, yy, &r, &g, &b);
+
+    Uint8 actualR, actualG, actualB;
+    getRGB(surface, x, y, &actualR, &actualG, &actualB);
+    EXPECT_EQ(r, actualR) << x << ' ' << y;
+    EXPECT_EQ(g, actualG) << x << ' ' << y;
+    EXPECT_EQ(b, actualB) << x << ' ' << y;
+}
+
+}
+
+TEST(YUVSurfaceTest, yuy2)
+{
+    // 2x2 pixels. Each line is Y0 U Y1 V, padded to 6 bytes.
+    Uint8 pixels[] = {
+        100, 90, 150, 200, 0, 0,
+        30, 60, 220, 110, 0, 0,
+    };
+
+    int numReleased = 0;
+    UniqueSDLSurface surface = makeYUVSurface(pixels, 2, 2, 6, SDL_PIXELFORMAT_YUY2, [&]() { ++numReleased; });
+    ASSERT_TRUE(surface.get() != nullptr);
+    ASSERT_TRUE(yuvSurfaceInfo(surface.get()) != nullptr);
+    // The pixels are not copied.
+    EXPECT_EQ(pixels, surface->pixels);
+
+    expectRGB(surface.get(), 0, 0, 100, 90, 200);
+    expectRGB(surface.get(), 1, 0, 150, 90, 200);
+    expectRGB(surface.get(), 0, 1, 30, 60, 110);
+    expectRGB(surface.get(), 1, 1, 220, 60, 110);
+
+    EXPECT_EQ(0, numReleased);
+    surface.reset();
+    EXPECT_EQ(1, numReleased);
+}
+
+TEST(YUVSurfaceTest, uyvy)
+{
+    // 2x1 pixels: U Y0 V Y1.
+    Uint8 pixels[] = { 90, 100, 200, 150 };
+
+    UniqueSDLSurface surface = makeYUVSurface(pixels, 2, 1, 4, SDL_PIXELFORMAT_UYVY, nullptr);
+    ASSERT_TRUE(surface.get() != nullptr);
+
+    expectRGB(surface.get(), 0, 0, 100, 90, 200);
+    expectRGB(surface.get(), 1, 0, 150, 90, 200);
+}
+
+TEST(YUVSurfaceTest, nv12)
+{
+    // 4x2 pixels. The Y plane is followed by the UV plane of 2x1.
+    Uint8 pixels[] = {
+        10, 20, 30, 40,
+        50, 60, 70, 80,
+        90, 200, 120, 130,
+    };
+
+    UniqueSDLSurface surface = makeYUVSurface(pixels, 4, 2, 4, SDL_PIXELFORMAT_NV12, nullptr);
+    ASSERT_TRUE(surface.get() != nullptr);
+
+    expectRGB(surface.get(), 0, 0, 10, 90, 200);
+    expectRGB(surface.get(), 1, 0, 20, 90, 200);
+    expectRGB(surface.get(), 2, 0, 30, 120, 130);
+    expectRGB(surface.get(), 3, 1, 80, 120, 130);
+}
+
+TEST(YUVSurfaceTest, toDrawableSurface)
+{
+    UniqueSDLSurface rgb(makeUniqueSDLSurface(SDL_CreateRGBSurfaceWithFormat(0, 2, 2, 32, SDL_PIXELFORMAT_ARGB8888)));
+    ASSERT_TRUE(rgb.get() != nullptr);
+    EXPECT_TRUE(yuvSurfaceInfo(rgb.get()) == nullptr);
+
+    // An RGB surface is drawn as is.
+    UniqueSDLSurface buffer(emptyUniqueSDLSurface());
+    EXPECT_EQ(rgb.get(), toDrawableSurface(rgb.get(), &buffer));
+    EXPECT_TRUE(buffer.get() == nullptr);
+
+    // A YUV surface is converted into the buffer.
+    Uint8 pixels[8] {};
+    UniqueSDLSurface yuv = makeYUVSurface(pixels, 2, 2, 4, SDL_PIXELFORMAT_YUY2, nullptr);
+    SDL_Surface* drawable = toDrawableSurface(yuv.get(), &buffer);
+    ASSERT_TRUE(drawable != nullptr);
+    EXPECT_EQ(buffer.get(), drawable);
+    EXPECT_EQ(2, drawable->w);
+    EXPECT_EQ(2, drawable->h);
+
+    // The buffer is reused.
+    EXPECT_EQ(drawable, toDrawableSurface(yuv.get(), &buffer));
+}
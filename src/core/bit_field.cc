@@ -5,7 +5,9 @@
 
 #include <sstream>
 
+#include "base/builtin.h"
 #include "core/frame.h"
+#include "core/kumipuyo_seq.h"
 #include "core/plain_field.h"
 #include "core/position.h"
 #include "core/score.h"
@@ -105,6 +107,71 @@ bool BitField::hasFloatingPuyo() const
     return !b.maskedField13().isEmpty();
 }
 
+void BitField::permuteColors(const ColorPermutation& perm)
+{
+    if (perm.isIdentity())
+        return;
+
+    // The normal colors are 1xx, where xx is their index. So, permuting the normal colors
+    // only rewrites the lower 2 planes of the normal color cells.
+    FieldBits m0 = m_[0].notmask(m_[2]);
+    FieldBits m1 = m_[1].notmask(m_[2]);
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        int to = ordinal(perm.apply(c));
+        FieldBits b = bits(c);
+        if (to & 1)
+            m0.setAll(b);
+        if (to & 2)
+            m1.setAll(b);
+    }
+
+    m_[0] = m0;
+    m_[1] = m1;
+}
+
+ColorPermutation BitField::canonicalColorPermutation(const KumipuyoSeq* seq) const
+{
+    // The bit order of FieldBits is the order of scanning the field column by column
+    // from the bottom, so the first appearance in the field is the lowest bit.
+    // Colors not in the field are ordered by the first appearance in |seq|.
+    static const int NOT_FOUND = 1 << 30;
+    const int seqBase = 128;
+
+    int firstAppearance[NUM_NORMAL_PUYO_COLORS];
+    for (int i = 0; i < NUM_NORMAL_PUYO_COLORS; ++i) {
+        FieldBits b = bits(NORMAL_PUYO_COLORS[i]);
+        std::uint64_t lo = _mm_cvtsi128_si64(b);
+        std::uint64_t hi = _mm_extract_epi64(b, 1);
+        if (lo)
+            firstAppearance[i] = countTrailingZeros64(lo);
+        else if (hi)
+            firstAppearance[i] = 64 + countTrailingZeros64(hi);
+        else
+            firstAppearance[i] = NOT_FOUND;
+    }
+
+    if (seq) {
+        for (int i = 0; i < seq->size(); ++i) {
+            const Kumipuyo& kp = seq->get(i);
+            if (::isNormalColor(kp.axis) && firstAppearance[normalColorIndex(kp.axis)] == NOT_FOUND)
+                firstAppearance[normalColorIndex(kp.axis)] = seqBase + 2 * i;
+            if (::isNormalColor(kp.child) && firstAppearance[normalColorIndex(kp.child)] == NOT_FOUND)
+                firstAppearance[normalColorIndex(kp.child)] = seqBase + 2 * i + 1;
+        }
+    }
+
+    return ColorPermutation::fromFirstAppearance(firstAppearance);
+}
+
+ColorPermutation BitField::canonicalize(KumipuyoSeq* seq)
+{
+    ColorPermutation perm = canonicalColorPermutation(seq);
+    permuteColors(perm);
+    if (seq)
+        seq->permuteColors(perm);
+    return perm;
+}
+
 Position* BitField::fillSameColorPosition(int x, int y, PuyoColor c,
                                           Position* positionQueueHead, FieldBits* checked) const
 {
@@ -7,6 +7,7 @@
 
 #include "base/base.h"
 #include "base/sse.h"
+#include "core/color_permutation.h"
 #include "core/field_bits.h"
 #include "core/frame.h"
 #include "core/puyo_color.h"
@@ -14,6 +15,7 @@
 #include "core/rensa_tracker.h"
 #include "core/score.h"
 
+class KumipuyoSeq;
 class PlainField;
 struct Position;
 
@@ -47,6 +49,17 @@ public:
     void setColorAll(FieldBits, PuyoColor);
     void setColorAllIfEmpty(FieldBits, PuyoColor);
 
+    // Relabels the normal colors by |perm|.
+    void permuteColors(const ColorPermutation& perm);
+    // Returns the permutation that makes this field (and |seq|) canonical. The normal colors are
+    // relabeled in the order of their first appearance, scanning the field column by column
+    // from the bottom, and then |seq|.
+    ColorPermutation canonicalColorPermutation(const KumipuyoSeq* seq = nullptr) const;
+    // Permutes the colors of this field and |seq| into the canonical form, and returns the
+    // applied permutation. Pairs of field and seq that are equivalent under color permutation
+    // have the same canonical form.
+    ColorPermutation canonicalize(KumipuyoSeq* seq = nullptr);
+
     bool isZenkeshi() const { return FieldBits(m_[0] | m_[1] | m_[2]).maskedField13().isEmpty(); }
 
     bool isConnectedPuyo(int x, int y) const { return isConnectedPuyo(x, y, color(x, y)); }
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "base/base.h"
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 
 using namespace std;
@@ -22,7 +23,7 @@ TEST(BitFieldPerformanceTest, hash)
         EXPECT_EQ(expected, bf.hash());
     }
 
-    tscd.showStatistics();
+    reportTestBenchmark(tscd);
 }
 
 TEST(BitFieldPerformanceTest, bitfield_simulate_filled)
@@ -53,7 +54,7 @@ TEST(BitFieldPerformanceTest, bitfield_simulate_filled)
         EXPECT_EQ(19, bf.simulate(&context, &tracker).chains);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(BitFieldPerformanceTest, bitfield_simulate_fast_filled)
@@ -83,7 +84,7 @@ TEST(BitFieldPerformanceTest, bitfield_simulate_fast_filled)
         EXPECT_EQ(19, bf.simulateFast(&tracker));
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 #if defined(__AVX2__) && defined(__BMI2__)
@@ -115,7 +116,7 @@ TEST(BitFieldPerformanceTest, bitfield_simulate_avx2_filled)
         EXPECT_EQ(19, bf.simulateAVX2(&context, &tracker).chains);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(BitFieldPerformanceTest, bitfield_simulate_fast_avx2_filled)
@@ -145,6 +146,6 @@ TEST(BitFieldPerformanceTest, bitfield_simulate_fast_avx2_filled)
         EXPECT_EQ(19, bf.simulateFastAVX2(&tracker));
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 #endif // defined(__AVX2__) && defined(__BMI2__)
@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 
+#include "core/kumipuyo_seq.h"
 #include "core/plain_field.h"
 
 using namespace std;
@@ -731,3 +732,56 @@ TEST(BitFieldTest, hash)
         }
     }
 }
+
+TEST(BitFieldTest, permuteColors)
+{
+    BitField bf(
+        "R....."
+        "BYGO..");
+
+    // BLUE <-> RED, YELLOW <-> GREEN
+    const int firstAppearance[] = { 1, 0, 3, 2 };
+    bf.permuteColors(ColorPermutation::fromFirstAppearance(firstAppearance));
+
+    BitField expected(
+        "B....."
+        "RGYO..");
+    EXPECT_EQ(expected, bf);
+}
+
+TEST(BitFieldTest, canonicalize)
+{
+    BitField bf(
+        "R....."
+        "BYBO..");
+    KumipuyoSeq seq("YGRR");
+
+    BitField canonical(bf);
+    KumipuyoSeq canonicalSeq(seq);
+    ColorPermutation perm = canonical.canonicalize(&canonicalSeq);
+
+    // The colors are relabeled in the order of (1, 1), (1, 2), (2, 1), and then the seq.
+    BitField expected(
+        "B....."
+        "RYRO..");
+    EXPECT_EQ(expected, canonical);
+    EXPECT_EQ(KumipuyoSeq("YGBB"), canonicalSeq);
+    EXPECT_EQ(perm, bf.canonicalColorPermutation(&seq));
+
+    // The equivalent pair has the same canonical form.
+    const int firstAppearance[] = { 2, 3, 0, 1 };
+    ColorPermutation other = ColorPermutation::fromFirstAppearance(firstAppearance);
+    BitField bf2(bf);
+    KumipuyoSeq seq2(seq);
+    bf2.permuteColors(other);
+    seq2.permuteColors(other);
+    ASSERT_FALSE(bf == bf2);
+
+    bf2.canonicalize(&seq2);
+    EXPECT_EQ(canonical, bf2);
+    EXPECT_EQ(canonicalSeq, seq2);
+
+    // The inverse permutation recovers the original.
+    canonical.permuteColors(perm.inverse());
+    EXPECT_EQ(bf, canonical);
+}
@@ -1,9 +1,14 @@
 #include "core/client/ai/ai.h"
 
 #include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <gflags/gflags.h>
 #include <glog/logging.h>
 
 #include "base/base.h"
+#include "base/instrumentation.h"
+#include "base/time.h"
 #include "core/core_field.h"
 #include "core/decision.h"
 #include "core/field_pretty_printer.h"
@@ -17,6 +22,11 @@
 
 using namespace std;
 
+DEFINE_bool(instrumentation_in_message, false,
+            "Append the instrumentation report of each think to the message. Effective only with USE_INSTRUMENTATION.");
+DEFINE_string(ai_think_latency_summary, "",
+              "If set, the think latency is appended to this file in a JSON line per game.");
+
 struct DecisionSending {
     void clear()
     {
@@ -26,8 +36,12 @@ struct DecisionSending {
     DropDecision dropDecision = DropDecision();
     Kumipuyo kumipuyo = Kumipuyo();
     CoreField fieldBeforeThink;
+    // When the decision request has been received.
+    std::chrono::steady_clock::time_point requestedTime;
 
     bool requested = false;
+    // True when the decision has been thought again in a short time after the request.
+    bool rethought = false;
     bool ready = false;
     // True when we need to rethink this hand. This happens when we detected ojama etc.
     bool needsRethink = false;
@@ -78,6 +92,7 @@ void AI::runLoop()
             LOG(ERROR) << "received unexpected request?";
             break;
         }
+        const auto receivedTime = std::chrono::steady_clock::now();
 
         if (!frameRequest.isValid()) {
             connector_->send(FrameResponse(frameRequest.frameId));
@@ -137,8 +152,8 @@ void AI::runLoop()
             }
 
             next1.fieldBeforeThink = me_.field;
-            next1.dropDecision = think(nextThinkFrameId, me_.field, seq,
-                                       myPlayerState(), enemyPlayerState(), false);
+            next1.dropDecision = thinkWithReport(nextThinkFrameId, me_.field, seq,
+                                                 myPlayerState(), enemyPlayerState(), false);
 
             next1.kumipuyo = kumipuyoSeq.get(1);
             next1.ready = true;
@@ -159,6 +174,7 @@ void AI::runLoop()
         if (frameRequest.myPlayerFrameRequest().event.decisionRequest) {
             VLOG(1) << "REQUESTED";
             next1.requested = true;
+            next1.requestedTime = receivedTime;
             decisionRequestedForMe(frameRequest);
         }
         if (frameRequest.myPlayerFrameRequest().event.decisionRequestAgain) {
@@ -167,13 +183,14 @@ void AI::runLoop()
             VLOG(1) << "REQUEST_AGAIN";
             DCHECK(!frameRequest.myPlayerFrameRequest().event.decisionRequest)
                 << "decisionRequestAgain should not come with decisionRequest.";
-            DropDecision dropDecision = think(frameRequest.frameId,
-                                              CoreField(frameRequest.myPlayerFrameRequest().field),
-                                              frameRequest.myPlayerFrameRequest().kumipuyoSeq,
-                                              myPlayerState(),
-                                              enemyPlayerState(),
-                                              true);
+            DropDecision dropDecision = thinkWithReport(frameRequest.frameId,
+                                                        CoreField(frameRequest.myPlayerFrameRequest().field),
+                                                        frameRequest.myPlayerFrameRequest().kumipuyoSeq,
+                                                        myPlayerState(),
+                                                        enemyPlayerState(),
+                                                        true);
             connector_->send(FrameResponse(frameRequest.frameId, dropDecision.decision(), dropDecision.message()));
+            recordThinkLatency(true, receivedTime, dropDecision.decision());
             continue;
         }
 
@@ -213,9 +230,10 @@ void AI::runLoop()
             CHECK_EQ(kumipuyoSeq.get(0), seq.get(0));
             CHECK_EQ(kumipuyoSeq.get(1), seq.get(1));
 
-            next1.dropDecision = think(frameRequest.frameId, me_.field, seq, myPlayerState(), enemyPlayerState(), true);
+            next1.dropDecision = thinkWithReport(frameRequest.frameId, me_.field, seq, myPlayerState(), enemyPlayerState(), true);
             next1.kumipuyo = kumipuyoSeq.get(0);
             next1.ready = true;
+            next1.rethought = true;
             next1.needsRethink = false;
             next1.ojamaDropped = false;
             rethinkRequested_ = false;
@@ -223,6 +241,7 @@ void AI::runLoop()
 
         // Send
         connector_->send(FrameResponse(frameRequest.frameId, next1.dropDecision.decision(), next1.dropDecision.message()));
+        recordThinkLatency(next1.rethought, next1.requestedTime, next1.dropDecision.decision());
         nextThinkFrameId =
             frameRequest.frameId +
             next1.fieldBeforeThink.framesToDropNext(next1.dropDecision.decision()) +
@@ -241,6 +260,45 @@ void AI::runLoop()
     LOG(INFO) << "will exit run loop";
 }
 
+void AI::recordThinkLatency(bool fast, std::chrono::steady_clock::time_point requestedTime, const Decision& decision)
+{
+    if (!decision.isValid()) {
+        thinkLatencyStats_.addFallback();
+        return;
+    }
+
+    auto latency = std::chrono::steady_clock::now() - requestedTime;
+    thinkLatencyStats_.addAnswered(fast, latency, latency > ThinkLatencyStats::DEADLINE);
+}
+
+DropDecision AI::thinkWithReport(int frameId, const CoreField& field, const KumipuyoSeq& seq,
+                                 const PlayerState& me, const PlayerState& enemy, bool fast)
+{
+    if (!Instrumentation::enabled())
+        return think(frameId, field, seq, me, enemy, fast);
+
+    InstrumentationSnapshot before = Instrumentation::snapshot();
+    double beginTime = currentTime();
+    DropDecision dropDecision = think(frameId, field, seq, me, enemy, fast);
+    double endTime = currentTime();
+
+    InstrumentationSnapshot recorded = Instrumentation::snapshot().since(before);
+    if (recorded.empty())
+        return dropDecision;
+
+    string report = recorded.toString(endTime - beginTime);
+    LOG(INFO) << "think: frameId=" << frameId << " fast=" << fast
+              << " time=" << (endTime - beginTime) * 1000 << "ms " << report;
+    if (FLAGS_instrumentation_in_message) {
+        if (dropDecision.message().empty())
+            dropDecision.setMessage(report);
+        else
+            dropDecision.setMessage(dropDecision.message() + "\n" + report);
+    }
+
+    return dropDecision;
+}
+
 void AI::gaze(int frameId, const CoreField&, const KumipuyoSeq&)
 {
     UNUSED_VARIABLE(frameId);
@@ -255,12 +313,22 @@ void AI::gameWillBegin(const FrameRequest& frameRequest)
 
     rethinkRequested_ = false;
     enemyDecisionRequestFrameId_ = 0;
+    thinkLatencyStats_.clear();
 
     onGameWillBegin(frameRequest);
 }
 
 void AI::gameHasEnded(const FrameRequest& frameRequest)
 {
+    LOG(INFO) << "think latency: " << thinkLatencyStats_.toString();
+    if (!FLAGS_ai_think_latency_summary.empty()) {
+        ofstream ofs(FLAGS_ai_think_latency_summary, ios::app);
+        if (ofs)
+            ofs << "{\"name\": \"" << name_ << "\", \"latency\": " << thinkLatencyStats_.toJson() << "}" << endl;
+        else
+            LOG(ERROR) << "failed to open " << FLAGS_ai_think_latency_summary;
+    }
+
     onGameHasEnded(frameRequest);
 }
 
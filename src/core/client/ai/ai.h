@@ -1,6 +1,7 @@
 #ifndef CORE_CLIENT_AI_AI_H_
 #define CORE_CLIENT_AI_AI_H_
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -9,6 +10,7 @@
 #include "core/client/client_connector.h"
 #include "core/kumipuyo_seq.h"
 #include "core/player_state.h"
+#include "core/think_latency_stats.h"
 
 class CoreField;
 class PlainField;
@@ -118,6 +120,8 @@ protected:
     PlayerState* mutableMyPlayerState() { return &me_; }
     PlayerState* mutableEnemyPlayerState() { return &enemy_; }
 
+    const ThinkLatencyStats& thinkLatencyStats() const { return thinkLatencyStats_; }
+
 private:
     friend class AITest;
     friend class Endless;
@@ -126,6 +130,15 @@ private:
     static bool isFieldInconsistent(const PlainField& ours, const PlainField& provided);
     static CoreField mergeField(const CoreField& ours, const PlainField& provided, bool ojamaDropped);
 
+    // Calls think(). When instrumentation is enabled, what has been recorded during think()
+    // is logged (and appended to the message with --instrumentation_in_message).
+    DropDecision thinkWithReport(int frameId, const CoreField&, const KumipuyoSeq&,
+                                 const PlayerState& me, const PlayerState& enemy, bool fast);
+
+    // Records the latency from receiving the decision request at |requestedTime| until now,
+    // when the decision has been sent.
+    void recordThinkLatency(bool fast, std::chrono::steady_clock::time_point requestedTime, const Decision&);
+
     // Returns the remembered sequence. If desynced, provided is returned as is.
     KumipuyoSeq rememberedSequence(int indexFrom, const KumipuyoSeq& provided) const;
 
@@ -141,6 +154,9 @@ private:
     PlayerState enemy_;
 
     bool behaviorRethinkAfterOpponentRensa_;
+
+    // The latency of answering decision requests in the current game.
+    ThinkLatencyStats thinkLatencyStats_;
 };
 
 #endif // CORE_CLIENT_AI_AI_H_
@@ -0,0 +1,62 @@
+#include "core/color_permutation.h"
+
+#include <algorithm>
+
+using namespace std;
+
+ColorPermutation::ColorPermutation()
+{
+    for (int i = 0; i < NUM_PUYO_COLORS; ++i)
+        map_[i] = static_cast<PuyoColor>(i);
+}
+
+// static
+ColorPermutation ColorPermutation::fromFirstAppearance(const int firstAppearance[NUM_NORMAL_PUYO_COLORS])
+{
+    int order[NUM_NORMAL_PUYO_COLORS] = { 0, 1, 2, 3 };
+    stable_sort(order, order + NUM_NORMAL_PUYO_COLORS, [&](int lhs, int rhs) {
+        return firstAppearance[lhs] < firstAppearance[rhs];
+    });
+
+    ColorPermutation perm;
+    for (int i = 0; i < NUM_NORMAL_PUYO_COLORS; ++i)
+        perm.map_[ordinal(NORMAL_PUYO_COLORS[order[i]])] = NORMAL_PUYO_COLORS[i];
+    return perm;
+}
+
+bool ColorPermutation::isIdentity() const
+{
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        if (apply(c) != c)
+            return false;
+    }
+    return true;
+}
+
+ColorPermutation ColorPermutation::inverse() const
+{
+    ColorPermutation perm;
+    for (PuyoColor c : NORMAL_PUYO_COLORS)
+        perm.map_[ordinal(apply(c))] = c;
+    return perm;
+}
+
+string ColorPermutation::toString() const
+{
+    string s;
+    for (PuyoColor c : NORMAL_PUYO_COLORS)
+        s += toChar(c);
+    s += '>';
+    for (PuyoColor c : NORMAL_PUYO_COLORS)
+        s += toChar(apply(c));
+    return s;
+}
+
+bool operator==(const ColorPermutation& lhs, const ColorPermutation& rhs)
+{
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        if (lhs.apply(c) != rhs.apply(c))
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,41 @@
+#ifndef CORE_COLOR_PERMUTATION_H_
+#define CORE_COLOR_PERMUTATION_H_
+
+#include <string>
+
+#include "core/kumipuyo.h"
+#include "core/puyo_color.h"
+
+// ColorPermutation is a permutation of the 4 normal colors. The other colors
+// (EMPTY, OJAMA, WALL and IRON) are always mapped to themselves.
+//
+// Puyo positions are equivalent under any ColorPermutation, so caches and books can
+// be keyed on the canonical form (c.f. BitField::canonicalize()).
+class ColorPermutation {
+public:
+    // Makes the identity permutation.
+    ColorPermutation();
+
+    // Makes the permutation that relabels the normal colors in the order of their
+    // first appearance. |firstAppearance[i]| is the key of NORMAL_PUYO_COLORS[i]; the color
+    // having the smallest key is mapped to RED, the next one to BLUE, and so on.
+    // Ties are broken by the original color order.
+    static ColorPermutation fromFirstAppearance(const int firstAppearance[NUM_NORMAL_PUYO_COLORS]);
+
+    PuyoColor apply(PuyoColor c) const { return map_[ordinal(c)]; }
+    Kumipuyo apply(const Kumipuyo& kp) const { return Kumipuyo(apply(kp.axis), apply(kp.child)); }
+
+    bool isIdentity() const;
+    ColorPermutation inverse() const;
+
+    // e.g. "RBYG>BRYG" (RED is mapped to BLUE, and BLUE is mapped to RED).
+    std::string toString() const;
+
+    friend bool operator==(const ColorPermutation&, const ColorPermutation&);
+    friend bool operator!=(const ColorPermutation& lhs, const ColorPermutation& rhs) { return !(lhs == rhs); }
+
+private:
+    PuyoColor map_[NUM_PUYO_COLORS];
+};
+
+#endif // CORE_COLOR_PERMUTATION_H_
@@ -0,0 +1,64 @@
+#include "core/color_permutation.h"
+
+#include <gtest/gtest.h>
+
+TEST(ColorPermutationTest, identity)
+{
+    ColorPermutation perm;
+
+    EXPECT_TRUE(perm.isIdentity());
+    for (int i = 0; i < NUM_PUYO_COLORS; ++i) {
+        PuyoColor c = static_cast<PuyoColor>(i);
+        EXPECT_EQ(c, perm.apply(c));
+    }
+    EXPECT_EQ("RBYG>RBYG", perm.toString());
+}
+
+TEST(ColorPermutationTest, fromFirstAppearance)
+{
+    // BLUE appears first, then RED, GREEN, and YELLOW.
+    const int firstAppearance[] = { 1, 0, 3, 2 };
+    ColorPermutation perm = ColorPermutation::fromFirstAppearance(firstAppearance);
+
+    EXPECT_FALSE(perm.isIdentity());
+    EXPECT_EQ(PuyoColor::RED, perm.apply(PuyoColor::BLUE));
+    EXPECT_EQ(PuyoColor::BLUE, perm.apply(PuyoColor::RED));
+    EXPECT_EQ(PuyoColor::YELLOW, perm.apply(PuyoColor::GREEN));
+    EXPECT_EQ(PuyoColor::GREEN, perm.apply(PuyoColor::YELLOW));
+    EXPECT_EQ("RBYG>BRGY", perm.toString());
+
+    // Non-normal colors are not changed.
+    EXPECT_EQ(PuyoColor::EMPTY, perm.apply(PuyoColor::EMPTY));
+    EXPECT_EQ(PuyoColor::OJAMA, perm.apply(PuyoColor::OJAMA));
+    EXPECT_EQ(PuyoColor::WALL, perm.apply(PuyoColor::WALL));
+    EXPECT_EQ(PuyoColor::IRON, perm.apply(PuyoColor::IRON));
+
+    EXPECT_EQ(Kumipuyo(PuyoColor::RED, PuyoColor::GREEN), perm.apply(Kumipuyo(PuyoColor::BLUE, PuyoColor::YELLOW)));
+}
+
+TEST(ColorPermutationTest, fromFirstAppearanceWithTies)
+{
+    // RED and YELLOW don't appear. They are ordered by the original color order.
+    const int firstAppearance[] = { 100, 5, 100, 3 };
+    ColorPermutation perm = ColorPermutation::fromFirstAppearance(firstAppearance);
+
+    EXPECT_EQ(PuyoColor::RED, perm.apply(PuyoColor::GREEN));
+    EXPECT_EQ(PuyoColor::BLUE, perm.apply(PuyoColor::BLUE));
+    EXPECT_EQ(PuyoColor::YELLOW, perm.apply(PuyoColor::RED));
+    EXPECT_EQ(PuyoColor::GREEN, perm.apply(PuyoColor::YELLOW));
+}
+
+TEST(ColorPermutationTest, inverse)
+{
+    // RED -> BLUE -> YELLOW -> RED
+    const int firstAppearance[] = { 1, 2, 0, 3 };
+    ColorPermutation perm = ColorPermutation::fromFirstAppearance(firstAppearance);
+    ColorPermutation inv = perm.inverse();
+
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        EXPECT_EQ(c, inv.apply(perm.apply(c)));
+        EXPECT_EQ(c, perm.apply(inv.apply(c)));
+    }
+    EXPECT_NE(perm, inv);
+    EXPECT_EQ(perm, inv.inverse());
+}
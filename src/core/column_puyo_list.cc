@@ -2,6 +2,7 @@
 
 #include <sstream>
 
+#include "core/color_permutation.h"
 #include "core/column_puyo.h"
 
 using namespace std;
@@ -18,7 +19,33 @@ string ColumnPuyoList::toString() const
     return oss.str();
 }
 
-// static
+void ColumnPuyoList::permuteColors(const ColorPermutation& perm)
+{
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j < size_[i]; ++j)
+            puyos_[i][j] = perm.apply(puyos_[i][j]);
+    }
+}
+
+ColorPermutation ColumnPuyoList::canonicalize()
+{
+    static const int NOT_FOUND = 1 << 30;
+    int firstAppearance[NUM_NORMAL_PUYO_COLORS] = { NOT_FOUND, NOT_FOUND, NOT_FOUND, NOT_FOUND };
+    int index = 0;
+    for (int i = 0; i < 6; ++i) {
+        for (int j = 0; j < size_[i]; ++j, ++index) {
+            PuyoColor c = puyos_[i][j];
+            if (isNormalColor(c) && firstAppearance[normalColorIndex(c)] == NOT_FOUND)
+                firstAppearance[normalColorIndex(c)] = index;
+        }
+    }
+
+    ColorPermutation perm = ColorPermutation::fromFirstAppearance(firstAppearance);
+    if (!perm.isIdentity())
+        permuteColors(perm);
+    return perm;
+}
+
 bool operator==(const ColumnPuyoList& lhs, const ColumnPuyoList& rhs)
 {
     for (int i = 0; i < 6; ++i) {
@@ -12,6 +12,8 @@
 #include "core/column_puyo.h"
 #include "core/puyo_color.h"
 
+class ColorPermutation;
+
 // ColumnPuyoList is a list of PuyoColor for each column.
 // You can think this is a list of ColumnPuyo, however, the implementation is different.
 class ColumnPuyoList {
@@ -141,6 +143,13 @@ public:
         }
     }
 
+    // Relabels the normal colors by |perm|.
+    void permuteColors(const ColorPermutation& perm);
+    // Relabels the normal colors in the order of their first appearance (column by column,
+    // from the bottom), and returns the applied permutation. ColumnPuyoLists equivalent under
+    // color permutation have the same canonical form.
+    ColorPermutation canonicalize();
+
     std::string toString() const;
 
     friend bool operator==(const ColumnPuyoList&, const ColumnPuyoList&);
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include "core/color_permutation.h"
+
 TEST(ColumnPuyoListTest, constructor)
 {
     ColumnPuyoList cpl;
@@ -144,3 +146,29 @@ TEST(ColumnPuyoListTest, mergeWithPlaceHolders3)
 
     EXPECT_FALSE(cpl1.merge(cpl2));
 }
+
+TEST(ColumnPuyoListTest, canonicalize)
+{
+    ColumnPuyoList cpl;
+    ASSERT_TRUE(cpl.add(1, PuyoColor::YELLOW));
+    ASSERT_TRUE(cpl.add(1, PuyoColor::IRON));
+    ASSERT_TRUE(cpl.add(3, PuyoColor::GREEN));
+    ASSERT_TRUE(cpl.add(3, PuyoColor::YELLOW));
+
+    ColumnPuyoList canonical(cpl);
+    ColorPermutation perm = canonical.canonicalize();
+
+    ColumnPuyoList expected;
+    ASSERT_TRUE(expected.add(1, PuyoColor::RED));
+    ASSERT_TRUE(expected.add(1, PuyoColor::IRON));
+    ASSERT_TRUE(expected.add(3, PuyoColor::BLUE));
+    ASSERT_TRUE(expected.add(3, PuyoColor::RED));
+    EXPECT_EQ(expected, canonical);
+    EXPECT_TRUE(canonical.hasPlaceHolder());
+
+    // Canonical form is canonical.
+    EXPECT_TRUE(canonical.canonicalize().isIdentity());
+
+    canonical.permuteColors(perm.inverse());
+    EXPECT_EQ(cpl, canonical);
+}
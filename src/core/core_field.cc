@@ -11,13 +11,15 @@
 #include "core/decision.h"
 #include "core/field_checker.h"
 #include "core/kumipuyo.h"
+#include "core/kumipuyo_seq.h"
 #include "core/position.h"
 #include "core/rensa_result.h"
 
 using namespace std;
 
 CoreField::CoreField(const std::string& url) :
-    field_(url)
+    field_(url),
+    dirtyConnectionColors_(ALL_NORMAL_COLORS_DIRTY)
 {
     heights_[0] = 0;
     for (int x = 1; x <= WIDTH; ++x) {
@@ -35,7 +37,8 @@ CoreField::CoreField(const std::string& url) :
 }
 
 CoreField::CoreField(const PlainField& f) :
-    field_(f)
+    field_(f),
+    dirtyConnectionColors_(ALL_NORMAL_COLORS_DIRTY)
 {
     heights_[0] = 0;
     for (int x = 1; x <= WIDTH; ++x) {
@@ -134,6 +137,46 @@ int CoreField::countReachableSpaces() const
     return count;
 }
 
+void CoreField::countConnection(int* count2, int* count3) const
+{
+    *count2 = *count3 = 0;
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        int cnt2, cnt3;
+        countConnection(c, &cnt2, &cnt3);
+        *count2 += cnt2;
+        *count3 += cnt3;
+    }
+}
+
+void CoreField::countConnection(PuyoColor c, int* count2, int* count3) const
+{
+    DCHECK(::isNormalColor(c)) << c;
+
+    int i = connectionIndex(c);
+    if (dirtyConnectionColors_ & (1 << i)) {
+        field_.bits(c).countConnection(count2, count3);
+        return;
+    }
+
+    *count2 = connection2_[i];
+    *count3 = connection3_[i];
+}
+
+void CoreField::updateConnectionCache()
+{
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        int i = connectionIndex(c);
+        if (!(dirtyConnectionColors_ & (1 << i)))
+            continue;
+
+        int count2, count3;
+        field_.bits(c).countConnection(&count2, &count3);
+        connection2_[i] = static_cast<std::int8_t>(count2);
+        connection3_[i] = static_cast<std::int8_t>(count3);
+    }
+    dirtyConnectionColors_ = 0;
+}
+
 int CoreField::ridgeHeight(int x) const
 {
     int currentHeight = height(x);
@@ -156,6 +199,59 @@ int CoreField::valleyDepth(int x) const
     return std::min(left, right);
 }
 
+void CoreField::calculateValleyDepthAndRidgeHeight(int valleyDepth[MAP_WIDTH], int ridgeHeight[MAP_WIDTH]) const
+{
+    // The walls are considered as height 14, same as valleyDepth() and ridgeHeight().
+    int h[MAP_WIDTH];
+    for (int x = 0; x < MAP_WIDTH; ++x)
+        h[x] = heights_[x];
+    h[0] = h[MAP_WIDTH - 1] = 14;
+
+    valleyDepth[0] = ridgeHeight[0] = 0;
+    valleyDepth[MAP_WIDTH - 1] = ridgeHeight[MAP_WIDTH - 1] = 0;
+
+    // min(max(a, 0), max(b, 0)) == max(min(a, b), 0). This loop has no branch.
+    for (int x = 1; x <= WIDTH; ++x) {
+        int left = h[x - 1] - h[x];
+        int right = h[x + 1] - h[x];
+        valleyDepth[x] = std::max(std::min(left, right), 0);
+        ridgeHeight[x] = std::max(std::min(-left, -right), 0);
+    }
+}
+
+void CoreField::permuteColors(const ColorPermutation& perm)
+{
+    if (perm.isIdentity())
+        return;
+
+    field_.permuteColors(perm);
+
+    // The connection counts move with the colors.
+    std::int8_t connection2[NUM_NORMAL_PUYO_COLORS];
+    std::int8_t connection3[NUM_NORMAL_PUYO_COLORS];
+    std::uint8_t dirty = 0;
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        int from = connectionIndex(c);
+        int to = connectionIndex(perm.apply(c));
+        connection2[to] = connection2_[from];
+        connection3[to] = connection3_[from];
+        if (dirtyConnectionColors_ & (1 << from))
+            dirty |= 1 << to;
+    }
+    std::copy(connection2, connection2 + NUM_NORMAL_PUYO_COLORS, connection2_);
+    std::copy(connection3, connection3 + NUM_NORMAL_PUYO_COLORS, connection3_);
+    dirtyConnectionColors_ = dirty;
+}
+
+ColorPermutation CoreField::canonicalize(KumipuyoSeq* seq)
+{
+    ColorPermutation perm = field_.canonicalColorPermutation(seq);
+    permuteColors(perm);
+    if (seq)
+        seq->permuteColors(perm);
+    return perm;
+}
+
 bool CoreField::dropKumipuyo(const Decision& decision, const Kumipuyo& kumiPuyo)
 {
     int x1 = decision.axisX();
@@ -170,15 +266,16 @@ bool CoreField::dropKumipuyo(const Decision& decision, const Kumipuyo& kumiPuyo)
             removePuyoFrom(x2);
             return false;
         }
-        return true;
+    } else {
+        if (!dropPuyoOnWithMaxHeight(x1, c1, 13))
+            return false;
+        if (!dropPuyoOnWithMaxHeight(x2, c2, 14)) {
+            removePuyoFrom(x1);
+            return false;
+        }
     }
 
-    if (!dropPuyoOnWithMaxHeight(x1, c1, 13))
-        return false;
-    if (!dropPuyoOnWithMaxHeight(x2, c2, 14)) {
-        removePuyoFrom(x1);
-        return false;
-    }
+    updateConnectionCache();
     return true;
 }
 
@@ -286,6 +383,7 @@ bool CoreField::dropPuyoOnWithMaxHeight(int x, PuyoColor c, int maxHeight)
         << toDebugString();
 
     unsafeSet(x, ++heights_[x], c);
+    markConnectionDirty(c);
     return true;
 }
 
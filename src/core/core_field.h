@@ -4,6 +4,7 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <initializer_list>
 #include <ostream>
 #include <string>
@@ -24,13 +25,14 @@
 
 class ColumnPuyoList;
 class Kumipuyo;
+class KumipuyoSeq;
 struct Position;
 
 // CoreField represents a field. Without strong reason, this class should be used for
 // field implementation.
 class CoreField : public FieldConstant {
 public:
-    CoreField() : heights_{} {}
+    CoreField() : heights_{}, connection2_{}, connection3_{}, dirtyConnectionColors_(0) {}
     explicit CoreField(const std::string& url);
     explicit CoreField(const PlainField&);
     explicit CoreField(const BitField&);
@@ -94,16 +96,25 @@ public:
     // Returns the number of reachable spaces.
     int countReachableSpaces() const;
 
-    void countConnection(int* count2, int* count3) const { return field_.countConnection(count2, count3); }
+    // Counts the connections of normal colors. c.f. FieldBits::countConnection().
+    // The counts are cached per color, and only the colors that have changed since the
+    // last dropKumipuyo() are counted here.
+    void countConnection(int* count2, int* count3) const;
+    void countConnection(PuyoColor, int* count2, int* count3) const;
     // Returns the ridge height of column |x|.
     int ridgeHeight(int x) const;
     // Returns the vallye depth of column |x|.
     int valleyDepth(int x) const;
+    // Calculates valleyDepth(x) and ridgeHeight(x) of all the columns at once.
+    // This is faster than calling valleyDepth() and ridgeHeight() for each column.
+    void calculateValleyDepthAndRidgeHeight(int valleyDepth[MAP_WIDTH], int ridgeHeight[MAP_WIDTH]) const;
 
     // ----------------------------------------------------------------------
     // field manipulation
 
     // Drop kumipuyo with decision.
+    // This also updates the cached connection counts of the changed colors, since
+    // the fields made by dropKumipuyo are usually evaluated.
     bool dropKumipuyo(const Decision&, const Kumipuyo&);
 
     // Returns #frame to drop the next KumiPuyo with decision. This function does not drop the puyo.
@@ -130,6 +141,12 @@ public:
     // If there is no puyo on column |x|, behavior is undefined.
     void removePuyoFrom(int x);
 
+    // Relabels the normal colors by |perm|. Heights don't change.
+    void permuteColors(const ColorPermutation& perm);
+    // Permutes the colors of this field and |seq| into the canonical form, and returns the
+    // applied permutation. c.f. BitField::canonicalize().
+    ColorPermutation canonicalize(KumipuyoSeq* seq = nullptr);
+
     // ----------------------------------------------------------------------
     // simulation
 
@@ -200,6 +217,8 @@ public:
     // TODO(mayah): Remove this.
     void setPuyoAndHeight(int x, int y, PuyoColor c)
     {
+        markConnectionDirty(color(x, y));
+        markConnectionDirty(c);
         unsafeSet(x, y, c);
 
         // Recalculate height.
@@ -211,15 +230,34 @@ public:
     }
 
 private:
+    static const std::uint8_t ALL_NORMAL_COLORS_DIRTY = (1 << NUM_NORMAL_PUYO_COLORS) - 1;
+
     void unsafeSet(int x, int y, PuyoColor c) { field_.setColor(x, y, c); }
 
+    static int connectionIndex(PuyoColor c) { return ordinal(c) - ordinal(PuyoColor::RED); }
+    void markConnectionDirty(PuyoColor c)
+    {
+        if (::isNormalColor(c))
+            dirtyConnectionColors_ |= 1 << connectionIndex(c);
+    }
+    void markAllConnectionDirty() { dirtyConnectionColors_ = ALL_NORMAL_COLORS_DIRTY; }
+    // Recounts the connections of the dirty colors.
+    void updateConnectionCache();
+
     BitField field_;
     alignas(16) int heights_[MAP_WIDTH];
+
+    // The connection counts of each normal color. They are valid only when the bit
+    // of the color in |dirtyConnectionColors_| is not set.
+    std::int8_t connection2_[NUM_NORMAL_PUYO_COLORS];
+    std::int8_t connection3_[NUM_NORMAL_PUYO_COLORS];
+    std::uint8_t dirtyConnectionColors_;
 };
 
 inline
 CoreField::CoreField(const BitField& f) :
-    field_(f)
+    field_(f),
+    dirtyConnectionColors_(ALL_NORMAL_COLORS_DIRTY)
 {
     f.calculateHeight(heights_);
 }
@@ -256,6 +294,8 @@ RensaResult CoreField::simulate(SimulationContext* context, Tracker* tracker)
 #endif
 
     field_.calculateHeight(heights_);
+    if (result.chains > 0)
+        markAllConnectionDirty();
     return result;
 }
 
@@ -276,6 +316,8 @@ int CoreField::simulateFast(Tracker* tracker)
 #endif
 
     field_.calculateHeight(heights_);
+    if (result > 0)
+        markAllConnectionDirty();
     return result;
 }
 
@@ -310,6 +352,8 @@ RensaStepResult CoreField::vanishDrop(SimulationContext* context, Tracker* track
 #endif
 
     field_.calculateHeight(heights_);
+    if (result.score > 0)
+        markAllConnectionDirty();
     return result;
 }
 
@@ -344,6 +388,8 @@ bool CoreField::vanishDropFast(SimulationContext* context, Tracker* tracker)
 #endif
 
     field_.calculateHeight(heights_);
+    if (result)
+        markAllConnectionDirty();
     return result;
 }
 
@@ -351,6 +397,7 @@ inline
 void CoreField::removePuyoFrom(int x)
 {
     DCHECK_GE(height(x), 1);
+    markConnectionDirty(color(x, height(x)));
     unsafeSet(x, heights_[x]--, PuyoColor::EMPTY);
 }
 
@@ -6,8 +6,10 @@
 #include <cstddef>
 #include <string>
 
+#include "core/color_permutation.h"
 #include "core/decision.h"
 #include "core/frame.h"
+#include "core/kumipuyo.h"
 #include "core/position.h"
 #include "core/rensa_result.h"
 
@@ -269,6 +271,37 @@ TEST(CoreFieldTest, valleyDepth2)
     EXPECT_EQ(0, cf.valleyDepth(6));
 }
 
+TEST(CoreFieldTest, calculateValleyDepthAndRidgeHeight)
+{
+    const CoreField fields[] = {
+        CoreField(),
+        CoreField(
+            ".O...."
+            ".O.O.."
+            "OO.O.."
+            "OO.O.O"
+            "OO.OOO"
+            "OOOOOO"),
+        CoreField(
+            "O....."
+            "O....."
+            "O....O"
+            "O..O.O"
+            "OO.O.O"
+            "OOOOOO"),
+    };
+
+    for (const auto& cf : fields) {
+        int valleyDepth[CoreField::MAP_WIDTH];
+        int ridgeHeight[CoreField::MAP_WIDTH];
+        cf.calculateValleyDepthAndRidgeHeight(valleyDepth, ridgeHeight);
+        for (int x = 1; x <= CoreField::WIDTH; ++x) {
+            EXPECT_EQ(cf.valleyDepth(x), valleyDepth[x]) << x;
+            EXPECT_EQ(cf.ridgeHeight(x), ridgeHeight[x]) << x;
+        }
+    }
+}
+
 TEST(CoreFieldTest, simulate1)
 {
     CoreField cf("RRRR..");
@@ -754,6 +787,102 @@ TEST(CoreFieldTest, countConnectedPuyosMax4EdgeCase)
     }
 }
 
+static void expectCountConnection(const CoreField& cf)
+{
+    int expected2, expected3;
+    cf.bitField().countConnection(&expected2, &expected3);
+
+    int actual2, actual3;
+    cf.countConnection(&actual2, &actual3);
+    EXPECT_EQ(expected2, actual2) << cf.toDebugString();
+    EXPECT_EQ(expected3, actual3) << cf.toDebugString();
+
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        cf.bitField().bits(c).countConnection(&expected2, &expected3);
+        cf.countConnection(c, &actual2, &actual3);
+        EXPECT_EQ(expected2, actual2) << c;
+        EXPECT_EQ(expected3, actual3) << c;
+    }
+}
+
+TEST(CoreFieldTest, countConnectionCache)
+{
+    CoreField cf(
+        "R....."
+        "RB...."
+        "BBY..."
+        "GGYY.R");
+    expectCountConnection(cf);
+
+    ASSERT_TRUE(cf.dropKumipuyo(Decision(2, 0), Kumipuyo(PuyoColor::BLUE, PuyoColor::RED)));
+    expectCountConnection(cf);
+    ASSERT_TRUE(cf.dropKumipuyo(Decision(5, 1), Kumipuyo(PuyoColor::YELLOW, PuyoColor::YELLOW)));
+    expectCountConnection(cf);
+
+    // Copies keep the cache.
+    CoreField copied(cf);
+    expectCountConnection(copied);
+
+    cf.removePuyoFrom(2);
+    expectCountConnection(cf);
+    cf.dropPuyoOn(2, PuyoColor::GREEN);
+    expectCountConnection(cf);
+    cf.setPuyoAndHeight(6, 2, PuyoColor::GREEN);
+    expectCountConnection(cf);
+
+    const int firstAppearance[NUM_NORMAL_PUYO_COLORS] = { 3, 2, 1, 0 };
+    cf.permuteColors(ColorPermutation::fromFirstAppearance(firstAppearance));
+    expectCountConnection(cf);
+    cf.canonicalize();
+    expectCountConnection(cf);
+
+    ASSERT_TRUE(cf.dropKumipuyo(Decision(1, 0), Kumipuyo(PuyoColor::GREEN, PuyoColor::GREEN)));
+    expectCountConnection(cf);
+
+    cf.simulate();
+    expectCountConnection(cf);
+}
+
+TEST(CoreFieldTest, countConnectionCacheAfterVanishDrop)
+{
+    CoreField cf(
+        "..B..."
+        "RRR.BB");
+    ASSERT_TRUE(cf.dropKumipuyo(Decision(4, 0), Kumipuyo(PuyoColor::RED, PuyoColor::BLUE)));
+    expectCountConnection(cf);
+
+    CoreField::SimulationContext context;
+    int chains = 0;
+    while (cf.vanishDrop(&context).score > 0) {
+        ++chains;
+        expectCountConnection(cf);
+    }
+    EXPECT_EQ(2, chains);
+    expectCountConnection(cf);
+}
+
+TEST(CoreFieldTest, countConnectionCacheWhenDropKumipuyoFails)
+{
+    CoreField cf(
+        "OOOOOO" // 13
+        "OOOOOO" // 12
+        "OOOOOO"
+        "OOOOOO"
+        "OOOOOO"
+        "OOOOOO" // 8
+        "OOOOOO"
+        "OOOOOO"
+        "OOOOOO"
+        "OOOOOO" // 4
+        "OOOOOO"
+        "OOOOOO"
+        "RRBBYY");
+    expectCountConnection(cf);
+
+    EXPECT_FALSE(cf.dropKumipuyo(Decision(3, 0), Kumipuyo(PuyoColor::RED, PuyoColor::RED)));
+    expectCountConnection(cf);
+}
+
 TEST(CoreFieldTest, isChigiriDecision1)
 {
     CoreField cf;
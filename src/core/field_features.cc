@@ -0,0 +1,96 @@
+#include "core/field_features.h"
+
+#include <smmintrin.h>
+
+#include <cstdint>
+
+#include "core/core_field.h"
+#include "core/field_bits.h"
+
+namespace {
+
+// Returns the number of 1 bits of each 16 bits, i.e. each column.
+inline __m128i popcount16(__m128i m)
+{
+    const __m128i lowMask = _mm_set1_epi8(0x0F);
+    const __m128i table = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+    __m128i low = _mm_shuffle_epi8(table, _mm_and_si128(m, lowMask));
+    __m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(m, 4), lowMask));
+    __m128i bytes = _mm_add_epi8(low, high);
+    return _mm_add_epi16(_mm_and_si128(bytes, _mm_set1_epi16(0x00FF)), _mm_srli_epi16(bytes, 8));
+}
+
+// Column x of the result has column (x + n) of |m|.
+template<int n>
+inline FieldBits shiftFromRight(FieldBits m) { return _mm_srli_si128(m, 2 * n); }
+
+// Column x of the result has column (x - n) of |m|.
+template<int n>
+inline FieldBits shiftFromLeft(FieldBits m) { return _mm_slli_si128(m, 2 * n); }
+
+}
+
+FieldFeatures::FieldFeatures(const CoreField& field)
+{
+    const BitField& bf = field.bitField();
+
+    // rows [1, LOW_ROWS] of the columns [1, 6].
+    const FieldBits lowRowsMask = FieldBits::FIELD_MASK_12 & FieldBits(_mm_set1_epi16(((1 << LOW_ROWS) - 1) << 1));
+    // The 2nd and 3rd columns. A run starting from here contains the 3rd and 4th columns.
+    const FieldBits crossed2Start = _mm_set_epi16(0, 0, 0, 0, -1, 0, 0, 0);
+    const FieldBits crossed3Start = _mm_set_epi16(0, 0, 0, 0, -1, -1, 0, 0);
+
+    alignas(16) std::int16_t columns[FieldConstant::MAP_WIDTH];
+    int run2 = 0, run2Crossed = 0, run3 = 0, run3Crossed = 0;
+    int numColorPuyos = 0;
+
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        const int i = colorIndex(c);
+        const FieldBits bits = bf.bits(c);
+
+        int count2, count3;
+        field.countConnection(c, &count2, &count3);
+        values_[CONNECTION_2 + i] = count2;
+        values_[CONNECTION_3 + i] = count3;
+
+        const FieldBits bits12 = bits.maskedField12();
+        values_[HORIZONTAL_PAIR + i] = (bits12 & shiftFromRight<1>(bits12)).popcount();
+        values_[VERTICAL_PAIR + i] = (bits12 & FieldBits(_mm_srli_epi16(bits12, 1))).popcount();
+
+        _mm_store_si128(reinterpret_cast<__m128i*>(columns), popcount16(bits.maskedField13()));
+        for (int x = 1; x <= FieldConstant::WIDTH; ++x) {
+            values_[COLUMN_COLOR + i * FieldConstant::WIDTH + x - 1] = columns[x];
+            numColorPuyos += columns[x];
+        }
+
+        // A run of length n starts at x when x, ..., x + n - 1 have the color and
+        // neither x - 1 nor x + n has. Walls are not in |low|.
+        const FieldBits low = bits & lowRowsMask;
+        const FieldBits pair = low & shiftFromRight<1>(low);
+        const FieldBits start = pair.notmask(shiftFromLeft<1>(low));
+        const FieldBits start2 = start.notmask(shiftFromRight<2>(low));
+        const FieldBits start3 = (start & shiftFromRight<2>(low)).notmask(shiftFromRight<3>(low));
+
+        run2 += start2.notmask(crossed2Start).popcount();
+        run2Crossed += start2.mask(crossed2Start).popcount();
+        run3 += start3.notmask(crossed3Start).popcount();
+        run3Crossed += start3.mask(crossed3Start).popcount();
+    }
+
+    values_[LOW_HORIZONTAL_2] = run2;
+    values_[LOW_HORIZONTAL_2_CROSSED] = run2Crossed;
+    values_[LOW_HORIZONTAL_3] = run3;
+    values_[LOW_HORIZONTAL_3_CROSSED] = run3Crossed;
+    values_[NUM_COLOR_PUYOS] = numColorPuyos;
+    values_[NUM_OJAMA_PUYOS] = bf.bits(PuyoColor::OJAMA).maskedField13().popcount();
+    values_[THIRD_COLUMN_HEIGHT] = field.height(3);
+}
+
+int FieldFeatures::sum(Index index) const
+{
+    int result = 0;
+    for (int i = 0; i < NUM_NORMAL_PUYO_COLORS; ++i)
+        result += values_[index + i];
+    return result;
+}
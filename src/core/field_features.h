@@ -0,0 +1,63 @@
+#ifndef CORE_FIELD_FEATURES_H_
+#define CORE_FIELD_FEATURES_H_
+
+#include "core/field_constant.h"
+#include "core/puyo_color.h"
+
+class CoreField;
+
+// FieldFeatures extracts the shape features of a field at once, and stores them
+// in a flat int vector. The features are calculated from the bit planes of the field
+// without looking at each cell, so this is much cheaper than collecting them
+// one by one with CoreField::color().
+//
+// The features of normal colors are stored per color in the order of NORMAL_PUYO_COLORS.
+class FieldFeatures {
+public:
+    enum Index {
+        // The number of puyos in 2 connection and in 3 or more connection.
+        // c.f. FieldBits::countConnection().
+        CONNECTION_2 = 0,
+        CONNECTION_3 = CONNECTION_2 + NUM_NORMAL_PUYO_COLORS,
+        // The number of horizontally or vertically adjacent pairs of the same color
+        // in the visible field.
+        HORIZONTAL_PAIR = CONNECTION_3 + NUM_NORMAL_PUYO_COLORS,
+        VERTICAL_PAIR = HORIZONTAL_PAIR + NUM_NORMAL_PUYO_COLORS,
+        // The number of puyos in each column (including the 13th row).
+        // The index of color c and column x is COLUMN_COLOR + colorIndex(c) * WIDTH + (x - 1).
+        COLUMN_COLOR = VERTICAL_PAIR + NUM_NORMAL_PUYO_COLORS,
+        // The number of horizontal runs of the same color whose length is exactly 2 or 3
+        // in the lowest LOW_ROWS rows. CROSSED ones contain both the 3rd and 4th columns,
+        // and are not counted in the others.
+        LOW_HORIZONTAL_2 = COLUMN_COLOR + NUM_NORMAL_PUYO_COLORS * FieldConstant::WIDTH,
+        LOW_HORIZONTAL_2_CROSSED,
+        LOW_HORIZONTAL_3,
+        LOW_HORIZONTAL_3_CROSSED,
+        // The total number of normal color puyos and ojama puyos (including the 13th row).
+        NUM_COLOR_PUYOS,
+        NUM_OJAMA_PUYOS,
+        THIRD_COLUMN_HEIGHT,
+
+        SIZE
+    };
+
+    static const int LOW_ROWS = 3;
+
+    explicit FieldFeatures(const CoreField&);
+
+    static int colorIndex(PuyoColor c) { return ordinal(c) - ordinal(PuyoColor::RED); }
+
+    int operator[](int index) const { return values_[index]; }
+    int get(Index index, PuyoColor c) const { return values_[index + colorIndex(c)]; }
+    int columnColor(int x, PuyoColor c) const { return values_[COLUMN_COLOR + colorIndex(c) * FieldConstant::WIDTH + x - 1]; }
+
+    // Sums the per-color feature |index| over the normal colors.
+    int sum(Index index) const;
+
+    const int* values() const { return values_; }
+
+private:
+    int values_[SIZE];
+};
+
+#endif // CORE_FIELD_FEATURES_H_
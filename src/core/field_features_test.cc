@@ -0,0 +1,135 @@
+#include "core/field_features.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "core/core_field.h"
+
+using namespace std;
+
+namespace {
+
+// Calculates the features cell by cell.
+void expectFeatures(const CoreField& f)
+{
+    FieldFeatures features(f);
+
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        int count2, count3;
+        f.bitField().bits(c).countConnection(&count2, &count3);
+        EXPECT_EQ(count2, features.get(FieldFeatures::CONNECTION_2, c)) << c;
+        EXPECT_EQ(count3, features.get(FieldFeatures::CONNECTION_3, c)) << c;
+
+        int horizontal = 0;
+        int vertical = 0;
+        for (int x = 1; x <= FieldConstant::WIDTH; ++x) {
+            for (int y = 1; y <= FieldConstant::HEIGHT; ++y) {
+                if (f.color(x, y) != c)
+                    continue;
+                if (x < FieldConstant::WIDTH && f.color(x + 1, y) == c)
+                    ++horizontal;
+                if (y < FieldConstant::HEIGHT && f.color(x, y + 1) == c)
+                    ++vertical;
+            }
+        }
+        EXPECT_EQ(horizontal, features.get(FieldFeatures::HORIZONTAL_PAIR, c)) << c;
+        EXPECT_EQ(vertical, features.get(FieldFeatures::VERTICAL_PAIR, c)) << c;
+
+        for (int x = 1; x <= FieldConstant::WIDTH; ++x) {
+            int count = 0;
+            for (int y = 1; y <= 13; ++y) {
+                if (f.color(x, y) == c)
+                    ++count;
+            }
+            EXPECT_EQ(count, features.columnColor(x, c)) << x << ' ' << c;
+        }
+    }
+
+    int runs[4] {};
+    for (int y = 1; y <= FieldFeatures::LOW_ROWS; ++y) {
+        for (int x = 1; x <= FieldConstant::WIDTH; ++x) {
+            if (!isNormalColor(f.color(x, y)))
+                continue;
+            int len = 1;
+            while (f.color(x, y) == f.color(x + len, y))
+                ++len;
+
+            bool crossed = x <= 3 && 4 < x + len;
+            if (len == 2)
+                ++runs[crossed ? 1 : 0];
+            else if (len == 3)
+                ++runs[crossed ? 3 : 2];
+            x += len - 1;
+        }
+    }
+    EXPECT_EQ(runs[0], features[FieldFeatures::LOW_HORIZONTAL_2]);
+    EXPECT_EQ(runs[1], features[FieldFeatures::LOW_HORIZONTAL_2_CROSSED]);
+    EXPECT_EQ(runs[2], features[FieldFeatures::LOW_HORIZONTAL_3]);
+    EXPECT_EQ(runs[3], features[FieldFeatures::LOW_HORIZONTAL_3_CROSSED]);
+
+    EXPECT_EQ(f.countColorPuyos(), features[FieldFeatures::NUM_COLOR_PUYOS]);
+    EXPECT_EQ(f.countColor(PuyoColor::OJAMA), features[FieldFeatures::NUM_OJAMA_PUYOS]);
+    EXPECT_EQ(f.height(3), features[FieldFeatures::THIRD_COLUMN_HEIGHT]);
+}
+
+}
+
+TEST(FieldFeaturesTest, empty)
+{
+    CoreField f;
+    FieldFeatures features(f);
+
+    for (int i = 0; i < FieldFeatures::SIZE; ++i)
+        EXPECT_EQ(0, features[i]) << i;
+}
+
+TEST(FieldFeaturesTest, features)
+{
+    CoreField f(
+        "Y....."
+        "YB...."
+        "BBY..."
+        "OGGGOO"
+        "OOYYOO"
+        "RRROGG");
+    FieldFeatures features(f);
+
+    EXPECT_EQ(3, features.get(FieldFeatures::HORIZONTAL_PAIR, PuyoColor::GREEN));
+    EXPECT_EQ(1, features.get(FieldFeatures::VERTICAL_PAIR, PuyoColor::YELLOW));
+    EXPECT_EQ(1, features.get(FieldFeatures::VERTICAL_PAIR, PuyoColor::BLUE));
+    EXPECT_EQ(2, features.columnColor(1, PuyoColor::YELLOW));
+    EXPECT_EQ(1, features.columnColor(1, PuyoColor::RED));
+    EXPECT_EQ(16, features[FieldFeatures::NUM_COLOR_PUYOS]);
+    EXPECT_EQ(8, features[FieldFeatures::NUM_OJAMA_PUYOS]);
+    EXPECT_EQ(4, features[FieldFeatures::THIRD_COLUMN_HEIGHT]);
+
+    EXPECT_EQ(1, features[FieldFeatures::LOW_HORIZONTAL_2]);
+    EXPECT_EQ(1, features[FieldFeatures::LOW_HORIZONTAL_2_CROSSED]);
+    EXPECT_EQ(1, features[FieldFeatures::LOW_HORIZONTAL_3]);
+    EXPECT_EQ(1, features[FieldFeatures::LOW_HORIZONTAL_3_CROSSED]);
+
+    expectFeatures(f);
+}
+
+TEST(FieldFeaturesTest, randomFields)
+{
+    const char colors[] = { 'R', 'B', 'Y', 'G', 'O' };
+
+    mt19937 mt(1);
+    for (int i = 0; i < 1000; ++i) {
+        int heights[FieldConstant::WIDTH];
+        for (int x = 0; x < FieldConstant::WIDTH; ++x)
+            heights[x] = mt() % 14;
+
+        string s;
+        for (int y = 13; y >= 1; --y) {
+            for (int x = 0; x < FieldConstant::WIDTH; ++x)
+                s += y <= heights[x] ? colors[mt() % (i % 2 ? 5 : 4)] : '.';
+        }
+
+        CoreField f(s);
+        expectFeatures(f);
+    }
+}
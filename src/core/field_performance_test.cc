@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "base/base.h"
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 #include "core/bit_field.h"
 #include "core/field_bits.h"
@@ -62,20 +63,13 @@ static void runCountConnectedPuyosTest(const PlainField& f, int expected, int x,
         EXPECT_LE(expected4, bf.countConnectedPuyosMax4(x, y, c));
     }
 
-    cout << "overhead: " << endl;
-    none.showStatistics();
-    cout << "PlainField::countConnectedPuyos: " << endl;
-    tscPlainField.showStatistics();
-    cout << "PlainField::countConnectedPuyosMax4: " << endl;
-    tscPlainFieldMax4.showStatistics();
-    cout << "FieldBits::countConnectedField: " << endl;
-    tscBitField.showStatistics();
-    cout << "FieldBits::countConnectedFieldMax4: " << endl;
-    tscBitFieldMax4.showStatistics();
-    cout << "FieldBits::countConnectedField (with color): " << endl;
-    tscBitFieldWithColor.showStatistics();
-    cout << "FieldBits::countConnectedFieldMax4 (with color): " << endl;
-    tscBitFieldMax4WithColor.showStatistics();
+    reportTestBenchmark(none, "overhead");
+    reportTestBenchmark(tscPlainField, "PlainField::countConnectedPuyos");
+    reportTestBenchmark(tscPlainFieldMax4, "PlainField::countConnectedPuyosMax4");
+    reportTestBenchmark(tscBitField, "FieldBits::countConnectedField");
+    reportTestBenchmark(tscBitFieldMax4, "FieldBits::countConnectedFieldMax4");
+    reportTestBenchmark(tscBitFieldWithColor, "FieldBits::countConnectedField (with color)");
+    reportTestBenchmark(tscBitFieldMax4WithColor, "FieldBits::countConnectedFieldMax4 (with color)");
 }
 
 static void runSimulation(const CoreField& original)
@@ -131,20 +125,14 @@ static void runSimulation(const CoreField& original)
     }
 #endif // __AVX2__ and __BMI2__
 
-    cout << "overhead: " << endl;
-    none.showStatistics();
-    cout << "CoreField: " << endl;
-    tscCoreField.showStatistics();
-    cout << "BitField: " << endl;
-    tscBitField.showStatistics();
-    cout << "BitField (fast): " << endl;
-    tscBitFieldFast.showStatistics();
+    reportTestBenchmark(none, "overhead");
+    reportTestBenchmark(tscCoreField, "CoreField");
+    reportTestBenchmark(tscBitField, "BitField");
+    reportTestBenchmark(tscBitFieldFast, "BitField (fast)");
 
 #if defined(__AVX2__) && defined(__BMI2__)
-    cout << "BitField AVX2: " << endl;
-    tscBitFieldAVX2.showStatistics();
-    cout << "BitField (fast) AVX2: " << endl;
-    tscBitFieldFastAVX2.showStatistics();
+    reportTestBenchmark(tscBitFieldAVX2, "BitField AVX2");
+    reportTestBenchmark(tscBitFieldFastAVX2, "BitField (fast) AVX2");
 #endif
 }
 
@@ -222,20 +210,14 @@ static void runVanishDrop(const CoreField& original)
     }
 #endif // __AVX2__ and __BMI2__
 
-    cout << "overhead: " << endl;
-    none.showStatistics();
-    cout << "CoreField: " << endl;
-    tscCoreField.showStatistics();
-    cout << "BitField: " << endl;
-    tscBitField.showStatistics();
-    cout << "BitField (fast): " << endl;
-    tscBitFieldFast.showStatistics();
+    reportTestBenchmark(none, "overhead");
+    reportTestBenchmark(tscCoreField, "CoreField");
+    reportTestBenchmark(tscBitField, "BitField");
+    reportTestBenchmark(tscBitFieldFast, "BitField (fast)");
 
 #if defined(__AVX2__) && defined(__BMI2__)
-    cout << "BitField AVX2: " << endl;
-    tscBitFieldAVX2.showStatistics();
-    cout << "BitField (fast) AVX2: " << endl;
-    tscBitFieldFastAVX2.showStatistics();
+    reportTestBenchmark(tscBitFieldAVX2, "BitField AVX2");
+    reportTestBenchmark(tscBitFieldFastAVX2, "BitField (fast) AVX2");
 #endif
 }
 
@@ -263,7 +245,7 @@ TEST(FieldPerformanceTest, copy)
         UNUSED_VARIABLE(f2);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(FieldPerformanceTest, simulate_empty)
@@ -2,6 +2,8 @@
 
 #include <glog/logging.h>
 
+#include "core/color_permutation.h"
+
 using namespace std;
 
 KumipuyoSeq::KumipuyoSeq(const string& str)
@@ -42,6 +44,12 @@ PuyoColor KumipuyoSeq::color(NextPuyoPosition npp) const
     return PuyoColor::EMPTY;
 }
 
+void KumipuyoSeq::permuteColors(const ColorPermutation& perm)
+{
+    for (auto& kp : seq_)
+        kp = perm.apply(kp);
+}
+
 string KumipuyoSeq::toString() const
 {
     std::string s;
@@ -9,6 +9,8 @@
 #include "core/next_puyo.h"
 #include "core/puyo_color.h"
 
+class ColorPermutation;
+
 class KumipuyoSeq {
 public:
     KumipuyoSeq() {}
@@ -43,6 +45,9 @@ public:
     void setAxis(int n, PuyoColor c) { seq_[n].axis = c; }
     void setChild(int n, PuyoColor c) { seq_[n].child = c; }
 
+    // Relabels the normal colors by |perm|.
+    void permuteColors(const ColorPermutation& perm);
+
     std::string toString() const;
 
     friend bool operator==(const KumipuyoSeq& lhs, const KumipuyoSeq& rhs) { return lhs.seq_ == rhs.seq_; }
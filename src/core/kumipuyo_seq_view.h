@@ -0,0 +1,74 @@
+#ifndef CORE_KUMIPUYO_SEQ_VIEW_H_
+#define CORE_KUMIPUYO_SEQ_VIEW_H_
+
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "core/kumipuyo.h"
+#include "core/kumipuyo_seq.h"
+
+// KumipuyoSeqView is a non-owning view of a range of kumipuyos, typically a KumipuyoSeq.
+// Taking a subsequence or dropping the front only moves the range, so search recursion can
+// pass the rest of the sequence without copying it.
+//
+// The viewed storage must outlive the view, and must not be modified while it's viewed.
+// A KumipuyoSeq is implicitly converted to a view of the whole sequence.
+class KumipuyoSeqView {
+public:
+    KumipuyoSeqView() : begin_(nullptr), size_(0) {}
+    KumipuyoSeqView(const KumipuyoSeq& seq) :
+        begin_(seq.isEmpty() ? nullptr : &seq.get(0)), size_(seq.size()) {}
+    // A view of the single kumipuyo |kp|.
+    KumipuyoSeqView(const Kumipuyo& kp) : begin_(&kp), size_(1) {}
+    KumipuyoSeqView(const Kumipuyo* begin, int size) : begin_(begin), size_(size) {}
+
+    const Kumipuyo& get(int n) const
+    {
+        DCHECK(0 <= n && n < size_) << n << ' ' << size_;
+        return begin_[n];
+    }
+    PuyoColor axis(int n) const { return get(n).axis; }
+    PuyoColor child(int n) const { return get(n).child; }
+    const Kumipuyo& front() const { return get(0); }
+
+    bool isEmpty() const { return size_ == 0; }
+    int size() const { return size_; }
+
+    const Kumipuyo* begin() const { return begin_; }
+    const Kumipuyo* end() const { return begin_ + size_; }
+
+    void dropFront()
+    {
+        DCHECK_GT(size_, 0);
+        ++begin_;
+        --size_;
+    }
+
+    KumipuyoSeqView subsequence(int begin, int n) const
+    {
+        DCHECK(0 <= begin && begin <= size_) << begin << ' ' << size_;
+        DCHECK(0 <= n && begin + n <= size_) << begin << ' ' << n << ' ' << size_;
+        return KumipuyoSeqView(begin_ + begin, n);
+    }
+    KumipuyoSeqView subsequence(int begin) const { return subsequence(begin, size_ - begin); }
+
+    // Copies the viewed kumipuyos.
+    KumipuyoSeq toKumipuyoSeq() const { return KumipuyoSeq(std::vector<Kumipuyo>(begin(), end())); }
+    std::string toString() const
+    {
+        std::string s;
+        for (const Kumipuyo& kp : *this) {
+            s += toChar(kp.axis);
+            s += toChar(kp.child);
+        }
+        return s;
+    }
+
+private:
+    const Kumipuyo* begin_;
+    int size_;
+};
+
+#endif // CORE_KUMIPUYO_SEQ_VIEW_H_
@@ -0,0 +1,66 @@
+#include "core/kumipuyo_seq_view.h"
+
+#include <gtest/gtest.h>
+
+TEST(KumipuyoSeqViewTest, fromKumipuyoSeq)
+{
+    KumipuyoSeq seq("RRBBYYGG");
+    KumipuyoSeqView view(seq);
+
+    EXPECT_EQ(4, view.size());
+    EXPECT_FALSE(view.isEmpty());
+    EXPECT_EQ(&seq.get(0), &view.get(0));
+    EXPECT_EQ(PuyoColor::BLUE, view.axis(1));
+    EXPECT_EQ(PuyoColor::GREEN, view.child(3));
+    EXPECT_EQ("RRBBYYGG", view.toString());
+    EXPECT_EQ(seq, view.toKumipuyoSeq());
+}
+
+TEST(KumipuyoSeqViewTest, empty)
+{
+    KumipuyoSeq seq;
+    KumipuyoSeqView view(seq);
+
+    EXPECT_TRUE(view.isEmpty());
+    EXPECT_EQ(0, view.size());
+    EXPECT_EQ("", view.toString());
+    EXPECT_TRUE(KumipuyoSeqView().isEmpty());
+}
+
+TEST(KumipuyoSeqViewTest, subsequence)
+{
+    KumipuyoSeq seq("RRBBYYGG");
+    KumipuyoSeqView view(seq);
+
+    EXPECT_EQ("BBYY", view.subsequence(1, 2).toString());
+    EXPECT_EQ("YYGG", view.subsequence(2).toString());
+    EXPECT_TRUE(view.subsequence(4).isEmpty());
+    EXPECT_EQ(seq.subsequence(1).toString(), view.subsequence(1).toString());
+
+    // No copy.
+    EXPECT_EQ(&seq.get(2), &view.subsequence(2).front());
+}
+
+TEST(KumipuyoSeqViewTest, dropFront)
+{
+    KumipuyoSeq seq("RRBBYY");
+    KumipuyoSeqView view(seq);
+
+    view.dropFront();
+    EXPECT_EQ("BBYY", view.toString());
+    view.dropFront();
+    view.dropFront();
+    EXPECT_TRUE(view.isEmpty());
+
+    // The original sequence is not changed.
+    EXPECT_EQ("RRBBYY", seq.toString());
+}
+
+TEST(KumipuyoSeqViewTest, singleKumipuyo)
+{
+    Kumipuyo kp(PuyoColor::RED, PuyoColor::BLUE);
+    KumipuyoSeqView view(kp);
+
+    EXPECT_EQ(1, view.size());
+    EXPECT_EQ(kp, view.front());
+}
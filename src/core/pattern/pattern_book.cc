@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <fstream>
 
+#include "base/instrumentation.h"
+
 using namespace std;
 
 namespace {
@@ -23,11 +25,23 @@ ColumnPuyoList diff(const CoreField& before, const BitField& after)
     return cpl;
 }
 
+// Returns the bits where each column is filled from the highest bit down to the bottom.
+FieldBits fillDown(FieldBits bits)
+{
+    __m128i m = bits;
+    m = _mm_or_si128(m, _mm_srli_epi16(m, 1));
+    m = _mm_or_si128(m, _mm_srli_epi16(m, 2));
+    m = _mm_or_si128(m, _mm_srli_epi16(m, 4));
+    m = _mm_or_si128(m, _mm_srli_epi16(m, 8));
+    return m;
+}
+
 } // namespace anonymous
 
 PatternBook::PatternBook() :
     root_(new PatternTree())
 {
+    compile();
 }
 
 PatternBook::~PatternBook()
@@ -146,9 +160,84 @@ bool PatternBook::loadFromValue(const toml::Value& patterns, bool ignoreDuplicat
         }
     }
 
+    compile();
     return true;
 }
 
+void PatternBook::compile()
+{
+    nodes_.clear();
+
+    // Lays out the nodes in breadth-first order.
+    vector<const PatternTree*> trees { root_.get() };
+    nodes_.emplace_back();
+    for (size_t i = 0; i < trees.size(); ++i) {
+        const PatternTree* tree = trees[i];
+        nodes_[i].childBegin = static_cast<int>(nodes_.size());
+        for (const auto& entry : tree->children_) {
+            CompiledNode node;
+            node.varBits = entry.first.varBits();
+            node.notBits = entry.first.notBits();
+            nodes_.push_back(node);
+            trees.push_back(entry.second.get());
+        }
+        nodes_[i].childEnd = static_cast<int>(nodes_.size());
+        if (tree->isLeaf())
+            nodes_[i].patternBookField = &tree->patternBookField();
+    }
+
+    // Summarizes the subtrees. A child always comes after its parent, so iterating
+    // in the reverse order visits the children first.
+    // A leaf fills its variables and iron. |mustFillBits| is filled by all the leaves in the subtree,
+    // and |mayFillBits| might be filled by some leaf.
+    vector<FieldBits> mustFillBits(nodes_.size());
+    vector<FieldBits> mayFillBits(nodes_.size());
+    for (int i = static_cast<int>(nodes_.size()) - 1; i >= 0; --i) {
+        CompiledNode& node = nodes_[i];
+
+        bool first = true;
+        FieldBits mustFill, mayFill, mustVar, must;
+        auto addLeaf = [&](const FieldBits& leafMustFill, const FieldBits& leafMayFill,
+                           const FieldBits& leafMustVar, const FieldBits& leafMust) {
+            if (first) {
+                mustFill = leafMustFill;
+                mustVar = leafMustVar;
+                must = leafMust;
+                first = false;
+            } else {
+                mustFill = mustFill & leafMustFill;
+                mustVar = mustVar & leafMustVar;
+                must = must & leafMust;
+            }
+            mayFill.setAll(leafMayFill);
+        };
+
+        if (node.patternBookField) {
+            const PatternBookField& pbf = *node.patternBookField;
+            addLeaf(pbf.ironBits(), pbf.ironBits(), FieldBits(), pbf.mustBits());
+        }
+        for (int c = node.childBegin; c < node.childEnd; ++c)
+            addLeaf(mustFillBits[c], mayFillBits[c], nodes_[c].mustVarBits, nodes_[c].mustBits);
+        // Only the root of an empty book doesn't have any leaf.
+        if (first) {
+            DCHECK_EQ(0, i);
+            continue;
+        }
+
+        mustFill.setAll(node.varBits);
+        mayFill.setAll(node.varBits);
+        mustVar.setAll(node.varBits);
+
+        node.mustVarBits = mustVar;
+        node.mustBits = must;
+        // The positions below a filled position must have a puyo. Unless some leaf fills it,
+        // the current field should have it.
+        node.existingBits = fillDown(mustFill.maskedField13()).maskedField13().notmask(mayFill);
+        mustFillBits[i] = mustFill;
+        mayFillBits[i] = mayFill;
+    }
+}
+
 void PatternBook::complement(const CoreField& originalField,
                                 const PatternBook::ComplementCallback& callback) const
 {
@@ -159,7 +248,8 @@ void PatternBook::complement(const CoreField& originalField,
                                 int allowedNumUnusedVariables,
                                 const ComplementCallback& callback) const
 {
-    iterate(*root_, originalField, originalField.bitField(), FieldBits(), allowedNumUnusedVariables, 0, callback);
+    INSTRUMENT_SCOPE("PatternBook::complement");
+    iterate(0, originalField, originalField.bitField(), FieldBits(), allowedNumUnusedVariables, 0, callback);
 }
 
 void PatternBook::complement(const CoreField& originalField,
@@ -167,17 +257,19 @@ void PatternBook::complement(const CoreField& originalField,
                              int allowedNumUnusedVariables,
                              const ComplementCallback& callback) const
 {
-    for (const auto& entry : root_->children_) {
-        if (entry.first.varBits() != ignitionBits)
+    INSTRUMENT_SCOPE("PatternBook::complement");
+    const CompiledNode& root = nodes_[0];
+    for (int i = root.childBegin; i < root.childEnd; ++i) {
+        if (nodes_[i].varBits != ignitionBits)
             continue;
         // TODO(mayah): Probably, we don't need to check notBits.
-        iterate(*entry.second, originalField, originalField.bitField(),
-                entry.first.varBits() & ignitionBits,
+        iterate(i, originalField, originalField.bitField(),
+                nodes_[i].varBits & ignitionBits,
                 allowedNumUnusedVariables, 0, callback);
     }
 }
 
-void PatternBook::iterate(const PatternTree& tree,
+void PatternBook::iterate(int nodeIndex,
                           const CoreField& originalField,
                           const BitField& currentField,
                           const FieldBits& matchedBits,
@@ -185,66 +277,87 @@ void PatternBook::iterate(const PatternTree& tree,
                           int numUnusedVariables,
                           const ComplementCallback& callback) const
 {
-    if (tree.isLeaf()) {
-        if ((tree.patternBookField().mustBits() & originalField.bitField().field13Bits()) == tree.patternBookField().mustBits()) {
+    const CompiledNode& node = nodes_[nodeIndex];
+    const FieldBits originalBits = originalField.bitField().field13Bits();
+
+    if (node.patternBookField) {
+        const PatternBookField& pbf = *node.patternBookField;
+        if ((pbf.mustBits() & originalBits) == pbf.mustBits()) {
             BitField bf(currentField);
-            bf.setColorAllIfEmpty(tree.patternBookField().ironBits(), PuyoColor::IRON);
+            bf.setColorAllIfEmpty(pbf.ironBits(), PuyoColor::IRON);
             if (!bf.hasFloatingPuyo()) {
                 CoreField cf(bf);
-                callback(std::move(cf), diff(originalField, bf), numUnusedVariables, matchedBits, tree.patternBookField());
+                callback(std::move(cf), diff(originalField, bf), numUnusedVariables, matchedBits, pbf);
             }
         }
     }
 
-    FieldBits ojamaBits = currentField.bits(PuyoColor::OJAMA);
-    for (const auto& entry : tree.children_) {
-        PuyoColor foundColor = PuyoColor::EMPTY;
+    if (node.childBegin == node.childEnd)
+        return;
+
+    const FieldBits currentBits = currentField.field13Bits();
+    const FieldBits ojamaBits = currentField.bits(PuyoColor::OJAMA);
+    const FieldBits colorBits[NUM_NORMAL_PUYO_COLORS] = {
+        currentField.bits(NORMAL_PUYO_COLORS[0]),
+        currentField.bits(NORMAL_PUYO_COLORS[1]),
+        currentField.bits(NORMAL_PUYO_COLORS[2]),
+        currentField.bits(NORMAL_PUYO_COLORS[3]),
+    };
+
+    for (int i = node.childBegin; i < node.childEnd; ++i) {
+        const CompiledNode& child = nodes_[i];
+
+        // Prunes the subtree where no leaf can match.
+        if (!child.mustVarBits.testz(ojamaBits))
+            continue;
+        if (!child.existingBits.notmask(currentBits).isEmpty())
+            continue;
+        if (!child.mustBits.notmask(originalBits).isEmpty())
+            continue;
+
+        int foundIndex = -1;
         bool ok = true;
         FieldBits newMatchedBits(matchedBits);
-        for (PuyoColor c : NORMAL_PUYO_COLORS) {
-            FieldBits matched = entry.first.varBits() & currentField.bits(c);
+        for (int j = 0; j < NUM_NORMAL_PUYO_COLORS; ++j) {
+            FieldBits matched = child.varBits & colorBits[j];
             if (matched.isEmpty())
                 continue;
-            if (foundColor != PuyoColor::EMPTY) {
+            if (foundIndex >= 0) {
                 ok = false;
                 break;
             }
 
             newMatchedBits.setAll(matched);
-            foundColor = c;
+            foundIndex = j;
         }
         if (!ok)
             continue;
 
-        // Check ojama.
-        if (!(entry.first.varBits() & ojamaBits).isEmpty())
-            continue;
-
         bool unusedVariableUsed = false;
-        if (foundColor == PuyoColor::EMPTY) {
+        if (foundIndex < 0) {
             if (allowedNumUnusedVariables <= numUnusedVariables)
                 continue;
 
             // TODO(mayah): Should check all colors?
-            for (PuyoColor c : NORMAL_PUYO_COLORS) {
-                if ((entry.first.notBits() & currentField.bits(c)).isEmpty()) {
-                    foundColor = c;
+            for (int j = 0; j < NUM_NORMAL_PUYO_COLORS; ++j) {
+                if (child.notBits.testz(colorBits[j])) {
+                    foundIndex = j;
                     break;
                 }
             }
 
-            if (foundColor == PuyoColor::EMPTY)
+            if (foundIndex < 0)
                 continue;
 
             unusedVariableUsed = true;
         } else {
             // Check not bits.
-            if (!(entry.first.notBits() & currentField.bits(foundColor)).isEmpty())
+            if (!child.notBits.testz(colorBits[foundIndex]))
                 continue;
         }
 
         BitField bf(currentField);
-        bf.setColorAll(entry.first.varBits(), foundColor);
-        iterate(*entry.second, originalField, bf, newMatchedBits, allowedNumUnusedVariables, unusedVariableUsed ? numUnusedVariables + 1 : numUnusedVariables, callback);
+        bf.setColorAll(child.varBits, NORMAL_PUYO_COLORS[foundIndex]);
+        iterate(i, originalField, bf, newMatchedBits, allowedNumUnusedVariables, unusedVariableUsed ? numUnusedVariables + 1 : numUnusedVariables, callback);
     }
 }
@@ -38,7 +38,34 @@ public:
     void complement(const CoreField&, const FieldBits& ignitionBits, int allowedNumUnusedVariables, const ComplementCallback&) const;
 
 private:
-    void iterate(const PatternTree&,
+    // CompiledNode is a node of PatternTree flattened into |nodes_|.
+    // The nodes are stored in breadth-first order, so the children of a node are contiguous.
+    struct CompiledNode {
+        // The variable of the edge from the parent.
+        FieldBits varBits;
+        FieldBits notBits;
+
+        // The following bits summarize all the leaves in the subtree, considering the variables
+        // of the edges in the subtree (including the edge from the parent). They're used to
+        // prune the subtree before matching colors.
+        // The variables that all the leaves use. They must not be OJAMA.
+        FieldBits mustVarBits;
+        // The positions that must have a puyo in the current field. Otherwise, all the leaves
+        // would make a floating puyo.
+        FieldBits existingBits;
+        // The positions that must have a puyo in the original field (precondition).
+        FieldBits mustBits;
+
+        int childBegin = 0;
+        int childEnd = 0;
+        // nullptr if not leaf.
+        const PatternBookField* patternBookField = nullptr;
+    };
+
+    // Flattens |root_| into |nodes_|.
+    void compile();
+
+    void iterate(int nodeIndex,
                  const CoreField& oridinalField,
                  const BitField& currentField,
                  const FieldBits& matchedBits,
@@ -47,6 +74,7 @@ private:
                  const ComplementCallback&) const;
 
     std::unique_ptr<PatternTree> root_;
+    std::vector<CompiledNode> nodes_;
 };
 
 #endif // CPU_MAYAH_PATTERN_BOOK_H_
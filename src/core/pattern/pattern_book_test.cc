@@ -460,6 +460,20 @@ name = "GTR"
     testComplementWithIgnitionBits(BOOK, original, ignitionBits, expected, ARRAY_SIZE(expected));
 }
 
+TEST(PatternBookTest, emptyBook)
+{
+    PatternBook patternBook;
+    CoreField original(
+        "RRB..."
+        "BBY...");
+
+    bool found = false;
+    patternBook.complement(original, 2, [&](CoreField&&, const ColumnPuyoList&, int, const FieldBits&, const PatternBookField&) {
+        found = true;
+    });
+    EXPECT_FALSE(found);
+}
+
 TEST(PatternBookTest, unmatch1)
 {
     static const char BOOK[] = R"(
@@ -4,7 +4,7 @@
 #include <iostream>
 #include <sstream>
 
-#include "core/kumipuyo_seq.h"
+#include "base/instrumentation.h"
 #include "core/puyo_controller.h"
 
 using namespace std;
@@ -72,7 +72,7 @@ std::string RefPlan::decisionText() const
 
 template<typename Callback>
 void iterateAvailablePlansInternal(const CoreField& field,
-                                   const KumipuyoSeq& kumipuyoSeq,
+                                   KumipuyoSeqView kumipuyoSeq,
                                    std::vector<Decision>& decisions,
                                    int currentDepth,
                                    int maxDepth,
@@ -93,9 +93,10 @@ void iterateAvailablePlansInternal(const CoreField& field,
         n = 10;
     }
 
+    const unsigned int reachable = PuyoController::reachableDecisions(field);
     for (int j = 0; j < 22; j++) {
         const Decision& decision = DECISIONS[j];
-        if (!PuyoController::isReachable(field, decision))
+        if (!(reachable & (1U << PuyoController::decisionIndex(decision))))
             continue;
 
         bool isChigiri = field.isChigiriDecision(decision);
@@ -114,6 +115,7 @@ void iterateAvailablePlansInternal(const CoreField& field,
             CoreField nextField(field);
             if (!nextField.dropKumipuyo(decision, kumipuyo))
                 continue;
+            INSTRUMENT_COUNT("Plan::nodes", 1);
 
             bool shouldFire = nextField.rensaWillOccurWhenLastDecisionIs(decision);
             if (!shouldFire && !nextField.isEmpty(3, 12))
@@ -132,10 +134,12 @@ void iterateAvailablePlansInternal(const CoreField& field,
 
 // static
 void Plan::iterateAvailablePlans(const CoreField& field,
-                                 const KumipuyoSeq& kumipuyoSeq,
+                                 KumipuyoSeqView kumipuyoSeq,
                                  int maxDepth,
                                  const Plan::IterationCallback& callback)
 {
+    INSTRUMENT_SCOPE("Plan::iterateAvailablePlans");
+
     std::vector<Decision> decisions;
     decisions.reserve(maxDepth);
 
@@ -164,10 +168,12 @@ void Plan::iterateAvailablePlans(const CoreField& field,
 
 // static
 void Plan::iterateAvailablePlansWithoutFiring(const CoreField& field,
-                                              const KumipuyoSeq& kumipuyoSeq,
+                                              KumipuyoSeqView kumipuyoSeq,
                                               int maxDepth,
                                               const Plan::RensaIterationCallback& callback)
 {
+    INSTRUMENT_SCOPE("Plan::iterateAvailablePlansWithoutFiring");
+
     std::vector<Decision> decisions;
     decisions.reserve(maxDepth);
     iterateAvailablePlansInternal(field, kumipuyoSeq, decisions, 0, maxDepth, 0, 0, callback);
@@ -8,9 +8,9 @@
 #include "base/noncopyable.h"
 #include "core/core_field.h"
 #include "core/decision.h"
+#include "core/kumipuyo_seq_view.h"
 #include "core/rensa_result.h"
 
-class KumipuyoSeq;
 class RefPlan;
 
 class Plan {
@@ -28,11 +28,11 @@ public:
 
     typedef std::function<void (const RefPlan&)> IterationCallback;
     // if |kumipuyos.size()| < |depth|, we will add extra kumipuyo.
-    static void iterateAvailablePlans(const CoreField&, const KumipuyoSeq&, int depth, const IterationCallback&);
+    static void iterateAvailablePlans(const CoreField&, KumipuyoSeqView, int depth, const IterationCallback&);
 
     typedef std::function<void (const CoreField&, const std::vector<Decision>&,
                                 int numChigiri, int framesToIgnite, int lastDropFrames, bool shouldFire)> RensaIterationCallback;
-    static void iterateAvailablePlansWithoutFiring(const CoreField&, const KumipuyoSeq&, int depth, const RensaIterationCallback&);
+    static void iterateAvailablePlansWithoutFiring(const CoreField&, KumipuyoSeqView, int depth, const RensaIterationCallback&);
 
     const CoreField& field() const { return field_; }
 
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 #include "core/core_field.h"
 #include "core/kumipuyo_seq.h"
@@ -21,7 +22,7 @@ TEST(PlanPerformanceTest, Empty44)
         Plan::iterateAvailablePlans(f, seq, 4, [](const RefPlan&){});
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(PlanPerformanceTest, Filled44)
@@ -45,7 +46,7 @@ TEST(PlanPerformanceTest, Filled44)
         Plan::iterateAvailablePlans(f, seq, 4, [](const RefPlan&){});
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(PlanPerformanceTest, Empty23)
@@ -60,7 +61,7 @@ TEST(PlanPerformanceTest, Empty23)
         Plan::iterateAvailablePlans(f, seq, 3, [](const RefPlan&){});
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(PlanPerformanceTest, Filled23)
@@ -84,7 +85,7 @@ TEST(PlanPerformanceTest, Filled23)
         Plan::iterateAvailablePlans(f, seq, 3, [](const RefPlan&){});
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(PlanPerformanceTest, Empty24)
@@ -99,7 +100,7 @@ TEST(PlanPerformanceTest, Empty24)
         Plan::iterateAvailablePlans(f, seq, 4, [](const RefPlan&){});
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(PlanPerformanceTest, Filled24)
@@ -123,5 +124,5 @@ TEST(PlanPerformanceTest, Filled24)
         Plan::iterateAvailablePlans(f, seq, 4, [](const RefPlan&){});
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
@@ -1,10 +1,11 @@
 #include "core/probability/column_puyo_list_probability.h"
 
-#include <fstream>
 #include <limits>
-#include <iostream>
+#include <memory>
+#include <unordered_map>
 
 #include "base/strings.h"
+#include "core/color_permutation.h"
 #include "core/kumipuyo.h"
 #include "core/probability/puyo_set_probability.h"
 
@@ -31,6 +32,12 @@ static double necessaryPuyosReverse(const ColumnPuyoList& cpl, unordered_map<Col
     //
     // s = (1 + \sum p_i s_i) / \sum p_i
 
+    // The result doesn't depend on the actual colors, since ALL_KUMIPUYO_KINDS is
+    // symmetric under color permutation. So |m| only has the canonical ColumnPuyoLists.
+    ColumnPuyoList canonical(cpl);
+    if (!canonical.canonicalize().isIdentity())
+        return necessaryPuyosReverse(canonical, m);
+
     auto it = m->find(cpl);
     if (it != m->end())
         return it->second;
@@ -129,124 +136,139 @@ static double necessaryPuyosReverse(const ColumnPuyoList& cpl, unordered_map<Col
     return p;
 }
 
-static void iter(int n, int leftX, ColumnPuyoList* cpl, unordered_map<ColumnPuyoList, double>* m)
+// Computes the values of ColumnPuyoList visited from |cpl|, and puts them into |vs|.
+// Since the values are computed for the reversed ColumnPuyoList, the index of |vs| is
+// the table index of the reversed |cpl|.
+static void iter(int n, int leftX, ColumnPuyoList* cpl, unordered_map<ColumnPuyoList, double>* m, vector<double>* vs)
 {
-    necessaryPuyosReverse(*cpl, m);
-
-    for (int x = leftX; x <= 6; ++x) {
-        for (PuyoColor c : NORMAL_PUYO_COLORS) {
-            cpl->add(x, c);
-            if (n > 0)
-                iter(n - 1, x, cpl, m);
-            cpl->removeTopFrom(x);
-        }
+    ColumnPuyoList reversed;
+    for (int x = 1; x <= 6; ++x) {
+        for (int i = cpl->sizeOn(x) - 1; i >= 0; --i)
+            reversed.add(x, cpl->get(x, i));
     }
-}
 
-static void iterForSave(int n, int leftX, ColumnPuyoList* cpl, const unordered_map<ColumnPuyoList, double>& m,
-                        vector<double>* vs, size_t* index)
-{
-    auto it = m.find(*cpl);
-    CHECK(it != m.end()) << cpl->toString();
-    (*vs)[*index] = it->second;
-    *index += 1;
+    int index = ColumnPuyoListProbability::tableIndex(reversed);
+    CHECK_GE(index, 0) << reversed.toString();
+    (*vs)[index] = necessaryPuyosReverse(*cpl, m);
 
     for (int x = leftX; x <= 6; ++x) {
         for (PuyoColor c : NORMAL_PUYO_COLORS) {
             cpl->add(x, c);
             if (n > 0)
-                iterForSave(n - 1, x, cpl, m, vs, index);
+                iter(n - 1, x, cpl, m, vs);
             cpl->removeTopFrom(x);
         }
     }
 }
 
-static void iterForLoad(int n, int leftX, ColumnPuyoList* cpl, unordered_map<ColumnPuyoList, double>* m,
-                        const vector<double>& vs, size_t* index)
-{
-    (*m)[*cpl] = vs[*index];
-    *index += 1;
-
-    for (int x = leftX; x <= 6; ++x) {
-        for (PuyoColor c : NORMAL_PUYO_COLORS) {
-            cpl->add(x, c);
-            if (n > 0)
-                iterForLoad(n - 1, x, cpl, m, vs, index);
-            cpl->removeTopFrom(x);
+namespace {
+
+// The table is ordered by the preorder of the following enumeration, which starts from
+// the empty ColumnPuyoList with n = MAX_TABLE_PUYOS and leftX = 1:
+//   visit(cpl); for x in [leftX, 6], c in NORMAL_PUYO_COLORS: visit(cpl + (x, c)) with n - 1 and x if n > 0.
+// SubtreeSize::size[n][x] is the number of ColumnPuyoList visited from a node having n and x.
+struct SubtreeSize {
+    SubtreeSize()
+    {
+        for (int n = 0; n <= ColumnPuyoListProbability::MAX_TABLE_PUYOS; ++n) {
+            for (int leftX = 1; leftX <= 6; ++leftX) {
+                size[n][leftX] = 1;
+                if (n == 0)
+                    continue;
+                for (int x = leftX; x <= 6; ++x)
+                    size[n][leftX] += NUM_NORMAL_PUYO_COLORS * size[n - 1][x];
+            }
         }
     }
-}
 
-ColumnPuyoListProbability::ColumnPuyoListProbability()
+    int size[ColumnPuyoListProbability::MAX_TABLE_PUYOS + 1][7];
+};
+
+const SubtreeSize& subtreeSize()
 {
-    const int N = 6;
-    const string filename = "column-puyo-possibility-" + std::to_string(N) + ".dat";
+    static const SubtreeSize s;
+    return s;
+}
 
-    m_.reserve(1000000);
+}
 
-    // try to read from the file.
-    ifstream ifs(filename);
-    if (ifs) {
-        ifstream::pos_type begin = ifs.tellg();
-        ifs.seekg(0, fstream::end);
-        ifstream::pos_type end = ifs.tellg();
-        ifs.seekg(0, fstream::beg);
-        ifs.clear();
+const char ColumnPuyoListProbability::TABLE_NAME[] = "column_puyo_list_probability.tbl";
+const char ColumnPuyoListProbability::TABLE_MAGIC[] = "PUYOCPLP";
 
-        size_t size = end - begin;
-        vector<double> vs(size / sizeof(double));
-        ifs.read(reinterpret_cast<char*>(vs.data()), size);
+ColumnPuyoListProbability::ColumnPuyoListProbability(const string& filename)
+{
+    if (table_.load(filename, TABLE_MAGIC, tableSize()))
+        return;
 
-        size_t index = 0;
-        ColumnPuyoList initial;
-        iterForLoad(N, 1, &initial, &m_, vs, &index);
+    LOG(INFO) << filename << " is not available. Computing ColumnPuyoListProbability."
+              << " Run make_probability_tables to make it faster.";
+    table_.reset(computeTable());
+}
 
-        return;
-    }
+// static
+const ColumnPuyoListProbability* ColumnPuyoListProbability::instanceSlow()
+{
+    static std::unique_ptr<ColumnPuyoListProbability> s_instance(
+        new ColumnPuyoListProbability(ProbabilityTable::defaultPath(TABLE_NAME)));
+    return s_instance.get();
+}
 
+// static
+vector<double> ColumnPuyoListProbability::computeTable()
+{
     unordered_map<ColumnPuyoList, double> reverseMap;
-    reverseMap.reserve(1000000);
     ColumnPuyoList initial;
     reverseMap[initial] = 0.0;
-    iter(N, 1, &initial, &reverseMap);
-
-    CHECK(initial.size() == 0);
-
-    //
-    for (const auto& entry : reverseMap) {
-        ColumnPuyoList cpl;
-        for (int x = 1; x <= 6; ++x) {
-            for (int i = entry.first.sizeOn(x) - 1; i >= 0; --i) {
-                cpl.add(x, entry.first.get(x, i));
-            }
-        }
-
-        m_[cpl] = entry.second;
-    }
 
-    vector<double> vs(m_.size());
-    size_t index = 0;
-    iterForSave(N, 1, &initial, m_, &vs, &index);
+    // necessaryPuyosReverse computes the values for reversed ColumnPuyoList.
+    vector<double> vs(tableSize());
+    iter(MAX_TABLE_PUYOS, 1, &initial, &reverseMap, &vs);
     CHECK(initial.size() == 0);
 
-    CHECK_EQ(vs.size(), index);
+    return vs;
+}
 
-    ofstream ofs(filename);
-    ofs.write(reinterpret_cast<char*>(vs.data()), sizeof(double) * vs.size());
+// static
+size_t ColumnPuyoListProbability::tableSize()
+{
+    return subtreeSize().size[MAX_TABLE_PUYOS][1];
 }
 
 // static
-const ColumnPuyoListProbability* ColumnPuyoListProbability::instanceSlow()
+int ColumnPuyoListProbability::tableIndex(const ColumnPuyoList& cpl)
 {
-    static std::unique_ptr<ColumnPuyoListProbability> s_instance(new ColumnPuyoListProbability);
-    return s_instance.get();
+    if (cpl.size() > MAX_TABLE_PUYOS)
+        return -1;
+
+    const SubtreeSize& ss = subtreeSize();
+    int index = 0;
+    int n = MAX_TABLE_PUYOS;
+    int leftX = 1;
+    for (int x = 1; x <= 6; ++x) {
+        for (int i = 0; i < cpl.sizeOn(x); ++i) {
+            if (!isNormalColor(cpl.get(x, i)))
+                return -1;
+            int c = normalColorIndex(cpl.get(x, i));
+
+            // Skip the current node and its children before (x, c).
+            index += 1;
+            for (int xx = leftX; xx < x; ++xx)
+                index += NUM_NORMAL_PUYO_COLORS * ss.size[n - 1][xx];
+            index += c * ss.size[n - 1][x];
+
+            n -= 1;
+            leftX = x;
+        }
+    }
+
+    return index;
 }
 
 double ColumnPuyoListProbability::necessaryKumipuyos(const ColumnPuyoList& cpl) const
 {
-    auto it = m_.find(cpl);
-    if (it != m_.end())
-        return it->second;
+    int index = tableIndex(cpl);
+    if (index >= 0)
+        return table_.values()[index];
 
     // TODO(mayah): This is not accurate, but better than returning infinity.
     PuyoSet ps(cpl);
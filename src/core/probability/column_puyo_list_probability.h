@@ -1,25 +1,43 @@
 #ifndef CORE_PROBABILITY_COLUMN_PUYO_LIST_PROBABILITY_H_
 #define CORE_PROBABILITY_COLUMN_PUYO_LIST_PROBABILITY_H_
 
-#include <memory>
-#include <unordered_map>
+#include <string>
+#include <vector>
 
 #include "base/noncopyable.h"
 #include "core/column_puyo_list.h"
+#include "core/probability/probability_table.h"
 
 class ColumnPuyoListProbability : noncopyable, nonmovable {
 public:
-    // Taking ColumnPuyoListProbability instance. This might be slow.
+    // The table has the values of ColumnPuyoList having at most this number of puyos.
+    static const int MAX_TABLE_PUYOS = 6;
+    static const char TABLE_NAME[];
+    static const char TABLE_MAGIC[];
+
+    // Taking ColumnPuyoListProbability instance. This is fast if the table made by
+    // make_probability_tables exists. Otherwise, the table is computed, and it's slow.
     static const ColumnPuyoListProbability* instanceSlow();
 
+    // Computes the table. The i-th value is for the ColumnPuyoList whose tableIndex() is i.
+    static std::vector<double> computeTable();
+    static size_t tableSize();
+    // Returns the index of |cpl| in the table, or -1 if |cpl| is not in the table.
+    // This is a minimal perfect hash of ColumnPuyoList having at most MAX_TABLE_PUYOS
+    // normal color puyos.
+    static int tableIndex(const ColumnPuyoList& cpl);
+
     // Returns the expected numbef of kumipuyos to fill ColumnPuyoList.
-    // NOTE: currently this is not thread-safe.
+    // This is thread-safe.
     double necessaryKumipuyos(const ColumnPuyoList&) const;
 
+    // Returns true if the table is mapped from a file.
+    bool isMapped() const { return table_.isMapped(); }
+
 private:
-    ColumnPuyoListProbability();
+    explicit ColumnPuyoListProbability(const std::string& filename);
 
-    std::unordered_map<ColumnPuyoList, double> m_;
+    ProbabilityTable table_;
 };
 
 #endif // CORE_PROBABILITY_COLUMN_PUYO_LIST_PROBABILITY_H_
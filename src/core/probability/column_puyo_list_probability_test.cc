@@ -1,7 +1,12 @@
 #include "core/probability/column_puyo_list_probability.h"
 
+#include <functional>
+#include <set>
+
 #include <gtest/gtest.h>
 
+using namespace std;
+
 TEST(ColumnPuyoListProbabilityTest, necessaryPuyosWithColumnPuyoList)
 {
     const ColumnPuyoListProbability* instance = ColumnPuyoListProbability::instanceSlow();
@@ -15,3 +20,54 @@ TEST(ColumnPuyoListProbabilityTest, necessaryPuyosWithColumnPuyoList)
     cpl.add(2, PuyoColor::RED);
     EXPECT_DOUBLE_EQ(13.0 * 16 / 49, instance->necessaryKumipuyos(cpl));
 }
+
+TEST(ColumnPuyoListProbabilityTest, tableIndex)
+{
+    EXPECT_EQ(0, ColumnPuyoListProbability::tableIndex(ColumnPuyoList()));
+
+    ColumnPuyoList cpl;
+    cpl.add(1, PuyoColor::RED);
+    EXPECT_EQ(1, ColumnPuyoListProbability::tableIndex(cpl));
+
+    // The last entry in the table.
+    cpl.clear();
+    cpl.add(6, NORMAL_PUYO_COLORS[NUM_NORMAL_PUYO_COLORS - 1], ColumnPuyoListProbability::MAX_TABLE_PUYOS);
+    EXPECT_EQ(static_cast<int>(ColumnPuyoListProbability::tableSize()) - 1,
+              ColumnPuyoListProbability::tableIndex(cpl));
+
+    // Too many puyos.
+    cpl.add(1, PuyoColor::RED);
+    EXPECT_EQ(-1, ColumnPuyoListProbability::tableIndex(cpl));
+
+    // Not a normal color.
+    cpl.clear();
+    cpl.add(3, PuyoColor::OJAMA);
+    EXPECT_EQ(-1, ColumnPuyoListProbability::tableIndex(cpl));
+}
+
+TEST(ColumnPuyoListProbabilityTest, tableIndexIsPerfectHash)
+{
+    // Enumerates all ColumnPuyoList having at most 3 puyos in the columns 2-4.
+    set<int> indices;
+    int count = 0;
+    function<void (ColumnPuyoList*, int, int)> iter = [&](ColumnPuyoList* cpl, int n, int leftX) {
+        int index = ColumnPuyoListProbability::tableIndex(*cpl);
+        EXPECT_LE(0, index);
+        EXPECT_GT(static_cast<int>(ColumnPuyoListProbability::tableSize()), index);
+        indices.insert(index);
+        ++count;
+        if (n == 0)
+            return;
+        for (int x = leftX; x <= 4; ++x) {
+            for (PuyoColor c : NORMAL_PUYO_COLORS) {
+                cpl->add(x, c);
+                iter(cpl, n - 1, x);
+                cpl->removeTopFrom(x);
+            }
+        }
+    };
+
+    ColumnPuyoList cpl;
+    iter(&cpl, 3, 2);
+    EXPECT_EQ(count, static_cast<int>(indices.size()));
+}
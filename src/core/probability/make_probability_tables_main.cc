@@ -0,0 +1,55 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+
+#include "base/file/path.h"
+#include "core/probability/column_puyo_list_probability.h"
+#include "core/probability/probability_table.h"
+#include "core/probability/puyo_set_probability.h"
+
+DEFINE_string(output_dir, "", "The directory to write the tables. <--data_dir>/probability is used if empty.");
+
+using namespace std;
+
+static bool save(const string& dir, const char* name, const char* magic, const vector<double>& values)
+{
+    string filename = file::joinPath(dir, name);
+    if (!ProbabilityTable::save(filename, magic, values)) {
+        LOG(ERROR) << "failed to write " << filename;
+        return false;
+    }
+
+    cout << "wrote " << filename << " (" << values.size() << " values)" << endl;
+    return true;
+}
+
+// Makes the tables of ColumnPuyoListProbability and PuyoSetProbability.
+// The programs map them instead of computing the tables on startup.
+int main(int argc, char* argv[])
+{
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    google::InitGoogleLogging(argv[0]);
+#if !defined(_MSC_VER)
+    google::InstallFailureSignalHandler();
+#endif
+
+    string dir = FLAGS_output_dir;
+    if (dir.empty())
+        dir = file::dirname(ProbabilityTable::defaultPath(ColumnPuyoListProbability::TABLE_NAME));
+    if (!file::isDirectory(dir)) {
+        LOG(ERROR) << dir << " is not a directory. Create it or specify --output_dir.";
+        return 1;
+    }
+
+    if (!save(dir, PuyoSetProbability::TABLE_NAME, PuyoSetProbability::TABLE_MAGIC,
+              PuyoSetProbability::computeTable()))
+        return 1;
+    if (!save(dir, ColumnPuyoListProbability::TABLE_NAME, ColumnPuyoListProbability::TABLE_MAGIC,
+              ColumnPuyoListProbability::computeTable()))
+        return 1;
+
+    return 0;
+}
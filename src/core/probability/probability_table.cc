@@ -0,0 +1,87 @@
+#include "core/probability/probability_table.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+
+#include "base/file/path.h"
+
+DECLARE_string(data_dir);
+
+using namespace std;
+
+namespace {
+
+const uint32_t TABLE_VERSION = 1;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t numValues;
+};
+
+static_assert(sizeof(Header) % sizeof(double) == 0, "values should be aligned");
+
+}
+
+// static
+string ProbabilityTable::defaultPath(const string& name)
+{
+    return file::joinPath(FLAGS_data_dir, "probability", name);
+}
+
+// static
+bool ProbabilityTable::save(const string& filename, const char* magic, const vector<double>& values)
+{
+    Header header {};
+    memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = TABLE_VERSION;
+    header.numValues = values.size();
+
+    ofstream ofs(filename, ios::out | ios::binary);
+    if (!ofs)
+        return false;
+    if (!ofs.write(reinterpret_cast<const char*>(&header), sizeof(header)))
+        return false;
+    if (!ofs.write(reinterpret_cast<const char*>(values.data()), sizeof(double) * values.size()))
+        return false;
+    return true;
+}
+
+bool ProbabilityTable::load(const string& filename, const char* magic, size_t numValues)
+{
+    if (!file_.open(filename))
+        return false;
+
+    Header header;
+    if (file_.size() != sizeof(header) + sizeof(double) * numValues) {
+        LOG(WARNING) << filename << " has unexpected size: " << file_.size();
+        file_.close();
+        return false;
+    }
+
+    memcpy(&header, file_.data(), sizeof(header));
+    if (strncmp(header.magic, magic, sizeof(header.magic)) != 0 ||
+        header.version != TABLE_VERSION || header.numValues != numValues) {
+        LOG(WARNING) << filename << " is not a valid table: version=" << header.version
+                     << " numValues=" << header.numValues;
+        file_.close();
+        return false;
+    }
+
+    ownedValues_.clear();
+    values_ = reinterpret_cast<const double*>(file_.data() + sizeof(header));
+    size_ = numValues;
+    return true;
+}
+
+void ProbabilityTable::reset(vector<double> values)
+{
+    file_.close();
+    ownedValues_ = std::move(values);
+    values_ = ownedValues_.data();
+    size_ = ownedValues_.size();
+}
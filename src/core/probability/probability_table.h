@@ -0,0 +1,42 @@
+#ifndef CORE_PROBABILITY_PROBABILITY_TABLE_H_
+#define CORE_PROBABILITY_PROBABILITY_TABLE_H_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "base/file/mapped_file.h"
+#include "base/noncopyable.h"
+
+// ProbabilityTable is a read-only array of doubles, which is either mapped from
+// a file made by make_probability_tables, or computed in memory.
+//
+// The file is a header (8 bytes magic, uint32 version, uint32 the number of values)
+// followed by the values in the native byte order.
+class ProbabilityTable : noncopyable {
+public:
+    // Returns the default path of the table |name|, i.e. <--data_dir>/probability/<name>.
+    static std::string defaultPath(const std::string& name);
+
+    // Writes |values| to |filename|. Returns false if failed.
+    // |magic| must have at least 8 bytes, e.g. a literal of 7 or 8 characters.
+    static bool save(const std::string& filename, const char* magic, const std::vector<double>& values);
+
+    // Maps |filename|. Returns false if the file doesn't exist, or it is not a table
+    // of |magic| having |numValues| values.
+    bool load(const std::string& filename, const char* magic, size_t numValues);
+    // Uses |values| instead of a file.
+    void reset(std::vector<double> values);
+
+    const double* values() const { return values_; }
+    size_t size() const { return size_; }
+    bool isMapped() const { return file_.isOpen(); }
+
+private:
+    file::MappedFile file_;
+    std::vector<double> ownedValues_;
+    const double* values_ = nullptr;
+    size_t size_ = 0;
+};
+
+#endif // CORE_PROBABILITY_PROBABILITY_TABLE_H_
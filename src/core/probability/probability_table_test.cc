@@ -0,0 +1,66 @@
+#include "core/probability/probability_table.h"
+
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "base/file/path.h"
+
+using namespace std;
+
+namespace {
+
+string tempFilename()
+{
+    char buf[] = "/tmp/probability_table_test_XXXXXX";
+    int fd = mkstemp(buf);
+    CHECK_GE(fd, 0);
+    close(fd);
+    return buf;
+}
+
+}
+
+TEST(ProbabilityTableTest, saveAndLoad)
+{
+    string filename = tempFilename();
+    vector<double> values { 0.0, 0.25, 1.5, 1e9 };
+    ASSERT_TRUE(ProbabilityTable::save(filename, "TESTTBL", values));
+
+    ProbabilityTable table;
+    ASSERT_TRUE(table.load(filename, "TESTTBL", values.size()));
+    EXPECT_TRUE(table.isMapped());
+    ASSERT_EQ(values.size(), table.size());
+    for (size_t i = 0; i < values.size(); ++i)
+        EXPECT_EQ(values[i], table.values()[i]);
+
+    EXPECT_TRUE(file::remove(filename));
+}
+
+TEST(ProbabilityTableTest, loadInvalidTable)
+{
+    string filename = tempFilename();
+    ASSERT_TRUE(ProbabilityTable::save(filename, "TESTTBL", vector<double> { 1.0, 2.0 }));
+
+    ProbabilityTable table;
+    EXPECT_FALSE(table.load(filename, "OTHERTBL", 2));
+    EXPECT_FALSE(table.load(filename, "TESTTBL", 3));
+    EXPECT_FALSE(table.load(filename + ".notfound", "TESTTBL", 2));
+    EXPECT_FALSE(table.isMapped());
+
+    EXPECT_TRUE(file::remove(filename));
+}
+
+TEST(ProbabilityTableTest, reset)
+{
+    ProbabilityTable table;
+    table.reset(vector<double> { 3.0, 4.0 });
+    EXPECT_FALSE(table.isMapped());
+    ASSERT_EQ(2U, table.size());
+    EXPECT_EQ(3.0, table.values()[0]);
+    EXPECT_EQ(4.0, table.values()[1]);
+}
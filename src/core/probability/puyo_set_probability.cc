@@ -2,12 +2,27 @@
 
 #include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "core/kumipuyo_seq.h"
 
 using namespace std;
 
-PuyoSetProbability::PuyoSetProbability()
+const char PuyoSetProbability::TABLE_NAME[] = "puyo_set_probability.tbl";
+const char PuyoSetProbability::TABLE_MAGIC[] = "PUYOPSP";
+
+PuyoSetProbability::PuyoSetProbability(const string& filename)
+{
+    if (!table_.load(filename, TABLE_MAGIC, tableSize())) {
+        LOG(INFO) << filename << " is not available. Computing PuyoSetProbability."
+                  << " Run make_probability_tables to make it faster.";
+        table_.reset(computeTable());
+    }
+    p_ = table_.values();
+}
+
+// static
+vector<double> PuyoSetProbability::computeTable()
 {
     auto p = new double[MAX_N][MAX_N][MAX_N][MAX_N][MAX_K];
     auto q = new double[MAX_N][MAX_N][MAX_N][MAX_N][MAX_K];
@@ -96,12 +111,13 @@ PuyoSetProbability::PuyoSetProbability()
         }
     }
 
+    vector<double> result(tableSize());
     for (int a = 0; a < MAX_N; ++a) {
         for (int b = 0; b < MAX_N; ++b) {
             for (int c = 0; c < MAX_N; ++c) {
                 for (int d = 0; d < MAX_N; ++d) {
                     for (int k = 0; k < MAX_K; ++k) {
-                        p_[a][b][c][d][k] = p[a][b][c][d][k];
+                        result[tableIndex(a, b, c, d, k)] = p[a][b][c][d][k];
                     }
                 }
             }
@@ -110,11 +126,15 @@ PuyoSetProbability::PuyoSetProbability()
 
     delete[] p;
     delete[] q;
+
+    return result;
 }
 
+// static
 const PuyoSetProbability* PuyoSetProbability::instanceSlow()
 {
-    static std::unique_ptr<PuyoSetProbability> s_instance(new PuyoSetProbability);
+    static std::unique_ptr<PuyoSetProbability> s_instance(
+        new PuyoSetProbability(ProbabilityTable::defaultPath(TABLE_NAME)));
     return s_instance.get();
 }
 
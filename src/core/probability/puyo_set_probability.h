@@ -4,18 +4,36 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 #include "base/noncopyable.h"
+#include "core/probability/probability_table.h"
 #include "core/probability/puyo_set.h"
 
 class KumipuyoSeq;
 
 class PuyoSetProbability : noncopyable, nonmovable {
 public:
-    // Returns PuyoSetProbability instance. This might take time.
+    static const int MAX_N = 16;
+    static const int MAX_K = 32;
+    static const char TABLE_NAME[];
+    static const char TABLE_MAGIC[];
+
+    // Returns PuyoSetProbability instance. This might take time if the table made by
+    // make_probability_tables doesn't exist.
     static const PuyoSetProbability* instanceSlow();
 
-    PuyoSetProbability();
+    // Computes the table. The layout is [a][b][c][d][k], i.e. tableIndex(a, b, c, d, k).
+    static std::vector<double> computeTable();
+    static size_t tableSize() { return MAX_N * MAX_N * MAX_N * MAX_N * MAX_K; }
+    static int tableIndex(int a, int b, int c, int d, int k)
+    {
+        return (((a * MAX_N + b) * MAX_N + c) * MAX_N + d) * MAX_K + k;
+    }
+
+    // Loads the table from |filename|. If it's not available, the table is computed.
+    explicit PuyoSetProbability(const std::string& filename);
 
     // Returns the possibility that when there are randomly |k| puyos,
     // that set will contain |puyoSet|.
@@ -27,7 +45,7 @@ public:
         int d = std::min(MAX_N - 1, puyoSet.green());
         int kk = std::min(MAX_K - 1, k);
 
-        return p_[a][b][c][d][kk];
+        return p_[tableIndex(a, b, c, d, kk)];
     }
 
     // Returns how many puyos are required to get |puyoSet| with possibility |threshold|?
@@ -40,7 +58,7 @@ public:
         int c = std::min(MAX_N - 1, puyoSet.yellow());
         int d = std::min(MAX_N - 1, puyoSet.green());
 
-        const double* p = p_[a][b][c][d];
+        const double* p = p_ + tableIndex(a, b, c, d, 0);
 
         for (int k = 0; k < MAX_K; ++k) {
             if (p[k] >= threshold)
@@ -54,11 +72,13 @@ public:
     // Some of kumipuyo seq is provided.
     int necessaryPuyos(const PuyoSet&, const KumipuyoSeq&, double threshold) const;
 
-private:
-    static const int MAX_N = 16;
-    static const int MAX_K = 32;
+    // Returns true if the table is mapped from a file.
+    bool isMapped() const { return table_.isMapped(); }
 
-    double p_[MAX_N][MAX_N][MAX_N][MAX_N][MAX_K];
+private:
+    ProbabilityTable table_;
+    // Points to |table_|'s values.
+    const double* p_;
 };
 
 #endif // CORE_PROBABILITY_PUYO_POSSIBILITY_H_
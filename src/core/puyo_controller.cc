@@ -2,23 +2,19 @@
 
 #include <algorithm>
 #include <cstddef>
-#include <functional>
-#include <map>
-#include <queue>
 #include <string>
-#include <tuple>
 #include <utility>
 #include <vector>
 
 #include <glog/logging.h>
 
-#include "base/base.h"
 #include "core/core_field.h"
 #include "core/decision.h"
 #include "core/key.h"
 #include "core/kumipuyo_pos.h"
 #include "core/kumipuyo_moving_state.h"
 #include "core/puyo_color.h"
+#include "core/reachability_table.h"
 
 using namespace std;
 
@@ -382,6 +378,61 @@ PrecedeKeySetSeq findKeyStrokeFastpath63(const CoreField& field)
     return PrecedeKeySetSeq();
 }
 
+// The heights which isReachable() distinguishes: <= 10, 11, 12 and >= 13.
+const int NUM_HEIGHT_CLASSES = 4;
+const int NUM_HEIGHT_PROFILES = NUM_HEIGHT_CLASSES * NUM_HEIGHT_CLASSES * NUM_HEIGHT_CLASSES *
+    NUM_HEIGHT_CLASSES * NUM_HEIGHT_CLASSES * NUM_HEIGHT_CLASSES;
+
+int heightProfile(const int heights[7])
+{
+    int profile = 0;
+    for (int x = 1; x <= 6; ++x) {
+        int c = std::min(std::max(heights[x] - 10, 0), NUM_HEIGHT_CLASSES - 1);
+        profile = profile * NUM_HEIGHT_CLASSES + c;
+    }
+    return profile;
+}
+
+// The index of each decision in the mask of reachableDecisions(). -1 for invalid decisions.
+const int DECISION_INDEX[7][4] = {
+    { -1, -1, -1, -1 },
+    {  0,  1,  2, -1 },
+    {  3,  4,  5,  6 },
+    {  7,  8,  9, 10 },
+    { 11, 12, 13, 14 },
+    { 15, 16, 17, 18 },
+    { 19, -1, 20, 21 },
+};
+
+// REACHABLE_DECISIONS[profile] is the mask of reachable decisions for the height profile.
+struct ReachableDecisionsTable {
+    ReachableDecisionsTable()
+    {
+        for (int profile = 0; profile < NUM_HEIGHT_PROFILES; ++profile) {
+            CoreField field;
+            int p = profile;
+            for (int x = 6; x >= 1; --x) {
+                int h = 10 + p % NUM_HEIGHT_CLASSES;
+                p /= NUM_HEIGHT_CLASSES;
+                for (int y = 1; y <= h; ++y)
+                    field.dropPuyoOn(x, PuyoColor::OJAMA);
+            }
+
+            unsigned int mask = 0;
+            for (int x = 1; x <= 6; ++x) {
+                for (int r = 0; r < 4; ++r) {
+                    Decision d(x, r);
+                    if (d.isValid() && PuyoController::isReachable(field, d))
+                        mask |= 1U << DECISION_INDEX[x][r];
+                }
+            }
+            masks[profile] = mask;
+        }
+    }
+
+    unsigned int masks[NUM_HEIGHT_PROFILES];
+};
+
 } // namespace anomymous
 
 bool PuyoController::isReachable(const CoreField& field, const Decision& decision)
@@ -434,6 +485,26 @@ bool PuyoController::isReachable(const CoreField& field, const Decision& decisio
     return true;
 }
 
+const int PuyoController::NUM_DECISIONS;
+
+// static
+unsigned int PuyoController::reachableDecisions(const CoreField& field)
+{
+    static const ReachableDecisionsTable table;
+
+    int heights[7];
+    for (int x = 1; x <= 6; ++x)
+        heights[x] = field.height(x);
+    return table.masks[heightProfile(heights)];
+}
+
+// static
+int PuyoController::decisionIndex(const Decision& decision)
+{
+    DCHECK(decision.isValid()) << decision.toString();
+    return DECISION_INDEX[decision.x][decision.r];
+}
+
 bool PuyoController::isReachableFrom(const CoreField& field, const KumipuyoMovingState& mks, const Decision& decision)
 {
     return !findKeyStrokeOnlineInternal(field, mks, decision).empty();
@@ -445,6 +516,12 @@ PrecedeKeySetSeq PuyoController::findKeyStroke(const CoreField& field, const Dec
     if (!pkss.empty())
         return pkss;
 
+    // The table is cached by the column heights, so a decision the exhaustive search
+    // couldn't reach doesn't need the online search. The key stroke still comes from the
+    // online search, since it's shorter than the frame-by-frame one in the table.
+    if (!ReachabilityTable::isReachable(field, decision))
+        return PrecedeKeySetSeq();
+
     return PrecedeKeySetSeq(findKeyStrokeOnline(field, KumipuyoMovingState::initialState(), decision));
 }
 
@@ -458,134 +535,11 @@ KeySetSeq PuyoController::findKeyStrokeFrom(const CoreField& field, const Kumipu
     return findKeyStrokeByDijkstra(field, mks, decision);
 }
 
-typedef KumipuyoMovingState Vertex;
-
-typedef double Weight;
-struct Edge {
-    Edge() {}
-    Edge(const Vertex& src, const Vertex& dest, Weight weight, const KeySet& keySet) :
-        src(src), dest(dest), weight(weight), keySet(keySet) {}
-
-    friend bool operator>(const Edge& lhs, const Edge& rhs) {
-        if (lhs.weight != rhs.weight) { return lhs.weight > rhs.weight; }
-        if (lhs.src != rhs.src) { return lhs.src > rhs.src; }
-        return lhs.dest > rhs.dest;
-    }
-
-    Vertex src;
-    Vertex dest;
-    Weight weight;
-    KeySet keySet;
-};
-
-typedef vector<Edge> Edges;
-typedef map<Vertex, tuple<Vertex, KeySet, Weight>> Potential;
-
 KeySetSeq PuyoController::findKeyStrokeByDijkstra(const CoreField& field, const KumipuyoMovingState& initialState, const Decision& decision)
 {
-    // We don't add KeySet(Key::DOWN) intentionally.
-    static const pair<KeySet, double> KEY_CANDIDATES[] = {
-        make_pair(KeySet(), 1),
-        make_pair(KeySet(Key::LEFT), 1.01),
-        make_pair(KeySet(Key::RIGHT), 1.01),
-        make_pair(KeySet(Key::LEFT, Key::LEFT_TURN), 1.03),
-        make_pair(KeySet(Key::LEFT, Key::RIGHT_TURN), 1.03),
-        make_pair(KeySet(Key::RIGHT, Key::LEFT_TURN), 1.03),
-        make_pair(KeySet(Key::RIGHT, Key::RIGHT_TURN), 1.03),
-        make_pair(KeySet(Key::LEFT_TURN), 1.01),
-        make_pair(KeySet(Key::RIGHT_TURN), 1.01),
-    };
-    static const int KEY_CANDIDATES_SIZE = ARRAY_SIZE(KEY_CANDIDATES);
-
-    static const pair<KeySet, double> KEY_CANDIDATES_WITHOUT_TURN[] = {
-        make_pair(KeySet(), 1),
-        make_pair(KeySet(Key::LEFT), 1.01),
-        make_pair(KeySet(Key::RIGHT), 1.01),
-    };
-    static const int KEY_CANDIDATES_SIZE_WITHOUT_TURN = ARRAY_SIZE(KEY_CANDIDATES_WITHOUT_TURN);
-
-    static const pair<KeySet, double> KEY_CANDIDATES_WITHOUT_ARROW[] = {
-        make_pair(KeySet(), 1),
-        make_pair(KeySet(Key::LEFT_TURN), 1.01),
-        make_pair(KeySet(Key::RIGHT_TURN), 1.01),
-    };
-    static const int KEY_CANDIDATES_SIZE_WITHOUT_ARROW = ARRAY_SIZE(KEY_CANDIDATES_WITHOUT_ARROW);
-
-    static const pair<KeySet, double> KEY_CANDIDATES_WITHOUT_TURN_OR_ARROW[] = {
-        make_pair(KeySet(), 1),
-    };
-    static const int KEY_CANDIDATES_SIZE_WITHOUT_TURN_OR_ARROW = ARRAY_SIZE(KEY_CANDIDATES_WITHOUT_TURN_OR_ARROW);
-
-    PlainField plainField = field.toPlainField();
-
-    Potential pot;
-    priority_queue<Edge, Edges, greater<Edge> > Q;
-
-    Vertex startV(initialState);
-    Q.push(Edge(startV, startV, 0, KeySet()));
-
-    while (!Q.empty()) {
-        Edge edge = Q.top(); Q.pop();
-        Vertex p = edge.dest;
-        Weight curr = edge.weight;
-
-        // already visited?
-        if (pot.count(p))
-            continue;
-
-        pot[p] = make_tuple(edge.src, edge.keySet, curr);
-
-        // goal.
-        if (p.pos.axisX() == decision.x && p.pos.rot() == decision.r) {
-            // goal.
-            vector<KeySet> kss;
-            kss.push_back(KeySet(Key::DOWN));
-            while (pot.count(p)) {
-                if (p == startV)
-                    break;
-                const KeySet ks(std::get<1>(pot[p]));
-                kss.push_back(ks);
-                p = std::get<0>(pot[p]);
-            }
-
-            reverse(kss.begin(), kss.end());
-            return KeySetSeq(kss);
-        }
-
-        if (p.grounded)
-            continue;
-
-        const pair<KeySet, double>* candidates;
-        int size;
-        if (p.restFramesTurnProhibited > 0 && p.restFramesArrowProhibited > 0) {
-            candidates = KEY_CANDIDATES_WITHOUT_TURN_OR_ARROW;
-            size = KEY_CANDIDATES_SIZE_WITHOUT_TURN_OR_ARROW;
-        } else if (p.restFramesTurnProhibited > 0) {
-            candidates = KEY_CANDIDATES_WITHOUT_TURN;
-            size = KEY_CANDIDATES_SIZE_WITHOUT_TURN;
-        } else if (p.restFramesArrowProhibited > 0) {
-            candidates = KEY_CANDIDATES_WITHOUT_ARROW;
-            size = KEY_CANDIDATES_SIZE_WITHOUT_ARROW;
-        } else {
-            candidates = KEY_CANDIDATES;
-            size = KEY_CANDIDATES_SIZE;
-        }
-
-        for (int i = 0; i < size; ++i) {
-            const pair<KeySet, double>& candidate = candidates[i];
-            KumipuyoMovingState mks(p);
-            bool downAccepted;
-            mks.moveKumipuyo(plainField, candidate.first, &downAccepted);
-
-            if (pot.count(mks))
-                continue;
-            // TODO(mayah): This is not correct. We'd like to prefer KeySet() to another key sequence a bit.
-            Q.push(Edge(p, mks, curr + candidate.second, candidate.first));
-        }
-    }
-
-    // No way...
-    return KeySetSeq();
+    if (initialState.isInitialPosition())
+        return ReachabilityTable::instance(field)->keyStroke(decision);
+    return ReachabilityTable::findKeyStroke(field.toPlainField(), initialState, decision);
 }
 
 KeySetSeq PuyoController::findKeyStrokeOnline(const CoreField& field, const KumipuyoMovingState& mks, const Decision& decision)
@@ -9,7 +9,17 @@ class KumipuyoMovingState;
 
 class PuyoController {
 public:
+    // The number of valid decisions.
+    static const int NUM_DECISIONS = 22;
+
     static bool isReachable(const CoreField&, const Decision&);
+    // Returns the reachable decisions as a mask. The |decisionIndex(d)|-th bit is set
+    // iff isReachable(field, d) is true. This is a table lookup by the column heights,
+    // so this is much faster than calling isReachable() for each decision.
+    static unsigned int reachableDecisions(const CoreField&);
+    // Returns the index of |decision| in the mask of reachableDecisions(), in [0, NUM_DECISIONS).
+    // |decision| must be valid.
+    static int decisionIndex(const Decision& decision);
     static bool isReachableFrom(const CoreField&, const KumipuyoMovingState&, const Decision&);
 
     // Finds a key stroke to move puyo from |KumipuyoMovingState| to |Decision|.
@@ -24,7 +34,7 @@ private:
     static PrecedeKeySetSeq findKeyStrokeFastpath(const CoreField&, const Decision&);
     // This is faster, but might output worse key stroke.
     static KeySetSeq findKeyStrokeOnline(const CoreField&, const KumipuyoMovingState&, const Decision&);
-    // This is slow, but precise.
+    // This is slow, but precise. From the initial position, the cached ReachabilityTable is used.
     static KeySetSeq findKeyStrokeByDijkstra(const CoreField&, const KumipuyoMovingState&, const Decision&);
 };
 
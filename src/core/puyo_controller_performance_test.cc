@@ -2,9 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 #include "core/core_field.h"
 #include "core/decision.h"
+#include "core/kumipuyo_moving_state.h"
+#include "core/kumipuyo_pos.h"
+#include "core/reachability_table.h"
 
 using namespace std;
 
@@ -20,7 +24,7 @@ TEST(PuyoControllerPerformanceTest, empty)
         PuyoController::findKeyStroke(f, d);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(PuyoControllerPerformanceTest, unreachable)
@@ -48,5 +52,79 @@ TEST(PuyoControllerPerformanceTest, unreachable)
         PuyoController::findKeyStroke(f, d);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
+}
+
+TEST(PuyoControllerPerformanceTest, findKeyStrokeFrom)
+{
+    TimeStampCounterData tsc;
+
+    CoreField f(
+        "O    O"
+        "OO  OO" // 12
+        "OO  OO"
+        "OO  OO");
+
+    // Not the initial state, so this uses Dijkstra.
+    KumipuyoMovingState mks(KumipuyoPos(3, 11, 0));
+    for (int i = 0; i < 100; ++i) {
+        ScopedTimeStampCounter stsc(&tsc);
+        PuyoController::findKeyStrokeFrom(f, mks, Decision(6, 2));
+    }
+
+    reportTestBenchmark(tsc);
+}
+
+TEST(PuyoControllerPerformanceTest, higherField)
+{
+    TimeStampCounterData tsc;
+
+    CoreField f(
+        "  O   "
+        "  O O " // 12
+        "  O O "
+        "  O O "
+        "  O O "
+        "  O O " // 8
+        "  O O "
+        "  O O "
+        "  O O "
+        "  O O " // 4
+        "  O O "
+        "  O O "
+        "  O O ");
+
+    // The fastpath doesn't handle this field, so this uses the reachability table
+    // and the online search.
+    for (int i = 0; i < 100; ++i) {
+        ScopedTimeStampCounter stsc(&tsc);
+        for (int x = 1; x <= 6; ++x) {
+            for (int r = 0; r < 4; ++r) {
+                Decision d(x, r);
+                if (d.isValid())
+                    PuyoController::findKeyStroke(f, d);
+            }
+        }
+    }
+
+    reportTestBenchmark(tsc);
+}
+
+TEST(PuyoControllerPerformanceTest, reachabilityTable)
+{
+    TimeStampCounterData tsc;
+
+    CoreField f(
+        "O    O"
+        "OO  OO" // 12
+        "OO  OO"
+        "OO  OO");
+
+    for (int i = 0; i < 100; ++i) {
+        ReachabilityTable::clearCache();
+        ScopedTimeStampCounter stsc(&tsc);
+        ReachabilityTable::instance(f);
+    }
+
+    reportTestBenchmark(tsc);
 }
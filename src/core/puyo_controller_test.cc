@@ -959,3 +959,53 @@ TEST(PuyoControllerTest, reachable6)
         }
     }
 }
+
+TEST(PuyoControllerTest, decisionIndex)
+{
+    set<int> indices;
+    for (int x = 1; x <= 6; ++x) {
+        for (int r = 0; r < 4; ++r) {
+            Decision d(x, r);
+            if (!d.isValid())
+                continue;
+            int index = PuyoController::decisionIndex(d);
+            EXPECT_LE(0, index);
+            EXPECT_GT(PuyoController::NUM_DECISIONS, index);
+            indices.insert(index);
+        }
+    }
+    EXPECT_EQ(static_cast<size_t>(PuyoController::NUM_DECISIONS), indices.size());
+}
+
+TEST(PuyoControllerTest, reachableDecisions)
+{
+    // Try all the height profiles which isReachable() can distinguish, and a few more.
+    const int heights[] = { 0, 9, 10, 11, 12, 13 };
+    const int n = sizeof(heights) / sizeof(heights[0]);
+
+    int hs[7] {};
+    for (int profile = 0; profile < n * n * n * n * n * n; ++profile) {
+        int p = profile;
+        for (int x = 1; x <= 6; ++x) {
+            hs[x] = heights[p % n];
+            p /= n;
+        }
+
+        CoreField f;
+        for (int x = 1; x <= 6; ++x) {
+            for (int y = 1; y <= hs[x]; ++y)
+                f.dropPuyoOn(x, PuyoColor::OJAMA);
+        }
+
+        unsigned int mask = PuyoController::reachableDecisions(f);
+        for (int x = 1; x <= 6; ++x) {
+            for (int r = 0; r < 4; ++r) {
+                Decision d(x, r);
+                if (!d.isValid())
+                    continue;
+                bool bit = (mask >> PuyoController::decisionIndex(d)) & 1;
+                ASSERT_EQ(PuyoController::isReachable(f, d), bit) << f.toDebugString() << d.toString();
+            }
+        }
+    }
+}
@@ -0,0 +1,371 @@
+#include "core/reachability_table.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "base/base.h"
+#include "core/core_field.h"
+#include "core/frame.h"
+#include "core/key.h"
+#include "core/kumipuyo_moving_state.h"
+#include "core/plain_field.h"
+
+using namespace std;
+
+namespace {
+
+// The cache is cleared when it has this number of tables.
+const size_t MAX_CACHE_SIZE = 1 << 16;
+
+// Packs KumipuyoMovingState into an integer. The packing keeps the order of
+// operator<(KumipuyoMovingState, KumipuyoMovingState), so the search visits the states
+// in the same order as a search using KumipuyoMovingState directly.
+const uint32_t RADIX_Y = 16;
+const uint32_t RADIX_R = 4;
+const uint32_t RADIX_TURN = FRAMES_CONTINUOUS_TURN_PROHIBITED + 1;
+const uint32_t RADIX_ARROW = FRAMES_CONTINUOUS_ARROW_PROHIBITED + 1;
+const uint32_t RADIX_QUICKTURN = FRAMES_QUICKTURN + 1;
+const uint32_t RADIX_FREEFALL = FRAMES_FREE_FALL + 1;
+const uint32_t RADIX_GROUNDED = 9;
+
+uint32_t pack(const KumipuyoMovingState& mks)
+{
+    DCHECK(0 <= mks.pos.x && mks.pos.x < 8) << mks.pos.x;
+    DCHECK(0 <= mks.pos.y && mks.pos.y < static_cast<int>(RADIX_Y)) << mks.pos.y;
+    DCHECK(0 <= mks.restFramesTurnProhibited && mks.restFramesTurnProhibited < static_cast<int>(RADIX_TURN));
+    DCHECK(0 <= mks.restFramesArrowProhibited && mks.restFramesArrowProhibited < static_cast<int>(RADIX_ARROW));
+    DCHECK(0 <= mks.restFramesToAcceptQuickTurn && mks.restFramesToAcceptQuickTurn < static_cast<int>(RADIX_QUICKTURN));
+    DCHECK(0 <= mks.restFramesForFreefall && mks.restFramesForFreefall < static_cast<int>(RADIX_FREEFALL));
+    DCHECK(0 <= mks.numGrounded && mks.numGrounded < static_cast<int>(RADIX_GROUNDED));
+
+    uint32_t v = mks.pos.x;
+    v = v * RADIX_Y + mks.pos.y;
+    v = v * RADIX_R + mks.pos.r;
+    v = v * RADIX_TURN + mks.restFramesTurnProhibited;
+    v = v * RADIX_ARROW + mks.restFramesArrowProhibited;
+    v = v * RADIX_QUICKTURN + mks.restFramesToAcceptQuickTurn;
+    v = v * RADIX_FREEFALL + mks.restFramesForFreefall;
+    v = v * RADIX_GROUNDED + mks.numGrounded;
+    v = v * 2 + mks.grounding;
+    v = v * 2 + mks.grounded;
+    return v;
+}
+
+KumipuyoMovingState unpack(uint32_t v)
+{
+    KumipuyoMovingState mks;
+    mks.grounded = v % 2; v /= 2;
+    mks.grounding = v % 2; v /= 2;
+    mks.numGrounded = v % RADIX_GROUNDED; v /= RADIX_GROUNDED;
+    mks.restFramesForFreefall = v % RADIX_FREEFALL; v /= RADIX_FREEFALL;
+    mks.restFramesToAcceptQuickTurn = v % RADIX_QUICKTURN; v /= RADIX_QUICKTURN;
+    mks.restFramesArrowProhibited = v % RADIX_ARROW; v /= RADIX_ARROW;
+    mks.restFramesTurnProhibited = v % RADIX_TURN; v /= RADIX_TURN;
+    mks.pos.r = v % RADIX_R; v /= RADIX_R;
+    mks.pos.y = v % RADIX_Y; v /= RADIX_Y;
+    mks.pos.x = v;
+    return mks;
+}
+
+// VisitedTable is an open addressing hash table from a packed state to
+// the previous state and the KeySet to come to the state.
+class VisitedTable {
+public:
+    struct Entry {
+        // |state| + 1. 0 means the entry is empty.
+        uint32_t key;
+        uint32_t prev;
+        KeySet keySet;
+    };
+
+    VisitedTable() : entries_(1024), size_(0) {}
+
+    const Entry* find(uint32_t state) const
+    {
+        const size_t mask = entries_.size() - 1;
+        for (size_t i = hash(state) & mask; ; i = (i + 1) & mask) {
+            if (entries_[i].key == state + 1)
+                return &entries_[i];
+            if (entries_[i].key == 0)
+                return nullptr;
+        }
+    }
+
+    // Returns false if |state| has already been inserted.
+    bool insert(uint32_t state, uint32_t prev, const KeySet& keySet)
+    {
+        if ((size_ + 1) * 2 > entries_.size())
+            grow();
+
+        const size_t mask = entries_.size() - 1;
+        for (size_t i = hash(state) & mask; ; i = (i + 1) & mask) {
+            if (entries_[i].key == state + 1)
+                return false;
+            if (entries_[i].key == 0) {
+                entries_[i] = Entry { state + 1, prev, keySet };
+                ++size_;
+                return true;
+            }
+        }
+    }
+
+private:
+    static size_t hash(uint32_t state) { return (state * 0x9E3779B1U) >> 8; }
+
+    void grow()
+    {
+        vector<Entry> old(entries_.size() * 2);
+        old.swap(entries_);
+        size_ = 0;
+        for (const Entry& e : old) {
+            if (e.key != 0)
+                insert(e.key - 1, e.prev, e.keySet);
+        }
+    }
+
+    vector<Entry> entries_;
+    size_t size_;
+};
+
+struct Edge {
+    double weight;
+    uint32_t src;
+    uint32_t dest;
+    KeySet keySet;
+
+    friend bool operator>(const Edge& lhs, const Edge& rhs)
+    {
+        if (lhs.weight != rhs.weight) { return lhs.weight > rhs.weight; }
+        if (lhs.src != rhs.src) { return lhs.src > rhs.src; }
+        return lhs.dest > rhs.dest;
+    }
+};
+
+typedef function<bool (const KumipuyoMovingState&, const KeySetSeq&)> GoalCallback;
+
+KeySetSeq makeKeySetSeq(const VisitedTable& visited, uint32_t start, uint32_t goal)
+{
+    vector<KeySet> kss;
+    kss.push_back(KeySet(Key::DOWN));
+    for (uint32_t p = goal; p != start; ) {
+        const VisitedTable::Entry* e = visited.find(p);
+        DCHECK(e);
+        kss.push_back(e->keySet);
+        p = e->prev;
+    }
+
+    reverse(kss.begin(), kss.end());
+    return KeySetSeq(kss);
+}
+
+// Runs Dijkstra from |initialState|. |callback| is called for each state in the order
+// of the distance, with the shortest key stroke to the state. Stops when |callback| returns true.
+void search(const PlainField& field, const KumipuyoMovingState& initialState,
+            const function<bool (const KumipuyoMovingState&)>& isGoal, const GoalCallback& callback)
+{
+    // We don't add KeySet(Key::DOWN) intentionally.
+    static const pair<KeySet, double> KEY_CANDIDATES[] = {
+        make_pair(KeySet(), 1),
+        make_pair(KeySet(Key::LEFT), 1.01),
+        make_pair(KeySet(Key::RIGHT), 1.01),
+        make_pair(KeySet(Key::LEFT, Key::LEFT_TURN), 1.03),
+        make_pair(KeySet(Key::LEFT, Key::RIGHT_TURN), 1.03),
+        make_pair(KeySet(Key::RIGHT, Key::LEFT_TURN), 1.03),
+        make_pair(KeySet(Key::RIGHT, Key::RIGHT_TURN), 1.03),
+        make_pair(KeySet(Key::LEFT_TURN), 1.01),
+        make_pair(KeySet(Key::RIGHT_TURN), 1.01),
+    };
+    static const int KEY_CANDIDATES_SIZE = ARRAY_SIZE(KEY_CANDIDATES);
+
+    static const pair<KeySet, double> KEY_CANDIDATES_WITHOUT_TURN[] = {
+        make_pair(KeySet(), 1),
+        make_pair(KeySet(Key::LEFT), 1.01),
+        make_pair(KeySet(Key::RIGHT), 1.01),
+    };
+    static const int KEY_CANDIDATES_SIZE_WITHOUT_TURN = ARRAY_SIZE(KEY_CANDIDATES_WITHOUT_TURN);
+
+    static const pair<KeySet, double> KEY_CANDIDATES_WITHOUT_ARROW[] = {
+        make_pair(KeySet(), 1),
+        make_pair(KeySet(Key::LEFT_TURN), 1.01),
+        make_pair(KeySet(Key::RIGHT_TURN), 1.01),
+    };
+    static const int KEY_CANDIDATES_SIZE_WITHOUT_ARROW = ARRAY_SIZE(KEY_CANDIDATES_WITHOUT_ARROW);
+
+    static const pair<KeySet, double> KEY_CANDIDATES_WITHOUT_TURN_OR_ARROW[] = {
+        make_pair(KeySet(), 1),
+    };
+    static const int KEY_CANDIDATES_SIZE_WITHOUT_TURN_OR_ARROW = ARRAY_SIZE(KEY_CANDIDATES_WITHOUT_TURN_OR_ARROW);
+
+    VisitedTable visited;
+    vector<Edge> edges;
+    edges.reserve(1024);
+    priority_queue<Edge, vector<Edge>, greater<Edge>> Q(greater<Edge>(), std::move(edges));
+
+    const uint32_t start = pack(initialState);
+    Q.push(Edge { 0, start, start, KeySet() });
+
+    while (!Q.empty()) {
+        Edge edge = Q.top(); Q.pop();
+        const double curr = edge.weight;
+
+        // already visited?
+        if (!visited.insert(edge.dest, edge.src, edge.keySet))
+            continue;
+
+        const KumipuyoMovingState p = unpack(edge.dest);
+        if (isGoal(p)) {
+            if (callback(p, makeKeySetSeq(visited, start, edge.dest)))
+                return;
+        }
+
+        if (p.grounded)
+            continue;
+
+        const pair<KeySet, double>* candidates;
+        int size;
+        if (p.restFramesTurnProhibited > 0 && p.restFramesArrowProhibited > 0) {
+            candidates = KEY_CANDIDATES_WITHOUT_TURN_OR_ARROW;
+            size = KEY_CANDIDATES_SIZE_WITHOUT_TURN_OR_ARROW;
+        } else if (p.restFramesTurnProhibited > 0) {
+            candidates = KEY_CANDIDATES_WITHOUT_TURN;
+            size = KEY_CANDIDATES_SIZE_WITHOUT_TURN;
+        } else if (p.restFramesArrowProhibited > 0) {
+            candidates = KEY_CANDIDATES_WITHOUT_ARROW;
+            size = KEY_CANDIDATES_SIZE_WITHOUT_ARROW;
+        } else {
+            candidates = KEY_CANDIDATES;
+            size = KEY_CANDIDATES_SIZE;
+        }
+
+        for (int i = 0; i < size; ++i) {
+            const pair<KeySet, double>& candidate = candidates[i];
+            KumipuyoMovingState mks(p);
+            bool downAccepted;
+            mks.moveKumipuyo(field, candidate.first, &downAccepted);
+
+            uint32_t next = pack(mks);
+            if (visited.find(next))
+                continue;
+            Q.push(Edge { curr + candidate.second, edge.dest, next, candidate.first });
+        }
+    }
+}
+
+// The heights of the columns in 4 bits each.
+uint32_t heightSignature(const CoreField& field)
+{
+    uint32_t signature = 0;
+    for (int x = 1; x <= 6; ++x)
+        signature = (signature << 4) | field.height(x);
+    return signature;
+}
+
+mutex s_cacheMutex;
+unordered_map<uint32_t, shared_ptr<const ReachabilityTable>>& cache()
+{
+    static unordered_map<uint32_t, shared_ptr<const ReachabilityTable>> s_cache;
+    return s_cache;
+}
+
+// Incremented by clearCache() to invalidate the tables remembered by each thread.
+atomic<int> s_cacheGeneration(0);
+
+// The table each thread used last. Callers usually ask for all the decisions on
+// the same field in a row, so this saves the lock and the lookup of the cache.
+// The raw pointer is checked first, since it doesn't need the initialization of
+// a thread_local object.
+thread_local const ReachabilityTable* s_lastTable = nullptr;
+thread_local uint32_t s_lastSignature = 0;
+thread_local int s_lastGeneration = 0;
+thread_local shared_ptr<const ReachabilityTable> s_lastTableHolder;
+
+} // namespace anonymous
+
+// static
+shared_ptr<const ReachabilityTable> ReachabilityTable::instance(const CoreField& field)
+{
+    const uint32_t signature = heightSignature(field);
+    {
+        lock_guard<mutex> lock(s_cacheMutex);
+        auto it = cache().find(signature);
+        if (it != cache().end())
+            return it->second;
+    }
+
+    // Build the table without holding the lock. Another thread might build the same
+    // table at the same time, but the result is the same.
+    shared_ptr<const ReachabilityTable> table(new ReachabilityTable(field));
+
+    lock_guard<mutex> lock(s_cacheMutex);
+    if (cache().size() >= MAX_CACHE_SIZE)
+        cache().clear();
+    cache().emplace(signature, table);
+    return table;
+}
+
+// static
+bool ReachabilityTable::isReachable(const CoreField& field, const Decision& decision)
+{
+    const uint32_t signature = heightSignature(field);
+    const int generation = s_cacheGeneration.load(memory_order_relaxed);
+    if (!s_lastTable || s_lastSignature != signature || s_lastGeneration != generation) {
+        s_lastTableHolder = instance(field);
+        s_lastTable = s_lastTableHolder.get();
+        s_lastSignature = signature;
+        s_lastGeneration = generation;
+    }
+    return s_lastTable->isReachable(decision);
+}
+
+// static
+KeySetSeq ReachabilityTable::findKeyStroke(const PlainField& field, const KumipuyoMovingState& mks, const Decision& decision)
+{
+    KeySetSeq result;
+    search(field, mks, [&decision](const KumipuyoMovingState& p) {
+        return p.pos.axisX() == decision.x && p.pos.rot() == decision.r;
+    }, [&result](const KumipuyoMovingState&, const KeySetSeq& kss) {
+        result = kss;
+        return true;
+    });
+    return result;
+}
+
+// static
+size_t ReachabilityTable::cacheSize()
+{
+    lock_guard<mutex> lock(s_cacheMutex);
+    return cache().size();
+}
+
+// static
+void ReachabilityTable::clearCache()
+{
+    lock_guard<mutex> lock(s_cacheMutex);
+    cache().clear();
+    ++s_cacheGeneration;
+}
+
+ReachabilityTable::ReachabilityTable(const CoreField& field)
+{
+    int numRemaining = 0;
+    for (int x = 1; x <= 6; ++x) {
+        for (int r = 0; r < 4; ++r) {
+            if (Decision(x, r).isValid())
+                ++numRemaining;
+        }
+    }
+
+    search(field.toPlainField(), KumipuyoMovingState::initialState(), [this](const KumipuyoMovingState& p) {
+        return keyStrokes_[p.pos.axisX()][p.pos.rot()].empty();
+    }, [this, &numRemaining](const KumipuyoMovingState& p, const KeySetSeq& kss) {
+        keyStrokes_[p.pos.axisX()][p.pos.rot()] = kss;
+        return --numRemaining == 0;
+    });
+}
@@ -0,0 +1,47 @@
+#ifndef CORE_REACHABILITY_TABLE_H_
+#define CORE_REACHABILITY_TABLE_H_
+
+#include <memory>
+
+#include "base/noncopyable.h"
+#include "core/decision.h"
+#include "core/key_set_seq.h"
+
+class CoreField;
+class KumipuyoMovingState;
+class PlainField;
+
+// ReachabilityTable has the shortest key strokes to move a kumipuyo from the initial
+// position to all the 22 decisions on a field.
+//
+// How a kumipuyo moves depends only on the column heights, so the tables are cached
+// by the heights. All the decisions are found by one Dijkstra search.
+class ReachabilityTable : noncopyable {
+public:
+    // Returns the table for |field|. This is thread-safe.
+    static std::shared_ptr<const ReachabilityTable> instance(const CoreField& field);
+    // Same as instance(field)->isReachable(decision), but each thread remembers the table
+    // it used last, so asking for the decisions on the same field in a row doesn't take
+    // the lock of the cache.
+    static bool isReachable(const CoreField& field, const Decision& decision);
+
+    // Finds the shortest key stroke from |mks| to |decision| by Dijkstra.
+    // The last KeySet is DOWN. When |decision| is not reachable, an empty KeySetSeq is returned.
+    static KeySetSeq findKeyStroke(const PlainField&, const KumipuyoMovingState& mks, const Decision& decision);
+
+    // Returns the key stroke to |decision|, which is the same as findKeyStroke()
+    // from the initial position. Empty if |decision| is not reachable.
+    const KeySetSeq& keyStroke(const Decision& decision) const { return keyStrokes_[decision.x][decision.r]; }
+    bool isReachable(const Decision& decision) const { return !keyStroke(decision).empty(); }
+
+    // The number of cached tables.
+    static size_t cacheSize();
+    static void clearCache();
+
+private:
+    explicit ReachabilityTable(const CoreField& field);
+
+    KeySetSeq keyStrokes_[7][4];
+};
+
+#endif // CORE_REACHABILITY_TABLE_H_
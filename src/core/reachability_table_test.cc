@@ -0,0 +1,150 @@
+#include "core/reachability_table.h"
+
+#include <gtest/gtest.h>
+
+#include "core/core_field.h"
+#include "core/decision.h"
+#include "core/kumipuyo_moving_state.h"
+#include "core/plain_field.h"
+#include "core/puyo_color.h"
+
+using namespace std;
+
+namespace {
+
+void setHeights(CoreField* f, const int heights[7])
+{
+    for (int x = 1; x <= 6; ++x) {
+        while (f->height(x) > heights[x])
+            f->removePuyoFrom(x);
+        while (f->height(x) < heights[x])
+            f->dropPuyoOn(x, PuyoColor::OJAMA);
+    }
+}
+
+}
+
+TEST(ReachabilityTableTest, emptyField)
+{
+    CoreField f;
+    shared_ptr<const ReachabilityTable> table = ReachabilityTable::instance(f);
+
+    PlainField pf = f.toPlainField();
+    for (int x = 1; x <= 6; ++x) {
+        for (int r = 0; r < 4; ++r) {
+            Decision d(x, r);
+            if (!d.isValid())
+                continue;
+            EXPECT_TRUE(table->isReachable(d)) << d;
+            EXPECT_EQ(KeySet(Key::DOWN), table->keyStroke(d).back());
+
+            // The key stroke is frame by frame.
+            KumipuyoMovingState mks(KumipuyoMovingState::initialState());
+            bool downAccepted;
+            for (const KeySet& ks : table->keyStroke(d))
+                mks.moveKumipuyo(pf, ks, &downAccepted);
+            EXPECT_EQ(x, mks.pos.axisX()) << d << ' ' << table->keyStroke(d);
+            EXPECT_EQ(r, mks.pos.rot()) << d << ' ' << table->keyStroke(d);
+        }
+    }
+}
+
+TEST(ReachabilityTableTest, sameAsFindKeyStroke)
+{
+    // Searching unreachable decisions visits all the states, so we check only some fields.
+    static const int HEIGHTS[][7] = {
+        { 0, 0, 0, 0, 0, 0, 0 },
+        { 0, 11, 12, 10, 12, 11, 10 },
+        { 0, 12, 11, 10, 11, 12, 13 },
+        { 0, 13, 12, 11, 12, 12, 10 },
+        { 0, 10, 10, 11, 13, 11, 12 },
+    };
+
+    CoreField f;
+    for (const auto& heights : HEIGHTS) {
+        setHeights(&f, heights);
+
+        shared_ptr<const ReachabilityTable> table = ReachabilityTable::instance(f);
+        PlainField pf = f.toPlainField();
+        for (int x = 1; x <= 6; ++x) {
+            for (int r = 0; r < 4; ++r) {
+                Decision d(x, r);
+                if (!d.isValid())
+                    continue;
+                KeySetSeq expected = ReachabilityTable::findKeyStroke(pf, KumipuyoMovingState::initialState(), d);
+                EXPECT_EQ(expected, table->keyStroke(d)) << f.toDebugString() << d;
+            }
+        }
+    }
+}
+
+TEST(ReachabilityTableTest, unreachable)
+{
+    CoreField f(
+        " O O  "
+        " O O  " // 12
+        " O O  "
+        " O O  "
+        " O O  "
+        " O O  " // 8
+        " O O  "
+        " O O  "
+        " O O  "
+        " O O  " // 4
+        " O O  "
+        " O O  "
+        " O O  ");
+
+    shared_ptr<const ReachabilityTable> table = ReachabilityTable::instance(f);
+    EXPECT_TRUE(table->isReachable(Decision(3, 0)));
+    EXPECT_TRUE(table->isReachable(Decision(3, 2)));
+    EXPECT_FALSE(table->isReachable(Decision(1, 0)));
+    EXPECT_FALSE(table->isReachable(Decision(6, 3)));
+
+    EXPECT_TRUE(ReachabilityTable::isReachable(f, Decision(3, 0)));
+    EXPECT_FALSE(ReachabilityTable::isReachable(f, Decision(1, 0)));
+}
+
+TEST(ReachabilityTableTest, cachedByHeights)
+{
+    ReachabilityTable::clearCache();
+
+    CoreField f1("RBYG..");
+    CoreField f2("OOOO..");
+    CoreField f3("OOOOO.");
+
+    shared_ptr<const ReachabilityTable> t1 = ReachabilityTable::instance(f1);
+    shared_ptr<const ReachabilityTable> t2 = ReachabilityTable::instance(f2);
+    shared_ptr<const ReachabilityTable> t3 = ReachabilityTable::instance(f3);
+    EXPECT_EQ(t1.get(), t2.get());
+    EXPECT_NE(t1.get(), t3.get());
+    EXPECT_EQ(2U, ReachabilityTable::cacheSize());
+}
+
+TEST(ReachabilityTableTest, isReachableAfterClearCache)
+{
+    CoreField f1("OOOOO.");
+    CoreField f2(
+        " O O  "
+        " O O  " // 12
+        " O O  "
+        " O O  "
+        " O O  "
+        " O O  " // 8
+        " O O  "
+        " O O  "
+        " O O  "
+        " O O  " // 4
+        " O O  "
+        " O O  "
+        " O O  ");
+
+    EXPECT_TRUE(ReachabilityTable::isReachable(f1, Decision(1, 0)));
+    EXPECT_FALSE(ReachabilityTable::isReachable(f2, Decision(1, 0)));
+    EXPECT_TRUE(ReachabilityTable::isReachable(f1, Decision(1, 0)));
+
+    // The table remembered by this thread is not used after clearCache().
+    ReachabilityTable::clearCache();
+    EXPECT_TRUE(ReachabilityTable::isReachable(f1, Decision(1, 0)));
+    EXPECT_EQ(1U, ReachabilityTable::cacheSize());
+}
@@ -7,6 +7,7 @@
 #include <string>
 
 #include "base/base.h"
+#include "base/instrumentation.h"
 #include "core/column_puyo.h"
 #include "core/column_puyo_list.h"
 #include "core/core_field.h"
@@ -427,6 +428,8 @@ void RensaDetector::detect(const CoreField& originalField,
                            const bool prohibits[FieldConstant::MAP_WIDTH],
                            const RensaDetector::ComplementCallback& callback)
 {
+    INSTRUMENT_SCOPE("RensaDetector::detect");
+
     int maxPuyoHeight = 12;
     int complementPuyos;
     switch (purpose) {
@@ -472,6 +475,7 @@ void RensaDetector::detectIteratively(const CoreField& originalField,
                                       int maxIteration,
                                       const RensaSimulationCallback& callback)
 {
+    INSTRUMENT_SCOPE("RensaDetector::detectIteratively");
     DCHECK_LE(1, maxIteration);
 
     auto detectCallback = [&](CoreField&& complementedField, const ColumnPuyoList& firePuyos) {
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <iostream>
 
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 #include "core/core_field.h"
 
@@ -33,7 +34,7 @@ TEST(RensaDetectorPerformanceTest, detectIteratively_Drop)
         RensaDetector::detectIteratively(original, RensaDetectorStrategy::defaultDropStrategy(), 3, callback);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(RensaDetectorPerformanceTest, detectIteratively_Float)
@@ -55,7 +56,7 @@ TEST(RensaDetectorPerformanceTest, detectIteratively_Float)
         RensaDetector::detectIteratively(original, RensaDetectorStrategy::defaultFloatStrategy(), 3, callback);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(RensaDetectorPerformanceTest, detectIteratively_Extend)
@@ -77,5 +78,5 @@ TEST(RensaDetectorPerformanceTest, detectIteratively_Extend)
         RensaDetector::detectIteratively(original, RensaDetectorStrategy::defaultExtendStrategy(), 3, callback);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
@@ -5,8 +5,9 @@
 
 using namespace std;
 
-RensaChainTrackResult::RensaChainTrackResult() :
-    erasedAt_ {}
+const int RensaChainTrackResult::MAX_CHAIN;
+
+RensaChainTrackResult::RensaChainTrackResult()
 {
 }
 
@@ -23,24 +24,55 @@ RensaChainTrackResult::RensaChainTrackResult(const string& s) :
             continue;
 
         if ('0' <= s[i] && s[i] <= '9')
-            erasedAt_[x][y] = s[i] - '0';
+            setErasedAt(x, y, s[i] - '0');
         else if ('A' <= s[i] && s[i] <= 'F')
-            erasedAt_[x][y] = s[i] - 'A' + 10;
+            setErasedAt(x, y, s[i] - 'A' + 10);
         else if ('a' <= s[i] && s[i] <= 'f')
-            erasedAt_[x][y] = s[i] - 'a' + 10;
+            setErasedAt(x, y, s[i] - 'a' + 10);
         else
             CHECK(false) << s[i];
     }
 }
 
-RensaChainTrackResult& RensaChainTrackResult::operator=(const RensaChainTrackResult& result)
+int RensaChainTrackResult::erasedAt(int x, int y) const
 {
-    for (int x = 0; x < FieldConstant::MAP_WIDTH; ++x) {
-        for (int y = 0; y < FieldConstant::MAP_HEIGHT; ++y)
-            erasedAt_[x][y] = result.erasedAt_[x][y];
+    int nthChain = 0;
+    for (int k = 0; k < 5; ++k) {
+        if (bits_[k].get(x, y))
+            nthChain |= 1 << k;
     }
+    return nthChain;
+}
+
+void RensaChainTrackResult::setErasedAt(int x, int y, int nthChain)
+{
+    setErasedAt(FieldBits(x, y), nthChain);
+}
+
+void RensaChainTrackResult::setErasedAt(const FieldBits& bits, int nthChain)
+{
+    DCHECK(0 <= nthChain && nthChain <= MAX_CHAIN) << nthChain;
 
-    return *this;
+    for (int k = 0; k < 5; ++k) {
+        if (nthChain & (1 << k))
+            bits_[k].setAll(bits);
+        else
+            bits_[k].unsetAll(bits);
+    }
+}
+
+FieldBits RensaChainTrackResult::erasedBits(int nthChain) const
+{
+    DCHECK(0 <= nthChain && nthChain <= MAX_CHAIN) << nthChain;
+
+    FieldBits bits(_mm_set1_epi8(-1));
+    for (int k = 0; k < 5; ++k) {
+        if (nthChain & (1 << k))
+            bits = bits.mask(bits_[k]);
+        else
+            bits = bits.notmask(bits_[k]);
+    }
+    return bits;
 }
 
 string RensaChainTrackResult::toString() const
@@ -48,7 +80,7 @@ string RensaChainTrackResult::toString() const
     ostringstream ss;
     for (int y = FieldConstant::HEIGHT; y >= 1; --y) {
         for (int x = 1; x <= FieldConstant::WIDTH; ++x)
-            ss << std::setw(3) << static_cast<int>(erasedAt_[x][y]);
+            ss << std::setw(3) << erasedAt(x, y);
         ss << '\n';
     }
 
@@ -13,16 +13,24 @@ public:
     RensaChainTrackResult();
     explicit RensaChainTrackResult(const std::string&);
 
-    RensaChainTrackResult& operator=(const RensaChainTrackResult& result);
+    // The maximum chain this result can hold.
+    static const int MAX_CHAIN = (1 << 5) - 1;
 
     // Nth Rensa where (x, y) is erased. 0 if not erased.
-    int erasedAt(int x, int y) const { return erasedAt_[x][y]; }
-    void setErasedAt(int x, int y, int nthChain) { erasedAt_[x][y] = nthChain; }
+    int erasedAt(int x, int y) const;
+    void setErasedAt(int x, int y, int nthChain);
+    // Sets the positions in |bits| are erased at |nthChain|.
+    void setErasedAt(const FieldBits& bits, int nthChain);
+
+    // Returns the positions erased at |nthChain|.
+    FieldBits erasedBits(int nthChain) const;
 
     std::string toString() const;
 
 private:
-    std::uint8_t erasedAt_[FieldConstant::MAP_WIDTH][FieldConstant::MAP_HEIGHT];
+    // The chain number is stored bit-sliced. The k-th bit of erasedAt(x, y) is
+    // bits_[k].get(x, y), so one chain can be recorded with a few bit operations.
+    FieldBits bits_[5];
 };
 
 // RensaTracker<RensaChainTrackResult> tracks in what-th rensa a puyo is vanished.
@@ -33,18 +41,11 @@ public:
 
     const RensaChainTrackResult& result() const { return result_; }
 
-    void trackCoef(int nthChain, int numErasedPuyo, int longBonusCoef, int colorBonusCoef)
-    {
-        yTracker_.trackCoef(nthChain, numErasedPuyo, longBonusCoef, colorBonusCoef);
-    }
+    void trackCoef(int /*nthChain*/, int /*numErasedPuyo*/, int /*longBonusCoef*/, int /*colorBonusCoef*/) {}
 
-    void trackVanish(int nthChain, const FieldBits& vanishedPuyoBits, const FieldBits& vanishedOjamaPuyoBits)
+    void trackVanish(int nthChain, const FieldBits& vanishedPuyoBits, const FieldBits& /*vanishedOjamaPuyoBits*/)
     {
-        vanishedPuyoBits.iterateBitPositions([&](int x, int y) {
-            result_.setErasedAt(x, yTracker_.originalY(x, y), nthChain);
-        });
-
-        yTracker_.trackVanish(nthChain, vanishedPuyoBits, vanishedOjamaPuyoBits);
+        result_.setErasedAt(originalBitsTracker_.vanish(vanishedPuyoBits), nthChain);
     }
 
     void trackDrop(FieldBits /*blender*/, FieldBits /*leftOnes*/, FieldBits /*rightOnes*/) {}
@@ -53,7 +54,7 @@ public:
 #endif
 
 private:
-    RensaYPositionTracker yTracker_;
+    RensaOriginalBitsTracker originalBitsTracker_;
     RensaChainTrackResult result_;
 };
 typedef RensaTracker<RensaChainTrackResult> RensaChainTracker;
@@ -69,18 +70,11 @@ public:
 
     const RensaChainTrackResult& result() const { return *result_; }
 
-    void trackCoef(int nthChain, int numErasedPuyo, int longBonusCoef, int colorBonusCoef)
-    {
-        yTracker_.trackCoef(nthChain, numErasedPuyo, longBonusCoef, colorBonusCoef);
-    }
+    void trackCoef(int /*nthChain*/, int /*numErasedPuyo*/, int /*longBonusCoef*/, int /*colorBonusCoef*/) {}
 
-    void trackVanish(int nthChain, const FieldBits& vanishedPuyoBits, const FieldBits& vanishedOjamaPuyoBits)
+    void trackVanish(int nthChain, const FieldBits& vanishedPuyoBits, const FieldBits& /*vanishedOjamaPuyoBits*/)
     {
-        vanishedPuyoBits.iterateBitPositions([&](int x, int y) {
-            result_->setErasedAt(x, yTracker_.originalY(x, y), nthChain);
-        });
-
-        yTracker_.trackVanish(nthChain, vanishedPuyoBits, vanishedOjamaPuyoBits);
+        result_->setErasedAt(originalBitsTracker_.vanish(vanishedPuyoBits), nthChain);
     }
 
     void trackDrop(FieldBits /*blender*/, FieldBits /*leftOnes*/, FieldBits /*rightOnes*/) {}
@@ -89,7 +83,7 @@ public:
 #endif
 
 private:
-    RensaYPositionTracker yTracker_;
+    RensaOriginalBitsTracker originalBitsTracker_;
     RensaChainTrackResult* result_;
 };
 
@@ -75,3 +75,36 @@ TEST(RensaChainTrackerTest, simulate2)
     EXPECT_EQ(0, trackResult.erasedAt(4, 2));
     EXPECT_EQ(0, trackResult.erasedAt(6, 1));
 }
+
+TEST(RensaChainTrackerTest, erasedBits)
+{
+    CoreField cf("R...R."
+                 "RBYRGR"
+                 "RRBYYG"
+                 "BBYGGR");
+
+    RensaChainTracker tracker;
+    RensaResult rensaResult = cf.simulate(&tracker);
+    EXPECT_EQ(5, rensaResult.chains);
+
+    const RensaChainTrackResult& trackResult = tracker.result();
+    for (int nthChain = 1; nthChain <= 5; ++nthChain) {
+        FieldBits bits = trackResult.erasedBits(nthChain);
+        for (int x = 1; x <= 6; ++x) {
+            for (int y = 1; y <= 12; ++y) {
+                EXPECT_EQ(trackResult.erasedAt(x, y) == nthChain, bits.get(x, y))
+                    << "nthChain=" << nthChain << " x=" << x << " y=" << y;
+            }
+        }
+    }
+}
+
+TEST(RensaChainTrackResult, overwrite)
+{
+    RensaChainTrackResult rtr;
+    rtr.setErasedAt(1, 1, 19);
+    EXPECT_EQ(19, rtr.erasedAt(1, 1));
+    rtr.setErasedAt(1, 1, 4);
+    EXPECT_EQ(4, rtr.erasedAt(1, 1));
+    EXPECT_EQ(0, rtr.erasedAt(1, 2));
+}
@@ -3,40 +3,84 @@
 #include <gtest/gtest.h>
 
 #include "base/base.h"
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 #include "core/core_field.h"
+#include "core/rensa_tracker.h"
 #include "core/rensa_tracker/rensa_chain_tracker.h"
+#include "core/rensa_tracker/rensa_coef_tracker.h"
+#include "core/rensa_tracker/rensa_composite_tracker.h"
+#include "core/rensa_tracker/rensa_existing_position_tracker.h"
+#include "core/rensa_tracker/rensa_last_vanished_position_tracker.h"
+#include "core/rensa_tracker/rensa_vanishing_position_tracker.h"
 
 using namespace std;
 
 namespace {
 
-static void runSimulation(const CoreField& original)
+const int N = 100000;
+
+// Runs simulate() with the tracker made by |makeTracker| N times.
+template<typename MakeTracker>
+TimeStampCounterData measure(const CoreField& original, int expectedChain, MakeTracker makeTracker)
 {
-    const int expectedChain = CoreField(original).simulate().chains;
+    TimeStampCounterData tsc;
+    for (int i = 0; i < N; ++i) {
+        CoreField cf(original);
+        auto tracker = makeTracker(cf);
+        ScopedTimeStampCounter stsc(&tsc);
+        EXPECT_EQ(expectedChain, cf.simulate(&tracker).chains);
+    }
+    return tsc;
+}
 
-    const int N = 100000;
+// Reports |tsc| and shows the overhead relative to |base|.
+void report(const char* name, const TimeStampCounterData& tsc, const BenchmarkResult& base)
+{
+    BenchmarkResult result = reportTestBenchmark(tsc, name);
+    cout << "overhead: " << (result.median - base.median) / base.median * 100 << "%" << endl;
+}
 
-    TimeStampCounterData tscCoreField;
-    TimeStampCounterData tscCoreFieldWithRensaChainTracker;
+void runSimulation(const CoreField& original)
+{
+    const int expectedChain = CoreField(original).simulate().chains;
 
-    for (int i = 0; i < N; i++) {
-        CoreField cf(original);
-        ScopedTimeStampCounter stsc(&tscCoreField);
-        EXPECT_EQ(expectedChain, cf.simulate().chains);
-    }
+    TimeStampCounterData tscNon = measure(original, expectedChain, [](const CoreField&) {
+        return RensaNonTracker();
+    });
+    TimeStampCounterData tscChain = measure(original, expectedChain, [](const CoreField&) {
+        return RensaChainTracker();
+    });
+    TimeStampCounterData tscCoef = measure(original, expectedChain, [](const CoreField&) {
+        return RensaCoefTracker();
+    });
+    TimeStampCounterData tscExisting = measure(original, expectedChain, [](const CoreField& cf) {
+        return RensaExistingPositionTracker(cf.bitField().normalColorBits());
+    });
+    TimeStampCounterData tscLastVanished = measure(original, expectedChain, [](const CoreField&) {
+        return RensaLastVanishedPositionTracker();
+    });
+    TimeStampCounterData tscVanishing = measure(original, expectedChain, [](const CoreField&) {
+        return RensaVanishingPositionTracker();
+    });
 
+    TimeStampCounterData tscComposite;
     for (int i = 0; i < N; ++i) {
         CoreField cf(original);
-        RensaChainTracker tracker;
-        ScopedTimeStampCounter stsc(&tscCoreFieldWithRensaChainTracker);
+        RensaChainTracker chainTracker;
+        RensaCoefTracker coefTracker;
+        RensaCompositeTracker<RensaChainTracker, RensaCoefTracker> tracker(&chainTracker, &coefTracker);
+        ScopedTimeStampCounter stsc(&tscComposite);
         EXPECT_EQ(expectedChain, cf.simulate(&tracker).chains);
     }
 
-    cout << "CoreField: " << endl;
-    tscCoreField.showStatistics();
-    cout << "CoreField (RensaChainTracker): " << endl;
-    tscCoreFieldWithRensaChainTracker.showStatistics();
+    BenchmarkResult base = reportTestBenchmark(tscNon, "RensaNonTracker");
+    report("RensaChainTracker", tscChain, base);
+    report("RensaCoefTracker", tscCoef, base);
+    report("RensaExistingPositionTracker", tscExisting, base);
+    report("RensaLastVanishedPositionTracker", tscLastVanished, base);
+    report("RensaVanishingPositionTracker", tscVanishing, base);
+    report("RensaCompositeTracker (chain, coef)", tscComposite, base);
 }
 
 } // namespace anonymous
@@ -49,4 +49,39 @@ private:
     std::uint64_t originalY_[FieldConstant::MAP_WIDTH];
 };
 
+// RensaOriginalBitsTracker converts FieldBits in the current field to FieldBits in the
+// original field (the field before the rensa started). Unlike RensaYPositionTracker,
+// this converts all the positions at once with one PDEP per column.
+class RensaOriginalBitsTracker {
+public:
+    RensaOriginalBitsTracker() : remainingBits_(_mm_set1_epi8(-1)) {}
+
+    // Returns the bits in the original field corresponding to |currentBits|.
+    FieldBits originalBits(const FieldBits& currentBits) const
+    {
+        // The puyo at the current y is the y-th (0-origin) remaining puyo in the column.
+        union {
+            std::uint16_t cols[FieldConstant::MAP_WIDTH];
+            __m128i m;
+        } current, remaining, result;
+        current.m = currentBits;
+        remaining.m = remainingBits_;
+        result.m = _mm_setzero_si128();
+        for (int x = 1; x <= 6; ++x)
+            result.cols[x] = static_cast<std::uint16_t>(bmi::depositBits(current.cols[x], remaining.cols[x]));
+        return result.m;
+    }
+
+    // Marks |vanishedPuyoBits| as vanished. Returns their bits in the original field.
+    FieldBits vanish(const FieldBits& vanishedPuyoBits)
+    {
+        FieldBits bits = originalBits(vanishedPuyoBits);
+        remainingBits_.unsetAll(bits);
+        return bits;
+    }
+
+private:
+    FieldBits remainingBits_;
+};
+
 #endif // CORE_RENSA_RENSA_YPOSITION_TRACKER_H_
@@ -0,0 +1,18 @@
+#include "core/search/beam_search.h"
+
+#include <sstream>
+
+using namespace std;
+
+string BeamSearchDepthStats::toString() const
+{
+    ostringstream oss;
+    oss << "depth=" << depth
+        << " states=" << numStates
+        << " children=" << numChildren
+        << " duplicates=" << numDuplicates
+        << " kept=" << numKept
+        << " expand=" << expandTime.count() << "us"
+        << " select=" << selectTime.count() << "us";
+    return oss.str();
+}
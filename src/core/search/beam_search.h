@@ -0,0 +1,314 @@
+#ifndef CORE_SEARCH_BEAM_SEARCH_H_
+#define CORE_SEARCH_BEAM_SEARCH_H_
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "base/concurrent_hash_set.h"
+#include "base/executor.h"
+#include "base/noncopyable.h"
+#include "base/wait_group.h"
+#include "core/decision.h"
+
+struct BeamSearchOptions {
+    // The number of states kept in each depth.
+    int beamWidth = 400;
+    // The maximum number of states sharing the same first decision kept in each depth.
+    // This keeps the beam from being occupied by a single first decision. 0 means no limit.
+    int maxStatesPerFirstDecision = 0;
+    // When true, a child is removed if the same state has been seen in any depth since the
+    // last reset(). By default, only the duplicates in the same depth are removed, because
+    // the same field reached in a different depth is a different state (e.g. it has consumed
+    // a different number of kumipuyos).
+    bool removeDuplicatesAcrossDepths = false;
+    // When |executor| is set, states are expanded in |numTasks| tasks in parallel.
+    Executor* executor = nullptr;
+    int numTasks = 1;
+};
+
+// BeamSearchVisitor is passed to Evaluator::expand(). When generating a child is expensive,
+// expand() can call visit() with the child's hash before the expensive part, and skip the
+// child when visit() returns false, i.e. the child is a duplicate. The children expand()
+// doesn't visit are deduplicated after expand() returns.
+class BeamSearchVisitor : noncopyable {
+public:
+    // Returns false if a state having |hash| has already been seen.
+    bool visit(size_t hash)
+    {
+        if (!visited_->insert(hash)) {
+            ++numSkipped_;
+            return false;
+        }
+        visitedInExpand_.push_back(hash);
+        return true;
+    }
+
+private:
+    template<typename State, typename Evaluator> friend class BeamSearch;
+
+    explicit BeamSearchVisitor(ConcurrentHashSet* visited) : visited_(visited) {}
+
+    // Forgets the hashes visited in the previous expand().
+    void clear()
+    {
+        visitedInExpand_.clear();
+        numSkipped_ = 0;
+    }
+
+    // Returns true if |hash| was visited in expand() and hasn't been taken yet.
+    bool take(size_t hash)
+    {
+        for (size_t& h : visitedInExpand_) {
+            if (h == hash) {
+                h = visitedInExpand_.back();
+                visitedInExpand_.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ConcurrentHashSet* visited_;
+    std::vector<size_t> visitedInExpand_;
+    // The number of children skipped in expand().
+    int numSkipped_ = 0;
+};
+
+// Statistics of one depth of BeamSearch.
+struct BeamSearchDepthStats {
+    int depth = 0;
+    // The number of states expanded in this depth.
+    int numStates = 0;
+    // The number of generated children, including the duplicated ones.
+    int numChildren = 0;
+    int numDuplicates = 0;
+    // The number of children kept for the next depth.
+    int numKept = 0;
+    std::chrono::microseconds expandTime {0};
+    std::chrono::microseconds selectTime {0};
+
+    std::string toString() const;
+};
+
+// BeamSearch is a generic beam search engine.
+//
+// State must have
+//   size_t hash() const;              // Used to remove duplicated states.
+//   Decision firstDecision() const;   // Used for the quota of each first decision.
+//
+// Evaluator must have
+//   void expand(const State&, int depth, BeamSearchVisitor*, std::vector<State>* children) const;
+//   Score evaluate(const State&) const;
+// where Score is any type comparable with operator<. A larger score is better.
+// Both are called from several threads when an executor is given.
+// evaluate() is called only for the children which are not duplicates.
+//
+// When states are expanded in parallel, which of the states having the same hash
+// survives depends on timing. Use a single task if you need reproducible results.
+template<typename State, typename Evaluator>
+class BeamSearch : noncopyable {
+public:
+    typedef typename std::decay<decltype(std::declval<const Evaluator&>().evaluate(std::declval<const State&>()))>::type Score;
+
+    BeamSearch(const Evaluator* evaluator, const BeamSearchOptions& options) :
+        evaluator_(evaluator), options_(options)
+    {
+        CHECK_GT(options_.beamWidth, 0);
+        CHECK_GT(options_.numTasks, 0);
+    }
+
+    // Expands |states| once, and returns the best children sorted by score (best first).
+    // The children are deduplicated in this depth, or against all the states seen since
+    // the last reset() if |removeDuplicatesAcrossDepths| is set.
+    std::vector<State> step(const std::vector<State>& states, int depth);
+
+    // Runs step() from |initialStates| up to |maxDepth| times. Stops when no state is left.
+    // Returns the states in the last depth, best first.
+    std::vector<State> run(const std::vector<State>& initialStates, int maxDepth)
+    {
+        reset();
+        std::vector<State> states(initialStates);
+        for (int depth = 0; depth < maxDepth; ++depth) {
+            std::vector<State> next = step(states, depth);
+            if (next.empty())
+                break;
+            states = std::move(next);
+        }
+        return states;
+    }
+
+    // Forgets the visited states and the statistics.
+    void reset()
+    {
+        visited_.clear();
+        stats_.clear();
+    }
+
+    const std::vector<BeamSearchDepthStats>& stats() const { return stats_; }
+
+private:
+    struct Child {
+        State state;
+        Score score;
+        size_t hash;
+    };
+
+    void expandRange(const std::vector<State>& states, size_t begin, size_t end, int depth,
+                     std::vector<Child>* children, int* numChildren, int* numDuplicates);
+    // Returns the indices of the best children.
+    std::vector<size_t> selectTop(const std::vector<Child>& children) const;
+
+    const Evaluator* evaluator_;
+    const BeamSearchOptions options_;
+    ConcurrentHashSet visited_;
+    std::vector<BeamSearchDepthStats> stats_;
+};
+
+template<typename State, typename Evaluator>
+std::vector<State> BeamSearch<State, Evaluator>::step(const std::vector<State>& states, int depth)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    BeamSearchDepthStats stats;
+    stats.depth = depth;
+    stats.numStates = states.size();
+
+    Clock::time_point beginTime = Clock::now();
+
+    if (!options_.removeDuplicatesAcrossDepths)
+        visited_.clear();
+
+    const int numTasks = options_.executor ? std::min<int>(options_.numTasks, std::max<size_t>(1, states.size())) : 1;
+    std::vector<std::vector<Child>> taskChildren(numTasks);
+    std::vector<int> taskNumChildren(numTasks);
+    std::vector<int> taskNumDuplicates(numTasks);
+
+    if (numTasks == 1) {
+        expandRange(states, 0, states.size(), depth, &taskChildren[0], &taskNumChildren[0], &taskNumDuplicates[0]);
+    } else {
+        WaitGroup wg;
+        wg.add(numTasks);
+        for (int i = 0; i < numTasks; ++i) {
+            size_t begin = states.size() * i / numTasks;
+            size_t end = states.size() * (i + 1) / numTasks;
+            options_.executor->submit([&, i, begin, end]() {
+                expandRange(states, begin, end, depth, &taskChildren[i], &taskNumChildren[i], &taskNumDuplicates[i]);
+                wg.done();
+            });
+        }
+        wg.waitUntilDone();
+    }
+
+    std::vector<Child> children;
+    if (numTasks == 1) {
+        children = std::move(taskChildren[0]);
+    } else {
+        size_t total = 0;
+        for (const auto& cs : taskChildren)
+            total += cs.size();
+        children.reserve(total);
+        for (auto& cs : taskChildren)
+            std::move(cs.begin(), cs.end(), std::back_inserter(children));
+    }
+    for (int i = 0; i < numTasks; ++i) {
+        stats.numChildren += taskNumChildren[i];
+        stats.numDuplicates += taskNumDuplicates[i];
+    }
+
+    Clock::time_point expandedTime = Clock::now();
+
+    std::vector<size_t> selected = selectTop(children);
+    std::vector<State> result;
+    result.reserve(selected.size());
+    for (size_t i : selected)
+        result.push_back(std::move(children[i].state));
+
+    Clock::time_point endTime = Clock::now();
+
+    stats.numKept = result.size();
+    stats.expandTime = std::chrono::duration_cast<std::chrono::microseconds>(expandedTime - beginTime);
+    stats.selectTime = std::chrono::duration_cast<std::chrono::microseconds>(endTime - expandedTime);
+    stats_.push_back(stats);
+
+    return result;
+}
+
+template<typename State, typename Evaluator>
+void BeamSearch<State, Evaluator>::expandRange(const std::vector<State>& states, size_t begin, size_t end, int depth,
+                                               std::vector<Child>* children, int* numChildren, int* numDuplicates)
+{
+    std::vector<State> generated;
+    BeamSearchVisitor visitor(&visited_);
+    for (size_t i = begin; i < end; ++i) {
+        generated.clear();
+        visitor.clear();
+        evaluator_->expand(states[i], depth, &visitor, &generated);
+        *numChildren += generated.size() + visitor.numSkipped_;
+        *numDuplicates += visitor.numSkipped_;
+        for (State& s : generated) {
+            size_t h = s.hash();
+            if (!visitor.take(h) && !visited_.insert(h)) {
+                ++*numDuplicates;
+                continue;
+            }
+            Score score = evaluator_->evaluate(s);
+            children->push_back(Child { std::move(s), std::move(score), h });
+        }
+    }
+}
+
+template<typename State, typename Evaluator>
+std::vector<size_t> BeamSearch<State, Evaluator>::selectTop(const std::vector<Child>& children) const
+{
+    // Better first. Ties are broken by hash so that the result doesn't depend on the order of children.
+    auto better = [&children](size_t lhs, size_t rhs) {
+        const Child& l = children[lhs];
+        const Child& r = children[rhs];
+        if (r.score < l.score)
+            return true;
+        if (l.score < r.score)
+            return false;
+        return l.hash < r.hash;
+    };
+
+    std::vector<size_t> candidates;
+    if (options_.maxStatesPerFirstDecision > 0) {
+        // Keeps at most maxStatesPerFirstDecision children for each first decision.
+        std::map<Decision, std::vector<size_t>> groups;
+        for (size_t i = 0; i < children.size(); ++i)
+            groups[children[i].state.firstDecision()].push_back(i);
+
+        const size_t quota = options_.maxStatesPerFirstDecision;
+        for (auto& entry : groups) {
+            std::vector<size_t>& indices = entry.second;
+            if (indices.size() > quota) {
+                std::nth_element(indices.begin(), indices.begin() + quota, indices.end(), better);
+                indices.resize(quota);
+            }
+            candidates.insert(candidates.end(), indices.begin(), indices.end());
+        }
+    } else {
+        candidates.resize(children.size());
+        for (size_t i = 0; i < children.size(); ++i)
+            candidates[i] = i;
+    }
+
+    const size_t width = options_.beamWidth;
+    if (candidates.size() > width) {
+        std::nth_element(candidates.begin(), candidates.begin() + width, candidates.end(), better);
+        candidates.resize(width);
+    }
+    // Only the kept children are sorted.
+    std::sort(candidates.begin(), candidates.end(), better);
+    return candidates;
+}
+
+#endif // CORE_SEARCH_BEAM_SEARCH_H_
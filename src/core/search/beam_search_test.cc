@@ -0,0 +1,186 @@
+#include "core/search/beam_search.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "base/executor.h"
+
+using namespace std;
+
+namespace {
+
+// A toy state: a number built by appending digits.
+struct NumberState {
+    size_t hash() const { return value; }
+    Decision firstDecision() const { return Decision(firstDigit + 1, 0); }
+
+    int firstDigit;
+    size_t value;
+};
+
+// Appends a digit in [0, numDigits). A larger value is better.
+class NumberEvaluator {
+public:
+    explicit NumberEvaluator(int numDigits) : numDigits_(numDigits) {}
+
+    void expand(const NumberState& state, int depth, BeamSearchVisitor*, vector<NumberState>* children) const
+    {
+        for (int d = 0; d < numDigits_; ++d) {
+            NumberState s { depth == 0 ? d : state.firstDigit, state.value * 10 + d };
+            children->push_back(s);
+        }
+    }
+
+    size_t evaluate(const NumberState& state) const { return state.value; }
+
+private:
+    int numDigits_;
+};
+
+// Every child has the same hash except the digit.
+class DigitOnlyEvaluator : public NumberEvaluator {
+public:
+    DigitOnlyEvaluator() : NumberEvaluator(3) {}
+
+    void expand(const NumberState& state, int depth, BeamSearchVisitor*, vector<NumberState>* children) const
+    {
+        for (int d = 0; d < 3; ++d) {
+            NumberState s { depth == 0 ? d : state.firstDigit, static_cast<size_t>(d) };
+            children->push_back(s);
+        }
+    }
+};
+
+vector<size_t> values(const vector<NumberState>& states)
+{
+    vector<size_t> result;
+    for (const auto& s : states)
+        result.push_back(s.value);
+    return result;
+}
+
+}
+
+TEST(BeamSearchTest, keepsTopStates)
+{
+    NumberEvaluator evaluator(5);
+    BeamSearchOptions options;
+    options.beamWidth = 3;
+    BeamSearch<NumberState, NumberEvaluator> search(&evaluator, options);
+
+    vector<NumberState> states = search.run(vector<NumberState> { NumberState { 0, 0 } }, 3);
+    EXPECT_EQ((vector<size_t> { 444, 443, 442 }), values(states));
+
+    ASSERT_EQ(3U, search.stats().size());
+    EXPECT_EQ(1, search.stats()[0].numStates);
+    EXPECT_EQ(5, search.stats()[0].numChildren);
+    EXPECT_EQ(3, search.stats()[0].numKept);
+    EXPECT_EQ(15, search.stats()[1].numChildren);
+}
+
+TEST(BeamSearchTest, maxStatesPerFirstDecision)
+{
+    NumberEvaluator evaluator(5);
+    BeamSearchOptions options;
+    options.beamWidth = 6;
+    options.maxStatesPerFirstDecision = 2;
+    BeamSearch<NumberState, NumberEvaluator> search(&evaluator, options);
+
+    vector<NumberState> states = search.run(vector<NumberState> { NumberState { 0, 0 } }, 2);
+    EXPECT_EQ((vector<size_t> { 44, 43, 34, 33, 24, 23 }), values(states));
+}
+
+TEST(BeamSearchTest, removesDuplicates)
+{
+    DigitOnlyEvaluator evaluator;
+    BeamSearchOptions options;
+    BeamSearch<NumberState, DigitOnlyEvaluator> search(&evaluator, options);
+
+    vector<NumberState> states = search.step(vector<NumberState> { NumberState { 0, 0 } }, 0);
+    EXPECT_EQ((vector<size_t> { 2, 1, 0 }), values(states));
+    EXPECT_EQ(0, search.stats()[0].numDuplicates);
+
+    // The children seen in the previous depth are kept, but only one of each in this depth.
+    states = search.step(states, 1);
+    EXPECT_EQ((vector<size_t> { 2, 1, 0 }), values(states));
+    EXPECT_EQ(6, search.stats()[1].numDuplicates);
+}
+
+TEST(BeamSearchTest, removesDuplicatesAcrossDepths)
+{
+    DigitOnlyEvaluator evaluator;
+    BeamSearchOptions options;
+    options.removeDuplicatesAcrossDepths = true;
+    BeamSearch<NumberState, DigitOnlyEvaluator> search(&evaluator, options);
+
+    vector<NumberState> states = search.step(vector<NumberState> { NumberState { 0, 0 } }, 0);
+    EXPECT_EQ((vector<size_t> { 2, 1, 0 }), values(states));
+    EXPECT_EQ(0, search.stats()[0].numDuplicates);
+
+    // All the children have been seen.
+    states = search.step(states, 1);
+    EXPECT_TRUE(states.empty());
+    EXPECT_EQ(9, search.stats()[1].numDuplicates);
+
+    // reset() forgets the states seen.
+    search.reset();
+    states = search.step(vector<NumberState> { NumberState { 0, 0 } }, 0);
+    EXPECT_EQ((vector<size_t> { 2, 1, 0 }), values(states));
+}
+
+TEST(BeamSearchTest, skipsDuplicatesInExpand)
+{
+    // Visits each child before generating it, as an evaluator would do
+    // when generating a child is expensive.
+    class VisitingEvaluator : public DigitOnlyEvaluator {
+    public:
+        void expand(const NumberState& state, int depth, BeamSearchVisitor* visitor, vector<NumberState>* children) const
+        {
+            for (int d = 0; d < 3; ++d) {
+                if (!visitor->visit(d))
+                    continue;
+                ++numGenerated;
+                children->push_back(NumberState { depth == 0 ? d : state.firstDigit, static_cast<size_t>(d) });
+            }
+        }
+
+        mutable int numGenerated = 0;
+    };
+
+    VisitingEvaluator evaluator;
+    BeamSearchOptions options;
+    BeamSearch<NumberState, VisitingEvaluator> search(&evaluator, options);
+
+    vector<NumberState> states = search.step(vector<NumberState> { NumberState { 0, 0 } }, 0);
+    states = search.step(states, 1);
+    EXPECT_EQ((vector<size_t> { 2, 1, 0 }), values(states));
+
+    // Only 3 children are generated in each depth.
+    EXPECT_EQ(6, evaluator.numGenerated);
+    EXPECT_EQ(9, search.stats()[1].numChildren);
+    EXPECT_EQ(6, search.stats()[1].numDuplicates);
+}
+
+TEST(BeamSearchTest, parallelSameAsSerial)
+{
+    NumberEvaluator evaluator(7);
+
+    BeamSearchOptions serialOptions;
+    serialOptions.beamWidth = 50;
+    serialOptions.maxStatesPerFirstDecision = 20;
+    BeamSearch<NumberState, NumberEvaluator> serial(&evaluator, serialOptions);
+
+    unique_ptr<Executor> executor(new Executor(4));
+    executor->start();
+    BeamSearchOptions parallelOptions(serialOptions);
+    parallelOptions.executor = executor.get();
+    parallelOptions.numTasks = 8;
+    BeamSearch<NumberState, NumberEvaluator> parallel(&evaluator, parallelOptions);
+
+    vector<NumberState> initial { NumberState { 0, 0 } };
+    EXPECT_EQ(values(serial.run(initial, 5)), values(parallel.run(initial, 5)));
+
+    executor->stop();
+}
@@ -0,0 +1,217 @@
+#include "core/search/rollout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+
+#include <glog/logging.h>
+
+#include "base/executor.h"
+#include "base/wait_group.h"
+#include "core/kumipuyo_seq.h"
+#include "core/kumipuyo_seq_generator.h"
+
+using namespace std;
+
+double RolloutStats::variance() const
+{
+    if (count < 2)
+        return 0.0;
+    double m = mean();
+    // Unbiased sample variance.
+    return max(0.0, (sumSquares - count * m * m) / (count - 1));
+}
+
+double RolloutStats::lowerBound(double z) const
+{
+    if (count == 0)
+        return -HUGE_VAL;
+    return mean() - z * sqrt(variance() / count);
+}
+
+double RolloutStats::upperBound(double z) const
+{
+    if (count == 0)
+        return HUGE_VAL;
+    return mean() + z * sqrt(variance() / count);
+}
+
+void RolloutStats::add(double value)
+{
+    ++count;
+    sum += value;
+    sumSquares += value * value;
+}
+
+const RolloutResult::Entry* RolloutResult::best() const
+{
+    const Entry* result = nullptr;
+    for (const Entry& entry : entries) {
+        if (entry.pruned)
+            continue;
+        if (!result || result->stats.mean() < entry.stats.mean())
+            result = &entry;
+    }
+    return result;
+}
+
+string RolloutResult::toString() const
+{
+    ostringstream oss;
+    oss << "rollouts=" << numRollouts;
+    if (stoppedEarly)
+        oss << " (stopped early)";
+    if (timedOut)
+        oss << " (timed out)";
+    for (const Entry& entry : entries) {
+        oss << " " << entry.decision.toString() << ":" << entry.stats.mean()
+            << "/" << entry.stats.count << (entry.pruned ? "x" : "");
+    }
+    return oss.str();
+}
+
+RolloutRunner::RolloutRunner(const RolloutOptions& options, Policy policy) :
+    options_(options),
+    policy_(std::move(policy))
+{
+    CHECK(policy_) << "policy should be callable";
+    CHECK_GT(options_.maxRollouts, 0);
+    CHECK_GT(options_.batchSize, 0);
+    CHECK_GT(options_.numTasks, 0);
+}
+
+// static
+vector<RolloutCandidate> RolloutRunner::makeCandidates(const CoreField& field, const KumipuyoSeq& seq)
+{
+    CHECK_GT(seq.size(), 0);
+
+    vector<RolloutCandidate> candidates;
+    Plan::iterateAvailablePlans(field, seq.subsequence(0, 1), 1, [&](const RefPlan& plan) {
+        candidates.push_back(RolloutCandidate { plan.firstDecision(), plan.toPlan() });
+    });
+    return candidates;
+}
+
+RolloutResult RolloutRunner::run(const CoreField& field, const KumipuyoSeq& seq) const
+{
+    return run(makeCandidates(field, seq), seq);
+}
+
+RolloutResult RolloutRunner::run(const vector<RolloutCandidate>& candidates, const KumipuyoSeq& seq) const
+{
+    typedef chrono::steady_clock Clock;
+    const Clock::time_point beginTime = Clock::now();
+
+    CHECK_GT(seq.size(), 0);
+    const KumipuyoSeq knownSeq(seq.subsequence(1));
+
+    RolloutResult result;
+    result.entries.resize(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i)
+        result.entries[i].decision = candidates[i].decision;
+
+    // values[i][k] is the value of the i-th candidate in the k-th rollout.
+    // Each rollout writes its own slots, so the tasks don't need a lock.
+    vector<vector<double>> values(candidates.size(), vector<double>(options_.maxRollouts));
+
+    // Even when a single candidate is left from the beginning, its value is estimated
+    // with minRollouts rollouts.
+    int numActive = candidates.size();
+    auto needsMoreRollouts = [&]() {
+        if (numActive == 0 || result.numRollouts >= options_.maxRollouts)
+            return false;
+        return numActive > 1 || result.numRollouts < options_.minRollouts;
+    };
+    while (needsMoreRollouts()) {
+        vector<bool> active(candidates.size());
+        for (size_t i = 0; i < candidates.size(); ++i)
+            active[i] = !result.entries[i].pruned;
+
+        const int begin = result.numRollouts;
+        const int end = min(options_.maxRollouts, begin + options_.batchSize);
+        const int numTasks = options_.executor ? min(options_.numTasks, end - begin) : 1;
+
+        if (numTasks == 1) {
+            runRange(candidates, active, knownSeq, begin, end, &values);
+        } else {
+            WaitGroup wg;
+            wg.add(numTasks);
+            for (int i = 0; i < numTasks; ++i) {
+                int taskBegin = begin + (end - begin) * i / numTasks;
+                int taskEnd = begin + (end - begin) * (i + 1) / numTasks;
+                options_.executor->submit([&, taskBegin, taskEnd]() {
+                    runRange(candidates, active, knownSeq, taskBegin, taskEnd, &values);
+                    wg.done();
+                });
+            }
+            wg.waitUntilDone();
+        }
+
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            if (!active[i])
+                continue;
+            for (int k = begin; k < end; ++k)
+                result.entries[i].stats.add(values[i][k]);
+        }
+        result.numRollouts = end;
+
+        if (result.numRollouts >= options_.minRollouts)
+            numActive = prune(values, &result);
+
+        if (options_.timeLimit.count() > 0 && Clock::now() - beginTime >= options_.timeLimit) {
+            result.timedOut = needsMoreRollouts();
+            break;
+        }
+    }
+
+    result.stoppedEarly = numActive <= 1 && result.numRollouts < options_.maxRollouts;
+    return result;
+}
+
+void RolloutRunner::runRange(const vector<RolloutCandidate>& candidates, const vector<bool>& active,
+                             const KumipuyoSeq& knownSeq, int begin, int end, vector<vector<double>>* values) const
+{
+    for (int k = begin; k < end; ++k) {
+        seed_seq seq { options_.seed, static_cast<uint32_t>(k) };
+        mt19937 mt(seq);
+
+        KumipuyoSeq rolloutSeq(knownSeq);
+        rolloutSeq.append(KumipuyoSeqGenerator::generateRandomSequenceWithMt19937(options_.randomSequenceSize, &mt));
+
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            if (active[i])
+                (*values)[i][k] = policy_(candidates[i], rolloutSeq);
+        }
+    }
+}
+
+int RolloutRunner::prune(const vector<vector<double>>& values, RolloutResult* result) const
+{
+    const RolloutResult::Entry* best = result->best();
+    if (!best)
+        return 0;
+    const vector<double>& bestValues = values[best - result->entries.data()];
+
+    // Since all the active candidates share the same random sequences, we compare
+    // the paired differences from the best candidate.
+    int numActive = 0;
+    for (size_t i = 0; i < result->entries.size(); ++i) {
+        RolloutResult::Entry& entry = result->entries[i];
+        if (entry.pruned)
+            continue;
+        if (&entry == best) {
+            ++numActive;
+            continue;
+        }
+
+        RolloutStats diff;
+        for (int k = 0; k < result->numRollouts; ++k)
+            diff.add(bestValues[k] - values[i][k]);
+        if (diff.lowerBound(options_.z) > 0)
+            entry.pruned = true;
+        else
+            ++numActive;
+    }
+    return numActive;
+}
@@ -0,0 +1,117 @@
+#ifndef CORE_SEARCH_ROLLOUT_H_
+#define CORE_SEARCH_ROLLOUT_H_
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "base/noncopyable.h"
+#include "core/decision.h"
+#include "core/plan/plan.h"
+
+class Executor;
+class KumipuyoSeq;
+
+struct RolloutOptions {
+    // The maximum number of rollouts per candidate.
+    int maxRollouts = 100;
+    // Rollouts are run in batches of this size. Early stopping and the time limit are
+    // checked between batches.
+    int batchSize = 10;
+    // Candidates are not pruned until they have this number of rollouts.
+    // A single candidate is also evaluated with this number of rollouts.
+    int minRollouts = 20;
+    // The number of random kumipuyos appended to the known sequence in each rollout.
+    int randomSequenceSize = 40;
+    // A candidate is pruned when the lower bound of (the best candidate's value - its value)
+    // over the shared rollouts is positive. The bounds are mean +- z * standard error.
+    double z = 1.96;
+    // 0 means no limit.
+    std::chrono::milliseconds timeLimit {0};
+    std::uint32_t seed = 1;
+    // When |executor| is set, each batch is split into |numTasks| tasks.
+    Executor* executor = nullptr;
+    int numTasks = 1;
+};
+
+// A candidate first move.
+struct RolloutCandidate {
+    Decision decision;
+    // The plan of the first move. The field is after the rensa, if any.
+    Plan plan;
+};
+
+struct RolloutStats {
+    double mean() const { return count > 0 ? sum / count : 0.0; }
+    double variance() const;
+    double lowerBound(double z) const;
+    double upperBound(double z) const;
+
+    void add(double value);
+
+    int count = 0;
+    double sum = 0.0;
+    double sumSquares = 0.0;
+};
+
+struct RolloutResult {
+    struct Entry {
+        Decision decision;
+        RolloutStats stats;
+        // true if this candidate was dropped by early stopping.
+        bool pruned = false;
+    };
+
+    // Returns the entry having the best mean among the candidates not pruned.
+    // nullptr if there is no candidate.
+    const Entry* best() const;
+
+    std::string toString() const;
+
+    // In the order of the candidates.
+    std::vector<Entry> entries;
+    // The number of random sequences generated.
+    int numRollouts = 0;
+    bool stoppedEarly = false;
+    bool timedOut = false;
+};
+
+// RolloutRunner estimates the value of each first move by playing the rest of the game
+// with a policy on random continuations of the known kumipuyo sequence.
+//
+// All the candidates are evaluated on the same random sequences (common random numbers),
+// and early stopping compares the paired differences, which have much lower variance
+// than the values themselves.
+// The i-th random sequence is generated from its own std::mt19937 seeded with (seed, i),
+// so the result doesn't depend on the number of tasks.
+class RolloutRunner : noncopyable {
+public:
+    // Returns the value of |candidate| when the next kumipuyos are |seq|.
+    // A larger value is better. Called from several threads when an executor is given.
+    typedef std::function<double (const RolloutCandidate& candidate, const KumipuyoSeq& seq)> Policy;
+
+    RolloutRunner(const RolloutOptions& options, Policy policy);
+
+    // Enumerates the first moves of |field| with |seq|.front().
+    static std::vector<RolloutCandidate> makeCandidates(const CoreField& field, const KumipuyoSeq& seq);
+
+    // |seq| must contain the current kumipuyo. The policy receives |seq| without the
+    // current kumipuyo, followed by random kumipuyos.
+    RolloutResult run(const CoreField& field, const KumipuyoSeq& seq) const;
+    RolloutResult run(const std::vector<RolloutCandidate>&, const KumipuyoSeq& seq) const;
+
+private:
+    // Runs the rollouts [begin, end) for the active candidates and stores the values to |values|.
+    void runRange(const std::vector<RolloutCandidate>&, const std::vector<bool>& active,
+                  const KumipuyoSeq& knownSeq, int begin, int end, std::vector<std::vector<double>>* values) const;
+    // Marks candidates that are worse than the best one with confidence as pruned.
+    // Returns the number of candidates not pruned.
+    int prune(const std::vector<std::vector<double>>& values, RolloutResult*) const;
+
+    const RolloutOptions options_;
+    Policy policy_;
+};
+
+#endif // CORE_SEARCH_ROLLOUT_H_
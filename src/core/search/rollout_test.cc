@@ -0,0 +1,159 @@
+#include "core/search/rollout.h"
+
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "base/executor.h"
+#include "core/core_field.h"
+#include "core/kumipuyo_seq.h"
+
+using namespace std;
+
+namespace {
+
+// A value in [0, 100) depending only on the random sequence.
+double noise(const KumipuyoSeq& seq)
+{
+    int v = 0;
+    for (int i = 0; i < seq.size(); ++i)
+        v = (v * 7 + static_cast<int>(seq.axis(i)) * 3 + static_cast<int>(seq.child(i))) % 100;
+    return v;
+}
+
+}
+
+TEST(RolloutTest, makeCandidates)
+{
+    CoreField field;
+    vector<RolloutCandidate> candidates = RolloutRunner::makeCandidates(field, KumipuyoSeq("RB"));
+    EXPECT_EQ(22U, candidates.size());
+
+    // Symmetric decisions are not enumerated twice.
+    candidates = RolloutRunner::makeCandidates(field, KumipuyoSeq("RR"));
+    EXPECT_EQ(11U, candidates.size());
+}
+
+TEST(RolloutTest, sameSequencesForAllCandidates)
+{
+    mutex mu;
+    set<string> seqs;
+    RolloutOptions options;
+    options.maxRollouts = 10;
+    options.randomSequenceSize = 5;
+    RolloutRunner runner(options, [&](const RolloutCandidate&, const KumipuyoSeq& seq) {
+        lock_guard<mutex> lock(mu);
+        seqs.insert(seq.toString());
+        return 0.0;
+    });
+
+    RolloutResult result = runner.run(CoreField(), KumipuyoSeq("RBYY"));
+    EXPECT_EQ(10, result.numRollouts);
+    // The known kumipuyos come first, and each rollout has its own random sequence.
+    EXPECT_EQ(10U, seqs.size());
+    for (const auto& s : seqs) {
+        EXPECT_EQ("YY", s.substr(0, 2));
+        EXPECT_EQ(12U, s.size());
+    }
+}
+
+TEST(RolloutTest, stopsEarlyWithCommonRandomNumbers)
+{
+    RolloutOptions options;
+    options.maxRollouts = 1000;
+    options.minRollouts = 10;
+    // The noise is much larger than the difference between candidates, but
+    // the difference is always the same on the shared sequences.
+    RolloutRunner runner(options, [](const RolloutCandidate& candidate, const KumipuyoSeq& seq) {
+        return noise(seq) + (candidate.decision == Decision(3, 0) ? 1 : 0);
+    });
+
+    RolloutResult result = runner.run(CoreField(), KumipuyoSeq("RB"));
+    EXPECT_TRUE(result.stoppedEarly);
+    EXPECT_EQ(10, result.numRollouts);
+    ASSERT_TRUE(result.best() != nullptr);
+    EXPECT_EQ(Decision(3, 0), result.best()->decision);
+    EXPECT_EQ(10, result.best()->stats.count);
+}
+
+TEST(RolloutTest, keepsCandidatesWithSameValue)
+{
+    RolloutOptions options;
+    options.maxRollouts = 30;
+    options.minRollouts = 10;
+    RolloutRunner runner(options, [](const RolloutCandidate& candidate, const KumipuyoSeq& seq) {
+        return noise(seq) + (candidate.decision.x >= 5 ? 1 : 0);
+    });
+
+    RolloutResult result = runner.run(CoreField(), KumipuyoSeq("RB"));
+    EXPECT_FALSE(result.stoppedEarly);
+    EXPECT_EQ(30, result.numRollouts);
+    for (const auto& entry : result.entries) {
+        EXPECT_EQ(entry.decision.x < 5, entry.pruned) << entry.decision;
+        if (entry.pruned)
+            EXPECT_EQ(10, entry.stats.count);
+        else
+            EXPECT_EQ(30, entry.stats.count);
+    }
+}
+
+TEST(RolloutTest, singleCandidate)
+{
+    RolloutOptions options;
+    options.maxRollouts = 100;
+    options.minRollouts = 20;
+    RolloutRunner runner(options, [](const RolloutCandidate&, const KumipuyoSeq& seq) {
+        return noise(seq);
+    });
+
+    vector<RolloutCandidate> candidates = RolloutRunner::makeCandidates(CoreField(), KumipuyoSeq("RB"));
+    candidates.resize(1);
+    RolloutResult result = runner.run(candidates, KumipuyoSeq("RB"));
+    EXPECT_TRUE(result.stoppedEarly);
+    EXPECT_EQ(20, result.numRollouts);
+    ASSERT_TRUE(result.best() != nullptr);
+    EXPECT_EQ(candidates[0].decision, result.best()->decision);
+    EXPECT_EQ(20, result.best()->stats.count);
+    EXPECT_LT(0, result.best()->stats.mean());
+}
+
+TEST(RolloutTest, noCandidate)
+{
+    RolloutOptions options;
+    RolloutRunner runner(options, [](const RolloutCandidate&, const KumipuyoSeq&) {
+        ADD_FAILURE() << "no rollout should run";
+        return 0.0;
+    });
+
+    RolloutResult result = runner.run(vector<RolloutCandidate>(), KumipuyoSeq("RB"));
+    EXPECT_EQ(0, result.numRollouts);
+    EXPECT_TRUE(result.best() == nullptr);
+}
+
+TEST(RolloutTest, parallelSameAsSerial)
+{
+    auto policy = [](const RolloutCandidate& candidate, const KumipuyoSeq& seq) {
+        return noise(seq) * (candidate.decision.x + candidate.decision.r);
+    };
+
+    RolloutOptions serialOptions;
+    serialOptions.maxRollouts = 50;
+    serialOptions.batchSize = 16;
+    RolloutRunner serial(serialOptions, policy);
+
+    unique_ptr<Executor> executor(new Executor(4));
+    executor->start();
+    RolloutOptions parallelOptions(serialOptions);
+    parallelOptions.executor = executor.get();
+    parallelOptions.numTasks = 4;
+    RolloutRunner parallel(parallelOptions, policy);
+
+    RolloutResult expected = serial.run(CoreField(), KumipuyoSeq("RBYG"));
+    RolloutResult actual = parallel.run(CoreField(), KumipuyoSeq("RBYG"));
+    EXPECT_EQ(expected.toString(), actual.toString());
+
+    executor->stop();
+}
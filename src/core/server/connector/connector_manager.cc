@@ -73,7 +73,7 @@ void ConnectorManager::runReceiverThreadLoop(int player_id)
             return;
         }
 
-        resp_queue_[player_id].push(resp);
+        resp_queue_[player_id].push(ReceivedResponse { resp, std::chrono::steady_clock::now() });
     }
 }
 
@@ -93,15 +93,21 @@ void ConnectorManager::setConnector(int playerId, std::unique_ptr<ServerConnecto
 }
 
 bool ConnectorManager::receive(int frameId, vector<FrameResponse> cfr[NUM_PLAYERS],
-                               const std::chrono::steady_clock::time_point& timeout_time)
+                               const std::chrono::steady_clock::time_point& timeout_time,
+                               vector<std::chrono::steady_clock::time_point> receivedTimes[NUM_PLAYERS])
 {
-    for (int i = 0; i < NUM_PLAYERS; ++i)
+    for (int i = 0; i < NUM_PLAYERS; ++i) {
         cfr[i].clear();
+        if (receivedTimes)
+            receivedTimes[i].clear();
+    }
 
     for (HumanConnector* ctr : humanConnectors_) {
         FrameResponse response;
         CHECK(ctr->receive(&response)) << "Human connector must be always receivable.";
         cfr[ctr->playerId()].push_back(response);
+        if (receivedTimes)
+            receivedTimes[ctr->playerId()].push_back(std::chrono::steady_clock::now());
     }
 
     // We have 16 milliseconds margin.
@@ -113,11 +119,13 @@ bool ConnectorManager::receive(int frameId, vector<FrameResponse> cfr[NUM_PLAYER
             continue;
 
         std::vector<FrameResponse> resps;
-        FrameResponse resp;
+        ReceivedResponse received;
 
-        while (resp_queue_[i].takeWithTimeout(timeout, &resp)) {
-            resps.push_back(resp);
-            if (resp.frameId == frameId)
+        while (resp_queue_[i].takeWithTimeout(timeout, &received)) {
+            resps.push_back(received.response);
+            if (receivedTimes)
+                receivedTimes[i].push_back(received.receivedTime);
+            if (received.response.frameId == frameId)
                 break;
         }
 
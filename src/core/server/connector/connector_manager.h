@@ -2,6 +2,7 @@
 #define CORE_SERVER_CONNECTOR_CONNECTOR_MANAGER_H_
 
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <vector>
@@ -20,8 +21,11 @@ public:
     explicit ConnectorManager(bool always_wait_timeout);
     ~ConnectorManager();
 
+    // If |receivedTimes| is not nullptr, the time when each response has arrived is stored
+    // in receivedTimes[playerId] in the same order as cfr[playerId].
     bool receive(int frameId, std::vector<FrameResponse> cfr[NUM_PLAYERS],
-                 const std::chrono::steady_clock::time_point& timeout_time);
+                 const std::chrono::steady_clock::time_point& timeout_time,
+                 std::vector<std::chrono::steady_clock::time_point> receivedTimes[NUM_PLAYERS] = nullptr);
 
     void setPlayer(int player_id, const std::string& program);
 
@@ -33,6 +37,11 @@ public:
     ServerConnector* connector(int i) { return connectors_[i].get(); }
 
 private:
+    struct ReceivedResponse {
+        FrameResponse response;
+        std::chrono::steady_clock::time_point receivedTime;
+    };
+
     static void receiverThreadDriver(ConnectorManager* manager, int player_id);
     void runReceiverThreadLoop(int player_id);
 
@@ -47,7 +56,7 @@ private:
 
     // If true, ConnectorManager always consume 16ms.
     bool always_wait_timeout_;
-    base::InfiniteBlockingQueue<FrameResponse> resp_queue_[2];
+    base::InfiniteBlockingQueue<ReceivedResponse> resp_queue_[2];
     std::thread receiver_thread_[2];
 };
 
@@ -48,12 +48,14 @@ string GameState::toJson() const
     root["o1"] = playerGameState_[0].ojama();
     root["n1"] = playerGameState_[0].kumipuyoSeq.toString();
     root["m1"] = playerGameState_[0].message;
+    root["l1"] = playerGameState_[0].thinkLatency;
 
     root["p2"] = f[1].toString();
     root["s2"] = playerGameState_[1].score;
     root["o2"] = playerGameState_[1].ojama();
     root["n2"] = playerGameState_[1].kumipuyoSeq.toString();
     root["m2"] = playerGameState_[1].message;
+    root["l2"] = playerGameState_[1].thinkLatency;
 
     Json::StyledWriter writer;
     return writer.write(root);
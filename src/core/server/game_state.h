@@ -28,6 +28,8 @@ struct PlayerGameState {
     int fixedOjama;
     Decision decision;
     std::string message;
+    // The summary of ThinkLatencyStats.
+    std::string thinkLatency;
 };
 
 class GameState {
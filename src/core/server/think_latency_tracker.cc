@@ -0,0 +1,29 @@
+#include "core/server/think_latency_tracker.h"
+
+#include <glog/logging.h>
+
+#include "core/frame_response.h"
+
+void ThinkLatencyTracker::requested(int frameId, bool fast, Clock::time_point sentTime)
+{
+    if (pending_) {
+        VLOG(1) << "decision request in frame " << frameId_ << " has not been answered";
+        stats_.addFallback();
+    }
+
+    pending_ = true;
+    frameId_ = frameId;
+    fast_ = fast;
+    sentTime_ = sentTime;
+}
+
+void ThinkLatencyTracker::received(const FrameResponse& response, Clock::time_point receivedTime)
+{
+    // A response for an older frame doesn't answer the request.
+    if (!pending_ || response.frameId < frameId_ || !response.decision.isValid())
+        return;
+
+    Clock::duration latency = receivedTime - sentTime_;
+    stats_.addAnswered(fast_, latency, latency > ThinkLatencyStats::DEADLINE);
+    pending_ = false;
+}
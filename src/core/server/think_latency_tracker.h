@@ -0,0 +1,38 @@
+#ifndef CORE_SERVER_THINK_LATENCY_TRACKER_H_
+#define CORE_SERVER_THINK_LATENCY_TRACKER_H_
+
+#include <chrono>
+
+#include "base/noncopyable.h"
+#include "core/think_latency_stats.h"
+
+struct FrameResponse;
+
+// ThinkLatencyTracker measures how long a player takes to answer each decision request,
+// from the server sending the request until the server receiving the response.
+class ThinkLatencyTracker : noncopyable {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    // A decision is requested in |frameId|. The request has been sent at |sentTime|.
+    // If the previous request hasn't been answered yet, it's counted as a fallback.
+    void requested(int frameId, bool fast, Clock::time_point sentTime);
+    // A response has been received at |receivedTime|. A response with a valid decision
+    // for the pending request answers it.
+    void received(const FrameResponse&, Clock::time_point receivedTime);
+    // Forgets the pending request, e.g. when a game has ended.
+    void reset() { pending_ = false; }
+
+    const ThinkLatencyStats& stats() const { return stats_; }
+    ThinkLatencyStats* mutableStats() { return &stats_; }
+
+private:
+    bool pending_ = false;
+    int frameId_ = 0;
+    bool fast_ = false;
+    Clock::time_point sentTime_;
+
+    ThinkLatencyStats stats_;
+};
+
+#endif // CORE_SERVER_THINK_LATENCY_TRACKER_H_
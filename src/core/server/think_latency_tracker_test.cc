@@ -0,0 +1,61 @@
+#include "core/server/think_latency_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include "core/frame_response.h"
+
+using namespace std;
+
+typedef ThinkLatencyTracker::Clock Clock;
+
+TEST(ThinkLatencyTrackerTest, answered)
+{
+    ThinkLatencyTracker tracker;
+    Clock::time_point t = Clock::now();
+
+    tracker.requested(10, false, t);
+    // A response without any decision doesn't answer the request.
+    tracker.received(FrameResponse(10), t + chrono::milliseconds(1));
+    EXPECT_EQ(0, tracker.stats().numRequests());
+
+    tracker.received(FrameResponse(10, Decision(3, 0)), t + chrono::milliseconds(2));
+    EXPECT_EQ(1, tracker.stats().numRequests());
+    EXPECT_EQ(1, tracker.stats().normalLatency().count());
+    EXPECT_EQ(2000, tracker.stats().latency().maxMicros());
+    EXPECT_EQ(0, tracker.stats().numDeadlineMisses());
+
+    // Already answered.
+    tracker.received(FrameResponse(11, Decision(3, 0)), t + chrono::milliseconds(3));
+    EXPECT_EQ(1, tracker.stats().numRequests());
+}
+
+TEST(ThinkLatencyTrackerTest, deadlineMiss)
+{
+    ThinkLatencyTracker tracker;
+    Clock::time_point t = Clock::now();
+
+    tracker.requested(10, true, t);
+    // A response for the older frame doesn't answer the request.
+    tracker.received(FrameResponse(9, Decision(3, 0)), t + chrono::milliseconds(1));
+    // The response came after some frames.
+    tracker.received(FrameResponse(12, Decision(3, 0)), t + chrono::milliseconds(40));
+
+    EXPECT_EQ(1, tracker.stats().numRequests());
+    EXPECT_EQ(1, tracker.stats().fastLatency().count());
+    EXPECT_EQ(1, tracker.stats().numDeadlineMisses());
+}
+
+TEST(ThinkLatencyTrackerTest, fallback)
+{
+    ThinkLatencyTracker tracker;
+    Clock::time_point t = Clock::now();
+
+    tracker.requested(10, false, t);
+    tracker.requested(50, false, t + chrono::milliseconds(500));
+    EXPECT_EQ(1, tracker.stats().numFallbacks());
+
+    // The pending request is forgotten.
+    tracker.reset();
+    tracker.requested(100, false, t + chrono::milliseconds(1000));
+    EXPECT_EQ(1, tracker.stats().numFallbacks());
+}
@@ -0,0 +1,86 @@
+#include "core/think_latency_stats.h"
+
+#include <sstream>
+
+#include "core/frame.h"
+
+using namespace std;
+
+namespace {
+
+string histogramJson(const LatencyHistogram& h)
+{
+    ostringstream oss;
+    oss << "{\"n\": " << h.count()
+        << ", \"p50\": " << h.percentileMicros(50)
+        << ", \"p99\": " << h.percentileMicros(99)
+        << ", \"max\": " << h.maxMicros()
+        << "}";
+    return oss.str();
+}
+
+}
+
+// static
+const chrono::steady_clock::duration ThinkLatencyStats::DEADLINE = chrono::microseconds(1000000 / FPS);
+
+void ThinkLatencyStats::addAnswered(bool fast, chrono::steady_clock::duration latency, bool missedDeadline)
+{
+    latency_.add(latency);
+    if (fast)
+        fastLatency_.add(latency);
+    else
+        normalLatency_.add(latency);
+
+    if (missedDeadline)
+        ++numDeadlineMisses_;
+}
+
+void ThinkLatencyStats::addFallback()
+{
+    ++numFallbacks_;
+}
+
+void ThinkLatencyStats::clear()
+{
+    latency_.clear();
+    fastLatency_.clear();
+    normalLatency_.clear();
+    numDeadlineMisses_ = 0;
+    numFallbacks_ = 0;
+}
+
+string ThinkLatencyStats::toString() const
+{
+    ostringstream oss;
+    oss << latency_.toString()
+        << " miss=" << numDeadlineMisses()
+        << " fallback=" << numFallbacks()
+        << " (fast: " << fastLatency_.toString()
+        << " normal: " << normalLatency_.toString() << ")";
+    return oss.str();
+}
+
+string ThinkLatencyStats::toShortString() const
+{
+    ostringstream oss;
+    oss << latency_.percentileMicros(50) / 1000 << '/'
+        << latency_.percentileMicros(99) / 1000 << '/'
+        << latency_.maxMicros() / 1000 << "ms"
+        << " miss=" << numDeadlineMisses()
+        << " fb=" << numFallbacks();
+    return oss.str();
+}
+
+string ThinkLatencyStats::toJson() const
+{
+    ostringstream oss;
+    oss << "{\"requests\": " << numRequests()
+        << ", \"deadline_misses\": " << numDeadlineMisses()
+        << ", \"fallbacks\": " << numFallbacks()
+        << ", \"latency\": " << histogramJson(latency_)
+        << ", \"fast\": " << histogramJson(fastLatency_)
+        << ", \"normal\": " << histogramJson(normalLatency_)
+        << "}";
+    return oss.str();
+}
@@ -0,0 +1,53 @@
+#ifndef CORE_THINK_LATENCY_STATS_H_
+#define CORE_THINK_LATENCY_STATS_H_
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "base/latency_histogram.h"
+#include "base/noncopyable.h"
+
+// ThinkLatencyStats summarizes how long a player takes to answer decision requests.
+// Both the server (from sending a request to receiving the response) and
+// the AI client (from receiving a request to sending the response) use this.
+//
+// A request is "fast" when the player should answer it in a short time
+// (e.g. decisionRequestAgain, or a rethink), and "normal" otherwise.
+// A request is "fallback" when the player hasn't answered it at all, so that
+// the puyo was moved without the player's decision.
+class ThinkLatencyStats : noncopyable {
+public:
+    // The time a player can spend to answer a request without delaying the puyo.
+    static const std::chrono::steady_clock::duration DEADLINE;
+
+    void addAnswered(bool fast, std::chrono::steady_clock::duration latency, bool missedDeadline);
+    void addFallback();
+
+    void clear();
+
+    const LatencyHistogram& latency() const { return latency_; }
+    const LatencyHistogram& fastLatency() const { return fastLatency_; }
+    const LatencyHistogram& normalLatency() const { return normalLatency_; }
+
+    // The number of answered requests and fallbacks.
+    int numRequests() const { return static_cast<int>(latency_.count()) + numFallbacks_; }
+    int numDeadlineMisses() const { return numDeadlineMisses_; }
+    int numFallbacks() const { return numFallbacks_; }
+
+    // e.g. "n=120 p50=1023us p99=4095us max=3300us miss=2 fallback=1 (fast: n=3 ... normal: n=117 ...)"
+    std::string toString() const;
+    // Fits in a line of the CUI. p50/p99/max in milliseconds, e.g. "1/4/3ms miss=2 fb=1".
+    std::string toShortString() const;
+    // Returns a JSON object in one line.
+    std::string toJson() const;
+
+private:
+    LatencyHistogram latency_;
+    LatencyHistogram fastLatency_;
+    LatencyHistogram normalLatency_;
+    std::atomic<int> numDeadlineMisses_ { 0 };
+    std::atomic<int> numFallbacks_ { 0 };
+};
+
+#endif // CORE_THINK_LATENCY_STATS_H_
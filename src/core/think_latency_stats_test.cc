@@ -0,0 +1,43 @@
+#include "core/think_latency_stats.h"
+
+#include <gtest/gtest.h>
+
+using namespace std;
+
+TEST(ThinkLatencyStatsTest, empty)
+{
+    ThinkLatencyStats stats;
+    EXPECT_EQ(0, stats.numRequests());
+    EXPECT_EQ(0, stats.numDeadlineMisses());
+    EXPECT_EQ(0, stats.numFallbacks());
+    EXPECT_EQ("0/0/0ms miss=0 fb=0", stats.toShortString());
+}
+
+TEST(ThinkLatencyStatsTest, fastAndNormal)
+{
+    ThinkLatencyStats stats;
+    stats.addAnswered(false, chrono::microseconds(1000), false);
+    stats.addAnswered(false, chrono::microseconds(2000), false);
+    stats.addAnswered(true, chrono::microseconds(30000), true);
+    stats.addFallback();
+
+    EXPECT_EQ(4, stats.numRequests());
+    EXPECT_EQ(1, stats.numDeadlineMisses());
+    EXPECT_EQ(1, stats.numFallbacks());
+    EXPECT_EQ(3, stats.latency().count());
+    EXPECT_EQ(1, stats.fastLatency().count());
+    EXPECT_EQ(2, stats.normalLatency().count());
+    EXPECT_EQ(30000, stats.latency().maxMicros());
+    EXPECT_EQ(2000, stats.normalLatency().maxMicros());
+
+    EXPECT_EQ("2/30/30ms miss=1 fb=1", stats.toShortString());
+    EXPECT_EQ("{\"requests\": 4, \"deadline_misses\": 1, \"fallbacks\": 1, "
+              "\"latency\": {\"n\": 3, \"p50\": 2047, \"p99\": 30000, \"max\": 30000}, "
+              "\"fast\": {\"n\": 1, \"p50\": 30000, \"p99\": 30000, \"max\": 30000}, "
+              "\"normal\": {\"n\": 2, \"p50\": 1023, \"p99\": 2000, \"max\": 2000}}",
+              stats.toJson());
+
+    stats.clear();
+    EXPECT_EQ(0, stats.numRequests());
+    EXPECT_EQ(0, stats.fastLatency().count());
+}
@@ -1,6 +1,7 @@
 #include "rater.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
@@ -8,6 +9,8 @@
 #include <chrono>
 #include <thread>
 
+#include "base/base.h"
+#include "base/file/file.h"
 #include "field.h"
 #include "game.h"
 #include "ratingstats.h"
@@ -25,13 +28,54 @@ DEFINE_bool(optimistic_chain_count, true, "Be optimistic");
 
 DEFINE_bool(show_progress, true, "");
 
+DEFINE_int32(shard_index, 0,
+             "Play only the games whose index % num_shards == shard_index");
+DEFINE_int32(num_shards, 1, "The number of processes sharing eval_cnt games");
+DEFINE_string(checkpoint, "",
+              "Append the result of each game to this file. "
+              "Games already in the file are skipped, so a killed run can be "
+              "resumed with the same flags.");
+DEFINE_int32(early_stop_chain, 0,
+             "If positive, stop once the probability to fire this chain is "
+             "significantly different from early_stop_baseline");
+DEFINE_double(early_stop_baseline, 0.5, "");
+DEFINE_int32(early_stop_min_games, 30, "");
+DEFINE_int32(early_stop_interval, 10,
+             "Test for early stop every this number of games after "
+             "early_stop_min_games");
+DEFINE_double(early_stop_z, 2.0,
+              "The width of the confidence interval in standard deviations "
+              "for the whole run. Since the interval is tested repeatedly, "
+              "each test uses a wider interval so that the false stop rate "
+              "doesn't exceed that of a single test with this width");
+
 Rater::Rater(int eval_threads, int eval_cnt, int base_seed)
     : threads_(eval_threads),
       states_(eval_threads),
-      game_index_(0),
+      next_pending_(0),
+      started_games_(0),
       finished_games_(0),
+      shard_games_(0),
+      resumed_games_(0),
       eval_cnt_(eval_cnt),
-      base_seed_(base_seed) {
+      base_seed_(base_seed),
+      checkpoint_(NULL),
+      early_stop_successes_(0),
+      early_stop_trials_(0),
+      early_stop_z_(FLAGS_early_stop_z),
+      stopped_early_(false) {
+  CHECK(0 <= FLAGS_shard_index && FLAGS_shard_index < FLAGS_num_shards)
+      << "shard_index=" << FLAGS_shard_index
+      << " num_shards=" << FLAGS_num_shards;
+  CHECK_LT(FLAGS_early_stop_chain,
+           static_cast<int>(ARRAY_SIZE(RatingStats().chain_stats)))
+      << "early_stop_chain=" << FLAGS_early_stop_chain;
+  // Chains shorter than 2 are never recorded.
+  if (FLAGS_early_stop_chain > 0)
+    CHECK_GE(FLAGS_early_stop_chain, 2)
+        << "early_stop_chain=" << FLAGS_early_stop_chain;
+  CHECK_GT(FLAGS_early_stop_interval, 0)
+      << "early_stop_interval=" << FLAGS_early_stop_interval;
 #ifdef GOOGLE3
   puyo_cloud_ = NULL;
   if (FLAGS_puyo_cloud) {
@@ -42,13 +86,167 @@ Rater::Rater(int eval_threads, int eval_cnt, int base_seed)
 }
 
 Rater::~Rater() {
+  if (checkpoint_ != NULL)
+    fclose(checkpoint_);
 #ifdef GOOGLE3
   if (puyo_cloud_ != NULL) {
     delete puyo_cloud_;
   }
 #endif  // GOOGLE3
 }
+
+// static
+bool Rater::LoadCheckpoint(const string& path, int* seed,
+                           map<int, RatingStats>* games,
+                           size_t* valid_size) {
+  string content;
+  if (!file::readFile(path, &content))
+    return false;
+
+  *seed = -1;
+  size_t pos = 0;
+  while (pos < content.size()) {
+    // A record is complete only when it is terminated by a newline. The last
+    // record written by a killed process may be torn.
+    size_t newline = content.find('\n', pos);
+    if (newline == string::npos) {
+      LOG(WARNING) << "Torn record in " << path << ": " << content.substr(pos);
+      break;
+    }
+    const string line = content.substr(pos, newline - pos);
+    if (!ParseCheckpointRecord(line, seed, games)) {
+      LOG(WARNING) << "Broken record in " << path << ": " << line;
+      break;
+    }
+    pos = newline + 1;
+  }
+
+  if (valid_size != NULL)
+    *valid_size = pos;
+  return true;
+}
+
+// static
+bool Rater::ParseCheckpointRecord(const string& line, int* seed,
+                                  map<int, RatingStats>* games) {
+  size_t tab = line.find('\t');
+  if (tab == string::npos)
+    return false;
+  const string key = line.substr(0, tab);
+  const string value = line.substr(tab + 1);
+  if (key == "seed") {
+    *seed = atoi(value.c_str());
+    return true;
+  }
+
+  // The serialized stats are prefixed by their length.
+  size_t length_tab = value.find('\t');
+  if (length_tab == string::npos)
+    return false;
+  const string serialized = value.substr(length_tab + 1);
+  if (strtoul(value.c_str(), NULL, 10) != serialized.size())
+    return false;
+
+  RatingStats stats;
+  if (!stats.Deserialize(serialized))
+    return false;
+  games->insert(make_pair(atoi(key.c_str()), stats));
+  return true;
+}
+
+void Rater::prepareGames() {
+  map<int, RatingStats> done;
+  if (!FLAGS_checkpoint.empty()) {
+    int seed = -1;
+    size_t valid_size;
+    if (LoadCheckpoint(FLAGS_checkpoint, &seed, &done, &valid_size)) {
+      CHECK(seed == -1 || seed == base_seed_)
+          << FLAGS_checkpoint << " was made with --seed=" << seed;
+      // Drop the torn record, otherwise the next record would be appended
+      // to it.
+      string content;
+      CHECK(file::readFile(FLAGS_checkpoint, &content));
+      if (valid_size < content.size()) {
+        LOG(WARNING) << "Truncating " << FLAGS_checkpoint << " to the last "
+                     << "complete record at " << valid_size << " bytes";
+        CHECK(file::writeFile(FLAGS_checkpoint,
+                              content.substr(0, valid_size)));
+      }
+    }
+
+    checkpoint_ = fopen(FLAGS_checkpoint.c_str(), "a");
+    PCHECK(checkpoint_ != NULL) << "Failed to open " << FLAGS_checkpoint;
+    if (seed == -1) {
+      fprintf(checkpoint_, "seed\t%d\n", base_seed_);
+      fflush(checkpoint_);
+    }
+  }
+
+  if (FLAGS_early_stop_chain > 0) {
+    // The interval is tested after early_stop_min_games games, and then every
+    // early_stop_interval games until all the games of this shard finish.
+    int num_games = (eval_cnt_ - FLAGS_shard_index + FLAGS_num_shards - 1) /
+        FLAGS_num_shards;
+    int looks = 0;
+    if (num_games >= FLAGS_early_stop_min_games) {
+      looks = 1 + (num_games - FLAGS_early_stop_min_games) /
+          FLAGS_early_stop_interval;
+    }
+    early_stop_z_ = Stat::sequentialZ(FLAGS_early_stop_z, looks);
+    LOG(INFO) << "Early stop is tested " << looks << " times with z="
+              << early_stop_z_;
+  }
+
+  for (int i = FLAGS_shard_index; i < eval_cnt_; i += FLAGS_num_shards) {
+    ++shard_games_;
+    map<int, RatingStats>::const_iterator it = done.find(i);
+    if (it == done.end()) {
+      pending_games_.push_back(i);
+      continue;
+    }
+
+    rating_stats_vec_.push_back(it->second);
+    updateEarlyStop(it->second);
+    ++resumed_games_;
+  }
+
+  if (resumed_games_ > 0) {
+    LOG(INFO) << "Resumed " << resumed_games_ << " games from "
+              << FLAGS_checkpoint;
+  }
+}
+
+void Rater::updateEarlyStop(const RatingStats& stats) {
+  if (FLAGS_early_stop_chain <= 0)
+    return;
+
+  ++early_stop_trials_;
+  if (stats.chain_stats[FLAGS_early_stop_chain].num() > 0)
+    ++early_stop_successes_;
+
+  if (stopped_early_ || early_stop_trials_ < FLAGS_early_stop_min_games)
+    return;
+  // Testing after every game would make the false stop rate much higher
+  // than the one early_stop_z_ is corrected for.
+  if ((early_stop_trials_ - FLAGS_early_stop_min_games) %
+      FLAGS_early_stop_interval != 0)
+    return;
+
+  double low, high;
+  Stat::confidenceInterval(early_stop_successes_, early_stop_trials_,
+                           early_stop_z_, &low, &high);
+  if (FLAGS_early_stop_baseline < low || high < FLAGS_early_stop_baseline) {
+    LOG(INFO) << "Stop early: " << FLAGS_early_stop_chain << " RENSA prob "
+              << (double)early_stop_successes_ / early_stop_trials_
+              << " (" << low << "," << high << ") after "
+              << early_stop_trials_ << " games";
+    stopped_early_ = true;
+  }
+}
+
 void Rater::eval(RatingStats* all_stats) {
+  prepareGames();
+
   for (size_t i = 0; i < threads_.size(); i++) {
     states_[i].tid = i;
     states_[i].rater = this;
@@ -70,10 +268,22 @@ void Rater::eval(RatingStats* all_stats) {
         sum_turns += s.turn;
       }
       fprintf(stderr, "%d/%d %d    ",
-              finished_games_, eval_cnt_, sum_turns);
+              resumed_games_ + finished_games_, shard_games_, sum_turns);
+      if (FLAGS_early_stop_chain > 0 && early_stop_trials_ > 0) {
+        double low, high;
+        Stat::confidenceInterval(early_stop_successes_, early_stop_trials_,
+                                 early_stop_z_, &low, &high);
+        fprintf(stderr, "%d RENSA: %.2f%% (%.2f%%,%.2f%%)    ",
+                FLAGS_early_stop_chain,
+                100.0 * early_stop_successes_ / early_stop_trials_,
+                100.0 * low, 100.0 * high);
+      }
     }
 
-    if (finished_games_ == eval_cnt_)
+    // Games already started are finished even when we stop early.
+    bool no_more_games =
+        stopped_early_ || next_pending_ == pending_games_.size();
+    if (no_more_games && finished_games_ == started_games_)
       break;
   }
 
@@ -118,18 +328,28 @@ void Rater::runWorker(int tid) {
   }
 }
 
-void Rater::GameDone(const int /* index */, const RatingStats& stats) {
+void Rater::GameDone(const int index, const RatingStats& stats) {
   std::lock_guard<std::mutex> lock(mu_);
   // LOG(INFO) << rating_stats_vec_.size() << " done.";
   rating_stats_vec_.push_back(stats);
   finished_games_++;
+
+  if (checkpoint_ != NULL) {
+    // Flush each game so that a killed run loses only the running games.
+    const string serialized = stats.Serialize();
+    fprintf(checkpoint_, "%d\t%d\t%s\n",
+            index, static_cast<int>(serialized.size()), serialized.c_str());
+    fflush(checkpoint_);
+  }
+  updateEarlyStop(stats);
 }
 
 int Rater::pickGameIndex() {
   std::lock_guard<std::mutex> lock(mu_);
-  if (game_index_ == eval_cnt_)
+  if (stopped_early_ || next_pending_ == pending_games_.size())
     return -1;
-  return game_index_++;
+  started_games_++;
+  return pending_games_[next_pending_++];
 }
 
 void Rater::evalOneGame(int i,
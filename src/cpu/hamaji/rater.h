@@ -1,8 +1,12 @@
 #ifndef HAMAJI_RATER_H_
 #define HAMAJI_RATER_H_
 
-#include <thread>
+#include <stdio.h>
+
+#include <map>
 #include <mutex>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "base.h"
@@ -28,10 +32,26 @@ public:
   static void evalOneGame(int i, int base_seed,
                           ThreadState* state, RatingStats* rating_stats);
 
+  // Loads a checkpoint file written by eval(). |seed| will be the base seed
+  // the games were played with. Loading stops at the first torn or broken
+  // record (e.g. the last record written when the process was killed).
+  // If |valid_size| is not NULL, it will be the size of the records loaded.
+  static bool LoadCheckpoint(const string& path, int* seed,
+                             map<int, RatingStats>* games,
+                             size_t* valid_size = NULL);
+
 private:
+  // Parses a checkpoint record without the terminating newline.
+  static bool ParseCheckpointRecord(const string& line, int* seed,
+                                    map<int, RatingStats>* games);
   static void* runWorker(void* self);
   void runWorker(int tid);
   int pickGameIndex();
+  // Decides which games this shard should play, and restores the games
+  // found in the checkpoint.
+  void prepareGames();
+  // Updates the confidence interval for early stopping. |mu_| must be held.
+  void updateEarlyStop(const RatingStats& stats);
 
  private:
   std::mutex mu_;
@@ -39,10 +59,24 @@ private:
   vector<std::thread> threads_;
   vector<ThreadState> states_;
   vector<RatingStats> rating_stats_vec_;
-  int game_index_;
+  // The games this shard has to play.
+  vector<int> pending_games_;
+  size_t next_pending_;
+  int started_games_;
   int finished_games_;
+  // The number of games of this shard, including the resumed ones.
+  int shard_games_;
+  int resumed_games_;
   int eval_cnt_;
   int base_seed_;
+
+  FILE* checkpoint_;
+
+  int early_stop_successes_;
+  int early_stop_trials_;
+  // early_stop_z corrected for the number of tests.
+  double early_stop_z_;
+  bool stopped_early_;
 #ifdef GOOGLE3
   PuyoCloudManager* puyo_cloud_;
 #endif // GOOGLE3
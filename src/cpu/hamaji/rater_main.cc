@@ -2,7 +2,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <map>
 #include <memory>
+#include <sstream>
+#include <string>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
@@ -14,12 +17,62 @@ DEFINE_int32(eval_cnt, 100,
              "Run the game this times and show some stats");
 DEFINE_int32(eval_threads, 1, "");
 DEFINE_int32(seed, -1, "");
+DEFINE_string(merge_checkpoints, "",
+              "Comma separated checkpoint files (e.g. written by shards). "
+              "Shows the stats of the games in them instead of playing.");
+
+DECLARE_string(checkpoint);
+DECLARE_int32(num_shards);
+
+namespace {
+
+int mergeCheckpoints() {
+  map<int, RatingStats> games;
+  istringstream iss(FLAGS_merge_checkpoints);
+  string path;
+  int base_seed = -1;
+  while (getline(iss, path, ',')) {
+    int seed;
+    if (!Rater::LoadCheckpoint(path, &seed, &games)) {
+      fprintf(stderr, "Failed to read %s\n", path.c_str());
+      return EXIT_FAILURE;
+    }
+    CHECK(base_seed == -1 || seed == -1 || base_seed == seed)
+        << path << " was made with a different seed";
+    if (seed != -1)
+      base_seed = seed;
+  }
+
+  if (games.empty()) {
+    fprintf(stderr, "No games found\n");
+    return EXIT_FAILURE;
+  }
+
+  RatingStats all_stats;
+  for (map<int, RatingStats>::const_iterator iter = games.begin();
+       iter != games.end(); ++iter) {
+    all_stats.merge(iter->second);
+  }
+  all_stats.Print();
+  return EXIT_SUCCESS;
+}
+
+}  // namespace
 
 int main(int argc, char* argv[]) {
   ParseCommandLineFlags(&argc, &argv, true);
   InitGoogleLogging(argv[0]);
 
+  if (!FLAGS_merge_checkpoints.empty())
+    return mergeCheckpoints();
+
+  if (FLAGS_seed < 0 && !FLAGS_checkpoint.empty()) {
+    // Resume with the seed of the checkpoint.
+    map<int, RatingStats> unused_games;
+    Rater::LoadCheckpoint(FLAGS_checkpoint, &FLAGS_seed, &unused_games);
+  }
   if (FLAGS_seed < 0) {
+    CHECK_EQ(1, FLAGS_num_shards) << "Shards must share the same --seed";
     srand(time(NULL));
     FLAGS_seed = rand();
   }
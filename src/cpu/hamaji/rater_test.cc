@@ -0,0 +1,95 @@
+#include "rater.h"
+
+#include <unistd.h>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "base/file/file.h"
+#include "ratingstats.h"
+
+using namespace std;
+
+namespace {
+
+string tempFilename() {
+  char buf[] = "/tmp/rater_test_XXXXXX";
+  int fd = mkstemp(buf);
+  CHECK_GE(fd, 0);
+  close(fd);
+  return buf;
+}
+
+string record(int index, const RatingStats& stats) {
+  const string serialized = stats.Serialize();
+  return to_string(index) + "\t" + to_string(serialized.size()) + "\t" +
+      serialized + "\n";
+}
+
+RatingStats makeStats(int chain) {
+  RatingStats stats;
+  stats.total_count++;
+  stats.add_chain_stats(chain, 1, 10);
+  stats.add_chigiri_frames(0);
+  stats.add_chigiri_frames(4);
+  return stats;
+}
+
+}  // namespace
+
+TEST(Rater, loadCheckpoint) {
+  const string content =
+      "seed\t42\n" + record(0, makeStats(3)) + record(2, makeStats(5));
+  const string path = tempFilename();
+  ASSERT_TRUE(file::writeFile(path, content));
+
+  int seed;
+  map<int, RatingStats> games;
+  size_t valid_size;
+  ASSERT_TRUE(Rater::LoadCheckpoint(path, &seed, &games, &valid_size));
+  EXPECT_EQ(42, seed);
+  EXPECT_EQ(content.size(), valid_size);
+  ASSERT_EQ(2U, games.size());
+  EXPECT_EQ(makeStats(3).Serialize(), games[0].Serialize());
+  EXPECT_EQ(makeStats(5).Serialize(), games[2].Serialize());
+  unlink(path.c_str());
+}
+
+TEST(Rater, loadCheckpointWithTornRecord) {
+  const string good = "seed\t42\n" + record(0, makeStats(3));
+  const string torn = record(1, makeStats(4));
+  const string path = tempFilename();
+
+  // Every prefix of the last record must be rejected, including the ones
+  // which can be deserialized (e.g. the chigiri frames cut at "0,").
+  for (size_t len = 1; len < torn.size(); ++len) {
+    ASSERT_TRUE(file::writeFile(path, good + torn.substr(0, len)));
+
+    int seed;
+    map<int, RatingStats> games;
+    size_t valid_size;
+    ASSERT_TRUE(Rater::LoadCheckpoint(path, &seed, &games, &valid_size));
+    EXPECT_EQ(42, seed);
+    EXPECT_EQ(good.size(), valid_size) << len;
+    EXPECT_EQ(1U, games.size()) << len;
+  }
+  unlink(path.c_str());
+}
+
+TEST(Rater, loadCheckpointWithWrongLength) {
+  const string serialized = makeStats(3).Serialize();
+  // A record terminated by a newline but shorter than its length says.
+  const string content = "seed\t42\n0\t" + to_string(serialized.size()) +
+      "\t" + serialized.substr(0, serialized.size() - 1) + "\n" +
+      record(1, makeStats(4));
+  const string path = tempFilename();
+  ASSERT_TRUE(file::writeFile(path, content));
+
+  int seed;
+  map<int, RatingStats> games;
+  size_t valid_size;
+  ASSERT_TRUE(Rater::LoadCheckpoint(path, &seed, &games, &valid_size));
+  EXPECT_EQ(string("seed\t42\n").size(), valid_size);
+  EXPECT_TRUE(games.empty());
+  unlink(path.c_str());
+}
@@ -2,10 +2,12 @@
 
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include <algorithm>
 #include <functional>
 #include <iterator>
+#include <sstream>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
@@ -60,6 +62,92 @@ void Stat::show(int total_count) const {
   }
 }
 
+void Stat::confidenceInterval(int successes, int n, double z,
+                              double* low, double* high) {
+  if (n == 0) {
+    *low = 0.0;
+    *high = 1.0;
+    return;
+  }
+
+  double p = (double)successes / n;
+  double denom = 1.0 + z * z / n;
+  double center = (p + z * z / (2.0 * n)) / denom;
+  double width = z * sqrt(p * (1.0 - p) / n + z * z / (4.0 * n * n)) / denom;
+  *low = max(0.0, center - width);
+  *high = min(1.0, center + width);
+}
+
+double Stat::sequentialZ(double z, int looks) {
+  if (looks <= 1)
+    return z;
+
+  // Finds z' such that P(|N(0,1)| > z') = P(|N(0,1)| > z) / looks.
+  const double alpha = erfc(z / sqrt(2.0)) / looks;
+  double low = z;
+  double high = z + 10.0;
+  for (int i = 0; i < 100; ++i) {
+    double mid = (low + high) / 2;
+    if (erfc(mid / sqrt(2.0)) > alpha)
+      low = mid;
+    else
+      high = mid;
+  }
+  return high;
+}
+
+string Stat::Serialize() const {
+  ostringstream oss;
+  for (map<int, int>::const_iterator iter = turns_.begin();
+       iter != turns_.end(); ++iter) {
+    if (iter != turns_.begin())
+      oss << ',';
+    oss << iter->first << ':' << iter->second;
+  }
+  return oss.str();
+}
+
+bool Stat::Deserialize(const string& s) {
+  turns_.clear();
+  istringstream iss(s);
+  string pair;
+  while (getline(iss, pair, ',')) {
+    int i, t;
+    if (sscanf(pair.c_str(), "%d:%d", &i, &t) != 2)
+      return false;
+    turns_[i] = t;
+  }
+  return true;
+}
+
+namespace {
+
+string serializeFloats(const vector<float>& a) {
+  ostringstream oss;
+  oss.precision(9);
+  for (size_t i = 0; i < a.size(); i++) {
+    if (i)
+      oss << ',';
+    oss << a[i];
+  }
+  return oss.str();
+}
+
+bool deserializeFloats(const string& s, vector<float>* a) {
+  a->clear();
+  istringstream iss(s);
+  string v;
+  while (getline(iss, v, ',')) {
+    char* end;
+    a->push_back(strtof(v.c_str(), &end));
+    if (*end != '\0')
+      return false;
+  }
+  return true;
+}
+
+}  // namespace
+
 void RatingStats::add_invalid_stat(int i, int t) {
   invalid_stat.add(i, t);
 }
@@ -171,3 +259,66 @@ void RatingStats::merge(const RatingStats& from) {
   }
   total_count += from.total_count;
 }
+
+string RatingStats::Serialize() const {
+  ostringstream oss;
+  oss.precision(17);
+  oss << "total=" << total_count
+      << " invalid=" << invalid_stat.Serialize()
+      << " dead=" << dead_stat.Serialize();
+  for (int c = 0; c < 20; ++c) {
+    if (chain_stats[c].num())
+      oss << " chain" << c << '=' << chain_stats[c].Serialize();
+  }
+  oss << " max_score=" << max_score
+      << " max_url=" << max_url
+      << " scores=" << serializeFloats(maxScores)
+      << " msecs=" << serializeFloats(cpuMsecs)
+      << " chigiri=" << serializeFloats(chigiri_frames);
+  return oss.str();
+}
+
+bool RatingStats::Deserialize(const string& line) {
+  *this = RatingStats();
+
+  istringstream iss(line);
+  string field;
+  while (iss >> field) {
+    size_t pos = field.find('=');
+    if (pos == string::npos)
+      return false;
+    const string key = field.substr(0, pos);
+    const string value = field.substr(pos + 1);
+
+    bool ok = true;
+    int c;
+    if (key == "total") {
+      total_count = atoi(value.c_str());
+    } else if (key == "invalid") {
+      ok = invalid_stat.Deserialize(value);
+    } else if (key == "dead") {
+      ok = dead_stat.Deserialize(value);
+    } else if (sscanf(key.c_str(), "chain%d", &c) == 1 && 0 <= c && c < 20) {
+      ok = chain_stats[c].Deserialize(value);
+    } else if (key == "max_score") {
+      max_score = atof(value.c_str());
+    } else if (key == "max_url") {
+      max_url = value;
+    } else if (key == "scores") {
+      ok = deserializeFloats(value, &maxScores);
+    } else if (key == "msecs") {
+      ok = deserializeFloats(value, &cpuMsecs);
+    } else if (key == "chigiri") {
+      ok = deserializeFloats(value, &chigiri_frames);
+    } else {
+      ok = false;
+    }
+
+    if (!ok) {
+      LOG(ERROR) << "Failed to parse " << field;
+      return false;
+    }
+  }
+
+  return true;
+}
@@ -14,9 +14,21 @@ class Stat {
   int num() const;
   void show(int total_count) const;
   static void showStat(const vector<float>& a);
+  // Computes the Wilson score interval of the probability when |successes|
+  // out of |n| trials succeeded. |z| is the number of standard deviations.
+  static void confidenceInterval(int successes, int n, double z,
+                                 double* low, double* high);
+  // Returns the z to use for each of |looks| tests so that the probability
+  // any of them rejects a true hypothesis (two-sided) doesn't exceed that of
+  // a single test with |z| (Bonferroni correction).
+  static double sequentialZ(double z, int looks);
   int get(int i) const;
   const map<int, int>& turns() const;
 
+  // "i:t,i:t,..."
+  string Serialize() const;
+  bool Deserialize(const string& s);
+
  private:
   map<int, int> turns_;
 };
@@ -33,6 +45,11 @@ class RatingStats {
   void Print();
   void merge(const RatingStats& from);
 
+  // Serializes the stats into a single line without newlines.
+  // The line can be restored by Deserialize().
+  string Serialize() const;
+  bool Deserialize(const string& line);
+
   Stat invalid_stat, dead_stat;
   Stat chain_stats[20];
   vector<float> maxScores;
@@ -0,0 +1,64 @@
+#include "ratingstats.h"
+
+#include <gtest/gtest.h>
+
+using namespace std;
+
+TEST(RatingStats, serialize) {
+  RatingStats stats;
+  stats.total_count++;
+  stats.add_dead_stat(3, 30);
+  stats.add_chain_stats(2, 3, 5);
+  stats.add_chain_stats(3, 3, 12);
+  stats.add_elapsed_msec(1.5);
+  stats.add_elapsed_msec(0.25);
+  stats.add_chigiri_frames(0);
+  stats.add_chigiri_frames(2);
+  stats.add_max_score(1120, "http://example.com/#4455");
+
+  RatingStats restored;
+  ASSERT_TRUE(restored.Deserialize(stats.Serialize()));
+  EXPECT_EQ(stats.Serialize(), restored.Serialize());
+
+  EXPECT_EQ(1, restored.total_count);
+  EXPECT_EQ(0, restored.invalid_stat.num());
+  EXPECT_EQ(30, restored.dead_stat.get(3));
+  EXPECT_EQ(5, restored.chain_stats[2].get(3));
+  EXPECT_EQ(12, restored.chain_stats[3].get(3));
+  EXPECT_EQ(0, restored.chain_stats[4].num());
+  EXPECT_EQ((vector<float>{1.5, 0.25}), restored.cpuMsecs);
+  EXPECT_EQ((vector<float>{0, 2}), restored.chigiri_frames);
+  EXPECT_EQ((vector<float>{1120}), restored.maxScores);
+  EXPECT_EQ(1120, restored.max_score);
+  EXPECT_EQ("http://example.com/#4455", restored.max_url);
+}
+
+TEST(RatingStats, deserializeBrokenLine) {
+  RatingStats stats;
+  EXPECT_FALSE(stats.Deserialize("total=1 invalid=3:"));
+  EXPECT_FALSE(stats.Deserialize("total=1 msecs=1.5,abc"));
+  EXPECT_FALSE(stats.Deserialize("unknown"));
+}
+
+TEST(Stat, confidenceInterval) {
+  double low, high;
+  Stat::confidenceInterval(50, 100, 2.0, &low, &high);
+  EXPECT_NEAR(0.40, low, 0.01);
+  EXPECT_NEAR(0.60, high, 0.01);
+
+  // Unlike the normal approximation, the interval doesn't collapse at 0.
+  Stat::confidenceInterval(0, 30, 2.0, &low, &high);
+  EXPECT_EQ(0.0, low);
+  EXPECT_LT(0.1, high);
+
+  Stat::confidenceInterval(0, 0, 2.0, &low, &high);
+  EXPECT_EQ(0.0, low);
+  EXPECT_EQ(1.0, high);
+}
+
+TEST(Stat, sequentialZ) {
+  EXPECT_EQ(2.0, Stat::sequentialZ(2.0, 1));
+  // 5% split into 5 looks is 1% each.
+  EXPECT_NEAR(2.576, Stat::sequentialZ(1.960, 5), 0.001);
+  EXPECT_LT(Stat::sequentialZ(2.0, 10), Stat::sequentialZ(2.0, 20));
+}
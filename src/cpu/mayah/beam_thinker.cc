@@ -8,6 +8,7 @@
 #include "base/wait_group.h"
 #include "core/field_pretty_printer.h"
 #include "core/kumipuyo_seq_generator.h"
+#include "core/kumipuyo_seq_view.h"
 #include "core/plan/plan.h"
 #include "core/rensa/rensa_detector.h"
 
@@ -16,6 +17,7 @@
 DEFINE_int32(beam_width, 400, "beam width");
 DEFINE_int32(beam_depth, 50, "beam depth");
 DEFINE_int32(beam_num, 12, "beam iteration number");
+DEFINE_string(beam_model, "", "If set, fields are evaluated with the MultiLayerPerceptron saved here.");
 
 using namespace std;
 
@@ -94,8 +96,8 @@ std::pair<double, int> evalSuperLight(const CoreField& fieldBeforeRensa)
     return std::make_pair(maxScore, maxChains);
 }
 
-SearchResult run(const std::vector<State>& initialStates, KumipuyoSeq seq, int maxSearchTurns,
-                 std::mutex& mu)
+SearchResult run(const std::vector<State>& initialStates, KumipuyoSeqView seq, int maxSearchTurns,
+                 const NeuralEvaluator* neuralEvaluator, std::mutex& mu)
 {
     SearchResult result;
 
@@ -107,6 +109,11 @@ SearchResult run(const std::vector<State>& initialStates, KumipuyoSeq seq, int m
     std::vector<State> nextStates;
     nextStates.reserve(100000);
 
+    // The states to be evaluated by |neuralEvaluator| in batch.
+    std::vector<size_t> neuralStateIndices;
+    std::vector<const CoreField*> neuralFields;
+    std::vector<double> neuralScores;
+
     std::vector<double> time(std::max(maxSearchTurns, 10));
 
     double beginTime = currentTime();
@@ -141,6 +148,12 @@ SearchResult run(const std::vector<State>& initialStates, KumipuyoSeq seq, int m
                     return;
                 }
 
+                if (neuralEvaluator) {
+                    neuralStateIndices.push_back(nextStates.size());
+                    nextStates.emplace_back(plan.field(), s.firstDecision, 0, 0, total_frames);
+                    return;
+                }
+
                 double maxScore;
                 int maxChains;
                 std::tie(maxScore, maxChains) = evalSuperLight(fieldBeforeRensa);
@@ -148,6 +161,17 @@ SearchResult run(const std::vector<State>& initialStates, KumipuyoSeq seq, int m
             });
         }
 
+        if (!neuralStateIndices.empty()) {
+            neuralFields.clear();
+            for (size_t i : neuralStateIndices)
+                neuralFields.push_back(&nextStates[i].field);
+            neuralScores.resize(neuralFields.size());
+            neuralEvaluator->evaluate(neuralFields.data(), neuralFields.size(), neuralScores.data());
+            for (size_t i = 0; i < neuralStateIndices.size(); ++i)
+                nextStates[neuralStateIndices[i]].stateScore = neuralScores[i];
+            neuralStateIndices.clear();
+        }
+
         std::sort(nextStates.begin(), nextStates.end(), std::greater<State>());
 
         int beamWidth = FLAGS_beam_width;
@@ -210,6 +234,15 @@ SearchResult run(const std::vector<State>& initialStates, KumipuyoSeq seq, int m
 
 } // anonymous namespace
 
+BeamThinker::BeamThinker(Executor* executor) :
+    executor_(executor)
+{
+    if (!FLAGS_beam_model.empty()) {
+        neuralEvaluator_ = NeuralEvaluator::load(FLAGS_beam_model);
+        CHECK(neuralEvaluator_) << "cannot load " << FLAGS_beam_model;
+    }
+}
+
 DropDecision BeamThinker::think(int /*frameId*/, const CoreField& field, const KumipuyoSeq& seq,
                                 const PlayerState& /*me*/, const PlayerState& /*enemy*/, bool /*fast*/) const
 {
@@ -241,7 +274,7 @@ DropDecision BeamThinker::think(int /*frameId*/, const CoreField& field, const K
 
     // The second move.
     std::vector<State> nextStates;
-    KumipuyoSeq subSeq = seq.subsequence(1);
+    KumipuyoSeqView subSeq = KumipuyoSeqView(seq).subsequence(1);
     for (const auto& s : currentStates) {
         Plan::iterateAvailablePlans(s.field, subSeq, 1, [&](const RefPlan& plan) {
             int total_frames = s.total_frames + plan.totalFrames() + FRAMES_PREPARING_NEXT;
@@ -264,7 +297,7 @@ DropDecision BeamThinker::think(int /*frameId*/, const CoreField& field, const K
             KumipuyoSeq tmpSeq(seq.subsequence(2));
             tmpSeq.append(KumipuyoSeqGenerator::generateRandomSequence(40));
 
-            SearchResult searchResult = run(nextStates, tmpSeq, maxSearchTurns, mu_);
+            SearchResult searchResult = run(nextStates, tmpSeq, maxSearchTurns, neuralEvaluator_.get(), mu_);
 
             {
                 lock_guard<mutex> lk(mu);
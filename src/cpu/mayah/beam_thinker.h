@@ -1,6 +1,7 @@
 #ifndef CPU_MAYAH_BEAM_THINKER_H_
 #define CPU_MAYAH_BEAM_THINKER_H_
 
+#include <memory>
 #include <mutex>
 
 #include "base/executor.h"
@@ -9,15 +10,19 @@
 #include "core/kumipuyo_seq.h"
 #include "core/player_state.h"
 
+#include "neural_evaluator.h"
+
 class BeamThinker {
 public:
-    explicit BeamThinker(Executor* executor) : executor_(executor) {}
+    // When --beam_model is given, the fields in the beam are evaluated with NeuralEvaluator.
+    explicit BeamThinker(Executor* executor);
 
     DropDecision think(int frame_id, const CoreField& field, const KumipuyoSeq& seq,
                        const PlayerState& me, const PlayerState& enemy, bool fast) const;
 
 private:
     Executor* executor_;
+    std::unique_ptr<NeuralEvaluator> neuralEvaluator_;
 
     mutable std::mutex mu_;  // for cout
 };
@@ -3,6 +3,7 @@
 
 // TODO(mayah): Move this to core/algorithm.
 
+#include <algorithm>
 #include <vector>
 
 #include "base/executor.h"
@@ -10,6 +11,7 @@
 #include "core/plan/plan.h"
 #include "core/core_field.h"
 #include "core/kumipuyo_seq.h"
+#include "core/kumipuyo_seq_view.h"
 #include "core/player_state.h"
 #include "core/puyo_controller.h"
 
@@ -36,13 +38,13 @@ public:
     // When decision sequence is specified, we consider only this decision sequence.
     void setSpecifiedDecisions(const std::vector<Decision>& decisions) { decisions_ = decisions; }
 
-    void iterate(int frameId, const CoreField& originalField, const KumipuyoSeq& kumipuyoSeq,
+    void iterate(int frameId, const CoreField& originalField, KumipuyoSeqView kumipuyoSeq,
                  const PlayerState& me, const PlayerState& enemy, int maxDepth);
 
 private:
     void iterateRest(int initialFrameId,
                      const CoreField& currentField,
-                     const KumipuyoSeq& kumipuyoSeq,
+                     KumipuyoSeqView kumipuyoSeq,
                      const std::vector<Decision>& currentDecisions,
                      int currentNumChigiri,
                      int currentTotalFrames,
@@ -70,6 +72,38 @@ private:
 
 // ----------------------------------------------------------------------
 
+// Returns the 22 decisions in the order DecisionPlanner tries them.
+// When both puyos have the same color, only the first 11 decisions are tried.
+inline const Decision* plannerDecisions()
+{
+    static const Decision DECISIONS[] = {
+        Decision(2, 3), Decision(3, 3), Decision(3, 1), Decision(4, 1),
+        Decision(5, 1), Decision(1, 2), Decision(2, 2), Decision(3, 2),
+        Decision(4, 2), Decision(5, 2), Decision(6, 2),
+        Decision(1, 1), Decision(2, 1), Decision(4, 3), Decision(5, 3),
+        Decision(6, 3), Decision(1, 0), Decision(2, 0), Decision(3, 0),
+        Decision(4, 0), Decision(5, 0), Decision(6, 0),
+    };
+    return DECISIONS;
+}
+
+// Returns true if DecisionPlanner without executor evaluates the plan having |lhs| before
+// the plan having |rhs|. This can be used to break ties in the same way as the sequential search.
+inline bool isPlannedBefore(const std::vector<Decision>& lhs, const std::vector<Decision>& rhs)
+{
+    auto order = [](const Decision& d) {
+        const Decision* decisions = plannerDecisions();
+        for (int i = 0; i < 22; ++i) {
+            if (decisions[i] == d)
+                return i;
+        }
+        return 22;
+    };
+
+    return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+                                        [&](const Decision& a, const Decision& b) { return order(a) < order(b); });
+}
+
 inline int updateOjama(int currentFrameId, int generatedOjama, int* fixedOjama, int* pendingOjama, int* ojamaCommittingFrameId)
 {
     if (generatedOjama > 0) {
@@ -122,14 +156,7 @@ void DecisionPlanner<MidEvaluationResult>::iterateKumipuyoDrop(int currentDepth,
                                                                bool first,
                                                                Callback callback)
 {
-    static const Decision DECISIONS[] = {
-        Decision(2, 3), Decision(3, 3), Decision(3, 1), Decision(4, 1),
-        Decision(5, 1), Decision(1, 2), Decision(2, 2), Decision(3, 2),
-        Decision(4, 2), Decision(5, 2), Decision(6, 2),
-        Decision(1, 1), Decision(2, 1), Decision(4, 3), Decision(5, 3),
-        Decision(6, 3), Decision(1, 0), Decision(2, 0), Decision(3, 0),
-        Decision(4, 0), Decision(5, 0), Decision(6, 0),
-    };
+    const Decision* DECISIONS = plannerDecisions();
 
     DCHECK(isNormalColor(kumipuyo.axis)) << kumipuyo.axis;
     DCHECK(isNormalColor(kumipuyo.child)) << kumipuyo.child;
@@ -168,7 +195,7 @@ void DecisionPlanner<MidEvaluationResult>::iterateKumipuyoDrop(int currentDepth,
 template<typename MidEvaluationResult>
 void DecisionPlanner<MidEvaluationResult>::iterateRest(int initialFrameId,
                                                        const CoreField& currentField,
-                                                       const KumipuyoSeq& kumipuyoSeq,
+                                                       KumipuyoSeqView kumipuyoSeq,
                                                        const std::vector<Decision>& currentDecisions,
                                                        int currentNumChigiri,
                                                        int currentTotalFrames,
@@ -245,7 +272,7 @@ void DecisionPlanner<MidEvaluationResult>::iterateRest(int initialFrameId,
 template <typename MidEvaluationResult>
 void DecisionPlanner<MidEvaluationResult>::iterate(int initialFrameId,
                                                    const CoreField& originalField,
-                                                   const KumipuyoSeq& kumipuyoSeq,
+                                                   KumipuyoSeqView kumipuyoSeq,
                                                    const PlayerState& me,
                                                    const PlayerState& enemy,
                                                    int maxDepth)
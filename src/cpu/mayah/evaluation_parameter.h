@@ -77,7 +77,8 @@ public:
 
     toml::Value toTomlValue() const
     {
-        toml::Value v;
+        // An empty parameter is an empty table, so that it can be loaded again.
+        toml::Value v((toml::Table()));
 
         for (const auto& ef : FeatureSet::features()) {
             if (!hasParam(ef.key()))
@@ -198,6 +199,8 @@ public:
     typedef typename FeatureSet::FeatureKey FeatureKey;
     typedef typename FeatureSet::SparseFeatureKey SparseFeatureKey;
 
+    const Param& defaultParam() const { return defaultParam_; }
+
     double param(EvaluationMode mode, FeatureKey key) const
     {
         if (params_[ordinal(mode)].hasParam(key))
@@ -9,6 +9,7 @@
 
 #include <glog/logging.h>
 
+#include "base/instrumentation.h"
 #include "base/time.h"
 #include "core/plan/plan.h"
 #include "core/rensa/rensa_detector.h"
@@ -282,7 +283,7 @@ CollectedCoef Evaluator<ScoreCollector>::calculateDefaultCoef(const PlayerState&
 
 template<typename ScoreCollector>
 void Evaluator<ScoreCollector>::eval(const RefPlan& plan,
-                                     const KumipuyoSeq& restSeq,
+                                     KumipuyoSeqView restSeq,
                                      int currentFrameId,
                                      int maxIteration,
                                      const PlayerState& me,
@@ -292,6 +293,8 @@ void Evaluator<ScoreCollector>::eval(const RefPlan& plan,
                                      bool usesRensaHandTree,
                                      const GazeResult& gazeResult)
 {
+    INSTRUMENT_SCOPE("Evaluator::eval");
+
     typedef typename ScoreCollector::RensaScoreCollector RensaScoreCollector;
     typedef typename RensaScoreCollector::CollectedScore RensaCollectedScore;
 
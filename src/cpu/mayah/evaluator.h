@@ -4,6 +4,7 @@
 #include <map>
 #include <vector>
 
+#include "core/kumipuyo_seq_view.h"
 #include "core/pattern/pattern_book.h"
 
 #include "evaluation_feature.h"
@@ -12,7 +13,6 @@
 class ColumnPuyoList;
 class CoreField;
 class GazeResult;
-class KumipuyoSeq;
 class RefPlan;
 
 struct PlayerState;
@@ -93,7 +93,7 @@ public:
         EvaluatorBase(patternBook),
         sc_(sc) {}
 
-    void eval(const RefPlan&, const KumipuyoSeq&, int currentFrameId, int maxIteration,
+    void eval(const RefPlan&, KumipuyoSeqView restSeq, int currentFrameId, int maxIteration,
               const PlayerState& me, const PlayerState& enemy,
               const MidEvalResult&, bool fast, bool usesRensaHandTree, const GazeResult&);
 
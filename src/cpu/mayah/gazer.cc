@@ -7,6 +7,7 @@
 
 #include <glog/logging.h>
 
+#include "base/instrumentation.h"
 #include "core/plan/plan.h"
 #include "core/rensa/rensa_detector.h"
 #include "core/field_checker.h"
@@ -170,6 +171,8 @@ void Gazer::initialize(int frameIdGameWillBegin)
 
 void Gazer::gaze(int frameId, const CoreField& originalField, const KumipuyoSeq& kumipuyoSeq)
 {
+    INSTRUMENT_SCOPE("Gazer::gaze");
+
     LOG(INFO) << "Gaze: frame_id=" << frameId << "\n"
               << originalField.toDebugString() << "\nSeq: " << kumipuyoSeq.toString();
 
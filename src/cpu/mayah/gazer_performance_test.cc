@@ -5,6 +5,7 @@
 #include <gflags/gflags.h>
 #include <gtest/gtest.h>
 
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 #include "core/plan/plan.h"
 #include "core/core_field.h"
@@ -18,9 +19,16 @@ using namespace std;
 
 static void runTest(const CoreField& cf, const KumipuyoSeq& seq)
 {
-    Gazer gazer;
-    gazer.initialize(1);
-    gazer.gaze(100, cf, seq);
+    TimeStampCounterData tsc;
+
+    for (int i = 0; i < 3; ++i) {
+        Gazer gazer;
+        gazer.initialize(1);
+        ScopedTimeStampCounter stsc(&tsc);
+        gazer.gaze(100, cf, seq);
+    }
+
+    reportTestBenchmark(tsc);
 }
 
 TEST(GazerPerformanceTest, pattern1)
@@ -53,7 +53,7 @@ ThoughtResult MayahAI::thinkPlan(int frameId, const CoreField& cf, const Kumipuy
 }
 
 CollectedFeatureCoefScore MayahAI::evalWithCollectingFeature(
-    const RefPlan& plan, const KumipuyoSeq& restSeq, int currentFrameId, int maxIteration,
+    const RefPlan& plan, KumipuyoSeqView restSeq, int currentFrameId, int maxIteration,
     const PlayerState& me, const PlayerState& enemy,
     const MidEvalResult& midEvalResult, bool fast, const GazeResult& gazeResult) const
 {
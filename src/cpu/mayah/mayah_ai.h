@@ -25,7 +25,7 @@ public:
                             int depth, int maxIteration, bool fast = false,
                             std::vector<Decision>* specifiedDecisions = nullptr) const;
     CollectedFeatureCoefScore evalWithCollectingFeature(
-        const RefPlan&, const KumipuyoSeq& restSeq, int currentFrameId, int maxIteration,
+        const RefPlan&, KumipuyoSeqView restSeq, int currentFrameId, int maxIteration,
         const PlayerState& me, const PlayerState& enemy,
         const MidEvalResult&, bool fast, const GazeResult& gazeResult) const;
 
@@ -3,6 +3,7 @@
 #include <gflags/gflags.h>
 #include <gtest/gtest.h>
 
+#include "base/benchmark_gtest.h"
 #include "base/time_stamp_counter.h"
 #include "core/plan/plan.h"
 #include "core/core_field.h"
@@ -71,7 +72,7 @@ void runTest(int depth, int iteration, const CoreField& cf, const KumipuyoSeq& k
         (void)ai->thinkPlan(frameId, cf, kumipuyoSeq, PlayerState(), PlayerState(), depth, iteration);
     }
 
-    tsc.showStatistics();
+    reportTestBenchmark(tsc);
 }
 
 TEST(MayahAIPerformanceTest, seq2_depth2_iter2)
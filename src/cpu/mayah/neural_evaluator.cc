@@ -0,0 +1,114 @@
+#include "neural_evaluator.h"
+
+#include <smmintrin.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "core/color_permutation.h"
+#include "core/core_field.h"
+#include "learning/multi_layer_perceptron.h"
+
+namespace {
+
+// The number of fields encoded and evaluated at once.
+const int CHUNK_SIZE = 256;
+
+// Expands the rows [1, 16] of |column| into 16 bytes of 0 or 1.
+inline void expandColumn(std::uint16_t column, std::uint8_t out[16])
+{
+    const __m128i shuffle = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+    const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i ones = _mm_set1_epi8(1);
+
+    __m128i v = _mm_shuffle_epi8(_mm_cvtsi32_si128(column >> 1), shuffle);
+    v = _mm_min_epu8(_mm_and_si128(v, bits), ones);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+}
+
+} // anonymous namespace
+
+NeuralEvaluator::NeuralEvaluator(const learning::MultiLayerPerceptron& mlp) :
+    perceptron_(mlp)
+{
+    CHECK_EQ(mlp.numInput(), INPUT_SIZE);
+}
+
+// static
+std::unique_ptr<NeuralEvaluator> NeuralEvaluator::load(const std::string& path)
+{
+    std::unique_ptr<learning::MultiLayerPerceptron> mlp = learning::MultiLayerPerceptron::loadParameter(path);
+    if (!mlp)
+        return std::unique_ptr<NeuralEvaluator>();
+    if (mlp->numInput() != INPUT_SIZE) {
+        LOG(ERROR) << path << " has " << mlp->numInput() << " inputs, but " << INPUT_SIZE << " is expected";
+        return std::unique_ptr<NeuralEvaluator>();
+    }
+    return std::unique_ptr<NeuralEvaluator>(new NeuralEvaluator(*mlp));
+}
+
+// static
+void NeuralEvaluator::encode(const CoreField& field, std::uint8_t input[])
+{
+    const int PLANE_SIZE = FieldConstant::WIDTH * NUM_ROWS;
+
+    const BitField& bf = field.bitField();
+    const ColorPermutation perm = bf.canonicalColorPermutation();
+
+    alignas(16) std::uint16_t columns[FieldConstant::MAP_WIDTH];
+    // expandColumn() writes 3 bytes more than NUM_ROWS, which are overwritten by the next column.
+    std::uint8_t plane[PLANE_SIZE + 16 - NUM_ROWS];
+    auto encodePlane = [&](FieldBits bits, int index) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(columns), bits.maskedField13());
+        for (int x = 1; x <= FieldConstant::WIDTH; ++x)
+            expandColumn(columns[x], plane + (x - 1) * NUM_ROWS);
+        std::copy(plane, plane + PLANE_SIZE, input + index * PLANE_SIZE);
+    };
+
+    for (PuyoColor c : NORMAL_PUYO_COLORS)
+        encodePlane(bf.bits(c), ordinal(perm.apply(c)) - ordinal(PuyoColor::RED));
+    encodePlane(bf.bits(PuyoColor::OJAMA), NUM_NORMAL_PUYO_COLORS);
+}
+
+// static
+void NeuralEvaluator::encode(const CoreField& field, float input[])
+{
+    std::uint8_t bytes[INPUT_SIZE];
+    encode(field, bytes);
+    std::copy(bytes, bytes + INPUT_SIZE, input);
+}
+
+double NeuralEvaluator::evaluate(const CoreField& field) const
+{
+    const CoreField* fields[] = { &field };
+    double score;
+    evaluate(fields, 1, &score);
+    return score;
+}
+
+void NeuralEvaluator::evaluate(const CoreField* const fields[], int size, double scores[]) const
+{
+    const int stride = perceptron_.inputStride();
+    const int numOutput = perceptron_.numOutput();
+
+    // The padding after INPUT_SIZE stays 0.
+    std::vector<std::uint8_t> inputs(static_cast<size_t>(std::min(size, CHUNK_SIZE)) * stride);
+    std::vector<float> outputs(static_cast<size_t>(std::min(size, CHUNK_SIZE)) * numOutput);
+
+    for (int begin = 0; begin < size; begin += CHUNK_SIZE) {
+        const int n = std::min(CHUNK_SIZE, size - begin);
+        for (int i = 0; i < n; ++i)
+            encode(*fields[begin + i], &inputs[static_cast<size_t>(i) * stride]);
+
+        perceptron_.forward(inputs.data(), n, outputs.data());
+
+        for (int i = 0; i < n; ++i) {
+            double score = 0;
+            for (int label = 1; label < numOutput; ++label)
+                score += label * outputs[i * numOutput + label];
+            scores[begin + i] = score;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#ifndef CPU_MAYAH_NEURAL_EVALUATOR_H_
+#define CPU_MAYAH_NEURAL_EVALUATOR_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "core/field_constant.h"
+#include "core/puyo_color.h"
+#include "learning/quantized_perceptron.h"
+
+class CoreField;
+
+namespace learning {
+class MultiLayerPerceptron;
+}
+
+// NeuralEvaluator evaluates fields with a learned MultiLayerPerceptron.
+// The inputs are the bit planes of the field (normal colors and ojama, including
+// the 13th row), and the colors are canonicalized so that fields equivalent under
+// color permutation have the same score.
+//
+// The perceptron is a classifier whose outputs are trained toward one-hot vectors.
+// The score is the expected label, sum_i i * output[i], so a larger label should
+// mean a better field (e.g. the number of chains the field can fire later).
+//
+// This is thread-safe.
+class NeuralEvaluator {
+public:
+    static const int NUM_PLANES = NUM_NORMAL_PUYO_COLORS + 1;
+    static const int NUM_ROWS = 13;
+    static const int INPUT_SIZE = NUM_PLANES * FieldConstant::WIDTH * NUM_ROWS;
+
+    explicit NeuralEvaluator(const learning::MultiLayerPerceptron&);
+
+    // Loads the perceptron saved with MultiLayerPerceptron::saveParameter().
+    // Returns nullptr if failed.
+    static std::unique_ptr<NeuralEvaluator> load(const std::string& path);
+
+    // Writes the INPUT_SIZE inputs of |field| to |input|.
+    // The float version is for training MultiLayerPerceptron.
+    static void encode(const CoreField& field, std::uint8_t input[]);
+    static void encode(const CoreField& field, float input[]);
+
+    double evaluate(const CoreField& field) const;
+    // Evaluates |size| fields at once. This is much faster than evaluating them one by one.
+    void evaluate(const CoreField* const fields[], int size, double scores[]) const;
+
+private:
+    learning::QuantizedPerceptron perceptron_;
+};
+
+#endif // CPU_MAYAH_NEURAL_EVALUATOR_H_
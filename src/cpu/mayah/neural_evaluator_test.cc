@@ -0,0 +1,202 @@
+#include "neural_evaluator.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+#include <gtest/gtest.h>
+
+#include "base/executor.h"
+#include "core/core_field.h"
+#include "learning/multi_layer_perceptron.h"
+
+using namespace std;
+
+namespace {
+
+const int NUM_HIDDEN = 24;
+const int NUM_OUTPUT = 5;
+
+string tempFilename()
+{
+    char buf[] = "/tmp/neural_evaluator_test_XXXXXX";
+    int fd = mkstemp(buf);
+    CHECK_GE(fd, 0);
+    close(fd);
+    return buf;
+}
+
+vector<CoreField> makeFields()
+{
+    return vector<CoreField> {
+        CoreField(),
+        CoreField("RRBBYY"),
+        CoreField(
+            "Y....."
+            "YB...."
+            "BBY..."
+            "OGGGOO"
+            "OOYYOO"
+            "RRROGG"),
+        CoreField(
+            "R....."
+            "RB..G."
+            "BBYYGG"
+            "GGYBRR"
+            "RRBBYY"),
+        CoreField(
+            "OOOOOO" // 13
+            "OOOOOO" // 12
+            "OOOOOO"
+            "OOOOOO"
+            "OOOOOO"
+            "OOOOOO" // 8
+            "OOOOOO"
+            "OOOOOO"
+            "OOOOOO"
+            "OOOOOO" // 4
+            "OOOOOO"
+            "OOOOOO"
+            "RRBBYY"),
+    };
+}
+
+// Evaluates |field| with the float perceptron.
+double evaluateWithoutQuantization(const learning::MultiLayerPerceptron& mlp, const CoreField& field)
+{
+    vector<float> input(NeuralEvaluator::INPUT_SIZE);
+    NeuralEvaluator::encode(field, input.data());
+
+    auto data = mlp.makeForwadingStorage();
+    mlp.predict(input.data(), &data);
+
+    double score = 0;
+    for (int label = 1; label < mlp.numOutput(); ++label)
+        score += label * data.i3[label];
+    return score;
+}
+
+}
+
+TEST(NeuralEvaluatorTest, encode)
+{
+    CoreField f(
+        "O....."
+        "YB...."
+        "BBY..R");
+
+    vector<uint8_t> input(NeuralEvaluator::INPUT_SIZE);
+    NeuralEvaluator::encode(f, input.data());
+
+    // The colors are canonicalized in the order of appearance from the bottom of
+    // the 1st column: B -> RED, Y -> BLUE, R -> YELLOW.
+    auto at = [&](int plane, int x, int y) {
+        return input[(plane * FieldConstant::WIDTH + x - 1) * NeuralEvaluator::NUM_ROWS + y - 1];
+    };
+    EXPECT_EQ(1, at(0, 1, 1));
+    EXPECT_EQ(1, at(0, 2, 1));
+    EXPECT_EQ(1, at(0, 2, 2));
+    EXPECT_EQ(1, at(1, 1, 2));
+    EXPECT_EQ(1, at(1, 3, 1));
+    EXPECT_EQ(1, at(2, 6, 1));
+    EXPECT_EQ(1, at(4, 1, 3));
+
+    int count = 0;
+    for (uint8_t v : input)
+        count += v;
+    EXPECT_EQ(f.countPuyos(), count);
+
+    // Fields equivalent under color permutation have the same inputs.
+    CoreField g(
+        "O....."
+        "RG...."
+        "GGR..Y");
+    vector<uint8_t> input2(NeuralEvaluator::INPUT_SIZE);
+    NeuralEvaluator::encode(g, input2.data());
+    EXPECT_EQ(input, input2);
+}
+
+TEST(NeuralEvaluatorTest, evaluate)
+{
+    learning::MultiLayerPerceptron mlp(NeuralEvaluator::INPUT_SIZE, NUM_HIDDEN, NUM_OUTPUT);
+    NeuralEvaluator evaluator(mlp);
+
+    vector<CoreField> fields = makeFields();
+    vector<const CoreField*> fieldPointers;
+    for (const auto& f : fields)
+        fieldPointers.push_back(&f);
+
+    vector<double> scores(fields.size());
+    evaluator.evaluate(fieldPointers.data(), fieldPointers.size(), scores.data());
+
+    // The difference comes from the quantization of the hidden layer weights.
+    for (size_t i = 0; i < fields.size(); ++i) {
+        EXPECT_NEAR(evaluateWithoutQuantization(mlp, fields[i]), scores[i], 0.5) << fields[i];
+        EXPECT_DOUBLE_EQ(evaluator.evaluate(fields[i]), scores[i]);
+    }
+}
+
+TEST(NeuralEvaluatorTest, load)
+{
+    learning::MultiLayerPerceptron mlp(NeuralEvaluator::INPUT_SIZE, NUM_HIDDEN, NUM_OUTPUT);
+    string filename = tempFilename();
+    ASSERT_TRUE(mlp.saveParameter(filename));
+
+    unique_ptr<NeuralEvaluator> evaluator = NeuralEvaluator::load(filename);
+    ASSERT_TRUE(evaluator.get() != nullptr);
+
+    NeuralEvaluator expected(mlp);
+    for (const auto& f : makeFields())
+        EXPECT_DOUBLE_EQ(expected.evaluate(f), evaluator->evaluate(f));
+
+    learning::MultiLayerPerceptron wrongSize(NeuralEvaluator::INPUT_SIZE + 1, NUM_HIDDEN, NUM_OUTPUT);
+    ASSERT_TRUE(wrongSize.saveParameter(filename));
+    EXPECT_TRUE(NeuralEvaluator::load(filename).get() == nullptr);
+
+    remove(filename.c_str());
+}
+
+TEST(NeuralEvaluatorTest, trainBatch)
+{
+    // Learns whether the field has a puyo on the 3rd column.
+    learning::MultiLayerPerceptron mlp(NeuralEvaluator::INPUT_SIZE, NUM_HIDDEN, 2);
+
+    vector<CoreField> fields {
+        CoreField("..R..."), CoreField("..B..."), CoreField("R....."), CoreField(".....Y"),
+        CoreField("..RB.."), CoreField("BY...."), CoreField("..O..."), CoreField("....GG"),
+    };
+    vector<int> labels { 1, 1, 0, 0, 1, 0, 1, 0 };
+    vector<float> xs(fields.size() * NeuralEvaluator::INPUT_SIZE);
+    for (size_t i = 0; i < fields.size(); ++i)
+        NeuralEvaluator::encode(fields[i], &xs[i * NeuralEvaluator::INPUT_SIZE]);
+
+    // The same initial weights as |mlp|.
+    learning::MultiLayerPerceptron parallelMlp(NeuralEvaluator::INPUT_SIZE, NUM_HIDDEN, 2);
+    parallelMlp.setHiddenLayerParameter(mlp.hiddenLayerParameter());
+    parallelMlp.setOutputLayerParameter(mlp.outputLayerParameter());
+
+    Executor executor(3);
+    executor.start();
+
+    int numCorrect = 0;
+    for (int epoch = 0; epoch < 200; ++epoch) {
+        numCorrect = mlp.trainBatch(labels.data(), xs.data(), fields.size(), 0.1, 0.0);
+        parallelMlp.trainBatch(labels.data(), xs.data(), fields.size(), 0.1, 0.0, &executor, 3);
+    }
+    executor.stop();
+
+    EXPECT_EQ(static_cast<int>(fields.size()), numCorrect);
+
+    auto data = mlp.makeForwadingStorage();
+    for (size_t i = 0; i < fields.size(); ++i)
+        EXPECT_EQ(labels[i], mlp.predict(&xs[i * NeuralEvaluator::INPUT_SIZE], &data)) << fields[i];
+
+    // The parallel training differs only in rounding errors.
+    for (int i = 0; i < (NeuralEvaluator::INPUT_SIZE + 1) * NUM_HIDDEN; ++i)
+        EXPECT_NEAR(mlp.hiddenLayerParameter()[i], parallelMlp.hiddenLayerParameter()[i], 1e-3) << i;
+    for (int i = 0; i < (NUM_HIDDEN + 1) * 2; ++i)
+        EXPECT_NEAR(mlp.outputLayerParameter()[i], parallelMlp.outputLayerParameter()[i], 1e-3) << i;
+}
@@ -0,0 +1,291 @@
+#include "parameter_tuner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <random>
+
+#include <glog/logging.h>
+
+using namespace std;
+
+namespace {
+
+toml::Value toTomlArray(const vector<double>& vs)
+{
+    toml::Value v((toml::Array()));
+    for (double d : vs)
+        v.push(d);
+    return v;
+}
+
+bool fromTomlArray(const toml::Value* v, vector<double>* vs)
+{
+    if (!v || !v->is<toml::Array>())
+        return false;
+
+    vs->clear();
+    for (const auto& x : v->as<toml::Array>()) {
+        if (!x.isNumber())
+            return false;
+        vs->push_back(x.asNumber());
+    }
+    return true;
+}
+
+}
+
+TunableParameters::TunableParameters(const EvaluationParameterMap& paramMap)
+{
+    addEntries<EvaluationMoveFeatureSet>(paramMap.moveParamSet().defaultParam(),
+                                         Kind::MOVE, Kind::MOVE_SPARSE, "move.");
+    addEntries<EvaluationRensaFeatureSet>(paramMap.mainRensaParamSet().defaultParam(),
+                                          Kind::MAIN_RENSA, Kind::MAIN_RENSA_SPARSE, "main.");
+}
+
+template<typename FeatureSet, typename Param>
+void TunableParameters::addEntries(const Param& param, Kind kind, Kind sparseKind, const string& prefix)
+{
+    for (const auto& ef : FeatureSet::features()) {
+        if (!ef.isTweakable() || !param.hasParam(ef.key()))
+            continue;
+        entries_.push_back(Entry { kind, ef.key(), 0, prefix + ef.name() });
+    }
+
+    for (const auto& ef : FeatureSet::sparseFeatures()) {
+        if (!ef.isTweakable() || !param.hasParam(ef.key()))
+            continue;
+        for (size_t i = 0; i < ef.size(); ++i) {
+            entries_.push_back(Entry { sparseKind, ef.key(), static_cast<int>(i),
+                                       prefix + ef.name() + "[" + to_string(i) + "]" });
+        }
+    }
+}
+
+vector<string> TunableParameters::names() const
+{
+    vector<string> result;
+    for (const auto& entry : entries_)
+        result.push_back(entry.name);
+    return result;
+}
+
+vector<double> TunableParameters::values(const EvaluationParameterMap& paramMap) const
+{
+    const EvaluationMoveParameter& move = paramMap.moveParamSet().defaultParam();
+    const EvaluationRensaParameter& main = paramMap.mainRensaParamSet().defaultParam();
+
+    vector<double> result;
+    result.reserve(entries_.size());
+    for (const auto& entry : entries_) {
+        switch (entry.kind) {
+        case Kind::MOVE:
+            result.push_back(move.param(static_cast<EvaluationMoveFeatureKey>(entry.key)));
+            break;
+        case Kind::MOVE_SPARSE:
+            result.push_back(move.param(static_cast<EvaluationMoveSparseFeatureKey>(entry.key), entry.index));
+            break;
+        case Kind::MAIN_RENSA:
+            result.push_back(main.param(static_cast<EvaluationRensaFeatureKey>(entry.key)));
+            break;
+        case Kind::MAIN_RENSA_SPARSE:
+            result.push_back(main.param(static_cast<EvaluationRensaSparseFeatureKey>(entry.key), entry.index));
+            break;
+        }
+    }
+    return result;
+}
+
+void TunableParameters::apply(const vector<double>& values, EvaluationParameterMap* paramMap) const
+{
+    CHECK_EQ(values.size(), entries_.size());
+
+    EvaluationMoveParameterSet* move = paramMap->mutableMoveParamSet();
+    EvaluationRensaParameterSet* main = paramMap->mutableMainRensaParamSet();
+
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        const Entry& entry = entries_[i];
+        switch (entry.kind) {
+        case Kind::MOVE:
+            move->setDefault(static_cast<EvaluationMoveFeatureKey>(entry.key), values[i]);
+            break;
+        case Kind::MOVE_SPARSE:
+            move->setDefault(static_cast<EvaluationMoveSparseFeatureKey>(entry.key), entry.index, values[i]);
+            break;
+        case Kind::MAIN_RENSA:
+            main->setDefault(static_cast<EvaluationRensaFeatureKey>(entry.key), values[i]);
+            break;
+        case Kind::MAIN_RENSA_SPARSE:
+            main->setDefault(static_cast<EvaluationRensaSparseFeatureKey>(entry.key), entry.index, values[i]);
+            break;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------
+
+SpsaTuner::SpsaTuner(const vector<double>& theta, const Config& config, uint32_t seed) :
+    config_(config),
+    seed_(seed),
+    theta_(theta)
+{
+    scale_.reserve(theta.size());
+    for (double t : theta)
+        scale_.push_back(std::max(std::abs(t), 1.0));
+}
+
+double SpsaTuner::ak() const
+{
+    return config_.a / std::pow(iteration_ + 1 + config_.stability, config_.alpha);
+}
+
+double SpsaTuner::ck() const
+{
+    return config_.c / std::pow(iteration_ + 1, config_.gamma);
+}
+
+vector<int> SpsaTuner::perturbation() const
+{
+    // Uses the raw output of mt19937, which is specified by the standard, so that
+    // the perturbation of an iteration is reproducible across platforms.
+    seed_seq seq { seed_, static_cast<uint32_t>(iteration_) };
+    mt19937 mt(seq);
+
+    vector<int> delta(theta_.size());
+    for (size_t i = 0; i < delta.size(); ++i)
+        delta[i] = (mt() & 1) ? 1 : -1;
+    return delta;
+}
+
+SpsaTuner::Candidate SpsaTuner::propose() const
+{
+    vector<int> delta = perturbation();
+    double c = ck();
+
+    Candidate candidate;
+    candidate.plus = theta_;
+    candidate.minus = theta_;
+    for (size_t i = 0; i < theta_.size(); ++i) {
+        candidate.plus[i] += c * scale_[i] * delta[i];
+        candidate.minus[i] -= c * scale_[i] * delta[i];
+    }
+    return candidate;
+}
+
+void SpsaTuner::update(double scorePlus, double scoreMinus)
+{
+    // Since theta is perturbed in the space normalized by scale_, the gradient
+    // is also estimated in that space.
+    vector<int> delta = perturbation();
+    double a = ak();
+    double c = ck();
+    for (size_t i = 0; i < theta_.size(); ++i) {
+        double g = (scorePlus - scoreMinus) / (2 * c * delta[i]);
+        theta_[i] += a * g * scale_[i];
+    }
+
+    ++iteration_;
+}
+
+bool SpsaTuner::updateBest(const vector<double>& theta, double score)
+{
+    CHECK_EQ(theta.size(), theta_.size());
+    if (!bestTheta_.empty() && score <= bestScore_)
+        return false;
+
+    bestScore_ = score;
+    bestTheta_ = theta;
+    return true;
+}
+
+toml::Value SpsaTuner::toTomlValue() const
+{
+    toml::Value v((toml::Table()));
+    v.set("seed", static_cast<int>(seed_));
+    v.set("iteration", iteration_);
+    v.set("theta", toTomlArray(theta_));
+    v.set("scale", toTomlArray(scale_));
+    if (!bestTheta_.empty()) {
+        v.set("best_score", bestScore_);
+        v.set("best_theta", toTomlArray(bestTheta_));
+    }
+    return v;
+}
+
+bool SpsaTuner::loadValue(const toml::Value& v)
+{
+    const toml::Value* seed = v.find("seed");
+    const toml::Value* iteration = v.find("iteration");
+    if (!seed || !seed->is<int>() || !iteration || !iteration->is<int>()) {
+        LOG(ERROR) << "seed and iteration should be integers";
+        return false;
+    }
+
+    vector<double> theta, scale, bestTheta;
+    if (!fromTomlArray(v.find("theta"), &theta) || !fromTomlArray(v.find("scale"), &scale)) {
+        LOG(ERROR) << "theta and scale should be arrays of numbers";
+        return false;
+    }
+    if (theta.size() != theta_.size() || scale.size() != theta_.size()) {
+        LOG(ERROR) << "the number of parameters is " << theta_.size()
+                   << ", but the checkpoint has " << theta.size();
+        return false;
+    }
+
+    double bestScore = 0.0;
+    if (const toml::Value* best = v.find("best_score")) {
+        if (!best->isNumber() || !fromTomlArray(v.find("best_theta"), &bestTheta) || bestTheta.size() != theta.size()) {
+            LOG(ERROR) << "best_score and best_theta are broken";
+            return false;
+        }
+        bestScore = best->asNumber();
+    }
+
+    seed_ = static_cast<uint32_t>(seed->as<int>());
+    iteration_ = iteration->as<int>();
+    theta_ = theta;
+    scale_ = scale;
+    bestScore_ = bestScore;
+    bestTheta_ = bestTheta;
+    return true;
+}
+
+bool SpsaTuner::save(const string& filename) const
+{
+    // Writes to a temporary file first so that a crash while saving doesn't
+    // break the previous checkpoint.
+    string tmpFilename = filename + ".tmp";
+    try {
+        ofstream ofs(tmpFilename, ios::out | ios::trunc);
+        if (!ofs)
+            return false;
+        toTomlValue().write(&ofs);
+        if (!ofs)
+            return false;
+    } catch (std::exception& e) {
+        LOG(WARNING) << "SpsaTuner::save failed: " << e.what();
+        return false;
+    }
+
+    return std::rename(tmpFilename.c_str(), filename.c_str()) == 0;
+}
+
+bool SpsaTuner::load(const string& filename)
+{
+    try {
+        ifstream ifs(filename, ios::in);
+        if (!ifs)
+            return false;
+        toml::ParseResult result = toml::parse(ifs);
+        if (!result.valid()) {
+            LOG(ERROR) << result.errorReason;
+            return false;
+        }
+        return loadValue(result.value);
+    } catch (std::exception& e) {
+        LOG(WARNING) << "SpsaTuner::load failed: " << e.what();
+        return false;
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef CPU_MAYAH_PARAMETER_TUNER_H_
+#define CPU_MAYAH_PARAMETER_TUNER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <toml/toml.h>
+
+#include "evaluation_parameter.h"
+
+// TunableParameters flattens the tweakable parameters of EvaluationParameterMap
+// into a vector of doubles. Only the default (mode independent) parameters of
+// the move and the main rensa parameter sets that are present in the map are
+// considered. Each element of a sparse parameter becomes one entry.
+class TunableParameters {
+public:
+    explicit TunableParameters(const EvaluationParameterMap&);
+
+    size_t size() const { return entries_.size(); }
+    const std::string& name(size_t i) const { return entries_[i].name; }
+    std::vector<std::string> names() const;
+
+    std::vector<double> values(const EvaluationParameterMap&) const;
+    // Overwrites the default parameters of |paramMap| with |values|.
+    void apply(const std::vector<double>& values, EvaluationParameterMap* paramMap) const;
+
+private:
+    enum class Kind { MOVE, MOVE_SPARSE, MAIN_RENSA, MAIN_RENSA_SPARSE };
+    struct Entry {
+        Kind kind;
+        int key;
+        int index;
+        std::string name;
+    };
+
+    template<typename FeatureSet, typename Param>
+    void addEntries(const Param&, Kind kind, Kind sparseKind, const std::string& prefix);
+
+    std::vector<Entry> entries_;
+};
+
+// SpsaTuner maximizes a noisy score with simultaneous perturbation stochastic
+// approximation. Each iteration evaluates two candidates, theta + c_k * delta
+// and theta - c_k * delta, where delta is a random +1/-1 vector scaled by the
+// magnitude of each initial parameter. So the gradient estimate costs
+// 2 evaluations regardless of the number of parameters.
+//
+// The perturbation of an iteration depends only on (seed, iteration), so the
+// state can be checkpointed with save() and resumed with load().
+//
+// The scores passed to update() are measured on different cases in each iteration,
+// so they cannot be compared across iterations. The best candidate is tracked
+// with updateBest(), whose scores must be measured on the same cases.
+class SpsaTuner {
+public:
+    struct Config {
+        double a = 0.1;
+        double c = 0.05;
+        double stability = 10.0; // A in a_k = a / (k + 1 + A)^alpha.
+        double alpha = 0.602;
+        double gamma = 0.101;
+    };
+
+    struct Candidate {
+        std::vector<double> plus;
+        std::vector<double> minus;
+    };
+
+    SpsaTuner(const std::vector<double>& theta, const Config&, std::uint32_t seed);
+
+    int iteration() const { return iteration_; }
+    const std::vector<double>& theta() const { return theta_; }
+    // The best candidate passed to updateBest(). bestTheta() is empty before the first updateBest().
+    double bestScore() const { return bestScore_; }
+    const std::vector<double>& bestTheta() const { return bestTheta_; }
+
+    // Returns the candidates of the current iteration.
+    Candidate propose() const;
+    // Updates theta with the scores of the candidates returned by propose(),
+    // and advances the iteration.
+    void update(double scorePlus, double scoreMinus);
+    // Makes |theta| the best if |score| is better than bestScore(). |score| must be
+    // measured on the same cases as bestScore(). Returns true if the best is updated.
+    bool updateBest(const std::vector<double>& theta, double score);
+
+    toml::Value toTomlValue() const;
+    bool loadValue(const toml::Value&);
+
+    bool save(const std::string& filename) const;
+    bool load(const std::string& filename);
+
+private:
+    std::vector<int> perturbation() const;
+    double ak() const;
+    double ck() const;
+
+    Config config_;
+    std::uint32_t seed_;
+    int iteration_ = 0;
+    std::vector<double> theta_;
+    std::vector<double> scale_;
+    double bestScore_ = 0.0;
+    std::vector<double> bestTheta_;
+};
+
+#endif // CPU_MAYAH_PARAMETER_TUNER_H_
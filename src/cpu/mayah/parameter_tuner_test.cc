@@ -0,0 +1,123 @@
+#include "parameter_tuner.h"
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+EvaluationParameterMap makeParameterMap()
+{
+    EvaluationParameterMap paramMap;
+    paramMap.mutableMoveParamSet()->setDefault(CONNECTION_2, 10.0);
+    paramMap.mutableMoveParamSet()->setDefault(CONNECTION_3, -0.5);
+    paramMap.mutableMainRensaParamSet()->setDefault(SCORE, 3.0);
+    return paramMap;
+}
+
+}
+
+TEST(TunableParametersTest, valuesAndApply)
+{
+    EvaluationParameterMap paramMap = makeParameterMap();
+    TunableParameters tunable(paramMap);
+
+    ASSERT_EQ(3U, tunable.size());
+    EXPECT_EQ((vector<string> { "move.CONNECTION_2", "move.CONNECTION_3", "main.SCORE" }), tunable.names());
+    EXPECT_EQ((vector<double> { 10.0, -0.5, 3.0 }), tunable.values(paramMap));
+
+    tunable.apply(vector<double> { 1.0, 2.0, 4.0 }, &paramMap);
+    EXPECT_EQ(1.0, paramMap.moveParamSet().param(EvaluationMode::EARLY, CONNECTION_2));
+    EXPECT_EQ(2.0, paramMap.moveParamSet().param(EvaluationMode::EARLY, CONNECTION_3));
+    EXPECT_EQ(4.0, paramMap.mainRensaParamSet().param(EvaluationMode::EARLY, SCORE));
+}
+
+TEST(SpsaTunerTest, propose)
+{
+    SpsaTuner::Config config;
+    SpsaTuner tuner(vector<double> { 10.0, -0.5, 3.0 }, config, 1);
+
+    SpsaTuner::Candidate candidate = tuner.propose();
+    ASSERT_EQ(3U, candidate.plus.size());
+    ASSERT_EQ(3U, candidate.minus.size());
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_NE(candidate.plus[i], candidate.minus[i]);
+        EXPECT_DOUBLE_EQ(tuner.theta()[i] * 2, candidate.plus[i] + candidate.minus[i]);
+    }
+
+    // The same iteration proposes the same candidate.
+    SpsaTuner::Candidate again = tuner.propose();
+    EXPECT_EQ(candidate.plus, again.plus);
+    EXPECT_EQ(candidate.minus, again.minus);
+}
+
+TEST(SpsaTunerTest, update)
+{
+    SpsaTuner::Config config;
+    SpsaTuner tuner(vector<double> { 10.0, -0.5, 3.0 }, config, 1);
+
+    SpsaTuner::Candidate candidate = tuner.propose();
+    tuner.update(2.0, 1.0);
+
+    EXPECT_EQ(1, tuner.iteration());
+    // The scores of update() are not compared across iterations.
+    EXPECT_TRUE(tuner.bestTheta().empty());
+
+    // theta moves toward the better candidate.
+    for (size_t i = 0; i < 3; ++i) {
+        double before = (candidate.plus[i] + candidate.minus[i]) / 2;
+        EXPECT_GT((tuner.theta()[i] - before) * (candidate.plus[i] - before), 0.0);
+    }
+}
+
+TEST(SpsaTunerTest, updateBest)
+{
+    SpsaTuner::Config config;
+    SpsaTuner tuner(vector<double> { 10.0, -0.5, 3.0 }, config, 1);
+
+    EXPECT_TRUE(tuner.updateBest(vector<double> { 1.0, 2.0, 3.0 }, -5.0));
+    EXPECT_EQ(-5.0, tuner.bestScore());
+    EXPECT_FALSE(tuner.updateBest(vector<double> { 4.0, 5.0, 6.0 }, -5.0));
+    EXPECT_FALSE(tuner.updateBest(vector<double> { 4.0, 5.0, 6.0 }, -6.0));
+    EXPECT_EQ((vector<double> { 1.0, 2.0, 3.0 }), tuner.bestTheta());
+
+    EXPECT_TRUE(tuner.updateBest(vector<double> { 4.0, 5.0, 6.0 }, 1.0));
+    EXPECT_EQ(1.0, tuner.bestScore());
+    EXPECT_EQ((vector<double> { 4.0, 5.0, 6.0 }), tuner.bestTheta());
+}
+
+TEST(SpsaTunerTest, checkpoint)
+{
+    SpsaTuner::Config config;
+    SpsaTuner tuner(vector<double> { 10.0, -0.5, 3.0 }, config, 7);
+    tuner.update(1.0, 3.0);
+    tuner.updateBest(tuner.theta(), 2.5);
+    tuner.update(2.0, 0.5);
+
+    stringstream ss;
+    tuner.toTomlValue().write(&ss);
+    toml::ParseResult result = toml::parse(ss);
+    ASSERT_TRUE(result.valid());
+
+    SpsaTuner resumed(vector<double> { 0.0, 0.0, 0.0 }, config, 1);
+    ASSERT_TRUE(resumed.loadValue(result.value));
+
+    EXPECT_EQ(tuner.iteration(), resumed.iteration());
+    EXPECT_EQ(tuner.bestScore(), resumed.bestScore());
+    ASSERT_EQ(3U, resumed.theta().size());
+    for (size_t i = 0; i < 3; ++i) {
+        EXPECT_NEAR(tuner.theta()[i], resumed.theta()[i], 1e-5);
+        EXPECT_NEAR(tuner.bestTheta()[i], resumed.bestTheta()[i], 1e-5);
+    }
+
+    // The resumed tuner proposes the same perturbation.
+    SpsaTuner::Candidate expected = tuner.propose();
+    SpsaTuner::Candidate actual = resumed.propose();
+    for (size_t i = 0; i < 3; ++i)
+        EXPECT_NEAR(expected.plus[i], actual.plus[i], 1e-5);
+
+    SpsaTuner other(vector<double> { 0.0, 0.0 }, config, 1);
+    EXPECT_FALSE(other.loadValue(result.value));
+}
@@ -1,5 +1,6 @@
 #include "pattern_thinker.h"
 
+#include <algorithm>
 #include <vector>
 
 #include "decision_planner.h"
@@ -7,6 +8,83 @@
 
 using namespace std;
 
+namespace {
+
+// The best plans found by one worker. A plan is kept as its decisions only,
+// and materialized by materializePlan() after the search.
+// Ties are broken in the order of the sequential search, so that the result doesn't depend
+// on how the evaluations are scheduled.
+struct BestPlanSlot {
+    void updateBest(double s, const vector<Decision>& ds, const MidEvalResult& r)
+    {
+        if (score < s || (score == s && isPlannedBefore(ds, decisions))) {
+            score = s;
+            decisions = ds;
+            midEvalResult = r;
+        }
+    }
+
+    void updateBestRensa(int s, int frames, const vector<Decision>& ds, const MidEvalResult& r)
+    {
+        if (rensaScore < s || (rensaScore == s && rensaFrames > frames) ||
+            (rensaScore == s && rensaFrames == frames && !rensaDecisions.empty() && isPlannedBefore(ds, rensaDecisions))) {
+            rensaScore = s;
+            rensaFrames = frames;
+            rensaDecisions = ds;
+            rensaMidEvalResult = r;
+        }
+    }
+
+    void merge(const BestPlanSlot& slot)
+    {
+        ojamaFallen |= slot.ojamaFallen;
+        virtualRensaScore = std::max(virtualRensaScore, slot.virtualRensaScore);
+        if (!slot.decisions.empty())
+            updateBest(slot.score, slot.decisions, slot.midEvalResult);
+        if (!slot.rensaDecisions.empty())
+            updateBestRensa(slot.rensaScore, slot.rensaFrames, slot.rensaDecisions, slot.rensaMidEvalResult);
+    }
+
+    double score = -100000000.0;
+    vector<Decision> decisions;
+    MidEvalResult midEvalResult;
+
+    int rensaScore = 0;
+    int rensaFrames = 0;
+    vector<Decision> rensaDecisions;
+    MidEvalResult rensaMidEvalResult;
+
+    int virtualRensaScore = 0;
+    bool ojamaFallen = false;
+};
+
+// Replays |decisions| to make the Plan that DecisionPlanner has evaluated.
+Plan materializePlan(int frameId, const CoreField& field, const KumipuyoSeq& kumipuyoSeq,
+                     const PlayerState& me, const PlayerState& enemy, int depth,
+                     const vector<Decision>& decisions)
+{
+    if (decisions.empty())
+        return Plan();
+
+    Plan plan;
+    bool found = false;
+    DecisionPlanner<MidEvalResult> planner(
+        [](const RefPlan&) { return MidEvalResult(); },
+        [&](const RefPlan& refPlan, const MidEvalResult&) {
+            if (!found && refPlan.decisions() == decisions) {
+                plan = refPlan.toPlan();
+                found = true;
+            }
+        });
+    planner.setSpecifiedDecisions(decisions);
+    planner.iterate(frameId, field, kumipuyoSeq, me, enemy, depth);
+
+    CHECK(found) << toString(decisions);
+    return plan;
+}
+
+} // anonymous namespace
+
 PatternThinker::PatternThinker(const EvaluationParameterMap& evaluationParameterMap,
                                const DecisionBook& decisionBook,
                                const PatternBook& patternBook,
@@ -92,91 +170,32 @@ ThoughtResult PatternThinker::thinkPlan(int frameId, const CoreField& field, con
         }
     }
 
-    Plan bestPlan;
-    double bestScore = -100000000.0;
-    MidEvalResult bestMidEvalResult;
-
-    Plan bestRensaPlan;
-    int bestRensaScore = 0;
-    int bestRensaFrames = 0;
-    MidEvalResult bestRensaMidEvalResult;
-
-    int bestVirtualRensaScore = 0;
+    // The evaluators take the rest of the sequence without copying it.
+    const KumipuyoSeqView seqView(kumipuyoSeq);
 
-    bool ojamaFallen = false;
-
-    mutex mu;
+    // Each worker keeps its own best-so-far in its slot, so evaluators don't contend on a lock.
+    // Slot 0 is for the calling thread, and slot i + 1 is for the i-th worker of the executor.
+    vector<BestPlanSlot> slots((executor_ ? executor_->numThreads() : 0) + 1);
     auto evalRefPlan = [&, this, frameId, maxIteration](const RefPlan& plan, const MidEvalResult& midEvalResult) {
-        KumipuyoSeq restSeq(kumipuyoSeq.subsequence(plan.decisions().size()));
+        KumipuyoSeqView restSeq(seqView.subsequence(plan.decisions().size()));
         // Here, we iterate enemy's possible rensa.
         EvalResult evalResult = eval(plan, restSeq, frameId, maxIteration, me, enemy, midEvalResult, fast, usesRensaHandTree, gazeResult);
-        Plan evaledPlan = plan.toPlan();
-
-        // Hmm, it looks weaker if we search this...
-#if 0
-        if (!gazeResult.feasibleRensaHandTree().nodes().empty()) {
-            const RensaHandNode& node = gazeResult.feasibleRensaHandTree().node(0);
-            for (const auto& edge : node.edges()) {
-                int frameIdRensaFinished = gazeResult.frameIdToStartNextMove() + edge.rensaHand().totalFrames();
-                if (plan.framesToIgnite() < frameIdRensaFinished)
-                    continue;
-
-                int numOjama = edge.rensaHand().score() / 70;
-                numOjama -= enemy.totalOjama(me);
-                if (numOjama < 0)
-                    continue;
-
-                int lines = std::min(5, (me.totalOjama(enemy) + numOjama + 4) / 6);
-                if (lines == 0)
-                    continue;
-
-                // TODO(mayah): p must be more correct.
-                // When enemy has ZENKESHI, p should consider it.
-                // Enemy PlayerState should also be updated.
-
-                Plan p = plan.toPlan();
-                int ojamaFrames = p.mutableField()->fallOjama(lines);
-                p.setLastDropFrames(p.lastDropFrames() + ojamaFrames);
-
-                // TODO(mayah): Instead of gazeResult, we need to use edge.tree().
-                EvalResult result = eval(RefPlan(p), restSeq, frameId, maxIteration, me, enemy, midEvalResult, fast, usesRensaHandTree, gazeResult);
-                if (result.score() < evalResult.score()) {
-                    evalResult = result;
-                    evaledPlan = p;
-                }
-            }
-        }
-#endif
 
         VLOG(1) << toString(plan.decisions())
                 << ": eval=" << evalResult.score()
                 << " pscore=" << plan.score()
                 << " vscore=" << evalResult.maxVirtualScore();
 
-        lock_guard<mutex> lock(mu);
-
-        if (evaledPlan.fallenOjama() > 0)
-            ojamaFallen = true;
-
-        if (bestScore < evalResult.score()) {
-            bestScore = evalResult.score();
-            bestPlan = evaledPlan;
-            bestMidEvalResult = midEvalResult;
-        }
-
-        if (bestVirtualRensaScore < evalResult.maxVirtualScore()) {
-            bestVirtualRensaScore = evalResult.maxVirtualScore();
-        }
-
-        if (bestRensaScore < evaledPlan.score() || (bestRensaScore == evaledPlan.score() && bestRensaFrames > evaledPlan.totalFrames())) {
-            bestRensaScore = evaledPlan.score();
-            bestRensaFrames = evaledPlan.totalFrames();
-            bestRensaPlan = evaledPlan;
-            bestRensaMidEvalResult = midEvalResult;
-        }
+        BestPlanSlot& slot = slots[executor_ ? executor_->currentWorkerIndex() + 1 : 0];
+        if (plan.fallenOjama() > 0)
+            slot.ojamaFallen = true;
+        if (slot.virtualRensaScore < evalResult.maxVirtualScore())
+            slot.virtualRensaScore = evalResult.maxVirtualScore();
+        slot.updateBest(evalResult.score(), plan.decisions(), midEvalResult);
+        slot.updateBestRensa(plan.score(), plan.totalFrames(), plan.decisions(), midEvalResult);
     };
     auto evalMidEval = [&](const RefPlan& plan) {
-        return midEval(plan, field, kumipuyoSeq.subsequence(plan.decisions().size()),
+        return midEval(plan, field, seqView.subsequence(plan.decisions().size()),
                        frameId, maxIteration, me, enemy, gazeResult, usesRensaHandTree);
     };
 
@@ -185,26 +204,32 @@ ThoughtResult PatternThinker::thinkPlan(int frameId, const CoreField& field, con
         planner.setSpecifiedDecisions(*specifiedDecisions);
     planner.iterate(frameId, field, kumipuyoSeq, me, enemy, depth);
 
-    if (!ojamaFallen && bestVirtualRensaScore < bestRensaScore) {
+    BestPlanSlot best;
+    for (const BestPlanSlot& slot : slots)
+        best.merge(slot);
+
+    if (!best.ojamaFallen && best.virtualRensaScore < best.rensaScore) {
+        Plan bestRensaPlan = materializePlan(frameId, field, kumipuyoSeq, me, enemy, depth, best.rensaDecisions);
         std::string message = makeMessageFrom(frameId, kumipuyoSeq, maxIteration,
                                               me, enemy,
-                                              bestRensaMidEvalResult, gazeResult,
-                                              bestRensaPlan, bestRensaScore, bestVirtualRensaScore,
+                                              best.rensaMidEvalResult, gazeResult,
+                                              bestRensaPlan, best.rensaScore, best.virtualRensaScore,
                                               true, fast, usesRensaHandTree);
-        return ThoughtResult(bestRensaPlan, bestRensaScore, bestVirtualRensaScore, bestRensaMidEvalResult, message);
+        return ThoughtResult(bestRensaPlan, best.rensaScore, best.virtualRensaScore, best.rensaMidEvalResult, message);
     } else {
+        Plan bestPlan = materializePlan(frameId, field, kumipuyoSeq, me, enemy, depth, best.decisions);
         std::string message = makeMessageFrom(frameId, kumipuyoSeq, maxIteration,
                                               me, enemy,
-                                              bestMidEvalResult, gazeResult,
-                                              bestPlan, bestRensaScore, bestVirtualRensaScore,
+                                              best.midEvalResult, gazeResult,
+                                              bestPlan, best.rensaScore, best.virtualRensaScore,
                                               false, fast, usesRensaHandTree);
-        return ThoughtResult(bestPlan, bestRensaScore, bestVirtualRensaScore, bestMidEvalResult, message);
+        return ThoughtResult(bestPlan, best.rensaScore, best.virtualRensaScore, best.midEvalResult, message);
     }
 }
 
 MidEvalResult PatternThinker::midEval(const RefPlan& plan,
                                       const CoreField& currentField,
-                                      const KumipuyoSeq& restSeq,
+                                      KumipuyoSeqView restSeq,
                                       int currentFrameId, int maxIteration,
                                       const PlayerState& me,
                                       const PlayerState& enemy,
@@ -223,7 +248,7 @@ MidEvalResult PatternThinker::midEval(const RefPlan& plan,
 }
 
 EvalResult PatternThinker::eval(const RefPlan& plan,
-                                const KumipuyoSeq& restSeq,
+                                KumipuyoSeqView restSeq,
                                 int currentFrameId, int maxIteration,
                                 const PlayerState& me, const PlayerState& enemy,
                                 const MidEvalResult& midEvalResult,
@@ -239,7 +264,7 @@ EvalResult PatternThinker::eval(const RefPlan& plan,
 }
 
 CollectedFeatureCoefScore PatternThinker::evalWithCollectingFeature(const RefPlan& plan,
-                                                                    const KumipuyoSeq& restSeq,
+                                                                    KumipuyoSeqView restSeq,
                                                                     int currentFrameId,
                                                                     int maxIteration,
                                                                     const PlayerState& me,
@@ -270,7 +295,7 @@ std::string PatternThinker::makeMessageFrom(int frameId, const KumipuyoSeq& kumi
 
     RefPlan refPlan(plan);
     CollectedFeatureCoefScore cf =
-        evalWithCollectingFeature(refPlan, kumipuyoSeq.subsequence(refPlan.decisions().size()),
+        evalWithCollectingFeature(refPlan, KumipuyoSeqView(kumipuyoSeq).subsequence(refPlan.decisions().size()),
                                   frameId, maxIteration, me, enemy, midEvalResult, fast, usesRensaHandTree, gazeResult);
 
 
@@ -6,6 +6,7 @@
 #include "core/client/ai/ai.h"
 #include "core/core_field.h"
 #include "core/kumipuyo_seq.h"
+#include "core/kumipuyo_seq_view.h"
 #include "core/pattern/decision_book.h"
 #include "core/pattern/pattern_book.h"
 #include "core/plan/plan.h"
@@ -55,17 +56,17 @@ public:
                             std::vector<Decision>* specifiedDecisions = nullptr) const;
 
     CollectedFeatureCoefScore evalWithCollectingFeature(
-        const RefPlan&, const KumipuyoSeq& restSeq, int currentFrameId, int maxIteration,
+        const RefPlan&, KumipuyoSeqView restSeq, int currentFrameId, int maxIteration,
         const PlayerState& me, const PlayerState& enemy,
         const MidEvalResult&, bool fast, bool usesRensaHandTree, const GazeResult& gazeResult) const;
 
 private:
     MidEvalResult midEval(const RefPlan&, const CoreField& currentField,
-                          const KumipuyoSeq& restSeq,
+                          KumipuyoSeqView restSeq,
                           int currentFrameId, int maxIteration,
                           const PlayerState& me, const PlayerState& enemy,
                           const GazeResult&, bool usesRensaHandTree) const;
-    EvalResult eval(const RefPlan&, const KumipuyoSeq& restSeq, int currentFrameId, int maxIteration,
+    EvalResult eval(const RefPlan&, KumipuyoSeqView restSeq, int currentFrameId, int maxIteration,
                     const PlayerState& me, const PlayerState& enemy,
                     const MidEvalResult&, bool fast, bool usesRensaHandTree, const GazeResult&) const;
 
@@ -1,6 +1,7 @@
 #include "rensa_evaluator.h"
 
 #include "base/base.h"
+#include "base/instrumentation.h"
 #include "core/column_puyo_list.h"
 #include "core/core_field.h"
 #include "core/plan/plan.h"
@@ -17,6 +18,8 @@ void RensaEvaluator<ScoreCollector>::eval(const CoreField& complementedField,
                                           double patternScore,
                                           double virtualRensaScore)
 {
+    INSTRUMENT_SCOPE("RensaEvaluator::eval");
+
     FieldBits ignitionPuyoBits = complementedField.ignitionPuyoBits();
 
     evalRensaRidgeHeight(complementedField);
@@ -136,19 +139,27 @@ void RensaEvaluator<ScoreCollector>::evalRensaScore(double score, double virtual
 template<typename ScoreCollector>
 void RensaEvaluator<ScoreCollector>::evalRensaRidgeHeight(const CoreField& field)
 {
+    int valleyDepth[FieldConstant::MAP_WIDTH];
+    int ridgeHeight[FieldConstant::MAP_WIDTH];
+    field.calculateValleyDepthAndRidgeHeight(valleyDepth, ridgeHeight);
+
     for (int x = 1; x <= 6; ++x) {
-        sc_->addScore(RENSA_RIDGE_HEIGHT, field.ridgeHeight(x), 1);
+        sc_->addScore(RENSA_RIDGE_HEIGHT, ridgeHeight[x], 1);
     }
 }
 
 template<typename ScoreCollector>
 void RensaEvaluator<ScoreCollector>::evalRensaValleyDepth(const CoreField& field)
 {
+    int valleyDepth[FieldConstant::MAP_WIDTH];
+    int ridgeHeight[FieldConstant::MAP_WIDTH];
+    field.calculateValleyDepthAndRidgeHeight(valleyDepth, ridgeHeight);
+
     for (int x = 1; x <= 6; ++x) {
         if (x == 1 || x == 6)
-            sc_->addScore(RENSA_VALLEY_DEPTH_EDGE, field.valleyDepth(x), 1);
+            sc_->addScore(RENSA_VALLEY_DEPTH_EDGE, valleyDepth[x], 1);
         else
-            sc_->addScore(RENSA_VALLEY_DEPTH, field.valleyDepth(x), 1);
+            sc_->addScore(RENSA_VALLEY_DEPTH, valleyDepth[x], 1);
     }
 }
 
@@ -64,7 +64,7 @@ RensaHandTree RensaHandTree::makeTree(int restIteration,
                                       const CoreField& currentField,
                                       const PuyoSet& usedPuyoSet,
                                       int usedPuyoMoveFrames,
-                                      const KumipuyoSeq& wholeKumipuyoSeq)
+                                      KumipuyoSeqView wholeKumipuyoSeq)
 {
     if (restIteration <= 0)
         return RensaHandTree();
@@ -322,7 +322,7 @@ int RensaHandTree::eval(const RensaHandTree& myTree,
     return 0;
 }
 
-RensaHandNodeMaker::RensaHandNodeMaker(int restIteration, const KumipuyoSeq& kumipuyoSeq) :
+RensaHandNodeMaker::RensaHandNodeMaker(int restIteration, KumipuyoSeqView kumipuyoSeq) :
     restIteration_(restIteration),
     kumipuyoSeq_(kumipuyoSeq)
 {
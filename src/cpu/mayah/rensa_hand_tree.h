@@ -7,14 +7,13 @@
 
 #include "core/core_field.h"
 #include "core/frame.h"
-#include "core/kumipuyo_seq.h"
+#include "core/kumipuyo_seq_view.h"
 #include "core/probability/puyo_set.h"
 #include "core/rensa_result.h"
 #include "core/rensa_tracker/rensa_coef_tracker.h"
 
 class ColumnPuyoList;
 class CoreField;
-class KumipuyoSeq;
 class PuyoSet;
 
 class RensaHandEdge;
@@ -57,7 +56,7 @@ public:
                                   const CoreField& currentField,
                                   const PuyoSet& usedPuyoSet,
                                   int usedPuyoMoveFrames,
-                                  const KumipuyoSeq& wholeKumipuyoSeq);
+                                  KumipuyoSeqView wholeKumipuyoSeq);
 
     static int eval(const RensaHandTree& myTree,
                     int myStartingFrameId,
@@ -146,7 +145,7 @@ struct RensaHandCandidate {
 
 class RensaHandNodeMaker {
 public:
-    RensaHandNodeMaker(int restIteration, const KumipuyoSeq& kumipuyoSeq);
+    RensaHandNodeMaker(int restIteration, KumipuyoSeqView kumipuyoSeq);
     ~RensaHandNodeMaker();
 
     int restIteration() const { return restIteration_; }
@@ -161,7 +160,8 @@ public:
 
 private:
     const int restIteration_;
-    const KumipuyoSeq kumipuyoSeq_;
+    // The viewed sequence must outlive this maker.
+    const KumipuyoSeqView kumipuyoSeq_;
     std::vector<RensaHandCandidate> data_;
 };
 
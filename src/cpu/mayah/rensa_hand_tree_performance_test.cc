@@ -5,6 +5,8 @@
 #include <gflags/gflags.h>
 #include <gtest/gtest.h>
 
+#include "base/benchmark_gtest.h"
+#include "base/time_stamp_counter.h"
 #include "core/core_field.h"
 #include "core/kumipuyo_seq.h"
 #include "core/probability/puyo_set_probability.h"
@@ -25,10 +27,14 @@ TEST(RensaHandTreePerformanceTest, pattern1_depth1)
         "YYBBBR");
     KumipuyoSeq seq("RBRGRYYG");
 
+    TimeStampCounterData tsc;
     for (int i = 0; i < 100; ++i) {
+        ScopedTimeStampCounter stsc(&tsc);
         RensaHandTree tree = RensaHandTree::makeTree(1, cf, PuyoSet(), 0, seq);
         UNUSED_VARIABLE(tree);
     }
+
+    reportTestBenchmark(tsc);
 }
 
 TEST(RensaHandTreePerformanceTest, pattern1_depth2)
@@ -45,10 +51,14 @@ TEST(RensaHandTreePerformanceTest, pattern1_depth2)
         "YYBBBR");
     KumipuyoSeq seq("RBRGRYYG");
 
+    TimeStampCounterData tsc;
     for (int i = 0; i < 100; ++i) {
+        ScopedTimeStampCounter stsc(&tsc);
         RensaHandTree tree = RensaHandTree::makeTree(2, cf, PuyoSet(), 0, seq);
         UNUSED_VARIABLE(tree);
     }
+
+    reportTestBenchmark(tsc);
 }
 
 TEST(RensaHandTreePerformanceTest, pattern1_depth3)
@@ -65,10 +75,14 @@ TEST(RensaHandTreePerformanceTest, pattern1_depth3)
         "YYBBBR");
     KumipuyoSeq seq("RBRGRYYG");
 
+    TimeStampCounterData tsc;
     for (int i = 0; i < 100; ++i) {
+        ScopedTimeStampCounter stsc(&tsc);
         RensaHandTree tree = RensaHandTree::makeTree(3, cf, PuyoSet(), 0, seq);
         UNUSED_VARIABLE(tree);
     }
+
+    reportTestBenchmark(tsc);
 }
 
 TEST(RensaHandTreePerformanceTest, pattern2_depth2)
@@ -82,8 +96,12 @@ TEST(RensaHandTreePerformanceTest, pattern2_depth2)
         "YYYBYY");
     KumipuyoSeq seq("RGRY");
 
+    TimeStampCounterData tsc;
     for (int i = 0; i < 100; ++i) {
+        ScopedTimeStampCounter stsc(&tsc);
         RensaHandTree tree = RensaHandTree::makeTree(2, cf, PuyoSet(), 0, seq);
         UNUSED_VARIABLE(tree);
     }
+
+    reportTestBenchmark(tsc);
 }
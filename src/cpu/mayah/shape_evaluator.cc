@@ -4,6 +4,7 @@
 
 #include "core/plan/plan.h"
 #include "core/core_field.h"
+#include "core/field_features.h"
 
 #include "evaluation_parameter.h"
 #include "score_collector.h"
@@ -11,10 +12,11 @@
 template<typename ScoreCollector>
 void ShapeEvaluator<ScoreCollector>::eval(const CoreField& field)
 {
-    evalCountPuyoFeature(field);
-    evalConnection(field);
-    evalRestrictedConnectionHorizontalFeature(field);
-    evalThirdColumnHeightFeature(field);
+    const FieldFeatures features(field);
+    evalCountPuyoFeature(features);
+    evalConnection(features);
+    evalRestrictedConnectionHorizontalFeature(features);
+    evalThirdColumnHeightFeature(features);
     evalValleyDepth(field);
     evalRidgeHeight(field);
     evalFieldUShape(field);
@@ -25,79 +27,83 @@ void ShapeEvaluator<ScoreCollector>::eval(const CoreField& field)
 template<typename ScoreCollector>
 void ShapeEvaluator<ScoreCollector>::evalCountPuyoFeature(const CoreField& field)
 {
-    sc_->addScore(NUM_COUNT_PUYOS, field.countColorPuyos(), 1);
-    sc_->addScore(NUM_COUNT_OJAMA, field.countColor(PuyoColor::OJAMA));
+    evalCountPuyoFeature(FieldFeatures(field));
+}
+
+template<typename ScoreCollector>
+void ShapeEvaluator<ScoreCollector>::evalCountPuyoFeature(const FieldFeatures& features)
+{
+    sc_->addScore(NUM_COUNT_PUYOS, features[FieldFeatures::NUM_COLOR_PUYOS], 1);
+    sc_->addScore(NUM_COUNT_OJAMA, features[FieldFeatures::NUM_OJAMA_PUYOS]);
 }
 
 template<typename ScoreCollector>
 void ShapeEvaluator<ScoreCollector>::evalConnection(const CoreField& field)
 {
-    int count2, count3;
-    field.countConnection(&count2, &count3);
-    sc_->addScore(CONNECTION_2, count2);
-    sc_->addScore(CONNECTION_3, count3);
+    evalConnection(FieldFeatures(field));
 }
 
 template<typename ScoreCollector>
-void ShapeEvaluator<ScoreCollector>::evalRestrictedConnectionHorizontalFeature(const CoreField& f)
+void ShapeEvaluator<ScoreCollector>::evalConnection(const FieldFeatures& features)
 {
-    const int MAX_HEIGHT = 3; // instead of FieldConstant::HEIGHT
-    for (int y = 1; y <= MAX_HEIGHT; ++y) {
-        for (int x = 1; x < FieldConstant::WIDTH; ++x) {
-            if (!isNormalColor(f.color(x, y)))
-                continue;
-
-            int len = 1;
-            while (f.color(x, y) == f.color(x + len, y))
-                ++len;
-
-            EvaluationMoveFeatureKey key;
-            if (len == 1) {
-                continue;
-            } else if (len == 2) {
-                if (x <= 3 && 4 < x + len) {
-                    key = CONNECTION_HORIZONTAL_CROSSED_2;
-                } else {
-                    key = CONNECTION_HORIZONTAL_2;
-                }
-            } else if (len == 3) {
-                if (x <= 3 && 4 < x + len) {
-                    key = CONNECTION_HORIZONTAL_CROSSED_3;
-                } else {
-                    key = CONNECTION_HORIZONTAL_3;
-                }
-            } else {
-                CHECK(false) << "shouldn't happen: " << len;
-            }
-
-            sc_->addScore(key, 1);
-            x += len - 1;
-        }
-    }
+    sc_->addScore(CONNECTION_2, features.sum(FieldFeatures::CONNECTION_2));
+    sc_->addScore(CONNECTION_3, features.sum(FieldFeatures::CONNECTION_3));
+}
+
+template<typename ScoreCollector>
+void ShapeEvaluator<ScoreCollector>::evalRestrictedConnectionHorizontalFeature(const CoreField& field)
+{
+    evalRestrictedConnectionHorizontalFeature(FieldFeatures(field));
+}
+
+template<typename ScoreCollector>
+void ShapeEvaluator<ScoreCollector>::evalRestrictedConnectionHorizontalFeature(const FieldFeatures& features)
+{
+    // Only the lowest 3 rows are taken into account, instead of FieldConstant::HEIGHT.
+    static_assert(FieldFeatures::LOW_ROWS == 3, "LOW_ROWS should be 3");
+
+    sc_->addScore(CONNECTION_HORIZONTAL_2, features[FieldFeatures::LOW_HORIZONTAL_2]);
+    sc_->addScore(CONNECTION_HORIZONTAL_CROSSED_2, features[FieldFeatures::LOW_HORIZONTAL_2_CROSSED]);
+    sc_->addScore(CONNECTION_HORIZONTAL_3, features[FieldFeatures::LOW_HORIZONTAL_3]);
+    sc_->addScore(CONNECTION_HORIZONTAL_CROSSED_3, features[FieldFeatures::LOW_HORIZONTAL_3_CROSSED]);
 }
 
 template<typename ScoreCollector>
 void ShapeEvaluator<ScoreCollector>::evalThirdColumnHeightFeature(const CoreField& field)
 {
-    sc_->addScore(THIRD_COLUMN_HEIGHT, field.height(3), 1);
+    evalThirdColumnHeightFeature(FieldFeatures(field));
+}
+
+template<typename ScoreCollector>
+void ShapeEvaluator<ScoreCollector>::evalThirdColumnHeightFeature(const FieldFeatures& features)
+{
+    sc_->addScore(THIRD_COLUMN_HEIGHT, features[FieldFeatures::THIRD_COLUMN_HEIGHT], 1);
 }
 
 template<typename ScoreCollector>
 void ShapeEvaluator<ScoreCollector>::evalValleyDepth(const CoreField& field)
 {
+    int valleyDepth[FieldConstant::MAP_WIDTH];
+    int ridgeHeight[FieldConstant::MAP_WIDTH];
+    field.calculateValleyDepthAndRidgeHeight(valleyDepth, ridgeHeight);
+
     for (int x = 1; x <= 6; ++x) {
         if (x == 1 || x == 6)
-            sc_->addScore(VALLEY_DEPTH_EDGE, field.valleyDepth(x), 1);
+            sc_->addScore(VALLEY_DEPTH_EDGE, valleyDepth[x], 1);
         else
-            sc_->addScore(VALLEY_DEPTH, field.valleyDepth(x), 1);
+            sc_->addScore(VALLEY_DEPTH, valleyDepth[x], 1);
     }
 }
 
 template<typename ScoreCollector>
 void ShapeEvaluator<ScoreCollector>::evalRidgeHeight(const CoreField& field)
 {
+    int valleyDepth[FieldConstant::MAP_WIDTH];
+    int ridgeHeight[FieldConstant::MAP_WIDTH];
+    field.calculateValleyDepthAndRidgeHeight(valleyDepth, ridgeHeight);
+
     for (int x = 1; x <= 6; ++x) {
-        sc_->addScore(RIDGE_HEIGHT, field.ridgeHeight(x), 1);
+        sc_->addScore(RIDGE_HEIGHT, ridgeHeight[x], 1);
     }
 }
 
@@ -2,6 +2,7 @@
 #define CPU_MAYAH_SHAPE_EVALUATOR_H_
 
 class CoreField;
+class FieldFeatures;
 class RefPlan;
 
 template<typename ScoreCollector>
@@ -15,6 +16,11 @@ public:
     void evalConnection(const CoreField&);
     void evalRestrictedConnectionHorizontalFeature(const CoreField&);
     void evalThirdColumnHeightFeature(const CoreField&);
+    // The same as the above, but use the features extracted beforehand.
+    void evalCountPuyoFeature(const FieldFeatures&);
+    void evalConnection(const FieldFeatures&);
+    void evalRestrictedConnectionHorizontalFeature(const FieldFeatures&);
+    void evalThirdColumnHeightFeature(const FieldFeatures&);
     void evalValleyDepth(const CoreField&);
     void evalRidgeHeight(const CoreField&);
     void evalFieldUShape(const CoreField&);
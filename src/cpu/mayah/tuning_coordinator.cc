@@ -0,0 +1,378 @@
+#include <unistd.h>
+
+#if !defined(_MSC_VER)
+#include <poll.h>
+#include <signal.h>
+#endif
+
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+
+#include "base/strings.h"
+#include "net/socket/socket_factory.h"
+#include "solver/endless_batch.h"
+
+#include "evaluation_parameter.h"
+#include "parameter_tuner.h"
+#include "tuning_protocol.h"
+
+DECLARE_string(feature);
+
+DEFINE_string(listen, "unix:/tmp/puyoai_tuning.sock", "the address to listen. unix:<path> or tcp:<port>");
+DEFINE_int32(num_workers, 1, "the number of tuning_worker to wait for before starting. "
+             "More workers can connect later.");
+DEFINE_int32(task_deadline, 600,
+             "a worker which doesn't reply to a task in this seconds is dropped, and the task is "
+             "sent to another worker. 0 means no deadline.");
+DEFINE_int32(iterations, 100, "the number of SPSA iterations.");
+DEFINE_int32(size, 200, "the number of endless cases to evaluate a candidate.");
+DEFINE_int32(validation_size, 200,
+             "the number of endless cases to compare a candidate with the best one. "
+             "The same cases are used in all the iterations.");
+DEFINE_int32(chunk_size, 50, "the number of endless cases sent to a worker at once.");
+DEFINE_int32(tuning_seed, 1, "the seed of the perturbations.");
+DEFINE_double(spsa_a, 0.1, "the step size of SPSA.");
+DEFINE_double(spsa_c, 0.05, "the perturbation size of SPSA relative to each parameter.");
+DEFINE_string(checkpoint, "tuning-checkpoint.toml",
+              "the search state is saved to here after each iteration, and resumed from here if it exists.");
+DEFINE_string(output, "tuned-parameter.toml", "the best parameter is saved here.");
+
+using namespace std;
+
+namespace {
+
+// WorkerPool runs EndlessTasks on the connected workers. Workers can be added
+// at any time, even while run() is running. A worker whose connection is broken,
+// or which doesn't reply before the deadline, is dropped, and its task is sent to
+// another worker. A dropped worker can connect again.
+class WorkerPool {
+public:
+    void addWorker(net::Socket socket);
+    // Waits until |numWorkers| workers are connected.
+    void waitForWorkers(int numWorkers);
+
+    vector<RunResult> run(const vector<EndlessTask>& tasks);
+    void quit();
+
+private:
+    mutex mu_;
+    condition_variable cond_;
+    // The workers not running a task.
+    deque<net::Socket> idleWorkers_;
+    int numWorkers_ = 0;
+    bool quit_ = false;
+};
+
+// Returns true if |socket| has something to read within |timeoutSec| seconds.
+// If |timeoutSec| is 0, waits forever.
+bool waitForReply(net::Socket* socket, int timeoutSec)
+{
+    if (timeoutSec <= 0)
+        return true;
+
+    typedef chrono::steady_clock Clock;
+    const Clock::time_point deadline = Clock::now() + chrono::seconds(timeoutSec);
+
+    struct pollfd pfd;
+    pfd.fd = socket->get();
+    pfd.events = POLLIN;
+    while (true) {
+        auto remaining = chrono::duration_cast<chrono::milliseconds>(deadline - Clock::now());
+        if (remaining.count() <= 0)
+            return false;
+
+        pfd.revents = 0;
+        int r = poll(&pfd, 1, static_cast<int>(remaining.count()));
+        if (r > 0)
+            return true;
+        if (r == 0)
+            return false;
+        if (errno != EINTR) {
+            PLOG(ERROR) << "failed to poll";
+            return false;
+        }
+    }
+}
+
+void WorkerPool::addWorker(net::Socket socket)
+{
+    lock_guard<mutex> lock(mu_);
+    if (quit_) {
+        toml::Value message((toml::Table()));
+        message.set("type", "quit");
+        writeTuningMessage(&socket, message);
+        return;
+    }
+
+    idleWorkers_.push_back(std::move(socket));
+    ++numWorkers_;
+    LOG(INFO) << "worker accepted: " << numWorkers_ << " workers";
+    cond_.notify_all();
+}
+
+void WorkerPool::waitForWorkers(int numWorkers)
+{
+    unique_lock<mutex> lock(mu_);
+    cond_.wait(lock, [&]() { return numWorkers_ >= numWorkers; });
+}
+
+vector<RunResult> WorkerPool::run(const vector<EndlessTask>& tasks)
+{
+    vector<RunResult> results(tasks.size());
+
+    deque<size_t> pending;
+    for (size_t i = 0; i < tasks.size(); ++i)
+        pending.push_back(i);
+    size_t numDone = 0;
+
+    // Each task runs on its own thread, which owns the worker while the task is running.
+    vector<thread> threads;
+    unique_lock<mutex> lock(mu_);
+    while (true) {
+        if (numWorkers_ == 0 && !pending.empty())
+            LOG(WARNING) << "all workers are lost. waiting for a worker to connect.";
+        cond_.wait(lock, [&]() {
+            return numDone == tasks.size() || (!pending.empty() && !idleWorkers_.empty());
+        });
+        if (numDone == tasks.size())
+            break;
+
+        size_t index = pending.front();
+        pending.pop_front();
+        net::Socket worker(std::move(idleWorkers_.front()));
+        idleWorkers_.pop_front();
+
+        threads.emplace_back([&, index](net::Socket worker) {
+            const EndlessTask& task = tasks[index];
+            toml::Value reply;
+            RunResult result;
+            bool ok = writeTuningMessage(&worker, task.toTomlValue());
+            if (ok && !waitForReply(&worker, FLAGS_task_deadline)) {
+                LOG(ERROR) << "worker " << worker.get() << " didn't reply in " << FLAGS_task_deadline << " seconds.";
+                ok = false;
+            }
+            ok = ok && readTuningMessage(&worker, &reply) && loadRunResult(reply, &result);
+
+            lock_guard<mutex> lock(mu_);
+            if (ok) {
+                results[index] = std::move(result);
+                ++numDone;
+                idleWorkers_.push_back(std::move(worker));
+            } else {
+                LOG(ERROR) << "worker " << worker.get() << " is dropped. seeds [" << task.offset << ", "
+                           << (task.offset + task.size) << ") are sent to another worker.";
+                pending.push_back(index);
+                --numWorkers_;
+            }
+            cond_.notify_all();
+        }, std::move(worker));
+    }
+    lock.unlock();
+
+    for (auto& t : threads)
+        t.join();
+    return results;
+}
+
+void WorkerPool::quit()
+{
+    toml::Value message((toml::Table()));
+    message.set("type", "quit");
+
+    lock_guard<mutex> lock(mu_);
+    quit_ = true;
+    for (auto& worker : idleWorkers_)
+        writeTuningMessage(&worker, message);
+}
+
+// Accepts workers forever, so that a worker can connect (again) at any time.
+void acceptWorkers(const string& address, WorkerPool* pool)
+{
+    if (strings::hasPrefix(address, "unix:")) {
+        string path = address.substr(5);
+        unlink(path.c_str());
+
+        net::UnixDomainServerSocket socket(net::SocketFactory::instance()->makeUnixDomainServerSocket());
+        CHECK(socket.bind(path.c_str())) << "cannot bind " << path;
+        CHECK(socket.listen(FLAGS_num_workers));
+        while (true) {
+            net::UnixDomainSocket accepted = socket.accept();
+            if (accepted.valid())
+                pool->addWorker(std::move(accepted));
+        }
+    }
+
+    if (strings::hasPrefix(address, "tcp:")) {
+        string portStr = address.substr(4);
+        CHECK(strings::isAllDigits(portStr)) << "tcp:<port> is expected, but " << address;
+
+        net::TCPServerSocket socket(net::SocketFactory::instance()->makeTCPServerSocket());
+        CHECK(socket.bindFromAny(atoi(portStr.c_str()))) << "cannot bind " << address;
+        CHECK(socket.listen(FLAGS_num_workers));
+        while (true) {
+            net::TCPSocket accepted = socket.accept();
+            if (!accepted.valid())
+                continue;
+            accepted.setTCPNodelay();
+            pool->addWorker(std::move(accepted));
+        }
+    }
+
+    CHECK(false) << "Unknown listen address: " << address;
+}
+
+// Splits the seeds [offset, offset + size) into tasks of FLAGS_chunk_size cases.
+void addTasks(const EvaluationParameterMap& paramMap, int offset, int size, vector<EndlessTask>* tasks)
+{
+    for (int begin = 0; begin < size; begin += FLAGS_chunk_size) {
+        EndlessTask task;
+        task.offset = offset + begin;
+        task.size = min(FLAGS_chunk_size, size - begin);
+        task.paramMap = paramMap;
+        tasks->push_back(task);
+    }
+}
+
+RunResult mergeResults(const vector<RunResult>& results, size_t begin, size_t end)
+{
+    RunResult merged;
+    for (size_t i = begin; i < end; ++i)
+        merged.merge(results[i]);
+    return merged;
+}
+
+// Returns the average score of |paramMap| on the validation cases.
+double validate(const EvaluationParameterMap& paramMap, WorkerPool* pool)
+{
+    vector<EndlessTask> tasks;
+    addTasks(paramMap, 0, FLAGS_validation_size, &tasks);
+    RunResult result = mergeResults(pool->run(tasks), 0, tasks.size());
+    return static_cast<double>(result.resultScore()) / FLAGS_validation_size;
+}
+
+#if !defined(_MSC_VER)
+void ignoreSIGPIPE()
+{
+    struct sigaction act;
+    memset(&act, 0, sizeof(act));
+
+    act.sa_handler = SIG_IGN;
+    sigemptyset(&act.sa_mask);
+
+    CHECK(sigaction(SIGPIPE, &act, 0) == 0);
+}
+#endif
+
+} // anonymous namespace
+
+// tuning_coordinator tunes the tweakable parameters of feature.toml with SPSA.
+// Each iteration evaluates two perturbed parameters on the same endless seeds
+// with the connected tuning_workers. Workers can run on other machines with
+// --listen=tcp:<port>, and can connect at any time. The better one is compared
+// with the best parameter so far on the validation seeds, which are shared by
+// all the iterations.
+int main(int argc, char* argv[])
+{
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    google::InitGoogleLogging(argv[0]);
+#if !defined(_MSC_VER)
+    google::InstallFailureSignalHandler();
+#endif
+
+#if !defined(_MSC_VER)
+    // A lost worker should be retried instead of killing the coordinator.
+    ignoreSIGPIPE();
+#endif
+
+    CHECK_GT(FLAGS_size, 0);
+    CHECK_GT(FLAGS_validation_size, 0);
+    CHECK_GT(FLAGS_chunk_size, 0);
+    CHECK_GE(FLAGS_task_deadline, 0);
+
+    EvaluationParameterMap paramMap;
+    if (!paramMap.load(FLAGS_feature)) {
+        std::string filename = string(SRC_DIR) + "/cpu/mayah/" + FLAGS_feature;
+        if (!paramMap.load(filename))
+            CHECK(false) << "parameter cannot be loaded correctly.";
+    }
+    paramMap.removeNontokopuyoParameter();
+
+    TunableParameters tunable(paramMap);
+    CHECK_GT(tunable.size(), 0U) << "no tweakable parameter is found.";
+
+    SpsaTuner::Config config;
+    config.a = FLAGS_spsa_a;
+    config.c = FLAGS_spsa_c;
+    SpsaTuner tuner(tunable.values(paramMap), config, FLAGS_tuning_seed);
+    if (ifstream(FLAGS_checkpoint)) {
+        CHECK(tuner.load(FLAGS_checkpoint)) << "cannot load " << FLAGS_checkpoint;
+        LOG(INFO) << "resumed from " << FLAGS_checkpoint << " at iteration " << tuner.iteration();
+    }
+
+    WorkerPool pool;
+    thread(acceptWorkers, FLAGS_listen, &pool).detach();
+    pool.waitForWorkers(FLAGS_num_workers);
+
+    // Candidates have to beat the initial parameter to be saved.
+    if (tuner.bestTheta().empty())
+        tuner.updateBest(tunable.values(paramMap), validate(paramMap, &pool));
+
+    while (tuner.iteration() < FLAGS_iterations) {
+        SpsaTuner::Candidate candidate = tuner.propose();
+
+        EvaluationParameterMap plusMap(paramMap);
+        EvaluationParameterMap minusMap(paramMap);
+        tunable.apply(candidate.plus, &plusMap);
+        tunable.apply(candidate.minus, &minusMap);
+
+        // Both candidates are evaluated on the same seeds to reduce the noise
+        // of the difference. The seeds change every iteration to avoid overfitting.
+        // The validation seeds come first.
+        int offset = FLAGS_validation_size + tuner.iteration() * FLAGS_size;
+        vector<EndlessTask> tasks;
+        addTasks(plusMap, offset, FLAGS_size, &tasks);
+        size_t numPlusTasks = tasks.size();
+        addTasks(minusMap, offset, FLAGS_size, &tasks);
+
+        vector<RunResult> results = pool.run(tasks);
+        RunResult plusResult = mergeResults(results, 0, numPlusTasks);
+        RunResult minusResult = mergeResults(results, numPlusTasks, results.size());
+
+        double plusScore = static_cast<double>(plusResult.resultScore()) / FLAGS_size;
+        double minusScore = static_cast<double>(minusResult.resultScore()) / FLAGS_size;
+        cout << "iteration " << tuner.iteration()
+             << ": plus = " << plusScore << " minus = " << minusScore << endl;
+
+        tuner.update(plusScore, minusScore);
+
+        // The scores above are on the seeds of this iteration, so the better candidate
+        // is evaluated again on the validation seeds to compare with the best one.
+        bool plusIsBetter = plusScore >= minusScore;
+        double score = validate(plusIsBetter ? plusMap : minusMap, &pool);
+        cout << "validation: " << score << " best = " << tuner.bestScore() << endl;
+        if (tuner.updateBest(plusIsBetter ? candidate.plus : candidate.minus, score)) {
+            EvaluationParameterMap bestMap(paramMap);
+            tunable.apply(tuner.bestTheta(), &bestMap);
+            CHECK(bestMap.save(FLAGS_output)) << "cannot save " << FLAGS_output;
+            cout << "best score is updated: " << tuner.bestScore() << endl;
+        }
+
+        CHECK(tuner.save(FLAGS_checkpoint)) << "cannot save " << FLAGS_checkpoint;
+    }
+
+    pool.quit();
+    return 0;
+}
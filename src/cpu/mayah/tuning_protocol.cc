@@ -0,0 +1,193 @@
+#include "tuning_protocol.h"
+
+#include <cstdint>
+#include <exception>
+#include <sstream>
+#include <vector>
+
+#include <glog/logging.h>
+
+#if defined(USE_TCP)
+#include "net/socket/socket.h"
+#endif
+
+using namespace std;
+
+namespace {
+
+// Longer messages are considered broken.
+const uint32_t MAX_MESSAGE_SIZE = 16 * 1024 * 1024;
+
+struct RunResultField {
+    const char* name;
+    int RunResult::* field;
+};
+
+const RunResultField RUN_RESULT_FIELDS[] = {
+    { "num_zenkeshi", &RunResult::numZenkeshi },
+    { "sum_score", &RunResult::sumScore },
+    { "sum_main_rensa_score", &RunResult::sumMainRensaScore },
+    { "main_rensa_count", &RunResult::mainRensaCount },
+    { "over_40000_count", &RunResult::over40000Count },
+    { "over_60000_count", &RunResult::over60000Count },
+    { "over_70000_count", &RunResult::over70000Count },
+    { "over_80000_count", &RunResult::over80000Count },
+    { "over_100000_count", &RunResult::over100000Count },
+    { "over_rensa_13_count", &RunResult::overRensa13Count },
+    { "over_rensa_14_count", &RunResult::overRensa14Count },
+    { "over_rensa_15_count", &RunResult::overRensa15Count },
+};
+
+bool findInt(const toml::Value& v, const string& key, int* result)
+{
+    const toml::Value* x = v.find(key);
+    if (!x || !x->is<int>()) {
+        LOG(ERROR) << key << " should be an integer";
+        return false;
+    }
+    *result = x->as<int>();
+    return true;
+}
+
+} // anonymous namespace
+
+toml::Value EndlessTask::toTomlValue() const
+{
+    toml::Value v((toml::Table()));
+    v.set("type", "endless");
+    v.set("offset", offset);
+    v.set("size", size);
+    v.set("parameter", paramMap.toTomlValue());
+    return v;
+}
+
+bool EndlessTask::loadValue(const toml::Value& v)
+{
+    if (tuningMessageType(v) != "endless")
+        return false;
+    if (!findInt(v, "offset", &offset) || !findInt(v, "size", &size))
+        return false;
+
+    const toml::Value* param = v.find("parameter");
+    if (!param) {
+        LOG(ERROR) << "parameter is missing";
+        return false;
+    }
+    return paramMap.loadValue(*param);
+}
+
+toml::Value runResultToTomlValue(const RunResult& result)
+{
+    toml::Value v((toml::Table()));
+    v.set("type", "result");
+    for (const auto& f : RUN_RESULT_FIELDS)
+        v.set(f.name, result.*(f.field));
+
+    toml::Value scores((toml::Array()));
+    toml::Value seeds((toml::Array()));
+    for (const auto& s : result.scores) {
+        scores.push(s.first);
+        seeds.push(s.second);
+    }
+    v.set("scores", scores);
+    v.set("seeds", seeds);
+    return v;
+}
+
+bool loadRunResult(const toml::Value& v, RunResult* result)
+{
+    if (tuningMessageType(v) != "result")
+        return false;
+
+    RunResult r;
+    for (const auto& f : RUN_RESULT_FIELDS) {
+        if (!findInt(v, f.name, &(r.*(f.field))))
+            return false;
+    }
+
+    const toml::Value* scores = v.find("scores");
+    const toml::Value* seeds = v.find("seeds");
+    if (!scores || !scores->is<toml::Array>() || !seeds || !seeds->is<toml::Array>() ||
+        scores->size() != seeds->size()) {
+        LOG(ERROR) << "scores and seeds should be arrays of the same size";
+        return false;
+    }
+
+    const toml::Array& scoreArray = scores->as<toml::Array>();
+    const toml::Array& seedArray = seeds->as<toml::Array>();
+    for (size_t i = 0; i < scoreArray.size(); ++i) {
+        if (!scoreArray[i].is<int>() || !seedArray[i].is<int>()) {
+            LOG(ERROR) << "scores and seeds should be integers";
+            return false;
+        }
+        int score = scoreArray[i].as<int>();
+        int seed = seedArray[i].as<int>();
+        r.scores.push_back(make_pair(score, seed));
+    }
+
+    *result = std::move(r);
+    return true;
+}
+
+string tuningMessageType(const toml::Value& v)
+{
+    const toml::Value* type = v.find("type");
+    if (!type || !type->is<string>())
+        return string();
+    return type->as<string>();
+}
+
+#if defined(USE_TCP)
+
+bool writeTuningMessage(net::Socket* socket, const toml::Value& v)
+{
+    stringstream ss;
+    v.write(&ss);
+    string s = ss.str();
+    CHECK_LE(s.size(), MAX_MESSAGE_SIZE);
+
+    uint32_t size = static_cast<uint32_t>(s.size());
+    unsigned char header[4] = {
+        static_cast<unsigned char>(size >> 24),
+        static_cast<unsigned char>(size >> 16),
+        static_cast<unsigned char>(size >> 8),
+        static_cast<unsigned char>(size),
+    };
+    if (!socket->writeExactly(header, sizeof(header)))
+        return false;
+    return socket->writeExactly(s.data(), s.size());
+}
+
+bool readTuningMessage(net::Socket* socket, toml::Value* v)
+{
+    unsigned char header[4];
+    if (!socket->readExactly(header, sizeof(header)))
+        return false;
+
+    uint32_t size = (static_cast<uint32_t>(header[0]) << 24) | (static_cast<uint32_t>(header[1]) << 16) |
+        (static_cast<uint32_t>(header[2]) << 8) | static_cast<uint32_t>(header[3]);
+    if (size > MAX_MESSAGE_SIZE) {
+        LOG(ERROR) << "too large message: " << size;
+        return false;
+    }
+
+    vector<char> buf(size);
+    if (size > 0 && !socket->readExactly(buf.data(), size))
+        return false;
+
+    try {
+        istringstream iss(string(buf.begin(), buf.end()));
+        toml::ParseResult result = toml::parse(iss);
+        if (!result.valid()) {
+            LOG(ERROR) << result.errorReason;
+            return false;
+        }
+        *v = result.value;
+    } catch (std::exception& e) {
+        LOG(ERROR) << "failed to parse a tuning message: " << e.what();
+        return false;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef CPU_MAYAH_TUNING_PROTOCOL_H_
+#define CPU_MAYAH_TUNING_PROTOCOL_H_
+
+#include <string>
+
+#include <toml/toml.h>
+
+#include "solver/endless_batch.h"
+
+#include "evaluation_parameter.h"
+
+namespace net {
+class Socket;
+}
+
+// Messages between tuning_coordinator and tuning_worker.
+// Each message is a TOML table that has "type". The coordinator sends
+// "endless" (EndlessTask) or "quit", and the worker replies to "endless"
+// with "result" (RunResult).
+
+// EndlessTask asks a worker to run endless with |paramMap| for the seeds
+// [offset, offset + size).
+struct EndlessTask {
+    toml::Value toTomlValue() const;
+    bool loadValue(const toml::Value&);
+
+    int offset = 0;
+    int size = 0;
+    EvaluationParameterMap paramMap;
+};
+
+toml::Value runResultToTomlValue(const RunResult&);
+bool loadRunResult(const toml::Value&, RunResult*);
+
+std::string tuningMessageType(const toml::Value&);
+
+#if defined(USE_TCP)
+// Writes/reads a message framed by its byte length in 4-byte big endian.
+// Returns false if the connection is broken or the message is malformed.
+bool writeTuningMessage(net::Socket*, const toml::Value&);
+bool readTuningMessage(net::Socket*, toml::Value*);
+#endif
+
+#endif // CPU_MAYAH_TUNING_PROTOCOL_H_
@@ -0,0 +1,59 @@
+#include "tuning_protocol.h"
+
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+using namespace std;
+
+namespace {
+
+toml::Value writeAndParse(const toml::Value& v)
+{
+    stringstream ss;
+    v.write(&ss);
+    toml::ParseResult result = toml::parse(ss);
+    CHECK(result.valid()) << result.errorReason;
+    return result.value;
+}
+
+}
+
+TEST(TuningProtocolTest, endlessTask)
+{
+    EndlessTask task;
+    task.offset = 100;
+    task.size = 50;
+    task.paramMap.mutableMoveParamSet()->setDefault(CONNECTION_2, 10.0);
+    task.paramMap.mutableMainRensaParamSet()->setDefault(SCORE, 3.0);
+    task.paramMap.mutableSideRensaParamSet()->setDefault(SCORE, 1.0);
+
+    toml::Value v = writeAndParse(task.toTomlValue());
+    EXPECT_EQ("endless", tuningMessageType(v));
+
+    EndlessTask loaded;
+    ASSERT_TRUE(loaded.loadValue(v));
+    EXPECT_EQ(100, loaded.offset);
+    EXPECT_EQ(50, loaded.size);
+    EXPECT_EQ(task.paramMap.toString(), loaded.paramMap.toString());
+}
+
+TEST(TuningProtocolTest, runResult)
+{
+    RunResult result;
+    result.add(3, EndlessResult { 20, 80000, 14, false, {}, EndlessResult::Type::MAIN_CHAIN });
+    result.add(4, EndlessResult { 30, 2000, 4, false, {}, EndlessResult::Type::PUYOSEQ_RUNOUT });
+    result.add(5, EndlessResult { 3, 2100, 2, true, {}, EndlessResult::Type::ZENKESHI });
+
+    toml::Value v = writeAndParse(runResultToTomlValue(result));
+    EXPECT_EQ("result", tuningMessageType(v));
+
+    RunResult loaded;
+    ASSERT_TRUE(loadRunResult(v, &loaded));
+    EXPECT_EQ(result.toString(), loaded.toString());
+    EXPECT_EQ(result.scores, loaded.scores);
+    EXPECT_EQ(result.resultScore(), loaded.resultScore());
+
+    EndlessTask task;
+    EXPECT_FALSE(task.loadValue(v));
+}
@@ -0,0 +1,128 @@
+#if !defined(_MSC_VER)
+#include <signal.h>
+#endif
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include <glog/logging.h>
+
+#include "base/executor.h"
+#include "base/strings.h"
+#include "net/socket/socket_factory.h"
+#include "solver/endless_batch.h"
+
+#include "mayah_ai.h"
+#include "tuning_protocol.h"
+
+DEFINE_string(coordinator, "unix:/tmp/puyoai_tuning.sock",
+              "the address of tuning_coordinator. unix:<path> or tcp:<host>:<port>");
+
+using namespace std;
+
+namespace {
+
+unique_ptr<AI> makeWorkerAI()
+{
+    auto ai = new DebuggableMayahAI;
+    ai->setUsesRensaHandTree(false);
+    return unique_ptr<AI>(ai);
+}
+
+net::Socket connectToCoordinator(const string& address)
+{
+    if (strings::hasPrefix(address, "unix:")) {
+        net::UnixDomainClientSocket socket(net::SocketFactory::instance()->makeUnixDomainClientSocket());
+        string path = address.substr(5);
+        CHECK(socket.connect(path.c_str())) << "cannot connect to " << address;
+        return std::move(socket);
+    }
+
+    if (strings::hasPrefix(address, "tcp:")) {
+        vector<string> parts = strings::split(address.substr(4), ':');
+        CHECK_EQ(parts.size(), 2U) << "tcp:<hostname>:<port> is expected, but " << address;
+        CHECK(strings::isAllDigits(parts[1])) << "tcp:<hostname>:<port> is expected, but " << address;
+
+        net::TCPClientSocket socket(net::SocketFactory::instance()->makeTCPClientSocket());
+        CHECK(socket.setTCPNodelay());
+        CHECK(socket.connect(parts[0].c_str(), atoi(parts[1].c_str()))) << "cannot connect to " << address;
+        return std::move(socket);
+    }
+
+    CHECK(false) << "Unknown coordinator address: " << address;
+}
+
+#if !defined(_MSC_VER)
+void ignoreSIGPIPE()
+{
+    struct sigaction act;
+    memset(&act, 0, sizeof(act));
+
+    act.sa_handler = SIG_IGN;
+    sigemptyset(&act.sa_mask);
+
+    CHECK(sigaction(SIGPIPE, &act, 0) == 0);
+}
+#endif
+
+} // anonymous namespace
+
+// tuning_worker runs endless tasks sent from tuning_coordinator.
+// Run as many workers as machines (each uses all the cores with EndlessBatch).
+// When the connection is lost (e.g. the coordinator dropped this worker because
+// it missed the deadline), the worker connects again.
+int main(int argc, char* argv[])
+{
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    google::InitGoogleLogging(argv[0]);
+#if !defined(_MSC_VER)
+    google::InstallFailureSignalHandler();
+#endif
+
+#if !defined(_MSC_VER)
+    // A lost connection should be reconnected instead of killing the worker.
+    ignoreSIGPIPE();
+#endif
+
+    net::Socket socket = connectToCoordinator(FLAGS_coordinator);
+    LOG(INFO) << "connected to " << FLAGS_coordinator;
+
+    unique_ptr<Executor> executor = Executor::makeDefaultExecutor();
+    EndlessBatch batch(executor.get(), makeWorkerAI);
+
+    while (true) {
+        toml::Value message;
+        if (!readTuningMessage(&socket, &message)) {
+            LOG(ERROR) << "connection to the coordinator is lost. reconnecting.";
+            socket = connectToCoordinator(FLAGS_coordinator);
+            continue;
+        }
+
+        string type = tuningMessageType(message);
+        if (type == "quit")
+            break;
+
+        EndlessTask task;
+        CHECK(task.loadValue(message)) << "unexpected message: " << type;
+
+        auto preparer = [&task](AI* ai) {
+            static_cast<DebuggableMayahAI*>(ai)->setEvaluationParameterMap(task.paramMap);
+        };
+        RunResult result = batch.run(task.offset, task.size, preparer);
+        LOG(INFO) << "seeds [" << task.offset << ", " << (task.offset + task.size) << "): "
+                  << "score = " << result.resultScore();
+
+        if (!writeTuningMessage(&socket, runResultToTomlValue(result))) {
+            LOG(ERROR) << "connection to the coordinator is lost. reconnecting.";
+            socket = connectToCoordinator(FLAGS_coordinator);
+        }
+    }
+
+    executor->stop();
+    return 0;
+}
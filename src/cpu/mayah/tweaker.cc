@@ -4,8 +4,6 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
-#include <future>
-#include <sstream>
 #include <random>
 
 #include <gflags/gflags.h>
@@ -15,6 +13,7 @@
 #include "core/kumipuyo_seq_generator.h"
 #include "core/probability/puyo_set_probability.h"
 #include "solver/endless.h"
+#include "solver/endless_batch.h"
 #include "solver/puyop.h"
 
 #include "evaluation_parameter.h"
@@ -33,27 +32,6 @@ DEFINE_int32(offset, 0, "offset for random seed");
 
 using namespace std;
 
-struct Result {
-    EndlessResult result;
-    string msg;
-};
-
-struct RunResult {
-    int numZenkeshi;
-    int sumScore;
-    int mainRensaCount;
-    int aveMainRensaScore;
-    int over40000Count;
-    int over60000Count;
-    int over70000Count;
-    int over80000Count;
-    int over100000Count;
-
-    int resultScore() {
-        return mainRensaCount * 20 + over60000Count * 6 + over70000Count + over80000Count;
-    }
-};
-
 #if 0
 class ParameterTweaker {
 public:
@@ -148,114 +126,37 @@ void runOnce(const EvaluationParameterMap& paramMap)
     cout << endl;
 }
 
-RunResult run(Executor* executor, const EvaluationParameterMap& paramMap)
+unique_ptr<AI> makeTweakerAI()
 {
-    const int N = FLAGS_size;
-    vector<promise<Result>> ps(N);
-
-    for (int i = 0; i < N; ++i) {
-        auto f = [i, &paramMap, &ps]() {
-            auto ai = new DebuggableMayahAI;
-            ai->setUsesRensaHandTree(false);
-            ai->setEvaluationParameterMap(paramMap);
-
-            std::unique_ptr<AI> ai_ptr(ai);
-            Endless endless(std::move(ai_ptr));
-
-            stringstream ss;
-            KumipuyoSeq seq = KumipuyoSeqGenerator::generateACPuyo2SequenceWithSeed(i + FLAGS_offset);
-            EndlessResult result = endless.run(seq);
-            ss << "case " << setw(2) << i << ": "
-               << "score=" << setw(6) << result.score << " rensa=" << setw(2) << result.maxRensa;
-            if (result.zenkeshi)
-                ss << " / ZENKESHI";
-            ss << endl;
-
-            ps[i].set_value(Result{result, ss.str()});
-        };
-        executor->submit(f);
-    }
-
-    int numZenkeshi = 0;
-    int sumScore = 0;
-    int sumMainRensaScore = 0;
-    int mainRensaCount = 0;
-    int over40000Count = 0;
-    int over60000Count = 0;
-    int over70000Count = 0;
-    int over80000Count = 0;
-    int over100000Count = 0;
-    int overRensa13Count = 0;
-    int overRensa14Count = 0;
-    int overRensa15Count = 0;
-
-    vector<pair<int, int>> scores;
-    for (int i = 0; i < N; ++i) {
-        Result r = ps[i].get_future().get();
-        cout << r.msg;
-        if (r.result.zenkeshi && r.result.hand < 8) {
-            numZenkeshi++;
-            continue;
-        }
-        int score = r.result.score;
-        sumScore += score;
-        scores.push_back(make_pair(score, i + FLAGS_offset));
-        if (score >= 10000) {
-            mainRensaCount++;
-            sumMainRensaScore += score;
-        }
-        if (score >= 40000) { over40000Count++; }
-        if (score >= 60000) { over60000Count++; }
-        if (score >= 70000) { over70000Count++; }
-        if (score >= 80000) { over80000Count++; }
-        if (score >= 100000) { over100000Count++; }
-        if (r.result.maxRensa >= 13) { overRensa13Count++; }
-        if (r.result.maxRensa >= 14) { overRensa14Count++; }
-        if (r.result.maxRensa >= 15) { overRensa15Count++; }
-    }
-
-    sort(scores.begin(), scores.end());
-
-    double mean = static_cast<double>(sumScore) / scores.size();
-    double variance = 0.0;
-    for (size_t i = 0; i < scores.size(); ++i) {
-        variance += (scores[i].first - mean) * (scores[i].first - mean);
-    }
-    double deviation = scores.size() >= 2 ? sqrt(variance / (scores.size() - 1)) : 0;
-
-    int aveMainRensaScore = mainRensaCount > 0 ? sumMainRensaScore / mainRensaCount : 0;
-    cout << "zenkeshi   = " << numZenkeshi << endl;
-    cout << "sum score  = " << sumScore << endl;
-    cout << "ave score  = " << (sumScore / scores.size()) << endl;
-    cout << "median     = " << scores[scores.size() / 2].first << endl;
-    cout << "deviation  = " << deviation << endl;
-    cout << "main rensa = " << mainRensaCount << endl;
-    cout << "main rensa % = " << (100.0 * mainRensaCount / scores.size()) << endl;
-    cout << "ave main rensa = " << aveMainRensaScore << endl;
-    cout << "over  40000 = " << over40000Count << endl;
-    cout << "over  60000 = " << over60000Count << endl;
-    cout << "over  70000 = " << over70000Count << endl;
-    cout << "over  80000 = " << over80000Count << endl;
-    cout << "over 100000 = " << over100000Count << endl;
-    cout << "over 13 chn = " << overRensa13Count << endl;
-    cout << "over 14 chn = " << overRensa14Count << endl;
-    cout << "over 15 chn = " << overRensa15Count << endl;
-    if (scores.size() >= 10) {
-        for (int i = 0; i < 5; ++i) {
-            cout << "  seed " << scores[i].second << " -> " << scores[i].first << endl;
-        }
-    }
+    auto ai = new DebuggableMayahAI;
+    ai->setUsesRensaHandTree(false);
+    return unique_ptr<AI>(ai);
+}
 
-    return RunResult { numZenkeshi, sumScore, mainRensaCount, aveMainRensaScore,
-            over40000Count, over60000Count, over70000Count, over80000Count, over100000Count };
+RunResult run(EndlessBatch* batch, const EvaluationParameterMap& paramMap)
+{
+    auto preparer = [&paramMap](AI* ai) {
+        static_cast<DebuggableMayahAI*>(ai)->setEvaluationParameterMap(paramMap);
+    };
+    auto callback = [](int seed, const EndlessResult& result) {
+        cout << "case " << setw(4) << (seed - FLAGS_offset) << ": "
+             << "score=" << setw(6) << result.score << " rensa=" << setw(2) << result.maxRensa;
+        if (result.zenkeshi)
+            cout << " / ZENKESHI";
+        cout << endl;
+    };
+
+    RunResult result = batch->run(FLAGS_offset, FLAGS_size, preparer, callback);
+    cout << result.toString();
+    return result;
 }
 
 #if 0
-void runAutoTweaker(Executor* executor, const EvaluationParameterMap& original, int num)
+void runAutoTweaker(EndlessBatch* batch, const EvaluationParameterMap& original, int num)
 {
     cout << "Run with the original parameter." << endl;
     EvaluationParameterMap currentBestParameter(original);
-    RunResult currentBestResult = run(executor, original);
+    RunResult currentBestResult = run(batch, original);
 
     cout << "original score = " << currentBestResult.resultScore() << endl;
 
@@ -265,7 +166,7 @@ void runAutoTweaker(Executor* executor, const EvaluationParameterMap& original,
         EvaluationParameterMap parameter(currentBestParameter);
         tweaker.tweakParameter(&parameter);
 
-        RunResult result = run(executor, parameter);
+        RunResult result = run(batch, parameter);
         cout << "score = " << result.resultScore() << endl;
 
         if (currentBestResult.resultScore() < result.resultScore()) {
@@ -299,13 +200,15 @@ int main(int argc, char* argv[])
     }
     paramMap.removeNontokopuyoParameter();
 
+    EndlessBatch batch(executor.get(), makeTweakerAI);
+
     if (!FLAGS_seq.empty() || FLAGS_seed >= 0) {
         runOnce(paramMap);
     } else if (FLAGS_once) {
-        run(executor.get(), paramMap);
+        run(&batch, paramMap);
 #if 0
     } else if (FLAGS_auto_count > 0) {
-        runAutoTweaker(executor.get(), paramMap, FLAGS_auto_count);
+        runAutoTweaker(&batch, paramMap, FLAGS_auto_count);
 #endif
     } else {
         typedef tuple<double, double> ScoreMapKey;
@@ -325,7 +228,7 @@ int main(int argc, char* argv[])
               paramMap.mutableMainRensaParamSet()->setParam(EvaluationMode::MIDDLE, HIGHER_PUYO_THAN_IGNITION_SQUARE, -y);
               paramMap.mutableMainRensaParamSet()->setParam(EvaluationMode::LATE, HIGHER_PUYO_THAN_IGNITION_SQUARE, -y);
 
-              scoreMap[ScoreMapKey(x, y)] = run(executor.get(), paramMap);
+              scoreMap[ScoreMapKey(x, y)] = run(&batch, paramMap);
             }
         }
 
@@ -333,7 +236,7 @@ int main(int argc, char* argv[])
             cout << setw(5) << get<0>(m.first) << ' ' << get<1>(m.first)
                  << " -> " << m.second.sumScore
                  << " / " << m.second.mainRensaCount
-                 << " / " << m.second.aveMainRensaScore
+                 << " / " << m.second.aveMainRensaScore()
                  << " / " << m.second.over40000Count
                  << " / " << m.second.over60000Count
                  << " / " << m.second.over70000Count
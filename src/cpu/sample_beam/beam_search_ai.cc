@@ -10,9 +10,11 @@
 #include <glog/logging.h>
 
 #include "base/base.h"
+#include "base/executor.h"
 #include "base/time.h"
 #include "core/plan/plan.h"
 #include "core/rensa/rensa_detector.h"
+#include "core/search/beam_search.h"
 #include "core/core_field.h"
 #include "core/kumipuyo_seq_generator.h"
 
@@ -29,11 +31,18 @@ DEFINE_int32(beam_width, 400, "Size of recorded states in beam search");
 
 DEFINE_string(type, "2dub", "Type of AI. Choose \"2dub\" or \"full\".");
 
+DECLARE_int32(num_threads);
+
 namespace sample {
 
 struct SearchState {
+  size_t hash() const { return field.hash(); }
+  Decision firstDecision() const { return decision; }
+
   CoreField field;
   Decision decision;
+  // The index of this state in its turn, and the index of the previous state.
+  int index;
   int from;
   std::array<int, 3> features;
   // Fill: [0: # of ojama, 1: expected score, 2: -frames]
@@ -204,6 +213,37 @@ DropDecision BeamSearchAI::think(
   return DropDecision(best, oss.str());
 }
 
+// Evaluator adapts BeamSearchAI to BeamSearch.
+class BeamSearchAI::Evaluator {
+ public:
+  Evaluator(const BeamSearchAI* ai, const KumipuyoSeq& vseq) : ai_(ai), vseq_(vseq) {}
+
+  void expand(const SearchState& state, int depth, BeamSearchVisitor* visitor,
+              std::vector<SearchState>* children) const {
+    ai_->generateNextStates(state, vseq_.get(depth), visitor, children);
+  }
+
+  // Fill: [0: # of ojama, 1: expected score, 2: -frames]
+  // 2Dub: [0: # of 2dub, 1: # of ojama, 2: expected score]
+  const std::array<int, 3>& evaluate(const SearchState& state) const { return state.features; }
+
+ private:
+  const BeamSearchAI* ai_;
+  const KumipuyoSeq& vseq_;
+};
+
+BeamSearchAI::BeamSearchAI(const std::string& name) : AI(name) {
+  if (FLAGS_num_threads > 1) {
+    executor_.reset(new Executor(FLAGS_num_threads));
+    executor_->start();
+  }
+}
+
+BeamSearchAI::~BeamSearchAI() {
+  if (executor_)
+    executor_->stop();
+}
+
 SearchState BeamSearchAI::search(
     const CoreField& field, const KumipuyoSeq& vseq, int search_turns) const {
   CHECK_GE(vseq.size(), search_turns);
@@ -213,34 +253,30 @@ SearchState BeamSearchAI::search(
   SearchState init_state;
   init_state.field = field;
   init_state.decision = Decision(0, 0);
+  init_state.index = 0;
+  init_state.from = 0;
   init_state.features[0] = 0;
   init_state.features[1] = 0;
   init_state.features[2] = std::numeric_limits<int>::min();
 
+  Evaluator evaluator(this, vseq);
+  BeamSearchOptions options;
+  options.beamWidth = FLAGS_beam_width;
+  options.executor = executor_.get();
+  options.numTasks = FLAGS_num_threads;
+  BeamSearch<SearchState, Evaluator> beam(&evaluator, options);
+
   q_states[0].push_back(init_state);
   for (int t = 0; t < search_turns; ++t) {
-    std::unordered_set<uint64> visited;
-    const auto& que = q_states[t];
-    std::vector<SearchState>& next_states = q_states[t + 1];
-    for (size_t i = 0; i < que.size(); ++i)
-      generateNextStates(que[i], i, vseq.get(t), visited, next_states);
-
+    std::vector<SearchState> next_states = beam.step(q_states[t], t);
     if (next_states.empty())
       break;
-    std::sort(next_states.begin(), next_states.end(),
-              [](const SearchState& a, const SearchState& b) {
-                if (a.features[0] == b.features[0]) {
-                  if (a.features[1] == b.features[1])
-                    return a.features[2] > b.features[2];
-                  return a.features[1] > b.features[1];
-                }
-                return a.features[0] > b.features[0];
-              });
-    if (static_cast<int>(next_states.size()) >= FLAGS_beam_width)
-      next_states.erase(next_states.begin() + FLAGS_beam_width, next_states.end());
-
-    const SearchState best = *next_states.begin();
-    if (std::all_of(next_states.begin(), next_states.end(),
+    for (size_t i = 0; i < next_states.size(); ++i)
+      next_states[i].index = i;
+    q_states[t + 1] = std::move(next_states);
+
+    const SearchState& best = q_states[t + 1].front();
+    if (std::all_of(q_states[t + 1].begin(), q_states[t + 1].end(),
         [&best](const SearchState& s){ return s.decision == best.decision; })) {
       search_turns = t + 1;
       break;
@@ -277,21 +313,24 @@ SearchState BeamSearchAI::search(
   for (int r : ranks)
     oss << " " << r;
   std::cerr << "[" << ranks.size() << "]" << oss.str() << "\n";
+  for (const auto& stats : beam.stats())
+    std::cerr << stats.toString() << "\n";
 #endif
 
   return result;
 }
 
+// Duplicated fields in the same turn are skipped before detecting rensas on them.
 void BeamSearchAI::generateNextStates(
-    const SearchState& state, int from, const Kumipuyo& kumi,
-    std::unordered_set<uint64>& visited, std::vector<SearchState>& states) const {
+    const SearchState& state, const Kumipuyo& kumi, BeamSearchVisitor* visitor,
+    std::vector<SearchState>* states) const {
   const BeamSearchAI* th = this;
-  auto callback = [&th, &state, &from, &visited, &states](const RefPlan& plan) {
+  const int from = state.index;
+  auto callback = [&th, &state, &from, visitor, states](const RefPlan& plan) {
     const CoreField field = plan.field();
     RensaResult result = plan.rensaResult();
 
-    uint64 h = field.hash();
-    if (!visited.insert(h).second)
+    if (!visitor->visit(field.hash()))
       return;
 
     if (plan.isRensaPlan()) {
@@ -299,7 +338,7 @@ void BeamSearchAI::generateNextStates(
         return;
 
       SearchState next = th->generateNextRensaState(field, from, state, plan);
-      states.push_back(next);
+      states->push_back(next);
 
       return;
     }
@@ -316,7 +355,7 @@ void BeamSearchAI::generateNextStates(
                                         detect_callback);
 
     SearchState next = th->generateNextNonRensaState(field, from, state, plan, expect);
-    states.push_back(next);
+    states->push_back(next);
   };
 
   Plan::iterateAvailablePlans(state.field, {kumi}, 1, callback);
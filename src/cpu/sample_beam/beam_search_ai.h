@@ -4,11 +4,14 @@
 // BeamSearchAI is a skelton AI to implement AIs using beam search algorithm.
 // This file also creates 2 different type AIs ineriting from BeamSearchAI.
 
+#include <memory>
 #include <string>
-#include <unordered_set>
+#include <vector>
 
 #include "core/client/ai/ai.h"
 
+class BeamSearchVisitor;
+class Executor;
 struct RensaResult;
 class RefPlan;
 
@@ -23,24 +26,28 @@ class BeamSearchAI : public AI {
   using uint64 = std::uint64_t;
   using int64 = std::int64_t;
  public:
-  BeamSearchAI(const std::string& name) : AI(name) {}
-  virtual ~BeamSearchAI() {}
+  BeamSearchAI(const std::string& name);
+  virtual ~BeamSearchAI();
 
   virtual DropDecision think(int frame_id, const CoreField& field, const KumipuyoSeq& seq,
                              const PlayerState&, const PlayerState&, bool fast) const;
 
  private:
+  class Evaluator;
+
   SearchState search(const CoreField& field, const KumipuyoSeq& vseq, int search_turns) const;
 
-  void generateNextStates(const SearchState& state, int from, const Kumipuyo& kumi,
-                          std::unordered_set<uint64>& visited,
-                          std::vector<SearchState>& states) const;
+  void generateNextStates(const SearchState& state, const Kumipuyo& kumi, BeamSearchVisitor* visitor,
+                          std::vector<SearchState>* states) const;
 
   // pure virtual methods to change the behavior.
   virtual bool skipRensaPlan(const RensaResult& result) const = 0;
   virtual SearchState generateNextRensaState(const CoreField& field, int from, const SearchState& state, const RefPlan& plan) const = 0;
   virtual SearchState generateNextNonRensaState(const CoreField& field, int from, const SearchState& state, const RefPlan& plan, int expect) const = 0;
   virtual bool shouldUpdateState(const SearchState& orig, const SearchState& res) const = 0;
+
+  // Used to expand states in parallel. nullptr if --num_threads is 1.
+  std::unique_ptr<Executor> executor_;
 };
 
 // Type specified AIs ------------------------------------------------
@@ -12,6 +12,7 @@
 #include <glog/logging.h>
 
 #include "base/base.h"
+#include "core/bit_field.h"
 #include "core/puyo_color.h"
 
 #include "field.h"
@@ -934,27 +935,13 @@ int COMAI_HI::hyouka(const PuyoColor ba3[6][kHeight], PuyoColor tsumo[], int zen
                 }
             }
 
-            int num = 0;
-            Check point[6][12] {};
-            for (int i = 0; i < 6; i++) {
-                for (int j = 0; j < 12; j++) {
-                    if (ba[i][j] == PuyoColor::EMPTY)
-                        break;
-                    if (point[i][j] != Check::Checked && isNormalColor(ba[i][j])) {
-                        saiki(ba, point, i, j, &num, ba[i][j]);
-                        if (num != 0) {
-                            if (num == 2)
-                                hym[aa] += 30 * config.renketu_bairitu;
-                            if (num == 3)
-                                hym[aa] += 120 * config.renketu_bairitu;
-                            if ((zenkesi_aite == 1) && (num == 2))
-                                hym[aa] += 120;
-                            if ((zenkesi_aite == 1) && (num == 3))
-                                hym[aa] += 480;
-                            num = 0;
-                        }
-                    }
-                }
+            int numGroups[kMaxConnection + 1];
+            countConnectedGroups(ba, numGroups);
+            hym[aa] += numGroups[2] * 30 * config.renketu_bairitu;
+            hym[aa] += numGroups[3] * 120 * config.renketu_bairitu;
+            if (zenkesi_aite == 1) {
+                hym[aa] += numGroups[2] * 120;
+                hym[aa] += numGroups[3] * 480;
             }
         }
     }
@@ -1201,8 +1188,6 @@ int COMAI_HI::pre_hyouka(const PuyoColor ba3[6][kHeight], PuyoColor tsumo[], int
     if (zenchain > 2100)
         zenke[zenchk] += 120000;
 
-    int num = 0;
-
     for (int aa = 0; aa < 22; aa++) {
         if (tobashi_hantei_a(ba2, aa, nx1, nx2))
             continue;
@@ -1311,8 +1296,6 @@ int COMAI_HI::pre_hyouka(const PuyoColor ba3[6][kHeight], PuyoColor tsumo[], int
         kuraichk = 1;
     }
 
-    num = 0;
-
     if (config.a_t == 0)
         wariko_taiou = taiouchk;
 
@@ -1635,6 +1618,7 @@ int COMAI_HI::pre_hyouka(const PuyoColor ba3[6][kHeight], PuyoColor tsumo[], int
                     Check point2[6][12];
                     std::fill_n(&point2[0][0], 6 * 12, Check::Unknown);
                     UpdateAccessibility(ba, point2);
+                    const BitField bf = toBitField(ba);
 
                     PuyoColor bass[6][kHeight] {};
                     int num2 = 3;
@@ -1651,11 +1635,10 @@ int COMAI_HI::pre_hyouka(const PuyoColor ba3[6][kHeight], PuyoColor tsumo[], int
                                 continue;
                             if ((num2 > 2))
                                 copyField(ba, bass);
-                            int num2 = 0;
                             int poi2s = 0;
                             int chain = 0;
                             Check tokus = point2[i2][j2];
-                            saiki(bass, point2, i2, j2, &num2, bass[i2][j2]);
+                            int num2 = markConnectedPuyos(bf, point2, i2, j2);
                             if (num2 >= 3) {
                                 poi2s = j2 * config.takasa_point;
                                 if (j2 > 5)
@@ -1680,19 +1663,10 @@ int COMAI_HI::pre_hyouka(const PuyoColor ba3[6][kHeight], PuyoColor tsumo[], int
                             int pois = 0;
                             if (m_cchai <= chain) {
                                 m_cchai = chain;
-                                Check point[6][12] {};
-                                num = 0;
-                                for (int i = 0; i < 6; i++) {
-                                    for (int j = 0; j < 12; j++) {
-                                        if (bass[i][j] == PuyoColor::EMPTY)
-                                            break;
-                                        if (point[i][j] != Check::Checked && isNormalColor(bass[i][j])) {
-                                            saiki(bass, point, i, j, &num, bass[i][j]);
-                                            pois = pois + num * num * num;
-                                            num = 0;
-                                        }
-                                    }
-                                }
+                                int numGroups[kMaxConnection + 1];
+                                countConnectedGroups(bass, numGroups);
+                                for (int n = 1; n <= kMaxConnection; n++)
+                                    pois = pois + numGroups[n] * n * n * n;
                             }
 
                             static const int yokotate = 4;
@@ -0,0 +1,106 @@
+#include "coma.h"
+
+#include <cstdint>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "core/puyo_color.h"
+#include "cpu_configuration.h"
+#include "field.h"
+#include "lockit_constant.h"
+#include "rensa_result.h"
+
+namespace test_lockit {
+
+namespace {
+
+cpu::Configuration makeConfiguration(int ruisekiPoint, int renketuBairitu)
+{
+    cpu::Configuration config;
+    config.q_t = 1;
+    config.w_t = 1;
+    config.e_t = 0;
+    config.r_t = 1;
+    config.t_t = 1;
+    config.y_t = 2;
+    config.u_t = 1;
+    config.i_t = 0;
+    config.o_t = 1;
+    config.p_t = 2;
+    config.a_t = 1;
+
+    config.takasa_point = 240;
+    config.ruiseki_point = ruisekiPoint;
+    config.renketu_bairitu = renketuBairitu;
+    config.is_2dub_cpu = false;
+    config.uses_2x_hyouka = false;
+
+    return config;
+}
+
+std::uint64_t mix(std::uint64_t digest, int value)
+{
+    return (digest ^ static_cast<std::uint32_t>(value)) * 1099511628211ULL;
+}
+
+// Lets COMAI_HI play against random moves, and returns the digest of all the evaluations
+// aite_hyouka(), pre_hyouka() and hyouka() made.
+std::uint64_t playAndDigest(const cpu::Configuration& config, unsigned int seed, int numTurns)
+{
+    // The distributions of <random> are implementation-defined, so the raw output of mt19937 is used.
+    std::mt19937 mt(seed);
+
+    COMAI_HI coma(config);
+    PuyoColor field[6][kHeight] {};
+    PuyoColor enemyField[6][kHeight] {};
+    std::uint64_t digest = 14695981039346656037ULL;
+
+    for (int turn = 0; turn < numTurns; ++turn) {
+        PuyoColor tsumo[6];
+        PuyoColor enemyTsumo[6];
+        for (int i = 0; i < 6; ++i) {
+            tsumo[i] = NORMAL_PUYO_COLORS[mt() % 4];
+            enemyTsumo[i] = NORMAL_PUYO_COLORS[mt() % 4];
+        }
+
+        int settiBasyo[4];
+        bool enemyAlive = setti_puyo(enemyField, mt() % 22, enemyTsumo[0], enemyTsumo[1], settiBasyo);
+        if (coma.aite_attack_start(enemyField, 0, coma.m_aite_hakkaji_score, turn))
+            simulate(enemyField);
+        coma.aite_rensa_end();
+        coma.aite_hyouka(enemyField, enemyTsumo + 2);
+
+        coma.pre_hyouka(field, tsumo, 0, enemyField, 0, 1);
+        coma.hyouka(field, tsumo, 0, enemyField, 0);
+
+        int decision = 0;
+        for (int aa = 0; aa < 22; ++aa) {
+            digest = mix(digest, coma.m_para[aa]);
+            if (coma.m_para[decision] < coma.m_para[aa])
+                decision = aa;
+        }
+
+        bool alive = setti_puyo(field, decision, tsumo[0], tsumo[1], settiBasyo);
+        digest = mix(digest, simulate(field).score);
+        if (!alive || !enemyAlive || field[2][11] != PuyoColor::EMPTY || enemyField[2][11] != PuyoColor::EMPTY) {
+            std::fill_n(&field[0][0], 6 * kHeight, PuyoColor::EMPTY);
+            std::fill_n(&enemyField[0][0], 6 * kHeight, PuyoColor::EMPTY);
+            coma.ref();
+        }
+    }
+
+    return digest;
+}
+
+}  // namespace
+
+// The digests were recorded with the original recursive flood fills. Ports of the primitives
+// must keep COMAI_HI's decisions, so they must not change the digests.
+TEST(ComaTest, evaluationsAreUnchanged)
+{
+    EXPECT_EQ(18091174879415205185ULL, playAndDigest(makeConfiguration(6, 1), 1, 120));
+    EXPECT_EQ(12041908284305920743ULL, playAndDigest(makeConfiguration(0, 4), 2, 120));
+}
+
+}  // namespace test_lockit
@@ -1,10 +1,17 @@
 #include "field.h"
 
+#include <smmintrin.h>
+
+#include <algorithm>
+
 #include <glog/logging.h>
 
-#include "base/small_int_set.h"
+#include "core/bit_field.h"
+#include "core/bit_field_inl.h"
+#include "core/field_bits.h"
 #include "core/puyo_color.h"
 #include "core/field_constant.h"
+#include "core/rensa_result.h"
 #include "core/score.h"
 #include "rensa_result.h"
 
@@ -186,6 +193,72 @@ void syou_down_num(PuyoColor ba[][kHeight], int x, int y, PuyoColor incol, int f
         ba[x][y - 1] = PuyoColor::EMPTY;
 }
 
+// Drops the puyos in the 13 rows of the columns marked in |rakkaflg|. |kiept[i]| will be the
+// lowest empty row of the column i before the drop, or 12 if the column isn't marked.
+// Returns the number of the empty cells in the marked columns.
+int dropMarkedColumns(PuyoColor ba[][kHeight], const int rakkaflg[6], int kiept[6])
+{
+    int rakka = 0;
+    for (int i = 0; i < 6; i++) {
+        kiept[i] = 12;
+        if (rakkaflg[i] != 1)
+            continue;
+        int n = 0;
+        for (int j = 0; j < 13; j++) {
+            if (ba[i][j] == PuyoColor::EMPTY) {
+                if (n == 0)
+                    kiept[i] = j;
+                n++;
+            } else if (n != 0) {
+                ba[i][j - n] = ba[i][j];
+                ba[i][j] = PuyoColor::EMPTY;
+            }
+        }
+        rakka += n;
+    }
+    return rakka;
+}
+
+// TLRensaTracker tracks the values in TLRensaResult which BitField doesn't compute.
+class TLRensaTracker {
+public:
+    // |field| should be the field being simulated.
+    explicit TLRensaTracker(const BitField& field) : field_(field) {}
+
+    int numVanished() const { return numVanished_; }
+    // |nth| is 0-origin.
+    int numConnections(int nth) const { return numConnections_[nth]; }
+
+    void trackCoef(int /*nthChain*/, int numErasedPuyo, int /*longBonusCoef*/, int /*colorBonusCoef*/)
+    {
+        numVanished_ += numErasedPuyo;
+    }
+
+    void trackVanish(int nthChain, const FieldBits& vanishedPuyoBits, const FieldBits& /*vanishedOjamaPuyoBits*/)
+    {
+        // |field_| has not been updated yet, so we can count the vanishing groups here.
+        int n = 0;
+        for (PuyoColor c : NORMAL_PUYO_COLORS) {
+            FieldBits bits = field_.bits(c) & vanishedPuyoBits;
+            bits.iterateBitWithMasking([&](FieldBits x) -> FieldBits {
+                ++n;
+                return x.expand(bits);
+            });
+        }
+        numConnections_[nthChain - 1] = n;
+    }
+
+    void trackDrop(FieldBits /*blender*/, FieldBits /*leftOnes*/, FieldBits /*rightOnes*/) {}
+#ifdef __BMI2__
+    void trackDropBMI2(std::uint64_t /*oldLowBits*/, std::uint64_t /*oldHighBits*/, std::uint64_t /*newLowBits*/, std::uint64_t /*newHighBits*/) {}
+#endif
+
+private:
+    const BitField& field_;
+    int numVanished_ = 0;
+    int numConnections_[TLRensaResult::MAX_RENSA] {};
+};
+
 } // namespace
 
 bool isTLFieldEmpty(const PuyoColor field[6][kHeight])
@@ -220,96 +293,98 @@ void copyField(const PuyoColor src[][kHeight], PuyoColor dst[][kHeight])
     }
 }
 
+BitField toBitField(const PuyoColor field[][kHeight])
+{
+    // Lays out the columns as PlainField does, so that a column is compared with a color at once.
+    alignas(16) PuyoColor columns[6][16] {};
+    for (int i = 0; i < 6; ++i)
+        std::copy(field[i], field[i] + kHeight, columns[i] + 1);
+
+    __m128i m[6];
+    for (int i = 0; i < 6; ++i)
+        m[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(columns[i]));
+
+    BitField bf;
+    for (PuyoColor c : { PuyoColor::OJAMA, PuyoColor::IRON, PuyoColor::RED, PuyoColor::BLUE, PuyoColor::YELLOW, PuyoColor::GREEN }) {
+        const __m128i mask = _mm_set1_epi8(static_cast<char>(c));
+        __m128i bits = _mm_set_epi16(0,
+                                     _mm_movemask_epi8(_mm_cmpeq_epi8(m[5], mask)),
+                                     _mm_movemask_epi8(_mm_cmpeq_epi8(m[4], mask)),
+                                     _mm_movemask_epi8(_mm_cmpeq_epi8(m[3], mask)),
+                                     _mm_movemask_epi8(_mm_cmpeq_epi8(m[2], mask)),
+                                     _mm_movemask_epi8(_mm_cmpeq_epi8(m[1], mask)),
+                                     _mm_movemask_epi8(_mm_cmpeq_epi8(m[0], mask)),
+                                     0);
+        if (!_mm_testz_si128(bits, bits))
+            bf.setColorAll(FieldBits(bits), c);
+    }
+
+    return bf;
+}
+
 TLRensaResult simulate(PuyoColor field[][kHeight])
 {
     // Assume all puyos are grounded.
     // TODO: add DCHECK to check it.
 
-    // parameters necessary to compute score
-    int chain = 0;
-    int long_bonus[TLRensaResult::MAX_RENSA] {};
-    int num_colors[TLRensaResult::MAX_RENSA] {};
-    int num_connected[TLRensaResult::MAX_RENSA] {};   // # of connected puyos
-    int num_connections[TLRensaResult::MAX_RENSA] {};  // # of groups
-    bool quick = false;
-
-    int bottom[6] {};
-    bool cont = true;
-    while (cont) {
-        cont = false;
-        Check point[6][12] {};
-        int rakkaflg[6] {};
-
-        SmallIntSet used_colors;
-        // check connections and vanish
-        for (int i = 0; i < 6; ++i) {
-            for (int j = bottom[i]; j < 12; ++j) {
-                PuyoColor color = field[i][j];
-                if (color == PuyoColor::EMPTY)
-                    continue;
-                if (point[i][j] != Check::Checked && isNormalColor(color)) {
-                    int num = 0;
-                    saiki(field, point, i, j, &num, color);
-                    if (num >= 4) {
-                        cont = true;
-                        syou(field, i, j, color, rakkaflg);
-
-                        long_bonus[chain] += longBonus(num);
-                        num_connected[chain] += num;
-                        used_colors.set(ordinal(color));
-                        num_connections[chain]++;
-                    }
-                }
-            }
-        }
-        num_colors[chain] = used_colors.size();
-        if (!cont)
+    // BitField vanishes puyos in the 12 rows and drops puyos in the 13 rows,
+    // which is the same as the original recursive implementation.
+    BitField bf = toBitField(field);
+    if (!bf.rensaWillOccur())
+        return TLRensaResult();
+
+    const BitField original(bf);
+    TLRensaTracker tracker(bf);
+    BitField::SimulationContext context;
+
+    TLRensaResult result;
+    while (true) {
+        RensaStepResult step = bf.vanishDrop(&context, &tracker);
+        if (step.score == 0)
             break;
-        ++chain;
-
-        // drop puyos
-        quick = true;
-        for (int i = 0; i < 6; ++i) {
-            bottom[i] = 12;
-            if (rakkaflg[i]) {
-                int n = 0;
-                for (int j = 0; j < 13; ++j) {
-                    if (field[i][j] == PuyoColor::EMPTY) {
-                        if (n == 0)
-                            bottom[i] = j;
-                        n++;
-                    } else if (n != 0) {
-                        field[i][j - n] = field[i][j];
-                        field[i][j] = PuyoColor::EMPTY;
-                        quick = false;
-                    }
-                }
-            }
-        }
+        result.score += step.score;
+        result.quick = step.quick;
     }
 
-    int score = 0;
-    int num_vanished = 0;
-    for (int i = 0; i < chain; ++i) {
-        int chain_bonus = chainBonus(i + 1);
-        int color_bonus = colorBonus(num_colors[i]);
-        int rate = calculateRensaBonusCoef(chain_bonus, long_bonus[i], color_bonus);
-        score += num_connected[i] * rate * 10;
-        num_vanished += num_connected[i];
+    result.chains = context.currentChain - 1;
+    result.num_vanished = tracker.numVanished();
+    for (int i = 0; i < result.chains; ++i) {
+        result.num_connections[i] = tracker.numConnections(i);
     }
 
-    TLRensaResult result;
-    result.chains = chain;
-    result.score = score;
-    result.quick = quick;
-    result.num_vanished = num_vanished;
-    for (int i = 0; i < chain; ++i) {
-        result.num_connections[i] = num_connections[i];
-    }
+    // Writes back only the cells changed by the rensa.
+    original.differentBits(bf).iterateBitPositions([&](int x, int y) {
+        field[x - 1][y - 1] = bf.color(x, y);
+    });
 
     return result;
 }
 
+void countConnectedGroups(const PuyoColor field[][kHeight], int numGroups[kMaxConnection + 1])
+{
+    std::fill_n(numGroups, kMaxConnection + 1, 0);
+
+    BitField bf = toBitField(field);
+    for (PuyoColor c : NORMAL_PUYO_COLORS) {
+        FieldBits bits = bf.bits(c).maskedField12();
+        bits.iterateBitWithMasking([&](FieldBits x) -> FieldBits {
+            FieldBits connected = x.expand(bits);
+            ++numGroups[connected.popcount()];
+            return connected;
+        });
+    }
+}
+
+int markConnectedPuyos(const BitField& bf, Check point[][12], int x, int y)
+{
+    // The puyos already checked belong to other groups, so they don't stop the expansion.
+    FieldBits connected = FieldBits(x + 1, y + 1).expand(bf.bits(bf.color(x + 1, y + 1)).maskedField12());
+    connected.iterateBitPositions([&](int cx, int cy) {
+        point[cx - 1][cy - 1] = Check::Checked;
+    });
+    return connected.popcount();
+}
+
 void saiki(const PuyoColor ba[][kHeight], Check point[][12], int x, int y, int* num, PuyoColor incol)
 {
     point[x][y] = Check::Checked;
@@ -324,25 +399,6 @@ void saiki(const PuyoColor ba[][kHeight], Check point[][12], int x, int y, int*
         saiki(ba, point, x, y - 1, num, incol);
 }
 
-void saiki_4(PuyoColor ba[][kHeight], int x, int y, int* num, PuyoColor incol)
-{
-    ba[x][y] = PuyoColor::EMPTY;
-    *num += 1;
-    if (*num > 3) {
-        ba[x][y] = incol;
-        return;
-    }
-    if ((x != 0) && (incol == ba[x - 1][y]))
-        saiki_4(ba, x - 1, y, num, incol);
-    if ((y != 11) && (incol == ba[x][y + 1]))
-        saiki_4(ba, x, y + 1, num, incol);
-    if ((x != 5) && (incol == ba[x + 1][y]))
-        saiki_4(ba, x + 1, y, num, incol);
-    if ((y != 0) && (incol == ba[x][y - 1]))
-        saiki_4(ba, x, y - 1, num, incol);
-    ba[x][y] = incol;
-}
-
 void syou(PuyoColor ba[][kHeight], int x, int y, PuyoColor incol, int flg[])
 {
     ba[x][y] = PuyoColor::EMPTY;
@@ -488,25 +544,14 @@ bool setti_puyo(PuyoColor ba[][kHeight], int aa, PuyoColor nx1, PuyoColor nx2, i
 
 int setti_puyo_1(PuyoColor ba[][kHeight], int eex, PuyoColor eecol)
 {
-    int j;
-    int oita = 0;
-    int num = 0;
-    int setti_basyoy;
-    for (j = 0; j < 12; j++) {
+    for (int j = 0; j < 12; j++) {
         if (ba[eex][j] == PuyoColor::EMPTY) {
             ba[eex][j] = eecol;
-            setti_basyoy = j;
-            oita = 1;
-            break;
+            return toBitField(ba).countConnectedPuyosMax4(eex + 1, j + 1) > 3 ? 1 : 0;
         }
     }
-    if (oita == 0)
-        return 1;
-    saiki_4(ba, eex, setti_basyoy, &num, eecol);
-    if (num > 3)
-        return 1;
 
-    return 0;
+    return 1;
 }
 
 int chousei_syoukyo_3(PuyoColor bass[][kHeight], int[], int* poi2s, int* score, Check tokus, int i2, int j2, int ruiseki_point)
@@ -514,27 +559,14 @@ int chousei_syoukyo_3(PuyoColor bass[][kHeight], int[], int* poi2s, int* score,
     int rensa_rate[19] = { 0, 8, 16, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 480, 512 };
     int color_rate[5] = { 0, 3, 6, 12, 24 };
     int renketsu[19][NUM_PUYO_COLORS] {};
-    int colnum;
-    int renketsunum;
     int renketsubonus[19] = { 0 };
-    int rate;
-
-    int num = 0;
-    Check point[6][12] {};
-    int i, j;
-    int syo = 1;
-    int kiept[6] = { 0 };
+    int kiept[6];
     int rakkaflg[6] = { 0 };
-    int n;
-    int chain = 1;
-    int rakka_ruiseki = 0;
+    int num = 0;
     *score = 0;
-    rakkaflg[0] = 0;
-    rakkaflg[1] = 0;
-    rakkaflg[2] = 0;
-    rakkaflg[3] = 0;
-    rakkaflg[4] = 0;
-    rakkaflg[5] = 0;
+
+    // The first group is vanished by a puyo virtually put next to (i2, j2). This keeps the
+    // recursive flood fill, because the columns it marks depend on the order it visits puyos.
     PuyoColor color = bass[i2][j2];
     switch (tokus) {
     case Check::Unchecked:
@@ -561,94 +593,69 @@ int chousei_syoukyo_3(PuyoColor bass[][kHeight], int[], int* poi2s, int* score,
     else if (num > 4)
         renketsubonus[0] = num - 3;
 
-    num = 0;
-
-    kiept[0] = 0;
-    kiept[1] = 0;
-    kiept[2] = 0;
-    kiept[3] = 0;
-    kiept[4] = 0;
-    kiept[5] = 0;
-    for (i = 0; i < 6; i++) {
-        kiept[i] = 12;
-        if (rakkaflg[i] == 1) {
-            n = 0;
-            for (j = 0; j < 13; j++) {
-                if (bass[i][j] == PuyoColor::EMPTY) {
-                    if (n == 0)
-                        kiept[i] = j;
-                    n++;
-                } else if (n != 0) {
-                    bass[i][j - n] = bass[i][j];
-                    bass[i][j] = PuyoColor::EMPTY;
-                }
-            }
-            rakka_ruiseki += n;
-        }
-    }
+    int rakka_ruiseki = dropMarkedColumns(bass, rakkaflg, kiept);
 
+    // Only the puyos which have dropped can start the following chains. Like the original
+    // implementation, a column is scanned from the lowest dropped puyo to the first empty cell,
+    // and the groups vanish as soon as they are found.
+    int chain = 1;
+    bool syo = true;
     while (syo) {
-        syo = 0;
-        std::fill_n(&point[0][0], 6 * 12, Check::Unchecked);
-        rakkaflg[0] = 0;
-        rakkaflg[1] = 0;
-        rakkaflg[2] = 0;
-        rakkaflg[3] = 0;
-        rakkaflg[4] = 0;
-        rakkaflg[5] = 0;
-        for (i = 0; i < 6; i++) {
-            for (j = kiept[i]; j < 12; j++) {
-                if (point[i][j] != Check::Unchecked)
+        syo = false;
+        std::fill_n(rakkaflg, 6, 0);
+
+        // Vanishing a group doesn't change the other groups, so we can use the bits at the beginning
+        // of the step. They're converted only when a dropped puyo is found.
+        BitField bf;
+        bool converted = false;
+        FieldBits checked;
+        for (int i = 0; i < 6; i++) {
+            for (int j = kiept[i]; j < 12; j++) {
+                if (checked.get(i + 1, j + 1))
                     continue;
                 if (bass[i][j] == PuyoColor::EMPTY)
                     break;
-                if (bass[i][j] != PuyoColor::OJAMA) {
-                    saiki(bass, point, i, j, &num, bass[i][j]);
-                    if (num > 3) {
-                        syo = 1;
-                        color = bass[i][j];
-                        renketsu[chain][ordinal(color)] += num;
-                        if (num > 10)
-                            renketsubonus[chain] += 10; // bugggggg 111102
-                        else if (num > 4)
-                            renketsubonus[chain] += num - 3;
-                        (*poi2s) = (*poi2s) - num * num;
-                        syou(bass, i, j, bass[i][j], rakkaflg);
-                    }
-                    num = 0;
-                }
-            }
-        }
-        for (i = 0; i < 6; i++) {
-            kiept[i] = 12;
-            if (rakkaflg[i] == 1) {
-                n = 0;
-                for (j = 0; j < 13; j++) {
-                    if (bass[i][j] == PuyoColor::EMPTY) {
-                        if (n == 0)
-                            kiept[i] = j;
-                        n++;
-                    } else if (n != 0) {
-                        bass[i][j - n] = bass[i][j];
-                        bass[i][j] = PuyoColor::EMPTY;
-                    }
+                if (bass[i][j] == PuyoColor::OJAMA)
+                    continue;
+
+                if (!converted) {
+                    bf = toBitField(bass);
+                    converted = true;
                 }
-                rakka_ruiseki += n;
+                color = bass[i][j];
+                FieldBits connected = FieldBits(i + 1, j + 1).expand(bf.bits(color).maskedField12());
+                checked.setAll(connected);
+                num = connected.popcount();
+                if (num <= 3)
+                    continue;
+
+                syo = true;
+                renketsu[chain][ordinal(color)] += num;
+                if (num > 10)
+                    renketsubonus[chain] += 10; // bugggggg 111102
+                else if (num > 4)
+                    renketsubonus[chain] += num - 3;
+                (*poi2s) = (*poi2s) - num * num;
+
+                (connected | connected.expand1(bf.bits(PuyoColor::OJAMA).maskedField12())).iterateBitPositions([&](int x, int y) {
+                    bass[x - 1][y - 1] = PuyoColor::EMPTY;
+                    rakkaflg[x - 1] = 1;
+                });
             }
         }
+        rakka_ruiseki += dropMarkedColumns(bass, rakkaflg, kiept);
         chain++;
     } // while
     chain--;
 
-    for (i = 0; i < (chain); i++) {
-        rate = 0;
-        colnum = 0;
-        renketsunum = 0;
-        for (j = 0; j < 5; j++) {
+    for (int i = 0; i < chain; i++) {
+        int colnum = 0;
+        int renketsunum = 0;
+        for (int j = 0; j < 5; j++) {
             colnum += (renketsu[i][j] != 0);
             renketsunum += renketsu[i][j];
         }
-        rate = color_rate[colnum - 1] + renketsubonus[i] + rensa_rate[i];
+        int rate = color_rate[colnum - 1] + renketsubonus[i] + rensa_rate[i];
         if (rate == 0)
             rate = 1;
         *score += renketsunum * rate * 10;
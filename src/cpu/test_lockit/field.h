@@ -4,6 +4,8 @@
 #include "core/puyo_color.h"
 #include "lockit_constant.h"
 
+class BitField;
+
 namespace test_lockit {
 
 struct TLRensaResult;
@@ -25,15 +27,27 @@ bool isTLFieldEmpty(const PuyoColor field[6][kHeight]);
 int countNormalColor13(const PuyoColor f[][kHeight]);
 void copyField(const PuyoColor src[][kHeight], PuyoColor dst[][kHeight]);
 
+// The largest number of the puyos connected in the 12 rows.
+const int kMaxConnection = 6 * 12;
+
+BitField toBitField(const PuyoColor field[][kHeight]);
+
 // simulates a 連鎖 and returns its result.  The argument |field| will be updated
 // to be state of field after the 連鎖.
 TLRensaResult simulate(PuyoColor field[][kHeight]);
 
+// Counts the groups of the same color puyos connected in the 12 rows. |numGroups[n]| will be
+// the number of the groups of n puyos. |field| should be grounded.
+void countConnectedGroups(const PuyoColor field[][kHeight], int numGroups[kMaxConnection + 1]);
+
+// Same as saiki() on the field |bf| is converted from, i.e. marks the puyos connected to (x, y)
+// as Check::Checked in |point|, and returns the number of them.
+int markConnectedPuyos(const BitField& bf, Check point[][12], int x, int y);
+
 // --------------------------------------------------------------------
 
 void saiki(const PuyoColor field[][kHeight], Check point[][12], int x, int y, int* num, PuyoColor incol);
 void saiki_3(const PuyoColor ba[][kHeight], Check point[][12], int x, int y, int* num, PuyoColor incol);
-void saiki_4(PuyoColor ba[][kHeight], int x, int y, int* num, PuyoColor incol);
 
 void syou(PuyoColor ba[][kHeight], int x, int y, PuyoColor incol, int flg[]);
 void syou_downx(PuyoColor ba[][kHeight], int x, int y, PuyoColor incol, int flg[], int* num);
@@ -1,15 +1,313 @@
 #include "field.h"
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include "base/small_int_set.h"
+#include "core/bit_field.h"
 #include "core/core_field.h"
 #include "core/puyo_color.h"
+#include "core/score.h"
 #include "lockit_constant.h"
 #include "rensa_result.h"
 #include "util.h"
 
 namespace test_lockit {
 
+namespace {
+
+// The original implementation of simulate(), which uses saiki() and syou().
+// simulate() should return the same result as this.
+TLRensaResult simulateByRecursion(PuyoColor field[][kHeight])
+{
+    // parameters necessary to compute score
+    int chain = 0;
+    int long_bonus[TLRensaResult::MAX_RENSA] {};
+    int num_colors[TLRensaResult::MAX_RENSA] {};
+    int num_connected[TLRensaResult::MAX_RENSA] {};   // # of connected puyos
+    int num_connections[TLRensaResult::MAX_RENSA] {};  // # of groups
+    bool quick = false;
+
+    int bottom[6] {};
+    bool cont = true;
+    while (cont) {
+        cont = false;
+        Check point[6][12] {};
+        int rakkaflg[6] {};
+
+        SmallIntSet used_colors;
+        // check connections and vanish
+        for (int i = 0; i < 6; ++i) {
+            for (int j = bottom[i]; j < 12; ++j) {
+                PuyoColor color = field[i][j];
+                if (color == PuyoColor::EMPTY)
+                    continue;
+                if (point[i][j] != Check::Checked && isNormalColor(color)) {
+                    int num = 0;
+                    saiki(field, point, i, j, &num, color);
+                    if (num >= 4) {
+                        cont = true;
+                        syou(field, i, j, color, rakkaflg);
+
+                        long_bonus[chain] += longBonus(num);
+                        num_connected[chain] += num;
+                        used_colors.set(ordinal(color));
+                        num_connections[chain]++;
+                    }
+                }
+            }
+        }
+        num_colors[chain] = used_colors.size();
+        if (!cont)
+            break;
+        ++chain;
+
+        // drop puyos
+        quick = true;
+        for (int i = 0; i < 6; ++i) {
+            bottom[i] = 12;
+            if (rakkaflg[i]) {
+                int n = 0;
+                for (int j = 0; j < 13; ++j) {
+                    if (field[i][j] == PuyoColor::EMPTY) {
+                        if (n == 0)
+                            bottom[i] = j;
+                        n++;
+                    } else if (n != 0) {
+                        field[i][j - n] = field[i][j];
+                        field[i][j] = PuyoColor::EMPTY;
+                        quick = false;
+                    }
+                }
+            }
+        }
+    }
+
+    int score = 0;
+    int num_vanished = 0;
+    for (int i = 0; i < chain; ++i) {
+        int chain_bonus = chainBonus(i + 1);
+        int color_bonus = colorBonus(num_colors[i]);
+        int rate = calculateRensaBonusCoef(chain_bonus, long_bonus[i], color_bonus);
+        score += num_connected[i] * rate * 10;
+        num_vanished += num_connected[i];
+    }
+
+    TLRensaResult result;
+    result.chains = chain;
+    result.score = score;
+    result.quick = quick;
+    result.num_vanished = num_vanished;
+    for (int i = 0; i < chain; ++i) {
+        result.num_connections[i] = num_connections[i];
+    }
+
+    return result;
+}
+
+// The original implementation of setti_puyo_1().
+void saiki_4(PuyoColor ba[][kHeight], int x, int y, int* num, PuyoColor incol)
+{
+    ba[x][y] = PuyoColor::EMPTY;
+    *num += 1;
+    if (*num > 3) {
+        ba[x][y] = incol;
+        return;
+    }
+    if ((x != 0) && (incol == ba[x - 1][y]))
+        saiki_4(ba, x - 1, y, num, incol);
+    if ((y != 11) && (incol == ba[x][y + 1]))
+        saiki_4(ba, x, y + 1, num, incol);
+    if ((x != 5) && (incol == ba[x + 1][y]))
+        saiki_4(ba, x + 1, y, num, incol);
+    if ((y != 0) && (incol == ba[x][y - 1]))
+        saiki_4(ba, x, y - 1, num, incol);
+    ba[x][y] = incol;
+}
+
+int settiPuyo1ByRecursion(PuyoColor ba[][kHeight], int eex, PuyoColor eecol)
+{
+    for (int j = 0; j < 12; j++) {
+        if (ba[eex][j] == PuyoColor::EMPTY) {
+            ba[eex][j] = eecol;
+            int num = 0;
+            saiki_4(ba, eex, j, &num, eecol);
+            return num > 3 ? 1 : 0;
+        }
+    }
+    return 1;
+}
+
+// The original implementation of countConnectedGroups(), which COMAI_HI used inline.
+void countConnectedGroupsByRecursion(const PuyoColor ba[][kHeight], int numGroups[kMaxConnection + 1])
+{
+    std::fill_n(numGroups, kMaxConnection + 1, 0);
+
+    Check point[6][12] {};
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < 12; j++) {
+            if (ba[i][j] == PuyoColor::EMPTY)
+                break;
+            if (point[i][j] != Check::Checked && isNormalColor(ba[i][j])) {
+                int num = 0;
+                saiki(ba, point, i, j, &num, ba[i][j]);
+                ++numGroups[num];
+            }
+        }
+    }
+}
+
+// The original implementation of chousei_syoukyo_3(), which uses saiki() and syou().
+int chouseiSyoukyo3ByRecursion(PuyoColor bass[][kHeight], int* poi2s, int* score, Check tokus, int i2, int j2, int ruiseki_point)
+{
+    int rensa_rate[19] = { 0, 8, 16, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 480, 512 };
+    int color_rate[5] = { 0, 3, 6, 12, 24 };
+    int renketsu[19][NUM_PUYO_COLORS] {};
+    int renketsubonus[19] = { 0 };
+    int num = 0;
+    int kiept[6] = { 0 };
+    int rakkaflg[6] = { 0 };
+    int chain = 1;
+    int rakka_ruiseki = 0;
+    bool syo = true;
+    *score = 0;
+
+    PuyoColor color = bass[i2][j2];
+    switch (tokus) {
+    case Check::ColorWithEmptyUR:
+    case Check::ColorWithEmptyUL:
+    case Check::ColorWithEmptyU:
+        syou_downx(bass, i2, j2 + 1, bass[i2][j2], rakkaflg, &num);
+        break;
+    case Check::ColorWithEmptyLR:
+    case Check::ColorWithEmptyL:
+        syou_downx(bass, i2 + 1, j2, bass[i2][j2], rakkaflg, &num);
+        break;
+    case Check::ColorWithEmptyR:
+        syou_downx(bass, i2 - 1, j2, bass[i2][j2], rakkaflg, &num);
+        break;
+    default:
+        CHECK(false);
+    }
+    renketsu[0][ordinal(color)] = num;
+    if (num > 10)
+        renketsubonus[0] += 10;
+    else if (num > 4)
+        renketsubonus[0] = num - 3;
+    num = 0;
+
+    auto drop = [&]() {
+        for (int i = 0; i < 6; i++) {
+            kiept[i] = 12;
+            if (rakkaflg[i] == 1) {
+                int n = 0;
+                for (int j = 0; j < 13; j++) {
+                    if (bass[i][j] == PuyoColor::EMPTY) {
+                        if (n == 0)
+                            kiept[i] = j;
+                        n++;
+                    } else if (n != 0) {
+                        bass[i][j - n] = bass[i][j];
+                        bass[i][j] = PuyoColor::EMPTY;
+                    }
+                }
+                rakka_ruiseki += n;
+            }
+        }
+    };
+    drop();
+
+    while (syo) {
+        syo = false;
+        Check point[6][12] {};
+        std::fill_n(rakkaflg, 6, 0);
+        for (int i = 0; i < 6; i++) {
+            for (int j = kiept[i]; j < 12; j++) {
+                if (point[i][j] != Check::Unchecked)
+                    continue;
+                if (bass[i][j] == PuyoColor::EMPTY)
+                    break;
+                if (bass[i][j] != PuyoColor::OJAMA) {
+                    saiki(bass, point, i, j, &num, bass[i][j]);
+                    if (num > 3) {
+                        syo = true;
+                        color = bass[i][j];
+                        renketsu[chain][ordinal(color)] += num;
+                        if (num > 10)
+                            renketsubonus[chain] += 10;
+                        else if (num > 4)
+                            renketsubonus[chain] += num - 3;
+                        (*poi2s) = (*poi2s) - num * num;
+                        syou(bass, i, j, bass[i][j], rakkaflg);
+                    }
+                    num = 0;
+                }
+            }
+        }
+        drop();
+        chain++;
+    }
+    chain--;
+
+    for (int i = 0; i < chain; i++) {
+        int colnum = 0;
+        int renketsunum = 0;
+        for (int j = 0; j < 5; j++) {
+            colnum += (renketsu[i][j] != 0);
+            renketsunum += renketsu[i][j];
+        }
+        int rate = color_rate[colnum - 1] + renketsubonus[i] + rensa_rate[i];
+        if (rate == 0)
+            rate = 1;
+        *score += renketsunum * rate * 10;
+    }
+    (*poi2s) = (*poi2s) - rakka_ruiseki * ruiseki_point;
+    return chain;
+}
+
+// Plays random games, and calls |callback| with the field after each placement, both before
+// and after the rensa.
+template<typename Callback>
+void playRandomGames(unsigned int seed, int numGames, Callback callback)
+{
+    std::mt19937 mt(seed);
+    std::uniform_int_distribution<int> decisionDist(0, 21);
+    std::uniform_int_distribution<int> colorDist(0, 3);
+    std::uniform_int_distribution<int> ojamaDist(0, 29);
+
+    for (int game = 0; game < numGames; ++game) {
+        PuyoColor field[6][kHeight] {};
+        for (int turn = 0; turn < 60; ++turn) {
+            PuyoColor c1 = NORMAL_PUYO_COLORS[colorDist(mt)];
+            PuyoColor c2 = NORMAL_PUYO_COLORS[colorDist(mt)];
+            int settiBasyo[4];
+            if (!setti_puyo(field, decisionDist(mt), c1, c2, settiBasyo))
+                break;
+            if (ojamaDist(mt) == 0)
+                setti_ojama(field, 6);
+
+            callback(field);
+            simulate(field);
+            callback(field);
+            if (field[2][11] != PuyoColor::EMPTY)
+                break;
+        }
+    }
+}
+
+void expectSameField(const PuyoColor expected[][kHeight], const PuyoColor actual[][kHeight])
+{
+    for (int x = 0; x < 6; ++x) {
+        for (int y = 0; y < kHeight; ++y)
+            ASSERT_EQ(expected[x][y], actual[x][y]) << x << ' ' << y;
+    }
+}
+
+}  // namespace
+
 TEST(FieldTest, Saiki) {
     CoreField cf(
         "BBGGYY"    // 12 (invisible)
@@ -205,4 +503,159 @@ TEST(FieldTest, simulate_2_double)
     EXPECT_EQ(2, result.num_connections[1]);
 }
 
+TEST(FieldTest, simulateSameAsRecursion)
+{
+    std::mt19937 mt(1);
+    std::uniform_int_distribution<int> decisionDist(0, 21);
+    std::uniform_int_distribution<int> colorDist(0, 3);
+    std::uniform_int_distribution<int> ojamaDist(0, 29);
+
+    int numRensa = 0;
+    for (int game = 0; game < 300; ++game) {
+        PuyoColor field[6][kHeight] {};
+        for (int turn = 0; turn < 60; ++turn) {
+            PuyoColor c1 = NORMAL_PUYO_COLORS[colorDist(mt)];
+            PuyoColor c2 = NORMAL_PUYO_COLORS[colorDist(mt)];
+            int settiBasyo[4];
+            if (!setti_puyo(field, decisionDist(mt), c1, c2, settiBasyo))
+                break;
+            if (ojamaDist(mt) == 0)
+                setti_ojama(field, 6);
+
+            PuyoColor expectedField[6][kHeight];
+            copyField(field, expectedField);
+
+            TLRensaResult expected = simulateByRecursion(expectedField);
+            TLRensaResult actual = simulate(field);
+
+            ASSERT_EQ(expected.chains, actual.chains);
+            ASSERT_EQ(expected.score, actual.score);
+            ASSERT_EQ(expected.num_vanished, actual.num_vanished);
+            ASSERT_EQ(expected.quick, actual.quick);
+            for (int i = 0; i < expected.chains; ++i)
+                ASSERT_EQ(expected.num_connections[i], actual.num_connections[i]) << i;
+            for (int x = 0; x < 6; ++x) {
+                for (int y = 0; y < kHeight; ++y)
+                    ASSERT_EQ(expectedField[x][y], field[x][y]) << x << ' ' << y;
+            }
+
+            if (actual.chains > 0)
+                ++numRensa;
+            if (field[2][11] != PuyoColor::EMPTY)
+                break;
+        }
+    }
+
+    // Make sure the random games cover rensa.
+    EXPECT_LT(100, numRensa);
+}
+
+TEST(FieldTest, countConnectedGroupsSameAsRecursion)
+{
+    int numLargeGroups = 0;
+    playRandomGames(2, 100, [&](const PuyoColor field[][kHeight]) {
+        int expected[kMaxConnection + 1];
+        int actual[kMaxConnection + 1];
+        countConnectedGroupsByRecursion(field, expected);
+        countConnectedGroups(field, actual);
+        for (int n = 0; n <= kMaxConnection; ++n) {
+            ASSERT_EQ(expected[n], actual[n]) << n;
+            if (n >= 4)
+                numLargeGroups += actual[n];
+        }
+    });
+
+    // Make sure the fields before the rensa are covered.
+    EXPECT_LT(0, numLargeGroups);
+}
+
+TEST(FieldTest, markConnectedPuyosSameAsSaiki)
+{
+    playRandomGames(3, 100, [](const PuyoColor field[][kHeight]) {
+        BitField bf = toBitField(field);
+        Check expectedPoint[6][12] {};
+        Check actualPoint[6][12] {};
+        for (int x = 0; x < 6; ++x) {
+            for (int y = 0; y < 12; ++y) {
+                if (!isNormalColor(field[x][y]) || expectedPoint[x][y] == Check::Checked)
+                    continue;
+                int expected = 0;
+                saiki(field, expectedPoint, x, y, &expected, field[x][y]);
+                ASSERT_EQ(expected, markConnectedPuyos(bf, actualPoint, x, y));
+                for (int i = 0; i < 6; ++i) {
+                    for (int j = 0; j < 12; ++j)
+                        ASSERT_EQ(expectedPoint[i][j], actualPoint[i][j]) << i << ' ' << j;
+                }
+            }
+        }
+    });
+}
+
+TEST(FieldTest, settiPuyo1SameAsRecursion)
+{
+    playRandomGames(4, 100, [](const PuyoColor field[][kHeight]) {
+        for (int x = 0; x < 6; ++x) {
+            for (PuyoColor c : NORMAL_PUYO_COLORS) {
+                PuyoColor expectedField[6][kHeight];
+                PuyoColor actualField[6][kHeight];
+                copyField(field, expectedField);
+                copyField(field, actualField);
+                ASSERT_EQ(settiPuyo1ByRecursion(expectedField, x, c), setti_puyo_1(actualField, x, c));
+                expectSameField(expectedField, actualField);
+            }
+        }
+    });
+}
+
+TEST(FieldTest, chouseiSyoukyo3SameAsRecursion)
+{
+    int numRensa = 0;
+    playRandomGames(5, 100, [&](const PuyoColor field[][kHeight]) {
+        // COMAI_HI calls chousei_syoukyo_3() on the fields without rensa.
+        PuyoColor ba[6][kHeight];
+        copyField(field, ba);
+        if (simulate(ba).chains > 0)
+            return;
+
+        for (int x = 0; x < 6; ++x) {
+            for (int y = 0; y < 12; ++y) {
+                if (!isNormalColor(ba[x][y]))
+                    continue;
+
+                // Tries a puyo put on the empty cell above, right or left of (x, y).
+                std::vector<Check> tokuses;
+                if (y != 11 && ba[x][y + 1] == PuyoColor::EMPTY)
+                    tokuses.push_back(Check::ColorWithEmptyU);
+                if (x != 5 && ba[x + 1][y] == PuyoColor::EMPTY)
+                    tokuses.push_back(Check::ColorWithEmptyL);
+                if (x != 0 && ba[x - 1][y] == PuyoColor::EMPTY)
+                    tokuses.push_back(Check::ColorWithEmptyR);
+
+                for (Check tokus : tokuses) {
+                    PuyoColor expectedField[6][kHeight];
+                    PuyoColor actualField[6][kHeight];
+                    copyField(ba, expectedField);
+                    copyField(ba, actualField);
+                    int expectedPoi2s = 100;
+                    int actualPoi2s = 100;
+                    int expectedScore;
+                    int actualScore;
+                    int settiBasyo[4] {};
+                    int expected = chouseiSyoukyo3ByRecursion(expectedField, &expectedPoi2s, &expectedScore, tokus, x, y, 6);
+                    int actual = chousei_syoukyo_3(actualField, settiBasyo, &actualPoi2s, &actualScore, tokus, x, y, 6);
+                    ASSERT_EQ(expected, actual);
+                    ASSERT_EQ(expectedPoi2s, actualPoi2s);
+                    ASSERT_EQ(expectedScore, actualScore);
+                    expectSameField(expectedField, actualField);
+                    if (actual > 1)
+                        ++numRensa;
+                }
+            }
+        }
+    });
+
+    // Make sure the random fields cover the following chains.
+    EXPECT_LT(100, numRensa);
+}
+
 }  // namespace test_lockit
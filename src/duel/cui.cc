@@ -123,6 +123,7 @@ void Cui::print(int playerId, const PlayerGameState& pgs)
     printNextPuyo(playerId, pgs);
     printMessage(playerId, pgs.message);
     printScore(playerId, pgs.score);
+    printThinkLatency(playerId, pgs.thinkLatency);
 
     setCursor(1, FieldConstant::MAP_HEIGHT + 3);
 }
@@ -135,6 +136,11 @@ void Cui::printScore(int playerId, int score)
               ss.str());
 }
 
+void Cui::printThinkLatency(int playerId, const string& thinkLatency)
+{
+    printText(locate(playerId, 0, FieldConstant::MAP_HEIGHT + 2), thinkLatency);
+}
+
 void Cui::printOjamaPuyo(int playerId, const PlayerGameState& pgs)
 {
     std::ostringstream ss;
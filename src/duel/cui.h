@@ -51,6 +51,7 @@ protected:
     void printField(int playerId, const PlayerGameState&);
     void printNextPuyo(int playerId, const PlayerGameState&);
     void printScore(int playerId, int score);
+    void printThinkLatency(int playerId, const std::string& thinkLatency);
     void printOjamaPuyo(int playerId, const PlayerGameState&);
     void printMessage(int playerId, const std::string& message);
 
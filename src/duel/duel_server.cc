@@ -7,6 +7,7 @@
 #include <string>
 
 #include <gflags/gflags.h>
+#include <glog/logging.h>
 
 #include "core/decision.h"
 #include "core/frame_response.h"
@@ -16,6 +17,7 @@
 #include "core/server/connector/server_connector.h"
 #include "core/server/game_state.h"
 #include "core/server/game_state_observer.h"
+#include "core/server/think_latency_tracker.h"
 #include "duel/field_realtime.h"
 #include "duel/frame_context.h"
 
@@ -24,6 +26,8 @@ using namespace std;
 DEFINE_int32(num_duel, -1, "After num_duel times of duel, the server will stop. negative is infinity.");
 DEFINE_int32(num_win, -1, "After num_win times of 1p or 2p win, the server will stop. negative is infinity");
 DEFINE_bool(use_even, false, "the match gets even after 2 minutes.");
+DEFINE_string(think_latency_summary, "",
+              "If set, the think latency of each player is appended to this file in a JSON line per match.");
 
 #ifdef USE_SDL2
 DECLARE_bool(use_gui);
@@ -49,6 +53,7 @@ struct DuelServer::DuelState {
             pgs->fixedOjama = fr.numFixedOjama();
             pgs->decision = decision[pi];
             pgs->message = message[pi];
+            pgs->thinkLatency = thinkLatency[pi].stats().toShortString();
         }
 
         return gs;
@@ -58,6 +63,7 @@ struct DuelServer::DuelState {
     FieldRealtime field[2];
     Decision decision[2];
     string message[2];
+    ThinkLatencyTracker thinkLatency[2];
 };
 
 /**
@@ -221,11 +227,20 @@ GameResult DuelServer::runGame(ConnectorManager* manager)
         for (int pi = 0; pi < 2; ++pi) {
             manager->connector(pi)->send(gameState.toFrameRequestFor(pi));
         }
+        auto sentTime = std::chrono::steady_clock::now();
+        for (int pi = 0; pi < 2; ++pi) {
+            if (manager->connector(pi)->isHuman())
+                continue;
+            const UserEvent& event = gameState.playerGameState(pi).event;
+            if (event.decisionRequest || event.decisionRequestAgain)
+                duelState.thinkLatency[pi].requested(frameId, event.decisionRequestAgain, sentTime);
+        }
 
         // --- Reads the response of the current frame information.
         // It takes up to 1/FPS [s] to finish this section.
         vector<FrameResponse> data[2];
-        if (!manager->receive(frameId, data, timeout_time)) {
+        vector<std::chrono::steady_clock::time_point> receivedTimes[2];
+        if (!manager->receive(frameId, data, timeout_time, receivedTimes)) {
             if (manager->connector(0)->isClosed()) {
                 gameResult = GameResult::P2_WIN_WITH_CONNECTION_ERROR;
                 break;
@@ -235,6 +250,11 @@ GameResult DuelServer::runGame(ConnectorManager* manager)
             }
         }
 
+        for (int pi = 0; pi < 2; ++pi) {
+            for (size_t i = 0; i < data[pi].size(); ++i)
+                duelState.thinkLatency[pi].received(data[pi][i], receivedTimes[pi][i]);
+        }
+
         // --- Play with input.
         play(&duelState, data);
         gameState = duelState.toGameState();
@@ -269,6 +289,23 @@ GameResult DuelServer::runGame(ConnectorManager* manager)
     for (auto observer : observers_)
         observer->gameHasDone(gameResult);
 
+    for (int pi = 0; pi < 2; ++pi) {
+        duelState.thinkLatency[pi].reset();
+        LOG(INFO) << (pi + 1) << "P think latency: " << duelState.thinkLatency[pi].stats().toString();
+    }
+    if (!FLAGS_think_latency_summary.empty() && gameResult != GameResult::GAME_HAS_STOPPED) {
+        ofstream ofs(FLAGS_think_latency_summary, ios::app);
+        if (ofs) {
+            ofs << "{\"result\": \"" << toString(gameResult) << "\""
+                << ", \"frames\": " << duelState.frameId
+                << ", \"p1\": " << duelState.thinkLatency[0].stats().toJson()
+                << ", \"p2\": " << duelState.thinkLatency[1].stats().toJson()
+                << "}" << endl;
+        } else {
+            LOG(ERROR) << "failed to open " << FLAGS_think_latency_summary;
+        }
+    }
+
     return gameResult;
 }
 
@@ -16,4 +16,13 @@ inline UniqueSDLSurface emptyUniqueSDLSurface()
     return UniqueSDLSurface(nullptr, SDL_FreeSurface);
 }
 
+// SharedSDLSurface is used when a surface is read from several threads,
+// e.g. the analyzer and the drawer.
+typedef std::shared_ptr<SDL_Surface> SharedSDLSurface;
+
+inline SharedSDLSurface toSharedSDLSurface(UniqueSDLSurface surface)
+{
+    return SharedSDLSurface(std::move(surface));
+}
+
 #endif
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -10,11 +11,28 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <vector>
 
+#include <glog/logging.h>
+
+#include "base/executor.h"
 #include "base/file/file.h"
+#include "base/wait_group.h"
 
 namespace {
 
+// The header of the binary parameter file. The weights follow in float.
+struct ParameterFileHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::int32_t num_input;
+    std::int32_t num_hidden;
+    std::int32_t num_output;
+};
+
+const char PARAMETER_FILE_MAGIC[4] = { 'P', 'M', 'L', 'P' };
+const std::uint32_t PARAMETER_FILE_VERSION = 1;
+
 inline float activator(float x)
 {
     return std::tanh(x);
@@ -53,6 +71,45 @@ MultiLayerPerceptron::~MultiLayerPerceptron()
 {
 }
 
+// static
+std::unique_ptr<MultiLayerPerceptron> MultiLayerPerceptron::loadParameter(const std::string& path)
+{
+    std::string content;
+    if (!file::readFile(path, &content)) {
+        LOG(ERROR) << "cannot read " << path;
+        return std::unique_ptr<MultiLayerPerceptron>();
+    }
+
+    ParameterFileHeader header;
+    if (content.size() < sizeof(header)) {
+        LOG(ERROR) << path << " is too short";
+        return std::unique_ptr<MultiLayerPerceptron>();
+    }
+    memcpy(&header, content.data(), sizeof(header));
+    if (memcmp(header.magic, PARAMETER_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != PARAMETER_FILE_VERSION) {
+        LOG(ERROR) << path << " is not a parameter file of version " << PARAMETER_FILE_VERSION;
+        return std::unique_ptr<MultiLayerPerceptron>();
+    }
+    if (header.num_input <= 0 || header.num_hidden <= 0 || header.num_output <= 0) {
+        LOG(ERROR) << path << " has a broken header";
+        return std::unique_ptr<MultiLayerPerceptron>();
+    }
+
+    std::unique_ptr<MultiLayerPerceptron> mlp(
+        new MultiLayerPerceptron(header.num_input, header.num_hidden, header.num_output));
+    size_t w2_size = mlp->hidden_layer_weight_size() * sizeof(float);
+    size_t w3_size = mlp->output_layer_weight_size() * sizeof(float);
+    if (content.size() != sizeof(header) + w2_size + w3_size) {
+        LOG(ERROR) << path << " has unexpected size";
+        return std::unique_ptr<MultiLayerPerceptron>();
+    }
+
+    memcpy(mlp->w2_.get(), content.data() + sizeof(header), w2_size);
+    memcpy(mlp->w3_.get(), content.data() + sizeof(header) + w2_size, w3_size);
+    return mlp;
+}
+
 MultiLayerPerceptron::ForwardingIntermediateStorage MultiLayerPerceptron::makeForwadingStorage() const
 {
     ForwardingIntermediateStorage data;
@@ -94,14 +151,101 @@ bool MultiLayerPerceptron::train(int correct_label,
                                  float learning_rate,
                                  float l2_normalization)
 {
-    int predicted_label = predict(x, data);
+    forward(x, data);
+    bool correct = calculate_error(correct_label, *data, error_data);
+
+    // Applies the gradient of this data in place instead of summing it up like trainBatch().
+    // The arithmetic is the same as update() with a batch of one data.
+    const float decay = learning_rate * l2_normalization;
+    for (int i = 0; i < num_hidden_ + 1; ++i) {
+        for (int j = 0; j < num_output_; ++j) {
+            float& w = w3_[i * num_output_ + j];
+            w -= learning_rate * (error_data->e3[j] * data->o2[i]) + decay * w;
+        }
+    }
+
+    for (int i = 0; i < num_input_ + 1; ++i) {
+        for (int j = 0; j < num_hidden_; ++j) {
+            float& w = w2_[i * num_hidden_ + j];
+            w -= learning_rate * (data->o1[i] * error_data->e2[j]) + decay * w;
+        }
+    }
+
+    return correct;
+}
+
+int MultiLayerPerceptron::trainBatch(const int correct_labels[],
+                                     const float xs[],
+                                     int batch_size,
+                                     float learning_rate,
+                                     float l2_normalization,
+                                     Executor* executor,
+                                     int num_tasks)
+{
+    if (batch_size <= 0)
+        return 0;
+
+    const int tasks = executor ? std::max(1, std::min(num_tasks, batch_size)) : 1;
+    std::vector<std::vector<float>> g2s(tasks);
+    std::vector<std::vector<float>> g3s(tasks);
+    std::vector<int> num_corrects(tasks);
+
+    auto calculate_gradient = [&](int task) {
+        ForwardingIntermediateStorage data = makeForwadingStorage();
+        BackPropagationIntermediateStorage error_data = makeBackpropagationStorage();
+        g2s[task].assign(hidden_layer_weight_size(), 0.0);
+        g3s[task].assign(output_layer_weight_size(), 0.0);
+
+        int begin = static_cast<long long>(batch_size) * task / tasks;
+        int end = static_cast<long long>(batch_size) * (task + 1) / tasks;
+        for (int k = begin; k < end; ++k) {
+            forward(xs + static_cast<size_t>(k) * num_input_, &data);
+            if (backward(correct_labels[k], &data, &error_data, g2s[task].data(), g3s[task].data()))
+                ++num_corrects[task];
+        }
+    };
+
+    if (tasks == 1) {
+        calculate_gradient(0);
+    } else {
+        WaitGroup wg;
+        wg.add(tasks);
+        for (int task = 0; task < tasks; ++task) {
+            executor->submit([&, task]() {
+                calculate_gradient(task);
+                wg.done();
+            });
+        }
+        wg.waitUntilDone();
+    }
+
+    // Sums up in the task order, so that the result is deterministic.
+    for (int task = 1; task < tasks; ++task) {
+        for (int i = 0; i < hidden_layer_weight_size(); ++i)
+            g2s[0][i] += g2s[task][i];
+        for (int i = 0; i < output_layer_weight_size(); ++i)
+            g3s[0][i] += g3s[task][i];
+    }
+
+    update(g2s[0].data(), g3s[0].data(), learning_rate / batch_size, learning_rate, l2_normalization);
+
+    int num_correct = 0;
+    for (int n : num_corrects)
+        num_correct += n;
+    return num_correct;
+}
+
+bool MultiLayerPerceptron::calculate_error(int correct_label,
+                                           const ForwardingIntermediateStorage& data,
+                                           BackPropagationIntermediateStorage* error_data) const
+{
+    int predicted_label = std::max_element(data.i3.get(), data.i3.get() + num_output_) - data.i3.get();
 
-    // calculate error.
     for (int i = 0; i < num_output_; ++i) {
         if (correct_label == i) {
-            error_data->e3[i] = data->i3[i] - 1;
+            error_data->e3[i] = data.i3[i] - 1;
         } else {
-            error_data->e3[i] = data->i3[i];
+            error_data->e3[i] = data.i3[i];
         }
     }
 
@@ -110,33 +254,42 @@ bool MultiLayerPerceptron::train(int correct_label,
         for (int j = 0; j < num_output_; ++j) {
             t += w3_[i * num_output_ + j] * error_data->e3[j];
         }
-        error_data->e2[i] = t * d_activator(data->i2[i]);
+        error_data->e2[i] = t * d_activator(data.i2[i]);
     }
 
-    // back propagation
+    return correct_label == predicted_label;
+}
+
+bool MultiLayerPerceptron::backward(int correct_label,
+                                    ForwardingIntermediateStorage* data,
+                                    BackPropagationIntermediateStorage* error_data,
+                                    float g2[], float g3[]) const
+{
+    bool correct = calculate_error(correct_label, *data, error_data);
+
     for (int i = 0; i < num_hidden_ + 1; ++i) {
         for (int j = 0; j < num_output_; ++j) {
-            w3_[i * num_output_ + j] -= learning_rate * error_data->e3[j] * data->o2[i];
+            g3[i * num_output_ + j] += error_data->e3[j] * data->o2[i];
         }
     }
 
     for (int i = 0; i < num_input_ + 1; ++i) {
         for (int j = 0; j < num_hidden_; ++j) {
-            w2_[i * num_hidden_ + j] -= learning_rate * data->o1[i] * error_data->e2[j];
+            g2[i * num_hidden_ + j] += data->o1[i] * error_data->e2[j];
         }
     }
 
-    // normalization
-    if (l2_normalization != 0.0) {
-        for (int i = 0; i < hidden_layer_weight_size(); ++i) {
-            w2_[i] -= learning_rate * l2_normalization * w2_[i];
-        }
-        for (int i = 0; i < output_layer_weight_size(); ++i) {
-            w3_[i] -= learning_rate * l2_normalization * w3_[i];
-        }
-    }
+    return correct;
+}
 
-    return correct_label == predicted_label;
+void MultiLayerPerceptron::update(const float g2[], const float g3[], float gradient_rate,
+                                  float learning_rate, float l2_normalization)
+{
+    const float decay = learning_rate * l2_normalization;
+    for (int i = 0; i < hidden_layer_weight_size(); ++i)
+        w2_[i] -= gradient_rate * g2[i] + decay * w2_[i];
+    for (int i = 0; i < output_layer_weight_size(); ++i)
+        w3_[i] -= gradient_rate * g3[i] + decay * w3_[i];
 }
 
 void MultiLayerPerceptron::forward(const float x[], ForwardingIntermediateStorage* data) const
@@ -168,12 +321,12 @@ void MultiLayerPerceptron::forward(const float x[], ForwardingIntermediateStorag
 
 void MultiLayerPerceptron::setHiddenLayerParameter(const float values[])
 {
-    memcpy(w2_.get(), values, hidden_layer_weight_size());
+    memcpy(w2_.get(), values, hidden_layer_weight_size() * sizeof(float));
 }
 
 void MultiLayerPerceptron::setOutputLayerParameter(const float values[])
 {
-    memcpy(w3_.get(), values, output_layer_weight_size());
+    memcpy(w3_.get(), values, output_layer_weight_size() * sizeof(float));
 }
 
 bool MultiLayerPerceptron::saveParameterAsCSource(const char* path, const char* prefix) const
@@ -218,4 +371,19 @@ bool MultiLayerPerceptron::saveParameterAsCSource(const char* path, const char*
     return true;
 }
 
+bool MultiLayerPerceptron::saveParameter(const std::string& path) const
+{
+    ParameterFileHeader header;
+    memcpy(header.magic, PARAMETER_FILE_MAGIC, sizeof(header.magic));
+    header.version = PARAMETER_FILE_VERSION;
+    header.num_input = num_input_;
+    header.num_hidden = num_hidden_;
+    header.num_output = num_output_;
+
+    std::string content(reinterpret_cast<const char*>(&header), sizeof(header));
+    content.append(reinterpret_cast<const char*>(w2_.get()), hidden_layer_weight_size() * sizeof(float));
+    content.append(reinterpret_cast<const char*>(w3_.get()), output_layer_weight_size() * sizeof(float));
+    return file::writeFile(path, content);
+}
+
 } // namespace learning
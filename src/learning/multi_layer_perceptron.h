@@ -2,6 +2,9 @@
 #define LEARNING_MULTILAYER_PERCEPTRON_H_
 
 #include <memory>
+#include <string>
+
+class Executor;
 
 namespace learning {
 
@@ -23,6 +26,13 @@ public:
     MultiLayerPerceptron(int in, int hid, int out);
     ~MultiLayerPerceptron();
 
+    // Loads the parameter saved with saveParameter(). Returns nullptr if failed.
+    static std::unique_ptr<MultiLayerPerceptron> loadParameter(const std::string& path);
+
+    int numInput() const { return num_input_; }
+    int numHidden() const { return num_hidden_; }
+    int numOutput() const { return num_output_; }
+
     ForwardingIntermediateStorage makeForwadingStorage() const;
     BackPropagationIntermediateStorage makeBackpropagationStorage() const;
 
@@ -30,7 +40,7 @@ public:
     // |x| should have |num_input_| size.
     int predict(const float x[], ForwardingIntermediateStorage* data) const;
 
-    // Train single data.
+    // Train single data. This is the same as trainBatch() with a batch of one data.
     // |x| should have |num_input_| size.
     bool train(int correct_label,
                const float x[],
@@ -39,16 +49,49 @@ public:
                float learning_rate = 0.1,
                float l2_normalization = 0.001);
 
+    // Trains a mini-batch of |batch_size| data. |xs| has |batch_size| * |num_input_| values.
+    // The gradients are averaged over the batch, and applied once. When |executor| is given,
+    // the gradients are calculated in |num_tasks| tasks in parallel. The result doesn't
+    // depend on |num_tasks|, except rounding errors.
+    // Returns the number of data that were predicted correctly before the update.
+    int trainBatch(const int correct_labels[],
+                   const float xs[],
+                   int batch_size,
+                   float learning_rate = 0.1,
+                   float l2_normalization = 0.001,
+                   Executor* executor = nullptr,
+                   int num_tasks = 1);
+
     void setHiddenLayerParameter(const float values[]);
     void setOutputLayerParameter(const float values[]);
 
+    // The weight of the j-th input (j == num_input_ is the bias) for the i-th hidden neuron
+    // is hiddenLayerParameter()[j * num_hidden_ + i]. The output layer is the same.
+    const float* hiddenLayerParameter() const { return w2_.get(); }
+    const float* outputLayerParameter() const { return w3_.get(); }
+
     bool saveParameterAsCSource(const char* path, const char* prefix) const;
+    // Saves the parameter in binary. Use loadParameter() to load it.
+    bool saveParameter(const std::string& path) const;
 
 private:
     int hidden_layer_weight_size() const;
     int output_layer_weight_size() const;
 
     void forward(const float x[], ForwardingIntermediateStorage* data) const;
+    // Calculates the errors of the layers for |correct_label| after forward().
+    // Returns true if the prediction was correct.
+    bool calculate_error(int correct_label,
+                         const ForwardingIntermediateStorage& data,
+                         BackPropagationIntermediateStorage* error_data) const;
+    // Calculates the errors like calculate_error(), and adds the gradients to |g2| and |g3|.
+    bool backward(int correct_label,
+                  ForwardingIntermediateStorage* data,
+                  BackPropagationIntermediateStorage* error_data,
+                  float g2[], float g3[]) const;
+    // Applies the gradients |g2| and |g3| multiplied by |gradient_rate|, and the L2 decay.
+    void update(const float g2[], const float g3[], float gradient_rate,
+                float learning_rate, float l2_normalization);
 
     const int num_input_;  // the number of input layer neuron.
     const int num_hidden_; // the number of hidden layer nueron.
@@ -0,0 +1,142 @@
+#include "learning/quantized_perceptron.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#else
+#include <smmintrin.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+#include "learning/multi_layer_perceptron.h"
+
+namespace {
+
+// The number of inputs processed at once. Each quantized weight row is loaded once
+// for these inputs.
+const int BLOCK_SIZE = 4;
+
+// The input stride is a multiple of this, so that the dot product has no remainder loop.
+const int INPUT_ALIGNMENT = 32;
+
+#if defined(__AVX2__)
+inline int horizontalSum(__m256i v)
+{
+    __m128i x = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    x = _mm_add_epi32(x, _mm_srli_si128(x, 8));
+    x = _mm_add_epi32(x, _mm_srli_si128(x, 4));
+    return _mm_cvtsi128_si32(x);
+}
+#else
+inline int horizontalSum(__m128i x)
+{
+    x = _mm_add_epi32(x, _mm_srli_si128(x, 8));
+    x = _mm_add_epi32(x, _mm_srli_si128(x, 4));
+    return _mm_cvtsi128_si32(x);
+}
+#endif
+
+// Calculates the dot products of |w| and the BLOCK_SIZE inputs |x|.
+// Since the inputs are in [0, 127], the products of adjacent bytes never saturate in int16.
+inline void dotBlock(const std::int8_t* w, const std::uint8_t* const x[BLOCK_SIZE], int size, int result[BLOCK_SIZE])
+{
+#if defined(__AVX2__)
+    const __m256i ones = _mm256_set1_epi16(1);
+    __m256i sum[BLOCK_SIZE];
+    for (int b = 0; b < BLOCK_SIZE; ++b)
+        sum[b] = _mm256_setzero_si256();
+
+    for (int k = 0; k < size; k += 32) {
+        const __m256i wv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + k));
+        for (int b = 0; b < BLOCK_SIZE; ++b) {
+            const __m256i xv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x[b] + k));
+            sum[b] = _mm256_add_epi32(sum[b], _mm256_madd_epi16(_mm256_maddubs_epi16(xv, wv), ones));
+        }
+    }
+#else
+    const __m128i ones = _mm_set1_epi16(1);
+    __m128i sum[BLOCK_SIZE];
+    for (int b = 0; b < BLOCK_SIZE; ++b)
+        sum[b] = _mm_setzero_si128();
+
+    for (int k = 0; k < size; k += 16) {
+        const __m128i wv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w + k));
+        for (int b = 0; b < BLOCK_SIZE; ++b) {
+            const __m128i xv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x[b] + k));
+            sum[b] = _mm_add_epi32(sum[b], _mm_madd_epi16(_mm_maddubs_epi16(xv, wv), ones));
+        }
+    }
+#endif
+
+    for (int b = 0; b < BLOCK_SIZE; ++b)
+        result[b] = horizontalSum(sum[b]);
+}
+
+} // anonymous namespace
+
+namespace learning {
+
+QuantizedPerceptron::QuantizedPerceptron(const MultiLayerPerceptron& mlp) :
+    num_input_(mlp.numInput()),
+    num_hidden_(mlp.numHidden()),
+    num_output_(mlp.numOutput()),
+    input_stride_((mlp.numInput() + INPUT_ALIGNMENT - 1) / INPUT_ALIGNMENT * INPUT_ALIGNMENT),
+    w2_(num_hidden_ * input_stride_),
+    w2_scale_(num_hidden_),
+    b2_(num_hidden_),
+    w3_(mlp.outputLayerParameter(), mlp.outputLayerParameter() + (num_hidden_ + 1) * num_output_)
+{
+    const float* w2 = mlp.hiddenLayerParameter();
+    for (int i = 0; i < num_hidden_; ++i) {
+        float max_abs = 0;
+        for (int j = 0; j < num_input_; ++j)
+            max_abs = std::max(max_abs, std::abs(w2[j * num_hidden_ + i]));
+
+        const float scale = max_abs > 0 ? max_abs / 127 : 1;
+        for (int j = 0; j < num_input_; ++j) {
+            int q = static_cast<int>(std::round(w2[j * num_hidden_ + i] / scale));
+            w2_[i * input_stride_ + j] = static_cast<std::int8_t>(std::max(-127, std::min(127, q)));
+        }
+        w2_scale_[i] = scale;
+        b2_[i] = w2[num_input_ * num_hidden_ + i];
+    }
+}
+
+void QuantizedPerceptron::forward(const std::uint8_t inputs[], int batch_size, float outputs[]) const
+{
+    std::vector<int> dots(BLOCK_SIZE * num_hidden_);
+    std::vector<float> hidden(num_hidden_);
+
+    for (int begin = 0; begin < batch_size; begin += BLOCK_SIZE) {
+        const int n = std::min(BLOCK_SIZE, batch_size - begin);
+
+        // The missing inputs of the last block are filled with the first input of the block,
+        // and their results are thrown away.
+        const std::uint8_t* x[BLOCK_SIZE];
+        for (int b = 0; b < BLOCK_SIZE; ++b)
+            x[b] = inputs + static_cast<size_t>(begin + (b < n ? b : 0)) * input_stride_;
+
+        for (int i = 0; i < num_hidden_; ++i) {
+            int result[BLOCK_SIZE];
+            dotBlock(&w2_[i * input_stride_], x, input_stride_, result);
+            for (int b = 0; b < BLOCK_SIZE; ++b)
+                dots[b * num_hidden_ + i] = result[b];
+        }
+
+        for (int b = 0; b < n; ++b) {
+            for (int i = 0; i < num_hidden_; ++i)
+                hidden[i] = std::tanh(dots[b * num_hidden_ + i] * w2_scale_[i] + b2_[i]);
+
+            float* out = outputs + static_cast<size_t>(begin + b) * num_output_;
+            // The bias of the output layer.
+            std::copy(&w3_[num_hidden_ * num_output_], &w3_[num_hidden_ * num_output_] + num_output_, out);
+            for (int i = 0; i < num_hidden_; ++i) {
+                for (int j = 0; j < num_output_; ++j)
+                    out[j] += w3_[i * num_output_ + j] * hidden[i];
+            }
+        }
+    }
+}
+
+} // namespace learning
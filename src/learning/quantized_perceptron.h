@@ -0,0 +1,47 @@
+#ifndef LEARNING_QUANTIZED_PERCEPTRON_H_
+#define LEARNING_QUANTIZED_PERCEPTRON_H_
+
+#include <cstdint>
+#include <vector>
+
+namespace learning {
+
+class MultiLayerPerceptron;
+
+// QuantizedPerceptron is an inference engine of MultiLayerPerceptron for a batch of inputs.
+// The hidden layer weights are quantized to int8 with a scale for each hidden neuron,
+// and stored transposed, so that a hidden neuron is a dot product of two byte vectors.
+// The inputs are uint8 in [0, 127], e.g. bits of FieldBits.
+//
+// This is immutable after construction, so this is thread-safe.
+class QuantizedPerceptron {
+public:
+    explicit QuantizedPerceptron(const MultiLayerPerceptron&);
+
+    int numInput() const { return num_input_; }
+    int numHidden() const { return num_hidden_; }
+    int numOutput() const { return num_output_; }
+
+    // The number of bytes of one input. The bytes after numInput() must be 0.
+    int inputStride() const { return input_stride_; }
+
+    // Calculates the output layer of |batch_size| inputs.
+    // |inputs| should have |batch_size| * inputStride() bytes, and
+    // |outputs| should have |batch_size| * numOutput() values.
+    void forward(const std::uint8_t inputs[], int batch_size, float outputs[]) const;
+
+private:
+    const int num_input_;
+    const int num_hidden_;
+    const int num_output_;
+    const int input_stride_;
+
+    std::vector<std::int8_t> w2_;   // [num_hidden_][input_stride_]
+    std::vector<float> w2_scale_;   // [num_hidden_]
+    std::vector<float> b2_;         // [num_hidden_]
+    std::vector<float> w3_;         // [num_hidden_ + 1][num_output_], the same as MultiLayerPerceptron.
+};
+
+} // namespace learning
+
+#endif // LEARNING_QUANTIZED_PERCEPTRON_H_
@@ -34,6 +34,8 @@ public:
 
     EndlessResult run(const KumipuyoSeq&);
 
+    AI* ai() const { return ai_.get(); }
+
     // Sets verbose mode. This will show fields in each hand.
     void setVerbose(bool flag) { verbose_ = flag; }
 
@@ -0,0 +1,165 @@
+#include "solver/endless_batch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <sstream>
+
+#include <glog/logging.h>
+
+#include "base/executor.h"
+#include "base/wait_group.h"
+#include "core/kumipuyo_seq_generator.h"
+
+using namespace std;
+
+void RunResult::add(int seed, const EndlessResult& result)
+{
+    if (result.zenkeshi && result.hand < 8) {
+        numZenkeshi++;
+        return;
+    }
+
+    int score = result.score;
+    sumScore += score;
+    scores.push_back(make_pair(score, seed));
+    if (score >= 10000) {
+        mainRensaCount++;
+        sumMainRensaScore += score;
+    }
+    if (score >= 40000) { over40000Count++; }
+    if (score >= 60000) { over60000Count++; }
+    if (score >= 70000) { over70000Count++; }
+    if (score >= 80000) { over80000Count++; }
+    if (score >= 100000) { over100000Count++; }
+    if (result.maxRensa >= 13) { overRensa13Count++; }
+    if (result.maxRensa >= 14) { overRensa14Count++; }
+    if (result.maxRensa >= 15) { overRensa15Count++; }
+}
+
+void RunResult::merge(const RunResult& other)
+{
+    numZenkeshi += other.numZenkeshi;
+    sumScore += other.sumScore;
+    sumMainRensaScore += other.sumMainRensaScore;
+    mainRensaCount += other.mainRensaCount;
+    over40000Count += other.over40000Count;
+    over60000Count += other.over60000Count;
+    over70000Count += other.over70000Count;
+    over80000Count += other.over80000Count;
+    over100000Count += other.over100000Count;
+    overRensa13Count += other.overRensa13Count;
+    overRensa14Count += other.overRensa14Count;
+    overRensa15Count += other.overRensa15Count;
+    scores.insert(scores.end(), other.scores.begin(), other.scores.end());
+}
+
+double RunResult::meanScore() const
+{
+    if (scores.empty())
+        return 0.0;
+    return static_cast<double>(sumScore) / scores.size();
+}
+
+int RunResult::medianScore() const
+{
+    if (scores.empty())
+        return 0;
+
+    vector<pair<int, int>> sorted(scores);
+    nth_element(sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+    return sorted[sorted.size() / 2].first;
+}
+
+double RunResult::scoreDeviation() const
+{
+    if (scores.size() < 2)
+        return 0.0;
+
+    double mean = meanScore();
+    double variance = 0.0;
+    for (const auto& s : scores)
+        variance += (s.first - mean) * (s.first - mean);
+    return sqrt(variance / (scores.size() - 1));
+}
+
+string RunResult::toString() const
+{
+    int n = size();
+
+    stringstream ss;
+    ss << "zenkeshi   = " << numZenkeshi << endl;
+    ss << "sum score  = " << sumScore << endl;
+    ss << "ave score  = " << static_cast<int>(meanScore()) << endl;
+    ss << "median     = " << medianScore() << endl;
+    ss << "deviation  = " << scoreDeviation() << endl;
+    ss << "main rensa = " << mainRensaCount << endl;
+    ss << "main rensa % = " << (n > 0 ? 100.0 * mainRensaCount / n : 0.0) << endl;
+    ss << "ave main rensa = " << aveMainRensaScore() << endl;
+    ss << "over  40000 = " << over40000Count << endl;
+    ss << "over  60000 = " << over60000Count << endl;
+    ss << "over  70000 = " << over70000Count << endl;
+    ss << "over  80000 = " << over80000Count << endl;
+    ss << "over 100000 = " << over100000Count << endl;
+    ss << "over 13 chn = " << overRensa13Count << endl;
+    ss << "over 14 chn = " << overRensa14Count << endl;
+    ss << "over 15 chn = " << overRensa15Count << endl;
+    if (n >= 10) {
+        vector<pair<int, int>> sorted(scores);
+        partial_sort(sorted.begin(), sorted.begin() + 5, sorted.end());
+        for (int i = 0; i < 5; ++i)
+            ss << "  seed " << sorted[i].second << " -> " << sorted[i].first << endl;
+    }
+    return ss.str();
+}
+
+EndlessBatch::EndlessBatch(Executor* executor, AIFactory factory, int numShards) :
+    executor_(executor),
+    factory_(std::move(factory))
+{
+    CHECK(executor_);
+    CHECK(factory_);
+
+    if (numShards <= 0)
+        numShards = max(1, executor_->numThreads());
+    endlesses_.resize(numShards);
+}
+
+EndlessBatch::~EndlessBatch()
+{
+}
+
+RunResult EndlessBatch::run(int offset, int size, const AIPreparer& preparer, const ResultCallback& callback)
+{
+    RunResult runResult;
+    mutex mu;
+
+    const int numShards = min(this->numShards(), size);
+
+    WaitGroup wg;
+    wg.add(numShards);
+    for (int shard = 0; shard < numShards; ++shard) {
+        executor_->submit([&, shard]() {
+            unique_ptr<Endless>& endless = endlesses_[shard];
+            if (!endless)
+                endless.reset(new Endless(factory_()));
+            if (preparer)
+                preparer(endless->ai());
+
+            for (int i = shard; i < size; i += numShards) {
+                int seed = offset + i;
+                KumipuyoSeq seq = KumipuyoSeqGenerator::generateACPuyo2SequenceWithSeed(seed);
+                EndlessResult result = endless->run(seq);
+
+                lock_guard<mutex> lock(mu);
+                runResult.add(seed, result);
+                if (callback)
+                    callback(seed, result);
+            }
+            wg.done();
+        });
+    }
+    wg.waitUntilDone();
+
+    return runResult;
+}
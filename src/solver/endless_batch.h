@@ -0,0 +1,84 @@
+#ifndef SOLVER_ENDLESS_BATCH_H_
+#define SOLVER_ENDLESS_BATCH_H_
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/noncopyable.h"
+#include "solver/endless.h"
+
+class Executor;
+
+// RunResult is the aggregated statistics of endless results.
+// EndlessResults are streamed into this with add() while a batch is running.
+struct RunResult {
+    void add(int seed, const EndlessResult&);
+    // Merges the result of another batch (e.g. another shard or another process).
+    void merge(const RunResult&);
+
+    int size() const { return static_cast<int>(scores.size()); }
+    double meanScore() const;
+    int medianScore() const;
+    double scoreDeviation() const;
+    int aveMainRensaScore() const { return mainRensaCount > 0 ? sumMainRensaScore / mainRensaCount : 0; }
+
+    int resultScore() const {
+        return mainRensaCount * 20 + over60000Count * 6 + over70000Count + over80000Count;
+    }
+
+    std::string toString() const;
+
+    int numZenkeshi = 0;
+    int sumScore = 0;
+    int sumMainRensaScore = 0;
+    int mainRensaCount = 0;
+    int over40000Count = 0;
+    int over60000Count = 0;
+    int over70000Count = 0;
+    int over80000Count = 0;
+    int over100000Count = 0;
+    int overRensa13Count = 0;
+    int overRensa14Count = 0;
+    int overRensa15Count = 0;
+
+    // (score, seed) of each case except early zenkeshi.
+    std::vector<std::pair<int, int>> scores;
+};
+
+// EndlessBatch runs Endless for a lot of KumipuyoSeqGenerator seeds in parallel.
+//
+// Seeds are sharded deterministically: the i-th seed of a run always goes to
+// the shard (i % numShards), and each shard runs its seeds in order on one task.
+// The AI of each shard is created once with the factory, and reused across seeds
+// and across runs, so books and features are loaded only numShards times.
+// AI::gameWillBegin() resets the per-game state for each seed.
+class EndlessBatch : noncopyable {
+public:
+    typedef std::function<std::unique_ptr<AI> ()> AIFactory;
+    // Called for each shard's AI before the shard runs its first seed of a run.
+    // Use this to update the AI configuration (e.g. parameters) between runs.
+    typedef std::function<void (AI*)> AIPreparer;
+    // Called for each finished case. Calls are serialized.
+    typedef std::function<void (int seed, const EndlessResult&)> ResultCallback;
+
+    // If numShards <= 0, the number of threads of |executor| is used.
+    EndlessBatch(Executor* executor, AIFactory factory, int numShards = 0);
+    ~EndlessBatch();
+
+    int numShards() const { return static_cast<int>(endlesses_.size()); }
+
+    // Runs the seeds [offset, offset + size), and returns the aggregated result.
+    RunResult run(int offset, int size,
+                  const AIPreparer& preparer = AIPreparer(),
+                  const ResultCallback& callback = ResultCallback());
+
+private:
+    Executor* executor_;
+    AIFactory factory_;
+    std::vector<std::unique_ptr<Endless>> endlesses_;
+};
+
+#endif // SOLVER_ENDLESS_BATCH_H_
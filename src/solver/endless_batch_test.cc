@@ -0,0 +1,249 @@
+#include "solver/endless_batch.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "base/executor.h"
+#include "core/core_field.h"
+#include "core/kumipuyo_seq.h"
+#include "core/kumipuyo_seq_generator.h"
+#include "core/rensa_result.h"
+
+using namespace std;
+
+namespace {
+
+// Fires the largest rensa it can make with the current kumipuyo, and otherwise
+// fills the columns in turn. Records the kumipuyos of each game it played.
+class TestAI : public AI {
+public:
+    TestAI() : AI("test") {}
+
+    const vector<vector<Kumipuyo>>& games() const { return games_; }
+
+protected:
+    void onGameWillBegin(const FrameRequest&) override { games_.emplace_back(); }
+
+    DropDecision think(int, const CoreField& field, const KumipuyoSeq& seq,
+                       const PlayerState&, const PlayerState&, bool) const override
+    {
+        vector<Kumipuyo>& game = games_.back();
+        Decision best(game.size() % 6 + 1, 0);
+        game.push_back(seq.front());
+
+        int bestScore = 0;
+        for (int x = 1; x <= 6; ++x) {
+            for (int r = 0; r < 4; ++r) {
+                Decision d(x, r);
+                CoreField f(field);
+                if (!d.isValid() || !f.dropKumipuyo(d, seq.front()))
+                    continue;
+                int score = f.simulate().score;
+                if (score > bestScore) {
+                    best = d;
+                    bestScore = score;
+                }
+            }
+        }
+        return DropDecision(best);
+    }
+
+private:
+    mutable vector<vector<Kumipuyo>> games_;
+};
+
+vector<Kumipuyo> prefix(int seed, size_t size)
+{
+    KumipuyoSeq seq = KumipuyoSeqGenerator::generateACPuyo2SequenceWithSeed(seed);
+    vector<Kumipuyo> result;
+    for (size_t i = 0; i < size; ++i)
+        result.push_back(seq.get(i));
+    return result;
+}
+
+EndlessResult makeResult(int hand, int score, int maxRensa, bool zenkeshi)
+{
+    EndlessResult result;
+    result.hand = hand;
+    result.score = score;
+    result.maxRensa = maxRensa;
+    result.zenkeshi = zenkeshi;
+    result.type = EndlessResult::Type::MAIN_CHAIN;
+    return result;
+}
+
+}
+
+class EndlessBatchTest : public testing::Test {
+protected:
+    void SetUp() override
+    {
+        executor_.reset(new Executor(3));
+        executor_->start();
+    }
+
+    void TearDown() override
+    {
+        executor_->stop();
+    }
+
+    EndlessBatch::AIFactory factory()
+    {
+        return [this]() {
+            unique_ptr<TestAI> ai(new TestAI);
+            lock_guard<mutex> lock(mu_);
+            ais_.push_back(ai.get());
+            return unique_ptr<AI>(std::move(ai));
+        };
+    }
+
+    unique_ptr<Executor> executor_;
+    mutex mu_;
+    vector<TestAI*> ais_;
+};
+
+TEST_F(EndlessBatchTest, shardsBySeedIndex)
+{
+    const int numShards = 3;
+    const int offset = 100;
+    const int size = 10;
+    EndlessBatch batch(executor_.get(), factory(), numShards);
+    EXPECT_EQ(numShards, batch.numShards());
+
+    // Each shard's AI is prepared once per run, and reused in the second run.
+    map<AI*, int> numPrepared;
+    mutex mu;
+    auto preparer = [&](AI* ai) {
+        lock_guard<mutex> lock(mu);
+        ++numPrepared[ai];
+    };
+    batch.run(offset, size, preparer);
+    batch.run(offset, size, preparer);
+    ASSERT_EQ(static_cast<size_t>(numShards), ais_.size());
+    ASSERT_EQ(static_cast<size_t>(numShards), numPrepared.size());
+
+    for (TestAI* ai : ais_) {
+        EXPECT_EQ(2, numPrepared[ai]);
+
+        // The i-th seed goes to the shard (i % numShards), and each shard runs its
+        // seeds in order. Find the shard of this AI from its first game.
+        const vector<vector<Kumipuyo>>& games = ai->games();
+        ASSERT_FALSE(games.empty());
+        int shard = -1;
+        for (int s = 0; s < numShards; ++s) {
+            if (games[0] == prefix(offset + s, games[0].size()))
+                shard = s;
+        }
+        ASSERT_NE(-1, shard);
+
+        vector<int> expectedSeeds;
+        for (int run = 0; run < 2; ++run) {
+            for (int i = shard; i < size; i += numShards)
+                expectedSeeds.push_back(offset + i);
+        }
+        ASSERT_EQ(expectedSeeds.size(), games.size()) << "shard " << shard;
+        for (size_t i = 0; i < games.size(); ++i) {
+            ASSERT_LE(10U, games[i].size());
+            EXPECT_EQ(prefix(expectedSeeds[i], games[i].size()), games[i]) << "shard " << shard << " game " << i;
+        }
+    }
+}
+
+TEST_F(EndlessBatchTest, sameAsSingleThread)
+{
+    const int offset = 0;
+    const int size = 12;
+
+    map<int, EndlessResult> results;
+    RunResult expected;
+    {
+        Endless endless(unique_ptr<AI>(new TestAI));
+        for (int seed = offset; seed < offset + size; ++seed) {
+            EndlessResult result = endless.run(KumipuyoSeqGenerator::generateACPuyo2SequenceWithSeed(seed));
+            results.emplace(seed, result);
+            expected.add(seed, result);
+        }
+    }
+
+    EndlessBatch batch(executor_.get(), factory(), 4);
+    map<int, EndlessResult> batchResults;
+    RunResult actual = batch.run(offset, size, EndlessBatch::AIPreparer(), [&](int seed, const EndlessResult& result) {
+        EXPECT_TRUE(batchResults.emplace(seed, result).second) << seed;
+    });
+
+    ASSERT_EQ(results.size(), batchResults.size());
+    for (const auto& entry : results) {
+        const EndlessResult& r = entry.second;
+        const EndlessResult& b = batchResults[entry.first];
+        EXPECT_EQ(r.hand, b.hand) << entry.first;
+        EXPECT_EQ(r.score, b.score) << entry.first;
+        EXPECT_EQ(r.maxRensa, b.maxRensa) << entry.first;
+        EXPECT_EQ(r.decisions, b.decisions) << entry.first;
+    }
+
+    // The order of the scores depends on the timing of the shards.
+    sort(expected.scores.begin(), expected.scores.end());
+    sort(actual.scores.begin(), actual.scores.end());
+    EXPECT_EQ(expected.scores, actual.scores);
+    EXPECT_EQ(expected.toString(), actual.toString());
+}
+
+TEST(RunResultTest, add)
+{
+    RunResult result;
+    result.add(1, makeResult(5, 3000, 3, true));    // early zenkeshi
+    result.add(2, makeResult(20, 8000, 6, true));
+    result.add(3, makeResult(30, 45000, 11, false));
+    result.add(4, makeResult(40, 72000, 13, false));
+    result.add(5, makeResult(45, 105000, 15, false));
+
+    EXPECT_EQ(1, result.numZenkeshi);
+    EXPECT_EQ(4, result.size());
+    EXPECT_EQ(8000 + 45000 + 72000 + 105000, result.sumScore);
+    EXPECT_EQ(3, result.mainRensaCount);
+    EXPECT_EQ((45000 + 72000 + 105000) / 3, result.aveMainRensaScore());
+    EXPECT_EQ(3, result.over40000Count);
+    EXPECT_EQ(2, result.over60000Count);
+    EXPECT_EQ(2, result.over70000Count);
+    EXPECT_EQ(1, result.over80000Count);
+    EXPECT_EQ(1, result.over100000Count);
+    EXPECT_EQ(2, result.overRensa13Count);
+    EXPECT_EQ(1, result.overRensa14Count);
+    EXPECT_EQ(1, result.overRensa15Count);
+    EXPECT_DOUBLE_EQ(57500.0, result.meanScore());
+    EXPECT_EQ(72000, result.medianScore());
+    EXPECT_EQ((vector<pair<int, int>> { { 8000, 2 }, { 45000, 3 }, { 72000, 4 }, { 105000, 5 } }), result.scores);
+}
+
+TEST(RunResultTest, merge)
+{
+    vector<EndlessResult> results {
+        makeResult(6, 2000, 2, true),
+        makeResult(30, 12000, 8, false),
+        makeResult(35, 65000, 13, false),
+        makeResult(50, 0, 0, false),
+        makeResult(42, 90000, 14, false),
+    };
+
+    RunResult all;
+    RunResult shards[2];
+    for (size_t i = 0; i < results.size(); ++i) {
+        all.add(i, results[i]);
+        shards[i % 2].add(i, results[i]);
+    }
+
+    RunResult merged;
+    merged.merge(shards[0]);
+    merged.merge(shards[1]);
+
+    sort(all.scores.begin(), all.scores.end());
+    sort(merged.scores.begin(), merged.scores.end());
+    EXPECT_EQ(all.scores, merged.scores);
+    EXPECT_EQ(all.toString(), merged.toString());
+    EXPECT_DOUBLE_EQ(all.scoreDeviation(), merged.scoreDeviation());
+}
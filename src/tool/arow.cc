@@ -1,310 +1,406 @@
 #include <algorithm>
-#include <fstream>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <numeric>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gflags/gflags.h>
 #include <glog/logging.h>
-#include <gtest/gtest.h>
 #include <SDL_image.h>
 
 #include "base/base.h"
+#include "base/executor.h"
 #include "base/strings.h"
+#include "base/wait_group.h"
 #include "capture/color.h"
 #include "capture/recognition/recognition_color.h"
+#include "capture/recognition/recognizer_model.h"
 #include "core/real_color.h"
 #include "gui/unique_sdl_surface.h"
 #include "gui/util.h"
 #include "learning/arow.h"
 #include "learning/multi_layer_perceptron.h"
 
+DECLARE_int32(num_threads);
 DECLARE_string(testdata_dir);
 
 DEFINE_bool(cross_validation, true, "use cross validation");
+DEFINE_string(model, "arow", "the model to train: arow or mlp");
+DEFINE_int32(epochs, 500, "the number of passes over the training examples");
+DEFINE_int32(batch_size, 32, "the size of a mini-batch (mlp)");
+DEFINE_double(learning_rate, 0.01, "the learning rate per example (mlp)");
+DEFINE_int32(chunk_size, 1 << 16,
+             "the number of examples shuffled in memory at once. "
+             "When the corpus fits in a chunk, the images are read only once.");
+DEFINE_string(output, "", "the output filename. The default depends on --model.");
 
 using namespace std;
 
-const char* COLOR_NAMES[] = {
-    "RED", "BLUE", "YELLOW", "GREEN", "PURPLE", "EMPTY", "OJAMA", "ZENKESHI"
+namespace {
+
+const char* IMAGE_NAMES[] = {
+    "red", "blue", "yellow", "green", "purple", "empty", "ojama", "zenkeshi"
 };
 
 const int IMAGE_WIDTH = 16;
 const int IMAGE_HEIGHT = 16;
 
-bool readFeatures(vector<vector<float>> features[NUM_RECOGNITION])
+// Which part of the images is learned, and which labels.
+struct ModelConfig {
+    int xBegin;
+    int xEnd;
+    int numLabels;
+    const char* prefix;
+    const char* filename;
+
+    int inputSize() const { return (xEnd - xBegin) * IMAGE_HEIGHT * 3; }
+};
+
+// The model Recognizer loads. Copy it to <--data_dir>/recognition/ to use it.
+const ModelConfig AROW_CONFIG { 0, IMAGE_WIDTH, NUM_RECOGNITION, "", "recognizer.model" };
+const ModelConfig MLP_CONFIG { 0, 8, 6, "LEFT", "left_parameter.cc" };
+// The default L2 normalization of MultiLayerPerceptron::train().
+const float MLP_L2_NORMALIZATION = 0.001;
+// The number of examples converted to features at once for Arow.
+const size_t AROW_BATCH_SIZE = 1024;
+// The default of --num_threads for this tool.
+const char DEFAULT_NUM_THREADS[] = "4";
+
+// An example keeps the raw RGB values of a patch, 3 bytes per pixel, to keep a chunk
+// small. They are converted to the features with toFeatures() when a batch is built.
+struct Example {
+    int label;
+    vector<std::uint8_t> pixels;
+};
+
+// Each feature is an RGB value scaled to [0, 1].
+template<typename T>
+void toFeatures(const Example& e, T* features)
 {
-    const pair<string, RecognitionColor> training_testcases[] = {
-        make_pair((FLAGS_testdata_dir + "/images/puyo/red.png"), RecognitionColor::RED),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/blue.png"), RecognitionColor::BLUE),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/yellow.png"), RecognitionColor::YELLOW),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/green.png"), RecognitionColor::GREEN),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/purple.png"), RecognitionColor::PURPLE),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/empty.png"), RecognitionColor::EMPTY),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/ojama.png"), RecognitionColor::OJAMA),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/zenkeshi.png"), RecognitionColor::ZENKESHI),
-
-        make_pair((FLAGS_testdata_dir + "/images/puyo/red-blur.png"), RecognitionColor::RED),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/blue-blur.png"), RecognitionColor::BLUE),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/yellow-blur.png"), RecognitionColor::YELLOW),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/green-blur.png"), RecognitionColor::GREEN),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/purple-blur.png"), RecognitionColor::PURPLE),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/empty-blur.png"), RecognitionColor::EMPTY),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/ojama-blur.png"), RecognitionColor::OJAMA),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/zenkeshi-blur.png"), RecognitionColor::ZENKESHI),
-
-        make_pair((FLAGS_testdata_dir + "/images/puyo/red-actual.png"), RecognitionColor::RED),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/blue-actual.png"), RecognitionColor::BLUE),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/yellow-actual.png"), RecognitionColor::YELLOW),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/green-actual.png"), RecognitionColor::GREEN),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/purple-actual.png"), RecognitionColor::PURPLE),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/empty-actual.png"), RecognitionColor::EMPTY),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/ojama-actual.png"), RecognitionColor::OJAMA),
-        make_pair((FLAGS_testdata_dir + "/images/puyo/zenkeshi-actual.png"), RecognitionColor::ZENKESHI),
-    };
-
-    // Read training testcases.
-    for (const auto& testcase: training_testcases) {
-        const string& filename = testcase.first;
-        const RecognitionColor color = testcase.second;
-
-        cout << "Opening... " << filename << endl;
-        UniqueSDLSurface surf(makeUniqueSDLSurface(IMG_Load(filename.c_str())));
-        CHECK(surf.get());
-
-        for (int x = 0; (x + 1) * IMAGE_WIDTH <= surf->w; ++x) {
-            for (int y = 0; (y + 1) * IMAGE_HEIGHT <= surf->h; ++y) {
-                int pos = 0;
-                vector<float> fs(IMAGE_WIDTH * IMAGE_HEIGHT * 3);
-                for (int yy = 0; yy < IMAGE_HEIGHT; ++yy) {
-                    for (int xx = 0; xx < IMAGE_WIDTH; ++xx) {
-                        std::uint32_t c = getpixel(surf.get(), x * IMAGE_WIDTH + xx, y * IMAGE_HEIGHT + yy);
-                        std::uint8_t r, g, b;
-                        SDL_GetRGB(c, surf->format, &r, &g, &b);
-                        fs[pos++] = r / 255.0;
-                        fs[pos++] = g / 255.0;
-                        fs[pos++] = b / 255.0;
-                    }
-                }
+    for (size_t i = 0; i < e.pixels.size(); ++i)
+        features[i] = static_cast<T>(e.pixels[i] / 255.0);
+}
 
-                CHECK(pos == IMAGE_WIDTH * IMAGE_HEIGHT * 3);
-                features[static_cast<int>(color)].push_back(std::move(fs));
-            }
+// ExampleStream reads the examples from the image corpus, and passes them in shuffled
+// chunks of about |chunkSize| examples, so that the whole corpus doesn't need to be
+// in memory. Every 16th patch of each image is held out for testing when
+// --cross_validation is set.
+class ExampleStream {
+public:
+    enum class Split { TRAINING, TESTING };
+
+    ExampleStream(const ModelConfig& config, vector<pair<string, RecognitionColor>> files, size_t chunkSize) :
+        config_(config), files_(std::move(files)), chunkSize_(chunkSize) {}
+
+    void forEachChunk(Split, mt19937*, const function<void (const vector<Example>&)>&);
+
+private:
+    void readImage(const pair<string, RecognitionColor>&, Split, vector<Example>*) const;
+
+    const ModelConfig config_;
+    const vector<pair<string, RecognitionColor>> files_;
+    const size_t chunkSize_;
+
+    // When all the examples of a split fit in one chunk, they are kept here.
+    bool cached_[2] {};
+    vector<Example> cache_[2];
+};
+
+void ExampleStream::forEachChunk(Split split, mt19937* rnd, const function<void (const vector<Example>&)>& callback)
+{
+    const int index = static_cast<int>(split);
+    if (cached_[index]) {
+        shuffle(cache_[index].begin(), cache_[index].end(), *rnd);
+        callback(cache_[index]);
+        return;
+    }
+
+    vector<size_t> order(files_.size());
+    iota(order.begin(), order.end(), 0);
+    shuffle(order.begin(), order.end(), *rnd);
+
+    int numChunks = 0;
+    vector<Example> chunk;
+    for (size_t i : order) {
+        readImage(files_[i], split, &chunk);
+        if (chunk.size() >= chunkSize_) {
+            shuffle(chunk.begin(), chunk.end(), *rnd);
+            callback(chunk);
+            chunk.clear();
+            ++numChunks;
         }
     }
 
-    for (int i = 0; i < NUM_RECOGNITION; ++i) {
-        const auto& f = features[i];
-        cout << "SIZE = " << f.size() << endl;
+    if (chunk.empty())
+        return;
+
+    shuffle(chunk.begin(), chunk.end(), *rnd);
+    callback(chunk);
+    if (numChunks == 0) {
+        cache_[index] = std::move(chunk);
+        cached_[index] = true;
     }
+}
 
-    return true;
+void ExampleStream::readImage(const pair<string, RecognitionColor>& file, Split split, vector<Example>* examples) const
+{
+    const string& filename = file.first;
+    const int label = static_cast<int>(file.second);
+    if (label >= config_.numLabels)
+        return;
+
+    UniqueSDLSurface surf(makeUniqueSDLSurface(IMG_Load(filename.c_str())));
+    CHECK(surf.get()) << "failed to open " << filename;
+
+    int patchIndex = 0;
+    for (int x = 0; (x + 1) * IMAGE_WIDTH <= surf->w; ++x) {
+        for (int y = 0; (y + 1) * IMAGE_HEIGHT <= surf->h; ++y, ++patchIndex) {
+            const bool testing = FLAGS_cross_validation && (patchIndex & 0xF) == 0;
+            if (FLAGS_cross_validation && testing != (split == Split::TESTING))
+                continue;
+
+            Example example { label, vector<std::uint8_t>(config_.inputSize()) };
+            int pos = 0;
+            for (int yy = 0; yy < IMAGE_HEIGHT; ++yy) {
+                for (int xx = config_.xBegin; xx < config_.xEnd; ++xx) {
+                    std::uint32_t c = getpixel(surf.get(), x * IMAGE_WIDTH + xx, y * IMAGE_HEIGHT + yy);
+                    std::uint8_t r, g, b;
+                    SDL_GetRGB(c, surf->format, &r, &g, &b);
+                    example.pixels[pos++] = r;
+                    example.pixels[pos++] = g;
+                    example.pixels[pos++] = b;
+                }
+            }
+            CHECK_EQ(config_.inputSize(), pos);
+            examples->push_back(std::move(example));
+        }
+    }
 }
 
-int main(int argc, char* argv[])
+vector<pair<string, RecognitionColor>> corpusFiles()
 {
-    google::ParseCommandLineFlags(&argc, &argv, true);
-    google::InitGoogleLogging(argv[0]);
+    vector<pair<string, RecognitionColor>> files;
+    for (const char* suffix : { "", "-blur", "-actual" }) {
+        for (int i = 0; i < NUM_RECOGNITION; ++i) {
+            string filename = FLAGS_testdata_dir + "/images/puyo/" + IMAGE_NAMES[i] + suffix + ".png";
+            files.push_back(make_pair(filename, static_cast<RecognitionColor>(i)));
+        }
+    }
+    return files;
+}
 
-    vector<vector<float>> features[NUM_RECOGNITION];
-    CHECK(readFeatures(features));
-
-#if 0
-    const int LEARNING_X_BEGIN = 0;
-    const int LEARNING_X_END = 16;
-    const int LEARNING_WIDTH = LEARNING_X_END - LEARNING_X_BEGIN;
-    const int LEARNING_HEIGHT = IMAGE_HEIGHT;
-
-    const char COLOR_NAME_PREFIX[] = "";
-    const int RECOGNITION_SIZE = 8;
-#endif
-
-#if 1
-    const int LEARNING_X_BEGIN = 0;
-    const int LEARNING_X_END = 8;
-    const int LEARNING_WIDTH = LEARNING_X_END - LEARNING_X_BEGIN;
-    const int LEARNING_HEIGHT = IMAGE_HEIGHT;
-
-    const char COLOR_NAME_PREFIX[] = "LEFT";
-    const int RECOGNITION_SIZE = 6;
-    const char PARAMETER_FILENAME[] = "left_parameter.cc";
-#endif
-
-#if 0
-    const int LEARNING_X_BEGIN = 8;
-    const int LEARNING_X_END = 16;
-    const int LEARNING_WIDTH = LEARNING_X_END - LEARNING_X_BEGIN;
-    const int LEARNING_HEIGHT = IMAGE_HEIGHT;
-
-    const char COLOR_NAME_PREFIX[] = "RIGHT";
-    const int RECOGNITION_SIZE = 6;
-    const char PARAMETER_FILENAME[] = "right_parameter.cc";
-#endif
-
-#if 0
-    unique_ptr<Arow> arows[RECOGNITION_SIZE];
-    for (int i = 0; i < RECOGNITION_SIZE; ++i) {
-        arows[i].reset(new Arow(LEARNING_WIDTH * LEARNING_HEIGHT * 3));
+// Trains one-vs-rest Arows. Since each Arow learns independently, the classifiers are
+// trained in parallel, and the result is the same as the single-threaded training.
+class ArowTrainer {
+public:
+    explicit ArowTrainer(const ModelConfig& config)
+    {
+        for (int i = 0; i < config.numLabels; ++i)
+            arows_.emplace_back(config.inputSize());
     }
-#endif
-
-    vector<pair<int, vector<float>>> training_features;
-    vector<pair<int, vector<float>>> testing_features;
-
-    if (FLAGS_cross_validation) {
-        for (int i = 0; i < RECOGNITION_SIZE; ++i) {
-            for (size_t j = 0; j < features[i].size(); ++j) {
-                if ((j & 0xF) == 0) {
-                    testing_features.push_back(make_pair(i, features[i][j]));
-                } else {
-                    training_features.push_back(make_pair(i, features[i][j]));
-                }
+
+    // Returns the number of the binary mistakes.
+    int train(const vector<Example>& examples, Executor* executor)
+    {
+        vector<int> losses(arows_.size());
+        for (size_t begin = 0; begin < examples.size(); begin += AROW_BATCH_SIZE) {
+            const size_t n = min(AROW_BATCH_SIZE, examples.size() - begin);
+            features_.resize(n);
+            for (size_t k = 0; k < n; ++k) {
+                features_[k].resize(examples[begin + k].pixels.size());
+                toFeatures(examples[begin + k], features_[k].data());
             }
-    }
-    } else {
-        for (int i = 0; i < RECOGNITION_SIZE; ++i) {
-            for (size_t j = 0; j < features[i].size(); ++j) {
-                testing_features.push_back(make_pair(i, features[i][j]));
-                training_features.push_back(make_pair(i, features[i][j]));
+
+            WaitGroup wg;
+            wg.add(arows_.size());
+            for (size_t i = 0; i < arows_.size(); ++i) {
+                executor->submit([&, i]() {
+                    for (size_t k = 0; k < n; ++k) {
+                        int label = static_cast<int>(i) == examples[begin + k].label ? 1 : -1;
+                        losses[i] += arows_[i].update(features_[k], label);
+                    }
+                    wg.done();
+                });
             }
+            wg.waitUntilDone();
         }
+        return accumulate(losses.begin(), losses.end(), 0);
     }
 
-    learning::MultiLayerPerceptron mlp(LEARNING_WIDTH * LEARNING_HEIGHT * 3, 20, RECOGNITION_SIZE);
-    auto data = mlp.makeForwadingStorage();
-    auto error_data = mlp.makeBackpropagationStorage();
+    int predict(const Example& e)
+    {
+        features_.resize(1);
+        features_[0].resize(e.pixels.size());
+        toFeatures(e, features_[0].data());
+
+        vector<double> margins;
+        for (const auto& arow : arows_)
+            margins.push_back(arow.margin(features_[0]));
+        return max_element(margins.begin(), margins.end()) - margins.begin();
+    }
 
-    // training
-    std::random_device rd;
-    std::mt19937 random_generator(rd());
-    for (int times = 0; times < 500; ++times) {
-        float rate;
-        if (times >= 400) {
-            rate = 0.001;
-        } else if (times >= 300) {
-            rate = 0.005;
-        } else {
-            rate = 0.01;
-        }
+    bool save(const string& filename, const ModelConfig& config) const;
 
-        std::shuffle(training_features.begin(), training_features.end(), random_generator);
+private:
+    vector<Arow> arows_;
+    vector<vector<double>> features_;
+};
 
-        int num_correct = 0;
-        for (const auto& f : training_features) {
-#if 0
-            for (int i = 0; i < RECOGNITION_SIZE; ++i) {
-                arows[i]->update(f.second, i == f.first ? 1 : -1);
-            }
-#endif
-            if (mlp.train(f.first, f.second.data(), &data, &error_data, rate))
-                num_correct += 1;
-        }
+bool ArowTrainer::save(const string& filename, const ModelConfig&) const
+{
+    // Recognizer uses only the means.
+    vector<vector<double>> weights;
+    for (const auto& arow : arows_)
+        weights.push_back(arow.mean());
+    return RecognizerModel::save(filename, weights);
+}
 
-        cout << "training " << times << ": done"
-             << " num = " << training_features.size()
-             << " correct = " << num_correct
-             << endl;
+// Trains MultiLayerPerceptron with synchronous mini-batches. The gradients of a batch
+// are calculated in parallel, and summed up before the update.
+class MlpTrainer {
+public:
+    explicit MlpTrainer(const ModelConfig& config) :
+        mlp_(config.inputSize(), 20, config.numLabels),
+        data_(mlp_.makeForwadingStorage())
+    {
+    }
 
-        if (times % 20 == 0) {
-            // test by all
-            int num = 0;
-            int fail = 0;
-            for (const auto& f : testing_features) {
-                ++num;
-                int result = mlp.predict(f.second.data(), &data);
-                if (result != f.first) {
-                    ++fail;
-                }
+    // Returns the number of the examples predicted correctly before each update.
+    int train(const vector<Example>& examples, float rate, Executor* executor)
+    {
+        const int inputSize = mlp_.numInput();
+        int numCorrect = 0;
+        for (size_t begin = 0; begin < examples.size(); begin += FLAGS_batch_size) {
+            const int n = static_cast<int>(min<size_t>(FLAGS_batch_size, examples.size() - begin));
+            labels_.resize(n);
+            xs_.resize(static_cast<size_t>(n) * inputSize);
+            for (int i = 0; i < n; ++i) {
+                const Example& e = examples[begin + i];
+                labels_[i] = e.label;
+                toFeatures(e, &xs_[static_cast<size_t>(i) * inputSize]);
             }
-
-            cout << "num = " << num << endl;
-            cout << "fail = " << fail << endl;
+            // trainBatch() averages the gradients, so the rate is scaled to match the online training.
+            // The online training decayed the weights by rate * L2 per example, i.e. rate * L2 * n
+            // per batch. trainBatch() decays them by its learning rate * L2, which is already
+            // (rate * n) * L2, so L2 itself must not be scaled by n again.
+            numCorrect += mlp_.trainBatch(labels_.data(), xs_.data(), n, rate * n, MLP_L2_NORMALIZATION,
+                                          executor, executor->numThreads());
         }
+        return numCorrect;
+    }
+
+    int predict(const Example& e)
+    {
+        xs_.resize(e.pixels.size());
+        toFeatures(e, xs_.data());
+        return mlp_.predict(xs_.data(), &data_);
     }
 
-    // test by all
+    bool save(const string& filename, const ModelConfig& config) const
+    {
+        return mlp_.saveParameterAsCSource(filename.c_str(), config.prefix);
+    }
+
+private:
+    learning::MultiLayerPerceptron mlp_;
+    learning::MultiLayerPerceptron::ForwardingIntermediateStorage data_;
+    vector<int> labels_;
+    vector<float> xs_;
+};
+
+template<typename Trainer>
+void test(Trainer* trainer, ExampleStream* stream, mt19937* rnd, bool verbose)
+{
     int num = 0;
     int fail = 0;
-    for (const auto& f : testing_features) {
-        ++num;
-#if 0
-        double vs[RECOGNITION_SIZE] {};
-        for (int i = 0; i < RECOGNITION_SIZE; ++i) {
-            vs[i] = arows[i]->margin(f.second);
-        }
-
-        int result = std::max_element(vs, vs + RECOGNITION_SIZE) - vs;
-#endif
-        int result = mlp.predict(f.second.data(), &data);
-
-        if (result != f.first) {
-            cout << "fail: expect=" << f.first << " actual=" << result << endl;
-#if 0
-            for (int i = 0; i < RECOGNITION_SIZE; ++i)
-                cout << vs[i] << ' ';
-#endif
-            cout << endl;
-            ++fail;
+    stream->forEachChunk(ExampleStream::Split::TESTING, rnd, [&](const vector<Example>& examples) {
+        for (const auto& e : examples) {
+            ++num;
+            int result = trainer->predict(e);
+            if (result != e.label) {
+                if (verbose)
+                    cout << "fail: expect=" << e.label << " actual=" << result << endl;
+                ++fail;
+            }
         }
-    }
+    });
 
     cout << "num = " << num << endl;
     cout << "fail = " << fail << endl;
+}
 
-    CHECK(mlp.saveParameterAsCSource(PARAMETER_FILENAME, COLOR_NAME_PREFIX));
+} // anonymous namespace
 
-#if 0
-    // Save the data as C-array.
-    std::stringstream body;
-    {
-        body << "#include <cstddef>" << endl;
-        body << "#include <cstdint>" << endl;
-
-        for (size_t i = 0; i < RECOGNITION_SIZE; ++i) {
-            body << "const std::size_t " << COLOR_NAME_PREFIX << COLOR_NAMES[i] << "_MEAN_SIZE = "
-                 << arows[i]->mean().size() << ";" << endl;
-            body << "const std::size_t " << COLOR_NAME_PREFIX << COLOR_NAMES[i] << "_COV_SIZE = "
-                 << arows[i]->cov().size() << ";" << endl;
-        }
+int main(int argc, char* argv[])
+{
+    // --num_threads is shared with the other tools, whose default is 1.
+    google::SetCommandLineOptionWithMode("num_threads", DEFAULT_NUM_THREADS, google::SET_FLAGS_DEFAULT);
+    google::ParseCommandLineFlags(&argc, &argv, true);
+    google::InitGoogleLogging(argv[0]);
 
-        for (size_t i = 0; i < RECOGNITION_SIZE; ++i) {
-            body << endl;
-            body << "const double " << COLOR_NAME_PREFIX << COLOR_NAMES[i] << "_MEAN[] = {" << endl;
-            for (size_t j = 0; j < arows[i]->mean().size(); ++j) {
-                if (j % 4 == 0) {
-                    body << "    ";
-                } else {
-                    body << " ";
-                }
-                body << scientific << showpos << setprecision(16) << arows[i]->mean()[j] << ",";
-                if (j % 4 == 3) {
-                    body << std::endl;
-                }
-            }
-            body << "};" << endl;
+    CHECK(FLAGS_model == "arow" || FLAGS_model == "mlp") << "unknown model: " << FLAGS_model;
+    CHECK_GT(FLAGS_num_threads, 0);
+    CHECK_GT(FLAGS_batch_size, 0);
+    CHECK_GT(FLAGS_chunk_size, 0);
+
+    const bool useArow = FLAGS_model == "arow";
+    const ModelConfig& config = useArow ? AROW_CONFIG : MLP_CONFIG;
+    const string filename = FLAGS_output.empty() ? config.filename : FLAGS_output;
+
+    ExampleStream stream(config, corpusFiles(), FLAGS_chunk_size);
+    std::random_device rd;
+    std::mt19937 random_generator(rd());
+
+    Executor executor(FLAGS_num_threads);
+    executor.start();
+
+    unique_ptr<ArowTrainer> arowTrainer(useArow ? new ArowTrainer(config) : nullptr);
+    unique_ptr<MlpTrainer> mlpTrainer(useArow ? nullptr : new MlpTrainer(config));
+
+    for (int times = 0; times < FLAGS_epochs; ++times) {
+        // The same schedule as the online training, which had 500 epochs.
+        float rate = FLAGS_learning_rate;
+        if (times >= FLAGS_epochs * 4 / 5) {
+            rate /= 10;
+        } else if (times >= FLAGS_epochs * 3 / 5) {
+            rate /= 2;
         }
 
-        for (size_t i = 0; i < RECOGNITION_SIZE; ++i) {
-            body << endl;
-            body << "const double " << COLOR_NAME_PREFIX << COLOR_NAMES[i] << "_COV[] = {" << endl;
-            for (size_t j = 0; j < arows[i]->cov().size(); ++j) {
-                if (j % 4 == 0) {
-                    body << "    ";
-                } else {
-                    body << " ";
-                }
-                body << scientific << showpos << setprecision(16) << arows[i]->cov()[j] << ",";
-                if (j % 4 == 3) {
-                    body << std::endl;
-                }
-            }
-            body << "};" << endl;
+        size_t num = 0;
+        int result = 0;
+        stream.forEachChunk(ExampleStream::Split::TRAINING, &random_generator, [&](const vector<Example>& examples) {
+            num += examples.size();
+            if (useArow)
+                result += arowTrainer->train(examples, &executor);
+            else
+                result += mlpTrainer->train(examples, rate, &executor);
+        });
+
+        cout << "training " << times << ": done"
+             << " num = " << num
+             << (useArow ? " mistakes = " : " correct = ") << result
+             << endl;
+
+        if (times % 20 == 0) {
+            if (useArow)
+                test(arowTrainer.get(), &stream, &random_generator, false);
+            else
+                test(mlpTrainer.get(), &stream, &random_generator, false);
         }
     }
 
-    ofstream ofs("classifier_features.cc");
-    ofs << body.str();
-    ofs.close();
-#endif
+    if (useArow) {
+        test(arowTrainer.get(), &stream, &random_generator, true);
+        CHECK(arowTrainer->save(filename, config));
+    } else {
+        test(mlpTrainer.get(), &stream, &random_generator, true);
+        CHECK(mlpTrainer->save(filename, config));
+    }
 
+    executor.stop();
     return 0;
 }
@@ -9,6 +9,7 @@
 #include <gflags/gflags.h>
 #include <glog/logging.h>
 
+#include "base/strings.h"
 #include "capture/ac_analyzer.h"
 #include "capture/capture.h"
 #include "capture/syntek_source.h"
@@ -27,6 +28,10 @@
 #include "wii/null_key_sender.h"
 #include "wii/wii_connect_server.h"
 
+#ifdef USE_V4L2
+#include "capture/viddev_source.h"
+#endif
+
 #if USE_AUDIO_COMMENTATOR
 #include "audio/audio_commentator.h"
 #include "audio/audio_server.h"
@@ -43,6 +48,7 @@ DEFINE_bool(draw_fps, true, "draw FPS");
 DEFINE_bool(draw_frame_number, true, "draw frame number");
 DEFINE_string(source, "syntek",
               "set image source. 'syntek' when using syntek video capture."
+              " 'v4l2:<device>' when using a V4L2 device."
               " filename if you'd like to use movie.");
 DEFINE_int32(fps, 60, "FPS");
 DEFINE_bool(ignore_sigpipe, false, "ignore SIGPIPE");
@@ -51,6 +57,10 @@ DEFINE_bool(use_game_state_recorder, true, "use game state recorder");
 DEFINE_string(record_dir, ".", "directory where game state is recorded");
 DEFINE_bool(record_only_p1_win, false, "game state recorder outputs only p1 win");
 
+#if USE_V4L2
+DEFINE_bool(v4l2_zero_copy, false, "analyze V4L2 frames in place in the device's native YUV format, and convert them to RGB only for drawing");
+#endif
+
 #if USE_AUDIO_COMMENTATOR
 DEFINE_bool(use_audio, false, "use audio commentator");
 #endif
@@ -60,6 +70,14 @@ static unique_ptr<Source> makeVideoSource()
     if (FLAGS_source == "syntek")
         return unique_ptr<Source>(new SyntekSource);
 
+#if USE_V4L2
+    if (strings::hasPrefix(FLAGS_source, "v4l2:")) {
+        string deviceName = FLAGS_source.substr(5);
+        cout << "V4L2 device name: " << deviceName << endl;
+        return unique_ptr<Source>(new VidDevSource(deviceName, FLAGS_v4l2_zero_copy));
+    }
+#endif
+
     MovieSource* source = new MovieSource(FLAGS_source);
     CHECK(source->ok());
     source->setFPS(FLAGS_fps);
@@ -156,7 +174,7 @@ int main(int argc, char* argv[])
 
     unique_ptr<MovieSourceKeyListener> movieSourceKeyListener;
     // TODO(mayah): BAD! Don't check FLAGS_source here.
-    if (FLAGS_fps == 0 && FLAGS_source != "syntek") {
+    if (FLAGS_fps == 0 && FLAGS_source != "syntek" && !strings::hasPrefix(FLAGS_source, "v4l2:")) {
         MovieSource* movieSource = static_cast<MovieSource*>(source.get());
         movieSourceKeyListener.reset(new MovieSourceKeyListener(movieSource));
     }
@@ -6,6 +6,7 @@
 #include "base/time.h"
 #include "capture/analyzer.h"
 #include "capture/source.h"
+#include "capture/yuv_surface.h"
 #include "core/core_field.h"
 #include "core/game_result.h"
 #include "core/frame_response.h"
@@ -25,11 +26,10 @@ using namespace std;
 WiiConnectServer::WiiConnectServer(Source* source, Analyzer* analyzer,
                                    KeySender* p1KeySender, KeySender* p2KeySender,
                                    const string& p1Program, const string& p2Program) :
-    shouldStop_(false),
-    surface_(emptyUniqueSDLSurface()),
-    source_(source),
-    analyzer_(analyzer),
-    keySenders_ { p1KeySender, p2KeySender }
+    drawBuffer_(emptyUniqueSDLSurface()),
+    keySenders_ { p1KeySender, p2KeySender },
+    startTime_(std::chrono::steady_clock::now()),
+    prevTime_(startTime_)
 {
     isAi_[0] = (p1Program != "-");
     isAi_[1] = (p2Program != "-");
@@ -38,13 +38,16 @@ WiiConnectServer::WiiConnectServer(Source* source, Analyzer* analyzer,
     connector_->setPlayer(0, p1Program);
     connector_->setPlayer(1, p2Program);
     connector_->start();
+
+    pipeline_.reset(new CapturePipeline(source, analyzer, [this](CaptureFrame* frame) {
+        return this->publish(frame);
+    }));
 }
 
 WiiConnectServer::~WiiConnectServer()
 {
+    pipeline_->stop();
     connector_->stop();
-    if (th_.joinable())
-        th_.join();
 }
 
 void WiiConnectServer::addObserver(GameStateObserver* observer)
@@ -55,17 +58,13 @@ void WiiConnectServer::addObserver(GameStateObserver* observer)
 
 bool WiiConnectServer::start()
 {
-    th_ = thread([this]() {
-        this->runLoop();
-    });
-    return true;
+    reset();
+    return pipeline_->start();
 }
 
 void WiiConnectServer::stop()
 {
-    shouldStop_ = true;
-    if (th_.joinable())
-        th_.join();
+    pipeline_->stop();
 }
 
 void WiiConnectServer::reset()
@@ -81,137 +80,101 @@ void WiiConnectServer::reset()
     colorsUsed_.fill(false);
 }
 
-void WiiConnectServer::runLoop()
+bool WiiConnectServer::publish(CaptureFrame* frame)
 {
-    reset();
-
-    bool gameStarted = false;
-    int noSurfaceCount = 0;
-    int frameId = 0;
-    UniqueSDLSurface prevSurface(emptyUniqueSDLSurface());
-    UniqueSDLSurface prev2Surface(emptyUniqueSDLSurface());
-    UniqueSDLSurface prev3Surface(emptyUniqueSDLSurface());
-
-    auto start_time = std::chrono::steady_clock::now();
-    auto prev_time = start_time;
-
-    while (!shouldStop_) {
-        UniqueSDLSurface surface(source_->nextFrame());
-
-        auto curr_time = std::chrono::steady_clock::now();
-        auto timeout_time = curr_time + std::chrono::milliseconds(16);
-
-        LOG(INFO) << "TIME"
-                  << " id=" << frameId
-                  << " elapsed=" << std::chrono::duration_cast<std::chrono::milliseconds>(curr_time - start_time).count()
-                  << " from_prev=" << std::chrono::duration_cast<std::chrono::milliseconds>(curr_time - prev_time).count();
-
-        prev_time = curr_time;
-
-        if (!surface.get()) {
-            ++noSurfaceCount;
-            LOG(INFO) << "No surface?: count=" << noSurfaceCount << endl;
-            cout << "No surface? count=" << noSurfaceCount
-                 << " done=" << source_->done() << endl;
-
-            if (source_->done()) {
-                break;
-            }
-
-            // TODO(mayah): Why not sleep?
-            if (noSurfaceCount > 100000) {
-                shouldStop_ = true;
-                break;
-            }
-            continue;
-        }
+    // The deadline is counted from when the frame was captured, not from when it was analyzed,
+    // so that the time spent in the pipeline is also taken into account.
+    auto timeout_time = frame->capturedTime + std::chrono::milliseconds(16);
+
+    LOG(INFO) << "TIME"
+              << " id=" << frameId_
+              << " elapsed=" << std::chrono::duration_cast<std::chrono::milliseconds>(frame->capturedTime - startTime_).count()
+              << " from_prev=" << std::chrono::duration_cast<std::chrono::milliseconds>(frame->capturedTime - prevTime_).count()
+              << " analyzed=" << std::chrono::duration_cast<std::chrono::microseconds>(frame->analyzedTime - frame->capturedTime).count() << "us";
+    prevTime_ = frame->capturedTime;
+
+    unique_ptr<AnalyzerResult> r = move(frame->result);
+    LOG(INFO) << r->toString();
+
+    bool ok = true;
+    switch (r->state()) {
+    case CaptureGameState::UNKNOWN:
+        if (!playForUnknown(frameId_))
+            ok = false;
+        break;
+    case CaptureGameState::LEVEL_SELECT:
+        // TODO(mayah): For workaround, we make frameId = 1.
+        // Server should send some event to initialize a game state.
+        // Client should implement an initialization logic
+        if (!gameStarted_) {
+            // TODO(mayah): initialization should be done after NEXT1/NEXT2 are stabilized?
+            lock_guard<mutex> lock(mu_);
 
-        unique_ptr<AnalyzerResult> r =
-            analyzer_->analyze(surface.get(), prevSurface.get(), prev2Surface.get(), prev3Surface.get(), analyzerResults_);
-        LOG(INFO) << r->toString();
+            // If the first surface is level select, analyzerResults_ might be empty.
+            // So, we need to allow analyzerResults_.empty() here.
+            if (analyzerResults_.empty() || analyzerResults_.front()->state() != CaptureGameState::LEVEL_SELECT) {
+                cout << "New game started" << endl;
+                frameId_ = 1;
+                reset();
+                // The result might contain the previous game's result. We don't want to stabilize the result
+                // with using the previous game's results.
+                // So, remove all the results.
+                analyzerResults_.clear();
+                pipeline_->resetAnalyzerHistory();
+                r->clear();
 
-        switch (r->state()) {
-        case CaptureGameState::UNKNOWN:
-            if (!playForUnknown(frameId))
-                shouldStop_ = true;
-            break;
-        case CaptureGameState::LEVEL_SELECT:
-            // TODO(mayah): For workaround, we make frameId = 1.
-            // Server should send some event to initialize a game state.
-            // Client should implement an initialization logic
-            if (!gameStarted) {
-                // TODO(mayah): initialization should be done after NEXT1/NEXT2 are stabilized?
-                lock_guard<mutex> lock(mu_);
-
-                // If the first surface is level select, analyzerResults_ might be empty.
-                // So, we need to allow analyzerResults_.empty() here.
-                if (analyzerResults_.empty() || analyzerResults_.front()->state() != CaptureGameState::LEVEL_SELECT) {
-                    cout << "New game started" << endl;
-                    frameId = 1;
-                    reset();
-                    // The result might contain the previous game's result. We don't want to stabilize the result
-                    // with using the previous game's results.
-                    // So, remove all the results.
-                    analyzerResults_.clear();
-                    r->clear();
-
-                    for (auto observer : observers_) {
-                        observer->newGameWillStart();
-                    }
-                    gameStarted = true;
-                }
-            }
-            if (!playForLevelSelect(frameId, *r, timeout_time))
-                shouldStop_ = true;
-            break;
-        case CaptureGameState::PLAYING: {
-            if (!playForPlaying(frameId, *r, timeout_time))
-                shouldStop_ = true;
-            GameState gameState = toGameState(frameId, *r);
-            for (auto observer : observers_)
-                observer->onUpdate(gameState);
-            break;
-        }
-        case CaptureGameState::MATCH_FINISHED_WITH_DRAW:
-        case CaptureGameState::MATCH_FINISHED_WITH_1P_WIN:
-        case CaptureGameState::MATCH_FINISHED_WITH_2P_WIN:
-        case CaptureGameState::GAME_FINISHED_WITH_DRAW:
-        case CaptureGameState::GAME_FINISHED_WITH_1P_WIN:
-        case CaptureGameState::GAME_FINISHED_WITH_2P_WIN:
-            cout << "game finished detected: started?=" << gameStarted << endl;
-            if (!playForFinished(frameId, gameStarted, *r, timeout_time))
-                shouldStop_ = true;
-            if (gameStarted) {
-                GameResult gameResult = GameResult::DRAW;
-                if (r->state() == CaptureGameState::GAME_FINISHED_WITH_1P_WIN || r->state() == CaptureGameState::MATCH_FINISHED_WITH_1P_WIN)
-                    gameResult = GameResult::P1_WIN;
-                if (r->state() == CaptureGameState::GAME_FINISHED_WITH_2P_WIN || r->state() == CaptureGameState::MATCH_FINISHED_WITH_2P_WIN)
-                    gameResult = GameResult::P2_WIN;
                 for (auto observer : observers_) {
-                    // TODO(mayah): This is not DRAW, of course.
-                    observer->gameHasDone(gameResult);
+                    observer->newGameWillStart();
                 }
-                gameStarted = false;
+                gameStarted_ = true;
             }
-            break;
         }
-
-        // We set frameId to surface's userdata. This will be useful for saving screen shot.
-        surface->userdata = reinterpret_cast<void*>(static_cast<uintptr_t>(frameId));
-
-        {
-            lock_guard<mutex> lock(mu_);
-            prev3Surface = move(prev2Surface);
-            prev2Surface = move(prevSurface);
-            prevSurface = move(surface_);
-            surface_ = move(surface);
-            analyzerResults_.push_front(move(r));
-            while (analyzerResults_.size() > 10)
-                analyzerResults_.pop_back();
+        if (!playForLevelSelect(frameId_, *r, timeout_time))
+            ok = false;
+        break;
+    case CaptureGameState::PLAYING: {
+        if (!playForPlaying(frameId_, *r, timeout_time))
+            ok = false;
+        GameState gameState = toGameState(frameId_, *r);
+        for (auto observer : observers_)
+            observer->onUpdate(gameState);
+        break;
+    }
+    case CaptureGameState::MATCH_FINISHED_WITH_DRAW:
+    case CaptureGameState::MATCH_FINISHED_WITH_1P_WIN:
+    case CaptureGameState::MATCH_FINISHED_WITH_2P_WIN:
+    case CaptureGameState::GAME_FINISHED_WITH_DRAW:
+    case CaptureGameState::GAME_FINISHED_WITH_1P_WIN:
+    case CaptureGameState::GAME_FINISHED_WITH_2P_WIN:
+        cout << "game finished detected: started?=" << gameStarted_ << endl;
+        if (!playForFinished(frameId_, gameStarted_, *r, timeout_time))
+            ok = false;
+        if (gameStarted_) {
+            GameResult gameResult = GameResult::DRAW;
+            if (r->state() == CaptureGameState::GAME_FINISHED_WITH_1P_WIN || r->state() == CaptureGameState::MATCH_FINISHED_WITH_1P_WIN)
+                gameResult = GameResult::P1_WIN;
+            if (r->state() == CaptureGameState::GAME_FINISHED_WITH_2P_WIN || r->state() == CaptureGameState::MATCH_FINISHED_WITH_2P_WIN)
+                gameResult = GameResult::P2_WIN;
+            for (auto observer : observers_) {
+                // TODO(mayah): This is not DRAW, of course.
+                observer->gameHasDone(gameResult);
+            }
+            gameStarted_ = false;
         }
+        break;
+    }
 
-        frameId++;
+    {
+        lock_guard<mutex> lock(mu_);
+        surface_ = frame->surface;
+        surfaceFrameId_ = frameId_;
+        analyzerResults_.push_front(move(r));
+        while (analyzerResults_.size() > 10)
+            analyzerResults_.pop_back();
     }
+
+    frameId_++;
+    return ok;
 }
 
 bool WiiConnectServer::playForUnknown(int frameId)
@@ -543,9 +506,15 @@ void WiiConnectServer::draw(Screen* screen)
     if (!surface_.get())
         return;
 
-    surface->userdata = surface_->userdata;
+    // A YUV frame is converted to RGB only here.
+    SDL_Surface* drawable = toDrawableSurface(surface_.get(), &drawBuffer_);
+    if (!drawable)
+        return;
+
+    // FrameNumberDrawer shows the frame id.
+    surface->userdata = reinterpret_cast<void*>(static_cast<uintptr_t>(surfaceFrameId_));
     SDL_Rect dstRect = screen->mainBox().toSDLRect();
-    SDL_BlitScaled(surface_.get(), nullptr, surface, &dstRect);
+    SDL_BlitScaled(drawable, nullptr, surface, &dstRect);
 }
 
 unique_ptr<AnalyzerResult> WiiConnectServer::analyzerResult() const
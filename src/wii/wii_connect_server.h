@@ -8,10 +8,10 @@
 #include <memory>
 #include <mutex>
 #include <string>
-#include <thread>
 
 #include "base/base.h"
 #include "capture/analyzer_result_drawer.h"
+#include "capture/capture_pipeline.h"
 #include "core/decision.h"
 #include "core/frame_request.h"
 #include "core/kumipuyo.h"
@@ -47,7 +47,8 @@ public:
 
 private:
     void reset();
-    void runLoop();
+    // Called for each analyzed frame on the publisher thread of |pipeline_|.
+    bool publish(CaptureFrame*);
 
     bool playForUnknown(int frameId);
     bool playForLevelSelect(int frameId, const AnalyzerResult&, const std::chrono::steady_clock::time_point& timeout_time);
@@ -61,21 +62,27 @@ private:
 
     GameState toGameState(int frameId, const AnalyzerResult&);
 
-    std::thread th_;
-    volatile bool shouldStop_;
     std::unique_ptr<ConnectorManager> connector_;
+    std::unique_ptr<CapturePipeline> pipeline_;
 
     std::vector<GameStateObserver*> observers_;
 
-    // These 3 field should be used for only drawing.
+    // These fields should be used for only drawing.
     mutable std::mutex mu_;
-    UniqueSDLSurface surface_;
+    SharedSDLSurface surface_;
+    int surfaceFrameId_ = 0;
+    // Holds |surface_| converted to RGB when it's a YUV surface.
+    UniqueSDLSurface drawBuffer_;
     std::deque<std::unique_ptr<AnalyzerResult>> analyzerResults_;
 
-    Source* source_;
-    Analyzer* analyzer_;
     KeySender* keySenders_[2];
 
+    // These are used only in the publisher thread.
+    bool gameStarted_ = false;
+    int frameId_ = 0;
+    std::chrono::steady_clock::time_point startTime_;
+    std::chrono::steady_clock::time_point prevTime_;
+
     std::map<RealColor, PuyoColor> colorMap_;
     std::array<bool, 4> colorsUsed_;
 